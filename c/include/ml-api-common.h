@@ -67,6 +67,24 @@ typedef enum {
  */
 typedef unsigned int ml_tensor_dimension[ML_TENSOR_RANK_LIMIT];
 
+/**
+ * @brief The maximum rank of the tensors information created with ml_tensors_info_create_extended().
+ * @since_tizen 7.0
+ */
+#define ML_TENSOR_RANK_LIMIT_EXTENDED  (8)
+
+/**
+ * @brief The maximum number of tensors in the tensors information created with ml_tensors_info_create_extended().
+ * @since_tizen 7.0
+ */
+#define ML_TENSOR_SIZE_LIMIT_EXTENDED  (256)
+
+/**
+ * @brief The dimensions of a tensor with the extended rank. The unused dimensions should be 1.
+ * @since_tizen 7.0
+ */
+typedef unsigned int ml_tensor_dimension_extended[ML_TENSOR_RANK_LIMIT_EXTENDED];
+
 /**
  * @brief A handle of a tensors metadata instance.
  * @since_tizen 5.5
@@ -79,6 +97,34 @@ typedef void *ml_tensors_info_h;
  */
 typedef void *ml_tensors_data_h;
 
+/**
+ * @brief The alignment of tensor buffers in bytes, allocated with #ML_TENSORS_DATA_FLAG_ALIGNED.
+ * @since_tizen 7.0
+ */
+#define ML_TENSORS_DATA_ALIGNMENT (64)
+
+/**
+ * @brief Flags for the allocation of tensor buffers. See ml_tensors_data_create_full().
+ * @since_tizen 7.0
+ */
+typedef enum {
+  ML_TENSORS_DATA_FLAG_NONE = 0, /**< Default allocation, same as ml_tensors_data_create(). */
+  ML_TENSORS_DATA_FLAG_ALIGNED = (1 << 0), /**< Align each tensor buffer to #ML_TENSORS_DATA_ALIGNMENT bytes. */
+  ML_TENSORS_DATA_FLAG_NO_ZERO_FILL = (1 << 1), /**< Do not fill the tensor buffers with zero. The contents are undefined. */
+  ML_TENSORS_DATA_FLAG_HUGE_PAGE = (1 << 2), /**< Use the transparent huge pages for large tensors if the system supports it. This implies #ML_TENSORS_DATA_FLAG_ALIGNED. */
+  ML_TENSORS_DATA_FLAG_CONTIGUOUS = (1 << 3), /**< Allocate all tensors in a single block. The offset of each tensor is aligned to #ML_TENSORS_DATA_ALIGNMENT bytes. This implies #ML_TENSORS_DATA_FLAG_ALIGNED. */
+} ml_tensors_data_flag_e;
+
+/**
+ * @brief The allocator of tensor buffers. See ml_tensors_data_create_full().
+ * @since_tizen 7.0
+ */
+typedef struct {
+  void *(*alloc) (size_t size, size_t alignment, void *user_data); /**< Allocates a buffer of @a size bytes. @a alignment is 0 if not required. Returns NULL if failed. */
+  void (*free) (void *mem, void *user_data); /**< Releases the buffer allocated with alloc. */
+  void *user_data; /**< The user data passed to the allocator. */
+} ml_tensors_data_allocator_s;
+
 /**
  * @brief Possible data element types of tensor in NNStreamer.
  * @since_tizen 5.5
@@ -113,6 +159,36 @@ typedef enum _ml_tensor_type_e
  */
 int ml_tensors_info_create (ml_tensors_info_h *info);
 
+/**
+ * @brief Creates a tensors information handle without the internal lock.
+ * @details The handle is confined to the thread that creates it. The functions accessing the handle do not lock it, thus the application should not access the handle in other threads.
+ *          In the debug build, the access from other threads is reported as a critical message.
+ * @since_tizen 7.0
+ * @param[out] info The handle of tensors information.
+ * @return @c 0 on success. Otherwise a negative error value.
+ * @retval #ML_ERROR_NONE Successful.
+ * @retval #ML_ERROR_NOT_SUPPORTED Not supported.
+ * @retval #ML_ERROR_INVALID_PARAMETER Given parameter is invalid.
+ * @retval #ML_ERROR_OUT_OF_MEMORY Failed to allocate required memory.
+ */
+int ml_tensors_info_create_unlocked (ml_tensors_info_h *info);
+
+/**
+ * @brief Creates a tensors information handle supporting more tensors and higher rank.
+ * @details The handle may have up to #ML_TENSOR_SIZE_LIMIT_EXTENDED tensors of rank up to #ML_TENSOR_RANK_LIMIT_EXTENDED. The storage of tensors beyond #ML_TENSOR_SIZE_LIMIT is allocated with the number of tensors.
+ *          Use ml_tensors_info_set_tensor_dimension_extended() and ml_tensors_info_get_tensor_dimension_extended() to access the dimension with higher rank.
+ *          ml_tensors_info_get_tensor_dimension() folds the dimensions beyond #ML_TENSOR_RANK_LIMIT into the last one, thus the number of elements is kept.
+ * @since_tizen 7.0
+ * @remarks The pipeline and single-shot APIs support #ML_TENSOR_SIZE_LIMIT tensors.
+ * @param[out] info The handle of tensors information.
+ * @return @c 0 on success. Otherwise a negative error value.
+ * @retval #ML_ERROR_NONE Successful.
+ * @retval #ML_ERROR_NOT_SUPPORTED Not supported.
+ * @retval #ML_ERROR_INVALID_PARAMETER Given parameter is invalid.
+ * @retval #ML_ERROR_OUT_OF_MEMORY Failed to allocate required memory.
+ */
+int ml_tensors_info_create_extended (ml_tensors_info_h *info);
+
 /**
  * @brief Frees the given handle of a tensors information.
  * @since_tizen 5.5
@@ -153,7 +229,7 @@ int ml_tensors_info_clone (ml_tensors_info_h dest, const ml_tensors_info_h src);
  * @brief Sets the number of tensors with given handle of tensors information.
  * @since_tizen 5.5
  * @param[in] info The handle of tensors information.
- * @param[in] count The number of tensors.
+ * @param[in] count The number of tensors. The maximum is #ML_TENSOR_SIZE_LIMIT, or #ML_TENSOR_SIZE_LIMIT_EXTENDED if the handle is created with ml_tensors_info_create_extended().
  * @return @c 0 on success. Otherwise a negative error value.
  * @retval #ML_ERROR_NONE Successful.
  * @retval #ML_ERROR_NOT_SUPPORTED Not supported.
@@ -252,6 +328,33 @@ int ml_tensors_info_set_tensor_dimension (ml_tensors_info_h info, unsigned int i
  */
 int ml_tensors_info_get_tensor_dimension (ml_tensors_info_h info, unsigned int index, ml_tensor_dimension dimension);
 
+/**
+ * @brief Sets the tensor dimension with the extended rank.
+ * @details The dimensions beyond #ML_TENSOR_RANK_LIMIT should be 1 unless the handle is created with ml_tensors_info_create_extended().
+ * @since_tizen 7.0
+ * @param[in] info The handle of tensors information.
+ * @param[in] index The index of the tensor to be updated.
+ * @param[in] dimension The tensor dimension to be set.
+ * @return @c 0 on success. Otherwise a negative error value.
+ * @retval #ML_ERROR_NONE Successful.
+ * @retval #ML_ERROR_NOT_SUPPORTED Not supported.
+ * @retval #ML_ERROR_INVALID_PARAMETER Given parameter is invalid.
+ */
+int ml_tensors_info_set_tensor_dimension_extended (ml_tensors_info_h info, unsigned int index, const ml_tensor_dimension_extended dimension);
+
+/**
+ * @brief Gets the tensor dimension with the extended rank.
+ * @since_tizen 7.0
+ * @param[in] info The handle of tensors information.
+ * @param[in] index The index of the tensor.
+ * @param[out] dimension The tensor dimension. The unused dimensions are 1.
+ * @return @c 0 on success. Otherwise a negative error value.
+ * @retval #ML_ERROR_NONE Successful.
+ * @retval #ML_ERROR_NOT_SUPPORTED Not supported.
+ * @retval #ML_ERROR_INVALID_PARAMETER Given parameter is invalid.
+ */
+int ml_tensors_info_get_tensor_dimension_extended (ml_tensors_info_h info, unsigned int index, ml_tensor_dimension_extended dimension);
+
 /**
  * @brief Gets the size of tensors data in the given tensors information handle in bytes.
  * @details If an application needs to get the total byte size of tensors, set the @a index '-1'. Note that the maximum number of tensors is 16 (#ML_TENSOR_SIZE_LIMIT).
@@ -280,6 +383,85 @@ int ml_tensors_info_get_tensor_size (ml_tensors_info_h info, int index, size_t *
  */
 int ml_tensors_data_create (const ml_tensors_info_h info, ml_tensors_data_h *data);
 
+/**
+ * @brief Creates a tensor data frame with the given tensors information, flags and allocator.
+ * @details The tensor buffers are allocated with @a allocator, or the default allocator of the system if @a allocator is NULL.
+ *          Use #ML_TENSORS_DATA_FLAG_ALIGNED for the SIMD kernels, and #ML_TENSORS_DATA_FLAG_NO_ZERO_FILL if the application overwrites the buffers anyway.
+ * @since_tizen 7.0
+ * @remarks The allocator should be valid until the data is destroyed.
+ * @remarks The data allocated with @a allocator cannot be pushed into the pipeline with #ML_PIPELINE_BUF_POLICY_AUTO_FREE.
+ * @param[in] info The handle of tensors information for the allocation.
+ * @param[in] flags The bitwise OR of #ml_tensors_data_flag_e.
+ * @param[in] allocator The allocator of tensor buffers. Set NULL to use the default allocator.
+ * @param[out] data The handle of tensors data. The caller is responsible for freeing the allocated data with ml_tensors_data_destroy().
+ * @return @c 0 on success. Otherwise a negative error value.
+ * @retval #ML_ERROR_NONE Successful.
+ * @retval #ML_ERROR_NOT_SUPPORTED Not supported.
+ * @retval #ML_ERROR_INVALID_PARAMETER Given parameter is invalid.
+ * @retval #ML_ERROR_OUT_OF_MEMORY Failed to allocate required memory.
+ */
+int ml_tensors_data_create_full (const ml_tensors_info_h info, int flags, const ml_tensors_data_allocator_s *allocator, ml_tensors_data_h *data);
+
+/**
+ * @brief Allocates a tensor data frame without the internal lock.
+ * @details The handle is confined to the thread that creates it. The functions accessing the handle do not lock it, thus the application should not access the handle in other threads.
+ *          In the debug build, the access from other threads is reported as a critical message.
+ * @since_tizen 7.0
+ * @param[in] info The handle of tensors information for the allocation.
+ * @param[out] data The handle of tensors data. The caller is responsible for freeing the allocated data with ml_tensors_data_destroy().
+ * @return @c 0 on success. Otherwise a negative error value.
+ * @retval #ML_ERROR_NONE Successful.
+ * @retval #ML_ERROR_NOT_SUPPORTED Not supported.
+ * @retval #ML_ERROR_INVALID_PARAMETER Given parameter is invalid.
+ * @retval #ML_ERROR_OUT_OF_MEMORY Failed to allocate required memory.
+ */
+int ml_tensors_data_create_unlocked (const ml_tensors_info_h info, ml_tensors_data_h *data);
+
+/**
+ * @brief Gets the single block of all tensors in the given handle.
+ * @details The handle should be created with #ML_TENSORS_DATA_FLAG_CONTIGUOUS. The block starts with the first tensor, and the offset of each tensor is aligned to #ML_TENSORS_DATA_ALIGNMENT bytes.
+ *          The application may copy the whole frame at once with the block. Do not deallocate the returned block.
+ * @since_tizen 7.0
+ * @param[in] data The handle of tensors data.
+ * @param[out] raw_data The block of tensors in the handle.
+ * @param[out] data_size Byte size of the block, including the padding between tensors.
+ * @return @c 0 on success. Otherwise a negative error value.
+ * @retval #ML_ERROR_NONE Successful.
+ * @retval #ML_ERROR_NOT_SUPPORTED Not supported.
+ * @retval #ML_ERROR_INVALID_PARAMETER Given parameter is invalid, or the tensors are not allocated in a single block.
+ */
+int ml_tensors_data_get_block_data (ml_tensors_data_h data, void **raw_data, size_t *data_size);
+
+/**
+ * @brief Creates a new handle sharing the tensor buffers of the given tensors data.
+ * @details The handles sharing the tensors are copy-on-write. The functions writing the tensor of a shared handle (e.g., ml_tensors_data_set_tensor_data(), ml_tensors_data_normalize(), ml_tensors_data_transpose(), ml_tensors_data_convert() and the output of ml_single_invoke_fast()) copy the tensor to be updated, thus the other handles are not changed.
+ *          The new handle has the same flags and allocator of @a data, and the copy is allocated with them. If the tensors are in a single block (#ML_TENSORS_DATA_FLAG_CONTIGUOUS), the whole block is copied, so ml_tensors_data_get_block_data() is still available.
+ *          The application can pass a frame to multiple consumers without copying the tensors. Do not write to the tensor from ml_tensors_data_get_tensor_data() directly, because it may be shared with other handles.
+ *          The shared buffers are released when all the handles sharing them are released with ml_tensors_data_unref() or ml_tensors_data_destroy().
+ * @since_tizen 7.0
+ * @remarks The handle sharing the tensors cannot be pushed into the pipeline with #ML_PIPELINE_BUF_POLICY_AUTO_FREE.
+ * @param[in] data The handle of tensors data, which is created with ml_tensors_data_create() or ml_tensors_data_create_full().
+ * @param[out] ref_data The new handle sharing the tensors of @a data. The caller is responsible for releasing it with ml_tensors_data_unref().
+ * @return @c 0 on success. Otherwise a negative error value.
+ * @retval #ML_ERROR_NONE Successful.
+ * @retval #ML_ERROR_NOT_SUPPORTED Not supported, or the handle has more than #ML_TENSOR_SIZE_LIMIT tensors.
+ * @retval #ML_ERROR_INVALID_PARAMETER Given parameter is invalid, or the handle does not own its tensor buffers.
+ * @retval #ML_ERROR_OUT_OF_MEMORY Failed to allocate required memory.
+ */
+int ml_tensors_data_ref (ml_tensors_data_h data, ml_tensors_data_h *ref_data);
+
+/**
+ * @brief Releases the handle of tensors data. The shared tensor buffers are released when the last handle sharing them is released.
+ * @details This is same as ml_tensors_data_destroy().
+ * @since_tizen 7.0
+ * @param[in] data The handle of tensors data.
+ * @return @c 0 on success. Otherwise a negative error value.
+ * @retval #ML_ERROR_NONE Successful.
+ * @retval #ML_ERROR_NOT_SUPPORTED Not supported.
+ * @retval #ML_ERROR_INVALID_PARAMETER Given parameter is invalid.
+ */
+int ml_tensors_data_unref (ml_tensors_data_h data);
+
 /**
  * @brief Frees the given tensors' data handle.
  * @details Note that the opened handle should be closed before calling this function in the case of a single API.
@@ -323,6 +505,88 @@ int ml_tensors_data_get_tensor_data (ml_tensors_data_h data, unsigned int index,
  */
 int ml_tensors_data_set_tensor_data (ml_tensors_data_h data, unsigned int index, const void *raw_data, const size_t data_size);
 
+/**
+ * @brief Normalizes the uint8 tensor into the float32 tensor with mean and standard deviation.
+ * @details The output value is (input - mean[c]) / std[c], where c is the channel of the element (the innermost dimension, e.g., NHWC).
+ *          To scale the value into [0, 1], set @a mean to 0 and @a std to 255.
+ *          This function uses the vector instructions of CPU (e.g., AVX2 or NEON) if available.
+ * @since_tizen 7.0
+ * @param[in] in The handle of tensors data with uint8 tensor.
+ * @param[out] out The handle of tensors data to get the float32 tensor. The size of tensor should be 4 times of the input tensor.
+ * @param[in] index The index of the tensor.
+ * @param[in] mean The array of mean values for each channel.
+ * @param[in] std The array of standard deviations for each channel.
+ * @param[in] channels The number of channels (the length of @a mean and @a std).
+ * @return @c 0 on success. Otherwise a negative error value.
+ * @retval #ML_ERROR_NONE Successful.
+ * @retval #ML_ERROR_NOT_SUPPORTED Not supported.
+ * @retval #ML_ERROR_INVALID_PARAMETER Given parameter is invalid.
+ */
+int ml_tensors_data_normalize (const ml_tensors_data_h in, ml_tensors_data_h out, unsigned int index, const float *mean, const float *std, unsigned int channels);
+
+/**
+ * @brief Transposes the tensor between channel-last (NHWC) and channel-first (NCHW) layouts.
+ * @since_tizen 7.0
+ * @param[in] in The handle of tensors data.
+ * @param[out] out The handle of tensors data to get the transposed tensor. The size of tensor should be the same as the input tensor.
+ * @param[in] index The index of the tensor.
+ * @param[in] element_size The byte size of an element in the tensor.
+ * @param[in] channels The number of channels.
+ * @param[in] batch The batch size.
+ * @param[in] to_channel_first @c true to transpose NHWC into NCHW, @c false to transpose NCHW into NHWC.
+ * @return @c 0 on success. Otherwise a negative error value.
+ * @retval #ML_ERROR_NONE Successful.
+ * @retval #ML_ERROR_NOT_SUPPORTED Not supported.
+ * @retval #ML_ERROR_INVALID_PARAMETER Given parameter is invalid.
+ */
+int ml_tensors_data_transpose (const ml_tensors_data_h in, ml_tensors_data_h out, unsigned int index, size_t element_size, unsigned int channels, unsigned int batch, bool to_channel_first);
+
+/**
+ * @brief Gets the index of the max value in the tensor (e.g., the class of logits).
+ * @details If there are several max values, this returns the first index. This function uses the vector instructions of CPU (e.g., AVX2 or NEON) for float32 tensor if available.
+ * @since_tizen 7.0
+ * @param[in] data The handle of tensors data.
+ * @param[in] index The index of the tensor.
+ * @param[in] type The type of tensor element.
+ * @param[out] result The index of the max value.
+ * @return @c 0 on success. Otherwise a negative error value.
+ * @retval #ML_ERROR_NONE Successful.
+ * @retval #ML_ERROR_NOT_SUPPORTED Not supported.
+ * @retval #ML_ERROR_INVALID_PARAMETER Given parameter is invalid.
+ */
+int ml_tensors_data_argmax (const ml_tensors_data_h data, unsigned int index, ml_tensor_type_e type, unsigned int *result);
+
+/**
+ * @brief The parameters of the per-tensor affine quantization. The real value is (quantized value - zero_point) * scale.
+ * @since_tizen 7.0
+ */
+typedef struct {
+  float scale; /**< The scale of the quantization, should be larger than 0. */
+  int zero_point; /**< The quantized value of real 0. */
+} ml_tensor_quant_param_s;
+
+/**
+ * @brief Converts the type of tensor elements (e.g., uint8 frame into float32 tensor).
+ * @details Without @a quant, each element is converted to the value of the output type. The integer output is truncated toward zero and saturated to the range of the type.
+ *          With @a quant, this dequantizes the integer tensor into the float tensor, or quantizes the float tensor into the integer tensor. The quantized value is rounded to the nearest integer and saturated.
+ *          The conversion runs in place if @a in and @a out are same handle and the types have the same element size (e.g., float32 and int32).
+ *          This function uses the vector instructions of CPU (e.g., AVX2 or NEON) if available, for uint8 or int8 to float32 and float32 to uint8 or int8.
+ *          The 64-bit integer larger than 2^53 may lose the precision when it is converted to other type.
+ * @since_tizen 7.0
+ * @param[in] in The handle of input tensors data.
+ * @param[out] out The handle of output tensors data. The size of tensor should be the number of elements multiplied by the size of output type.
+ * @param[in] index The index of the tensor.
+ * @param[in] in_type The type of input tensor element.
+ * @param[in] out_type The type of output tensor element.
+ * @param[in] quant The parameters of the quantization, or NULL. Either of input or output type should be the float type if given.
+ * @return @c 0 on success. Otherwise a negative error value.
+ * @retval #ML_ERROR_NONE Successful.
+ * @retval #ML_ERROR_NOT_SUPPORTED Not supported.
+ * @retval #ML_ERROR_INVALID_PARAMETER Given parameter is invalid.
+ * @retval #ML_ERROR_OUT_OF_MEMORY Failed to allocate required memory.
+ */
+int ml_tensors_data_convert (const ml_tensors_data_h in, ml_tensors_data_h out, unsigned int index, ml_tensor_type_e in_type, ml_tensor_type_e out_type, const ml_tensor_quant_param_s *quant);
+
 
 /**
  * @brief Returns a human-readable string describing the last error.
@@ -331,6 +595,9 @@ int ml_tensors_data_set_tensor_data (ml_tensors_data_h data, unsigned int index,
  *         funcctions in the Machine Learning API since the last call to
  *         ml_error(). The returned string should *not* be freed or
  *         overwritten by the caller.
+ *         The error is kept for each thread, so this describes the error
+ *         from the calls in the same thread. The returned string is valid
+ *         until the next call of the Machine Learning API in the thread.
  * @since_tizen 7.0
  * @return @c Null if no error to be reported. Otherwise the error description.
  */
@@ -347,6 +614,30 @@ const char * ml_error (void);
  */
 const char * ml_strerror (int errnum);
 
+/**
+ * @brief Callback to get the number of errors in a source location of the Machine Learning API.
+ * @since_tizen 7.0
+ * @param[in] file The source file where the errors occurred.
+ * @param[in] func The function where the errors occurred.
+ * @param[in] line The line number in the source file.
+ * @param[in] count The number of errors in the location, including the ones whose logs are suppressed.
+ * @param[in] user_data The user data passed to ml_error_foreach_count().
+ */
+typedef void (*ml_error_count_cb) (const char *file, const char *func, int line, unsigned int count, void *user_data);
+
+/**
+ * @brief Iterates the source locations of the Machine Learning API where errors occurred, with the number of errors.
+ * @details The error logs of each location are rate-limited, but every error is counted. Applications may use this to monitor frequent errors without parsing the logs.
+ *          The callback is called in the calling thread before this function returns. The locations without any error are not iterated.
+ * @since_tizen 7.0
+ * @param[in] cb The callback to be called for each source location.
+ * @param[in] user_data The user data to be passed to the callback.
+ * @return @c 0 on success. Otherwise a negative error value.
+ * @retval #ML_ERROR_NONE Successful.
+ * @retval #ML_ERROR_INVALID_PARAMETER Given parameter is invalid.
+ */
+int ml_error_foreach_count (ml_error_count_cb cb, void *user_data);
+
 /**
  * @}
  */
@@ -88,6 +88,24 @@ typedef void *ml_custom_easy_filter_h;
  */
 typedef void *ml_pipeline_if_h;
 
+/**
+ * @brief A handle of a pipeline template, the parsed and validated pipeline description with parameters.
+ * @since_tizen 7.0
+ */
+typedef void *ml_pipeline_template_h;
+
+/**
+ * @brief A handle of a pipeline pool, the ready pipelines constructed from a template.
+ * @since_tizen 7.0
+ */
+typedef void *ml_pipeline_pool_h;
+
+/**
+ * @brief A handle of a batch, which merges the frames of multiple streams into a src node of NNStreamer pipeline.
+ * @since_tizen 7.0
+ */
+typedef void *ml_pipeline_batch_h;
+
 /**
  * @brief Types of NNFWs.
  * @details To check if a nnfw-type is supported in a system, an application may call the API, ml_check_nnfw_availability().
@@ -166,6 +184,25 @@ typedef enum {
   ML_PIPELINE_SWITCH_INPUT_SELECTOR			= 1, /**< GstInputSelector */
 } ml_pipeline_switch_e;
 
+/**
+ * @brief Enumeration for the flags of custom-easy filter.
+ * @since_tizen 7.0
+ */
+typedef enum {
+  ML_CUSTOM_EASY_FLAG_NONE = 0,               /**< Default, the invoke callback is called serially. */
+  ML_CUSTOM_EASY_FLAG_REENTRANT = (1 << 0),   /**< The invoke callback is re-entrant (thread-safe). The pipelines may call the callback concurrently. */
+} ml_custom_easy_flag_e;
+
+/**
+ * @brief Enumeration for the built-in conditions of tensor_if.
+ * @details The built-in conditions find the max value (score) of a tensor and its index (class), and compare them without calling the application.
+ * @since_tizen 7.0
+ */
+typedef enum {
+  ML_PIPELINE_IF_CONDITION_MAX_SCORE_GT = 0,  /**< TRUE if the max score is greater than the threshold. */
+  ML_PIPELINE_IF_CONDITION_CLASS_IN_SET = 1,  /**< TRUE if the class of the max score is in the given set and the max score is greater than the threshold. */
+} ml_pipeline_if_condition_e;
+
 /**
  * @brief Callback for sink element of NNStreamer pipelines (pipeline's output).
  * @details If an application wants to accept data outputs of an NNStreamer stream, use this callback to get data from the stream. Note that the buffer may be deallocated after the return and this is synchronously called. Thus, if you need the data afterwards, copy the data to another buffer and return fast. Do not spend too much time in the callback. It is recommended to use very small tensors at sinks.
@@ -187,6 +224,28 @@ typedef void (*ml_pipeline_sink_cb) (const ml_tensors_data_h data, const ml_tens
  */
 typedef void (*ml_pipeline_state_cb) (ml_pipeline_state_e state, void *user_data);
 
+/**
+ * @brief Callback to notify the completion of asynchronous pipeline operation.
+ * @details This callback is called when the operation requested with ml_pipeline_start_async() or ml_pipeline_destroy_async() is done. Do not spend too much time in the callback.
+ * @since_tizen 7.0
+ * @remarks The callback may be called in the internal thread of the pipeline.
+ * @param[in] status The result of the operation. #ML_ERROR_NONE if the operation is done successfully.
+ * @param[in] user_data User application's private data.
+ */
+typedef void (*ml_pipeline_async_cb) (int status, void *user_data);
+
+/**
+ * @brief Callback for the output of each stream in the batch.
+ * @details The batch splits the output of sink node into the frames of streams, and calls this callback for each stream which pushed the frame into the batch.
+ * @since_tizen 7.0
+ * @remarks The @a data and @a info can be used only in the callback. To use outside, make a copy.
+ * @param[in] stream_id The index of stream given to ml_pipeline_batch_input_data().
+ * @param[in] data The handle of the tensor output of the stream.
+ * @param[in] info The handle of tensors information of the stream, the batch dimension is 1.
+ * @param[in,out] user_data User application's private data.
+ */
+typedef void (*ml_pipeline_batch_cb) (unsigned int stream_id, const ml_tensors_data_h data, const ml_tensors_info_h info, void *user_data);
+
 /**
  * @brief Callback for custom condition of tensor_if.
  * @since_tizen 6.5
@@ -215,6 +274,46 @@ typedef int (*ml_pipeline_if_custom_cb) (const ml_tensors_data_h data, const ml_
  */
 typedef int (*ml_custom_easy_invoke_cb) (const ml_tensors_data_h in, ml_tensors_data_h out, void *user_data);
 
+/**
+ * @brief The number of buckets in the latency histogram of pipeline statistics.
+ * @details The upper bounds of the buckets are 100us, 500us, 1ms, 5ms, 10ms, 50ms, 100ms and unlimited.
+ * @since_tizen 7.0
+ */
+#define ML_PIPELINE_LATENCY_HISTOGRAM_SIZE (8)
+
+/**
+ * @brief The statistics of a node in the pipeline.
+ * @details The processing latency is the time between a frame arriving at the node and the output frame leaving it.
+ *          The output frame is paired with the input frame of the same timestamp. If the frames have no timestamp, only the node with a single sink pad (e.g., valve, tensor_filter and tensor_if) pairs the output frame with the last input frame.
+ *          The input frame is counted as dropped if a later input frame is pushed out first (e.g., closed valve or skipped frame in tensor_if), or if more than 16 frames are waiting in the node.
+ *          The latency, dropped frames and queue depth are not valid for the node which creates new frames from the input (e.g., muxing or batching elements), and for the node without timestamps and with multiple sink pads (e.g., input-selector of switch).
+ * @since_tizen 7.0
+ */
+typedef struct {
+  uint64_t frames_in;       /**< The number of frames arrived at the node */
+  uint64_t frames_out;      /**< The number of frames pushed out from the node */
+  uint64_t bytes_out;       /**< The total size of the frames pushed out from the node, in bytes */
+  uint64_t dropped;         /**< The number of dropped frames in the node */
+  double fps;               /**< The throughput of the node in frames per second (output frames, or input frames of a sink node) */
+  uint64_t latency_avg;     /**< The average processing latency of the node, in microseconds */
+  uint64_t latency_max;     /**< The max processing latency of the node, in microseconds */
+  uint64_t latency_histogram[ML_PIPELINE_LATENCY_HISTOGRAM_SIZE]; /**< The number of frames in each latency bucket */
+  unsigned int queue_depth; /**< The number of input frames waiting for the output in the node */
+  unsigned int queue_depth_max; /**< The max number of input frames waiting for the output in the node */
+} ml_pipeline_node_statistics_s;
+
+/**
+ * @brief The QoS status of a node in the pipeline.
+ * @details The drop rate is the exponentially weighted ratio of the recent frames dropped by QoS.
+ * @since_tizen 7.0
+ */
+typedef struct {
+  uint64_t frames_in;       /**< The number of frames arrived at the node */
+  uint64_t dropped;         /**< The number of frames dropped by QoS */
+  double drop_rate;         /**< The recent drop rate, from 0.0 to 1.0 */
+  uint64_t process_time;    /**< The recent processing time of the node, in microseconds */
+} ml_pipeline_node_qos_s;
+
 /****************************************************
  ** NNStreamer Pipeline Construction (gst-parse)   **
  ****************************************************/
@@ -227,6 +326,7 @@ typedef int (*ml_custom_easy_invoke_cb) (const ml_tensors_data_h in, ml_tensors_
  * @remarks %http://tizen.org/privilege/externalstorage is needed if @a pipeline_description is relevant to external storage.
  * @remarks %http://tizen.org/privilege/camera is needed if @a pipeline_description accesses the camera device.
  * @remarks %http://tizen.org/privilege/recorder is needed if @a pipeline_description accesses the recorder device.
+ * @remarks The tensor_filter elements with the same "shared-tensor-filter-key" share one loaded model instance. If the key is "auto", the key is generated from the framework, model, accelerator, custom option, and input and output information of the filter, and it is updated when the application changes these properties with ml_pipeline_element_set_property_string(). The framework should support the concurrent invoke of the shared model instance.
  * @param[in] pipeline_description The pipeline description compatible with GStreamer gst_parse_launch(). Refer to GStreamer manual or NNStreamer (https://github.com/nnstreamer/nnstreamer) documentation for examples and the grammar.
  * @param[in] cb The function to be called when the pipeline state is changed. You may set NULL if it's not required.
  * @param[in] user_data Private data for the callback. This value is passed to the callback when it's invoked.
@@ -260,6 +360,144 @@ int ml_pipeline_construct (const char *pipeline_description, ml_pipeline_state_c
  */
 int ml_pipeline_destroy (ml_pipeline_h pipe);
 
+/**
+ * @brief Destroys the pipeline without blocking the caller.
+ * @details The pipeline is destroyed in the internal thread, and the callback is called when it's done.
+ *          Use this function to tear down many pipelines without waiting for the state change of each pipeline.
+ * @since_tizen 7.0
+ * @remarks The application should not use @a pipe and its element handles after calling this function.
+ * @param[in] pipe The pipeline to be destroyed.
+ * @param[in] cb The function to be called when the pipeline is destroyed. You may set NULL if it's not required.
+ * @param[in] user_data Private data for the callback. This value is passed to the callback when it's invoked.
+ * @return @c 0 on success. Otherwise a negative error value. If this function fails, the callback is not called.
+ * @retval #ML_ERROR_NONE Successful.
+ * @retval #ML_ERROR_NOT_SUPPORTED Not supported.
+ * @retval #ML_ERROR_INVALID_PARAMETER Given parameter is invalid.
+ * @retval #ML_ERROR_OUT_OF_MEMORY Failed to allocate required memory.
+ */
+int ml_pipeline_destroy_async (ml_pipeline_h pipe, ml_pipeline_async_cb cb, void *user_data);
+
+/**
+ * @brief Creates a pipeline template from the pipeline description with parameters.
+ * @details Use this function to construct the pipelines of the same shape repeatedly.
+ *          The parameter is written as the value of element property, "property=${param}", and the element with parameters should have its name.
+ *          The parameter belongs to the element which has the property in its own list, before the next element, link or caps. The parameter cannot be the element name or a field of caps.
+ *          The template converts, parses and validates the description once, so ml_pipeline_template_construct() constructs the pipeline and sets the properties without the validation.
+ *          For example, "appsrc name=src ! tensor_filter name=filter framework=${fw} model=${model} ! tensor_sink name=sink" has two parameters, "fw" and "model".
+ * @since_tizen 7.0
+ * @remarks If the function succeeds, @a tmpl handle must be released using ml_pipeline_template_destroy().
+ * @remarks The template handle is not changed after the creation, so the application may construct the pipelines from the template in multiple threads.
+ * @param[in] pipeline_description The pipeline description with parameters.
+ * @param[out] tmpl The pipeline template handle.
+ * @return @c 0 on success. Otherwise a negative error value.
+ * @retval #ML_ERROR_NONE Successful.
+ * @retval #ML_ERROR_NOT_SUPPORTED Not supported.
+ * @retval #ML_ERROR_PERMISSION_DENIED The application does not have the required privilege.
+ * @retval #ML_ERROR_INVALID_PARAMETER Given parameter is invalid, or the element with parameters does not have its name.
+ * @retval #ML_ERROR_STREAMS_PIPE Failed to parse the pipeline description.
+ * @retval #ML_ERROR_OUT_OF_MEMORY Failed to allocate required memory.
+ */
+int ml_pipeline_template_create (const char *pipeline_description, ml_pipeline_template_h *tmpl);
+
+/**
+ * @brief Destroys the pipeline template.
+ * @details The pipelines constructed from the template are not changed.
+ * @since_tizen 7.0
+ * @param[in] tmpl The pipeline template handle.
+ * @return @c 0 on success. Otherwise a negative error value.
+ * @retval #ML_ERROR_NONE Successful.
+ * @retval #ML_ERROR_NOT_SUPPORTED Not supported.
+ * @retval #ML_ERROR_INVALID_PARAMETER Given parameter is invalid.
+ */
+int ml_pipeline_template_destroy (ml_pipeline_template_h tmpl);
+
+/**
+ * @brief Constructs the pipeline from the template with the values of parameters.
+ * @details All parameters in the template should be given. The value is converted to the type of element property, same as the value in the pipeline description.
+ * @since_tizen 7.0
+ * @remarks If the function succeeds, @a pipe handle must be released using ml_pipeline_destroy().
+ * @param[in] tmpl The pipeline template handle.
+ * @param[in] names The array of parameter names.
+ * @param[in] values The array of parameter values.
+ * @param[in] num_params The number of parameters.
+ * @param[in] cb The function to be called when the pipeline state is changed. You may set NULL if it's not required.
+ * @param[in] user_data Private data for the callback. This value is passed to the callback when it's invoked.
+ * @param[out] pipe The NNStreamer pipeline handler.
+ * @return @c 0 on success. Otherwise a negative error value.
+ * @retval #ML_ERROR_NONE Successful.
+ * @retval #ML_ERROR_NOT_SUPPORTED Not supported.
+ * @retval #ML_ERROR_PERMISSION_DENIED The application does not have the required privilege.
+ * @retval #ML_ERROR_INVALID_PARAMETER Given parameter is invalid, or the parameter of template is not given.
+ * @retval #ML_ERROR_STREAMS_PIPE Pipeline construction is failed.
+ * @retval #ML_ERROR_OUT_OF_MEMORY Failed to allocate required memory to construct the pipeline.
+ *
+ * @post The pipeline state will be #ML_PIPELINE_STATE_PAUSED in the same thread.
+ */
+int ml_pipeline_template_construct (ml_pipeline_template_h tmpl, const char **names, const char **values, unsigned int num_params, ml_pipeline_state_cb cb, void *user_data, ml_pipeline_h *pipe);
+
+/**
+ * @brief Creates a pool of the pipelines constructed from the template.
+ * @details The pool constructs @a size pipelines in advance with the given parameters.
+ *          The application acquires a ready pipeline with ml_pipeline_pool_acquire() and returns it with ml_pipeline_pool_release(), then the pool resets the pipeline and reuses it.
+ * @since_tizen 7.0
+ * @remarks If the function succeeds, @a pool handle must be released using ml_pipeline_pool_destroy().
+ * @remarks The template should not be destroyed before the pool is destroyed.
+ * @param[in] tmpl The pipeline template handle.
+ * @param[in] names The array of parameter names.
+ * @param[in] values The array of parameter values.
+ * @param[in] num_params The number of parameters.
+ * @param[in] size The number of ready pipelines in the pool.
+ * @param[out] pool The pipeline pool handle.
+ * @return @c 0 on success. Otherwise a negative error value.
+ * @retval #ML_ERROR_NONE Successful.
+ * @retval #ML_ERROR_NOT_SUPPORTED Not supported.
+ * @retval #ML_ERROR_INVALID_PARAMETER Given parameter is invalid.
+ * @retval #ML_ERROR_STREAMS_PIPE Failed to construct the pipeline.
+ * @retval #ML_ERROR_OUT_OF_MEMORY Failed to allocate required memory.
+ */
+int ml_pipeline_pool_create (ml_pipeline_template_h tmpl, const char **names, const char **values, unsigned int num_params, unsigned int size, ml_pipeline_pool_h *pool);
+
+/**
+ * @brief Destroys the pipeline pool and the ready pipelines in the pool.
+ * @since_tizen 7.0
+ * @param[in] pool The pipeline pool handle.
+ * @return @c 0 on success. Otherwise a negative error value.
+ * @retval #ML_ERROR_NONE Successful.
+ * @retval #ML_ERROR_NOT_SUPPORTED Not supported.
+ * @retval #ML_ERROR_INVALID_PARAMETER Given parameter is invalid, or the acquired pipelines are not released yet.
+ */
+int ml_pipeline_pool_destroy (ml_pipeline_pool_h pool);
+
+/**
+ * @brief Acquires a ready pipeline from the pool.
+ * @details If there is no ready pipeline in the pool, this function constructs a new pipeline.
+ * @since_tizen 7.0
+ * @remarks The application should not destroy @a pipe, but return it with ml_pipeline_pool_release().
+ * @param[in] pool The pipeline pool handle.
+ * @param[out] pipe The pipeline handle in #ML_PIPELINE_STATE_PAUSED.
+ * @return @c 0 on success. Otherwise a negative error value.
+ * @retval #ML_ERROR_NONE Successful.
+ * @retval #ML_ERROR_NOT_SUPPORTED Not supported.
+ * @retval #ML_ERROR_INVALID_PARAMETER Given parameter is invalid.
+ * @retval #ML_ERROR_STREAMS_PIPE Failed to construct the pipeline.
+ * @retval #ML_ERROR_OUT_OF_MEMORY Failed to allocate required memory.
+ */
+int ml_pipeline_pool_acquire (ml_pipeline_pool_h pool, ml_pipeline_h *pipe);
+
+/**
+ * @brief Returns the pipeline to the pool.
+ * @details The pool resets the pipeline with ml_pipeline_reset() and keeps it for the next session.
+ *          If the pool is full or failed to reset the pipeline, the pipeline is destroyed.
+ * @since_tizen 7.0
+ * @param[in] pool The pipeline pool handle.
+ * @param[in] pipe The pipeline handle acquired from the pool.
+ * @return @c 0 on success. Otherwise a negative error value.
+ * @retval #ML_ERROR_NONE Successful.
+ * @retval #ML_ERROR_NOT_SUPPORTED Not supported.
+ * @retval #ML_ERROR_INVALID_PARAMETER Given parameter is invalid, or the pipeline is not acquired from the pool.
+ */
+int ml_pipeline_pool_release (ml_pipeline_pool_h pool, ml_pipeline_h pipe);
+
 /**
  * @brief Gets the state of pipeline.
  * @details Gets the state of the pipeline handle returned by ml_pipeline_construct().
@@ -295,6 +533,25 @@ int ml_pipeline_get_state (ml_pipeline_h pipe, ml_pipeline_state_e *state);
  */
 int ml_pipeline_start (ml_pipeline_h pipe);
 
+/**
+ * @brief Starts the pipeline and notifies when the pipeline state is changed to #ML_PIPELINE_STATE_PLAYING.
+ * @details This function does not wait for the state change. The callback is called when the pipeline state is changed to #ML_PIPELINE_STATE_PLAYING, or with an error if the pipeline posts an error before playing.
+ * @since_tizen 7.0
+ * @param[in] pipe The pipeline handle.
+ * @param[in] cb The function to be called when the pipeline is started.
+ * @param[in] user_data Private data for the callback. This value is passed to the callback when it's invoked.
+ * @return @c 0 on success. Otherwise a negative error value. If this function fails, the callback is not called.
+ * @retval #ML_ERROR_NONE Successful.
+ * @retval #ML_ERROR_NOT_SUPPORTED Not supported.
+ * @retval #ML_ERROR_INVALID_PARAMETER Given parameter is invalid.
+ * @retval #ML_ERROR_TRY_AGAIN The previous asynchronous start is not completed yet.
+ * @retval #ML_ERROR_STREAMS_PIPE Failed to start the pipeline.
+ *
+ * @pre The pipeline state should be #ML_PIPELINE_STATE_PAUSED.
+ * @post The pipeline state will be #ML_PIPELINE_STATE_PLAYING.
+ */
+int ml_pipeline_start_async (ml_pipeline_h pipe, ml_pipeline_async_cb cb, void *user_data);
+
 /**
  * @brief Stops the pipeline, asynchronously.
  * @details The pipeline handle returned by ml_pipeline_construct() is stopped.
@@ -327,6 +584,86 @@ int ml_pipeline_stop (ml_pipeline_h pipe);
  */
 int ml_pipeline_flush (ml_pipeline_h pipe, bool start);
 
+/**
+ * @brief Resets the pipeline to reuse it for the next session.
+ * @details This function stops the pipeline and clears all data in the pipeline, same as ml_pipeline_flush().
+ *          Then, it releases all handles of the elements (e.g., src, sink, valve and switch) and resets the queue limit of src nodes and the statistics.
+ *          The elements and the model instances of tensor_filter are not released, so the pipeline is ready to start the data flow without reloading the models.
+ * @since_tizen 7.0
+ * @remarks The handles of the elements from the pipeline are not available after calling this function. Get the handles again for the next session.
+ * @param[in] pipe The pipeline to be reset.
+ * @return @c 0 on success. Otherwise a negative error value.
+ * @retval #ML_ERROR_NONE Successful.
+ * @retval #ML_ERROR_NOT_SUPPORTED Not supported.
+ * @retval #ML_ERROR_INVALID_PARAMETER Given parameter is invalid.
+ * @retval #ML_ERROR_STREAMS_PIPE Failed to reset the pipeline.
+ *
+ * @post The pipeline state will be #ML_PIPELINE_STATE_PAUSED.
+ */
+int ml_pipeline_reset (ml_pipeline_h pipe);
+
+/****************************************************
+ ** NNStreamer Pipeline Statistics                 **
+ ****************************************************/
+/**
+ * @brief Enables or disables the statistics mode of the pipeline.
+ * @details If the statistics mode is enabled, the pipeline collects the counters and processing latency of each node (appsrc, tensor_sink, appsink, valve, switch, tensor_filter and tensor_if) without GStreamer debug logs.
+ *          The counters are reset when the statistics mode is enabled.
+ * @since_tizen 7.0
+ * @remarks The statistics mode adds a small overhead to each frame. It is disabled by default.
+ * @param[in] pipe The pipeline handle.
+ * @param[in] enable @c true to enable the statistics mode, @c false to disable it.
+ * @return @c 0 on success. Otherwise a negative error value.
+ * @retval #ML_ERROR_NONE Successful.
+ * @retval #ML_ERROR_NOT_SUPPORTED Not supported.
+ * @retval #ML_ERROR_INVALID_PARAMETER Given parameter is invalid.
+ * @retval #ML_ERROR_OUT_OF_MEMORY Failed to allocate required memory.
+ */
+int ml_pipeline_set_statistics (ml_pipeline_h pipe, bool enable);
+
+/**
+ * @brief Gets the statistics of a node in the pipeline.
+ * @since_tizen 7.0
+ * @param[in] pipe The pipeline handle.
+ * @param[in] node_name The name of node in the pipeline.
+ * @param[out] stats The statistics of the node.
+ * @return @c 0 on success. Otherwise a negative error value.
+ * @retval #ML_ERROR_NONE Successful.
+ * @retval #ML_ERROR_NOT_SUPPORTED Not supported.
+ * @retval #ML_ERROR_INVALID_PARAMETER Given parameter is invalid. (@a node_name is not found, or the statistics mode is disabled.)
+ */
+int ml_pipeline_get_statistics (ml_pipeline_h pipe, const char *node_name, ml_pipeline_node_statistics_s *stats);
+
+/**
+ * @brief Sets the max latency of the frames and enables the QoS of tensor_filter nodes in the pipeline.
+ * @details The QoS measures the processing time of each tensor_filter, and drops the frame before the filter if the frame cannot arrive at the filter output in @a max_latency_ms after it is ready for the filter.
+ *          The frame is ready for the filter when it is out of the upstream tensor_filter, or pushed into the src node with ml_pipeline_src_input_data(). For the other sources, the lateness against the pipeline clock is used.
+ *          So each tensor_filter drops the frames queued for itself, and the latency of the upstream filters is not counted.
+ *          The frame which does not wait for the previous frames is not dropped, so the filter keeps processing the frames even if its processing time exceeds @a max_latency_ms.
+ *          The counters are reset when this function is called.
+ * @since_tizen 7.0
+ * @param[in] pipe The pipeline handle.
+ * @param[in] max_latency_ms The max latency of the frame in milliseconds. Set 0 to disable the QoS.
+ * @return @c 0 on success. Otherwise a negative error value.
+ * @retval #ML_ERROR_NONE Successful.
+ * @retval #ML_ERROR_NOT_SUPPORTED Not supported.
+ * @retval #ML_ERROR_INVALID_PARAMETER Given parameter is invalid, or there is no tensor_filter in the pipeline.
+ */
+int ml_pipeline_set_qos (ml_pipeline_h pipe, unsigned int max_latency_ms);
+
+/**
+ * @brief Gets the QoS status of a tensor_filter node in the pipeline.
+ * @since_tizen 7.0
+ * @param[in] pipe The pipeline handle.
+ * @param[in] node_name The name of tensor_filter node in the pipeline.
+ * @param[out] qos The QoS status of the node.
+ * @return @c 0 on success. Otherwise a negative error value.
+ * @retval #ML_ERROR_NONE Successful.
+ * @retval #ML_ERROR_NOT_SUPPORTED Not supported.
+ * @retval #ML_ERROR_INVALID_PARAMETER Given parameter is invalid. (@a node_name is not found, or the QoS is disabled.)
+ */
+int ml_pipeline_get_qos (ml_pipeline_h pipe, const char *node_name, ml_pipeline_node_qos_s *qos);
+
 /****************************************************
  ** NNStreamer Pipeline Sink/Src Control           **
  ****************************************************/
@@ -363,6 +700,36 @@ int ml_pipeline_sink_register (ml_pipeline_h pipe, const char *sink_name, ml_pip
  */
 int ml_pipeline_sink_unregister (ml_pipeline_sink_h sink_handle);
 
+/**
+ * @brief The end-to-end latency of the frames from src nodes to a sink node.
+ * @details The pipeline stamps the frames pushed with ml_pipeline_src_input_data(), and the latency is the time until the frame arrives at the sink node.
+ *          The percentiles are calculated with the recent frames (up to 1024 frames).
+ * @since_tizen 7.0
+ */
+typedef struct {
+  uint64_t count;   /**< The number of frames arrived at the sink node with the ingress timestamp */
+  uint64_t last;    /**< The latency of the last frame in microseconds. In the sink callback, this is the latency of the given frame. */
+  uint64_t max;     /**< The max latency in microseconds */
+  uint64_t p50;     /**< The median latency of the recent frames in microseconds */
+  uint64_t p90;     /**< The 90th percentile latency of the recent frames in microseconds */
+  uint64_t p99;     /**< The 99th percentile latency of the recent frames in microseconds */
+} ml_pipeline_sink_latency_s;
+
+/**
+ * @brief Gets the end-to-end latency of the frames arrived at the sink node.
+ * @details This function can be called in the sink callback (ml_pipeline_sink_cb) to get the latency of the given frame.
+ *          Note that the ingress timestamp may be dropped by an element which creates a new frame without copying the metadata (e.g., aggregation of the frames). Such frames are not counted.
+ * @since_tizen 7.0
+ * @param[in] sink_handle The sink handle returned by ml_pipeline_sink_register().
+ * @param[out] latency The end-to-end latency of the sink node.
+ * @return @c 0 on success. Otherwise a negative error value.
+ * @retval #ML_ERROR_NONE Successful.
+ * @retval #ML_ERROR_NOT_SUPPORTED Not supported.
+ * @retval #ML_ERROR_INVALID_PARAMETER Given parameter is invalid.
+ * @retval #ML_ERROR_OUT_OF_MEMORY Failed to allocate required memory.
+ */
+int ml_pipeline_sink_get_latency (ml_pipeline_sink_h sink_handle, ml_pipeline_sink_latency_s *latency);
+
 /**
  * @brief Gets a handle to operate as a src node of NNStreamer pipelines.
  * @since_tizen 5.5
@@ -403,7 +770,8 @@ int ml_pipeline_src_release_handle (ml_pipeline_src_h src_handle);
  * @retval #ML_ERROR_NOT_SUPPORTED Not supported.
  * @retval #ML_ERROR_INVALID_PARAMETER Given parameter is invalid.
  * @retval #ML_ERROR_STREAMS_PIPE The pipeline has inconsistent pad caps. (Pipeline is not negotiated yet.)
- * @retval #ML_ERROR_TRY_AGAIN The pipeline is not ready yet.
+ * @retval #ML_ERROR_TRY_AGAIN The pipeline is not ready yet, or the queue of src node is full. (See ml_pipeline_src_set_queue_limit().)
+ * @retval #ML_ERROR_TIMED_OUT Failed to wait for the queue of src node. (See ml_pipeline_src_set_queue_limit().)
  */
 int ml_pipeline_src_input_data (ml_pipeline_src_h src_handle, ml_tensors_data_h data, ml_pipeline_buf_policy_e policy);
 
@@ -433,6 +801,52 @@ typedef struct {
  */
 int ml_pipeline_src_set_event_cb (ml_pipeline_src_h src_handle, ml_pipeline_src_callbacks_s *cb, void *user_data);
 
+/**
+ * @brief Callback to release the input data of src node.
+ * @details If an application pushes the input data with #ML_PIPELINE_BUF_POLICY_DO_NOT_FREE, this callback is called when the pipeline does not access the data anymore.
+ *          Then the application may reuse or release the data. Note that this callback may be called in the thread calling ml_pipeline_src_input_data() (e.g., when the pipeline is flushing). The pipeline does not hold its internal locks when calling this, so the application may destroy the data in the callback.
+ * @since_tizen 7.0
+ * @remarks The source handle is not given, because it may be already released when this callback is called. Pass the data the application needs with @a user_data.
+ * @param[in] data The handle of input tensors pushed with ml_pipeline_src_input_data().
+ * @param[in,out] user_data User application's private data given with ml_pipeline_src_set_release_cb().
+ */
+typedef void (*ml_pipeline_src_release_cb) (ml_tensors_data_h data, void *user_data);
+
+/**
+ * @brief Sets the callback which will be invoked when the pipeline releases the input data.
+ * @details The callback is only called for the data pushed with #ML_PIPELINE_BUF_POLICY_DO_NOT_FREE. Set NULL to unset the callback.
+ *          The pipeline recycles the internal wrappers of the pushed frames with this callback, so the application may reuse the data without re-allocating it for each frame.
+ * @since_tizen 7.0
+ * @param[in] src_handle The source handle returned by ml_pipeline_src_get_handle().
+ * @param[in] cb The function to be called when the pipeline releases the input data.
+ * @param[in] user_data The user's custom data given to the callback.
+ * @return 0 on success. Otherwise a negative error value.
+ * @retval #ML_ERROR_NONE Successful.
+ * @retval #ML_ERROR_NOT_SUPPORTED Not supported.
+ * @retval #ML_ERROR_INVALID_PARAMETER Given parameter is invalid.
+ * @retval #ML_ERROR_OUT_OF_MEMORY Failed to allocate required memory.
+ */
+int ml_pipeline_src_set_release_cb (ml_pipeline_src_h src_handle, ml_pipeline_src_release_cb cb, void *user_data);
+
+/**
+ * @brief Sets the queue limit of src node and makes ml_pipeline_src_input_data() wait for the queue.
+ * @details If the queue of src node is full (the pipeline emits enough_data event), ml_pipeline_src_input_data() waits until the pipeline needs more data (need_data event), and then pushes the input data.
+ *          Set both @a max_bytes and @a max_frames to 0 to disable the blocking mode. Then the queue limit of src node is restored to the default, and ml_pipeline_src_input_data() does not wait.
+ *          The pipeline is not locked while waiting, so the other pipeline APIs can be called. If the pipeline is destroyed or the src handle is released while waiting, ml_pipeline_src_input_data() returns an error without pushing the data.
+ * @since_tizen 7.0
+ * @remarks This function installs the internal callbacks of src node. If you set the callbacks with ml_pipeline_src_set_event_cb(), use the same src handle.
+ * @param[in] src_handle The source handle returned by ml_pipeline_src_get_handle().
+ * @param[in] max_bytes The max size of the queue in bytes. 0 for no limit in bytes.
+ * @param[in] max_frames The max number of frames in the queue. 0 for no limit in frames.
+ * @param[in] timeout_ms The max time to wait for the queue in milliseconds. If it is 0, ml_pipeline_src_input_data() does not wait and returns #ML_ERROR_TRY_AGAIN when the queue is full.
+ * @return 0 on success. Otherwise a negative error value.
+ * @retval #ML_ERROR_NONE Successful.
+ * @retval #ML_ERROR_NOT_SUPPORTED Not supported, or cannot limit the frames because the pipeline is not negotiated yet.
+ * @retval #ML_ERROR_INVALID_PARAMETER Given parameter is invalid.
+ * @retval #ML_ERROR_OUT_OF_MEMORY Failed to allocate required memory.
+ */
+int ml_pipeline_src_set_queue_limit (ml_pipeline_src_h src_handle, uint64_t max_bytes, uint64_t max_frames, unsigned int timeout_ms);
+
 /**
  * @brief Gets a handle for the tensors information of given src node.
  * @details If the media type is not other/tensor or other/tensors, @a info handle may not be correct. If want to use other media types, you MUST set the correct properties.
@@ -449,6 +863,64 @@ int ml_pipeline_src_set_event_cb (ml_pipeline_src_h src_handle, ml_pipeline_src_
  */
 int ml_pipeline_src_get_tensors_info (ml_pipeline_src_h src_handle, ml_tensors_info_h *info);
 
+/**
+ * @brief Creates a batch to merge the frames of multiple streams into a src node.
+ * @details The batch copies the frames of @a num_streams streams into a frame of src node, and pushes the frame when all streams are filled or the deadline is expired.
+ *          The frames of missing streams are filled with zero. Then the batch splits the output of sink node, and calls @a cb for each stream in the frame.
+ *          The batch dimension of each tensor is the outermost dimension which is larger than 1, and it should be @a num_streams.
+ *          (e.g., the src node with dimension 3:224:224:4 accepts the frames 3:224:224:1 of 4 streams.)
+ * @since_tizen 7.0
+ * @remarks If the function succeeds, @a batch handle must be released using ml_pipeline_batch_destroy().
+ * @remarks The batch registers the sink callback and the release callback of the src node. Do not push the data into the src node directly.
+ * @remarks The batch tags the frame pushed into the src node, and pairs the output with the tag. The elements between the src and sink nodes should keep the buffer metadata (e.g., tensor_filter), and the output without the tag is ignored. The frames dropped in the pipeline are not notified.
+ * @remarks The pipeline should not be destroyed before the batch is destroyed.
+ * @param[in] pipe The pipeline handle.
+ * @param[in] src_name The name of src node (appsrc) which accepts the batched frame.
+ * @param[in] sink_name The name of sink node (tensor_sink or appsink) which emits the batched output.
+ * @param[in] num_streams The number of streams in the batch.
+ * @param[in] deadline_ms The max time to wait for the streams in milliseconds after the first frame is filled. If it is 0, the batch waits until all streams are filled.
+ * @param[in] cb The function to be called with the output of each stream.
+ * @param[in] user_data Private data for the callback. This value is passed to the callback when it's invoked.
+ * @param[out] batch The batch handle.
+ * @return @c 0 on success. Otherwise a negative error value.
+ * @retval #ML_ERROR_NONE Successful.
+ * @retval #ML_ERROR_NOT_SUPPORTED Not supported.
+ * @retval #ML_ERROR_INVALID_PARAMETER Given parameter is invalid, or the dimension of src node does not have the batch of @a num_streams.
+ * @retval #ML_ERROR_STREAMS_PIPE The pipeline has inconsistent pad caps. (Pipeline is not negotiated yet.)
+ * @retval #ML_ERROR_OUT_OF_MEMORY Failed to allocate required memory.
+ */
+int ml_pipeline_batch_create (ml_pipeline_h pipe, const char *src_name, const char *sink_name, unsigned int num_streams, unsigned int deadline_ms, ml_pipeline_batch_cb cb, void *user_data, ml_pipeline_batch_h *batch);
+
+/**
+ * @brief Destroys the batch.
+ * @details The frames waiting for the other streams are dropped.
+ * @since_tizen 7.0
+ * @param[in] batch The batch handle.
+ * @return @c 0 on success. Otherwise a negative error value.
+ * @retval #ML_ERROR_NONE Successful.
+ * @retval #ML_ERROR_NOT_SUPPORTED Not supported.
+ * @retval #ML_ERROR_INVALID_PARAMETER Given parameter is invalid.
+ */
+int ml_pipeline_batch_destroy (ml_pipeline_batch_h batch);
+
+/**
+ * @brief Copies the frame of a stream into the batch.
+ * @details If the stream is already filled in the batch, the batch pushes the frame into the src node first.
+ * @since_tizen 7.0
+ * @remarks The batch copies the data, so the application may reuse or release @a data after calling this function.
+ * @param[in] batch The batch handle.
+ * @param[in] stream_id The index of stream, from 0 to num_streams - 1.
+ * @param[in] data The handle of input tensors of the stream. The size of each tensor is the size of src node divided by the number of streams.
+ * @return @c 0 on success. Otherwise a negative error value.
+ * @retval #ML_ERROR_NONE Successful.
+ * @retval #ML_ERROR_NOT_SUPPORTED Not supported.
+ * @retval #ML_ERROR_INVALID_PARAMETER Given parameter is invalid.
+ * @retval #ML_ERROR_STREAMS_PIPE The handles of the batch are released by ml_pipeline_reset(), or failed to push the batched frame. Destroy the batch if the pipeline is reset.
+ * @retval #ML_ERROR_TRY_AGAIN The pipeline is not ready or the queue of src node is full. The batched frame is dropped.
+ * @retval #ML_ERROR_OUT_OF_MEMORY Failed to allocate required memory.
+ */
+int ml_pipeline_batch_input_data (ml_pipeline_batch_h batch, unsigned int stream_id, const ml_tensors_data_h data);
+
 /****************************************************
  ** NNStreamer Pipeline Switch/Valve Control       **
  ****************************************************/
@@ -957,6 +1429,30 @@ int ml_pipeline_element_get_property_enum (ml_pipeline_element_h elem_h, const c
  */
 int ml_pipeline_tensor_if_custom_register (const char *name, ml_pipeline_if_custom_cb cb, void *user_data, ml_pipeline_if_h *if_custom);
 
+/**
+ * @brief Registers a built-in tensor_if custom condition.
+ * @details This function registers the custom condition which compares the tensor without the callback.
+ *          The condition finds the max score and its class in the tensor of the given index, then compares them with @a threshold and @a classes.
+ *          Since the application code is not called, the pipelines evaluate the condition without the lock of custom condition and the tensors data handle.
+ *          The registered condition is used in the pipeline same as ml_pipeline_tensor_if_custom_register().
+ * @since_tizen 7.0
+ * @remarks If the function succeeds, @a if_custom handle must be released using ml_pipeline_tensor_if_custom_unregister().
+ * @param[in] name The name of custom condition
+ * @param[in] condition The built-in condition.
+ * @param[in] index The index of the tensor to be compared.
+ * @param[in] threshold The threshold of the max score. Set -INFINITY to compare the class only.
+ * @param[in] classes The set of class indices. This is used with #ML_PIPELINE_IF_CONDITION_CLASS_IN_SET and ignored with other conditions.
+ * @param[in] num_classes The number of class indices.
+ * @param[out] if_custom The tensor_if handler.
+ * @return @c 0 on success. Otherwise a negative error value.
+ * @retval #ML_ERROR_NONE Successful.
+ * @retval #ML_ERROR_NOT_SUPPORTED Not supported.
+ * @retval #ML_ERROR_INVALID_PARAMETER The parameter is invalid.
+ * @retval #ML_ERROR_OUT_OF_MEMORY Failed to allocate required memory to register the custom condition.
+ * @retval #ML_ERROR_STREAMS_PIPE Failed to register the custom condition.
+ */
+int ml_pipeline_tensor_if_condition_register (const char *name, ml_pipeline_if_condition_e condition, unsigned int index, double threshold, const unsigned int *classes, unsigned int num_classes, ml_pipeline_if_h *if_custom);
+
 /**
  * @brief Unregisters the tensor_if custom callback.
  * @details Use this function to release and unregister the tensor_if custom callback.
@@ -1091,6 +1587,28 @@ int ml_check_element_availability (const char *element_name, bool *available);
  */
 int ml_pipeline_custom_easy_filter_register (const char *name, const ml_tensors_info_h in, const ml_tensors_info_h out, ml_custom_easy_invoke_cb cb, void *user_data, ml_custom_easy_filter_h *custom);
 
+/**
+ * @brief Registers a custom filter with the flags.
+ * @details This function is the same as ml_pipeline_custom_easy_filter_register(), but the application can set the flags of the custom filter.
+ *          If #ML_CUSTOM_EASY_FLAG_REENTRANT is given, the pipelines call the invoke callback without the lock of the custom filter,
+ *          so the stateless pre/post-processing filter shared by several pipelines can run in parallel. The callback should be thread-safe.
+ * @since_tizen 7.0
+ * @remarks If the function succeeds, @a custom handle must be released using ml_pipeline_custom_easy_filter_unregister().
+ * @param[in] name The name of custom filter.
+ * @param[in] in The handle of input tensors information.
+ * @param[in] out The handle of output tensors information.
+ * @param[in] cb The function to be called when the pipeline runs.
+ * @param[in] user_data Private data for the callback. This value is passed to the callback when it's invoked.
+ * @param[in] flags The flags of custom filter, bitwise OR of #ml_custom_easy_flag_e.
+ * @param[out] custom The custom filter handler.
+ * @return @c 0 on success. Otherwise a negative error value.
+ * @retval #ML_ERROR_NONE Successful.
+ * @retval #ML_ERROR_NOT_SUPPORTED Not supported.
+ * @retval #ML_ERROR_INVALID_PARAMETER The parameter is invalid, or duplicated name exists.
+ * @retval #ML_ERROR_OUT_OF_MEMORY Failed to allocate required memory to register the custom filter.
+ */
+int ml_pipeline_custom_easy_filter_register_full (const char *name, const ml_tensors_info_h in, const ml_tensors_info_h out, ml_custom_easy_invoke_cb cb, void *user_data, int flags, ml_custom_easy_filter_h *custom);
+
 /**
  * @brief Unregisters the custom filter.
  * @details Use this function to release and unregister the custom filter.
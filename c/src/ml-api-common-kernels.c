@@ -0,0 +1,1409 @@
+/* SPDX-License-Identifier: Apache-2.0 */
+/**
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved.
+ *
+ * @file ml-api-common-kernels.c
+ * @date 16 October 2021
+ * @brief Pre/post-processing kernels of tensors data with runtime CPU dispatch.
+ * @see	https://github.com/nnstreamer/api
+ * @author NNStreamer API Maintainers <nnstreamer@samsung.com>
+ * @bug No known bugs except for NYI items
+ */
+
+#include <string.h>
+#include <glib.h>
+
+#include "ml-api-common.h"
+#include "ml-api-internal.h"
+
+#if (defined (__x86_64__) || defined (__i386__)) && defined (__GNUC__)
+#define ML_KERNEL_X86 1
+#include <immintrin.h>
+#endif
+
+#if defined (__ARM_NEON) || defined (__ARM_NEON__)
+#define ML_KERNEL_NEON 1
+#include <arm_neon.h>
+#endif
+
+/**
+ * @brief The max number of channels to vectorize the normalization.
+ */
+#define ML_KERNEL_MAX_CHANNELS (16U)
+
+/**
+ * @brief The size of tile to transpose the tensor.
+ */
+#define ML_KERNEL_TILE_SIZE (16U)
+
+/**
+ * @brief The number of elements converted at once with the intermediate buffer.
+ */
+#define ML_KERNEL_CHUNK_SIZE (256U)
+
+/**
+ * @brief Kernel to normalize uint8 to float32 (out = in * scale + bias). The scale and bias are expanded by 8 * channels.
+ */
+typedef void (*ml_kernel_normalize_f) (const guint8 * in, gfloat * out,
+    gsize len, const gfloat * scale, const gfloat * bias, guint channels);
+
+/**
+ * @brief Kernel to find the max value of float32 array.
+ */
+typedef gfloat (*ml_kernel_max_f32_f) (const gfloat * in, gsize len);
+
+/**
+ * @brief Kernel to quantize float32 to uint8 or int8 (out = round (in * inv_scale + zero_point)).
+ */
+typedef void (*ml_kernel_quantize_f) (const gfloat * in, gpointer out,
+    gsize len, gfloat inv_scale, gfloat zero_point, gboolean is_signed);
+
+/**
+ * @brief Kernel to convert int8 to float32 (out = in * scale + bias).
+ */
+typedef void (*ml_kernel_dequantize_s8_f) (const gint8 * in, gfloat * out,
+    gsize len, gfloat scale, gfloat bias);
+
+/**
+ * @brief Kernel to transpose a tile (ML_KERNEL_TILE_SIZE x ML_KERNEL_TILE_SIZE) of 32-bit elements. The strides are the number of elements in a row.
+ */
+typedef void (*ml_kernel_transpose32_f) (const guint32 * in, guint32 * out,
+    gsize in_stride, gsize out_stride);
+
+/**
+ * @brief Kernels selected at runtime.
+ */
+typedef struct {
+  ml_kernel_normalize_f normalize;
+  ml_kernel_max_f32_f max_f32;
+  ml_kernel_quantize_f quantize;
+  ml_kernel_dequantize_s8_f dequantize_s8;
+  ml_kernel_transpose32_f transpose32;
+} ml_kernels_s;
+
+static ml_kernels_s ml_kernels;
+
+/**
+ * @brief Normalization kernel, scalar.
+ */
+static void
+kernel_normalize_c (const guint8 * in, gfloat * out, gsize len,
+    const gfloat * scale, const gfloat * bias, guint channels)
+{
+  gsize i;
+  guint c;
+
+  for (i = 0; i + channels <= len; i += channels) {
+    for (c = 0; c < channels; c++)
+      out[i + c] = (gfloat) in[i + c] * scale[c] + bias[c];
+  }
+}
+
+/**
+ * @brief Max value kernel of float32, scalar.
+ */
+static gfloat
+kernel_max_f32_c (const gfloat * in, gsize len)
+{
+  gfloat max = in[0];
+  gsize i;
+
+  for (i = 1; i < len; i++) {
+    if (in[i] > max)
+      max = in[i];
+  }
+
+  return max;
+}
+
+/**
+ * @brief Quantization kernel, scalar.
+ */
+static void
+kernel_quantize_c (const gfloat * in, gpointer out, gsize len,
+    gfloat inv_scale, gfloat zero_point, gboolean is_signed)
+{
+  const gfloat lo = (is_signed) ? (gfloat) G_MININT8 : 0.0f;
+  const gfloat hi = (is_signed) ? (gfloat) G_MAXINT8 : (gfloat) G_MAXUINT8;
+  gfloat v;
+  gsize i;
+
+  for (i = 0; i < len; i++) {
+    v = in[i] * inv_scale + zero_point;
+
+    /* saturate (NaN to lower bound), then round half away from zero */
+    v = (v > lo) ? v : lo;
+    v = (v < hi) ? v : hi;
+    v += (v < 0.0f) ? -0.5f : 0.5f;
+
+    if (is_signed)
+      ((gint8 *) out)[i] = (gint8) v;
+    else
+      ((guint8 *) out)[i] = (guint8) v;
+  }
+}
+
+/**
+ * @brief Dequantization kernel of int8, scalar.
+ */
+static void
+kernel_dequantize_s8_c (const gint8 * in, gfloat * out, gsize len,
+    gfloat scale, gfloat bias)
+{
+  gsize i;
+
+  for (i = 0; i < len; i++)
+    out[i] = (gfloat) in[i] * scale + bias;
+}
+
+/**
+ * @brief Transpose kernel of 32-bit elements, scalar.
+ */
+static void
+kernel_transpose32_c (const guint32 * in, guint32 * out, gsize in_stride,
+    gsize out_stride)
+{
+  gsize r, c;
+
+  for (r = 0; r < ML_KERNEL_TILE_SIZE; r++) {
+    for (c = 0; c < ML_KERNEL_TILE_SIZE; c++)
+      out[c * out_stride + r] = in[r * in_stride + c];
+  }
+}
+
+#if defined (ML_KERNEL_X86)
+/**
+ * @brief Transpose kernel of 32-bit elements, SSE2. This transposes 4x4 blocks of the tile.
+ */
+__attribute__((target ("sse2")))
+static void
+kernel_transpose32_sse2 (const guint32 * in, guint32 * out, gsize in_stride,
+    gsize out_stride)
+{
+  gsize r, c;
+
+  for (r = 0; r < ML_KERNEL_TILE_SIZE; r += 4) {
+    for (c = 0; c < ML_KERNEL_TILE_SIZE; c += 4) {
+      const guint32 *s = in + r * in_stride + c;
+      guint32 *d = out + c * out_stride + r;
+      __m128i r0 = _mm_loadu_si128 ((const __m128i *) s);
+      __m128i r1 = _mm_loadu_si128 ((const __m128i *) (s + in_stride));
+      __m128i r2 = _mm_loadu_si128 ((const __m128i *) (s + 2 * in_stride));
+      __m128i r3 = _mm_loadu_si128 ((const __m128i *) (s + 3 * in_stride));
+      __m128i t0 = _mm_unpacklo_epi32 (r0, r1);
+      __m128i t1 = _mm_unpacklo_epi32 (r2, r3);
+      __m128i t2 = _mm_unpackhi_epi32 (r0, r1);
+      __m128i t3 = _mm_unpackhi_epi32 (r2, r3);
+
+      _mm_storeu_si128 ((__m128i *) d, _mm_unpacklo_epi64 (t0, t1));
+      _mm_storeu_si128 ((__m128i *) (d + out_stride),
+          _mm_unpackhi_epi64 (t0, t1));
+      _mm_storeu_si128 ((__m128i *) (d + 2 * out_stride),
+          _mm_unpacklo_epi64 (t2, t3));
+      _mm_storeu_si128 ((__m128i *) (d + 3 * out_stride),
+          _mm_unpackhi_epi64 (t2, t3));
+    }
+  }
+}
+
+/**
+ * @brief Normalization kernel, AVX2.
+ */
+__attribute__((target ("avx2")))
+static void
+kernel_normalize_avx2 (const guint8 * in, gfloat * out, gsize len,
+    const gfloat * scale, const gfloat * bias, guint channels)
+{
+  const gsize block = 8U * channels;
+  gsize i, k;
+
+  for (i = 0; i + block <= len; i += block) {
+    for (k = 0; k < block; k += 8) {
+      __m128i v8 = _mm_loadl_epi64 ((const __m128i *) (in + i + k));
+      __m256 vf = _mm256_cvtepi32_ps (_mm256_cvtepu8_epi32 (v8));
+      __m256 vs = _mm256_loadu_ps (scale + k);
+      __m256 vb = _mm256_loadu_ps (bias + k);
+
+      _mm256_storeu_ps (out + i + k, _mm256_add_ps (_mm256_mul_ps (vf, vs),
+              vb));
+    }
+  }
+
+  /* remainders */
+  kernel_normalize_c (in + i, out + i, len - i, scale, bias, channels);
+}
+
+/**
+ * @brief Max value kernel of float32, AVX2.
+ */
+__attribute__((target ("avx2")))
+static gfloat
+kernel_max_f32_avx2 (const gfloat * in, gsize len)
+{
+  gfloat lanes[8];
+  gfloat max;
+  __m256 vmax;
+  gsize i;
+  guint k;
+
+  if (len < 8)
+    return kernel_max_f32_c (in, len);
+
+  vmax = _mm256_loadu_ps (in);
+  for (i = 8; i + 8 <= len; i += 8)
+    vmax = _mm256_max_ps (vmax, _mm256_loadu_ps (in + i));
+
+  _mm256_storeu_ps (lanes, vmax);
+  max = lanes[0];
+  for (k = 1; k < 8; k++) {
+    if (lanes[k] > max)
+      max = lanes[k];
+  }
+
+  for (; i < len; i++) {
+    if (in[i] > max)
+      max = in[i];
+  }
+
+  return max;
+}
+
+/**
+ * @brief Quantization kernel, AVX2.
+ */
+__attribute__((target ("avx2")))
+static void
+kernel_quantize_avx2 (const gfloat * in, gpointer out, gsize len,
+    gfloat inv_scale, gfloat zero_point, gboolean is_signed)
+{
+  const __m256 vinv = _mm256_set1_ps (inv_scale);
+  const __m256 vzp = _mm256_set1_ps (zero_point);
+  const __m256 vlo = _mm256_set1_ps ((is_signed) ? (gfloat) G_MININT8 : 0.0f);
+  const __m256 vhi = _mm256_set1_ps ((is_signed) ?
+      (gfloat) G_MAXINT8 : (gfloat) G_MAXUINT8);
+  const __m256 vhalf = _mm256_set1_ps (0.5f);
+  const __m256 vneghalf = _mm256_set1_ps (-0.5f);
+  const __m256 vzero = _mm256_setzero_ps ();
+  guint8 *dest = (guint8 *) out;
+  gsize i;
+
+  for (i = 0; i + 8 <= len; i += 8) {
+    __m256 v = _mm256_add_ps (_mm256_mul_ps (_mm256_loadu_ps (in + i), vinv),
+        vzp);
+    __m256i vi;
+    __m128i v16, v8;
+
+    /* max returns the second operand (lower bound) if NaN */
+    v = _mm256_min_ps (_mm256_max_ps (v, vlo), vhi);
+    v = _mm256_add_ps (v, _mm256_blendv_ps (vhalf, vneghalf,
+            _mm256_cmp_ps (v, vzero, _CMP_LT_OQ)));
+
+    vi = _mm256_cvttps_epi32 (v);
+    v16 = _mm_packs_epi32 (_mm256_castsi256_si128 (vi),
+        _mm256_extracti128_si256 (vi, 1));
+    v8 = (is_signed) ? _mm_packs_epi16 (v16, v16) : _mm_packus_epi16 (v16, v16);
+
+    _mm_storel_epi64 ((__m128i *) (dest + i), v8);
+  }
+
+  /* remainders */
+  kernel_quantize_c (in + i, dest + i, len - i, inv_scale, zero_point,
+      is_signed);
+}
+
+/**
+ * @brief Dequantization kernel of int8, AVX2.
+ */
+__attribute__((target ("avx2")))
+static void
+kernel_dequantize_s8_avx2 (const gint8 * in, gfloat * out, gsize len,
+    gfloat scale, gfloat bias)
+{
+  const __m256 vs = _mm256_set1_ps (scale);
+  const __m256 vb = _mm256_set1_ps (bias);
+  gsize i;
+
+  for (i = 0; i + 8 <= len; i += 8) {
+    __m128i v8 = _mm_loadl_epi64 ((const __m128i *) (in + i));
+    __m256 vf = _mm256_cvtepi32_ps (_mm256_cvtepi8_epi32 (v8));
+
+    _mm256_storeu_ps (out + i, _mm256_add_ps (_mm256_mul_ps (vf, vs), vb));
+  }
+
+  /* remainders */
+  kernel_dequantize_s8_c (in + i, out + i, len - i, scale, bias);
+}
+
+/**
+ * @brief Transpose kernel of 32-bit elements, AVX2. This transposes 8x8 blocks of the tile.
+ */
+__attribute__((target ("avx2")))
+static void
+kernel_transpose32_avx2 (const guint32 * in, guint32 * out, gsize in_stride,
+    gsize out_stride)
+{
+  __m256i v[8], t[8];
+  gsize r, c;
+  guint k;
+
+  for (r = 0; r < ML_KERNEL_TILE_SIZE; r += 8) {
+    for (c = 0; c < ML_KERNEL_TILE_SIZE; c += 8) {
+      const guint32 *s = in + r * in_stride + c;
+      guint32 *d = out + c * out_stride + r;
+
+      for (k = 0; k < 8; k++)
+        v[k] = _mm256_loadu_si256 ((const __m256i *) (s + k * in_stride));
+
+      /* interleave the pairs of rows, then the pairs of 64-bit lanes */
+      for (k = 0; k < 8; k += 2) {
+        t[k] = _mm256_unpacklo_epi32 (v[k], v[k + 1]);
+        t[k + 1] = _mm256_unpackhi_epi32 (v[k], v[k + 1]);
+      }
+
+      v[0] = _mm256_unpacklo_epi64 (t[0], t[2]);
+      v[1] = _mm256_unpackhi_epi64 (t[0], t[2]);
+      v[2] = _mm256_unpacklo_epi64 (t[1], t[3]);
+      v[3] = _mm256_unpackhi_epi64 (t[1], t[3]);
+      v[4] = _mm256_unpacklo_epi64 (t[4], t[6]);
+      v[5] = _mm256_unpackhi_epi64 (t[4], t[6]);
+      v[6] = _mm256_unpacklo_epi64 (t[5], t[7]);
+      v[7] = _mm256_unpackhi_epi64 (t[5], t[7]);
+
+      /* the low 128-bit lanes are the columns 0-3, and the high are 4-7 */
+      for (k = 0; k < 4; k++) {
+        _mm256_storeu_si256 ((__m256i *) (d + k * out_stride),
+            _mm256_permute2x128_si256 (v[k], v[k + 4], 0x20));
+        _mm256_storeu_si256 ((__m256i *) (d + (k + 4) * out_stride),
+            _mm256_permute2x128_si256 (v[k], v[k + 4], 0x31));
+      }
+    }
+  }
+}
+#endif /* ML_KERNEL_X86 */
+
+#if defined (ML_KERNEL_NEON)
+/**
+ * @brief Normalization kernel, NEON.
+ */
+static void
+kernel_normalize_neon (const guint8 * in, gfloat * out, gsize len,
+    const gfloat * scale, const gfloat * bias, guint channels)
+{
+  const gsize block = 8U * channels;
+  gsize i, k;
+
+  for (i = 0; i + block <= len; i += block) {
+    for (k = 0; k < block; k += 8) {
+      uint16x8_t v16 = vmovl_u8 (vld1_u8 (in + i + k));
+      float32x4_t lo = vcvtq_f32_u32 (vmovl_u16 (vget_low_u16 (v16)));
+      float32x4_t hi = vcvtq_f32_u32 (vmovl_u16 (vget_high_u16 (v16)));
+
+      lo = vmlaq_f32 (vld1q_f32 (bias + k), lo, vld1q_f32 (scale + k));
+      hi = vmlaq_f32 (vld1q_f32 (bias + k + 4), hi, vld1q_f32 (scale + k + 4));
+
+      vst1q_f32 (out + i + k, lo);
+      vst1q_f32 (out + i + k + 4, hi);
+    }
+  }
+
+  /* remainders */
+  kernel_normalize_c (in + i, out + i, len - i, scale, bias, channels);
+}
+
+/**
+ * @brief Max value kernel of float32, NEON.
+ */
+static gfloat
+kernel_max_f32_neon (const gfloat * in, gsize len)
+{
+  gfloat lanes[4];
+  gfloat max;
+  float32x4_t vmax;
+  gsize i;
+  guint k;
+
+  if (len < 4)
+    return kernel_max_f32_c (in, len);
+
+  vmax = vld1q_f32 (in);
+  for (i = 4; i + 4 <= len; i += 4)
+    vmax = vmaxq_f32 (vmax, vld1q_f32 (in + i));
+
+  vst1q_f32 (lanes, vmax);
+  max = lanes[0];
+  for (k = 1; k < 4; k++) {
+    if (lanes[k] > max)
+      max = lanes[k];
+  }
+
+  for (; i < len; i++) {
+    if (in[i] > max)
+      max = in[i];
+  }
+
+  return max;
+}
+
+/**
+ * @brief Quantization kernel, NEON.
+ */
+static void
+kernel_quantize_neon (const gfloat * in, gpointer out, gsize len,
+    gfloat inv_scale, gfloat zero_point, gboolean is_signed)
+{
+  const float32x4_t vinv = vdupq_n_f32 (inv_scale);
+  const float32x4_t vzp = vdupq_n_f32 (zero_point);
+  const float32x4_t vlo = vdupq_n_f32 ((is_signed) ? (gfloat) G_MININT8 : 0.0f);
+  const float32x4_t vhi = vdupq_n_f32 ((is_signed) ?
+      (gfloat) G_MAXINT8 : (gfloat) G_MAXUINT8);
+  const float32x4_t vhalf = vdupq_n_f32 (0.5f);
+  const float32x4_t vneghalf = vdupq_n_f32 (-0.5f);
+  const float32x4_t vzero = vdupq_n_f32 (0.0f);
+  guint8 *dest = (guint8 *) out;
+  gsize i;
+  guint k;
+
+  for (i = 0; i + 8 <= len; i += 8) {
+    float32x4_t v[2];
+    int16x8_t v16;
+
+    v[0] = vmlaq_f32 (vzp, vld1q_f32 (in + i), vinv);
+    v[1] = vmlaq_f32 (vzp, vld1q_f32 (in + i + 4), vinv);
+
+    for (k = 0; k < 2; k++) {
+      /* compare and select, NaN to lower bound */
+      v[k] = vbslq_f32 (vcgtq_f32 (v[k], vlo), v[k], vlo);
+      v[k] = vbslq_f32 (vcltq_f32 (v[k], vhi), v[k], vhi);
+      v[k] = vaddq_f32 (v[k], vbslq_f32 (vcltq_f32 (v[k], vzero), vneghalf,
+              vhalf));
+    }
+
+    v16 = vcombine_s16 (vqmovn_s32 (vcvtq_s32_f32 (v[0])),
+        vqmovn_s32 (vcvtq_s32_f32 (v[1])));
+
+    if (is_signed)
+      vst1_s8 ((int8_t *) (dest + i), vqmovn_s16 (v16));
+    else
+      vst1_u8 (dest + i, vqmovun_s16 (v16));
+  }
+
+  /* remainders */
+  kernel_quantize_c (in + i, dest + i, len - i, inv_scale, zero_point,
+      is_signed);
+}
+
+/**
+ * @brief Dequantization kernel of int8, NEON.
+ */
+static void
+kernel_dequantize_s8_neon (const gint8 * in, gfloat * out, gsize len,
+    gfloat scale, gfloat bias)
+{
+  const float32x4_t vs = vdupq_n_f32 (scale);
+  const float32x4_t vb = vdupq_n_f32 (bias);
+  gsize i;
+
+  for (i = 0; i + 8 <= len; i += 8) {
+    int16x8_t v16 = vmovl_s8 (vld1_s8 (in + i));
+    float32x4_t lo = vcvtq_f32_s32 (vmovl_s16 (vget_low_s16 (v16)));
+    float32x4_t hi = vcvtq_f32_s32 (vmovl_s16 (vget_high_s16 (v16)));
+
+    vst1q_f32 (out + i, vmlaq_f32 (vb, lo, vs));
+    vst1q_f32 (out + i + 4, vmlaq_f32 (vb, hi, vs));
+  }
+
+  /* remainders */
+  kernel_dequantize_s8_c (in + i, out + i, len - i, scale, bias);
+}
+
+/**
+ * @brief Transpose kernel of 32-bit elements, NEON. This transposes 4x4 blocks of the tile.
+ */
+static void
+kernel_transpose32_neon (const guint32 * in, guint32 * out, gsize in_stride,
+    gsize out_stride)
+{
+  gsize r, c;
+
+  for (r = 0; r < ML_KERNEL_TILE_SIZE; r += 4) {
+    for (c = 0; c < ML_KERNEL_TILE_SIZE; c += 4) {
+      const guint32 *s = in + r * in_stride + c;
+      guint32 *d = out + c * out_stride + r;
+      uint32x4x2_t t01 = vtrnq_u32 (vld1q_u32 (s), vld1q_u32 (s + in_stride));
+      uint32x4x2_t t23 = vtrnq_u32 (vld1q_u32 (s + 2 * in_stride),
+          vld1q_u32 (s + 3 * in_stride));
+
+      vst1q_u32 (d, vcombine_u32 (vget_low_u32 (t01.val[0]),
+              vget_low_u32 (t23.val[0])));
+      vst1q_u32 (d + out_stride, vcombine_u32 (vget_low_u32 (t01.val[1]),
+              vget_low_u32 (t23.val[1])));
+      vst1q_u32 (d + 2 * out_stride, vcombine_u32 (vget_high_u32 (t01.val[0]),
+              vget_high_u32 (t23.val[0])));
+      vst1q_u32 (d + 3 * out_stride, vcombine_u32 (vget_high_u32 (t01.val[1]),
+              vget_high_u32 (t23.val[1])));
+    }
+  }
+}
+#endif /* ML_KERNEL_NEON */
+
+/**
+ * @brief Internal function to select the kernels with CPU features.
+ */
+static void
+ml_kernels_init (void)
+{
+  static gsize initialized = 0;
+
+  if (g_once_init_enter (&initialized)) {
+    ml_kernels.normalize = kernel_normalize_c;
+    ml_kernels.max_f32 = kernel_max_f32_c;
+    ml_kernels.quantize = kernel_quantize_c;
+    ml_kernels.dequantize_s8 = kernel_dequantize_s8_c;
+    ml_kernels.transpose32 = kernel_transpose32_c;
+
+#if defined (ML_KERNEL_X86)
+    __builtin_cpu_init ();
+    if (__builtin_cpu_supports ("sse2")) {
+      ml_kernels.transpose32 = kernel_transpose32_sse2;
+    }
+
+    if (__builtin_cpu_supports ("avx2")) {
+      ml_kernels.normalize = kernel_normalize_avx2;
+      ml_kernels.max_f32 = kernel_max_f32_avx2;
+      ml_kernels.quantize = kernel_quantize_avx2;
+      ml_kernels.dequantize_s8 = kernel_dequantize_s8_avx2;
+      ml_kernels.transpose32 = kernel_transpose32_avx2;
+    }
+#elif defined (ML_KERNEL_NEON)
+    ml_kernels.normalize = kernel_normalize_neon;
+    ml_kernels.max_f32 = kernel_max_f32_neon;
+    ml_kernels.quantize = kernel_quantize_neon;
+    ml_kernels.dequantize_s8 = kernel_dequantize_s8_neon;
+    ml_kernels.transpose32 = kernel_transpose32_neon;
+#endif
+
+    g_once_init_leave (&initialized, 1);
+  }
+}
+
+/**
+ * @brief Internal function to lock the handles of input and output in the order of address.
+ * @details The calls with the reversed pair of handles (in another thread) lock the handles in the same order, so they do not deadlock.
+ */
+static void
+kernel_lock_data (ml_tensors_data_s * in, ml_tensors_data_s * out)
+{
+  ml_tensors_data_s *first, *second;
+
+  if ((guintptr) in < (guintptr) out) {
+    first = in;
+    second = out;
+  } else {
+    first = out;
+    second = in;
+  }
+
+  G_LOCK_UNLESS_NOLOCK (*first);
+  if (second != first) {
+    G_LOCK_UNLESS_NOLOCK (*second);
+  }
+}
+
+/**
+ * @brief Internal function to unlock the handles of input and output locked with kernel_lock_data().
+ */
+static void
+kernel_unlock_data (ml_tensors_data_s * in, ml_tensors_data_s * out)
+{
+  if (out != in) {
+    G_UNLOCK_UNLESS_NOLOCK (*out);
+  }
+  G_UNLOCK_UNLESS_NOLOCK (*in);
+}
+
+/**
+ * @brief Normalizes uint8 tensor to float32 tensor. (more info in ml-api-common.h)
+ */
+int
+ml_tensors_data_normalize (const ml_tensors_data_h in, ml_tensors_data_h out,
+    unsigned int index, const float *mean, const float *std,
+    unsigned int channels)
+{
+  ml_tensors_data_s *_in, *_out;
+  ml_tensor_data_s *in_nth, *out_nth;
+  gfloat scale[8U * ML_KERNEL_MAX_CHANNELS];
+  gfloat bias[8U * ML_KERNEL_MAX_CHANNELS];
+  gsize len;
+  guint c;
+  int status = ML_ERROR_NONE;
+
+  check_feature_state ();
+
+  if (!in || !out)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, in or out, is NULL. It should be a valid ml_tensors_data_h handle.");
+  if (in == out)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameters, in and out, are the same handle. The size of float32 output differs from the uint8 input.");
+  if (!mean || !std)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, mean or std, is NULL. It should be an array of %u values.",
+        channels);
+  if (channels == 0)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, channels, is 0. It should be the number of values in mean and std.");
+
+  for (c = 0; c < channels; c++) {
+    if (std[c] == 0.0f)
+      _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+          "The parameter, std[%u], is 0. Cannot normalize the tensor.", c);
+  }
+
+  ml_kernels_init ();
+
+  _in = (ml_tensors_data_s *) in;
+  _out = (ml_tensors_data_s *) out;
+
+  kernel_lock_data (_in, _out);
+
+  if (_in->num_tensors <= index || _out->num_tensors <= index) {
+    _ml_error_report
+        ("The parameter, index (%u), is out of bound. The number of tensors of 'in' is %u and 'out' is %u.",
+        index, _in->num_tensors, _out->num_tensors);
+    status = ML_ERROR_INVALID_PARAMETER;
+    goto report;
+  }
+
+  in_nth = _ml_tensors_data_get_nth_data (_in, index);
+  out_nth = _ml_tensors_data_get_nth_data (_out, index);
+
+  len = in_nth->size;
+  if (len % channels != 0 || out_nth->size != len * sizeof (gfloat)) {
+    _ml_error_report
+        ("The size of tensors[index: %u] is invalid. The input (%zu bytes) should be a multiple of channels (%u), and the output should be %zu bytes, while it is %zu bytes.",
+        index, len, channels, len * sizeof (gfloat), out_nth->size);
+    status = ML_ERROR_INVALID_PARAMETER;
+    goto report;
+  }
+
+  /* the output tensor may be shared with other handles */
+  status = _ml_tensors_data_make_writable (_out, index, FALSE);
+  if (status != ML_ERROR_NONE)
+    goto report;
+
+  if (channels <= ML_KERNEL_MAX_CHANNELS) {
+    /* expand the scale and bias to the multiple of vector size */
+    for (c = 0; c < 8U * channels; c++) {
+      scale[c] = 1.0f / std[c % channels];
+      bias[c] = -mean[c % channels] * scale[c];
+    }
+
+    ml_kernels.normalize (in_nth->tensor, out_nth->tensor, len, scale, bias,
+        channels);
+  } else {
+    const guint8 *src = in_nth->tensor;
+    gfloat *dest = out_nth->tensor;
+    gsize i;
+
+    for (i = 0; i < len; i++) {
+      c = i % channels;
+      dest[i] = ((gfloat) src[i] - mean[c]) / std[c];
+    }
+  }
+
+report:
+  kernel_unlock_data (_in, _out);
+  return status;
+}
+
+/**
+ * @brief Transposes the tensor between channel-last (NHWC) and channel-first (NCHW). (more info in ml-api-common.h)
+ */
+int
+ml_tensors_data_transpose (const ml_tensors_data_h in, ml_tensors_data_h out,
+    unsigned int index, size_t element_size, unsigned int channels,
+    unsigned int batch, bool to_channel_first)
+{
+  ml_tensors_data_s *_in, *_out;
+  ml_tensor_data_s *in_nth, *out_nth;
+  gsize size, spatial, rows, cols;
+  gsize b, r, c, rt, ct, r_end, c_end;
+  gboolean aligned32;
+  int status = ML_ERROR_NONE;
+
+  check_feature_state ();
+
+  if (!in || !out)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, in or out, is NULL. It should be a valid ml_tensors_data_h handle.");
+  if (in == out)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameters, in and out, are the same handle. The transpose cannot be done in place.");
+  if (element_size == 0 || channels == 0 || batch == 0)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameters, element_size (%zu), channels (%u) and batch (%u), should be larger than 0.",
+        element_size, channels, batch);
+
+  ml_kernels_init ();
+
+  _in = (ml_tensors_data_s *) in;
+  _out = (ml_tensors_data_s *) out;
+
+  kernel_lock_data (_in, _out);
+
+  if (_in->num_tensors <= index || _out->num_tensors <= index) {
+    _ml_error_report
+        ("The parameter, index (%u), is out of bound. The number of tensors of 'in' is %u and 'out' is %u.",
+        index, _in->num_tensors, _out->num_tensors);
+    status = ML_ERROR_INVALID_PARAMETER;
+    goto report;
+  }
+
+  in_nth = _ml_tensors_data_get_nth_data (_in, index);
+  out_nth = _ml_tensors_data_get_nth_data (_out, index);
+
+  size = in_nth->size;
+  if (size != out_nth->size ||
+      size % (element_size * channels * batch) != 0) {
+    _ml_error_report
+        ("The size of tensors[index: %u] is invalid. The input (%zu bytes) and the output (%zu bytes) should be the same multiple of element_size * channels * batch.",
+        index, size, out_nth->size);
+    status = ML_ERROR_INVALID_PARAMETER;
+    goto report;
+  }
+
+  /* the output tensor may be shared with other handles */
+  status = _ml_tensors_data_make_writable (_out, index, FALSE);
+  if (status != ML_ERROR_NONE)
+    goto report;
+
+  spatial = size / (element_size * channels * batch);
+
+  aligned32 = (element_size == 4 &&
+      ((guintptr) in_nth->tensor | (guintptr) out_nth->tensor) % 4 == 0);
+
+  /* transpose [rows][cols] matrix of each batch */
+  rows = (to_channel_first) ? spatial : channels;
+  cols = (to_channel_first) ? channels : spatial;
+
+  for (b = 0; b < batch; b++) {
+    const guint8 *src = (const guint8 *) in_nth->tensor +
+        b * rows * cols * element_size;
+    guint8 *dest = (guint8 *) out_nth->tensor +
+        b * rows * cols * element_size;
+
+    /* cache-blocked, the tile fits in L1 cache */
+    for (rt = 0; rt < rows; rt += ML_KERNEL_TILE_SIZE) {
+      r_end = MIN (rt + ML_KERNEL_TILE_SIZE, rows);
+
+      for (ct = 0; ct < cols; ct += ML_KERNEL_TILE_SIZE) {
+        c_end = MIN (ct + ML_KERNEL_TILE_SIZE, cols);
+
+        /* the full tile of 32-bit elements (e.g., float32) is vectorized */
+        if (aligned32 && r_end - rt == ML_KERNEL_TILE_SIZE &&
+            c_end - ct == ML_KERNEL_TILE_SIZE) {
+          ml_kernels.transpose32 ((const guint32 *) (src +
+                  (rt * cols + ct) * 4), (guint32 *) (dest +
+                  (ct * rows + rt) * 4), cols, rows);
+          continue;
+        }
+
+        for (r = rt; r < r_end; r++) {
+          for (c = ct; c < c_end; c++) {
+            memcpy (dest + (c * rows + r) * element_size,
+                src + (r * cols + c) * element_size, element_size);
+          }
+        }
+      }
+    }
+  }
+
+report:
+  kernel_unlock_data (_in, _out);
+  return status;
+}
+
+/**
+ * @brief Internal function to get the size of tensor element.
+ */
+static gsize
+kernel_get_element_size (ml_tensor_type_e type)
+{
+  switch (type) {
+    case ML_TENSOR_TYPE_INT8:
+    case ML_TENSOR_TYPE_UINT8:
+      return 1;
+    case ML_TENSOR_TYPE_INT16:
+    case ML_TENSOR_TYPE_UINT16:
+      return 2;
+    case ML_TENSOR_TYPE_INT32:
+    case ML_TENSOR_TYPE_UINT32:
+    case ML_TENSOR_TYPE_FLOAT32:
+      return 4;
+    case ML_TENSOR_TYPE_FLOAT64:
+    case ML_TENSOR_TYPE_INT64:
+    case ML_TENSOR_TYPE_UINT64:
+      return 8;
+    default:
+      break;
+  }
+
+  return 0;
+}
+
+/**
+ * @brief Internal macro to find the max value and its index.
+ */
+#define argmax_typed(type, ptr, len, idx, max) do { \
+    const type *v = (const type *) (ptr); \
+    gsize i; \
+    for ((idx) = 0, i = 1; i < (len); i++) { \
+      if (v[i] > v[idx]) \
+        (idx) = i; \
+    } \
+    (max) = (gdouble) v[idx]; \
+  } while (0)
+
+/**
+ * @brief Gets the index of max value in the tensor. (more info in ml-api-internal.h)
+ */
+int
+_ml_tensor_argmax (gconstpointer ptr, gsize len, ml_tensor_type_e type,
+    gsize * index, gdouble * max)
+{
+  gsize idx = 0;
+  gdouble value = 0.0;
+
+  if (!ptr || len == 0 || !index)
+    return ML_ERROR_INVALID_PARAMETER;
+
+  ml_kernels_init ();
+
+  switch (type) {
+    case ML_TENSOR_TYPE_FLOAT32:
+    {
+      const gfloat *v = (const gfloat *) ptr;
+      gfloat m = ml_kernels.max_f32 (v, len);
+
+      /* vectorized max, then the first index of max value */
+      while (idx < len - 1 && v[idx] != m)
+        idx++;
+      value = (gdouble) v[idx];
+      break;
+    }
+    case ML_TENSOR_TYPE_FLOAT64:
+      argmax_typed (gdouble, ptr, len, idx, value);
+      break;
+    case ML_TENSOR_TYPE_INT32:
+      argmax_typed (gint32, ptr, len, idx, value);
+      break;
+    case ML_TENSOR_TYPE_UINT32:
+      argmax_typed (guint32, ptr, len, idx, value);
+      break;
+    case ML_TENSOR_TYPE_INT16:
+      argmax_typed (gint16, ptr, len, idx, value);
+      break;
+    case ML_TENSOR_TYPE_UINT16:
+      argmax_typed (guint16, ptr, len, idx, value);
+      break;
+    case ML_TENSOR_TYPE_INT8:
+      argmax_typed (gint8, ptr, len, idx, value);
+      break;
+    case ML_TENSOR_TYPE_UINT8:
+      argmax_typed (guint8, ptr, len, idx, value);
+      break;
+    case ML_TENSOR_TYPE_INT64:
+      argmax_typed (gint64, ptr, len, idx, value);
+      break;
+    case ML_TENSOR_TYPE_UINT64:
+      argmax_typed (guint64, ptr, len, idx, value);
+      break;
+    default:
+      return ML_ERROR_INVALID_PARAMETER;
+  }
+
+  *index = idx;
+  if (max)
+    *max = value;
+
+  return ML_ERROR_NONE;
+}
+
+/**
+ * @brief Gets the index of max value in the tensor. (more info in ml-api-common.h)
+ */
+int
+ml_tensors_data_argmax (const ml_tensors_data_h data, unsigned int index,
+    ml_tensor_type_e type, unsigned int *result)
+{
+  ml_tensors_data_s *_data;
+  ml_tensor_data_s *nth;
+  gsize esize, len, idx = 0;
+  int status = ML_ERROR_NONE;
+
+  check_feature_state ();
+
+  if (!data)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, data, is NULL. It should be a valid ml_tensors_data_h handle.");
+  if (!result)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, result, is NULL. Provide a valid pointer.");
+
+  esize = kernel_get_element_size (type);
+  if (esize == 0)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, type (%d), is invalid.", type);
+
+  _data = (ml_tensors_data_s *) data;
+  G_LOCK_UNLESS_NOLOCK (*_data);
+
+  if (_data->num_tensors <= index) {
+    _ml_error_report
+        ("The parameter, index (%u), is out of bound. The number of tensors of 'data' is %u.",
+        index, _data->num_tensors);
+    status = ML_ERROR_INVALID_PARAMETER;
+    goto report;
+  }
+
+  nth = _ml_tensors_data_get_nth_data (_data, index);
+
+  len = nth->size / esize;
+  if (len == 0 || len > G_MAXUINT) {
+    _ml_error_report
+        ("The size of tensors[index: %u] (%zu bytes) is invalid for the type %d.",
+        index, nth->size, type);
+    status = ML_ERROR_INVALID_PARAMETER;
+    goto report;
+  }
+
+  status = _ml_tensor_argmax (nth->tensor, len, type, &idx, NULL);
+  if (status != ML_ERROR_NONE) {
+    _ml_error_report ("Failed to find the max value of tensors[index: %u].",
+        index);
+    goto report;
+  }
+
+  *result = (unsigned int) idx;
+
+report:
+  G_UNLOCK_UNLESS_NOLOCK (*_data);
+  return status;
+}
+
+/**
+ * @brief Internal macro to load the elements into the buffer of float64.
+ */
+#define load_typed(type, ptr, buf, n) do { \
+    const type *s = (const type *) (ptr); \
+    gsize k; \
+    for (k = 0; k < (n); k++) \
+      (buf)[k] = (gdouble) s[k]; \
+  } while (0)
+
+/**
+ * @brief Internal macro to store the float64 buffer into the elements, saturated to [lo, hi]. NaN is stored as lo.
+ */
+#define store_typed(type, ptr, buf, n, lo, hi) do { \
+    type *d = (type *) (ptr); \
+    gsize k; \
+    for (k = 0; k < (n); k++) { \
+      gdouble v = (buf)[k]; \
+      if (!(v > (gdouble) (lo))) \
+        d[k] = (lo); \
+      else if (v >= (gdouble) (hi)) \
+        d[k] = (hi); \
+      else \
+        d[k] = (type) v; \
+    } \
+  } while (0)
+
+/**
+ * @brief Internal function to load the elements of given type into the buffer of float64.
+ */
+static void
+kernel_load_f64 (gconstpointer ptr, ml_tensor_type_e type, gdouble * buf,
+    gsize n)
+{
+  switch (type) {
+    case ML_TENSOR_TYPE_INT8:
+      load_typed (gint8, ptr, buf, n);
+      break;
+    case ML_TENSOR_TYPE_UINT8:
+      load_typed (guint8, ptr, buf, n);
+      break;
+    case ML_TENSOR_TYPE_INT16:
+      load_typed (gint16, ptr, buf, n);
+      break;
+    case ML_TENSOR_TYPE_UINT16:
+      load_typed (guint16, ptr, buf, n);
+      break;
+    case ML_TENSOR_TYPE_INT32:
+      load_typed (gint32, ptr, buf, n);
+      break;
+    case ML_TENSOR_TYPE_UINT32:
+      load_typed (guint32, ptr, buf, n);
+      break;
+    case ML_TENSOR_TYPE_FLOAT32:
+      load_typed (gfloat, ptr, buf, n);
+      break;
+    case ML_TENSOR_TYPE_FLOAT64:
+      load_typed (gdouble, ptr, buf, n);
+      break;
+    case ML_TENSOR_TYPE_INT64:
+      load_typed (gint64, ptr, buf, n);
+      break;
+    case ML_TENSOR_TYPE_UINT64:
+      load_typed (guint64, ptr, buf, n);
+      break;
+    default:
+      break;
+  }
+}
+
+/**
+ * @brief Internal function to store the buffer of float64 into the elements of given type.
+ */
+static void
+kernel_store_f64 (gpointer ptr, ml_tensor_type_e type, const gdouble * buf,
+    gsize n)
+{
+  switch (type) {
+    case ML_TENSOR_TYPE_INT8:
+      store_typed (gint8, ptr, buf, n, G_MININT8, G_MAXINT8);
+      break;
+    case ML_TENSOR_TYPE_UINT8:
+      store_typed (guint8, ptr, buf, n, 0, G_MAXUINT8);
+      break;
+    case ML_TENSOR_TYPE_INT16:
+      store_typed (gint16, ptr, buf, n, G_MININT16, G_MAXINT16);
+      break;
+    case ML_TENSOR_TYPE_UINT16:
+      store_typed (guint16, ptr, buf, n, 0, G_MAXUINT16);
+      break;
+    case ML_TENSOR_TYPE_INT32:
+      store_typed (gint32, ptr, buf, n, G_MININT32, G_MAXINT32);
+      break;
+    case ML_TENSOR_TYPE_UINT32:
+      store_typed (guint32, ptr, buf, n, 0, G_MAXUINT32);
+      break;
+    case ML_TENSOR_TYPE_FLOAT32:
+    {
+      gfloat *d = (gfloat *) ptr;
+      gsize k;
+
+      for (k = 0; k < n; k++)
+        d[k] = (gfloat) buf[k];
+      break;
+    }
+    case ML_TENSOR_TYPE_FLOAT64:
+      memcpy (ptr, buf, n * sizeof (gdouble));
+      break;
+    case ML_TENSOR_TYPE_INT64:
+      store_typed (gint64, ptr, buf, n, G_MININT64, G_MAXINT64);
+      break;
+    case ML_TENSOR_TYPE_UINT64:
+      store_typed (guint64, ptr, buf, n, 0, G_MAXUINT64);
+      break;
+    default:
+      break;
+  }
+}
+
+/**
+ * @brief Internal macro to load the integer elements into the buffer of int64.
+ */
+#define load_int_typed(type, ptr, buf, n) do { \
+    const type *s = (const type *) (ptr); \
+    gsize k; \
+    for (k = 0; k < (n); k++) \
+      (buf)[k] = (gint64) s[k]; \
+  } while (0)
+
+/**
+ * @brief Internal macro to store the int64 buffer into the integer elements, saturated to [lo, hi].
+ */
+#define store_int_typed(type, ptr, buf, n, lo, hi) do { \
+    type *d = (type *) (ptr); \
+    gsize k; \
+    for (k = 0; k < (n); k++) { \
+      gint64 v = (buf)[k]; \
+      if (v < (gint64) (lo)) \
+        d[k] = (lo); \
+      else if (v > (gint64) (hi)) \
+        d[k] = (hi); \
+      else \
+        d[k] = (type) v; \
+    } \
+  } while (0)
+
+/**
+ * @brief Internal function to load the integer elements of given type into the buffer of int64.
+ * @details The uint64 value larger than G_MAXINT64 is saturated, the other integer types never store it.
+ */
+static void
+kernel_load_i64 (gconstpointer ptr, ml_tensor_type_e type, gint64 * buf,
+    gsize n)
+{
+  switch (type) {
+    case ML_TENSOR_TYPE_INT8:
+      load_int_typed (gint8, ptr, buf, n);
+      break;
+    case ML_TENSOR_TYPE_UINT8:
+      load_int_typed (guint8, ptr, buf, n);
+      break;
+    case ML_TENSOR_TYPE_INT16:
+      load_int_typed (gint16, ptr, buf, n);
+      break;
+    case ML_TENSOR_TYPE_UINT16:
+      load_int_typed (guint16, ptr, buf, n);
+      break;
+    case ML_TENSOR_TYPE_INT32:
+      load_int_typed (gint32, ptr, buf, n);
+      break;
+    case ML_TENSOR_TYPE_UINT32:
+      load_int_typed (guint32, ptr, buf, n);
+      break;
+    case ML_TENSOR_TYPE_INT64:
+      memcpy (buf, ptr, n * sizeof (gint64));
+      break;
+    case ML_TENSOR_TYPE_UINT64:
+    {
+      const guint64 *s = (const guint64 *) ptr;
+      gsize k;
+
+      for (k = 0; k < n; k++)
+        buf[k] = (s[k] > (guint64) G_MAXINT64) ? G_MAXINT64 : (gint64) s[k];
+      break;
+    }
+    default:
+      break;
+  }
+}
+
+/**
+ * @brief Internal function to store the buffer of int64 into the integer elements of given type.
+ */
+static void
+kernel_store_i64 (gpointer ptr, ml_tensor_type_e type, const gint64 * buf,
+    gsize n)
+{
+  switch (type) {
+    case ML_TENSOR_TYPE_INT8:
+      store_int_typed (gint8, ptr, buf, n, G_MININT8, G_MAXINT8);
+      break;
+    case ML_TENSOR_TYPE_UINT8:
+      store_int_typed (guint8, ptr, buf, n, 0, G_MAXUINT8);
+      break;
+    case ML_TENSOR_TYPE_INT16:
+      store_int_typed (gint16, ptr, buf, n, G_MININT16, G_MAXINT16);
+      break;
+    case ML_TENSOR_TYPE_UINT16:
+      store_int_typed (guint16, ptr, buf, n, 0, G_MAXUINT16);
+      break;
+    case ML_TENSOR_TYPE_INT32:
+      store_int_typed (gint32, ptr, buf, n, G_MININT32, G_MAXINT32);
+      break;
+    case ML_TENSOR_TYPE_UINT32:
+      store_int_typed (guint32, ptr, buf, n, 0, G_MAXUINT32);
+      break;
+    case ML_TENSOR_TYPE_INT64:
+      memcpy (ptr, buf, n * sizeof (gint64));
+      break;
+    case ML_TENSOR_TYPE_UINT64:
+    {
+      guint64 *d = (guint64 *) ptr;
+      gsize k;
+
+      for (k = 0; k < n; k++)
+        d[k] = (buf[k] < 0) ? 0 : (guint64) buf[k];
+      break;
+    }
+    default:
+      break;
+  }
+}
+
+/**
+ * @brief Internal function to convert the elements between integer types with the intermediate buffer of int64, saturated to the range of output type.
+ * @details The chunk of input is loaded before storing the output, so this can run in place if the element sizes are same.
+ */
+static void
+kernel_convert_int (gconstpointer in, gpointer out, gsize len,
+    ml_tensor_type_e in_type, ml_tensor_type_e out_type)
+{
+  gint64 buf[ML_KERNEL_CHUNK_SIZE];
+  const gsize in_esize = kernel_get_element_size (in_type);
+  const gsize out_esize = kernel_get_element_size (out_type);
+  gsize i, n;
+
+  for (i = 0; i < len; i += n) {
+    n = MIN (len - i, ML_KERNEL_CHUNK_SIZE);
+
+    kernel_load_i64 ((const guint8 *) in + i * in_esize, in_type, buf, n);
+    kernel_store_i64 ((guint8 *) out + i * out_esize, out_type, buf, n);
+  }
+}
+
+/**
+ * @brief Internal function to convert the elements with the intermediate buffer of float64, if one of the types is float.
+ * @details The chunk of input is loaded before storing the output, so this can run in place if the element sizes are same.
+ */
+static void
+kernel_convert_generic (gconstpointer in, gpointer out, gsize len,
+    ml_tensor_type_e in_type, ml_tensor_type_e out_type,
+    const ml_tensor_quant_param_s * quant)
+{
+  gdouble buf[ML_KERNEL_CHUNK_SIZE];
+  const gsize in_esize = kernel_get_element_size (in_type);
+  const gsize out_esize = kernel_get_element_size (out_type);
+  const gboolean quantize = (in_type == ML_TENSOR_TYPE_FLOAT32 ||
+      in_type == ML_TENSOR_TYPE_FLOAT64);
+  gdouble scale = 1.0, inv_scale = 1.0, zero_point = 0.0, v;
+  gsize i, k, n;
+
+  if (quant) {
+    scale = (gdouble) quant->scale;
+    inv_scale = 1.0 / scale;
+    zero_point = (gdouble) quant->zero_point;
+  }
+
+  for (i = 0; i < len; i += n) {
+    n = MIN (len - i, ML_KERNEL_CHUNK_SIZE);
+
+    kernel_load_f64 ((const guint8 *) in + i * in_esize, in_type, buf, n);
+
+    if (quant && quantize) {
+      /* round half away from zero, the store truncates toward zero */
+      for (k = 0; k < n; k++) {
+        v = buf[k] * inv_scale + zero_point;
+        buf[k] = v + ((v < 0.0) ? -0.5 : 0.5);
+      }
+    } else if (quant) {
+      for (k = 0; k < n; k++)
+        buf[k] = (buf[k] - zero_point) * scale;
+    }
+
+    kernel_store_f64 ((guint8 *) out + i * out_esize, out_type, buf, n);
+  }
+}
+
+/**
+ * @brief Converts the type of tensor elements. (more info in ml-api-common.h)
+ */
+int
+ml_tensors_data_convert (const ml_tensors_data_h in, ml_tensors_data_h out,
+    unsigned int index, ml_tensor_type_e in_type, ml_tensor_type_e out_type,
+    const ml_tensor_quant_param_s * quant)
+{
+  ml_tensors_data_s *_in, *_out;
+  ml_tensor_data_s *in_nth, *out_nth;
+  gsize in_esize, out_esize, len;
+  gpointer src, dest;
+  gboolean in_float, out_float;
+  int status = ML_ERROR_NONE;
+
+  check_feature_state ();
+
+  if (!in || !out)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, in or out, is NULL. It should be a valid ml_tensors_data_h handle.");
+
+  in_esize = kernel_get_element_size (in_type);
+  out_esize = kernel_get_element_size (out_type);
+  if (in_esize == 0 || out_esize == 0)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, in_type (%d) or out_type (%d), is invalid.",
+        in_type, out_type);
+
+  if (in == out && in_esize != out_esize)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameters, in and out, are the same handle. The element size of in_type (%zu) and out_type (%zu) should be same to convert in place.",
+        in_esize, out_esize);
+
+  in_float = (in_type == ML_TENSOR_TYPE_FLOAT32 ||
+      in_type == ML_TENSOR_TYPE_FLOAT64);
+  out_float = (out_type == ML_TENSOR_TYPE_FLOAT32 ||
+      out_type == ML_TENSOR_TYPE_FLOAT64);
+
+  if (quant) {
+    if (in_float == out_float)
+      _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+          "The parameter, quant, is given, but in_type (%d) and out_type (%d) are not a pair of float and integer types.",
+          in_type, out_type);
+    if (!(quant->scale > 0.0f))
+      _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+          "The parameter, quant->scale (%f), is invalid. It should be larger than 0.",
+          quant->scale);
+  }
+
+  ml_kernels_init ();
+
+  _in = (ml_tensors_data_s *) in;
+  _out = (ml_tensors_data_s *) out;
+
+  kernel_lock_data (_in, _out);
+
+  if (_in->num_tensors <= index || _out->num_tensors <= index) {
+    _ml_error_report
+        ("The parameter, index (%u), is out of bound. The number of tensors of 'in' is %u and 'out' is %u.",
+        index, _in->num_tensors, _out->num_tensors);
+    status = ML_ERROR_INVALID_PARAMETER;
+    goto report;
+  }
+
+  in_nth = _ml_tensors_data_get_nth_data (_in, index);
+  out_nth = _ml_tensors_data_get_nth_data (_out, index);
+
+  len = in_nth->size / in_esize;
+  if (in_nth->size % in_esize != 0 ||
+      out_nth->size != len * out_esize) {
+    _ml_error_report
+        ("The size of tensors[index: %u] is invalid. The input (%zu bytes) should be a multiple of %zu, and the output should be %zu bytes, while it is %zu bytes.",
+        index, in_nth->size, in_esize, len * out_esize, out_nth->size);
+    status = ML_ERROR_INVALID_PARAMETER;
+    goto report;
+  }
+
+  /* the output tensor may be shared with other handles */
+  status = _ml_tensors_data_make_writable (_out, index, (_out == _in));
+  if (status != ML_ERROR_NONE)
+    goto report;
+
+  src = in_nth->tensor;
+  dest = out_nth->tensor;
+
+  if (in_type == out_type && !quant) {
+    if (src != dest)
+      memcpy (dest, src, in_nth->size);
+  } else if (in_type == ML_TENSOR_TYPE_UINT8 &&
+      out_type == ML_TENSOR_TYPE_FLOAT32) {
+    gfloat scale[8], bias[8];
+    guint c;
+
+    for (c = 0; c < 8; c++) {
+      scale[c] = (quant) ? quant->scale : 1.0f;
+      bias[c] = (quant) ? -(gfloat) quant->zero_point * quant->scale : 0.0f;
+    }
+
+    ml_kernels.normalize (src, dest, len, scale, bias, 1);
+  } else if (in_type == ML_TENSOR_TYPE_INT8 &&
+      out_type == ML_TENSOR_TYPE_FLOAT32) {
+    ml_kernels.dequantize_s8 (src, dest, len,
+        (quant) ? quant->scale : 1.0f,
+        (quant) ? -(gfloat) quant->zero_point * quant->scale : 0.0f);
+  } else if (quant && in_type == ML_TENSOR_TYPE_FLOAT32 &&
+      (out_type == ML_TENSOR_TYPE_UINT8 || out_type == ML_TENSOR_TYPE_INT8)) {
+    ml_kernels.quantize (src, dest, len, 1.0f / quant->scale,
+        (gfloat) quant->zero_point, (out_type == ML_TENSOR_TYPE_INT8));
+  } else if (!in_float && !out_float) {
+    /* quant is not given for the pair of integer types */
+    kernel_convert_int (src, dest, len, in_type, out_type);
+  } else {
+    kernel_convert_generic (src, dest, len, in_type, out_type, quant);
+  }
+
+report:
+  kernel_unlock_data (_in, _out);
+  return status;
+}
@@ -12,12 +12,197 @@
 
 #include <string.h>
 #include <stdio.h>
+#include <stdlib.h>
 #include <stdarg.h>
 #include <glib.h>
+#if defined (__linux__)
+#include <sys/mman.h>
+#endif
 
 #include "nnstreamer.h"
 #include "ml-api-internal.h"
 
+static void _ml_tensors_info_reset_interned (ml_tensors_info_s * info);
+
+/**
+ * @brief The max number of handles cached in a thread for each type.
+ */
+#define ML_SLAB_CACHE_SIZE (32)
+
+/**
+ * @brief Per-thread cache of the released handles of tensors info and data.
+ * @details The cached handles keep the initialized lock, so the next handle is created without malloc and mutex init.
+ *          The handles are not bound to a thread. A handle destroyed in another thread than the one created it is cached in the thread destroying it, and the cache is freed when the thread exits.
+ */
+typedef struct {
+  guint num_info; /**< The number of cached info handles */
+  guint num_data; /**< The number of cached data handles */
+  ml_tensors_info_s *info[ML_SLAB_CACHE_SIZE]; /**< The cached info handles */
+  ml_tensors_data_s *data[ML_SLAB_CACHE_SIZE]; /**< The cached data handles */
+} ml_slab_cache_s;
+
+/**
+ * @brief Internal function to release the cache when the thread exits.
+ */
+static void
+_ml_slab_cache_free (gpointer data)
+{
+  ml_slab_cache_s *cache = (ml_slab_cache_s *) data;
+  guint i;
+
+  for (i = 0; i < cache->num_info; i++) {
+    g_mutex_clear (&cache->info[i]->lock);
+    g_free (cache->info[i]);
+  }
+
+  for (i = 0; i < cache->num_data; i++) {
+    g_mutex_clear (&cache->data[i]->lock);
+    g_free (cache->data[i]);
+  }
+
+  g_free (cache);
+}
+
+/**
+ * @brief The cache of the handles in current thread.
+ */
+static GPrivate ml_slab_cache = G_PRIVATE_INIT (_ml_slab_cache_free);
+
+/**
+ * @brief Internal function to get the cache of current thread.
+ */
+static ml_slab_cache_s *
+_ml_slab_cache_get (void)
+{
+  ml_slab_cache_s *cache = g_private_get (&ml_slab_cache);
+
+  if (cache == NULL) {
+    cache = g_new0 (ml_slab_cache_s, 1);
+    g_private_set (&ml_slab_cache, cache);
+  }
+
+  return cache;
+}
+
+/**
+ * @brief Internal function to allocate the tensors info handle, from the cache if available.
+ * @note The returned handle has the initialized lock. The caller should initialize the tensors info.
+ */
+static ml_tensors_info_s *
+_ml_tensors_info_alloc (void)
+{
+  ml_slab_cache_s *cache = _ml_slab_cache_get ();
+  ml_tensors_info_s *info;
+
+  if (cache->num_info > 0) {
+    info = cache->info[--cache->num_info];
+    info->released = FALSE;
+    info->is_extended = FALSE;
+    info->nolock = 0;
+    info->owner = NULL;
+  } else {
+    info = g_new0 (ml_tensors_info_s, 1);
+    if (info)
+      g_mutex_init (&info->lock);
+  }
+
+  return info;
+}
+
+/**
+ * @brief Internal function to release the tensors info handle into the cache.
+ * @note The caller should free the tensors info, mark it released and unlock the handle.
+ */
+static void
+_ml_tensors_info_release (ml_tensors_info_s * info)
+{
+  ml_slab_cache_s *cache = _ml_slab_cache_get ();
+
+#if defined (ML_API_DEBUG)
+  guint i;
+
+  for (i = 0; i < cache->num_info; i++) {
+    if (cache->info[i] == info) {
+      g_critical ("The tensors info handle %p is released twice.",
+          (void *) info);
+      return;
+    }
+  }
+#endif
+
+  if (cache->num_info < ML_SLAB_CACHE_SIZE) {
+    cache->info[cache->num_info++] = info;
+  } else {
+    g_mutex_clear (&info->lock);
+    g_free (info);
+  }
+}
+
+/**
+ * @brief Internal function to allocate the tensors data handle, from the cache if available.
+ * @note The returned handle has the initialized lock and the other fields are cleared.
+ */
+static ml_tensors_data_s *
+_ml_tensors_data_alloc (void)
+{
+  ml_slab_cache_s *cache = _ml_slab_cache_get ();
+  ml_tensors_data_s *data;
+
+  if (cache->num_data > 0) {
+    data = cache->data[--cache->num_data];
+
+    data->released = FALSE;
+    data->num_tensors = 0;
+    memset (data->tensors, 0, sizeof (data->tensors));
+    data->extra = NULL;
+    data->info = NULL;
+    data->user_data = NULL;
+    data->destroy = NULL;
+    data->alloc_flags = ML_TENSORS_DATA_FLAG_NONE;
+    memset (&data->allocator, 0, sizeof (ml_tensors_data_allocator_s));
+    data->owned = FALSE;
+    data->shared = NULL;
+    data->shared_mask = 0;
+    data->nolock = 0;
+    data->owner = NULL;
+  } else {
+    data = g_new0 (ml_tensors_data_s, 1);
+    if (data)
+      g_mutex_init (&data->lock);
+  }
+
+  return data;
+}
+
+/**
+ * @brief Internal function to release the tensors data handle into the cache.
+ * @note The caller should release the buffers and info, mark it released and unlock the handle.
+ */
+static void
+_ml_tensors_data_release (ml_tensors_data_s * data)
+{
+  ml_slab_cache_s *cache = _ml_slab_cache_get ();
+
+#if defined (ML_API_DEBUG)
+  guint i;
+
+  for (i = 0; i < cache->num_data; i++) {
+    if (cache->data[i] == data) {
+      g_critical ("The tensors data handle %p is released twice.",
+          (void *) data);
+      return;
+    }
+  }
+#endif
+
+  if (cache->num_data < ML_SLAB_CACHE_SIZE) {
+    cache->data[cache->num_data++] = data;
+  } else {
+    g_mutex_clear (&data->lock);
+    g_free (data);
+  }
+}
+
 /**
  * @brief Allocates a tensors information handle with default value.
  */
@@ -32,17 +217,59 @@ ml_tensors_info_create (ml_tensors_info_h * info)
     _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
         "The parameter, info, is NULL. Provide a valid pointer.");
 
-  *info = tensors_info = g_new0 (ml_tensors_info_s, 1);
+  *info = tensors_info = _ml_tensors_info_alloc ();
   if (tensors_info == NULL)
     _ml_error_report_return (ML_ERROR_OUT_OF_MEMORY,
         "Failed to allocate the tensors info handle. Out of memory?");
 
-  g_mutex_init (&tensors_info->lock);
-
   /* init tensors info struct */
   return _ml_tensors_info_initialize (tensors_info);
 }
 
+/**
+ * @brief Allocates a tensors information handle without the internal lock. (more info in nnstreamer.h)
+ */
+int
+ml_tensors_info_create_unlocked (ml_tensors_info_h * info)
+{
+  ml_tensors_info_s *tensors_info;
+  int status;
+
+  status = ml_tensors_info_create (info);
+  if (status != ML_ERROR_NONE)
+    _ml_error_report_return_continue (status,
+        "Failed to create the tensors info handle with ml_tensors_info_create (): %d.",
+        status);
+
+  /* the handle is confined to the current thread */
+  tensors_info = (ml_tensors_info_s *) (*info);
+  tensors_info->nolock = 1;
+  tensors_info->owner = g_thread_self ();
+
+  return ML_ERROR_NONE;
+}
+
+/**
+ * @brief Allocates a tensors information handle supporting more tensors and higher rank. (more info in ml-api-common.h)
+ */
+int
+ml_tensors_info_create_extended (ml_tensors_info_h * info)
+{
+  ml_tensors_info_s *tensors_info;
+  int status;
+
+  status = ml_tensors_info_create (info);
+  if (status != ML_ERROR_NONE)
+    _ml_error_report_return_continue (status,
+        "Failed to create the tensors info handle with ml_tensors_info_create (): %d.",
+        status);
+
+  tensors_info = (ml_tensors_info_s *) (*info);
+  tensors_info->is_extended = TRUE;
+
+  return ML_ERROR_NONE;
+}
+
 /**
  * @brief Frees the given handle of a tensors information.
  */
@@ -61,40 +288,193 @@ ml_tensors_info_destroy (ml_tensors_info_h info)
 
   G_LOCK_UNLESS_NOLOCK (*tensors_info);
 
+  /* the cached handle is still valid memory, reject to destroy it again */
+  if (tensors_info->released) {
+    G_UNLOCK_UNLESS_NOLOCK (*tensors_info);
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, info, is already destroyed. Do not destroy the handle twice.");
+  }
+
   _ml_tensors_info_free (tensors_info);
+  tensors_info->released = TRUE;
   G_UNLOCK_UNLESS_NOLOCK (*tensors_info);
-  g_mutex_clear (&tensors_info->lock);
-  g_free (tensors_info);
+
+  /* keep the handle with the lock for next one */
+  _ml_tensors_info_release (tensors_info);
 
   return ML_ERROR_NONE;
 }
 
+/**
+ * @brief Internal function to initialize the tensor info with default value.
+ * @details The dimensions beyond ML_TENSOR_RANK_LIMIT are 1, thus the tensor info set with ml_tensor_dimension is valid.
+ */
+static void
+_ml_tensor_info_initialize (ml_tensor_info_s * info)
+{
+  guint i;
+
+  info->name = NULL;
+  info->type = ML_TENSOR_TYPE_UNKNOWN;
+  info->dimension_ext = NULL;
+
+  for (i = 0; i < ML_TENSOR_RANK_LIMIT; i++)
+    info->dimension[i] = 0;
+}
+
+/**
+ * @brief Internal function to release the name and dimensions of the tensor info, and initialize it.
+ */
+static void
+_ml_tensor_info_clear (ml_tensor_info_s * info)
+{
+  g_free (info->name);
+  g_free (info->dimension_ext);
+
+  _ml_tensor_info_initialize (info);
+}
+
+/**
+ * @brief Gets the dimension of the given rank. (more info in ml-api-internal.h)
+ */
+unsigned int
+_ml_tensor_info_get_dimension (const ml_tensor_info_s * info, unsigned int rank)
+{
+  if (rank < ML_TENSOR_RANK_LIMIT)
+    return info->dimension[rank];
+
+  if (info->dimension_ext == NULL || rank >= ML_TENSOR_RANK_LIMIT_EXTENDED)
+    return 1;
+
+  return info->dimension_ext[rank - ML_TENSOR_RANK_LIMIT];
+}
+
+/**
+ * @brief Sets the dimension of the given rank. (more info in ml-api-internal.h)
+ */
+int
+_ml_tensor_info_set_dimension (ml_tensor_info_s * info, unsigned int rank,
+    unsigned int dim)
+{
+  guint i;
+
+  if (rank < ML_TENSOR_RANK_LIMIT) {
+    info->dimension[rank] = dim;
+    return ML_ERROR_NONE;
+  }
+
+  if (rank >= ML_TENSOR_RANK_LIMIT_EXTENDED)
+    return ML_ERROR_INVALID_PARAMETER;
+
+  /* the tensor of rank ML_TENSOR_RANK_LIMIT does not allocate the higher dimensions */
+  if (info->dimension_ext == NULL) {
+    if (dim == 1)
+      return ML_ERROR_NONE;
+
+    info->dimension_ext = g_try_new (unsigned int, ML_TENSOR_RANK_EXTRA);
+    if (info->dimension_ext == NULL)
+      return ML_ERROR_OUT_OF_MEMORY;
+
+    for (i = 0; i < ML_TENSOR_RANK_EXTRA; i++)
+      info->dimension_ext[i] = 1;
+  }
+
+  info->dimension_ext[rank - ML_TENSOR_RANK_LIMIT] = dim;
+  return ML_ERROR_NONE;
+}
+
 /**
  * @brief Initializes the tensors information with default value.
  */
 int
 _ml_tensors_info_initialize (ml_tensors_info_s * info)
 {
-  guint i, j;
+  guint i;
 
   if (!info)
     _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
         "The parameter, info, is NULL. Provide a valid pointer.");
 
+  _ml_tensors_info_reset_interned (info);
+
+  /* release the extra tensors */
+  if (info->extra) {
+    for (i = 0; i + ML_TENSOR_SIZE_LIMIT < info->num_tensors; i++)
+      _ml_tensor_info_clear (&info->extra[i]);
+
+    g_free (info->extra);
+    info->extra = NULL;
+  }
+
   info->num_tensors = 0;
 
-  for (i = 0; i < ML_TENSOR_SIZE_LIMIT; i++) {
-    info->info[i].name = NULL;
-    info->info[i].type = ML_TENSOR_TYPE_UNKNOWN;
+  /* release the names and higher dimensions, the info should be zero-filled or initialized before */
+  for (i = 0; i < ML_TENSOR_SIZE_LIMIT; i++)
+    _ml_tensor_info_clear (&info->info[i]);
 
-    for (j = 0; j < ML_TENSOR_RANK_LIMIT; j++) {
-      info->info[i].dimension[j] = 0;
-    }
+  return ML_ERROR_NONE;
+}
+
+/**
+ * @brief Resizes the list of extra tensors with the number of tensors. (more info in ml-api-internal.h)
+ */
+int
+_ml_tensors_info_resize_extra (ml_tensors_info_s * info, unsigned int count)
+{
+  ml_tensor_info_s *extra;
+  guint old_extra, new_extra, i;
+
+  old_extra = (info->num_tensors > ML_TENSOR_SIZE_LIMIT) ?
+      info->num_tensors - ML_TENSOR_SIZE_LIMIT : 0;
+  new_extra = (count > ML_TENSOR_SIZE_LIMIT) ?
+      count - ML_TENSOR_SIZE_LIMIT : 0;
+
+  if (old_extra == new_extra)
+    return ML_ERROR_NONE;
+
+  /* release the names and dimensions of the removed tensors */
+  for (i = new_extra; i < old_extra; i++)
+    _ml_tensor_info_clear (&info->extra[i]);
+
+  if (new_extra == 0) {
+    g_free (info->extra);
+    info->extra = NULL;
+    return ML_ERROR_NONE;
+  }
+
+  extra = g_try_renew (ml_tensor_info_s, info->extra, new_extra);
+  if (extra == NULL) {
+    /* keep the larger list if failed to shrink it */
+    if (new_extra < old_extra)
+      return ML_ERROR_NONE;
+
+    _ml_error_report_return (ML_ERROR_OUT_OF_MEMORY,
+        "Failed to allocate the tensors info of %u tensors. Out of memory?",
+        count);
   }
 
+  for (i = old_extra; i < new_extra; i++)
+    _ml_tensor_info_initialize (&extra[i]);
+
+  info->extra = extra;
   return ML_ERROR_NONE;
 }
 
+/**
+ * @brief Gets the tensor info of the given index. (more info in ml-api-internal.h)
+ */
+ml_tensor_info_s *
+_ml_tensors_info_get_nth_info (ml_tensors_info_s * info, unsigned int nth)
+{
+  if (info == NULL || nth >= info->num_tensors)
+    return NULL;
+
+  if (nth < ML_TENSOR_SIZE_LIMIT)
+    return &info->info[nth];
+
+  return &info->extra[nth - ML_TENSOR_SIZE_LIMIT];
+}
+
 /**
  * @brief Compares the given tensor info.
  */
@@ -110,8 +490,9 @@ ml_tensor_info_compare (const ml_tensor_info_s * i1,
   if (i1->type != i2->type)
     return FALSE;
 
-  for (i = 0; i < ML_TENSOR_RANK_LIMIT; i++) {
-    if (i1->dimension[i] != i2->dimension[i])
+  for (i = 0; i < ML_TENSOR_RANK_LIMIT_EXTENDED; i++) {
+    if (_ml_tensor_info_get_dimension (i1, i) !=
+        _ml_tensor_info_get_dimension (i2, i))
       return FALSE;
   }
 
@@ -133,14 +514,182 @@ ml_tensor_info_validate (const ml_tensor_info_s * info)
   if (info->type < 0 || info->type >= ML_TENSOR_TYPE_UNKNOWN)
     return FALSE;
 
-  for (i = 0; i < ML_TENSOR_RANK_LIMIT; i++) {
-    if (info->dimension[i] == 0)
+  for (i = 0; i < ML_TENSOR_RANK_LIMIT_EXTENDED; i++) {
+    if (_ml_tensor_info_get_dimension (info, i) == 0)
       return FALSE;
   }
 
   return TRUE;
 }
 
+/**
+ * @brief The table of the interned tensors info.
+ */
+static GHashTable *ml_tensors_info_interned_table = NULL;
+G_LOCK_DEFINE_STATIC (ml_tensors_info_interned);
+
+/**
+ * @brief Internal function to get the hash of the interned tensors info.
+ */
+static guint
+_ml_tensors_info_interned_hash (gconstpointer key)
+{
+  return ((const ml_tensors_info_interned_s *) key)->hash;
+}
+
+/**
+ * @brief Internal function to compare the types and dimensions of the interned tensors info.
+ */
+static gboolean
+_ml_tensors_info_interned_equal (gconstpointer a, gconstpointer b)
+{
+  const ml_tensors_info_interned_s *i1 = a;
+  const ml_tensors_info_interned_s *i2 = b;
+  guint i;
+
+  if (i1->hash != i2->hash || i1->num_tensors != i2->num_tensors)
+    return FALSE;
+
+  for (i = 0; i < i1->num_tensors; i++) {
+    if (!ml_tensor_info_compare (&i1->info[i], &i2->info[i]))
+      return FALSE;
+  }
+
+  return TRUE;
+}
+
+/**
+ * @brief Internal function to release the interned tensors info of the given info.
+ */
+static void
+_ml_tensors_info_reset_interned (ml_tensors_info_s * info)
+{
+  ml_tensors_info_interned_s *interned = info->interned;
+  gint count;
+
+  if (interned == NULL)
+    return;
+
+  info->interned = NULL;
+
+  /* drop the reference without the global lock unless it is the last one */
+  do {
+    count = g_atomic_int_get (&interned->ref_count);
+    if (count <= 1)
+      break;
+  } while (!g_atomic_int_compare_and_exchange (&interned->ref_count, count,
+          count - 1));
+
+  if (count > 1)
+    return;
+
+  /* the lookup may take a new reference before the lock, check it again */
+  G_LOCK (ml_tensors_info_interned);
+  if (g_atomic_int_dec_and_test (&interned->ref_count)) {
+    g_hash_table_remove (ml_tensors_info_interned_table, interned);
+    g_free (interned);
+  }
+  G_UNLOCK (ml_tensors_info_interned);
+}
+
+/**
+ * @brief Gets the canonical tensors info of the given tensors information. (more info in ml-api-internal.h)
+ */
+const ml_tensors_info_interned_s *
+_ml_tensors_info_get_interned (ml_tensors_info_s * info)
+{
+  ml_tensors_info_interned_s key, *interned;
+  ml_tensor_info_s key_info[ML_TENSOR_SIZE_LIMIT];
+  const ml_tensor_info_s *nth;
+  unsigned int *dimension_ext;
+  guint i, j;
+
+  if (info == NULL || info->num_tensors > ML_TENSOR_SIZE_LIMIT_EXTENDED)
+    return NULL;
+
+  if (info->interned)
+    return info->interned;
+
+  memset (&key, 0, sizeof (ml_tensors_info_interned_s));
+  key.num_tensors = info->num_tensors;
+  key.hash = info->num_tensors;
+
+  /* the key of the extended info is allocated */
+  key.info = (key.num_tensors <= ML_TENSOR_SIZE_LIMIT) ? key_info :
+      g_new (ml_tensor_info_s, key.num_tensors);
+
+  for (i = 0; i < key.num_tensors; i++) {
+    nth = _ml_tensors_info_get_nth_info (info, i);
+
+    /* the key refers the higher dimensions of the info while looking up */
+    key.info[i] = *nth;
+    key.info[i].name = NULL;
+    key.hash = key.hash * 31U + (guint) key.info[i].type;
+
+    for (j = 0; j < ML_TENSOR_RANK_LIMIT_EXTENDED; j++)
+      key.hash = key.hash * 31U + _ml_tensor_info_get_dimension (nth, j);
+  }
+
+  G_LOCK (ml_tensors_info_interned);
+  if (ml_tensors_info_interned_table == NULL) {
+    ml_tensors_info_interned_table =
+        g_hash_table_new (_ml_tensors_info_interned_hash,
+        _ml_tensors_info_interned_equal);
+  }
+
+  interned = g_hash_table_lookup (ml_tensors_info_interned_table, &key);
+  if (interned) {
+    g_atomic_int_inc (&interned->ref_count);
+  } else {
+    /* the lists are allocated with the instance, sized to the number of tensors */
+    interned = g_malloc0 (sizeof (ml_tensors_info_interned_s) +
+        key.num_tensors * (sizeof (ml_tensor_info_s) + sizeof (size_t) +
+            ML_TENSOR_RANK_EXTRA * sizeof (unsigned int)));
+    *interned = key;
+    interned->ref_count = 1;
+    interned->info = (ml_tensor_info_s *) (interned + 1);
+    interned->size = (size_t *) (interned->info + key.num_tensors);
+    dimension_ext = (unsigned int *) (interned->size + key.num_tensors);
+    memcpy (interned->info, key.info,
+        key.num_tensors * sizeof (ml_tensor_info_s));
+
+    /* copy the higher dimensions, the key refers the ones of the info */
+    for (i = 0; i < key.num_tensors; i++) {
+      if (key.info[i].dimension_ext == NULL)
+        continue;
+
+      interned->info[i].dimension_ext = dimension_ext + i * ML_TENSOR_RANK_EXTRA;
+      memcpy (interned->info[i].dimension_ext, key.info[i].dimension_ext,
+          ML_TENSOR_RANK_EXTRA * sizeof (unsigned int));
+    }
+
+    interned->valid = (key.num_tensors > 0);
+    for (i = 0; i < key.num_tensors; i++) {
+      if (!ml_tensor_info_validate (&interned->info[i])) {
+        interned->valid = FALSE;
+        break;
+      }
+    }
+
+    /* the size is computed once for each shape, 0 if the type is invalid */
+    for (i = 0; i < key.num_tensors; i++) {
+      if (interned->info[i].type >= 0 &&
+          interned->info[i].type < ML_TENSOR_TYPE_UNKNOWN)
+        interned->size[i] = _ml_tensor_info_get_size (&interned->info[i]);
+      interned->total_size += interned->size[i];
+    }
+
+    g_hash_table_add (ml_tensors_info_interned_table, interned);
+  }
+  G_UNLOCK (ml_tensors_info_interned);
+
+  if (key.info != key_info)
+    g_free (key.info);
+
+  info->interned = interned;
+  return interned;
+}
+
 /**
  * @brief Validates the given tensors info is valid without acquiring lock
  * @note This function assumes that lock on ml_tensors_info_h has already been acquired
@@ -160,14 +709,19 @@ _ml_tensors_info_validate_nolock (const ml_tensors_info_s * info, bool *valid)
         info->num_tensors);
   }
 
+  /* the validity is checked once when the info is interned */
+  if (info->interned) {
+    *valid = info->interned->valid;
+    return ML_ERROR_NONE;
+  }
+
   for (i = 0; i < info->num_tensors; i++) {
-    if (!ml_tensor_info_validate (&info->info[i]))
-      goto done;
+    if (!ml_tensor_info_validate (_ml_tensors_info_get_nth_info (
+                (ml_tensors_info_s *) info, i)))
+      return ML_ERROR_NONE;
   }
 
   *valid = true;
-
-done:
   return ML_ERROR_NONE;
 }
 
@@ -233,8 +787,15 @@ _ml_tensors_info_compare (const ml_tensors_info_h info1,
   if (i1->num_tensors != i2->num_tensors)
     goto done;
 
+  /* same shapes share the interned instance */
+  if (i1->interned && i2->interned) {
+    *equal = (i1->interned == i2->interned);
+    goto done;
+  }
+
   for (i = 0; i < i1->num_tensors; i++) {
-    if (!ml_tensor_info_compare (&i1->info[i], &i2->info[i]))
+    if (!ml_tensor_info_compare (_ml_tensors_info_get_nth_info (i1, i),
+            _ml_tensors_info_get_nth_info (i2, i)))
       goto done;
   }
 
@@ -253,23 +814,33 @@ int
 ml_tensors_info_set_count (ml_tensors_info_h info, unsigned int count)
 {
   ml_tensors_info_s *tensors_info;
+  guint limit;
+  int status;
 
   check_feature_state ();
 
   if (!info)
     _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
         "The parameter, info, is NULL. It should be a valid ml_tensors_info_h handle, which is usually created by ml_tensors_info_create().");
-  if (count > ML_TENSOR_SIZE_LIMIT || count == 0)
-    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
-        "The parameter, count, is the number of tensors, which should be between 1 and 16. The given count is %u.",
-        count);
 
   tensors_info = (ml_tensors_info_s *) info;
+  limit = (tensors_info->is_extended) ?
+      ML_TENSOR_SIZE_LIMIT_EXTENDED : ML_TENSOR_SIZE_LIMIT;
 
-  /* This is atomic. No need for locks */
-  tensors_info->num_tensors = count;
+  if (count > limit || count == 0)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, count, is the number of tensors, which should be between 1 and %u. The given count is %u.",
+        limit, count);
 
-  return ML_ERROR_NONE;
+  G_LOCK_UNLESS_NOLOCK (*tensors_info);
+
+  _ml_tensors_info_reset_interned (tensors_info);
+  status = _ml_tensors_info_resize_extra (tensors_info, count);
+  if (status == ML_ERROR_NONE)
+    tensors_info->num_tensors = count;
+
+  G_UNLOCK_UNLESS_NOLOCK (*tensors_info);
+  return status;
 }
 
 /**
@@ -304,6 +875,7 @@ ml_tensors_info_set_tensor_name (ml_tensors_info_h info,
     unsigned int index, const char *name)
 {
   ml_tensors_info_s *tensors_info;
+  ml_tensor_info_s *_info;
 
   check_feature_state ();
 
@@ -321,13 +893,14 @@ ml_tensors_info_set_tensor_name (ml_tensors_info_h info,
         tensors_info->num_tensors, index);
   }
 
-  if (tensors_info->info[index].name) {
-    g_free (tensors_info->info[index].name);
-    tensors_info->info[index].name = NULL;
+  _info = _ml_tensors_info_get_nth_info (tensors_info, index);
+  if (_info->name) {
+    g_free (_info->name);
+    _info->name = NULL;
   }
 
   if (name)
-    tensors_info->info[index].name = g_strdup (name);
+    _info->name = g_strdup (name);
 
   G_UNLOCK_UNLESS_NOLOCK (*tensors_info);
   return ML_ERROR_NONE;
@@ -361,7 +934,7 @@ ml_tensors_info_get_tensor_name (ml_tensors_info_h info,
         tensors_info->num_tensors, index);
   }
 
-  *name = g_strdup (tensors_info->info[index].name);
+  *name = g_strdup (_ml_tensors_info_get_nth_info (tensors_info, index)->name);
 
   G_UNLOCK_UNLESS_NOLOCK (*tensors_info);
   return ML_ERROR_NONE;
@@ -395,7 +968,8 @@ ml_tensors_info_set_tensor_type (ml_tensors_info_h info,
     return ML_ERROR_INVALID_PARAMETER;
   }
 
-  tensors_info->info[index].type = type;
+  _ml_tensors_info_reset_interned (tensors_info);
+  _ml_tensors_info_get_nth_info (tensors_info, index)->type = type;
 
   G_UNLOCK_UNLESS_NOLOCK (*tensors_info);
   return ML_ERROR_NONE;
@@ -427,7 +1001,7 @@ ml_tensors_info_get_tensor_type (ml_tensors_info_h info,
     return ML_ERROR_INVALID_PARAMETER;
   }
 
-  *type = tensors_info->info[index].type;
+  *type = _ml_tensors_info_get_nth_info (tensors_info, index)->type;
 
   G_UNLOCK_UNLESS_NOLOCK (*tensors_info);
   return ML_ERROR_NONE;
@@ -441,6 +1015,7 @@ ml_tensors_info_set_tensor_dimension (ml_tensors_info_h info,
     unsigned int index, const ml_tensor_dimension dimension)
 {
   ml_tensors_info_s *tensors_info;
+  ml_tensor_info_s *_info;
   guint i;
 
   check_feature_state ();
@@ -457,10 +1032,17 @@ ml_tensors_info_set_tensor_dimension (ml_tensors_info_h info,
     return ML_ERROR_INVALID_PARAMETER;
   }
 
+  _ml_tensors_info_reset_interned (tensors_info);
+  _info = _ml_tensors_info_get_nth_info (tensors_info, index);
+
+  /* the rank is ML_TENSOR_RANK_LIMIT, the remaining dimensions are 1 */
   for (i = 0; i < ML_TENSOR_RANK_LIMIT; i++) {
-    tensors_info->info[index].dimension[i] = dimension[i];
+    _info->dimension[i] = dimension[i];
   }
 
+  g_free (_info->dimension_ext);
+  _info->dimension_ext = NULL;
+
   G_UNLOCK_UNLESS_NOLOCK (*tensors_info);
   return ML_ERROR_NONE;
 }
@@ -473,6 +1055,7 @@ ml_tensors_info_get_tensor_dimension (ml_tensors_info_h info,
     unsigned int index, ml_tensor_dimension dimension)
 {
   ml_tensors_info_s *tensors_info;
+  ml_tensor_info_s *_info;
   guint i;
 
   check_feature_state ();
@@ -489,8 +1072,115 @@ ml_tensors_info_get_tensor_dimension (ml_tensors_info_h info,
     return ML_ERROR_INVALID_PARAMETER;
   }
 
+  _info = _ml_tensors_info_get_nth_info (tensors_info, index);
   for (i = 0; i < ML_TENSOR_RANK_LIMIT; i++) {
-    dimension[i] = tensors_info->info[index].dimension[i];
+    dimension[i] = _info->dimension[i];
+  }
+
+  /* fold the higher rank into the last dimension, the number of elements is kept */
+  for (; i < ML_TENSOR_RANK_LIMIT_EXTENDED; i++) {
+    dimension[ML_TENSOR_RANK_LIMIT - 1] *=
+        _ml_tensor_info_get_dimension (_info, i);
+  }
+
+  G_UNLOCK_UNLESS_NOLOCK (*tensors_info);
+  return ML_ERROR_NONE;
+}
+
+/**
+ * @brief Sets the tensor dimension with the extended rank. (more info in ml-api-common.h)
+ */
+int
+ml_tensors_info_set_tensor_dimension_extended (ml_tensors_info_h info,
+    unsigned int index, const ml_tensor_dimension_extended dimension)
+{
+  ml_tensors_info_s *tensors_info;
+  ml_tensor_info_s *_info;
+  guint i;
+  int status;
+
+  check_feature_state ();
+
+  if (!info)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, info, is NULL. It should be a valid pointer of ml_tensors_info_h, which is usually created by ml_tensors_info_create_extended().");
+  if (!dimension)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, dimension, is NULL. It should be an array of %d dimensions.",
+        ML_TENSOR_RANK_LIMIT_EXTENDED);
+
+  tensors_info = (ml_tensors_info_s *) info;
+
+  if (!tensors_info->is_extended) {
+    for (i = ML_TENSOR_RANK_LIMIT; i < ML_TENSOR_RANK_LIMIT_EXTENDED; i++) {
+      if (dimension[i] != 1)
+        _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+            "The parameter, dimension[%u] (%u), should be 1. The rank of the tensors info is limited to %d. Create the handle with ml_tensors_info_create_extended() for higher rank.",
+            i, dimension[i], ML_TENSOR_RANK_LIMIT);
+    }
+  }
+
+  G_LOCK_UNLESS_NOLOCK (*tensors_info);
+
+  if (tensors_info->num_tensors <= index) {
+    G_UNLOCK_UNLESS_NOLOCK (*tensors_info);
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, index (%u), is too large. It should be smaller than the number of tensors (%u).",
+        index, tensors_info->num_tensors);
+  }
+
+  _ml_tensors_info_reset_interned (tensors_info);
+  _info = _ml_tensors_info_get_nth_info (tensors_info, index);
+
+  /* set the higher rank first, the tensor info is not changed if failed */
+  for (i = ML_TENSOR_RANK_LIMIT_EXTENDED; i > 0; i--) {
+    status = _ml_tensor_info_set_dimension (_info, i - 1, dimension[i - 1]);
+    if (status != ML_ERROR_NONE) {
+      G_UNLOCK_UNLESS_NOLOCK (*tensors_info);
+      _ml_error_report_return (status,
+          "Failed to allocate the dimensions of the tensor (index %u). Out of memory?",
+          index);
+    }
+  }
+
+  G_UNLOCK_UNLESS_NOLOCK (*tensors_info);
+  return ML_ERROR_NONE;
+}
+
+/**
+ * @brief Gets the tensor dimension with the extended rank. (more info in ml-api-common.h)
+ */
+int
+ml_tensors_info_get_tensor_dimension_extended (ml_tensors_info_h info,
+    unsigned int index, ml_tensor_dimension_extended dimension)
+{
+  ml_tensors_info_s *tensors_info;
+  ml_tensor_info_s *_info;
+  guint i;
+
+  check_feature_state ();
+
+  if (!info)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, info, is NULL. It should be a valid pointer of ml_tensors_info_h, which is usually created by ml_tensors_info_create_extended().");
+  if (!dimension)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, dimension, is NULL. It should be an array of %d dimensions.",
+        ML_TENSOR_RANK_LIMIT_EXTENDED);
+
+  tensors_info = (ml_tensors_info_s *) info;
+  G_LOCK_UNLESS_NOLOCK (*tensors_info);
+
+  if (tensors_info->num_tensors <= index) {
+    G_UNLOCK_UNLESS_NOLOCK (*tensors_info);
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, index (%u), is too large. It should be smaller than the number of tensors (%u).",
+        index, tensors_info->num_tensors);
+  }
+
+  _info = _ml_tensors_info_get_nth_info (tensors_info, index);
+  for (i = 0; i < ML_TENSOR_RANK_LIMIT_EXTENDED; i++) {
+    dimension[i] = _ml_tensor_info_get_dimension (_info, i);
   }
 
   G_UNLOCK_UNLESS_NOLOCK (*tensors_info);
@@ -533,8 +1223,8 @@ _ml_tensor_info_get_size (const ml_tensor_info_s * info)
       return 0;
   }
 
-  for (i = 0; i < ML_TENSOR_RANK_LIMIT; i++) {
-    tensor_size *= info->dimension[i];
+  for (i = 0; i < ML_TENSOR_RANK_LIMIT_EXTENDED; i++) {
+    tensor_size *= _ml_tensor_info_get_dimension (info, i);
   }
 
   return tensor_size;
@@ -548,6 +1238,8 @@ ml_tensors_info_get_tensor_size (ml_tensors_info_h info,
     int index, size_t *data_size)
 {
   ml_tensors_info_s *tensors_info;
+  const ml_tensors_info_interned_s *interned;
+  guint i;
 
   check_feature_state ();
 
@@ -564,12 +1256,17 @@ ml_tensors_info_get_tensor_size (ml_tensors_info_h info,
   /* init 0 */
   *data_size = 0;
 
-  if (index < 0) {
-    guint i;
+  /* the size is cached in the interned info, the info is not changed here */
+  interned = tensors_info->interned;
 
+  if (index < 0) {
     /* get total byte size */
-    for (i = 0; i < tensors_info->num_tensors; i++) {
-      *data_size += _ml_tensor_info_get_size (&tensors_info->info[i]);
+    if (interned) {
+      *data_size = interned->total_size;
+    } else {
+      for (i = 0; i < tensors_info->num_tensors; i++)
+        *data_size += _ml_tensor_info_get_size (_ml_tensors_info_get_nth_info
+            (tensors_info, i));
     }
   } else {
     if (tensors_info->num_tensors <= index) {
@@ -579,7 +1276,9 @@ ml_tensors_info_get_tensor_size (ml_tensors_info_h info,
           index, tensors_info->num_tensors);
     }
 
-    *data_size = _ml_tensor_info_get_size (&tensors_info->info[index]);
+    *data_size = (interned) ? interned->size[index] :
+        _ml_tensor_info_get_size (_ml_tensors_info_get_nth_info (tensors_info,
+            index));
   }
 
   G_UNLOCK_UNLESS_NOLOCK (*tensors_info);
@@ -593,19 +1292,180 @@ ml_tensors_info_get_tensor_size (ml_tensors_info_h info,
 void
 _ml_tensors_info_free (ml_tensors_info_s * info)
 {
-  gint i;
+  guint i;
+
+  if (!info)
+    return;
+
+  for (i = 0; i < ML_TENSOR_SIZE_LIMIT; i++)
+    _ml_tensor_info_clear (&info->info[i]);
+
+  /* release the extra tensors beyond ML_TENSOR_SIZE_LIMIT */
+  if (info->extra) {
+    for (i = 0; i + ML_TENSOR_SIZE_LIMIT < info->num_tensors; i++)
+      _ml_tensor_info_clear (&info->extra[i]);
+
+    g_free (info->extra);
+    info->extra = NULL;
+  }
+
+  _ml_tensors_info_initialize (info);
+}
+
+/**
+ * @brief The size of huge page, the tensor larger than this is allocated with huge page if required.
+ */
+#define ML_TENSORS_DATA_HUGE_PAGE_SIZE (2U * 1024U * 1024U)
+
+/**
+ * @brief All flags for the allocation of tensor buffers.
+ */
+#define ML_TENSORS_DATA_FLAG_ALL \
+  (ML_TENSORS_DATA_FLAG_ALIGNED | ML_TENSORS_DATA_FLAG_NO_ZERO_FILL | \
+   ML_TENSORS_DATA_FLAG_HUGE_PAGE | ML_TENSORS_DATA_FLAG_CONTIGUOUS)
+
+/**
+ * @brief Internal function to allocate a tensor buffer with the flags and allocator of the data.
+ */
+static void *
+_ml_tensor_buffer_alloc (ml_tensors_data_s * data, size_t size)
+{
+  int flags = data->alloc_flags;
+  size_t alignment = 0;
+  void *mem = NULL;
+
+  if (flags & (ML_TENSORS_DATA_FLAG_ALIGNED | ML_TENSORS_DATA_FLAG_HUGE_PAGE |
+          ML_TENSORS_DATA_FLAG_CONTIGUOUS))
+    alignment = ML_TENSORS_DATA_ALIGNMENT;
+  if ((flags & ML_TENSORS_DATA_FLAG_HUGE_PAGE) &&
+      size >= ML_TENSORS_DATA_HUGE_PAGE_SIZE)
+    alignment = ML_TENSORS_DATA_HUGE_PAGE_SIZE;
+
+  if (data->allocator.alloc) {
+    mem = data->allocator.alloc (size, alignment, data->allocator.user_data);
+  } else if (alignment > 0) {
+    if (posix_memalign (&mem, alignment, size) != 0)
+      mem = NULL;
+#if defined (MADV_HUGEPAGE)
+    if (mem && alignment == ML_TENSORS_DATA_HUGE_PAGE_SIZE)
+      madvise (mem, size, MADV_HUGEPAGE);
+#endif
+  } else {
+    /* calloc gets the zeroed pages for large buffer */
+    return (flags & ML_TENSORS_DATA_FLAG_NO_ZERO_FILL) ?
+        g_try_malloc (size) : g_try_malloc0 (size);
+  }
+
+  if (mem && !(flags & ML_TENSORS_DATA_FLAG_NO_ZERO_FILL))
+    memset (mem, 0, size);
+
+  return mem;
+}
+
+/**
+ * @brief Internal function to release a tensor buffer with the given allocator.
+ * @note The aligned buffer from posix_memalign() is released with free(), same as g_free().
+ */
+static void
+_ml_tensor_buffer_free (const ml_tensors_data_allocator_s * allocator,
+    void *mem)
+{
+  if (allocator->free)
+    allocator->free (mem, allocator->user_data);
+  else
+    g_free (mem);
+}
+
+/**
+ * @brief Internal function to release the buffers shared by the handles of tensors data.
+ */
+static void
+_ml_tensors_data_shared_unref (ml_tensors_data_shared_s * shared)
+{
+  guint i;
+
+  if (!g_atomic_int_dec_and_test (&shared->ref_count))
+    return;
+
+  if (shared->alloc_flags & ML_TENSORS_DATA_FLAG_CONTIGUOUS) {
+    _ml_tensor_buffer_free (&shared->allocator, shared->tensors[0]);
+  } else {
+    for (i = 0; i < shared->num_tensors; i++) {
+      if (shared->tensors[i])
+        _ml_tensor_buffer_free (&shared->allocator, shared->tensors[i]);
+    }
+  }
+
+  g_free (shared);
+}
+
+/**
+ * @brief Gets the tensor data of the given index. (more info in ml-api-internal.h)
+ */
+ml_tensor_data_s *
+_ml_tensors_data_get_nth_data (ml_tensors_data_s * data, unsigned int nth)
+{
+  if (data == NULL || nth >= data->num_tensors)
+    return NULL;
+
+  if (nth < ML_TENSOR_SIZE_LIMIT)
+    return &data->tensors[nth];
+
+  return &data->extra[nth - ML_TENSOR_SIZE_LIMIT];
+}
+
+/**
+ * @brief Internal function to get the offset of each tensor in the single block.
+ * @return The byte size of the block.
+ */
+static size_t
+_ml_tensors_data_get_block_offsets (ml_tensors_data_s * data,
+    size_t * offsets)
+{
+  size_t total = 0;
+  guint i;
+
+  for (i = 0; i < data->num_tensors; i++) {
+    /* each tensor starts at the aligned offset */
+    total = (total + ML_TENSORS_DATA_ALIGNMENT - 1) &
+        ~((size_t) ML_TENSORS_DATA_ALIGNMENT - 1);
+    if (offsets)
+      offsets[i] = total;
+    total += _ml_tensors_data_get_nth_data (data, i)->size;
+  }
+
+  return total;
+}
+
+/**
+ * @brief Allocates the tensors of the data in a single block. (more info in ml-api-internal.h)
+ */
+int
+_ml_tensors_data_alloc_block (ml_tensors_data_s * data)
+{
+  size_t offsets[ML_TENSOR_SIZE_LIMIT_EXTENDED];
+  size_t total;
+  guint8 *block;
+  guint i;
+
+  if (data == NULL || data->num_tensors == 0)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, data, is NULL or has no tensor. It should be a valid ml_tensors_data_h handle with tensors.");
 
-  if (!info)
-    return;
+  data->alloc_flags |= ML_TENSORS_DATA_FLAG_CONTIGUOUS;
+  total = _ml_tensors_data_get_block_offsets (data, offsets);
 
-  for (i = 0; i < ML_TENSOR_SIZE_LIMIT; i++) {
-    if (info->info[i].name) {
-      g_free (info->info[i].name);
-      info->info[i].name = NULL;
-    }
-  }
+  block = (guint8 *) _ml_tensor_buffer_alloc (data, total);
+  if (block == NULL)
+    _ml_error_report_return (ML_ERROR_OUT_OF_MEMORY,
+        "Failed to allocate a block of %zu bytes for tensors data. Check if it's out-of-memory.",
+        total);
 
-  _ml_tensors_info_initialize (info);
+  for (i = 0; i < data->num_tensors; i++)
+    _ml_tensors_data_get_nth_data (data, i)->tensor = block + offsets[i];
+
+  data->owned = TRUE;
+  return ML_ERROR_NONE;
 }
 
 /**
@@ -619,7 +1479,7 @@ _ml_tensors_data_destroy_internal (ml_tensors_data_h data, gboolean free_data)
 {
   int status = ML_ERROR_NONE;
   ml_tensors_data_s *_data;
-  guint i;
+  guint i, num_extra;
 
   if (data == NULL)
     _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
@@ -628,28 +1488,74 @@ _ml_tensors_data_destroy_internal (ml_tensors_data_h data, gboolean free_data)
   _data = (ml_tensors_data_s *) data;
   G_LOCK_UNLESS_NOLOCK (*_data);
 
+  /* the cached handle is still valid memory, reject to destroy it again */
+  if (_data->released) {
+    G_UNLOCK_UNLESS_NOLOCK (*_data);
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, data, is already destroyed. Do not destroy the handle twice.");
+  }
+
+  num_extra = (_data->extra && _data->num_tensors > ML_TENSOR_SIZE_LIMIT) ?
+      _data->num_tensors - ML_TENSOR_SIZE_LIMIT : 0;
+
   if (free_data) {
-    if (_data->destroy) {
+    if (_data->shared) {
+      /* free the private copies only, the shared buffers are released below */
+      if (_data->alloc_flags & ML_TENSORS_DATA_FLAG_CONTIGUOUS) {
+        /* the private copy is a single block, see _ml_tensors_data_make_writable () */
+        if (_data->shared_mask == 0 && _data->tensors[0].tensor)
+          _ml_tensor_buffer_free (&_data->allocator, _data->tensors[0].tensor);
+      } else {
+        for (i = 0; i < _data->num_tensors; i++) {
+          if (!(_data->shared_mask & (1U << i)) && _data->tensors[i].tensor)
+            _ml_tensor_buffer_free (&_data->allocator,
+                _data->tensors[i].tensor);
+        }
+      }
+      for (i = 0; i < ML_TENSOR_SIZE_LIMIT; i++)
+        _data->tensors[i].tensor = NULL;
+    } else if (_data->destroy) {
       status = _data->destroy (_data, _data->user_data);
       if (status != ML_ERROR_NONE)
         _ml_error_report_return_continue (status,
             "Tried to destroy internal user_data of the given parameter, data, with its destroy callback; however, it has failed with %d.",
             status);
+    } else if (_data->alloc_flags & ML_TENSORS_DATA_FLAG_CONTIGUOUS) {
+      /* the first tensor is the head of the block */
+      if (_data->tensors[0].tensor)
+        _ml_tensor_buffer_free (&_data->allocator, _data->tensors[0].tensor);
+      for (i = 0; i < ML_TENSOR_SIZE_LIMIT; i++)
+        _data->tensors[i].tensor = NULL;
     } else {
       for (i = 0; i < ML_TENSOR_SIZE_LIMIT; i++) {
         if (_data->tensors[i].tensor) {
-          g_free (_data->tensors[i].tensor);
+          _ml_tensor_buffer_free (&_data->allocator, _data->tensors[i].tensor);
           _data->tensors[i].tensor = NULL;
         }
       }
+
+      for (i = 0; i < num_extra; i++) {
+        if (_data->extra[i].tensor)
+          _ml_tensor_buffer_free (&_data->allocator, _data->extra[i].tensor);
+      }
     }
   }
 
+  g_free (_data->extra);
+  _data->extra = NULL;
+
+  if (_data->shared) {
+    _ml_tensors_data_shared_unref (_data->shared);
+    _data->shared = NULL;
+  }
+
   ml_tensors_info_destroy (_data->info);
 
+  _data->released = TRUE;
   G_UNLOCK_UNLESS_NOLOCK (*_data);
-  g_mutex_clear (&_data->lock);
-  g_free (_data);
+
+  /* keep the handle with the lock for next one */
+  _ml_tensors_data_release (_data);
   return status;
 }
 
@@ -679,6 +1585,8 @@ _ml_tensors_data_create_no_alloc (const ml_tensors_info_h info,
 {
   ml_tensors_data_s *_data;
   ml_tensors_info_s *_info;
+  ml_tensor_data_s *nth;
+  const ml_tensors_info_interned_s *interned;
   gint i;
 
   check_feature_state ();
@@ -690,12 +1598,10 @@ _ml_tensors_data_create_no_alloc (const ml_tensors_info_h info,
   /* init null */
   *data = NULL;
 
-  _data = g_new0 (ml_tensors_data_s, 1);
+  _data = _ml_tensors_data_alloc ();
   if (!_data)
     _ml_error_report_return (ML_ERROR_OUT_OF_MEMORY,
-        "Failed to allocate memory for tensors data with g_new0(). Probably the system is out of memory.");
-
-  g_mutex_init (&_data->lock);
+        "Failed to allocate memory for tensors data. Probably the system is out of memory.");
 
   _info = (ml_tensors_info_s *) info;
   if (_info != NULL) {
@@ -703,10 +1609,27 @@ _ml_tensors_data_create_no_alloc (const ml_tensors_info_h info,
     ml_tensors_info_clone (_data->info, info);
 
     G_LOCK_UNLESS_NOLOCK (*_info);
+
+    /* the tensors beyond the limit are allocated with the number of tensors */
+    if (_info->num_tensors > ML_TENSOR_SIZE_LIMIT) {
+      _data->extra = g_try_new0 (ml_tensor_data_s,
+          _info->num_tensors - ML_TENSOR_SIZE_LIMIT);
+      if (_data->extra == NULL) {
+        G_UNLOCK_UNLESS_NOLOCK (*_info);
+        _ml_tensors_data_destroy_internal (_data, FALSE);
+        _ml_error_report_return (ML_ERROR_OUT_OF_MEMORY,
+            "Failed to allocate memory for %u tensors. Probably the system is out of memory.",
+            _info->num_tensors);
+      }
+    }
+
+    interned = _ml_tensors_info_get_interned (_info);
     _data->num_tensors = _info->num_tensors;
     for (i = 0; i < _data->num_tensors; i++) {
-      _data->tensors[i].size = _ml_tensor_info_get_size (&_info->info[i]);
-      _data->tensors[i].tensor = NULL;
+      nth = _ml_tensors_data_get_nth_data (_data, i);
+      nth->size = (interned) ? interned->size[i] :
+          _ml_tensor_info_get_size (_ml_tensors_info_get_nth_info (_info, i));
+      nth->tensor = NULL;
     }
     G_UNLOCK_UNLESS_NOLOCK (*_info);
   }
@@ -746,7 +1669,12 @@ _ml_tensors_data_clone_no_alloc (const ml_tensors_data_s * data_src,
 
   _data->num_tensors = data_src->num_tensors;
   memcpy (_data->tensors, data_src->tensors,
-      sizeof (ml_tensor_data_s) * data_src->num_tensors);
+      sizeof (ml_tensor_data_s) * MIN (data_src->num_tensors,
+          ML_TENSOR_SIZE_LIMIT));
+  if (_data->extra && data_src->extra) {
+    memcpy (_data->extra, data_src->extra, sizeof (ml_tensor_data_s) *
+        (data_src->num_tensors - ML_TENSOR_SIZE_LIMIT));
+  }
 
   *data = _data;
   G_UNLOCK_UNLESS_NOLOCK (*_data);
@@ -758,6 +1686,17 @@ _ml_tensors_data_clone_no_alloc (const ml_tensors_data_s * data_src,
  */
 int
 ml_tensors_data_create (const ml_tensors_info_h info, ml_tensors_data_h * data)
+{
+  return ml_tensors_data_create_full (info, ML_TENSORS_DATA_FLAG_NONE, NULL,
+      data);
+}
+
+/**
+ * @brief Allocates a tensor data frame with the given tensors info, flags and allocator. (more info in nnstreamer.h)
+ */
+int
+ml_tensors_data_create_full (const ml_tensors_info_h info, int flags,
+    const ml_tensors_data_allocator_s * allocator, ml_tensors_data_h * data)
 {
   gint status = ML_ERROR_STREAMS_PIPE;
   ml_tensors_data_s *_data = NULL;
@@ -772,6 +1711,13 @@ ml_tensors_data_create (const ml_tensors_info_h info, ml_tensors_data_h * data)
   if (data == NULL)
     _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
         "The parameter, data, is NULL. It should be a valid ml_tensors_data_h handle, which is usually created by ml_tensors_data_create ().");
+  if (flags & ~ML_TENSORS_DATA_FLAG_ALL)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, flags (0x%x), has unknown bits. It should be the bitwise OR of ml_tensors_data_flag_e.",
+        flags);
+  if (allocator && (allocator->alloc == NULL || allocator->free == NULL))
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, allocator, is not NULL, but its alloc or free callback is NULL. Both callbacks should be given.");
 
   status = ml_tensors_info_validate (info, &valid);
   if (status != ML_ERROR_NONE)
@@ -790,26 +1736,235 @@ ml_tensors_data_create (const ml_tensors_info_h info, ml_tensors_data_h * data)
         status);
   }
 
-  for (i = 0; i < _data->num_tensors; i++) {
-    _data->tensors[i].tensor = g_malloc0 (_data->tensors[i].size);
-    if (_data->tensors[i].tensor == NULL) {
+  _data->alloc_flags = flags;
+  if (allocator)
+    _data->allocator = *allocator;
+
+  if (flags & ML_TENSORS_DATA_FLAG_CONTIGUOUS) {
+    if (_ml_tensors_data_alloc_block (_data) != ML_ERROR_NONE)
       goto failed_oom;
+  } else {
+    for (i = 0; i < _data->num_tensors; i++) {
+      ml_tensor_data_s *nth = _ml_tensors_data_get_nth_data (_data, i);
+
+      nth->tensor = _ml_tensor_buffer_alloc (_data, nth->size);
+      if (nth->tensor == NULL) {
+        goto failed_oom;
+      }
     }
+
+    _data->owned = TRUE;
   }
 
   *data = _data;
   return ML_ERROR_NONE;
 
 failed_oom:
-  for (i = 0; i < _data->num_tensors; i++) {
-    g_free (_data->tensors[i].tensor);
-  }
-  g_free (_data);
+  _ml_tensors_data_destroy_internal (_data, TRUE);
 
   _ml_error_report_return (ML_ERROR_OUT_OF_MEMORY,
       "Failed to allocate memory blocks for tensors data. Check if it's out-of-memory.");
 }
 
+/**
+ * @brief Allocates a tensor data frame without the internal lock. (more info in nnstreamer.h)
+ */
+int
+ml_tensors_data_create_unlocked (const ml_tensors_info_h info,
+    ml_tensors_data_h * data)
+{
+  ml_tensors_data_s *_data;
+  ml_tensors_info_s *_info;
+  int status;
+
+  status = ml_tensors_data_create_full (info, ML_TENSORS_DATA_FLAG_NONE, NULL,
+      data);
+  if (status != ML_ERROR_NONE)
+    _ml_error_report_return_continue (status,
+        "Failed to create the tensors data handle with ml_tensors_data_create_full (): %d.",
+        status);
+
+  /* the handle and its tensors info are confined to the current thread */
+  _data = (ml_tensors_data_s *) (*data);
+  _data->nolock = 1;
+  _data->owner = g_thread_self ();
+
+  _info = (ml_tensors_info_s *) _data->info;
+  _info->nolock = 1;
+  _info->owner = _data->owner;
+
+  return ML_ERROR_NONE;
+}
+
+/**
+ * @brief Creates a handle sharing the tensor buffers of the given tensors data. (more info in nnstreamer.h)
+ */
+int
+ml_tensors_data_ref (ml_tensors_data_h data, ml_tensors_data_h * ref_data)
+{
+  ml_tensors_data_s *_data, *_ref = NULL;
+  ml_tensors_data_shared_s *shared;
+  int status = ML_ERROR_NONE;
+  guint i;
+
+  check_feature_state ();
+
+  if (data == NULL)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, data, is NULL. It should be a valid ml_tensors_data_h handle, which is usually created by ml_tensors_data_create ().");
+  if (ref_data == NULL)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, ref_data, is NULL. It should be a valid pointer of ml_tensors_data_h, which is supposed to be the new handle sharing the tensors after the call.");
+
+  _data = (ml_tensors_data_s *) data;
+  G_LOCK_UNLESS_NOLOCK (*_data);
+
+  if (!_data->owned || _data->destroy) {
+    _ml_error_report
+        ("The parameter, data, does not own its tensor buffers. Only the handle created with ml_tensors_data_create () or ml_tensors_data_create_full () can be shared.");
+    status = ML_ERROR_INVALID_PARAMETER;
+    goto done;
+  }
+
+  if (_data->num_tensors > ML_TENSOR_SIZE_LIMIT) {
+    _ml_error_report
+        ("The parameter, data, has %u tensors. The tensors data with more than %d tensors cannot be shared.",
+        _data->num_tensors, ML_TENSOR_SIZE_LIMIT);
+    status = ML_ERROR_NOT_SUPPORTED;
+    goto done;
+  }
+
+  status = _ml_tensors_data_create_no_alloc (_data->info,
+      (ml_tensors_data_h *) & _ref);
+  if (status != ML_ERROR_NONE) {
+    _ml_error_report_continue
+        ("Failed to create the handle sharing the tensors with _ml_tensors_data_create_no_alloc (): %d.",
+        status);
+    goto done;
+  }
+
+  /* move the buffers to the shared struct at the first reference */
+  if (_data->shared == NULL) {
+    shared = g_try_new0 (ml_tensors_data_shared_s, 1);
+    if (shared == NULL) {
+      _ml_error_report
+          ("Failed to allocate the shared buffers of tensors data. Out of memory?");
+      status = ML_ERROR_OUT_OF_MEMORY;
+      goto done;
+    }
+
+    shared->ref_count = 1;
+    shared->num_tensors = _data->num_tensors;
+    for (i = 0; i < _data->num_tensors; i++)
+      shared->tensors[i] = _data->tensors[i].tensor;
+    shared->alloc_flags = _data->alloc_flags;
+    shared->allocator = _data->allocator;
+
+    _data->shared = shared;
+    _data->shared_mask = (1U << _data->num_tensors) - 1;
+  }
+
+  /* the handles keep the flags and allocator, the private copy is allocated with them */
+  g_atomic_int_inc (&_data->shared->ref_count);
+  _ref->owned = TRUE;
+  _ref->shared = _data->shared;
+  _ref->shared_mask = (1U << _data->num_tensors) - 1;
+  _ref->num_tensors = _data->num_tensors;
+  _ref->alloc_flags = _data->alloc_flags;
+  _ref->allocator = _data->allocator;
+
+  for (i = 0; i < _data->num_tensors; i++) {
+    _ref->tensors[i].size = _data->tensors[i].size;
+    _ref->tensors[i].tensor = _data->tensors[i].tensor;
+  }
+
+  /* the private copy of the given handle cannot be shared, copy it */
+  for (i = 0; i < _data->num_tensors; i++) {
+    if (_data->shared_mask & (1U << i))
+      continue;
+
+    status = _ml_tensors_data_make_writable (_ref, i, TRUE);
+    if (status != ML_ERROR_NONE) {
+      _ml_error_report_continue
+          ("Failed to copy tensors[index: %u] (%zu bytes) of the given handle: %d.",
+          i, _data->tensors[i].size, status);
+      goto done;
+    }
+  }
+
+done:
+  G_UNLOCK_UNLESS_NOLOCK (*_data);
+
+  if (status != ML_ERROR_NONE) {
+    if (_ref)
+      _ml_tensors_data_destroy_internal (_ref, TRUE);
+    return status;
+  }
+
+  *ref_data = _ref;
+  return ML_ERROR_NONE;
+}
+
+/**
+ * @brief Makes the tensor writable, the tensor in the shared buffers is cloned. (more info in ml-api-internal.h)
+ */
+int
+_ml_tensors_data_make_writable (ml_tensors_data_s * data, unsigned int index,
+    gboolean keep)
+{
+  size_t offsets[ML_TENSOR_SIZE_LIMIT];
+  size_t total;
+  guint8 *block;
+  void *mem;
+  guint i;
+
+  if (data->shared == NULL || !(data->shared_mask & (1U << index)))
+    return ML_ERROR_NONE;
+
+  if (data->alloc_flags & ML_TENSORS_DATA_FLAG_CONTIGUOUS) {
+    /* copy-on-write of the whole block, the tensors stay in a single block */
+    total = _ml_tensors_data_get_block_offsets (data, offsets);
+    block = _ml_tensor_buffer_alloc (data, total);
+    if (block == NULL)
+      _ml_error_report_return (ML_ERROR_OUT_OF_MEMORY,
+          "Failed to allocate the private copy of the block (%zu bytes) from the shared data. Out of memory?",
+          total);
+
+    for (i = 0; i < data->num_tensors; i++) {
+      if (i != index || keep)
+        memcpy (block + offsets[i], data->tensors[i].tensor,
+            data->tensors[i].size);
+      data->tensors[i].tensor = block + offsets[i];
+    }
+
+    data->shared_mask = 0;
+    return ML_ERROR_NONE;
+  }
+
+  /* copy-on-write */
+  mem = _ml_tensor_buffer_alloc (data, data->tensors[index].size);
+  if (mem == NULL)
+    _ml_error_report_return (ML_ERROR_OUT_OF_MEMORY,
+        "Failed to allocate the private copy of tensors[index: %u] (%zu bytes) from the shared data. Out of memory?",
+        index, data->tensors[index].size);
+
+  if (keep)
+    memcpy (mem, data->tensors[index].tensor, data->tensors[index].size);
+
+  data->tensors[index].tensor = mem;
+  data->shared_mask &= ~(1U << index);
+  return ML_ERROR_NONE;
+}
+
+/**
+ * @brief Releases the handle sharing the tensor buffers. (more info in nnstreamer.h)
+ */
+int
+ml_tensors_data_unref (ml_tensors_data_h data)
+{
+  return ml_tensors_data_destroy (data);
+}
+
 /**
  * @brief Gets a tensor data of given handle.
  */
@@ -818,6 +1973,7 @@ ml_tensors_data_get_tensor_data (ml_tensors_data_h data, unsigned int index,
     void **raw_data, size_t *data_size)
 {
   ml_tensors_data_s *_data;
+  ml_tensor_data_s *nth;
   int status = ML_ERROR_NONE;
 
   check_feature_state ();
@@ -843,8 +1999,50 @@ ml_tensors_data_get_tensor_data (ml_tensors_data_h data, unsigned int index,
     goto report;
   }
 
-  *raw_data = _data->tensors[index].tensor;
-  *data_size = _data->tensors[index].size;
+  nth = _ml_tensors_data_get_nth_data (_data, index);
+  *raw_data = nth->tensor;
+  *data_size = nth->size;
+
+report:
+  G_UNLOCK_UNLESS_NOLOCK (*_data);
+  return status;
+}
+
+/**
+ * @brief Gets the single block of all tensors in the given handle.
+ */
+int
+ml_tensors_data_get_block_data (ml_tensors_data_h data, void **raw_data,
+    size_t *data_size)
+{
+  ml_tensors_data_s *_data;
+  int status = ML_ERROR_NONE;
+
+  check_feature_state ();
+
+  if (data == NULL)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, data, is NULL. It should be a valid ml_tensors_data_h handle, which is usually created by ml_tensors_data_create_full ().");
+  if (raw_data == NULL)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, raw_data, is NULL. It should be a valid, non-NULL, void ** pointer, which is supposed to point to the block of tensors after the call.");
+  if (data_size == NULL)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, data_size, is NULL. It should be a valid, non-NULL, size_t * pointer, which is supposed to point to the size of the block after the call.");
+
+  _data = (ml_tensors_data_s *) data;
+  G_LOCK_UNLESS_NOLOCK (*_data);
+
+  if (!(_data->alloc_flags & ML_TENSORS_DATA_FLAG_CONTIGUOUS) ||
+      _data->tensors[0].tensor == NULL) {
+    _ml_error_report
+        ("The parameter, data, is not allocated in a single block. Create it with ml_tensors_data_create_full () and the flag ML_TENSORS_DATA_FLAG_CONTIGUOUS.");
+    status = ML_ERROR_INVALID_PARAMETER;
+    goto report;
+  }
+
+  *raw_data = _data->tensors[0].tensor;
+  *data_size = _ml_tensors_data_get_block_offsets (_data, NULL);
 
 report:
   G_UNLOCK_UNLESS_NOLOCK (*_data);
@@ -859,6 +2057,7 @@ ml_tensors_data_set_tensor_data (ml_tensors_data_h data, unsigned int index,
     const void *raw_data, const size_t data_size)
 {
   ml_tensors_data_s *_data;
+  ml_tensor_data_s *nth;
   int status = ML_ERROR_NONE;
 
   check_feature_state ();
@@ -882,16 +2081,25 @@ ml_tensors_data_set_tensor_data (ml_tensors_data_h data, unsigned int index,
     goto report;
   }
 
-  if (data_size <= 0 || _data->tensors[index].size < data_size) {
+  nth = _ml_tensors_data_get_nth_data (_data, index);
+  if (data_size <= 0 || nth->size < data_size) {
     _ml_error_report
         ("The parameter, data_size (%zu), is invalid. It should be larger than 0 and not larger than the required size of tensors[index: %u] (%zu).",
-        data_size, index, _data->tensors[index].size);
+        data_size, index, nth->size);
     status = ML_ERROR_INVALID_PARAMETER;
     goto report;
   }
 
-  if (_data->tensors[index].tensor != raw_data)
-    memcpy (_data->tensors[index].tensor, raw_data, data_size);
+  if (nth->tensor == raw_data)
+    goto report;
+
+  /* keep the remaining bytes of the shared tensor */
+  status = _ml_tensors_data_make_writable (_data, index,
+      data_size < nth->size);
+  if (status != ML_ERROR_NONE)
+    goto report;
+
+  memcpy (nth->tensor, raw_data, data_size);
 
 report:
   G_UNLOCK_UNLESS_NOLOCK (*_data);
@@ -905,6 +2113,7 @@ int
 ml_tensors_info_clone (ml_tensors_info_h dest, const ml_tensors_info_h src)
 {
   ml_tensors_info_s *dest_info, *src_info;
+  ml_tensor_info_s *dest_nth, *src_nth;
   guint i, j;
   bool valid;
   int status = ML_ERROR_NONE;
@@ -937,17 +2146,38 @@ ml_tensors_info_clone (ml_tensors_info_h dest, const ml_tensors_info_h src)
     goto done;
   }
 
-  _ml_tensors_info_initialize (dest_info);
+  _ml_tensors_info_free (dest_info);
+
+  status = _ml_tensors_info_resize_extra (dest_info, src_info->num_tensors);
+  if (status != ML_ERROR_NONE)
+    goto done;
 
   dest_info->num_tensors = src_info->num_tensors;
+  dest_info->is_extended = src_info->is_extended;
 
   for (i = 0; i < dest_info->num_tensors; i++) {
-    dest_info->info[i].name =
-        (src_info->info[i].name) ? g_strdup (src_info->info[i].name) : NULL;
-    dest_info->info[i].type = src_info->info[i].type;
+    dest_nth = _ml_tensors_info_get_nth_info (dest_info, i);
+    src_nth = _ml_tensors_info_get_nth_info (src_info, i);
+
+    dest_nth->name = (src_nth->name) ? g_strdup (src_nth->name) : NULL;
+    dest_nth->type = src_nth->type;
+
+    for (j = 0; j < ML_TENSOR_RANK_LIMIT_EXTENDED; j++) {
+      status = _ml_tensor_info_set_dimension (dest_nth, j,
+          _ml_tensor_info_get_dimension (src_nth, j));
+      if (status != ML_ERROR_NONE) {
+        _ml_error_report
+            ("Failed to allocate the dimensions of the tensor (index %u). Out of memory?",
+            i);
+        goto done;
+      }
+    }
+  }
 
-    for (j = 0; j < ML_TENSOR_RANK_LIMIT; j++)
-      dest_info->info[i].dimension[j] = src_info->info[i].dimension[j];
+  /* src is interned while validating it, share the instance */
+  if (src_info->interned) {
+    g_atomic_int_inc (&src_info->interned->ref_count);
+    dest_info->interned = src_info->interned;
   }
 
 done:
@@ -1037,14 +2267,153 @@ _ml_replace_string (gchar * source, const gchar * what, const gchar * to,
   return result;
 }
 
+/**
+ * @brief The list of the call sites of the rate-limited log.
+ */
+static ml_log_site_s *ml_log_sites = NULL;
+
+/**
+ * @brief Counts the event of the call site and checks the log should be printed. (more info in ml-api-internal.h)
+ */
+gboolean
+_ml_log_site_hit (ml_log_site_s * site, guint * suppressed)
+{
+  ml_log_site_s *head;
+  gint window, last;
+
+  *suppressed = 0;
+
+  /* register the site with the first event, the list is never shrunk */
+  if (g_atomic_int_compare_and_exchange (&site->registered, 0, 1)) {
+    do {
+      head = (ml_log_site_s *) g_atomic_pointer_get (&ml_log_sites);
+      site->next = head;
+    } while (!g_atomic_pointer_compare_and_exchange (&ml_log_sites, head,
+            site));
+  }
+
+  g_atomic_int_inc (&site->count);
+
+  /* only the thread swapping the interval starts it, 0 means no event yet */
+  window = (gint) (g_get_monotonic_time () / ML_LOG_RATELIMIT_INTERVAL) + 1;
+  last = g_atomic_int_get (&site->window);
+  if (last != window &&
+      g_atomic_int_compare_and_exchange (&site->window, last, window)) {
+    /* new interval, report the logs suppressed in the previous one */
+    g_atomic_int_set (&site->window_count, 1);
+    *suppressed = g_atomic_int_and (&site->suppressed, 0);
+    return TRUE;
+  }
+
+  if (g_atomic_int_add (&site->window_count, 1) < ML_LOG_RATELIMIT_BURST)
+    return TRUE;
+
+  g_atomic_int_inc ((gint *) & site->suppressed);
+  return FALSE;
+}
+
+/**
+ * @brief Iterates the call sites of the errors with the number of errors. (more info in ml-api-common.h)
+ */
+int
+ml_error_foreach_count (ml_error_count_cb cb, void *user_data)
+{
+  ml_log_site_s *site;
+
+  if (!cb)
+    _ml_error_report_return (ML_ERROR_INVALID_PARAMETER,
+        "The parameter, cb, is NULL. It should be a valid function pointer of ml_error_count_cb.");
+
+  site = (ml_log_site_s *) g_atomic_pointer_get (&ml_log_sites);
+  while (site) {
+    cb (site->file, site->func, site->line,
+        (unsigned int) g_atomic_int_get (&site->count), user_data);
+    site = site->next;
+  }
+
+  return ML_ERROR_NONE;
+}
+
 /**
  * @brief error reporting infra
  */
 #define _ML_ERRORMSG_LENGTH (4096U)
-static char errormsg[_ML_ERRORMSG_LENGTH] = { 0 };      /* one page limit */
 
-static int reported = 0;
-G_LOCK_DEFINE_STATIC (errlock);
+/**
+ * @brief The error context of a thread.
+ * @details Each thread keeps its own message, so the error path runs without a global lock and the threads do not overwrite the messages of others.
+ */
+typedef struct {
+  int reported; /**< 1 if the message is already returned by ml_error() */
+  size_t length; /**< The length of the message */
+  char msg[_ML_ERRORMSG_LENGTH]; /**< The error message, one page limit */
+} ml_error_context_s;
+
+/**
+ * @brief The error context of current thread.
+ */
+static GPrivate ml_error_context = G_PRIVATE_INIT (g_free);
+
+/**
+ * @brief Internal function to get the error context of current thread.
+ * @param[in] create TRUE to allocate the context if the thread has no error reported yet.
+ */
+static ml_error_context_s *
+_ml_error_context_get (gboolean create)
+{
+  ml_error_context_s *ctx = g_private_get (&ml_error_context);
+
+  if (ctx == NULL && create) {
+    ctx = g_try_new0 (ml_error_context_s, 1);
+    if (ctx)
+      g_private_set (&ml_error_context, ctx);
+  }
+
+  return ctx;
+}
+
+/**
+ * @brief Internal function to write the message at the end of the error context.
+ */
+static void
+_ml_error_context_vappend (ml_error_context_s * ctx, const char *fmt,
+    va_list arg_ptr)
+{
+  size_t remain;
+  int n;
+
+  remain = _ML_ERRORMSG_LENGTH - ctx->length;
+  n = vsnprintf (ctx->msg + ctx->length, remain, fmt, arg_ptr);
+
+  if (n < 0) {
+    ctx->msg[ctx->length] = '\0';
+  } else if ((size_t) n >= remain) {
+    ctx->length = _ML_ERRORMSG_LENGTH - 1;
+    ctx->msg[_ML_ERRORMSG_LENGTH - 2] = '.';
+    ctx->msg[_ML_ERRORMSG_LENGTH - 3] = '.';
+    ctx->msg[_ML_ERRORMSG_LENGTH - 4] = '.';
+  } else {
+    ctx->length += n;
+  }
+}
+
+/**
+ * @brief Internal function to log the reported error, limited for each call site.
+ */
+static void
+_ml_error_log (ml_log_site_s * site, const char *msg)
+{
+  guint suppressed;
+
+  if (!_ml_log_site_hit (site, &suppressed))
+    return;
+
+  if (suppressed > 0)
+    _ml_loge ("%s [count=%d suppressed=%u]", msg,
+        g_atomic_int_get (&site->count), suppressed);
+  else
+    _ml_loge ("%s", msg);
+}
 
 /**
  * @brief public API function of error reporting.
@@ -1052,88 +2421,80 @@ G_LOCK_DEFINE_STATIC (errlock);
 const char *
 ml_error (void)
 {
-  G_LOCK (errlock);
-  if (reported != 0) {
-    errormsg[0] = '\0';
-    reported = 0;
-  }
-  if (errormsg[0] == '\0') {
-    G_UNLOCK (errlock);
+  ml_error_context_s *ctx = _ml_error_context_get (FALSE);
+
+  if (ctx == NULL)
     return NULL;
-  }
 
-  reported = 1;
+  if (ctx->reported != 0) {
+    ctx->msg[0] = '\0';
+    ctx->length = 0;
+    ctx->reported = 0;
+  }
+  if (ctx->length == 0)
+    return NULL;
 
-  G_UNLOCK (errlock);
-  return errormsg;
+  ctx->reported = 1;
+  return ctx->msg;
 }
 
 /**
  * @brief Internal interface to write messages for ml_error()
  */
 void
-_ml_error_report_ (const char *fmt, ...)
+_ml_error_report_ (ml_log_site_s * site, const char *fmt, ...)
 {
-  int n;
+  ml_error_context_s *ctx = _ml_error_context_get (TRUE);
   va_list arg_ptr;
-  G_LOCK (errlock);
-
-  va_start (arg_ptr, fmt);
-  n = vsnprintf (errormsg, _ML_ERRORMSG_LENGTH, fmt, arg_ptr);
-  va_end (arg_ptr);
 
-  if (n > _ML_ERRORMSG_LENGTH) {
-    errormsg[_ML_ERRORMSG_LENGTH - 2] = '.';
-    errormsg[_ML_ERRORMSG_LENGTH - 3] = '.';
-    errormsg[_ML_ERRORMSG_LENGTH - 4] = '.';
+  if (ctx == NULL) {
+    /* cannot keep the message, at least leave the log */
+    _ml_error_log (site, fmt);
+    return;
   }
 
-  _ml_loge ("%s", errormsg);
-
-  reported = 0;
+  ctx->length = 0;
+  va_start (arg_ptr, fmt);
+  _ml_error_context_vappend (ctx, fmt, arg_ptr);
+  va_end (arg_ptr);
 
-  G_UNLOCK (errlock);
+  _ml_error_log (site, ctx->msg);
+  ctx->reported = 0;
 }
 
 /**
  * @brief Internal interface to write messages for ml_error(), relaying previously reported errors.
  */
 void
-_ml_error_report_continue_ (const char *fmt, ...)
+_ml_error_report_continue_ (ml_log_site_s * site, const char *fmt, ...)
 {
-  size_t cursor = 0;
+  ml_error_context_s *ctx = _ml_error_context_get (TRUE);
+  size_t cursor;
   va_list arg_ptr;
-  char buf[_ML_ERRORMSG_LENGTH];
-  G_LOCK (errlock);
+
+  if (ctx == NULL) {
+    _ml_error_log (site, fmt);
+    return;
+  }
 
   /* Check if there is a message to relay */
-  if (reported == 0) {
-    cursor = strlen (errormsg);
-    if (cursor < (_ML_ERRORMSG_LENGTH - 1)) {
-      errormsg[cursor] = '\n';
-      errormsg[cursor + 1] = '\0';
-      cursor++;
+  if (ctx->reported == 0) {
+    if (ctx->length < (_ML_ERRORMSG_LENGTH - 1)) {
+      ctx->msg[ctx->length++] = '\n';
+      ctx->msg[ctx->length] = '\0';
     }
   } else {
-    errormsg[0] = '\0';
+    ctx->length = 0;
   }
 
+  /* format once into the context and log the appended part only */
+  cursor = ctx->length;
   va_start (arg_ptr, fmt);
-  vsnprintf (buf, _ML_ERRORMSG_LENGTH - 1, fmt, arg_ptr);
-  _ml_loge ("%s", buf);
-
-  memcpy (errormsg + cursor, buf, _ML_ERRORMSG_LENGTH - strlen (errormsg) - 1);
-  if (strlen (errormsg) >= (_ML_ERRORMSG_LENGTH - 2)) {
-    errormsg[_ML_ERRORMSG_LENGTH - 2] = '.';
-    errormsg[_ML_ERRORMSG_LENGTH - 3] = '.';
-    errormsg[_ML_ERRORMSG_LENGTH - 4] = '.';
-  }
-
+  _ml_error_context_vappend (ctx, fmt, arg_ptr);
   va_end (arg_ptr);
 
-  errormsg[_ML_ERRORMSG_LENGTH - 1] = '\0';
-  reported = 0;
-  G_UNLOCK (errlock);
+  _ml_error_log (site, ctx->msg + cursor);
+  ctx->reported = 0;
 }
 
 static const char *strerrors[] = {
@@ -76,6 +76,40 @@ _ml_tensors_info_create_from_gst (ml_tensors_info_h * ml_info,
   return ML_ERROR_NONE;
 }
 
+/**
+ * @brief Converts the tensor type of gst tensors info.
+ */
+ml_tensor_type_e
+_ml_tensor_type_from_gst (tensor_type type)
+{
+  switch (type) {
+    case _NNS_INT32:
+      return ML_TENSOR_TYPE_INT32;
+    case _NNS_UINT32:
+      return ML_TENSOR_TYPE_UINT32;
+    case _NNS_INT16:
+      return ML_TENSOR_TYPE_INT16;
+    case _NNS_UINT16:
+      return ML_TENSOR_TYPE_UINT16;
+    case _NNS_INT8:
+      return ML_TENSOR_TYPE_INT8;
+    case _NNS_UINT8:
+      return ML_TENSOR_TYPE_UINT8;
+    case _NNS_FLOAT64:
+      return ML_TENSOR_TYPE_FLOAT64;
+    case _NNS_FLOAT32:
+      return ML_TENSOR_TYPE_FLOAT32;
+    case _NNS_INT64:
+      return ML_TENSOR_TYPE_INT64;
+    case _NNS_UINT64:
+      return ML_TENSOR_TYPE_UINT64;
+    default:
+      break;
+  }
+
+  return ML_TENSOR_TYPE_UNKNOWN;
+}
+
 /**
  * @brief Copies tensor meta info from gst tensors info.
  * @bug Thread safety required. Check its internal users first!
@@ -84,100 +118,114 @@ void
 _ml_tensors_info_copy_from_gst (ml_tensors_info_s * ml_info,
     const GstTensorsInfo * gst_info)
 {
-  guint i, j;
+  ml_tensor_info_s *info;
+  guint i, j, num;
   guint max_dim;
 
   if (!ml_info || !gst_info)
     return;
 
   _ml_tensors_info_initialize (ml_info);
-  max_dim = MIN (ML_TENSOR_RANK_LIMIT, NNS_TENSOR_RANK_LIMIT);
+  max_dim = MIN (ML_TENSOR_RANK_LIMIT_EXTENDED, NNS_TENSOR_RANK_LIMIT);
 
-  ml_info->num_tensors = gst_info->num_tensors;
+  num = MIN (gst_info->num_tensors, ML_TENSOR_SIZE_LIMIT_EXTENDED);
+
+  /* the tensors beyond ML_TENSOR_SIZE_LIMIT are in the extended list */
+  if (num > ML_TENSOR_SIZE_LIMIT) {
+    if (_ml_tensors_info_resize_extra (ml_info, num) != ML_ERROR_NONE) {
+      /* keep ml info invalid (no tensor), the caller fails to validate it */
+      _ml_loge ("Failed to allocate the tensors info of %u tensors.", num);
+      return;
+    }
+
+    ml_info->is_extended = TRUE;
+  }
+
+  ml_info->num_tensors = num;
+
+  for (i = 0; i < num; i++) {
+    info = _ml_tensors_info_get_nth_info (ml_info, i);
 
-  for (i = 0; i < gst_info->num_tensors; i++) {
     /* Copy name string */
     if (gst_info->info[i].name) {
-      ml_info->info[i].name = g_strdup (gst_info->info[i].name);
+      info->name = g_strdup (gst_info->info[i].name);
     }
 
     /* Set tensor type */
-    switch (gst_info->info[i].type) {
-      case _NNS_INT32:
-        ml_info->info[i].type = ML_TENSOR_TYPE_INT32;
-        break;
-      case _NNS_UINT32:
-        ml_info->info[i].type = ML_TENSOR_TYPE_UINT32;
-        break;
-      case _NNS_INT16:
-        ml_info->info[i].type = ML_TENSOR_TYPE_INT16;
-        break;
-      case _NNS_UINT16:
-        ml_info->info[i].type = ML_TENSOR_TYPE_UINT16;
-        break;
-      case _NNS_INT8:
-        ml_info->info[i].type = ML_TENSOR_TYPE_INT8;
-        break;
-      case _NNS_UINT8:
-        ml_info->info[i].type = ML_TENSOR_TYPE_UINT8;
-        break;
-      case _NNS_FLOAT64:
-        ml_info->info[i].type = ML_TENSOR_TYPE_FLOAT64;
-        break;
-      case _NNS_FLOAT32:
-        ml_info->info[i].type = ML_TENSOR_TYPE_FLOAT32;
-        break;
-      case _NNS_INT64:
-        ml_info->info[i].type = ML_TENSOR_TYPE_INT64;
-        break;
-      case _NNS_UINT64:
-        ml_info->info[i].type = ML_TENSOR_TYPE_UINT64;
-        break;
-      default:
-        ml_info->info[i].type = ML_TENSOR_TYPE_UNKNOWN;
-        break;
-    }
+    info->type = _ml_tensor_type_from_gst (gst_info->info[i].type);
 
-    /* Set dimension */
+    /* Set dimension, the higher rank than ml_tensor_dimension is allocated */
     for (j = 0; j < max_dim; j++) {
-      ml_info->info[i].dimension[j] = gst_info->info[i].dimension[j];
-    }
+      if (_ml_tensor_info_set_dimension (info, j,
+              gst_info->info[i].dimension[j]) != ML_ERROR_NONE) {
+        _ml_loge ("Failed to allocate the dimensions of the %u'th tensor.", i);
+        break;
+      }
 
-    for (; j < ML_TENSOR_RANK_LIMIT; j++) {
-      ml_info->info[i].dimension[j] = 1;
+      /* the tensor has higher rank than ml_tensor_dimension, stored in dimension_ext */
+      if (j >= ML_TENSOR_RANK_LIMIT && gst_info->info[i].dimension[j] > 1)
+        ml_info->is_extended = TRUE;
     }
   }
 }
 
 /**
- * @brief Copies tensor meta info from gst tensors info.
+ * @brief Copies tensor meta info from ml tensors info.
  * @bug Thread safety required. Check its internal users first!
  */
-void
+int
 _ml_tensors_info_copy_from_ml (GstTensorsInfo * gst_info,
     const ml_tensors_info_s * ml_info)
 {
+  const ml_tensor_info_s *info;
   guint i, j;
   guint max_dim;
+  int status = ML_ERROR_NONE;
 
   if (!gst_info || !ml_info)
-    return;
+    return ML_ERROR_INVALID_PARAMETER;
 
   G_LOCK_UNLESS_NOLOCK (*ml_info);
 
   gst_tensors_info_init (gst_info);
-  max_dim = MIN (ML_TENSOR_RANK_LIMIT, NNS_TENSOR_RANK_LIMIT);
+  max_dim = MIN (ML_TENSOR_RANK_LIMIT_EXTENDED, NNS_TENSOR_RANK_LIMIT);
+
+  if (ml_info->num_tensors > NNS_TENSOR_SIZE_LIMIT) {
+    /* keep gst info invalid (no tensor), the caller fails to validate it */
+    _ml_error_report
+        ("The number of tensors (%u) exceeds the limit of NNStreamer (%d).",
+        ml_info->num_tensors, NNS_TENSOR_SIZE_LIMIT);
+    status = ML_ERROR_NOT_SUPPORTED;
+    goto done;
+  }
+
+  /* NNStreamer cannot represent the higher rank, do not fold it into the last dimension */
+  for (i = 0; i < ml_info->num_tensors; i++) {
+    info = _ml_tensors_info_get_nth_info ((ml_tensors_info_s *) ml_info, i);
+
+    for (j = max_dim; j < ML_TENSOR_RANK_LIMIT_EXTENDED; j++) {
+      if (_ml_tensor_info_get_dimension (info, j) > 1) {
+        _ml_error_report
+            ("The rank of the %u'th tensor exceeds the limit of NNStreamer (%d).",
+            i, NNS_TENSOR_RANK_LIMIT);
+        status = ML_ERROR_NOT_SUPPORTED;
+        goto done;
+      }
+    }
+  }
 
   gst_info->num_tensors = ml_info->num_tensors;
 
   for (i = 0; i < ml_info->num_tensors; i++) {
+    info = _ml_tensors_info_get_nth_info ((ml_tensors_info_s *) ml_info, i);
+
     /* Copy name string */
-    if (ml_info->info[i].name) {
-      gst_info->info[i].name = g_strdup (ml_info->info[i].name);
+    if (info->name) {
+      gst_info->info[i].name = g_strdup (info->name);
     }
 
     /* Set tensor type */
-    switch (ml_info->info[i].type) {
+    switch (info->type) {
       case ML_TENSOR_TYPE_INT32:
         gst_info->info[i].type = _NNS_INT32;
         break;
@@ -215,14 +263,17 @@ _ml_tensors_info_copy_from_ml (GstTensorsInfo * gst_info,
 
     /* Set dimension */
     for (j = 0; j < max_dim; j++) {
-      gst_info->info[i].dimension[j] = ml_info->info[i].dimension[j];
+      gst_info->info[i].dimension[j] = _ml_tensor_info_get_dimension (info, j);
     }
 
-    for (; j < NNS_TENSOR_RANK_LIMIT; j++) {
+    for (j = max_dim; j < NNS_TENSOR_RANK_LIMIT; j++) {
       gst_info->info[i].dimension[j] = 1;
     }
   }
+
+done:
   G_UNLOCK_UNLESS_NOLOCK (*ml_info);
+  return status;
 }
 
 /**
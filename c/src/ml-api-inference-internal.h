@@ -74,6 +74,7 @@ typedef struct {
   ml_tensors_info_h out_info;
   ml_custom_easy_invoke_cb cb;
   void *pdata;
+  int flags; /**< The flags of custom filter (ml_custom_easy_flag_e) */
 } ml_custom_filter_s;
 
 /**
@@ -86,6 +87,13 @@ typedef struct {
   GMutex lock;
   ml_pipeline_if_custom_cb cb;
   void *pdata;
+  GstTensorsInfo gst_info; /**< The tensors info of the last input, to check the input is changed */
+  ml_tensors_info_h info; /**< The cached tensors info handle passed to the callback, reused while the input is not changed */
+  ml_pipeline_if_condition_e condition; /**< The built-in condition, valid if the callback is NULL */
+  unsigned int index; /**< The index of the tensor to be compared with the built-in condition */
+  double threshold; /**< The threshold of the max score */
+  unsigned int *classes; /**< The set of class indices for #ML_PIPELINE_IF_CONDITION_CLASS_IN_SET */
+  unsigned int num_classes; /**< The number of class indices */
 } ml_if_custom_s;
 
 /**
@@ -107,6 +115,83 @@ typedef enum {
  */
 typedef struct _ml_pipeline ml_pipeline;
 
+/**
+ * @brief Internal data structure to recycle the frames pushed into src element.
+ */
+typedef struct {
+  gint ref_count; /**< Reference count of the pool (atomic) */
+  GMutex lock; /**< Lock for the queue of frames */
+  GQueue frames; /**< The queue of released frames to be reused */
+} ml_pipeline_src_pool_s;
+
+/**
+ * @brief The max number of input frames waiting for the output in the statistics of an element.
+ */
+#define ML_PIPELINE_STATS_PENDING_LIMIT (16U)
+
+/**
+ * @brief Internal data structure for the input frame waiting for the output.
+ */
+typedef struct {
+  GstClockTime pts; /**< The presentation timestamp of the input frame */
+  gint64 in_time; /**< Monotonic time of the input frame (us) */
+} ml_pipeline_stats_pending_s;
+
+/**
+ * @brief Internal data structure for the statistics of an element.
+ */
+typedef struct {
+  gint ref_count; /**< Reference count of the statistics, each pad probe holds a reference (atomic) */
+  GMutex lock; /**< Lock for the counters */
+  gboolean has_src; /**< The element has src pads (not a sink) */
+  guint num_sinks; /**< The number of sink pads */
+  guint64 frames_in; /**< The number of frames arrived at the sink pads */
+  guint64 frames_out; /**< The number of frames pushed from the src pads */
+  guint64 bytes_out; /**< The size of frames pushed from the src pads */
+  guint64 dropped; /**< The number of input frames without output */
+  gint64 first_time; /**< Monotonic time of the first frame (us) */
+  gint64 last_time; /**< Monotonic time of the last frame (us) */
+  ml_pipeline_stats_pending_s pending[ML_PIPELINE_STATS_PENDING_LIMIT]; /**< The input frames waiting for the output (ring buffer) */
+  guint pending_head; /**< The index of the oldest pending frame */
+  guint pending_count; /**< The number of pending frames */
+  guint pending_max; /**< The max number of pending frames */
+  guint64 latency_sum; /**< The sum of processing latency (us) */
+  guint64 latency_max; /**< The max processing latency (us) */
+  guint64 latency_count; /**< The number of latency samples */
+  guint64 histogram[ML_PIPELINE_LATENCY_HISTOGRAM_SIZE]; /**< The latency histogram */
+} ml_pipeline_stats_s;
+
+/**
+ * @brief The number of recent frames to calculate the percentiles of end-to-end latency.
+ */
+#define ML_PIPELINE_LATENCY_WINDOW (1024U)
+
+/**
+ * @brief Internal data structure for the end-to-end latency of sink element.
+ */
+typedef struct {
+  GMutex lock; /**< Lock for the latency samples */
+  guint64 count; /**< The number of frames with ingress timestamp */
+  guint64 last; /**< The latency of the last frame (us) */
+  guint64 max; /**< The max latency (us) */
+  guint64 window[ML_PIPELINE_LATENCY_WINDOW]; /**< The latency of recent frames (us) */
+} ml_pipeline_latency_s;
+
+/**
+ * @brief Internal data structure for the QoS of tensor_filter element.
+ */
+typedef struct {
+  gint ref_count; /**< Reference count of the QoS, each pad probe holds a reference (atomic) */
+  GMutex lock; /**< Lock for the counters */
+  guint64 max_latency; /**< The max latency of the frame (us) */
+  guint64 frames_in; /**< The number of frames arrived at the sink pad */
+  guint64 dropped; /**< The number of frames dropped by QoS */
+  gdouble drop_rate; /**< The recent drop rate (exponentially weighted) */
+  guint64 process_time; /**< The processing time of the element (us, exponentially weighted) */
+  gint64 in_time; /**< Monotonic time of the pending input frame (us), 0 if no pending frame */
+  GstCaps *caps; /**< The caps of reference timestamp meta, cached when the pad probes are added */
+} ml_pipeline_qos_ctrl_s;
+
 /**
  * @brief An element that may be controlled individually in a pipeline.
  */
@@ -130,6 +215,35 @@ typedef struct _ml_pipeline_element {
 
   ml_handle_destroy_cb custom_destroy;
   gpointer custom_data;
+  gboolean share_model; /**< The key of shared model is generated from the properties of tensor_filter */
+
+  /* cached caps and flex-tensor header of src element */
+  gulong src_probe_id; /**< Pad probe to watch the caps event of src pad */
+  gint caps_changed; /**< Set when the caps of src pad is changed (atomic) */
+  ml_tensors_info_s flex_info; /**< Tensors info of the cached flex-tensor header */
+  gpointer flex_header[ML_TENSOR_SIZE_LIMIT]; /**< Pre-serialised header of each flex tensor */
+  gsize flex_header_size[ML_TENSOR_SIZE_LIMIT]; /**< The size of each flex-tensor header */
+  ml_pipeline_src_pool_s *src_pool; /**< The pool of frames pushed into src element */
+
+  /* flow control of src element */
+  gboolean src_blocking; /**< Push waits until the queue of src element needs data */
+  gboolean src_enough_data; /**< Set when the queue of src element is full */
+  guint src_timeout; /**< Max time to wait for the queue in milliseconds */
+  GCond src_cond; /**< Condition to wake up the waiting push */
+  guint src_users; /**< The number of pushes in progress, which do not hold the pipeline lock */
+  gboolean src_closing; /**< Set when the element is being released, the waiting push returns */
+
+  /* statistics mode */
+  ml_pipeline_stats_s *stats; /**< The statistics of the element, NULL if statistics mode is disabled */
+  GSList *stats_probes; /**< Pad probes to collect the statistics */
+
+  ml_pipeline_latency_s *latency; /**< End-to-end latency of sink element */
+  GThread *sink_cb_thread; /**< The thread calling the sink callbacks with element lock, NULL if no callback is running (atomic) */
+  GstBuffer *sink_buffer; /**< The buffer passed to the sink callbacks, valid while the callbacks are running with element lock */
+
+  /* QoS of tensor_filter element */
+  ml_pipeline_qos_ctrl_s *qos; /**< The QoS controller, NULL if QoS is disabled */
+  GSList *qos_probes; /**< Pad probes to drop the late frames */
 } ml_pipeline_element;
 
 /**
@@ -162,8 +276,101 @@ struct _ml_pipeline {
   GHashTable *namednodes;         /**< hash table of "element"s. */
   GHashTable *resources;          /**< hash table of resources to construct the pipeline */
   pipeline_state_cb_s state_cb;   /**< Callback to notify the change of pipeline state */
+  GMutex state_lock;              /**< Lock for the pipeline state and EOS, updated by the bus messages */
+  GCond state_cond;               /**< Condition to wait for the change of pipeline state and EOS */
+  ml_pipeline_async_cb start_cb;  /**< Callback to notify the pipeline is started asynchronously */
+  void *start_user_data;          /**< The user data passed to the start callback */
 };
 
+/**
+ * @brief Internal function to handle the properties of element handle.
+ */
+typedef void (*ml_pipeline_element_option_cb) (ml_pipeline_element *e);
+
+/**
+ * @brief Internal data structure of the named element in pipeline template.
+ */
+typedef struct {
+  ml_pipeline_element_e type; /**< The type of element handle */
+  ml_pipeline_element_option_cb option; /**< The function to handle the properties, NULL if not required */
+} ml_pipeline_template_node_s;
+
+/**
+ * @brief Internal data structure of the parameter in pipeline template.
+ */
+typedef struct {
+  gchar *param; /**< The name of parameter */
+  gchar *element; /**< The name of element */
+  gchar *property; /**< The name of element property */
+} ml_pipeline_template_param_s;
+
+/**
+ * @brief Internal private representation of pipeline template.
+ * @details The template is not changed after the creation, so it does not need the lock.
+ */
+typedef struct {
+  gchar *description; /**< The pipeline description without the parameters */
+  gboolean convert; /**< The description has the pre-defined elements to be converted for each pipeline */
+  gboolean compiled; /**< The description is parsed and validated */
+  GHashTable *nodes; /**< The named elements, element name to ml_pipeline_template_node_s */
+  GPtrArray *params; /**< The parameters, array of ml_pipeline_template_param_s */
+} ml_pipeline_template_s;
+
+/**
+ * @brief Internal private representation of pipeline pool.
+ */
+typedef struct {
+  GMutex lock; /**< Lock for the pipelines in the pool */
+  ml_pipeline_template_s *tmpl; /**< The template to construct the pipeline */
+  gchar **names; /**< The names of parameters */
+  gchar **values; /**< The values of parameters */
+  guint num_params; /**< The number of parameters */
+  guint size; /**< The max number of ready pipelines */
+  GQueue ready; /**< The ready pipelines */
+  GHashTable *acquired; /**< The set of pipelines acquired from the pool */
+} ml_pipeline_pool_s;
+
+/**
+ * @brief Internal private representation of the streams filled in the batched frame.
+ */
+typedef struct {
+  guint64 seq; /**< The sequence number of the batched frame, tagged on the buffer pushed into the pipeline */
+  gboolean *filled; /**< The filled streams in the frame */
+} ml_pipeline_batch_mask_s;
+
+/**
+ * @brief Internal private representation of the batch of multiple streams.
+ */
+typedef struct {
+  gint ref_count; /**< The reference count, the frames in the pipeline hold the batch */
+  GMutex lock; /**< Lock for the pending frame */
+  GCond cond; /**< Condition to wake up the thread waiting for the deadline */
+  GMutex queue_lock; /**< Lock for the masks and the released frames */
+  GQueue masks; /**< The masks (ml_pipeline_batch_mask_s) of the frames pushed into the pipeline, in order of the sequence number */
+  GQueue free_data; /**< The released frames to be reused */
+  ml_tensors_data_h pushing; /**< The frame being pushed, to check the frame is released while pushing */
+  guint64 seq; /**< The sequence number of the last batched frame */
+  ml_pipeline *pipe; /**< The pipeline of the batch */
+  ml_pipeline_element *src; /**< The src element to push the frame */
+  guint32 src_id; /**< The id of src handle. The pipeline may release the handle (e.g., reset), thus the batch finds the handle with the id. */
+  ml_pipeline_element *sink; /**< The sink element to get the output */
+  guint32 sink_id; /**< The id of sink handle */
+  guint num_streams; /**< The number of streams */
+  guint num_tensors; /**< The number of tensors in the frame of src node */
+  gsize chunk[ML_TENSOR_SIZE_LIMIT]; /**< The size of each tensor of a stream */
+  ml_tensors_info_h in_info; /**< The tensors info of src node */
+  ml_tensors_info_h out_info; /**< The tensors info of a stream in the output, accessed in the sink thread only */
+  ml_pipeline_batch_cb cb; /**< The callback for the output of each stream */
+  void *user_data; /**< The user data passed to the callback */
+  ml_tensors_data_h pending; /**< The frame waiting for the streams */
+  gboolean *filled; /**< The filled streams in the pending frame */
+  guint num_filled; /**< The number of filled streams in the pending frame */
+  guint deadline_ms; /**< The max time to wait for the streams */
+  gint64 end_time; /**< The deadline of the pending frame (monotonic time) */
+  GThread *thread; /**< The thread to push the frame when the deadline is expired */
+  gboolean running; /**< The thread is running */
+} ml_pipeline_batch_s;
+
 /**
  * @brief Internal private representation sink callback function for GstTensorSink and GstAppSink
  * @details This represents a single instance of callback registration. This should not be exposed to applications.
@@ -172,6 +379,8 @@ typedef struct {
   ml_pipeline_sink_cb sink_cb;
   ml_pipeline_src_callbacks_s src_cb;
   void *pdata;
+  ml_pipeline_src_release_cb release_cb; /**< Callback to release the data pushed into src element */
+  void *release_pdata; /**< The user data passed to the release callback */
 } callback_info_s;
 
 /**
@@ -181,7 +390,7 @@ typedef struct {
 typedef struct _ml_pipeline_common_elem {
   ml_pipeline *pipe;
   ml_pipeline_element *element;
-  guint32 id;
+  guint32 id; /**< The id of handle, unique in the element. The released handle is identified with this, not with the address. */
   callback_info_s *callback_info;   /**< Callback function information. If element is not GstTensorSink or GstAppSink, then it should be NULL. */
 } ml_pipeline_common_elem;
 
@@ -201,6 +410,11 @@ typedef struct _ml_pipeline_common_elem {
  */
 int _ml_tensors_info_create_from_gst (ml_tensors_info_h *ml_info, GstTensorsInfo *gst_info);
 
+/**
+ * @brief Internal function to convert the tensor type of gst tensors info.
+ */
+ml_tensor_type_e _ml_tensor_type_from_gst (tensor_type type);
+
 /**
  * @brief Copies tensor metadata from gst tensors info.
  */
@@ -208,8 +422,10 @@ void _ml_tensors_info_copy_from_gst (ml_tensors_info_s *ml_info, const GstTensor
 
 /**
  * @brief Copies tensor metadata from ml tensors info.
+ * @return @c 0 on success. Otherwise a negative error value.
+ * @retval #ML_ERROR_NOT_SUPPORTED The number of tensors or the rank exceeds the limit of NNStreamer.
  */
-void _ml_tensors_info_copy_from_ml (GstTensorsInfo *gst_info, const ml_tensors_info_s *ml_info);
+int _ml_tensors_info_copy_from_ml (GstTensorsInfo *gst_info, const ml_tensors_info_s *ml_info);
 
 /**
  * @brief Internal function to get the sub-plugin name.
@@ -11,6 +11,7 @@
  * @bug Thread safety for ml_tensors_data should be addressed.
  */
 
+#include <stdlib.h>
 #include <string.h>
 #include <glib.h>
 #include <gst/gstbuffer.h>
@@ -89,38 +90,48 @@ static void ml_pipeline_if_custom_ref (ml_pipeline_if_h custom);
 static void ml_pipeline_if_custom_unref (ml_pipeline_if_h custom);
 
 /**
- * @brief Global lock for pipeline functions.
+ * @brief Global lock for the custom data. Lookups are read-mostly, so it is a reader-writer lock.
  */
-G_LOCK_DEFINE_STATIC (g_ml_pipe_lock);
+static GRWLock g_ml_custom_lock;
 
 /**
- * @brief The list of custom data. This should be managed with lock.
+ * @brief The table of custom data, keyed by data type and name. This should be managed with lock.
  */
-static GList *g_ml_custom_data = NULL;
+static GHashTable *g_ml_custom_data = NULL;
 
 /**
- * @brief Finds a position of custom data in the list.
- * @note This function should be called with lock.
+ * @brief Hash function of custom data, with data type and name.
  */
-static GList *
-pipe_custom_find_link (const pipe_custom_type_e type, const gchar * name)
+static guint
+pipe_custom_hash (gconstpointer key)
 {
-  pipe_custom_data_s *data;
-  GList *link;
+  const pipe_custom_data_s *data = (const pipe_custom_data_s *) key;
 
-  g_return_val_if_fail (name != NULL, NULL);
+  return g_str_hash (data->name) ^ (guint) data->type;
+}
 
-  link = g_ml_custom_data;
-  while (link) {
-    data = (pipe_custom_data_s *) link->data;
+/**
+ * @brief Compares the data type and name of custom data.
+ */
+static gboolean
+pipe_custom_equal (gconstpointer a, gconstpointer b)
+{
+  const pipe_custom_data_s *data1 = (const pipe_custom_data_s *) a;
+  const pipe_custom_data_s *data2 = (const pipe_custom_data_s *) b;
 
-    if (data->type == type && g_str_equal (data->name, name))
-      break;
+  return (data1->type == data2->type && g_str_equal (data1->name, data2->name));
+}
 
-    link = link->next;
-  }
+/**
+ * @brief Releases custom data in the table.
+ */
+static void
+pipe_custom_free_data (gpointer data)
+{
+  pipe_custom_data_s *custom_data = (pipe_custom_data_s *) data;
 
-  return link;
+  g_free (custom_data->name);
+  g_free (custom_data);
 }
 
 /**
@@ -129,20 +140,26 @@ pipe_custom_find_link (const pipe_custom_type_e type, const gchar * name)
 static pipe_custom_data_s *
 pipe_custom_find_data (const pipe_custom_type_e type, const gchar * name)
 {
-  pipe_custom_data_s *data;
-  GList *link;
+  pipe_custom_data_s key;
+  pipe_custom_data_s *data = NULL;
+
+  g_return_val_if_fail (name != NULL, NULL);
+
+  key.type = type;
+  key.name = (gchar *) name;
+  key.handle = NULL;
 
-  G_LOCK (g_ml_pipe_lock);
+  g_rw_lock_reader_lock (&g_ml_custom_lock);
 
-  link = pipe_custom_find_link (type, name);
-  data = (link != NULL) ? (pipe_custom_data_s *) link->data : NULL;
+  if (g_ml_custom_data)
+    data = (pipe_custom_data_s *) g_hash_table_lookup (g_ml_custom_data, &key);
 
-  G_UNLOCK (g_ml_pipe_lock);
+  g_rw_lock_reader_unlock (&g_ml_custom_lock);
   return data;
 }
 
 /**
- * @brief Adds new custom data into the list.
+ * @brief Adds new custom data into the table.
  */
 static void
 pipe_custom_add_data (const pipe_custom_type_e type, const gchar * name,
@@ -155,33 +172,39 @@ pipe_custom_add_data (const pipe_custom_type_e type, const gchar * name,
   data->name = g_strdup (name);
   data->handle = handle;
 
-  G_LOCK (g_ml_pipe_lock);
-  g_ml_custom_data = g_list_prepend (g_ml_custom_data, data);
-  G_UNLOCK (g_ml_pipe_lock);
+  g_rw_lock_writer_lock (&g_ml_custom_lock);
+
+  if (g_ml_custom_data == NULL) {
+    g_ml_custom_data = g_hash_table_new_full (pipe_custom_hash,
+        pipe_custom_equal, NULL, pipe_custom_free_data);
+  }
+
+  /* the data is the key itself */
+  g_hash_table_replace (g_ml_custom_data, data, data);
+
+  g_rw_lock_writer_unlock (&g_ml_custom_lock);
 }
 
 /**
- * @brief Removes custom data from the list.
+ * @brief Removes custom data from the table.
  */
 static void
 pipe_custom_remove_data (const pipe_custom_type_e type, const gchar * name)
 {
-  pipe_custom_data_s *data;
-  GList *link;
+  pipe_custom_data_s key;
 
-  G_LOCK (g_ml_pipe_lock);
+  g_return_if_fail (name != NULL);
 
-  link = pipe_custom_find_link (type, name);
-  if (link) {
-    data = (pipe_custom_data_s *) link->data;
+  key.type = type;
+  key.name = (gchar *) name;
+  key.handle = NULL;
 
-    g_ml_custom_data = g_list_delete_link (g_ml_custom_data, link);
+  g_rw_lock_writer_lock (&g_ml_custom_lock);
 
-    g_free (data->name);
-    g_free (data);
-  }
+  if (g_ml_custom_data)
+    g_hash_table_remove (g_ml_custom_data, &key);
 
-  G_UNLOCK (g_ml_pipe_lock);
+  g_rw_lock_writer_unlock (&g_ml_custom_lock);
 }
 
 /**
@@ -236,1492 +259,4668 @@ construct_element (GstElement * e, ml_pipeline * p, const char *name,
   ret->handle_id = 0;
   ret->is_media_stream = FALSE;
   ret->is_flexible_tensor = FALSE;
+  ret->src_probe_id = 0;
+  ret->caps_changed = FALSE;
+  _ml_tensors_info_initialize (&ret->flex_info);
+  ret->src_blocking = FALSE;
+  ret->src_enough_data = FALSE;
+  ret->src_timeout = 0;
+  ret->stats = NULL;
+  ret->stats_probes = NULL;
+  ret->latency = NULL;
+  ret->sink_cb_thread = NULL;
+  ret->qos = NULL;
+  ret->qos_probes = NULL;
   g_mutex_init (&ret->lock);
+  g_cond_init (&ret->src_cond);
+
+  if (t == ML_PIPELINE_ELEMENT_SINK || t == ML_PIPELINE_ELEMENT_APP_SINK) {
+    ret->latency = g_new0 (ml_pipeline_latency_s, 1);
+    g_mutex_init (&ret->latency->lock);
+  }
+
   return ret;
 }
 
 /**
- * @brief Internal function to get the tensors info from the element caps.
+ * @brief Internal function to release the cached flex-tensor header of src element.
+ * @note This function should be called with element lock.
  */
-static gboolean
-get_tensors_info_from_caps (GstCaps * caps, ml_tensors_info_s * info,
-    gboolean * is_flexible)
+static void
+clear_flex_header (ml_pipeline_element * e)
 {
-  GstStructure *s;
-  GstTensorsConfig config;
-  guint i, n_caps;
-  gboolean found = FALSE;
-
-  _ml_tensors_info_initialize (info);
-  n_caps = gst_caps_get_size (caps);
-
-  for (i = 0; i < n_caps; i++) {
-    s = gst_caps_get_structure (caps, i);
-    found = gst_tensors_config_from_structure (&config, s);
+  guint i;
 
-    if (found) {
-      _ml_tensors_info_copy_from_gst (info, &config.info);
-      *is_flexible = gst_tensors_config_is_flexible (&config);
-      break;
-    }
+  for (i = 0; i < ML_TENSOR_SIZE_LIMIT; i++) {
+    g_free (e->flex_header[i]);
+    e->flex_header[i] = NULL;
+    e->flex_header_size[i] = 0;
   }
 
-  return found;
+  _ml_tensors_info_free (&e->flex_info);
 }
 
 /**
- * @brief Handle a sink element for registered ml_pipeline_sink_cb
+ * @brief Internal function to release the cached caps of src element.
+ * @note This function should be called with element lock.
  */
 static void
-cb_sink_event (GstElement * e, GstBuffer * b, gpointer user_data)
+clear_src_caps (ml_pipeline_element * e)
 {
-  ml_pipeline_element *elem = user_data;
-
-  /** @todo CRITICAL if the pipeline is being killed, don't proceed! */
-  GstMemory *mem[ML_TENSOR_SIZE_LIMIT];
-  GstMapInfo map[ML_TENSOR_SIZE_LIMIT];
-  guint i;
-  guint num_mems;
-  GList *l;
-  ml_tensors_data_s *_data = NULL;
-  ml_tensors_info_s *_info;
-  ml_tensors_info_s info_flex_tensor;
-  size_t total_size = 0;
-  int status;
-
-  _info = &elem->tensors_info;
-  num_mems = gst_buffer_n_memory (b);
+  if (e->src) {
+    if (e->src_probe_id > 0)
+      gst_pad_remove_probe (e->src, e->src_probe_id);
 
-  if (num_mems > ML_TENSOR_SIZE_LIMIT) {
-    _ml_loge
-        ("Number of memory chunks in a GstBuffer exceed the limit: %u > %u",
-        num_mems, ML_TENSOR_SIZE_LIMIT);
-    return;
+    gst_object_unref (e->src);
+    e->src = NULL;
   }
 
-  /* set tensor data */
-  status =
-      _ml_tensors_data_create_no_alloc (NULL, (ml_tensors_data_h *) & _data);
-  if (status != ML_ERROR_NONE) {
-    _ml_loge ("Failed to allocate memory for tensors data in sink callback.");
-    return;
-  }
+  e->src_probe_id = 0;
+  e->size = 0;
+  e->is_media_stream = FALSE;
+  e->is_flexible_tensor = FALSE;
+  g_atomic_int_set (&e->caps_changed, FALSE);
 
-  _data->num_tensors = num_mems;
-  for (i = 0; i < num_mems; i++) {
-    mem[i] = gst_buffer_peek_memory (b, i);
-    if (!gst_memory_map (mem[i], &map[i], GST_MAP_READ)) {
-      nns_loge ("Failed to map the output in sink '%s' callback", elem->name);
-      num_mems = i;
-      goto error;
-    }
+  _ml_tensors_info_free (&e->tensors_info);
+  clear_flex_header (e);
+}
 
-    _data->tensors[i].tensor = map[i].data;
-    _data->tensors[i].size = map[i].size;
+/**
+ * @brief Pad probe of src element to invalidate the cached caps.
+ * @note This is called in the streaming thread, do not acquire the element lock here.
+ */
+static GstPadProbeReturn
+cb_src_pad_event (GstPad * pad, GstPadProbeInfo * info, gpointer user_data)
+{
+  ml_pipeline_element *elem = user_data;
+  GstEvent *event = GST_PAD_PROBE_INFO_EVENT (info);
 
-    total_size += map[i].size;
-  }
+  if (event && GST_EVENT_TYPE (event) == GST_EVENT_CAPS)
+    g_atomic_int_set (&elem->caps_changed, TRUE);
 
-  g_mutex_lock (&elem->lock);
+  return GST_PAD_PROBE_OK;
+}
 
-  /** @todo This assumes that padcap is static */
-  if (elem->sink == NULL) {
-    /* Get the sink-pad-cap */
-    elem->sink = gst_element_get_static_pad (elem->element, "sink");
+/**
+ * @brief The max number of released frames kept in the pool of src element.
+ */
+#define SRC_POOL_MAX_FRAMES (32U)
 
-    if (elem->sink) {
-      /* sinkpadcap available (negotiated) */
-      GstCaps *caps = gst_pad_get_current_caps (elem->sink);
+/**
+ * @brief Internal data structure for the frame pushed into src element.
+ */
+typedef struct {
+  ml_pipeline_src_pool_s *pool; /**< The pool to recycle this frame */
+  gint mem_count; /**< The number of memories wrapping the data (atomic) */
+  ml_tensors_data_h data; /**< The pushed data */
+  ml_pipeline_src_release_cb cb; /**< The callback to release the data */
+  void *pdata; /**< The user data passed to the release callback */
+} ml_pipeline_src_frame_s;
 
-      if (caps) {
-        gboolean flexible = FALSE;
-        gboolean found = get_tensors_info_from_caps (caps, _info, &flexible);
+/**
+ * @brief Decreases ref count of the frame pool of src element.
+ */
+static void
+src_pool_unref (ml_pipeline_src_pool_s * pool)
+{
+  ml_pipeline_src_frame_s *frame;
 
-        gst_caps_unref (caps);
+  if (pool && g_atomic_int_dec_and_test (&pool->ref_count)) {
+    while ((frame = g_queue_pop_head (&pool->frames)) != NULL)
+      g_free (frame);
 
-        if (found) {
-          elem->size = 0;
+    g_mutex_clear (&pool->lock);
+    g_free (pool);
+  }
+}
 
-          /* cannot get exact info from caps */
-          if (flexible) {
-            elem->is_flexible_tensor = TRUE;
-            goto send_cb;
-          }
+/**
+ * @brief Gets a frame from the pool of src element. Allocates new one if the pool is empty.
+ * @note This function should be called with element lock.
+ */
+static ml_pipeline_src_frame_s *
+src_pool_get_frame (ml_pipeline_element * elem)
+{
+  ml_pipeline_src_pool_s *pool;
+  ml_pipeline_src_frame_s *frame;
 
-          if (_info->num_tensors != num_mems) {
-            _ml_loge
-                ("The sink event of [%s] cannot be handled because the number of tensors mismatches.",
-                elem->name);
+  if (elem->src_pool == NULL) {
+    pool = g_new0 (ml_pipeline_src_pool_s, 1);
+    pool->ref_count = 1;
+    g_mutex_init (&pool->lock);
+    g_queue_init (&pool->frames);
 
-            gst_object_unref (elem->sink);
-            elem->sink = NULL;
-            goto error;
-          }
+    elem->src_pool = pool;
+  }
 
-          for (i = 0; i < _info->num_tensors; i++) {
-            size_t sz = _ml_tensor_info_get_size (&_info->info[i]);
+  pool = elem->src_pool;
 
-            /* Not configured, yet. */
-            if (sz == 0)
-              _ml_loge ("The caps for sink(%s) is not configured.", elem->name);
+  g_mutex_lock (&pool->lock);
+  frame = g_queue_pop_head (&pool->frames);
+  g_mutex_unlock (&pool->lock);
 
-            if (sz != _data->tensors[i].size) {
-              _ml_loge
-                  ("The sink event of [%s] cannot be handled because the tensor dimension mismatches.",
-                  elem->name);
+  if (frame == NULL)
+    frame = g_new0 (ml_pipeline_src_frame_s, 1);
 
-              gst_object_unref (elem->sink);
-              elem->sink = NULL;
-              goto error;
-            }
+  /* each frame in the pipeline holds the pool */
+  g_atomic_int_inc (&pool->ref_count);
+  frame->pool = pool;
 
-            elem->size += sz;
-          }
-        } else {
-          gst_object_unref (elem->sink);
-          elem->sink = NULL;    /* It is not valid */
-          goto error;
-          /** @todo What if it keeps being "NULL"? Exception handling at 2nd frame? */
-        }
-      }
-    }
-  }
+  return frame;
+}
 
-  /* Get the data! */
-  if (gst_buffer_get_size (b) != total_size ||
-      (elem->size > 0 && total_size != elem->size)) {
-    _ml_loge
-        ("The buffersize mismatches. All the three values must be the same: %zu, %zu, %zu",
-        total_size, elem->size, gst_buffer_get_size (b));
-    goto error;
-  }
+/**
+ * @brief Releases the memory wrapping the pushed data. The frame returns to the pool when all memories are released.
+ */
+static void
+src_pool_release_frame (gpointer data)
+{
+  ml_pipeline_src_frame_s *frame = data;
+  ml_pipeline_src_pool_s *pool;
 
-send_cb:
-  /* set info for flexible stream */
-  if (elem->is_flexible_tensor) {
-    GstTensorMetaInfo meta;
-    GstTensorsInfo gst_info;
-    gsize hsize;
+  if (!g_atomic_int_dec_and_test (&frame->mem_count))
+    return;
 
-    gst_tensors_info_init (&gst_info);
-    gst_info.num_tensors = num_mems;
-    _info = &info_flex_tensor;
+  if (frame->cb)
+    frame->cb (frame->data, frame->pdata);
 
-    /* handle header for flex tensor */
-    for (i = 0; i < num_mems; i++) {
-      gst_tensor_meta_info_parse_header (&meta, map[i].data);
-      hsize = gst_tensor_meta_info_get_header_size (&meta);
+  pool = frame->pool;
+  memset (frame, 0, sizeof (ml_pipeline_src_frame_s));
 
-      gst_tensor_meta_info_convert (&meta, &gst_info.info[i]);
+  g_mutex_lock (&pool->lock);
+  if (g_queue_get_length (&pool->frames) < SRC_POOL_MAX_FRAMES) {
+    g_queue_push_head (&pool->frames, frame);
+    frame = NULL;
+  }
+  g_mutex_unlock (&pool->lock);
 
-      _data->tensors[i].tensor = map[i].data + hsize;
-      _data->tensors[i].size = map[i].size - hsize;
-    }
+  g_free (frame);
+  src_pool_unref (pool);
+}
 
-    _ml_tensors_info_copy_from_gst (_info, &gst_info);
-  }
+/**
+ * @brief Internal data structure for the pad probe to collect the statistics.
+ */
+typedef struct {
+  GstPad *pad; /**< The pad (ref) */
+  gulong probe_id; /**< The id of pad probe */
+} ml_pipeline_stats_probe_s;
 
-  /* Iterate e->handles, pass the data to them */
-  for (l = elem->handles; l != NULL; l = l->next) {
-    ml_pipeline_sink_cb callback;
-    ml_pipeline_common_elem *sink = l->data;
-    if (sink->callback_info == NULL)
-      continue;
+/**
+ * @brief The upper bounds of the latency histogram buckets (us), the last bucket is unlimited.
+ */
+static const guint64 stats_latency_bounds[ML_PIPELINE_LATENCY_HISTOGRAM_SIZE - 1] = {
+  100, 500, 1000, 5000, 10000, 50000, 100000
+};
 
-    callback = sink->callback_info->sink_cb;
-    if (callback)
-      callback (_data, _info, sink->callback_info->pdata);
+/**
+ * @brief Internal function to release the statistics.
+ */
+static void
+stats_unref (gpointer data)
+{
+  ml_pipeline_stats_s *stats = data;
 
-    /** @todo Measure time. Warn if it takes long. Kill if it takes too long. */
+  if (stats && g_atomic_int_dec_and_test (&stats->ref_count)) {
+    g_mutex_clear (&stats->lock);
+    g_free (stats);
   }
+}
 
-error:
-  g_mutex_unlock (&elem->lock);
+/**
+ * @brief Internal function to add the latency sample.
+ * @note This function should be called with statistics lock.
+ */
+static void
+stats_add_latency (ml_pipeline_stats_s * stats, guint64 latency)
+{
+  guint i;
 
-  for (i = 0; i < num_mems; i++) {
-    gst_memory_unmap (mem[i], &map[i]);
+  stats->latency_sum += latency;
+  stats->latency_count++;
+  if (stats->latency_max < latency)
+    stats->latency_max = latency;
+
+  for (i = 0; i < ML_PIPELINE_LATENCY_HISTOGRAM_SIZE - 1; i++) {
+    if (latency < stats_latency_bounds[i])
+      break;
   }
 
-  _ml_tensors_data_destroy_internal (_data, FALSE);
-  _data = NULL;
+  stats->histogram[i]++;
+}
 
-  return;
+/**
+ * @brief Internal function to remove the oldest pending frames.
+ * @note This function should be called with statistics lock.
+ */
+static void
+stats_pop_pending (ml_pipeline_stats_s * stats, guint count)
+{
+  stats->pending_head = (stats->pending_head + count) %
+      ML_PIPELINE_STATS_PENDING_LIMIT;
+  stats->pending_count -= count;
 }
 
 /**
- * @brief Handle a appsink element for registered ml_pipeline_sink_cb
+ * @brief Internal function to find the pending input frame of the output frame.
+ * @return The position of the pending frame from the oldest one, or -1 if not found.
+ * @note This function should be called with statistics lock.
  */
-static GstFlowReturn
-cb_appsink_new_sample (GstElement * e, gpointer user_data)
+static gint
+stats_find_pending (ml_pipeline_stats_s * stats, GstClockTime pts)
 {
-  GstSample *sample;
-  GstBuffer *buffer;
+  guint i, idx;
 
-  /* get the sample from appsink */
-  sample = gst_app_sink_pull_sample (GST_APP_SINK (e));
-  buffer = gst_sample_get_buffer (sample);
+  if (stats->pending_count == 0)
+    return -1;
 
-  cb_sink_event (e, buffer, user_data);
+  if (!GST_CLOCK_TIME_IS_VALID (pts)) {
+    /* cannot identify the frame, only the single-sink element outputs the last input */
+    return (stats->num_sinks == 1) ? (gint) stats->pending_count - 1 : -1;
+  }
 
-  gst_sample_unref (sample);
-  return GST_FLOW_OK;
+  for (i = 0; i < stats->pending_count; i++) {
+    idx = (stats->pending_head + i) % ML_PIPELINE_STATS_PENDING_LIMIT;
+    if (stats->pending[idx].pts == pts)
+      return (gint) i;
+  }
+
+  return -1;
 }
 
 /**
- * @brief Callback for bus message.
+ * @brief Pad probe to collect the statistics of an element.
+ * @details The output frame is paired with the input frame of the same timestamp.
  */
-static void
-cb_bus_sync_message (GstBus * bus, GstMessage * message, gpointer user_data)
+static GstPadProbeReturn
+cb_stats_pad_probe (GstPad * pad, GstPadProbeInfo * info, gpointer user_data)
 {
-  ml_pipeline *pipe_h;
+  ml_pipeline_stats_s *stats = user_data;
+  GstBuffer *buffer = GST_PAD_PROBE_INFO_BUFFER (info);
+  gint64 now = g_get_monotonic_time ();
+  guint idx;
+  gint found;
+
+  g_mutex_lock (&stats->lock);
+
+  if (GST_PAD_IS_SINK (pad)) {
+    stats->frames_in++;
+
+    if (!stats->has_src) {
+      if (stats->first_time == 0)
+        stats->first_time = now;
+      stats->last_time = now;
+    } else if (stats->num_sinks == 1 ||
+        GST_BUFFER_PTS_IS_VALID (buffer)) {
+      /* the oldest frame is not pushed out */
+      if (stats->pending_count == ML_PIPELINE_STATS_PENDING_LIMIT) {
+        stats->dropped++;
+        stats_pop_pending (stats, 1);
+      }
 
-  pipe_h = (ml_pipeline *) user_data;
+      idx = (stats->pending_head + stats->pending_count) %
+          ML_PIPELINE_STATS_PENDING_LIMIT;
+      stats->pending[idx].pts = GST_BUFFER_PTS (buffer);
+      stats->pending[idx].in_time = now;
+      stats->pending_count++;
 
-  if (pipe_h == NULL)
-    return;
-
-  switch (GST_MESSAGE_TYPE (message)) {
-    case GST_MESSAGE_EOS:
-      pipe_h->isEOS = TRUE;
-      break;
-    case GST_MESSAGE_STATE_CHANGED:
-      if (GST_MESSAGE_SRC (message) == GST_OBJECT_CAST (pipe_h->element)) {
-        GstState old_state, new_state;
+      if (stats->pending_max < stats->pending_count)
+        stats->pending_max = stats->pending_count;
+    }
+  } else {
+    stats->frames_out++;
+    stats->bytes_out += gst_buffer_get_size (buffer);
 
-        gst_message_parse_state_changed (message, &old_state, &new_state, NULL);
-        pipe_h->pipe_state = (ml_pipeline_state_e) new_state;
+    if (stats->first_time == 0)
+      stats->first_time = now;
+    stats->last_time = now;
 
-        _ml_logd ("The pipeline state changed from %s to %s.",
-            gst_element_state_get_name (old_state),
-            gst_element_state_get_name (new_state));
+    found = stats_find_pending (stats, GST_BUFFER_PTS (buffer));
+    if (found >= 0) {
+      /* the frames before the paired one are passed without output */
+      stats->dropped += found;
 
-        if (pipe_h->state_cb.cb) {
-          pipe_h->state_cb.cb (pipe_h->pipe_state, pipe_h->state_cb.user_data);
-        }
-      }
-      break;
-    default:
-      break;
+      idx = (stats->pending_head + found) % ML_PIPELINE_STATS_PENDING_LIMIT;
+      stats_add_latency (stats, (guint64) (now - stats->pending[idx].in_time));
+      stats_pop_pending (stats, found + 1);
+    }
   }
+
+  g_mutex_unlock (&stats->lock);
+  return GST_PAD_PROBE_OK;
 }
 
 /**
- * @brief Clean up each element of the pipeline.
+ * @brief Internal function to add the pad probe to collect the statistics.
  */
-static void
-free_element_handle (gpointer data)
+static gboolean
+stats_add_pad_probe (GstElement * element, GstPad * pad, gpointer user_data)
 {
-  ml_pipeline_common_elem *item = (ml_pipeline_common_elem *) data;
+  ml_pipeline_element *e = user_data;
+  ml_pipeline_stats_probe_s *probe;
 
-  if (item) {
-    ml_pipeline_element *elem = item->element;
+  probe = g_new0 (ml_pipeline_stats_probe_s, 1);
+  probe->pad = gst_object_ref (pad);
 
-    /* clear callbacks */
-    if (item->callback_info) {
-      item->callback_info->sink_cb = NULL;
+  /* the probe holds the statistics until it is removed */
+  g_atomic_int_inc (&e->stats->ref_count);
+  probe->probe_id = gst_pad_add_probe (pad, GST_PAD_PROBE_TYPE_BUFFER,
+      cb_stats_pad_probe, e->stats, stats_unref);
 
-      if (elem->type == ML_PIPELINE_ELEMENT_APP_SRC) {
-        GstAppSrcCallbacks appsrc_cb = { 0, };
-        gst_app_src_set_callbacks (GST_APP_SRC (elem->element), &appsrc_cb,
-            NULL, NULL);
-      }
+  e->stats_probes = g_slist_prepend (e->stats_probes, probe);
+  return TRUE;
+}
 
-      g_free (item->callback_info);
-      item->callback_info = NULL;
-    }
+/**
+ * @brief Internal function to check the pads of the element.
+ */
+static gboolean
+stats_check_pad (GstElement * element, GstPad * pad, gpointer user_data)
+{
+  ml_pipeline_stats_s *stats = user_data;
 
-    g_free (item);
-  }
+  if (GST_PAD_IS_SRC (pad))
+    stats->has_src = TRUE;
+  else
+    stats->num_sinks++;
+
+  return TRUE;
 }
 
 /**
- * @brief Private function for ml_pipeline_destroy, cleaning up nodes in namednodes
+ * @brief Internal function to start collecting the statistics of an element.
+ * @note This function should be called with element lock.
  */
 static void
-cleanup_node (gpointer data)
+set_element_stats (ml_pipeline_element * e)
 {
-  ml_pipeline_element *e = data;
+  ml_pipeline_stats_s *stats;
 
-  g_mutex_lock (&e->lock);
-  /** @todo CRITICAL. Stop the handle callbacks if they are running/ready */
-  if (e->handle_id > 0) {
-    g_signal_handler_disconnect (e->element, e->handle_id);
-    e->handle_id = 0;
-  }
+  stats = g_new0 (ml_pipeline_stats_s, 1);
+  stats->ref_count = 1;
+  g_mutex_init (&stats->lock);
+  gst_element_foreach_pad (e->element, stats_check_pad, stats);
 
-  /* clear all handles first */
-  if (e->handles)
-    g_list_free_full (e->handles, free_element_handle);
-  e->handles = NULL;
+  e->stats = stats;
+  gst_element_foreach_pad (e->element, stats_add_pad_probe, e);
+}
 
-  if (e->type == ML_PIPELINE_ELEMENT_APP_SRC && !e->pipe->isEOS) {
-    int eos_check_cnt = 0;
+/**
+ * @brief Internal function to stop collecting the statistics of an element.
+ * @note This function should be called with element lock.
+ */
+static void
+clear_element_stats (ml_pipeline_element * e)
+{
+  GSList *l;
 
-    /** to push EOS event, the pipeline should be in PLAYING state */
-    gst_element_set_state (e->pipe->element, GST_STATE_PLAYING);
+  for (l = e->stats_probes; l; l = l->next) {
+    ml_pipeline_stats_probe_s *probe = l->data;
 
-    if (gst_app_src_end_of_stream (GST_APP_SRC (e->element)) != GST_FLOW_OK) {
-      _ml_logw ("Failed to set EOS in %s", e->name);
-    }
-    g_mutex_unlock (&e->lock);
-    while (!e->pipe->isEOS) {
-      eos_check_cnt++;
-      /** check EOS every 1ms */
-      g_usleep (1000);
-      if (eos_check_cnt >= EOS_MESSAGE_TIME_LIMIT) {
-        _ml_loge ("Failed to get EOS message");
-        break;
-      }
-    }
-    g_mutex_lock (&e->lock);
+    /* the statistics is released when the probe is not in use */
+    gst_pad_remove_probe (probe->pad, probe->probe_id);
+    gst_object_unref (probe->pad);
+    g_free (probe);
   }
 
-  if (e->custom_destroy) {
-    e->custom_destroy (e->custom_data, e);
-  }
+  g_slist_free (e->stats_probes);
+  e->stats_probes = NULL;
 
-  g_free (e->name);
-  if (e->src)
-    gst_object_unref (e->src);
-  if (e->sink)
-    gst_object_unref (e->sink);
+  stats_unref (e->stats);
+  e->stats = NULL;
+}
 
-  _ml_tensors_info_free (&e->tensors_info);
+/**
+ * @brief The caps of reference timestamp meta to stamp the ingress time of the frame.
+ */
+static GstStaticCaps ingress_caps = GST_STATIC_CAPS ("timestamp/x-ml-ingress");
 
-  g_mutex_unlock (&e->lock);
-  g_mutex_clear (&e->lock);
+/**
+ * @brief Internal function to stamp the ingress time (monotonic) on the buffer pushed into src element.
+ */
+static void
+stamp_ingress_time (GstBuffer * buffer)
+{
+  GstCaps *caps = gst_static_caps_get (&ingress_caps);
 
-  g_free (e);
+  gst_buffer_add_reference_timestamp_meta (buffer, caps,
+      (GstClockTime) g_get_monotonic_time () * GST_USECOND,
+      GST_CLOCK_TIME_NONE);
+  gst_caps_unref (caps);
 }
 
 /**
- * @brief Private function to release the pipeline resources
+ * @brief Internal function to get the ingress time (monotonic, us) of the buffer.
+ * @return TRUE if the buffer is pushed into src element.
  */
-static void
-cleanup_resource (gpointer data)
+static gboolean
+get_ingress_time (GstBuffer * buffer, guint64 * ingress)
 {
-  pipeline_resource_s *res = data;
+  GstCaps *caps = gst_static_caps_get (&ingress_caps);
+  GstReferenceTimestampMeta *meta;
 
-  /* check resource type and free data */
-  if (g_str_has_prefix (res->type, "tizen")) {
-    release_tizen_resource (res->handle, res->type);
-  }
+  meta = gst_buffer_get_reference_timestamp_meta (buffer, caps);
+  gst_caps_unref (caps);
 
-  g_free (res->type);
-  g_free (res);
+  if (meta == NULL)
+    return FALSE;
+
+  *ingress = meta->timestamp / GST_USECOND;
+  return TRUE;
 }
 
 /**
- * @brief Converts predefined element in pipeline description.
+ * @brief The caps of reference timestamp meta to tag the frame pushed into src element.
  */
-static int
-convert_element (ml_pipeline_h pipe, const gchar * description, gchar ** result,
-    gboolean is_internal)
-{
-  gchar *converted;
-  int status = ML_ERROR_NONE;
+static GstStaticCaps tag_caps = GST_STATIC_CAPS ("timestamp/x-ml-tag");
 
-  g_return_val_if_fail (pipe, ML_ERROR_INVALID_PARAMETER);
-  g_return_val_if_fail (description && result, ML_ERROR_INVALID_PARAMETER);
+/**
+ * @brief Internal function to tag the buffer pushed into src element, to pair the output with the input frame.
+ */
+static void
+stamp_buffer_tag (GstBuffer * buffer, guint64 tag)
+{
+  GstCaps *caps = gst_static_caps_get (&tag_caps);
 
-  /* init null */
-  *result = NULL;
+  gst_buffer_add_reference_timestamp_meta (buffer, caps, tag,
+      GST_CLOCK_TIME_NONE);
+  gst_caps_unref (caps);
+}
 
-  converted = g_strdup (description);
+/**
+ * @brief Internal function to get the tag of the buffer.
+ * @return TRUE if the buffer is tagged in src element.
+ */
+static gboolean
+get_buffer_tag (GstBuffer * buffer, guint64 * tag)
+{
+  GstCaps *caps = gst_static_caps_get (&tag_caps);
+  GstReferenceTimestampMeta *meta;
 
-  /* convert pre-defined element for Tizen */
-  status = convert_tizen_element (pipe, &converted, is_internal);
+  meta = gst_buffer_get_reference_timestamp_meta (buffer, caps);
+  gst_caps_unref (caps);
 
-  if (status == ML_ERROR_NONE) {
-    _ml_logd ("Converted pipeline: %s", converted);
-    *result = converted;
-  } else {
-    g_free (converted);
-  }
+  if (meta == NULL)
+    return FALSE;
 
-  return status;
+  *tag = meta->timestamp;
+  return TRUE;
 }
 
 /**
- * @brief Handle tensor-filter options.
+ * @brief Internal function to update the end-to-end latency of sink element.
  */
 static void
-process_tensor_filter_option (ml_pipeline_element * e)
+update_sink_latency (ml_pipeline_latency_s * latency, GstBuffer * buffer)
 {
-  gchar *fw = NULL;
-  gchar *model = NULL;
-  pipe_custom_data_s *custom_data;
-
-  g_object_get (G_OBJECT (e->element), "framework", &fw, "model", &model, NULL);
+  guint64 now, ingress, diff;
 
-  if (fw && g_ascii_strcasecmp (fw, "custom-easy") == 0) {
-    /* ref to tensor-filter custom-easy handle. */
-    custom_data = pipe_custom_find_data (PIPE_CUSTOM_TYPE_FILTER, model);
-    if (custom_data) {
-      ml_pipeline_custom_filter_ref (custom_data->handle);
+  if (!get_ingress_time (buffer, &ingress))
+    return;
 
-      e->custom_destroy = pipe_custom_destroy_cb;
-      e->custom_data = custom_data;
-    }
-  }
+  now = (guint64) g_get_monotonic_time ();
+  diff = (now > ingress) ? (now - ingress) : 0;
 
-  g_free (fw);
-  g_free (model);
+  g_mutex_lock (&latency->lock);
+  latency->window[latency->count % ML_PIPELINE_LATENCY_WINDOW] = diff;
+  latency->count++;
+  latency->last = diff;
+  if (latency->max < diff)
+    latency->max = diff;
+  g_mutex_unlock (&latency->lock);
 }
 
 /**
- * @brief Handle tensor-if options.
+ * @brief Internal function to release the end-to-end latency of sink element.
  */
 static void
-process_tensor_if_option (ml_pipeline_element * e)
+clear_sink_latency (ml_pipeline_element * e)
 {
-  gint cv = 0;
-  gchar *cv_option = NULL;
-  pipe_custom_data_s *custom_data;
+  if (e->latency) {
+    g_mutex_clear (&e->latency->lock);
+    g_free (e->latency);
+    e->latency = NULL;
+  }
+}
 
-  g_object_get (G_OBJECT (e->element), "compared-value", &cv,
-      "compared-value-option", &cv_option, NULL);
+/**
+ * @brief The weight of the recent sample in QoS (1/N).
+ */
+#define QOS_WEIGHT (8)
 
-  if (cv == 5) {
-    /* cv is TIFCV_CUSTOM, ref to tensor-if custom handle. */
-    custom_data = pipe_custom_find_data (PIPE_CUSTOM_TYPE_IF, cv_option);
-    if (custom_data) {
-      ml_pipeline_if_custom_ref (custom_data->handle);
+/**
+ * @brief Internal function to release the QoS controller.
+ */
+static void
+qos_unref (gpointer data)
+{
+  ml_pipeline_qos_ctrl_s *qos = data;
 
-      e->custom_destroy = pipe_custom_destroy_cb;
-      e->custom_data = custom_data;
-    }
+  if (qos && g_atomic_int_dec_and_test (&qos->ref_count)) {
+    if (qos->caps)
+      gst_caps_unref (qos->caps);
+    g_mutex_clear (&qos->lock);
+    g_free (qos);
   }
-
-  g_free (cv_option);
 }
 
 /**
- * @brief Iterate elements and prepare element handle.
+ * @brief The caps of reference timestamp meta to stamp the time when the frame is out of tensor_filter with QoS.
  */
-static int
-iterate_element (ml_pipeline * pipe_h, GstElement * pipeline,
-    gboolean is_internal)
-{
-  GstIterator *it = NULL;
-  int status = ML_ERROR_NONE;
+static GstStaticCaps qos_caps = GST_STATIC_CAPS ("timestamp/x-ml-qos");
 
-  g_return_val_if_fail (pipe_h && pipeline, ML_ERROR_INVALID_PARAMETER);
+/**
+ * @brief Internal function to stamp the time (monotonic) on the output of tensor_filter with QoS.
+ * @return The buffer to be passed to the peer pad.
+ */
+static GstBuffer *
+qos_stamp_out_time (ml_pipeline_qos_ctrl_s * qos, GstBuffer * buffer,
+    gint64 now)
+{
+  GstReferenceTimestampMeta *meta;
 
-  g_mutex_lock (&pipe_h->lock);
+  buffer = gst_buffer_make_writable (buffer);
 
-  it = gst_bin_iterate_elements (GST_BIN (pipeline));
-  if (it != NULL) {
-    gboolean done = FALSE;
-    GValue item = G_VALUE_INIT;
-    GObject *obj;
-    gchar *name;
+  /* the meta of upstream filter is copied to the output, update it. */
+  meta = gst_buffer_get_reference_timestamp_meta (buffer, qos->caps);
+  if (meta)
+    meta->timestamp = (GstClockTime) now * GST_USECOND;
+  else
+    gst_buffer_add_reference_timestamp_meta (buffer, qos->caps,
+        (GstClockTime) now * GST_USECOND, GST_CLOCK_TIME_NONE);
 
-    /* Fill in the hashtable, "namednodes" with named Elements */
-    while (!done) {
-      switch (gst_iterator_next (it, &item)) {
-        case GST_ITERATOR_OK:
-          obj = g_value_get_object (&item);
+  return buffer;
+}
 
-          if (GST_IS_ELEMENT (obj)) {
-            GstElement *elem = GST_ELEMENT (obj);
-            GstPluginFeature *feature =
-                GST_PLUGIN_FEATURE (gst_element_get_factory (elem));
-            const gchar *plugin_name =
-                gst_plugin_feature_get_plugin_name (feature);
-            const gchar *element_name = gst_plugin_feature_get_name (feature);
-
-            /* validate the availability of the plugin */
-            if (!is_internal && _ml_check_plugin_availability (plugin_name,
-                    element_name) != ML_ERROR_NONE) {
-              status = ML_ERROR_NOT_SUPPORTED;
-              done = TRUE;
-              break;
-            }
+/**
+ * @brief Internal function to get the queueing delay of the frame before tensor_filter (us).
+ * @details The delay is the time since the frame is out of the upstream filter with QoS, or pushed into src element.
+ *          For the other sources, it is the lateness of the frame against the pipeline clock.
+ */
+static guint64
+qos_get_queue_delay (ml_pipeline_qos_ctrl_s * qos, GstPad * pad,
+    GstBuffer * buffer, gint64 now)
+{
+  GstElement *element;
+  GstClock *clock;
+  GstEvent *event;
+  const GstSegment *segment;
+  GstClockTime running_time, clock_time;
+  GstReferenceTimestampMeta *meta;
+  guint64 ingress, age = 0;
+
+  meta = gst_buffer_get_reference_timestamp_meta (buffer, qos->caps);
+
+  if (meta) {
+    ingress = meta->timestamp / GST_USECOND;
+    return ((guint64) now > ingress) ? ((guint64) now - ingress) : 0;
+  }
 
-            name = gst_element_get_name (elem);
-            if (name != NULL) {
-              ml_pipeline_element_e element_type = ML_PIPELINE_ELEMENT_UNKNOWN;
-
-              if (g_str_equal (element_name, "tensor_sink")) {
-                element_type = ML_PIPELINE_ELEMENT_SINK;
-              } else if (g_str_equal (element_name, "appsrc")) {
-                element_type = ML_PIPELINE_ELEMENT_APP_SRC;
-              } else if (g_str_equal (element_name, "appsink")) {
-                element_type = ML_PIPELINE_ELEMENT_APP_SINK;
-              } else if (g_str_equal (element_name, "valve")) {
-                element_type = ML_PIPELINE_ELEMENT_VALVE;
-              } else if (g_str_equal (element_name, "input-selector")) {
-                element_type = ML_PIPELINE_ELEMENT_SWITCH_INPUT;
-              } else if (g_str_equal (element_name, "output-selector")) {
-                element_type = ML_PIPELINE_ELEMENT_SWITCH_OUTPUT;
-              } else if (g_str_equal (element_name, "tensor_if") ||
-                  g_str_equal (element_name, "tensor_filter")) {
-                element_type = ML_PIPELINE_ELEMENT_COMMON;
-              } else {
-                /** @todo CRITICAL HANDLE THIS! */
-              }
+  if (get_ingress_time (buffer, &ingress))
+    return ((guint64) now > ingress) ? ((guint64) now - ingress) : 0;
 
-              /* check 'sync' property in sink element */
-              if (element_type == ML_PIPELINE_ELEMENT_SINK ||
-                  element_type == ML_PIPELINE_ELEMENT_APP_SINK) {
-                gboolean sync = FALSE;
+  /* live sources, compare the running time of the frame with the clock */
+  if (!GST_BUFFER_PTS_IS_VALID (buffer))
+    return 0;
 
-                g_object_get (G_OBJECT (elem), "sync", &sync, NULL);
-                if (sync) {
-                  _ml_logw
-                      ("It is recommended to apply 'sync=false' property to a sink element in most AI applications. Otherwise, inference results of large neural networks will be frequently dropped by the synchronization mechanism at the sink element.");
-                }
-              }
+  event = gst_pad_get_sticky_event (pad, GST_EVENT_SEGMENT, 0);
+  if (event == NULL)
+    return 0;
 
-              if (element_type != ML_PIPELINE_ELEMENT_UNKNOWN) {
-                ml_pipeline_element *e;
-
-                e = construct_element (elem, pipe_h, name, element_type);
-                if (e != NULL) {
-                  if (g_str_equal (element_name, "tensor_if"))
-                    process_tensor_if_option (e);
-                  else if (g_str_equal (element_name, "tensor_filter"))
-                    process_tensor_filter_option (e);
-
-                  g_hash_table_insert (pipe_h->namednodes, g_strdup (name), e);
-                } else {
-                  /* allocation failure */
-                  status = ML_ERROR_OUT_OF_MEMORY;
-                  done = TRUE;
-                }
-              }
+  element = gst_pad_get_parent_element (pad);
+  clock = (element) ? gst_element_get_clock (element) : NULL;
 
-              g_free (name);
-            }
-          }
+  if (clock) {
+    gst_event_parse_segment (event, &segment);
+    running_time = gst_segment_to_running_time (segment, GST_FORMAT_TIME,
+        GST_BUFFER_PTS (buffer));
+    clock_time = gst_clock_get_time (clock) -
+        gst_element_get_base_time (element);
 
-          g_value_reset (&item);
-          break;
-        case GST_ITERATOR_RESYNC:
-        case GST_ITERATOR_ERROR:
-          _ml_logw
-              ("There is an error or a resync-event while inspecting a pipeline. However, we can still execute the pipeline.");
-          /* fallthrough */
-        case GST_ITERATOR_DONE:
-          done = TRUE;
-      }
-    }
+    if (GST_CLOCK_TIME_IS_VALID (running_time) && clock_time > running_time)
+      age = (clock_time - running_time) / GST_USECOND;
 
-    g_value_unset (&item);
-    /** @todo CRITICAL check the validity of elem=item registered in e */
-    gst_iterator_free (it);
+    gst_object_unref (clock);
   }
 
-  g_mutex_unlock (&pipe_h->lock);
-  return status;
+  if (element)
+    gst_object_unref (element);
+  gst_event_unref (event);
+
+  return age;
 }
 
 /**
- * @brief Internal function to construct the pipeline.
- * If is_internal is true, this will ignore the permission in Tizen.
+ * @brief Pad probe to drop the late frames before tensor_filter.
  */
-static int
-construct_pipeline_internal (const char *pipeline_description,
-    ml_pipeline_state_cb cb, void *user_data, ml_pipeline_h * pipe,
-    gboolean is_internal)
+static GstPadProbeReturn
+cb_qos_pad_probe (GstPad * pad, GstPadProbeInfo * info, gpointer user_data)
 {
-  GError *err = NULL;
-  GstElement *pipeline;
-  gchar *description = NULL;
-  int status = ML_ERROR_NONE;
+  ml_pipeline_qos_ctrl_s *qos = user_data;
+  GstBuffer *buffer = GST_PAD_PROBE_INFO_BUFFER (info);
+  gint64 now = g_get_monotonic_time ();
+  guint64 delay = 0, budget;
+  gboolean drop = FALSE;
 
-  ml_pipeline *pipe_h;
+  if (GST_PAD_IS_SINK (pad))
+    delay = qos_get_queue_delay (qos, pad, buffer, now);
+
+  g_mutex_lock (&qos->lock);
+
+  if (GST_PAD_IS_SINK (pad)) {
+    qos->frames_in++;
+
+    /**
+     * The frame should arrive at the filter output in the max latency after it is ready for the filter.
+     * The delay of upstream filters is not counted, each filter drops the frames queued for itself only.
+     * The frame which waits less than half of the processing time is not queued,
+     * pass it to keep the filter working even if the processing time exceeds the max latency.
+     */
+    if (qos->max_latency > qos->process_time)
+      budget = MAX (qos->max_latency - qos->process_time,
+          qos->process_time / 2);
+    else
+      budget = qos->process_time / 2;
+
+    drop = (delay > budget);
+
+    qos->drop_rate += ((drop ? 1.0 : 0.0) - qos->drop_rate) / QOS_WEIGHT;
+    if (drop)
+      qos->dropped++;
+    else
+      qos->in_time = now;
+  } else if (qos->in_time > 0) {
+    guint64 sample = (guint64) (now - qos->in_time);
+
+    if (qos->process_time == 0)
+      qos->process_time = sample;
+    else
+      qos->process_time += ((gint64) sample - (gint64) qos->process_time) /
+          QOS_WEIGHT;
+    qos->in_time = 0;
+  }
+
+  g_mutex_unlock (&qos->lock);
+
+  if (drop)
+    return GST_PAD_PROBE_DROP;
+
+  /* the downstream filter measures its own delay from this time, stamp the output only. */
+  if (GST_PAD_IS_SRC (pad))
+    GST_PAD_PROBE_INFO_DATA (info) = qos_stamp_out_time (qos, buffer, now);
+
+  return GST_PAD_PROBE_OK;
+}
+
+/**
+ * @brief Internal function to add the pad probe of QoS.
+ */
+static gboolean
+qos_add_pad_probe (GstElement * element, GstPad * pad, gpointer user_data)
+{
+  ml_pipeline_element *e = user_data;
+  ml_pipeline_stats_probe_s *probe;
+
+  probe = g_new0 (ml_pipeline_stats_probe_s, 1);
+  probe->pad = gst_object_ref (pad);
+
+  /* the probe holds the QoS controller until it is removed */
+  g_atomic_int_inc (&e->qos->ref_count);
+  probe->probe_id = gst_pad_add_probe (pad, GST_PAD_PROBE_TYPE_BUFFER,
+      cb_qos_pad_probe, e->qos, qos_unref);
+
+  e->qos_probes = g_slist_prepend (e->qos_probes, probe);
+  return TRUE;
+}
+
+/**
+ * @brief Internal function to start the QoS of an element.
+ * @note This function should be called with element lock.
+ */
+static void
+set_element_qos (ml_pipeline_element * e, guint64 max_latency)
+{
+  ml_pipeline_qos_ctrl_s *qos;
+
+  qos = g_new0 (ml_pipeline_qos_ctrl_s, 1);
+  qos->ref_count = 1;
+  qos->max_latency = max_latency;
+  g_mutex_init (&qos->lock);
+
+  /* get the caps once, the pad probes look up the meta with it for each frame */
+  qos->caps = gst_static_caps_get (&qos_caps);
+
+  e->qos = qos;
+  gst_element_foreach_pad (e->element, qos_add_pad_probe, e);
+}
+
+/**
+ * @brief Internal function to stop the QoS of an element.
+ * @note This function should be called with element lock.
+ */
+static void
+clear_element_qos (ml_pipeline_element * e)
+{
+  GSList *l;
+
+  for (l = e->qos_probes; l; l = l->next) {
+    ml_pipeline_stats_probe_s *probe = l->data;
+
+    /* the QoS controller is released when the probe is not in use */
+    gst_pad_remove_probe (probe->pad, probe->probe_id);
+    gst_object_unref (probe->pad);
+    g_free (probe);
+  }
+
+  g_slist_free (e->qos_probes);
+  e->qos_probes = NULL;
+
+  qos_unref (e->qos);
+  e->qos = NULL;
+}
+
+/**
+ * @brief Internal function to get the tensors info from the element caps.
+ */
+static gboolean
+get_tensors_info_from_caps (GstCaps * caps, ml_tensors_info_s * info,
+    gboolean * is_flexible)
+{
+  GstStructure *s;
+  GstTensorsConfig config;
+  guint i, n_caps;
+  gboolean found = FALSE;
+
+  _ml_tensors_info_initialize (info);
+  n_caps = gst_caps_get_size (caps);
+
+  for (i = 0; i < n_caps; i++) {
+    s = gst_caps_get_structure (caps, i);
+    found = gst_tensors_config_from_structure (&config, s);
+
+    if (found) {
+      _ml_tensors_info_copy_from_gst (info, &config.info);
+      *is_flexible = gst_tensors_config_is_flexible (&config);
+      break;
+    }
+  }
+
+  return found;
+}
+
+/**
+ * @brief Handle a sink element for registered ml_pipeline_sink_cb
+ */
+static void
+cb_sink_event (GstElement * e, GstBuffer * b, gpointer user_data)
+{
+  ml_pipeline_element *elem = user_data;
+
+  /** @todo CRITICAL if the pipeline is being killed, don't proceed! */
+  GstMemory *mem[ML_TENSOR_SIZE_LIMIT];
+  GstMapInfo map[ML_TENSOR_SIZE_LIMIT];
+  guint i;
+  guint num_mems;
+  GList *l;
+  ml_tensors_data_s *_data = NULL;
+  ml_tensors_info_s *_info;
+  ml_tensors_info_s info_flex_tensor;
+  size_t total_size = 0;
+  int status;
+
+  /* the tensors info of flexible tensor is used in this thread only */
+  memset (&info_flex_tensor, 0, sizeof (ml_tensors_info_s));
+  info_flex_tensor.nolock = 1;
+
+  /* end-to-end latency of the frame from src element */
+  if (elem->latency)
+    update_sink_latency (elem->latency, b);
+
+  _info = &elem->tensors_info;
+  num_mems = gst_buffer_n_memory (b);
+
+  if (num_mems > ML_TENSOR_SIZE_LIMIT) {
+    _ml_loge_ratelimited
+        ("Number of memory chunks in a GstBuffer exceed the limit: %u > %u",
+        num_mems, ML_TENSOR_SIZE_LIMIT);
+    return;
+  }
+
+  /* set tensor data */
+  status =
+      _ml_tensors_data_create_no_alloc (NULL, (ml_tensors_data_h *) & _data);
+  if (status != ML_ERROR_NONE) {
+    _ml_loge_ratelimited
+        ("Failed to allocate memory for tensors data in sink callback.");
+    return;
+  }
+
+  _data->num_tensors = num_mems;
+  for (i = 0; i < num_mems; i++) {
+    mem[i] = gst_buffer_peek_memory (b, i);
+    if (!gst_memory_map (mem[i], &map[i], GST_MAP_READ)) {
+      nns_loge ("Failed to map the output in sink '%s' callback", elem->name);
+      num_mems = i;
+      goto error;
+    }
+
+    _data->tensors[i].tensor = map[i].data;
+    _data->tensors[i].size = map[i].size;
+
+    total_size += map[i].size;
+  }
+
+  g_mutex_lock (&elem->lock);
+
+  /** @todo This assumes that padcap is static */
+  if (elem->sink == NULL) {
+    /* Get the sink-pad-cap */
+    elem->sink = gst_element_get_static_pad (elem->element, "sink");
+
+    if (elem->sink) {
+      /* sinkpadcap available (negotiated) */
+      GstCaps *caps = gst_pad_get_current_caps (elem->sink);
+
+      if (caps) {
+        gboolean flexible = FALSE;
+        gboolean found = get_tensors_info_from_caps (caps, _info, &flexible);
+
+        gst_caps_unref (caps);
+
+        if (found) {
+          elem->size = 0;
+
+          /* cannot get exact info from caps */
+          if (flexible) {
+            elem->is_flexible_tensor = TRUE;
+            goto send_cb;
+          }
+
+          if (_info->num_tensors != num_mems) {
+            _ml_loge_ratelimited
+                ("The sink event of [%s] cannot be handled because the number of tensors mismatches.",
+                elem->name);
+
+            gst_object_unref (elem->sink);
+            elem->sink = NULL;
+            goto error;
+          }
+
+          for (i = 0; i < _info->num_tensors; i++) {
+            size_t sz = _ml_tensor_info_get_size (&_info->info[i]);
+
+            /* Not configured, yet. */
+            if (sz == 0)
+              _ml_loge_ratelimited ("The caps for sink(%s) is not configured.",
+                  elem->name);
+
+            if (sz != _data->tensors[i].size) {
+              _ml_loge_ratelimited
+                  ("The sink event of [%s] cannot be handled because the tensor dimension mismatches.",
+                  elem->name);
+
+              gst_object_unref (elem->sink);
+              elem->sink = NULL;
+              goto error;
+            }
+
+            elem->size += sz;
+          }
+        } else {
+          gst_object_unref (elem->sink);
+          elem->sink = NULL;    /* It is not valid */
+          goto error;
+          /** @todo What if it keeps being "NULL"? Exception handling at 2nd frame? */
+        }
+      }
+    }
+  }
+
+  /* Get the data! */
+  if (gst_buffer_get_size (b) != total_size ||
+      (elem->size > 0 && total_size != elem->size)) {
+    _ml_loge_ratelimited
+        ("The buffersize mismatches. All the three values must be the same: %zu, %zu, %zu",
+        total_size, elem->size, gst_buffer_get_size (b));
+    goto error;
+  }
+
+send_cb:
+  /* set info for flexible stream */
+  if (elem->is_flexible_tensor) {
+    GstTensorMetaInfo meta;
+    GstTensorsInfo gst_info;
+    gsize hsize;
+
+    gst_tensors_info_init (&gst_info);
+    gst_info.num_tensors = num_mems;
+    _info = &info_flex_tensor;
+
+    /* handle header for flex tensor */
+    for (i = 0; i < num_mems; i++) {
+      gst_tensor_meta_info_parse_header (&meta, map[i].data);
+      hsize = gst_tensor_meta_info_get_header_size (&meta);
+
+      gst_tensor_meta_info_convert (&meta, &gst_info.info[i]);
+
+      _data->tensors[i].tensor = map[i].data + hsize;
+      _data->tensors[i].size = map[i].size - hsize;
+    }
+
+    _ml_tensors_info_copy_from_gst (_info, &gst_info);
+  }
+
+  /* the callbacks may get the latency with the element lock held */
+  g_atomic_pointer_set (&elem->sink_cb_thread, g_thread_self ());
+  elem->sink_buffer = b;
+
+  /* Iterate e->handles, pass the data to them */
+  for (l = elem->handles; l != NULL; l = l->next) {
+    ml_pipeline_sink_cb callback;
+    ml_pipeline_common_elem *sink = l->data;
+    if (sink->callback_info == NULL)
+      continue;
+
+    callback = sink->callback_info->sink_cb;
+    if (callback)
+      callback (_data, _info, sink->callback_info->pdata);
+
+    /** @todo Measure time. Warn if it takes long. Kill if it takes too long. */
+  }
+
+  elem->sink_buffer = NULL;
+  g_atomic_pointer_set (&elem->sink_cb_thread, NULL);
+
+error:
+  g_mutex_unlock (&elem->lock);
+
+  for (i = 0; i < num_mems; i++) {
+    gst_memory_unmap (mem[i], &map[i]);
+  }
+
+  _ml_tensors_info_free (&info_flex_tensor);
+  _ml_tensors_data_destroy_internal (_data, FALSE);
+  _data = NULL;
+
+  return;
+}
+
+/**
+ * @brief Handle a appsink element for registered ml_pipeline_sink_cb
+ */
+static GstFlowReturn
+cb_appsink_new_sample (GstElement * e, gpointer user_data)
+{
+  GstSample *sample;
+  GstBuffer *buffer;
+
+  /* get the sample from appsink */
+  sample = gst_app_sink_pull_sample (GST_APP_SINK (e));
+  buffer = gst_sample_get_buffer (sample);
+
+  cb_sink_event (e, buffer, user_data);
+
+  gst_sample_unref (sample);
+  return GST_FLOW_OK;
+}
+
+/**
+ * @brief Internal function to wait for EOS message of the pipeline.
+ * @return TRUE if the pipeline is EOS, FALSE if timed out.
+ */
+static gboolean
+wait_pipeline_eos (ml_pipeline * p, guint timeout_ms)
+{
+  gint64 end_time;
+  gboolean eos;
+
+  end_time = g_get_monotonic_time () + timeout_ms * G_TIME_SPAN_MILLISECOND;
+
+  g_mutex_lock (&p->state_lock);
+  while (!p->isEOS) {
+    if (!g_cond_wait_until (&p->state_cond, &p->state_lock, end_time))
+      break;
+  }
+  eos = p->isEOS;
+  g_mutex_unlock (&p->state_lock);
+
+  return eos;
+}
+
+/**
+ * @brief Internal function to wait until the pipeline state is changed from PLAYING.
+ * @return TRUE if the pipeline is not playing, FALSE if timed out.
+ */
+static gboolean
+wait_pipeline_paused (ml_pipeline * p, guint timeout_ms)
+{
+  gint64 end_time;
+  gboolean paused;
+
+  end_time = g_get_monotonic_time () + timeout_ms * G_TIME_SPAN_MILLISECOND;
+
+  g_mutex_lock (&p->state_lock);
+  while (p->pipe_state == ML_PIPELINE_STATE_PLAYING) {
+    if (!g_cond_wait_until (&p->state_cond, &p->state_lock, end_time))
+      break;
+  }
+  paused = (p->pipe_state != ML_PIPELINE_STATE_PLAYING);
+  g_mutex_unlock (&p->state_lock);
+
+  return paused;
+}
+
+/**
+ * @brief Internal function to notify the result of asynchronous start.
+ * @note The callback is called once, the first caller clears the callback.
+ */
+static void
+complete_pipeline_start (ml_pipeline * p, int status)
+{
+  ml_pipeline_async_cb cb;
+  void *user_data;
+
+  g_mutex_lock (&p->state_lock);
+  cb = p->start_cb;
+  user_data = p->start_user_data;
+  p->start_cb = NULL;
+  p->start_user_data = NULL;
+  g_mutex_unlock (&p->state_lock);
+
+  if (cb)
+    cb (status, user_data);
+}
+
+/**
+ * @brief Callback for bus message.
+ */
+static void
+cb_bus_sync_message (GstBus * bus, GstMessage * message, gpointer user_data)
+{
+  ml_pipeline *pipe_h;
+
+  pipe_h = (ml_pipeline *) user_data;
+
+  if (pipe_h == NULL)
+    return;
+
+  switch (GST_MESSAGE_TYPE (message)) {
+    case GST_MESSAGE_EOS:
+      g_mutex_lock (&pipe_h->state_lock);
+      pipe_h->isEOS = TRUE;
+      g_cond_broadcast (&pipe_h->state_cond);
+      g_mutex_unlock (&pipe_h->state_lock);
+      break;
+    case GST_MESSAGE_ERROR:
+      /* failed to start the pipeline */
+      complete_pipeline_start (pipe_h, ML_ERROR_STREAMS_PIPE);
+      break;
+    case GST_MESSAGE_STATE_CHANGED:
+      if (GST_MESSAGE_SRC (message) == GST_OBJECT_CAST (pipe_h->element)) {
+        GstState old_state, new_state;
+
+        gst_message_parse_state_changed (message, &old_state, &new_state, NULL);
+
+        g_mutex_lock (&pipe_h->state_lock);
+        pipe_h->pipe_state = (ml_pipeline_state_e) new_state;
+        g_cond_broadcast (&pipe_h->state_cond);
+        g_mutex_unlock (&pipe_h->state_lock);
+
+        _ml_logd ("The pipeline state changed from %s to %s.",
+            gst_element_state_get_name (old_state),
+            gst_element_state_get_name (new_state));
+
+        if (pipe_h->state_cb.cb) {
+          pipe_h->state_cb.cb (pipe_h->pipe_state, pipe_h->state_cb.user_data);
+        }
+
+        if (new_state == GST_STATE_PLAYING)
+          complete_pipeline_start (pipe_h, ML_ERROR_NONE);
+      }
+      break;
+    default:
+      break;
+  }
+}
+
+/**
+ * @brief Internal function to find the handle of element with the id.
+ * @details The id is unique in the element, thus the released handle is not found even if its address is reused by new handle.
+ * @note This function should be called with element lock.
+ */
+static ml_pipeline_common_elem *
+find_element_handle (ml_pipeline_element * elem, guint32 id)
+{
+  GList *l;
+
+  for (l = elem->handles; l; l = l->next) {
+    ml_pipeline_common_elem *item = (ml_pipeline_common_elem *) l->data;
+
+    if (item->id == id)
+      return item;
+  }
+
+  return NULL;
+}
+
+/**
+ * @brief Clean up each element of the pipeline.
+ */
+static void
+free_element_handle (gpointer data)
+{
+  ml_pipeline_common_elem *item = (ml_pipeline_common_elem *) data;
+
+  if (item) {
+    ml_pipeline_element *elem = item->element;
+
+    /* clear callbacks */
+    if (item->callback_info) {
+      item->callback_info->sink_cb = NULL;
+
+      if (elem->type == ML_PIPELINE_ELEMENT_APP_SRC) {
+        GstAppSrcCallbacks appsrc_cb = { 0, };
+        gst_app_src_set_callbacks (GST_APP_SRC (elem->element), &appsrc_cb,
+            NULL, NULL);
+
+        /* no more flow notification, wake up the waiting push. */
+        elem->src_enough_data = FALSE;
+        g_cond_broadcast (&elem->src_cond);
+      }
+
+      g_free (item->callback_info);
+      item->callback_info = NULL;
+    }
+
+    g_free (item);
+  }
+}
+
+/**
+ * @brief Private function for ml_pipeline_destroy, cleaning up nodes in namednodes
+ */
+static void
+cleanup_node (gpointer data)
+{
+  ml_pipeline_element *e = data;
+  gboolean eos = FALSE;
+
+  g_mutex_lock (&e->lock);
+
+  if (e->type == ML_PIPELINE_ELEMENT_APP_SRC) {
+    /* the push does not hold the pipeline lock, wake it up and wait for it */
+    e->src_closing = TRUE;
+    g_cond_broadcast (&e->src_cond);
+
+    while (e->src_users > 0)
+      g_cond_wait (&e->src_cond, &e->lock);
+  }
+
+  /** @todo CRITICAL. Stop the handle callbacks if they are running/ready */
+  if (e->handle_id > 0) {
+    g_signal_handler_disconnect (e->element, e->handle_id);
+    e->handle_id = 0;
+  }
+
+  /* clear all handles first */
+  if (e->handles)
+    g_list_free_full (e->handles, free_element_handle);
+  e->handles = NULL;
+
+  if (e->type == ML_PIPELINE_ELEMENT_APP_SRC) {
+    /* the bus callback updates the flag with the state lock */
+    g_mutex_lock (&e->pipe->state_lock);
+    eos = e->pipe->isEOS;
+    g_mutex_unlock (&e->pipe->state_lock);
+  }
+
+  if (e->type == ML_PIPELINE_ELEMENT_APP_SRC && !eos) {
+    /** to push EOS event, the pipeline should be in PLAYING state */
+    gst_element_set_state (e->pipe->element, GST_STATE_PLAYING);
+
+    if (gst_app_src_end_of_stream (GST_APP_SRC (e->element)) != GST_FLOW_OK) {
+      _ml_logw ("Failed to set EOS in %s", e->name);
+    }
+    g_mutex_unlock (&e->lock);
+    /* the bus message wakes up the waiting thread */
+    if (!wait_pipeline_eos (e->pipe, EOS_MESSAGE_TIME_LIMIT)) {
+      _ml_loge ("Failed to get EOS message");
+    }
+    g_mutex_lock (&e->lock);
+  }
+
+  if (e->custom_destroy) {
+    e->custom_destroy (e->custom_data, e);
+  }
+
+  g_free (e->name);
+  clear_element_stats (e);
+  clear_element_qos (e);
+  clear_sink_latency (e);
+  clear_src_caps (e);
+  if (e->sink)
+    gst_object_unref (e->sink);
+
+  /* the frames in the pipeline still hold the pool */
+  src_pool_unref (e->src_pool);
+  e->src_pool = NULL;
+
+  g_mutex_unlock (&e->lock);
+  g_mutex_clear (&e->lock);
+  g_cond_clear (&e->src_cond);
+
+  g_free (e);
+}
+
+/**
+ * @brief Private function to release the pipeline resources
+ */
+static void
+cleanup_resource (gpointer data)
+{
+  pipeline_resource_s *res = data;
+
+  /* check resource type and free data */
+  if (g_str_has_prefix (res->type, "tizen")) {
+    release_tizen_resource (res->handle, res->type);
+  }
+
+  g_free (res->type);
+  g_free (res);
+}
+
+/**
+ * @brief Converts predefined element in pipeline description.
+ */
+static int
+convert_element (ml_pipeline_h pipe, const gchar * description, gchar ** result,
+    gboolean is_internal)
+{
+  gchar *converted;
+  int status = ML_ERROR_NONE;
+
+  g_return_val_if_fail (pipe, ML_ERROR_INVALID_PARAMETER);
+  g_return_val_if_fail (description && result, ML_ERROR_INVALID_PARAMETER);
+
+  /* init null */
+  *result = NULL;
+
+  converted = g_strdup (description);
+
+  /* convert pre-defined element for Tizen */
+  status = convert_tizen_element (pipe, &converted, is_internal);
+
+  if (status == ML_ERROR_NONE) {
+    _ml_logd ("Converted pipeline: %s", converted);
+    *result = converted;
+  } else {
+    g_free (converted);
+  }
+
+  return status;
+}
+
+/**
+ * @brief The property of tensor_filter to share the model instance.
+ */
+#define ML_PIPELINE_SHARED_FILTER_KEY "shared-tensor-filter-key"
+
+/**
+ * @brief The value of shared key to generate the key from the properties of tensor_filter.
+ */
+#define ML_PIPELINE_SHARED_FILTER_KEY_AUTO "auto"
+
+/**
+ * @brief The properties of tensor_filter to identify the model instance.
+ */
+static const gchar *ml_pipeline_shared_filter_props[] = {
+  "framework", "model", "accelerator", "custom",
+  "input", "inputtype", "inputname", "inputlayout",
+  "output", "outputtype", "outputname", "outputlayout", NULL
+};
+
+/**
+ * @brief Internal function to set the key of shared model to tensor_filter.
+ * @note The filters with the same framework, model, accelerator, custom option, and input and output information share the model.
+ */
+static void
+set_tensor_filter_share_key (ml_pipeline_element * e)
+{
+  GObject *obj = G_OBJECT (e->element);
+  GObjectClass *class = G_OBJECT_GET_CLASS (obj);
+  GString *key;
+  gchar *value;
+  guint i;
+
+  key = g_string_new ("ml-pipeline");
+
+  for (i = 0; ml_pipeline_shared_filter_props[i]; i++) {
+    GParamSpec *pspec;
+
+    pspec = g_object_class_find_property (class,
+        ml_pipeline_shared_filter_props[i]);
+    if (pspec == NULL || pspec->value_type != G_TYPE_STRING)
+      continue;
+
+    value = NULL;
+    g_object_get (obj, ml_pipeline_shared_filter_props[i], &value, NULL);
+    g_string_append_printf (key, ":%s", value ? value : "");
+    g_free (value);
+  }
+
+  g_object_set (obj, ML_PIPELINE_SHARED_FILTER_KEY, key->str, NULL);
+  _ml_logd ("The tensor_filter %s shares the model with key %s.", e->name,
+      key->str);
+
+  g_string_free (key, TRUE);
+}
+
+/**
+ * @brief Internal function to update the key of shared model when the property of tensor_filter is changed.
+ * @note The key is used when the filter opens the model, the filter with the model opened keeps the current model instance.
+ */
+static void
+update_tensor_filter_share_key (ml_pipeline_element * e, const gchar * name)
+{
+  gchar *key = NULL;
+  guint i;
+
+  if (g_str_equal (name, ML_PIPELINE_SHARED_FILTER_KEY)) {
+    g_object_get (G_OBJECT (e->element), ML_PIPELINE_SHARED_FILTER_KEY, &key,
+        NULL);
+    e->share_model = (g_strcmp0 (key, ML_PIPELINE_SHARED_FILTER_KEY_AUTO) == 0);
+    g_free (key);
+  } else if (e->share_model) {
+    for (i = 0; ml_pipeline_shared_filter_props[i]; i++) {
+      if (g_str_equal (name, ml_pipeline_shared_filter_props[i]))
+        break;
+    }
+
+    if (ml_pipeline_shared_filter_props[i] == NULL)
+      return;
+  } else {
+    return;
+  }
+
+  if (e->share_model)
+    set_tensor_filter_share_key (e);
+}
+
+/**
+ * @brief Handle tensor-filter options.
+ */
+static void
+process_tensor_filter_option (ml_pipeline_element * e)
+{
+  gchar *fw = NULL;
+  gchar *model = NULL;
+  gchar *key = NULL;
+  pipe_custom_data_s *custom_data;
+
+  g_object_get (G_OBJECT (e->element), "framework", &fw, "model", &model, NULL);
+
+  if (g_object_class_find_property (G_OBJECT_GET_CLASS (e->element),
+          ML_PIPELINE_SHARED_FILTER_KEY)) {
+    g_object_get (G_OBJECT (e->element), ML_PIPELINE_SHARED_FILTER_KEY, &key,
+        NULL);
+  }
+
+  if (fw && g_ascii_strcasecmp (fw, "custom-easy") == 0) {
+    /* ref to tensor-filter custom-easy handle. */
+    custom_data = pipe_custom_find_data (PIPE_CUSTOM_TYPE_FILTER, model);
+    if (custom_data) {
+      ml_pipeline_custom_filter_ref (custom_data->handle);
+
+      e->custom_destroy = pipe_custom_destroy_cb;
+      e->custom_data = custom_data;
+    }
+  } else if (g_strcmp0 (key, ML_PIPELINE_SHARED_FILTER_KEY_AUTO) == 0) {
+    /* the model is loaded when the pipeline is paused, set the key before. */
+    e->share_model = TRUE;
+    set_tensor_filter_share_key (e);
+  }
+
+  g_free (fw);
+  g_free (model);
+  g_free (key);
+}
+
+/**
+ * @brief Handle tensor-if options.
+ */
+static void
+process_tensor_if_option (ml_pipeline_element * e)
+{
+  gint cv = 0;
+  gchar *cv_option = NULL;
+  pipe_custom_data_s *custom_data;
+
+  g_object_get (G_OBJECT (e->element), "compared-value", &cv,
+      "compared-value-option", &cv_option, NULL);
+
+  if (cv == 5) {
+    /* cv is TIFCV_CUSTOM, ref to tensor-if custom handle. */
+    custom_data = pipe_custom_find_data (PIPE_CUSTOM_TYPE_IF, cv_option);
+    if (custom_data) {
+      ml_pipeline_if_custom_ref (custom_data->handle);
+
+      e->custom_destroy = pipe_custom_destroy_cb;
+      e->custom_data = custom_data;
+    }
+  }
+
+  g_free (cv_option);
+}
+
+/**
+ * @brief Internal function to check the availability and get the type of element handle.
+ */
+static int
+inspect_element (GstElement * elem, gboolean is_internal,
+    ml_pipeline_element_e * type, ml_pipeline_element_option_cb * option)
+{
+  GstPluginFeature *feature =
+      GST_PLUGIN_FEATURE (gst_element_get_factory (elem));
+  const gchar *plugin_name = gst_plugin_feature_get_plugin_name (feature);
+  const gchar *element_name = gst_plugin_feature_get_name (feature);
+
+  *type = ML_PIPELINE_ELEMENT_UNKNOWN;
+  *option = NULL;
+
+  /* validate the availability of the plugin */
+  if (!is_internal && _ml_check_plugin_availability (plugin_name,
+          element_name) != ML_ERROR_NONE)
+    return ML_ERROR_NOT_SUPPORTED;
+
+  if (g_str_equal (element_name, "tensor_sink")) {
+    *type = ML_PIPELINE_ELEMENT_SINK;
+  } else if (g_str_equal (element_name, "appsrc")) {
+    *type = ML_PIPELINE_ELEMENT_APP_SRC;
+  } else if (g_str_equal (element_name, "appsink")) {
+    *type = ML_PIPELINE_ELEMENT_APP_SINK;
+  } else if (g_str_equal (element_name, "valve")) {
+    *type = ML_PIPELINE_ELEMENT_VALVE;
+  } else if (g_str_equal (element_name, "input-selector")) {
+    *type = ML_PIPELINE_ELEMENT_SWITCH_INPUT;
+  } else if (g_str_equal (element_name, "output-selector")) {
+    *type = ML_PIPELINE_ELEMENT_SWITCH_OUTPUT;
+  } else if (g_str_equal (element_name, "tensor_if")) {
+    *type = ML_PIPELINE_ELEMENT_COMMON;
+    *option = process_tensor_if_option;
+  } else if (g_str_equal (element_name, "tensor_filter")) {
+    *type = ML_PIPELINE_ELEMENT_COMMON;
+    *option = process_tensor_filter_option;
+  } else {
+    /** @todo CRITICAL HANDLE THIS! */
+  }
+
+  /* check 'sync' property in sink element */
+  if (*type == ML_PIPELINE_ELEMENT_SINK ||
+      *type == ML_PIPELINE_ELEMENT_APP_SINK) {
+    gboolean sync = FALSE;
+
+    g_object_get (G_OBJECT (elem), "sync", &sync, NULL);
+    if (sync) {
+      _ml_logw
+          ("It is recommended to apply 'sync=false' property to a sink element in most AI applications. Otherwise, inference results of large neural networks will be frequently dropped by the synchronization mechanism at the sink element.");
+    }
+  }
+
+  return ML_ERROR_NONE;
+}
+
+/**
+ * @brief Iterate elements and prepare element handle.
+ * @note If the template is given and compiled, this gets the type of element from the template without the validation.
+ *       If the template is not compiled yet, this adds the named elements to the template.
+ */
+static int
+iterate_element (ml_pipeline * pipe_h, GstElement * pipeline,
+    gboolean is_internal, ml_pipeline_template_s * tmpl)
+{
+  GstIterator *it = NULL;
+  int status = ML_ERROR_NONE;
+
+  g_return_val_if_fail (pipe_h && pipeline, ML_ERROR_INVALID_PARAMETER);
+
+  g_mutex_lock (&pipe_h->lock);
+
+  it = gst_bin_iterate_elements (GST_BIN (pipeline));
+  if (it != NULL) {
+    gboolean done = FALSE;
+    GValue item = G_VALUE_INIT;
+    GObject *obj;
+    gchar *name;
+
+    /* Fill in the hashtable, "namednodes" with named Elements */
+    while (!done) {
+      switch (gst_iterator_next (it, &item)) {
+        case GST_ITERATOR_OK:
+          obj = g_value_get_object (&item);
+
+          if (GST_IS_ELEMENT (obj)) {
+            GstElement *elem = GST_ELEMENT (obj);
+            ml_pipeline_element_e element_type = ML_PIPELINE_ELEMENT_UNKNOWN;
+            ml_pipeline_element_option_cb option = NULL;
+            ml_pipeline_template_node_s *node;
+
+            name = gst_element_get_name (elem);
+
+            if (tmpl && tmpl->compiled) {
+              /* the template is already validated, get the type of element. */
+              node = (name) ? g_hash_table_lookup (tmpl->nodes, name) : NULL;
+              if (node) {
+                element_type = node->type;
+                option = node->option;
+              }
+            } else {
+              status = inspect_element (elem, is_internal, &element_type,
+                  &option);
+              if (status != ML_ERROR_NONE) {
+                g_free (name);
+                done = TRUE;
+                break;
+              }
+
+              if (tmpl && name && element_type != ML_PIPELINE_ELEMENT_UNKNOWN) {
+                node = g_new0 (ml_pipeline_template_node_s, 1);
+                node->type = element_type;
+                node->option = option;
+
+                g_hash_table_insert (tmpl->nodes, g_strdup (name), node);
+              }
+            }
+
+            if (name != NULL && element_type != ML_PIPELINE_ELEMENT_UNKNOWN) {
+              ml_pipeline_element *e;
+
+              e = construct_element (elem, pipe_h, name, element_type);
+              if (e != NULL) {
+                if (option)
+                  option (e);
+
+                g_hash_table_insert (pipe_h->namednodes, g_strdup (name), e);
+              } else {
+                /* allocation failure */
+                status = ML_ERROR_OUT_OF_MEMORY;
+                done = TRUE;
+              }
+            }
+
+            g_free (name);
+          }
+
+          g_value_reset (&item);
+          break;
+        case GST_ITERATOR_RESYNC:
+        case GST_ITERATOR_ERROR:
+          _ml_logw
+              ("There is an error or a resync-event while inspecting a pipeline. However, we can still execute the pipeline.");
+          /* fallthrough */
+        case GST_ITERATOR_DONE:
+          done = TRUE;
+      }
+    }
+
+    g_value_unset (&item);
+    /** @todo CRITICAL check the validity of elem=item registered in e */
+    gst_iterator_free (it);
+  }
+
+  g_mutex_unlock (&pipe_h->lock);
+  return status;
+}
+
+/**
+ * @brief Internal function to create the pipeline handle.
+ */
+static ml_pipeline *
+create_pipeline_handle (void)
+{
+  ml_pipeline *pipe_h;
+
+  pipe_h = g_new0 (ml_pipeline, 1);
+  if (pipe_h == NULL) {
+    _ml_loge ("Failed to allocate handle for pipeline.");
+    return NULL;
+  }
+
+  g_mutex_init (&pipe_h->lock);
+  g_mutex_init (&pipe_h->state_lock);
+  g_cond_init (&pipe_h->state_cond);
+
+  pipe_h->isEOS = FALSE;
+  pipe_h->pipe_state = ML_PIPELINE_STATE_UNKNOWN;
+  pipe_h->namednodes =
+      g_hash_table_new_full (g_str_hash, g_str_equal, g_free, cleanup_node);
+
+  pipe_h->resources =
+      g_hash_table_new_full (g_str_hash, g_str_equal, g_free, cleanup_resource);
+
+  return pipe_h;
+}
+
+/**
+ * @brief Internal function to parse the pipeline description.
+ */
+static int
+parse_pipeline (const gchar * description, GstElement ** pipeline)
+{
+  GError *err = NULL;
+  GstElement *parsed;
+
+  parsed = gst_parse_launch (description, &err);
+
+  if (parsed == NULL || err) {
+    _ml_loge ("Cannot parse and launch the given pipeline = [%s]",
+        description);
+    _ml_loge ("  - Error Message: %s", (err) ? err->message : "unknown reason");
+    g_clear_error (&err);
+
+    if (parsed)
+      gst_object_unref (parsed);
+
+    return ML_ERROR_STREAMS_PIPE;
+  }
+
+  g_assert (GST_IS_PIPELINE (parsed));
+  *pipeline = parsed;
+  return ML_ERROR_NONE;
+}
+
+/**
+ * @brief Internal function to prepare the pipeline handle with parsed pipeline, and set the pipeline state to PAUSED.
+ */
+static int
+setup_pipeline (ml_pipeline * pipe_h, GstElement * pipeline,
+    ml_pipeline_state_cb cb, void *user_data, gboolean is_internal,
+    ml_pipeline_template_s * tmpl)
+{
+  int status;
+
+  pipe_h->element = pipeline;
+
+  /* bus and message callback */
+  pipe_h->bus = gst_element_get_bus (pipeline);
+  g_assert (pipe_h->bus);
+
+  gst_bus_enable_sync_message_emission (pipe_h->bus);
+  pipe_h->signal_msg = g_signal_connect (pipe_h->bus, "sync-message",
+      G_CALLBACK (cb_bus_sync_message), pipe_h);
+
+  /* state change callback */
+  pipe_h->state_cb.cb = cb;
+  pipe_h->state_cb.user_data = user_data;
+
+  /* iterate elements and prepare element handle */
+  status = iterate_element (pipe_h, pipeline, is_internal, tmpl);
+
+  /* finally set pipeline state to PAUSED */
+  if (status == ML_ERROR_NONE) {
+    status = ml_pipeline_stop ((ml_pipeline_h) pipe_h);
+
+    if (status == ML_ERROR_NONE) {
+      /**
+       * Let's wait until the pipeline state is changed to paused.
+       * Otherwise, the following APIs like 'set_property' may incur
+       * unintended behaviors. But, don't need to return any error
+       * even if this state change is not finished within the timeout,
+       * just replying on the caller.
+       */
+      gst_element_get_state (pipeline, NULL, NULL, 10 * GST_MSECOND);
+    }
+  }
+
+  return status;
+}
+
+/**
+ * @brief Internal function to construct the pipeline.
+ * If is_internal is true, this will ignore the permission in Tizen.
+ */
+static int
+construct_pipeline_internal (const char *pipeline_description,
+    ml_pipeline_state_cb cb, void *user_data, ml_pipeline_h * pipe,
+    gboolean is_internal)
+{
+  GstElement *pipeline;
+  gchar *description = NULL;
+  int status = ML_ERROR_NONE;
+
+  ml_pipeline *pipe_h;
+
+  check_feature_state ();
+
+  if (!pipe || !pipeline_description)
+    return ML_ERROR_INVALID_PARAMETER;
+
+  /* init null */
+  *pipe = NULL;
+
+  if ((status = _ml_initialize_gstreamer ()) != ML_ERROR_NONE)
+    return status;
+
+  /* prepare pipeline handle */
+  pipe_h = create_pipeline_handle ();
+  if (pipe_h == NULL)
+    return ML_ERROR_OUT_OF_MEMORY;
+
+  /* convert predefined element and launch the pipeline */
+  status =
+      convert_element ((ml_pipeline_h) pipe_h, pipeline_description,
+      &description, is_internal);
+  if (status != ML_ERROR_NONE)
+    goto failed;
+
+  status = parse_pipeline (description, &pipeline);
+  g_free (description);
+
+  if (status != ML_ERROR_NONE)
+    goto failed;
+
+  status = setup_pipeline (pipe_h, pipeline, cb, user_data, is_internal, NULL);
+
+failed:
+  if (status != ML_ERROR_NONE) {
+    /* failed to construct the pipeline */
+    ml_pipeline_destroy ((ml_pipeline_h) pipe_h);
+  } else {
+    *pipe = pipe_h;
+  }
+
+  return status;
+}
+
+/**
+ * @brief Construct the pipeline (more info in nnstreamer.h)
+ */
+int
+ml_pipeline_construct (const char *pipeline_description,
+    ml_pipeline_state_cb cb, void *user_data, ml_pipeline_h * pipe)
+{
+  /* not an internal pipeline construction */
+  return construct_pipeline_internal (pipeline_description, cb, user_data, pipe,
+      FALSE);
+}
+
+#if defined (__TIZEN__)
+/**
+ * @brief Construct the pipeline (Tizen internal, see nnstreamer-tizen-internal.h)
+ */
+int
+ml_pipeline_construct_internal (const char *pipeline_description,
+    ml_pipeline_state_cb cb, void *user_data, ml_pipeline_h * pipe)
+{
+  /* Tizen internal pipeline construction */
+  return construct_pipeline_internal (pipeline_description, cb, user_data, pipe,
+      TRUE);
+}
+#endif /* __TIZEN__ */
+
+/**
+ * @brief Internal function to release the parameter of pipeline template.
+ */
+static void
+free_template_param (gpointer data)
+{
+  ml_pipeline_template_param_s *param = data;
+
+  g_free (param->param);
+  g_free (param->element);
+  g_free (param->property);
+  g_free (param);
+}
+
+/**
+ * @brief Internal function to release the pipeline template.
+ */
+static void
+free_pipeline_template (ml_pipeline_template_s * tmpl)
+{
+  if (tmpl) {
+    g_free (tmpl->description);
+    g_hash_table_destroy (tmpl->nodes);
+    g_ptr_array_free (tmpl->params, TRUE);
+    g_free (tmpl);
+  }
+}
+
+/**
+ * @brief Internal function to get the end of the token in the pipeline description.
+ * @details The tokens are separated by the whitespace and link '!'. The quoted string is in a token, and the caps (e.g., "other/tensors, format=static") is a token until the next link.
+ */
+static const gchar *
+get_template_token_end (const gchar * str)
+{
+  const gchar *s;
+  gboolean caps, quoted = FALSE;
+
+  /* the media type of caps has '/' before the first '=' or whitespace */
+  caps = (str[strcspn (str, "=/! \t\r\n")] == '/');
+
+  for (s = str; *s != '\0'; s++) {
+    if (*s == '\\' && s[1] != '\0') {
+      s++;
+      continue;
+    }
+
+    if (*s == '"')
+      quoted = !quoted;
+    else if (!quoted && (*s == '!' || (!caps && g_ascii_isspace (*s))))
+      break;
+  }
+
+  return s;
+}
+
+/**
+ * @brief Internal function to set the element name of the parameters from the index.
+ */
+static int
+set_template_params_element (ml_pipeline_template_s * tmpl, guint index,
+    const gchar * name)
+{
+  ml_pipeline_template_param_s *param;
+  guint i;
+
+  for (i = index; i < tmpl->params->len; i++) {
+    param = g_ptr_array_index (tmpl->params, i);
+
+    if (name == NULL) {
+      _ml_loge
+          ("The element with the parameter '%s=${%s}' should have its name.",
+          param->property, param->param);
+      return ML_ERROR_INVALID_PARAMETER;
+    }
+
+    param->element = g_strdup (name);
+  }
+
+  return ML_ERROR_NONE;
+}
+
+/**
+ * @brief Internal function to find the parameters "property=${param}" and remove them from the description.
+ * @details The parameter belongs to the element which has the property in its token list, so the elements separated by whitespace without the link are distinguished.
+ */
+static int
+parse_template_params (ml_pipeline_template_s * tmpl, const char *description)
+{
+  ml_pipeline_template_param_s *param;
+  GRegex *prop_regex;
+  GMatchInfo *match;
+  GString *stripped;
+  const gchar *token, *token_end;
+  gchar *str, *property, *name = NULL;
+  gboolean in_element = FALSE;
+  guint index = 0;
+  gint start, end;
+  gsize pos = 0;
+  int status = ML_ERROR_NONE;
+
+  prop_regex = g_regex_new
+      ("^([A-Za-z0-9_-]+)=(?:\\$\\{([A-Za-z0-9_]+)\\}|\"?([^\"]*)\"?)$",
+      0, 0, NULL);
+  stripped = g_string_new (NULL);
+  token = description;
+
+  while (status == ML_ERROR_NONE) {
+    while (g_ascii_isspace (*token))
+      token++;
+
+    token_end = (*token == '!') ? token + 1 : get_template_token_end (token);
+    str = g_strndup (token, token_end - token);
+    match = NULL;
+
+    if (*token != '\0' && g_regex_match (prop_regex, str, 0, &match)) {
+      /* the property of current element */
+      property = g_match_info_fetch (match, 1);
+      g_match_info_fetch_pos (match, 2, &start, &end);
+
+      if (start >= 0) {
+        if (!in_element || g_str_equal (property, "name")) {
+          _ml_loge ("Cannot set the parameter to '%s'.", str);
+          status = ML_ERROR_INVALID_PARAMETER;
+          g_free (property);
+        } else {
+          param = g_new0 (ml_pipeline_template_param_s, 1);
+          param->property = property;
+          param->param = g_match_info_fetch (match, 2);
+          g_ptr_array_add (tmpl->params, param);
+
+          g_string_append_len (stripped, description + pos,
+              token - description - pos);
+          pos = token_end - description;
+        }
+      } else {
+        if (in_element && g_str_equal (property, "name")) {
+          g_free (name);
+          name = g_match_info_fetch (match, 3);
+        }
+        g_free (property);
+      }
+    } else {
+      /* the link, new element, caps or pad reference ends current element */
+      if (in_element) {
+        status = set_template_params_element (tmpl, index, name);
+        index = tmpl->params->len;
+        g_free (name);
+        name = NULL;
+      }
+
+      /* the pad reference (e.g., "tee.src_0") has no property */
+      in_element = (*token != '\0' && *token != '!' &&
+          strchr (str, '.') == NULL && strchr (str, '/') == NULL);
+    }
+
+    g_match_info_free (match);
+    g_free (str);
+
+    if (*token == '\0')
+      break;
+    token = token_end;
+  }
+
+  g_string_append (stripped, description + pos);
+  tmpl->description = g_string_free (stripped, FALSE);
+
+  g_free (name);
+  g_regex_unref (prop_regex);
+  return status;
+}
+
+/**
+ * @brief Internal function to find the value of the parameter.
+ */
+static const gchar *
+find_template_value (const char **names, const char **values,
+    unsigned int num_params, const gchar * param)
+{
+  guint i;
+
+  for (i = 0; i < num_params; i++) {
+    if (names[i] && g_str_equal (names[i], param))
+      return values[i];
+  }
+
+  return NULL;
+}
+
+/**
+ * @brief Internal function to check the parameter is in the template.
+ */
+static gboolean
+has_template_param (ml_pipeline_template_s * tmpl, const gchar * name)
+{
+  ml_pipeline_template_param_s *param;
+  guint i;
+
+  for (i = 0; i < tmpl->params->len; i++) {
+    param = g_ptr_array_index (tmpl->params, i);
+
+    if (g_str_equal (param->param, name))
+      return TRUE;
+  }
+
+  return FALSE;
+}
+
+/**
+ * @brief Creates the pipeline template (more info in nnstreamer.h)
+ */
+int
+ml_pipeline_template_create (const char *pipeline_description,
+    ml_pipeline_template_h * tmpl)
+{
+  ml_pipeline_template_s *t;
+  ml_pipeline_template_param_s *param;
+  ml_pipeline *pipe_h = NULL;
+  GstElement *pipeline, *elem;
+  gchar *converted = NULL;
+  guint i;
+  int status;
+
+  check_feature_state ();
+
+  if (!pipeline_description || !tmpl)
+    return ML_ERROR_INVALID_PARAMETER;
+
+  /* init null */
+  *tmpl = NULL;
+
+  if ((status = _ml_initialize_gstreamer ()) != ML_ERROR_NONE)
+    return status;
+
+  t = g_new0 (ml_pipeline_template_s, 1);
+  t->nodes = g_hash_table_new_full (g_str_hash, g_str_equal, g_free, g_free);
+  t->params = g_ptr_array_new_with_free_func (free_template_param);
+
+  status = parse_template_params (t, pipeline_description);
+  if (status != ML_ERROR_NONE)
+    goto done;
+
+  /* validate the description with the temporal pipeline handle */
+  pipe_h = create_pipeline_handle ();
+  if (pipe_h == NULL) {
+    status = ML_ERROR_OUT_OF_MEMORY;
+    goto done;
+  }
+
+  status = convert_element ((ml_pipeline_h) pipe_h, t->description,
+      &converted, FALSE);
+  if (status != ML_ERROR_NONE)
+    goto done;
+
+  /* the pre-defined elements (e.g., Tizen camera) get the resources for each pipeline */
+  t->convert = !g_str_equal (converted, t->description);
+
+  status = parse_pipeline (converted, &pipeline);
+  if (status != ML_ERROR_NONE)
+    goto done;
+
+  pipe_h->element = pipeline;
+
+  /* check the availability and get the type of named elements */
+  status = iterate_element (pipe_h, pipeline, FALSE, t);
+  if (status != ML_ERROR_NONE)
+    goto done;
+
+  for (i = 0; i < t->params->len; i++) {
+    param = g_ptr_array_index (t->params, i);
+    elem = gst_bin_get_by_name (GST_BIN (pipeline), param->element);
+
+    if (elem == NULL || g_object_class_find_property (G_OBJECT_GET_CLASS (elem),
+            param->property) == NULL) {
+      _ml_loge ("Cannot find the property '%s' of the element '%s'.",
+          param->property, param->element);
+      status = ML_ERROR_INVALID_PARAMETER;
+    }
+
+    if (elem)
+      gst_object_unref (elem);
+
+    if (status != ML_ERROR_NONE)
+      goto done;
+  }
+
+  t->compiled = TRUE;
+
+done:
+  g_free (converted);
+
+  if (pipe_h)
+    ml_pipeline_destroy ((ml_pipeline_h) pipe_h);
+
+  if (status == ML_ERROR_NONE)
+    *tmpl = t;
+  else
+    free_pipeline_template (t);
+
+  return status;
+}
+
+/**
+ * @brief Destroys the pipeline template (more info in nnstreamer.h)
+ */
+int
+ml_pipeline_template_destroy (ml_pipeline_template_h tmpl)
+{
+  check_feature_state ();
+
+  if (!tmpl)
+    return ML_ERROR_INVALID_PARAMETER;
+
+  free_pipeline_template ((ml_pipeline_template_s *) tmpl);
+  return ML_ERROR_NONE;
+}
+
+/**
+ * @brief Constructs the pipeline from the template (more info in nnstreamer.h)
+ */
+int
+ml_pipeline_template_construct (ml_pipeline_template_h tmpl,
+    const char **names, const char **values, unsigned int num_params,
+    ml_pipeline_state_cb cb, void *user_data, ml_pipeline_h * pipe)
+{
+  ml_pipeline_template_s *t = (ml_pipeline_template_s *) tmpl;
+  ml_pipeline_template_param_s *param;
+  ml_pipeline *pipe_h;
+  GstElement *pipeline, *elem;
+  gchar *description = NULL;
+  const gchar *value;
+  guint i;
+  int status = ML_ERROR_NONE;
+
+  check_feature_state ();
+
+  if (!t || !pipe || (num_params > 0 && (!names || !values)))
+    return ML_ERROR_INVALID_PARAMETER;
+
+  /* init null */
+  *pipe = NULL;
+
+  for (i = 0; i < num_params; i++) {
+    if (!names[i] || !values[i] || !has_template_param (t, names[i])) {
+      _ml_loge ("The parameter '%s' is not in the template.",
+          names[i] ? names[i] : "(null)");
+      return ML_ERROR_INVALID_PARAMETER;
+    }
+  }
+
+  for (i = 0; i < t->params->len; i++) {
+    param = g_ptr_array_index (t->params, i);
+
+    if (!find_template_value (names, values, num_params, param->param)) {
+      _ml_loge ("The value of parameter '%s' is not given.", param->param);
+      return ML_ERROR_INVALID_PARAMETER;
+    }
+  }
+
+  pipe_h = create_pipeline_handle ();
+  if (pipe_h == NULL)
+    return ML_ERROR_OUT_OF_MEMORY;
+
+  if (t->convert) {
+    status = convert_element ((ml_pipeline_h) pipe_h, t->description,
+        &description, FALSE);
+    if (status != ML_ERROR_NONE)
+      goto failed;
+
+    status = parse_pipeline (description, &pipeline);
+    g_free (description);
+  } else {
+    status = parse_pipeline (t->description, &pipeline);
+  }
+
+  if (status != ML_ERROR_NONE)
+    goto failed;
+
+  pipe_h->element = pipeline;
+
+  /* bind the parameters, the elements and properties are already validated. */
+  for (i = 0; i < t->params->len; i++) {
+    param = g_ptr_array_index (t->params, i);
+    value = find_template_value (names, values, num_params, param->param);
+
+    elem = gst_bin_get_by_name (GST_BIN (pipeline), param->element);
+    if (elem == NULL) {
+      _ml_loge ("Cannot find the element '%s'.", param->element);
+      status = ML_ERROR_STREAMS_PIPE;
+      goto failed;
+    }
+
+    gst_util_set_object_arg (G_OBJECT (elem), param->property, value);
+    gst_object_unref (elem);
+  }
+
+  status = setup_pipeline (pipe_h, pipeline, cb, user_data, FALSE, t);
+
+failed:
+  if (status != ML_ERROR_NONE) {
+    /* failed to construct the pipeline */
+    ml_pipeline_destroy ((ml_pipeline_h) pipe_h);
+  } else {
+    *pipe = pipe_h;
+  }
+
+  return status;
+}
+
+/**
+ * @brief Creates the pipeline pool (more info in nnstreamer.h)
+ */
+int
+ml_pipeline_pool_create (ml_pipeline_template_h tmpl, const char **names,
+    const char **values, unsigned int num_params, unsigned int size,
+    ml_pipeline_pool_h * pool)
+{
+  ml_pipeline_pool_s *p;
+  ml_pipeline_h pipe;
+  guint i;
+  int status = ML_ERROR_NONE;
+
+  check_feature_state ();
+
+  if (!tmpl || !pool || size == 0 || (num_params > 0 && (!names || !values)))
+    return ML_ERROR_INVALID_PARAMETER;
+
+  /* init null */
+  *pool = NULL;
+
+  p = g_new0 (ml_pipeline_pool_s, 1);
+  g_mutex_init (&p->lock);
+  g_queue_init (&p->ready);
+  p->acquired = g_hash_table_new (g_direct_hash, g_direct_equal);
+  p->tmpl = (ml_pipeline_template_s *) tmpl;
+  p->size = size;
+  p->num_params = num_params;
+  p->names = g_new0 (gchar *, num_params + 1);
+  p->values = g_new0 (gchar *, num_params + 1);
+
+  for (i = 0; i < num_params; i++) {
+    p->names[i] = g_strdup (names[i]);
+    p->values[i] = g_strdup (values[i]);
+  }
+
+  /* construct the ready pipelines */
+  for (i = 0; i < size; i++) {
+    status = ml_pipeline_template_construct (tmpl, (const char **) p->names,
+        (const char **) p->values, num_params, NULL, NULL, &pipe);
+    if (status != ML_ERROR_NONE)
+      break;
+
+    g_queue_push_tail (&p->ready, pipe);
+  }
+
+  if (status == ML_ERROR_NONE)
+    *pool = p;
+  else
+    ml_pipeline_pool_destroy (p);
+
+  return status;
+}
+
+/**
+ * @brief Destroys the pipeline pool (more info in nnstreamer.h)
+ */
+int
+ml_pipeline_pool_destroy (ml_pipeline_pool_h pool)
+{
+  ml_pipeline_pool_s *p = (ml_pipeline_pool_s *) pool;
+  ml_pipeline_h pipe;
+
+  check_feature_state ();
+
+  if (!p)
+    return ML_ERROR_INVALID_PARAMETER;
+
+  g_mutex_lock (&p->lock);
+  if (g_hash_table_size (p->acquired) > 0) {
+    _ml_loge
+        ("Failed to destroy the pipeline pool, %u pipelines are not released.",
+        g_hash_table_size (p->acquired));
+    g_mutex_unlock (&p->lock);
+    return ML_ERROR_INVALID_PARAMETER;
+  }
+
+  while ((pipe = g_queue_pop_head (&p->ready)) != NULL)
+    ml_pipeline_destroy (pipe);
+  g_mutex_unlock (&p->lock);
+
+  g_hash_table_destroy (p->acquired);
+  g_strfreev (p->names);
+  g_strfreev (p->values);
+  g_mutex_clear (&p->lock);
+  g_free (p);
+
+  return ML_ERROR_NONE;
+}
+
+/**
+ * @brief Acquires a ready pipeline from the pool (more info in nnstreamer.h)
+ */
+int
+ml_pipeline_pool_acquire (ml_pipeline_pool_h pool, ml_pipeline_h * pipe)
+{
+  ml_pipeline_pool_s *p = (ml_pipeline_pool_s *) pool;
+  ml_pipeline_h ready;
+  int status = ML_ERROR_NONE;
+
+  check_feature_state ();
+
+  if (!p || !pipe)
+    return ML_ERROR_INVALID_PARAMETER;
+
+  /* init null */
+  *pipe = NULL;
+
+  g_mutex_lock (&p->lock);
+  ready = g_queue_pop_head (&p->ready);
+  g_mutex_unlock (&p->lock);
+
+  /* no ready pipeline, construct new one without the lock. */
+  if (ready == NULL) {
+    status = ml_pipeline_template_construct (p->tmpl,
+        (const char **) p->names, (const char **) p->values, p->num_params,
+        NULL, NULL, &ready);
+    if (status != ML_ERROR_NONE)
+      return status;
+  }
+
+  g_mutex_lock (&p->lock);
+  g_hash_table_add (p->acquired, ready);
+  g_mutex_unlock (&p->lock);
+
+  *pipe = ready;
+  return status;
+}
+
+/**
+ * @brief Returns the pipeline to the pool (more info in nnstreamer.h)
+ */
+int
+ml_pipeline_pool_release (ml_pipeline_pool_h pool, ml_pipeline_h pipe)
+{
+  ml_pipeline_pool_s *p = (ml_pipeline_pool_s *) pool;
+  gboolean reuse;
+
+  check_feature_state ();
+
+  if (!p || !pipe)
+    return ML_ERROR_INVALID_PARAMETER;
+
+  g_mutex_lock (&p->lock);
+  if (!g_hash_table_remove (p->acquired, pipe)) {
+    _ml_loge ("The pipeline is not acquired from the pool.");
+    g_mutex_unlock (&p->lock);
+    return ML_ERROR_INVALID_PARAMETER;
+  }
+  reuse = (g_queue_get_length (&p->ready) < p->size);
+  g_mutex_unlock (&p->lock);
+
+  /* reset the pipeline without the lock, then keep it for next session. */
+  if (reuse && ml_pipeline_reset (pipe) == ML_ERROR_NONE) {
+    g_mutex_lock (&p->lock);
+    g_queue_push_tail (&p->ready, pipe);
+    g_mutex_unlock (&p->lock);
+  } else {
+    ml_pipeline_destroy (pipe);
+  }
+
+  return ML_ERROR_NONE;
+}
+
+/**
+ * @brief Destroy the pipeline (more info in nnstreamer.h)
+ */
+int
+ml_pipeline_destroy (ml_pipeline_h pipe)
+{
+  ml_pipeline *p = pipe;
+  GstStateChangeReturn scret;
+  GstState state;
+
+  check_feature_state ();
+
+  if (p == NULL)
+    return ML_ERROR_INVALID_PARAMETER;
+
+  g_mutex_lock (&p->lock);
+
+  /* Before changing the state, remove all callbacks. */
+  p->state_cb.cb = NULL;
+
+  g_mutex_lock (&p->state_lock);
+  p->start_cb = NULL;
+  p->start_user_data = NULL;
+  g_mutex_unlock (&p->state_lock);
+
+  g_hash_table_remove_all (p->namednodes);
+  g_hash_table_remove_all (p->resources);
+
+  if (p->element) {
+    /* Pause the pipeline if it's playing */
+    scret = gst_element_get_state (p->element, &state, NULL, 10 * GST_MSECOND); /* 10ms */
+    if (scret != GST_STATE_CHANGE_FAILURE && state == GST_STATE_PLAYING) {
+      scret = gst_element_set_state (p->element, GST_STATE_PAUSED);
+      if (scret == GST_STATE_CHANGE_FAILURE) {
+        g_mutex_unlock (&p->lock);
+        _ml_loge
+            ("Failed to wait until state changed PLAYING to PAUSED. For the detail, please check the GStreamer log messages.");
+        return ML_ERROR_STREAMS_PIPE;
+      }
+    }
+
+    g_mutex_unlock (&p->lock);
+    /* the bus message wakes up the waiting thread */
+    if (!wait_pipeline_paused (p, WAIT_PAUSED_TIME_LIMIT)) {
+      _ml_loge ("Failed to wait until state changed to PAUSED");
+    }
+    g_mutex_lock (&p->lock);
+
+    /* Stop (NULL State) the pipeline */
+    scret = gst_element_set_state (p->element, GST_STATE_NULL);
+    if (scret != GST_STATE_CHANGE_SUCCESS) {
+      g_mutex_unlock (&p->lock);
+      _ml_loge
+          ("Failed to wait until state changed to NULL(STOP). For the detail, please check the GStreamer log messages.");
+      return ML_ERROR_STREAMS_PIPE;
+    }
+
+    if (p->bus) {
+      g_signal_handler_disconnect (p->bus, p->signal_msg);
+      gst_object_unref (p->bus);
+    }
+
+    gst_object_unref (p->element);
+    p->element = NULL;
+  }
+
+  /* Destroy registered callback handles and resources */
+  g_hash_table_destroy (p->namednodes);
+  g_hash_table_destroy (p->resources);
+  p->namednodes = p->resources = NULL;
+
+  g_mutex_unlock (&p->lock);
+  g_mutex_clear (&p->lock);
+  g_mutex_clear (&p->state_lock);
+  g_cond_clear (&p->state_cond);
+
+  g_free (p);
+  return ML_ERROR_NONE;
+}
+
+/**
+ * @brief Internal data structure to destroy the pipeline in the thread pool.
+ */
+typedef struct {
+  ml_pipeline_h pipe; /**< The pipeline to be destroyed */
+  ml_pipeline_async_cb cb; /**< The callback to notify the pipeline is destroyed */
+  void *user_data; /**< The user data passed to the callback */
+} ml_pipeline_destroy_data_s;
+
+/**
+ * @brief The thread pool to destroy the pipelines, created with the first request.
+ */
+static GThreadPool *destroy_pool = NULL;
+
+/**
+ * @brief The number of pipelines pushed into the thread pool and not destroyed yet.
+ */
+static guint destroy_pending = 0;
+
+G_LOCK_DEFINE_STATIC (destroy_pool);
+
+/**
+ * @brief Internal function to destroy the pipeline in the thread pool.
+ */
+static void
+destroy_pipeline_func (gpointer data, gpointer user_data)
+{
+  ml_pipeline_destroy_data_s *destroy_data = data;
+  int status;
+
+  status = ml_pipeline_destroy (destroy_data->pipe);
+
+  if (destroy_data->cb)
+    destroy_data->cb (status, destroy_data->user_data);
+
+  g_free (destroy_data);
+
+  /**
+   * Free the pool when the last pipeline is destroyed.
+   * The pool is released after this thread returns, the next request creates new one.
+   */
+  G_LOCK (destroy_pool);
+  /* the pool is already released if the library is being unloaded */
+  if (--destroy_pending == 0 && destroy_pool) {
+    g_thread_pool_free (destroy_pool, FALSE, FALSE);
+    destroy_pool = NULL;
+  }
+  G_UNLOCK (destroy_pool);
+}
+
+/**
+ * @brief Internal function to free the thread pool when the library is unloaded.
+ * @details This waits for the pipelines in the pool, which run the code of this library.
+ */
+__attribute__((destructor))
+static void
+fini_destroy_thread_pool (void)
+{
+  GThreadPool *tp;
+
+  G_LOCK (destroy_pool);
+  tp = destroy_pool;
+  destroy_pool = NULL;
+  G_UNLOCK (destroy_pool);
+
+  if (tp)
+    g_thread_pool_free (tp, FALSE, TRUE);
+}
+
+/**
+ * @brief Destroy the pipeline without blocking the caller (more info in nnstreamer.h)
+ */
+int
+ml_pipeline_destroy_async (ml_pipeline_h pipe, ml_pipeline_async_cb cb,
+    void *user_data)
+{
+  ml_pipeline_destroy_data_s *destroy_data;
+  GError *err = NULL;
+  int status = ML_ERROR_NONE;
+
+  check_feature_state ();
+
+  if (pipe == NULL)
+    return ML_ERROR_INVALID_PARAMETER;
+
+  destroy_data = g_new0 (ml_pipeline_destroy_data_s, 1);
+  destroy_data->pipe = pipe;
+  destroy_data->cb = cb;
+  destroy_data->user_data = user_data;
+
+  G_LOCK (destroy_pool);
+  if (destroy_pool == NULL) {
+    /* the threads are shared by all pipelines, and exit when idle. */
+    destroy_pool = g_thread_pool_new (destroy_pipeline_func, NULL,
+        (gint) g_get_num_processors (), FALSE, &err);
+  }
+
+  if (destroy_pool == NULL) {
+    _ml_loge ("Failed to create the thread pool to destroy the pipeline: %s",
+        (err) ? err->message : "unknown reason");
+    status = ML_ERROR_OUT_OF_MEMORY;
+  } else if (!g_thread_pool_push (destroy_pool, destroy_data, &err)) {
+    _ml_loge ("Failed to destroy the pipeline: %s",
+        (err) ? err->message : "unknown reason");
+    status = ML_ERROR_OUT_OF_MEMORY;
+
+    /* the pool has no pipeline to destroy */
+    if (destroy_pending == 0) {
+      g_thread_pool_free (destroy_pool, FALSE, FALSE);
+      destroy_pool = NULL;
+    }
+  } else {
+    destroy_pending++;
+  }
+  G_UNLOCK (destroy_pool);
+
+  if (status != ML_ERROR_NONE) {
+    g_clear_error (&err);
+    g_free (destroy_data);
+  }
+
+  return status;
+}
+
+/**
+ * @brief Get the pipeline state (more info in nnstreamer.h)
+ */
+int
+ml_pipeline_get_state (ml_pipeline_h pipe, ml_pipeline_state_e * state)
+{
+  ml_pipeline *p = pipe;
+  GstState _state;
+  GstStateChangeReturn scret;
+
+  check_feature_state ();
+
+  if (p == NULL || state == NULL)
+    return ML_ERROR_INVALID_PARAMETER;
+
+  *state = ML_PIPELINE_STATE_UNKNOWN;
+
+  g_mutex_lock (&p->lock);
+  scret = gst_element_get_state (p->element, &_state, NULL, GST_MSECOND);       /* Do it within 1ms! */
+  g_mutex_unlock (&p->lock);
+
+  if (scret == GST_STATE_CHANGE_FAILURE) {
+    _ml_loge
+        ("Failed to get the state of the pipeline. For the detail, please check the GStreamer log messages.");
+    return ML_ERROR_STREAMS_PIPE;
+  }
+
+  *state = (ml_pipeline_state_e) _state;
+  return ML_ERROR_NONE;
+}
+
+/****************************************************
+ ** NNStreamer Pipeline Start/Stop Control         **
+ ****************************************************/
+/**
+ * @brief Start/Resume the pipeline! (more info in nnstreamer.h)
+ */
+int
+ml_pipeline_start (ml_pipeline_h pipe)
+{
+  ml_pipeline *p = pipe;
+  GstStateChangeReturn scret;
+  int status = ML_ERROR_NONE;
+
+  check_feature_state ();
+
+  if (p == NULL)
+    return ML_ERROR_INVALID_PARAMETER;
+
+  g_mutex_lock (&p->lock);
+
+  /* check the resources when starting the pipeline */
+  if (g_hash_table_size (p->resources)) {
+    GHashTableIter iter;
+    gpointer key, value;
+
+    /* iterate all handle and acquire res if released */
+    g_hash_table_iter_init (&iter, p->resources);
+    while (g_hash_table_iter_next (&iter, &key, &value)) {
+      if (g_str_has_prefix (key, "tizen")) {
+        status = get_tizen_resource (pipe, key);
+        if (status != ML_ERROR_NONE)
+          goto done;
+      }
+    }
+  }
+
+  scret = gst_element_set_state (p->element, GST_STATE_PLAYING);
+  if (scret == GST_STATE_CHANGE_FAILURE) {
+    _ml_loge
+        ("Failed to set the state of the pipeline to PLAYING. For the detail, please check the GStreamer log messages.");
+    status = ML_ERROR_STREAMS_PIPE;
+  }
+
+done:
+  g_mutex_unlock (&p->lock);
+  return status;
+}
+
+/**
+ * @brief Start the pipeline and notify when it's playing (more info in nnstreamer.h)
+ */
+int
+ml_pipeline_start_async (ml_pipeline_h pipe, ml_pipeline_async_cb cb,
+    void *user_data)
+{
+  ml_pipeline *p = pipe;
+  gboolean playing;
+  int status;
+
+  check_feature_state ();
+
+  if (p == NULL || cb == NULL)
+    return ML_ERROR_INVALID_PARAMETER;
+
+  /* set the callback before the state change, the bus message may come in this thread. */
+  g_mutex_lock (&p->state_lock);
+  if (p->start_cb) {
+    g_mutex_unlock (&p->state_lock);
+    _ml_loge ("The previous asynchronous start is not completed yet.");
+    return ML_ERROR_TRY_AGAIN;
+  }
+
+  p->start_cb = cb;
+  p->start_user_data = user_data;
+  g_mutex_unlock (&p->state_lock);
+
+  status = ml_pipeline_start (pipe);
+
+  g_mutex_lock (&p->state_lock);
+  if (status != ML_ERROR_NONE) {
+    /* do not call the callback if failed to start */
+    if (p->start_cb == cb && p->start_user_data == user_data) {
+      p->start_cb = NULL;
+      p->start_user_data = NULL;
+    }
+  }
+  playing = (p->pipe_state == ML_PIPELINE_STATE_PLAYING);
+  g_mutex_unlock (&p->state_lock);
+
+  /* no state change message if the pipeline is already playing */
+  if (status == ML_ERROR_NONE && playing)
+    complete_pipeline_start (p, ML_ERROR_NONE);
+
+  return status;
+}
+
+/**
+ * @brief Pause the pipeline! (more info in nnstreamer.h)
+ */
+int
+ml_pipeline_stop (ml_pipeline_h pipe)
+{
+  ml_pipeline *p = pipe;
+  GstStateChangeReturn scret;
+
+  check_feature_state ();
+
+  if (p == NULL)
+    return ML_ERROR_INVALID_PARAMETER;
+
+  g_mutex_lock (&p->lock);
+  scret = gst_element_set_state (p->element, GST_STATE_PAUSED);
+  g_mutex_unlock (&p->lock);
+
+  if (scret == GST_STATE_CHANGE_FAILURE) {
+    _ml_loge
+        ("Failed to set the state of the pipeline to PAUSED. For the detail, please check the GStreamer log messages.");
+    return ML_ERROR_STREAMS_PIPE;
+  }
+
+  return ML_ERROR_NONE;
+}
+
+/**
+ * @brief Clears all data and resets the running-time of the pipeline (more info in nnstreamer.h)
+ */
+int
+ml_pipeline_flush (ml_pipeline_h pipe, bool start)
+{
+  ml_pipeline *p = pipe;
+  int status;
+
+  check_feature_state ();
+
+  if (p == NULL)
+    return ML_ERROR_INVALID_PARAMETER;
+
+  status = ml_pipeline_stop (pipe);
+  if (status != ML_ERROR_NONE)
+    return status;
+
+  _ml_logi ("The pipeline is stopped, clear all data from the pipeline.");
+
+  /* send flush event to pipeline */
+  g_mutex_lock (&p->lock);
+  if (!gst_element_send_event (p->element, gst_event_new_flush_start ())) {
+    _ml_logw ("Error occurs while sending flush_start event.");
+  }
+
+  if (!gst_element_send_event (p->element, gst_event_new_flush_stop (TRUE))) {
+    _ml_logw ("Error occurs while sending flush_stop event.");
+  }
+  g_mutex_unlock (&p->lock);
+
+  if (start && status == ML_ERROR_NONE)
+    status = ml_pipeline_start (pipe);
+
+  return status;
+}
+
+/**
+ * @brief Internal function to reset the property of element to default value.
+ */
+static void
+reset_element_property (GstElement * element, const gchar * name)
+{
+  GParamSpec *pspec;
+
+  pspec = g_object_class_find_property (G_OBJECT_GET_CLASS (element), name);
+  if (pspec)
+    g_object_set_property (G_OBJECT (element), name,
+        g_param_spec_get_default_value (pspec));
+}
+
+/**
+ * @brief Internal function to reset the element for the next session.
+ * @note This function should be called with element lock.
+ */
+static void
+reset_element (ml_pipeline_element * e)
+{
+  if (e->type == ML_PIPELINE_ELEMENT_APP_SRC) {
+    /* the push does not hold the pipeline lock, wake it up and wait for it */
+    e->src_closing = TRUE;
+    g_cond_broadcast (&e->src_cond);
+
+    while (e->src_users > 0)
+      g_cond_wait (&e->src_cond, &e->lock);
+  }
+
+  if (e->handle_id > 0) {
+    g_signal_handler_disconnect (e->element, e->handle_id);
+    e->handle_id = 0;
+  }
+
+  /**
+   * Release all handles.
+   * The batch finds its handles with the id, and fails if the handles are released here.
+   */
+  if (e->handles)
+    g_list_free_full (e->handles, free_element_handle);
+  e->handles = NULL;
+
+  if (e->type == ML_PIPELINE_ELEMENT_APP_SRC) {
+    e->src_closing = FALSE;
+
+    /* reset the queue limit */
+    reset_element_property (e->element, "max-bytes");
+#if GST_CHECK_VERSION(1, 20, 0)
+    reset_element_property (e->element, "max-buffers");
+#endif
+
+    e->src_blocking = FALSE;
+    e->src_timeout = 0;
+    e->src_enough_data = FALSE;
+    g_cond_broadcast (&e->src_cond);
+  }
+
+  /* reset the counters */
+  if (e->stats) {
+    clear_element_stats (e);
+    set_element_stats (e);
+  }
+
+  if (e->qos) {
+    guint64 max_latency = e->qos->max_latency;
+
+    clear_element_qos (e);
+    set_element_qos (e, max_latency);
+  }
+
+  if (e->latency) {
+    g_mutex_lock (&e->latency->lock);
+    e->latency->count = 0;
+    e->latency->last = 0;
+    e->latency->max = 0;
+    g_mutex_unlock (&e->latency->lock);
+  }
+}
+
+/**
+ * @brief Resets the pipeline for the next session (more info in nnstreamer.h)
+ */
+int
+ml_pipeline_reset (ml_pipeline_h pipe)
+{
+  ml_pipeline *p = pipe;
+  GHashTableIter iter;
+  gpointer value;
+  int status;
+
+  check_feature_state ();
+
+  if (p == NULL)
+    return ML_ERROR_INVALID_PARAMETER;
+
+  /* pause the pipeline and clear all data, the elements are not released. */
+  status = ml_pipeline_flush (pipe, false);
+  if (status != ML_ERROR_NONE)
+    return status;
+
+  g_mutex_lock (&p->lock);
+
+  g_mutex_lock (&p->state_lock);
+  p->isEOS = FALSE;
+  g_mutex_unlock (&p->state_lock);
+
+  g_hash_table_iter_init (&iter, p->namednodes);
+  while (g_hash_table_iter_next (&iter, NULL, &value)) {
+    ml_pipeline_element *e = value;
+
+    g_mutex_lock (&e->lock);
+    reset_element (e);
+    g_mutex_unlock (&e->lock);
+  }
+
+  g_mutex_unlock (&p->lock);
+  return ML_ERROR_NONE;
+}
+
+/****************************************************
+ ** NNStreamer Pipeline Statistics                 **
+ ****************************************************/
+/**
+ * @brief Enables or disables the statistics mode of the pipeline (more info in nnstreamer.h)
+ */
+int
+ml_pipeline_set_statistics (ml_pipeline_h pipe, bool enable)
+{
+  ml_pipeline *p = pipe;
+  GHashTableIter iter;
+  gpointer value;
+
+  check_feature_state ();
+
+  if (p == NULL)
+    return ML_ERROR_INVALID_PARAMETER;
+
+  g_mutex_lock (&p->lock);
+
+  g_hash_table_iter_init (&iter, p->namednodes);
+  while (g_hash_table_iter_next (&iter, NULL, &value)) {
+    ml_pipeline_element *e = value;
+
+    g_mutex_lock (&e->lock);
+
+    /* reset the counters */
+    clear_element_stats (e);
+    if (enable)
+      set_element_stats (e);
+
+    g_mutex_unlock (&e->lock);
+  }
+
+  g_mutex_unlock (&p->lock);
+  return ML_ERROR_NONE;
+}
+
+/**
+ * @brief Gets the statistics of a node in the pipeline (more info in nnstreamer.h)
+ */
+int
+ml_pipeline_get_statistics (ml_pipeline_h pipe, const char *node_name,
+    ml_pipeline_node_statistics_s * stats)
+{
+  ml_pipeline *p = pipe;
+  ml_pipeline_element *elem;
+  ml_pipeline_stats_s *s;
+  int status = ML_ERROR_NONE;
+
+  check_feature_state ();
+
+  if (p == NULL || node_name == NULL || stats == NULL)
+    return ML_ERROR_INVALID_PARAMETER;
+
+  memset (stats, 0, sizeof (ml_pipeline_node_statistics_s));
+
+  g_mutex_lock (&p->lock);
+
+  elem = g_hash_table_lookup (p->namednodes, node_name);
+  if (elem == NULL) {
+    _ml_loge ("There is no element named [%s] in the pipeline.", node_name);
+    status = ML_ERROR_INVALID_PARAMETER;
+    goto done;
+  }
+
+  g_mutex_lock (&elem->lock);
+
+  s = elem->stats;
+  if (s == NULL) {
+    _ml_loge ("The statistics mode of the pipeline is disabled.");
+    status = ML_ERROR_INVALID_PARAMETER;
+  } else {
+    guint64 frames;
+
+    g_mutex_lock (&s->lock);
+    stats->frames_in = s->frames_in;
+    stats->frames_out = s->frames_out;
+    stats->bytes_out = s->bytes_out;
+    stats->dropped = s->dropped;
+
+    frames = (s->has_src) ? s->frames_out : s->frames_in;
+    if (frames > 1 && s->last_time > s->first_time) {
+      stats->fps = (double) (frames - 1) * G_USEC_PER_SEC /
+          (double) (s->last_time - s->first_time);
+    }
+
+    if (s->latency_count > 0)
+      stats->latency_avg = s->latency_sum / s->latency_count;
+    stats->latency_max = s->latency_max;
+    memcpy (stats->latency_histogram, s->histogram, sizeof (s->histogram));
+    stats->queue_depth = s->pending_count;
+    stats->queue_depth_max = s->pending_max;
+    g_mutex_unlock (&s->lock);
+  }
+
+  g_mutex_unlock (&elem->lock);
+
+done:
+  g_mutex_unlock (&p->lock);
+  return status;
+}
+
+/**
+ * @brief Internal function to check the element is tensor_filter.
+ */
+static gboolean
+is_tensor_filter (ml_pipeline_element * e)
+{
+  GstElementFactory *factory = gst_element_get_factory (e->element);
+
+  return (factory != NULL &&
+      g_str_equal (gst_plugin_feature_get_name (GST_PLUGIN_FEATURE (factory)),
+          "tensor_filter"));
+}
+
+/**
+ * @brief Sets the QoS of tensor_filter nodes in the pipeline (more info in nnstreamer.h)
+ */
+int
+ml_pipeline_set_qos (ml_pipeline_h pipe, unsigned int max_latency_ms)
+{
+  ml_pipeline *p = pipe;
+  GHashTableIter iter;
+  gpointer value;
+  guint num_filters = 0;
 
   check_feature_state ();
 
-  if (!pipe || !pipeline_description)
+  if (p == NULL)
+    return ML_ERROR_INVALID_PARAMETER;
+
+  g_mutex_lock (&p->lock);
+
+  g_hash_table_iter_init (&iter, p->namednodes);
+  while (g_hash_table_iter_next (&iter, NULL, &value)) {
+    ml_pipeline_element *e = value;
+
+    if (e->type != ML_PIPELINE_ELEMENT_COMMON || !is_tensor_filter (e))
+      continue;
+
+    g_mutex_lock (&e->lock);
+
+    /* reset the counters */
+    clear_element_qos (e);
+    if (max_latency_ms > 0)
+      set_element_qos (e, (guint64) max_latency_ms * 1000ULL);
+
+    g_mutex_unlock (&e->lock);
+    num_filters++;
+  }
+
+  g_mutex_unlock (&p->lock);
+
+  if (num_filters == 0) {
+    _ml_loge ("There is no tensor_filter in the pipeline.");
+    return ML_ERROR_INVALID_PARAMETER;
+  }
+
+  return ML_ERROR_NONE;
+}
+
+/**
+ * @brief Gets the QoS status of a node in the pipeline (more info in nnstreamer.h)
+ */
+int
+ml_pipeline_get_qos (ml_pipeline_h pipe, const char *node_name,
+    ml_pipeline_node_qos_s * qos)
+{
+  ml_pipeline *p = pipe;
+  ml_pipeline_element *elem;
+  ml_pipeline_qos_ctrl_s *q;
+  int status = ML_ERROR_NONE;
+
+  check_feature_state ();
+
+  if (p == NULL || node_name == NULL || qos == NULL)
+    return ML_ERROR_INVALID_PARAMETER;
+
+  memset (qos, 0, sizeof (ml_pipeline_node_qos_s));
+
+  g_mutex_lock (&p->lock);
+
+  elem = g_hash_table_lookup (p->namednodes, node_name);
+  if (elem == NULL) {
+    _ml_loge ("There is no element named [%s] in the pipeline.", node_name);
+    status = ML_ERROR_INVALID_PARAMETER;
+    goto done;
+  }
+
+  g_mutex_lock (&elem->lock);
+
+  q = elem->qos;
+  if (q == NULL) {
+    _ml_loge ("The QoS of the node [%s] is disabled.", node_name);
+    status = ML_ERROR_INVALID_PARAMETER;
+  } else {
+    g_mutex_lock (&q->lock);
+    qos->frames_in = q->frames_in;
+    qos->dropped = q->dropped;
+    qos->drop_rate = q->drop_rate;
+    qos->process_time = q->process_time;
+    g_mutex_unlock (&q->lock);
+  }
+
+  g_mutex_unlock (&elem->lock);
+
+done:
+  g_mutex_unlock (&p->lock);
+  return status;
+}
+
+/****************************************************
+ ** NNStreamer Pipeline Sink/Src Control           **
+ ****************************************************/
+/**
+ * @brief Register a callback for sink (more info in nnstreamer.h)
+ */
+int
+ml_pipeline_sink_register (ml_pipeline_h pipe, const char *sink_name,
+    ml_pipeline_sink_cb cb, void *user_data, ml_pipeline_sink_h * h)
+{
+  ml_pipeline_element *elem;
+  ml_pipeline *p = pipe;
+  ml_pipeline_common_elem *sink;
+  int ret = ML_ERROR_NONE;
+
+  check_feature_state ();
+
+  if (h == NULL) {
+    _ml_loge ("The argument sink handle is not valid.");
     return ML_ERROR_INVALID_PARAMETER;
+  }
 
   /* init null */
-  *pipe = NULL;
+  *h = NULL;
+
+  if (pipe == NULL) {
+    _ml_loge ("The first argument, pipeline handle is not valid.");
+    return ML_ERROR_INVALID_PARAMETER;
+  }
+
+  if (sink_name == NULL) {
+    _ml_loge ("The second argument, sink name is not valid.");
+    return ML_ERROR_INVALID_PARAMETER;
+  }
+
+  if (cb == NULL) {
+    _ml_loge ("The callback argument, cb, is not valid.");
+    return ML_ERROR_INVALID_PARAMETER;
+  }
+
+  g_mutex_lock (&p->lock);
+  elem = g_hash_table_lookup (p->namednodes, sink_name);
+
+  if (elem == NULL) {
+    _ml_loge ("There is no element named [%s] in the pipeline.", sink_name);
+    ret = ML_ERROR_INVALID_PARAMETER;
+    goto unlock_return;
+  }
+
+  if (elem->type != ML_PIPELINE_ELEMENT_SINK &&
+      elem->type != ML_PIPELINE_ELEMENT_APP_SINK) {
+    _ml_loge ("The element [%s] in the pipeline is not a sink element.",
+        sink_name);
+    ret = ML_ERROR_INVALID_PARAMETER;
+    goto unlock_return;
+  }
+
+  if (elem->handle_id > 0) {
+    /* no need to connect signal to sink element */
+    _ml_logw ("Sink callback is already registered.");
+  } else {
+    /* set callback for new data */
+    if (elem->type == ML_PIPELINE_ELEMENT_SINK) {
+      /* tensor_sink */
+      g_object_set (G_OBJECT (elem->element), "emit-signal", (gboolean) TRUE,
+          NULL);
+      elem->handle_id =
+          g_signal_connect (elem->element, "new-data",
+          G_CALLBACK (cb_sink_event), elem);
+    } else {
+      /* appsink */
+      g_object_set (G_OBJECT (elem->element), "emit-signals", (gboolean) TRUE,
+          NULL);
+      elem->handle_id =
+          g_signal_connect (elem->element, "new-sample",
+          G_CALLBACK (cb_appsink_new_sample), elem);
+    }
+
+    if (elem->handle_id == 0) {
+      _ml_loge ("Failed to connect a signal to the element [%s].", sink_name);
+      ret = ML_ERROR_STREAMS_PIPE;
+      goto unlock_return;
+    }
+  }
+
+  sink = g_new0 (ml_pipeline_common_elem, 1);
+  if (sink == NULL) {
+    _ml_loge ("Failed to allocate the sink handle for %s.", sink_name);
+    ret = ML_ERROR_OUT_OF_MEMORY;
+    goto unlock_return;
+  }
+
+  sink->callback_info = g_new0 (callback_info_s, 1);
+  if (sink->callback_info == NULL) {
+    g_free (sink);
+    _ml_loge ("Failed to allocate the sink handle for %s.", sink_name);
+    ret = ML_ERROR_OUT_OF_MEMORY;
+    goto unlock_return;
+  }
+
+  sink->pipe = p;
+  sink->element = elem;
+  sink->callback_info->sink_cb = cb;
+  sink->callback_info->pdata = user_data;
+  *h = sink;
+
+  g_mutex_lock (&elem->lock);
+
+  elem->maxid++;
+  sink->id = elem->maxid;
+  elem->handles = g_list_append (elem->handles, sink);
+
+  g_mutex_unlock (&elem->lock);
+
+unlock_return:
+  g_mutex_unlock (&p->lock);
+  return ret;
+}
+
+/**
+ * @brief Internal function to unregister the handle of sink node.
+ * @note This function should be called with the pipeline lock and element lock.
+ */
+static void
+sink_unregister_handle (ml_pipeline_element * elem,
+    ml_pipeline_common_elem * sink)
+{
+  if (elem->handle_id > 0) {
+    g_signal_handler_disconnect (elem->element, elem->handle_id);
+    elem->handle_id = 0;
+  }
+
+  elem->handles = g_list_remove (elem->handles, sink);
+  free_element_handle (sink);
+}
+
+/**
+ * @brief Unregister a callback for sink (more info in nnstreamer.h)
+ */
+int
+ml_pipeline_sink_unregister (ml_pipeline_sink_h h)
+{
+  handle_init (sink, h);
+
+  sink_unregister_handle (elem, sink);
+
+  handle_exit (h);
+}
+
+/**
+ * @brief Internal function to compare the latency samples.
+ */
+static int
+compare_latency (const void *a, const void *b)
+{
+  guint64 la = *(const guint64 *) a;
+  guint64 lb = *(const guint64 *) b;
+
+  return (la > lb) - (la < lb);
+}
+
+/**
+ * @brief Gets the end-to-end latency of the frames arrived at the sink node (more info in nnstreamer.h)
+ * @note This function does not hold the pipeline lock, to be called in the sink callback.
+ */
+int
+ml_pipeline_sink_get_latency (ml_pipeline_sink_h h,
+    ml_pipeline_sink_latency_s * latency)
+{
+  ml_pipeline_common_elem *sink = h;
+  ml_pipeline_element *elem;
+  ml_pipeline_latency_s *l;
+  guint64 *samples = NULL;
+  gboolean locked;
+  guint i, n;
+  int status = ML_ERROR_NONE;
+
+  check_feature_state ();
+
+  if (sink == NULL || latency == NULL)
+    return ML_ERROR_INVALID_PARAMETER;
+
+  elem = sink->element;
+  if (sink->pipe == NULL || elem == NULL || sink->pipe != elem->pipe) {
+    _ml_loge ("The handle appears to be broken.");
+    return ML_ERROR_INVALID_PARAMETER;
+  }
+
+  memset (latency, 0, sizeof (ml_pipeline_sink_latency_s));
+
+  /* the sink callback is called with element lock */
+  locked = (g_atomic_pointer_get (&elem->sink_cb_thread) != g_thread_self ());
+  if (locked)
+    g_mutex_lock (&elem->lock);
+
+  if (NULL == g_list_find (elem->handles, sink) || elem->latency == NULL) {
+    _ml_loge ("The handle does not exists.");
+    status = ML_ERROR_INVALID_PARAMETER;
+    goto done;
+  }
+
+  l = elem->latency;
+
+  g_mutex_lock (&l->lock);
+  n = (guint) MIN (l->count, ML_PIPELINE_LATENCY_WINDOW);
+  if (n > 0) {
+    samples = g_try_new (guint64, n);
+    if (samples == NULL) {
+      g_mutex_unlock (&l->lock);
+      _ml_loge ("Failed to allocate the latency samples.");
+      status = ML_ERROR_OUT_OF_MEMORY;
+      goto done;
+    }
+
+    memcpy (samples, l->window, sizeof (guint64) * n);
+  }
+
+  latency->count = l->count;
+  latency->last = l->last;
+  latency->max = l->max;
+  g_mutex_unlock (&l->lock);
+
+done:
+  if (locked)
+    g_mutex_unlock (&elem->lock);
 
-  if ((status = _ml_initialize_gstreamer ()) != ML_ERROR_NONE)
+  if (status != ML_ERROR_NONE)
     return status;
 
-  /* prepare pipeline handle */
-  pipe_h = g_new0 (ml_pipeline, 1);
-  if (pipe_h == NULL) {
-    _ml_loge ("Failed to allocate handle for pipeline.");
-    return ML_ERROR_OUT_OF_MEMORY;
+  if (n > 0) {
+    qsort (samples, n, sizeof (guint64), compare_latency);
+
+    /* nearest-rank percentiles */
+    i = (n * 50 + 99) / 100;
+    latency->p50 = samples[i - 1];
+    i = (n * 90 + 99) / 100;
+    latency->p90 = samples[i - 1];
+    i = (n * 99 + 99) / 100;
+    latency->p99 = samples[i - 1];
+
+    g_free (samples);
   }
 
-  g_mutex_init (&pipe_h->lock);
+  return ML_ERROR_NONE;
+}
 
-  pipe_h->isEOS = FALSE;
-  pipe_h->pipe_state = ML_PIPELINE_STATE_UNKNOWN;
-  pipe_h->namednodes =
-      g_hash_table_new_full (g_str_hash, g_str_equal, g_free, cleanup_node);
+/**
+ * @brief Parse tensors info of src element.
+ */
+static int
+ml_pipeline_src_parse_tensors_info (ml_pipeline_element * elem)
+{
+  int ret = ML_ERROR_NONE;
+  ml_tensors_info_s *_info = &elem->tensors_info;
 
-  pipe_h->resources =
-      g_hash_table_new_full (g_str_hash, g_str_equal, g_free, cleanup_resource);
+  /* The caps of src pad is changed, parse the tensors info again. */
+  if (elem->src && g_atomic_int_get (&elem->caps_changed))
+    clear_src_caps (elem);
 
-  /* convert predefined element and launch the pipeline */
-  status =
-      convert_element ((ml_pipeline_h) pipe_h, pipeline_description,
-      &description, is_internal);
-  if (status != ML_ERROR_NONE)
-    goto failed;
+  if (elem->src == NULL) {
+    elem->src = gst_element_get_static_pad (elem->element, "src");
+    elem->size = 0;
 
-  pipeline = gst_parse_launch (description, &err);
-  g_free (description);
+    if (elem->src == NULL) {
+      _ml_loge
+          ("Failed to get the src pad of the element[%s]. For the detail, please check the GStreamer log messages.",
+          elem->name);
+      ret = ML_ERROR_STREAMS_PIPE;
+    } else {
+      GstCaps *caps = gst_pad_get_allowed_caps (elem->src);
+      guint i;
+      gboolean found, flexible;
+      size_t sz;
 
-  if (pipeline == NULL || err) {
-    _ml_loge ("Cannot parse and launch the given pipeline = [%s]",
-        pipeline_description);
-    _ml_loge ("  - Error Message: %s", (err) ? err->message : "unknown reason");
-    g_clear_error (&err);
+      found = flexible = FALSE;
+      if (caps) {
+        found = get_tensors_info_from_caps (caps, _info, &flexible);
 
-    if (pipeline)
-      gst_object_unref (pipeline);
+        if (!found && gst_caps_is_fixed (caps)) {
+          GstStructure *st = gst_caps_get_structure (caps, 0);
 
-    status = ML_ERROR_STREAMS_PIPE;
-    goto failed;
-  }
+          if (!gst_structure_is_tensor_stream (st))
+            elem->is_media_stream = TRUE;
+        } else if (found && flexible) {
+          /* flexible tensor, cannot get exact info from caps. */
+          elem->is_flexible_tensor = TRUE;
+        }
 
-  g_assert (GST_IS_PIPELINE (pipeline));
-  pipe_h->element = pipeline;
+        gst_caps_unref (caps);
+      }
 
-  /* bus and message callback */
-  pipe_h->bus = gst_element_get_bus (pipeline);
-  g_assert (pipe_h->bus);
+      if (found && !flexible) {
+        for (i = 0; i < _info->num_tensors; i++) {
+          sz = _ml_tensor_info_get_size (&_info->info[i]);
+          elem->size += sz;
+        }
+      } else {
+        if (!elem->is_media_stream && !elem->is_flexible_tensor) {
+          _ml_logw
+              ("Cannot find caps. The pipeline is not yet negotiated for src element [%s].",
+              elem->name);
+          gst_object_unref (elem->src);
+          elem->src = NULL;
+          ret = ML_ERROR_TRY_AGAIN;
+        }
+      }
 
-  gst_bus_enable_sync_message_emission (pipe_h->bus);
-  pipe_h->signal_msg = g_signal_connect (pipe_h->bus, "sync-message",
-      G_CALLBACK (cb_bus_sync_message), pipe_h);
+      /* Keep the parsed caps until the caps event is pushed to src pad. */
+      if (elem->src) {
+        elem->src_probe_id = gst_pad_add_probe (elem->src,
+            GST_PAD_PROBE_TYPE_EVENT_DOWNSTREAM, cb_src_pad_event, elem, NULL);
+      }
+    }
+  }
 
-  /* state change callback */
-  pipe_h->state_cb.cb = cb;
-  pipe_h->state_cb.user_data = user_data;
+  return ret;
+}
 
-  /* iterate elements and prepare element handle */
-  status = iterate_element (pipe_h, pipeline, is_internal);
+/**
+ * @brief Prepares the flex-tensor header of src element.
+ * @details The header is serialised once and reused until the tensors info of given data is changed.
+ * @note This function should be called with element lock.
+ */
+static int
+ml_pipeline_src_prepare_flex_header (ml_pipeline_element * elem,
+    ml_tensors_info_h info)
+{
+  GstTensorsInfo gst_info;
+  GstTensorMetaInfo meta;
+  int status;
+  guint i;
 
-  /* finally set pipeline state to PAUSED */
-  if (status == ML_ERROR_NONE) {
-    status = ml_pipeline_stop ((ml_pipeline_h) pipe_h);
+  if (elem->flex_header[0] && ml_tensors_info_is_equal (info, &elem->flex_info))
+    return ML_ERROR_NONE;
 
-    if (status == ML_ERROR_NONE) {
-      /**
-       * Let's wait until the pipeline state is changed to paused.
-       * Otherwise, the following APIs like 'set_property' may incur
-       * unintended behaviors. But, don't need to return any error
-       * even if this state change is not finished within the timeout,
-       * just replying on the caller.
-       */
-      gst_element_get_state (pipeline, NULL, NULL, 10 * GST_MSECOND);
-    }
+  clear_flex_header (elem);
+
+  status = ml_tensors_info_clone (&elem->flex_info, info);
+  if (status != ML_ERROR_NONE) {
+    _ml_loge ("Failed to get the tensors info of flexible tensor for src [%s].",
+        elem->name);
+    return status;
   }
 
-failed:
+  status = _ml_tensors_info_copy_from_ml (&gst_info, &elem->flex_info);
   if (status != ML_ERROR_NONE) {
-    /* failed to construct the pipeline */
-    ml_pipeline_destroy ((ml_pipeline_h) pipe_h);
-  } else {
-    *pipe = pipe_h;
+    _ml_loge ("Failed to get the tensors info of flexible tensor for src [%s].",
+        elem->name);
+    return status;
   }
 
-  return status;
+  for (i = 0; i < gst_info.num_tensors; i++) {
+    gst_tensor_info_convert_to_meta (&gst_info.info[i], &meta);
+
+    elem->flex_header_size[i] = gst_tensor_meta_info_get_header_size (&meta);
+    elem->flex_header[i] = g_malloc0 (elem->flex_header_size[i]);
+    gst_tensor_meta_info_update_header (&meta, elem->flex_header[i]);
+  }
+
+  gst_tensors_info_free (&gst_info);
+  return ML_ERROR_NONE;
 }
 
 /**
- * @brief Construct the pipeline (more info in nnstreamer.h)
+ * @brief Get a handle to operate a src (more info in nnstreamer.h)
  */
 int
-ml_pipeline_construct (const char *pipeline_description,
-    ml_pipeline_state_cb cb, void *user_data, ml_pipeline_h * pipe)
+ml_pipeline_src_get_handle (ml_pipeline_h pipe, const char *src_name,
+    ml_pipeline_src_h * h)
 {
-  /* not an internal pipeline construction */
-  return construct_pipeline_internal (pipeline_description, cb, user_data, pipe,
-      FALSE);
+  ml_pipeline *p = pipe;
+  ml_pipeline_element *elem;
+  ml_pipeline_common_elem *src;
+  int ret = ML_ERROR_NONE;
+
+  check_feature_state ();
+
+  if (h == NULL) {
+    _ml_loge ("The argument source handle is not valid.");
+    return ML_ERROR_INVALID_PARAMETER;
+  }
+
+  /* init null */
+  *h = NULL;
+
+  if (pipe == NULL) {
+    _ml_loge ("The first argument, pipeline handle is not valid.");
+    return ML_ERROR_INVALID_PARAMETER;
+  }
+
+  if (src_name == NULL) {
+    _ml_loge ("The second argument, source name is not valid.");
+    return ML_ERROR_INVALID_PARAMETER;
+  }
+
+  g_mutex_lock (&p->lock);
+
+  elem = g_hash_table_lookup (p->namednodes, src_name);
+
+  if (elem == NULL) {
+    _ml_loge ("There is no element named [%s] in the pipeline.", src_name);
+    ret = ML_ERROR_INVALID_PARAMETER;
+    goto unlock_return;
+  }
+
+  if (elem->type != ML_PIPELINE_ELEMENT_APP_SRC) {
+    _ml_loge ("The element [%s] in the pipeline is not a source element.",
+        src_name);
+    ret = ML_ERROR_INVALID_PARAMETER;
+    goto unlock_return;
+  }
+
+  src = *h = g_new0 (ml_pipeline_common_elem, 1);
+  if (src == NULL) {
+    _ml_loge ("Failed to allocate the src handle for %s.", src_name);
+    ret = ML_ERROR_OUT_OF_MEMORY;
+    goto unlock_return;
+  }
+
+  src->pipe = p;
+  src->element = elem;
+
+  g_mutex_lock (&elem->lock);
+
+  elem->maxid++;
+  src->id = elem->maxid;
+  elem->handles = g_list_append (elem->handles, src);
+
+  ml_pipeline_src_parse_tensors_info (elem);
+  g_mutex_unlock (&elem->lock);
+
+unlock_return:
+  g_mutex_unlock (&p->lock);
+
+  return ret;
 }
 
-#if defined (__TIZEN__)
 /**
- * @brief Construct the pipeline (Tizen internal, see nnstreamer-tizen-internal.h)
+ * @brief Internal function to release the handle of src node.
+ * @note This function should be called with the pipeline lock and element lock.
  */
-int
-ml_pipeline_construct_internal (const char *pipeline_description,
-    ml_pipeline_state_cb cb, void *user_data, ml_pipeline_h * pipe)
+static void
+src_release_handle (ml_pipeline_element * elem, ml_pipeline_common_elem * src)
 {
-  /* Tizen internal pipeline construction */
-  return construct_pipeline_internal (pipeline_description, cb, user_data, pipe,
-      TRUE);
+  elem->handles = g_list_remove (elem->handles, src);
+  free_element_handle (src);
+
+  /* wake up the push waiting with the released handle */
+  g_cond_broadcast (&elem->src_cond);
 }
-#endif /* __TIZEN__ */
 
 /**
- * @brief Destroy the pipeline (more info in nnstreamer.h)
+ * @brief Close a src node (more info in nnstreamer.h)
  */
 int
-ml_pipeline_destroy (ml_pipeline_h pipe)
+ml_pipeline_src_release_handle (ml_pipeline_src_h h)
 {
-  ml_pipeline *p = pipe;
-  GstStateChangeReturn scret;
-  GstState state;
-  guint check_paused_cnt = 0;
-
-  check_feature_state ();
-
-  if (p == NULL)
-    return ML_ERROR_INVALID_PARAMETER;
-
-  g_mutex_lock (&p->lock);
+  handle_init (src, h);
 
-  /* Before changing the state, remove all callbacks. */
-  p->state_cb.cb = NULL;
+  src_release_handle (elem, src);
 
-  g_hash_table_remove_all (p->namednodes);
-  g_hash_table_remove_all (p->resources);
+  handle_exit (h);
+}
 
-  if (p->element) {
-    /* Pause the pipeline if it's playing */
-    scret = gst_element_get_state (p->element, &state, NULL, 10 * GST_MSECOND); /* 10ms */
-    if (scret != GST_STATE_CHANGE_FAILURE && state == GST_STATE_PLAYING) {
-      scret = gst_element_set_state (p->element, GST_STATE_PAUSED);
-      if (scret == GST_STATE_CHANGE_FAILURE) {
-        g_mutex_unlock (&p->lock);
-        _ml_loge
-            ("Failed to wait until state changed PLAYING to PAUSED. For the detail, please check the GStreamer log messages.");
-        return ML_ERROR_STREAMS_PIPE;
-      }
-    }
+/**
+ * @brief Internal function to wait until the queue of src element needs data.
+ * @note This function should be called with element lock, but without pipeline lock. The element lock is released while waiting.
+ */
+static int
+ml_pipeline_src_wait_need_data (ml_pipeline_element * elem,
+    ml_pipeline_common_elem * src)
+{
+  gint64 end_time;
+  gboolean timed_out = FALSE;
+  guint32 id;
 
-    g_mutex_unlock (&p->lock);
-    while (p->pipe_state == ML_PIPELINE_STATE_PLAYING) {
-      check_paused_cnt++;
-      /** check PAUSED every 1ms */
-      g_usleep (1000);
-      if (check_paused_cnt >= WAIT_PAUSED_TIME_LIMIT) {
-        _ml_loge ("Failed to wait until state changed to PAUSED");
-        break;
-      }
-    }
-    g_mutex_lock (&p->lock);
+  if (!elem->src_blocking || !elem->src_enough_data)
+    return ML_ERROR_NONE;
 
-    /* Stop (NULL State) the pipeline */
-    scret = gst_element_set_state (p->element, GST_STATE_NULL);
-    if (scret != GST_STATE_CHANGE_SUCCESS) {
-      g_mutex_unlock (&p->lock);
-      _ml_loge
-          ("Failed to wait until state changed to NULL(STOP). For the detail, please check the GStreamer log messages.");
-      return ML_ERROR_STREAMS_PIPE;
-    }
+  /* the handle may be released while waiting, do not access it after waiting */
+  id = src->id;
 
-    if (p->bus) {
-      g_signal_handler_disconnect (p->bus, p->signal_msg);
-      gst_object_unref (p->bus);
+  if (elem->src_timeout == 0) {
+    _ml_logd ("The queue of src [%s] is full.", elem->name);
+    return ML_ERROR_TRY_AGAIN;
+  }
+
+  end_time = g_get_monotonic_time () +
+      (gint64) elem->src_timeout * G_TIME_SPAN_MILLISECOND;
+
+  while (elem->src_blocking && elem->src_enough_data && !elem->src_closing) {
+    if (!g_cond_wait_until (&elem->src_cond, &elem->lock, end_time)) {
+      timed_out = TRUE;
+      break;
     }
+  }
 
-    gst_object_unref (p->element);
-    p->element = NULL;
+  /* the pipeline may be changed while waiting */
+  if (elem->src_closing) {
+    _ml_logw ("The src [%s] is released while waiting for the queue.",
+        elem->name);
+    return ML_ERROR_STREAMS_PIPE;
   }
 
-  /* Destroy registered callback handles and resources */
-  g_hash_table_destroy (p->namednodes);
-  g_hash_table_destroy (p->resources);
-  p->namednodes = p->resources = NULL;
+  if (find_element_handle (elem, id) != src) {
+    _ml_loge ("The handle of src [%s] is released while waiting.",
+        elem->name);
+    return ML_ERROR_INVALID_PARAMETER;
+  }
 
-  g_mutex_unlock (&p->lock);
-  g_mutex_clear (&p->lock);
+  if (timed_out && elem->src_blocking && elem->src_enough_data) {
+    _ml_logw ("Timed out while waiting for the queue of src [%s].",
+        elem->name);
+    return ML_ERROR_TIMED_OUT;
+  }
 
-  g_free (p);
   return ML_ERROR_NONE;
 }
 
 /**
- * @brief Get the pipeline state (more info in nnstreamer.h)
+ * @brief Releases the single block of tensors pushed with auto-free policy.
  */
-int
-ml_pipeline_get_state (ml_pipeline_h pipe, ml_pipeline_state_e * state)
+static void
+src_free_block_cb (ml_tensors_data_h data, void *user_data)
 {
-  ml_pipeline *p = pipe;
-  GstState _state;
-  GstStateChangeReturn scret;
+  g_free (data);
+}
 
-  check_feature_state ();
+/**
+ * @brief Internal function to push a data frame to a src, with the tag to pair the output.
+ * @note This function should be called with the pipeline lock and element lock, and releases both locks.
+ */
+static int
+src_push_data (ml_pipeline * p, ml_pipeline_element * elem,
+    ml_pipeline_common_elem * src, ml_tensors_data_h data,
+    ml_pipeline_buf_policy_e policy, const guint64 * tag)
+{
+  GstBuffer *buffer;
+  GstMemory *mem;
+  gpointer mem_data;
+  gsize mem_size;
+  GstFlowReturn gret;
+  ml_tensors_data_s *_data;
+  ml_pipeline_src_frame_s *frame = NULL;
+  const ml_tensors_info_interned_s *interned;
+  gboolean is_flex = FALSE;
+  unsigned int i;
+  int ret = ML_ERROR_NONE;
 
-  if (p == NULL || state == NULL)
-    return ML_ERROR_INVALID_PARAMETER;
+  /**
+   * Release the pipeline lock, the push may wait for the queue of src element.
+   * The element is not released until the push is done. (See cleanup_node())
+   */
+  elem->src_users++;
+  g_mutex_unlock (&p->lock);
 
-  *state = ML_PIPELINE_STATE_UNKNOWN;
+  _data = (ml_tensors_data_s *) data;
+  if (!_data) {
+    _ml_loge ("The given param data is invalid.");
+    ret = ML_ERROR_INVALID_PARAMETER;
+    goto push_done;
+  }
 
-  g_mutex_lock (&p->lock);
-  scret = gst_element_get_state (p->element, &_state, NULL, GST_MSECOND);       /* Do it within 1ms! */
-  g_mutex_unlock (&p->lock);
+  /* Blocking mode, wait for the credit of src queue. */
+  ret = ml_pipeline_src_wait_need_data (elem, src);
+  if (ret != ML_ERROR_NONE)
+    goto push_done;
 
-  if (scret == GST_STATE_CHANGE_FAILURE) {
+  G_LOCK_UNLESS_NOLOCK (*_data);
+
+  if (_data->num_tensors < 1 || _data->num_tensors > ML_TENSOR_SIZE_LIMIT) {
     _ml_loge
-        ("Failed to get the state of the pipeline. For the detail, please check the GStreamer log messages.");
-    return ML_ERROR_STREAMS_PIPE;
+        ("The tensor size is invalid. It should be 1 ~ %u; where it is %u",
+        ML_TENSOR_SIZE_LIMIT, _data->num_tensors);
+    ret = ML_ERROR_INVALID_PARAMETER;
+    goto dont_destroy_data;
   }
 
-  *state = (ml_pipeline_state_e) _state;
-  return ML_ERROR_NONE;
-}
+  if (policy == ML_PIPELINE_BUF_POLICY_AUTO_FREE && (_data->allocator.free ||
+          _data->shared)) {
+    _ml_loge
+        ("The data allocated with the custom allocator or shared with other handles cannot be freed by the pipeline. Use ML_PIPELINE_BUF_POLICY_DO_NOT_FREE.");
+    ret = ML_ERROR_INVALID_PARAMETER;
+    goto dont_destroy_data;
+  }
 
-/****************************************************
- ** NNStreamer Pipeline Start/Stop Control         **
- ****************************************************/
-/**
- * @brief Start/Resume the pipeline! (more info in nnstreamer.h)
- */
-int
-ml_pipeline_start (ml_pipeline_h pipe)
-{
-  ml_pipeline *p = pipe;
-  GstStateChangeReturn scret;
-  int status = ML_ERROR_NONE;
+  ret = ml_pipeline_src_parse_tensors_info (elem);
 
-  check_feature_state ();
+  if (ret != ML_ERROR_NONE) {
+    _ml_logw
+        ("The pipeline is not ready to accept inputs. The input is ignored.");
+    goto dont_destroy_data;
+  }
 
-  if (p == NULL)
-    return ML_ERROR_INVALID_PARAMETER;
+  if (!elem->is_media_stream && !elem->is_flexible_tensor) {
+    if (elem->tensors_info.num_tensors != _data->num_tensors) {
+      _ml_loge
+          ("The src push of [%s] cannot be handled because the number of tensors in a frame mismatches. %u != %u",
+          elem->name, elem->tensors_info.num_tensors, _data->num_tensors);
 
-  g_mutex_lock (&p->lock);
+      ret = ML_ERROR_INVALID_PARAMETER;
+      goto dont_destroy_data;
+    }
 
-  /* check the resources when starting the pipeline */
-  if (g_hash_table_size (p->resources)) {
-    GHashTableIter iter;
-    gpointer key, value;
+    /* the size of each tensor is computed once for the negotiated info */
+    interned = _ml_tensors_info_get_interned (&elem->tensors_info);
 
-    /* iterate all handle and acquire res if released */
-    g_hash_table_iter_init (&iter, p->resources);
-    while (g_hash_table_iter_next (&iter, &key, &value)) {
-      if (g_str_has_prefix (key, "tizen")) {
-        status = get_tizen_resource (pipe, key);
-        if (status != ML_ERROR_NONE)
-          goto done;
+    for (i = 0; i < elem->tensors_info.num_tensors; i++) {
+      size_t sz = (interned) ? interned->size[i] :
+          _ml_tensor_info_get_size (&elem->tensors_info.info[i]);
+
+      if (sz != _data->tensors[i].size) {
+        _ml_loge
+            ("The given input tensor size (%d'th, %zu bytes) mismatches the source pad (%zu bytes)",
+            i, _data->tensors[i].size, sz);
+
+        ret = ML_ERROR_INVALID_PARAMETER;
+        goto dont_destroy_data;
       }
     }
   }
 
-  scret = gst_element_set_state (p->element, GST_STATE_PLAYING);
-  if (scret == GST_STATE_CHANGE_FAILURE) {
-    _ml_loge
-        ("Failed to set the state of the pipeline to PLAYING. For the detail, please check the GStreamer log messages.");
-    status = ML_ERROR_STREAMS_PIPE;
+  if (elem->is_flexible_tensor) {
+    ret = ml_pipeline_src_prepare_flex_header (elem, _data->info);
+    if (ret != ML_ERROR_NONE)
+      goto dont_destroy_data;
   }
 
-done:
-  g_mutex_unlock (&p->lock);
-  return status;
+  /* Get a frame from the pool to notify the data is released. */
+  if (policy == ML_PIPELINE_BUF_POLICY_DO_NOT_FREE && src->callback_info &&
+      src->callback_info->release_cb) {
+    frame = src_pool_get_frame (elem);
+
+    frame->mem_count = (elem->is_flexible_tensor) ? 1 : _data->num_tensors;
+    frame->data = data;
+    frame->cb = src->callback_info->release_cb;
+    frame->pdata = src->callback_info->release_pdata;
+  } else if (policy == ML_PIPELINE_BUF_POLICY_AUTO_FREE &&
+      (_data->alloc_flags & ML_TENSORS_DATA_FLAG_CONTIGUOUS)) {
+    /* The tensors share a single block, free it when all memories are released. */
+    frame = src_pool_get_frame (elem);
+
+    frame->mem_count = (elem->is_flexible_tensor) ? 1 : _data->num_tensors;
+    frame->data = _data->tensors[0].tensor;
+    frame->cb = src_free_block_cb;
+    frame->pdata = NULL;
+  }
+
+  /* Create buffer to be pushed from buf[] */
+  buffer = gst_buffer_new ();
+  is_flex = elem->is_flexible_tensor;
+
+  for (i = 0; i < _data->num_tensors; i++) {
+    mem_data = _data->tensors[i].tensor;
+    mem_size = _data->tensors[i].size;
+
+    if (elem->is_flexible_tensor) {
+      GstMapInfo map;
+      gsize hsize = elem->flex_header_size[i];
+
+      /* flex tensor, copy the cached header and data into a single memory. */
+      mem = gst_allocator_alloc (NULL, hsize + mem_size, NULL);
+      gst_memory_map (mem, &map, GST_MAP_WRITE);
+      memcpy (map.data, elem->flex_header[i], hsize);
+      memcpy (map.data + hsize, mem_data, mem_size);
+      gst_memory_unmap (mem, &map);
+
+      if (policy == ML_PIPELINE_BUF_POLICY_AUTO_FREE && !frame)
+        g_free (mem_data);
+    } else if (frame) {
+      mem = gst_memory_new_wrapped (GST_MEMORY_FLAG_READONLY,
+          mem_data, mem_size, 0, mem_size, frame, src_pool_release_frame);
+    } else {
+      mem = gst_memory_new_wrapped (GST_MEMORY_FLAG_READONLY,
+          mem_data, mem_size, 0, mem_size, mem_data,
+          (policy == ML_PIPELINE_BUF_POLICY_AUTO_FREE) ? g_free : NULL);
+    }
+
+    gst_buffer_append_memory (buffer, mem);
+    /** @todo Verify that gst_buffer_append lists tensors/gstmem in the correct order */
+  }
+
+  stamp_ingress_time (buffer);
+  if (tag)
+    stamp_buffer_tag (buffer, *tag);
+
+  /* Unlock if it's not auto-free. We do not know when it'll be freed. */
+  if (policy != ML_PIPELINE_BUF_POLICY_AUTO_FREE)
+    G_UNLOCK_UNLESS_NOLOCK (*_data);
+
+  /**
+   * Push the data!
+   * appsrc may call enough-data callback in this thread, release the element lock.
+   * The element is not released while pushing. (See src_users)
+   */
+  g_mutex_unlock (&elem->lock);
+  gret = gst_app_src_push_buffer (GST_APP_SRC (elem->element), buffer);
+  g_mutex_lock (&elem->lock);
+
+  /* Free data ptr if buffer policy is auto-free */
+  if (policy == ML_PIPELINE_BUF_POLICY_AUTO_FREE) {
+    G_UNLOCK_UNLESS_NOLOCK (*_data);
+    _ml_tensors_data_destroy_internal (_data, FALSE);
+    _data = NULL;
+  }
+
+  if (gret == GST_FLOW_FLUSHING) {
+    _ml_logw
+        ("The pipeline is not in PAUSED/PLAYING. The input may be ignored.");
+    ret = ML_ERROR_TRY_AGAIN;
+  } else if (gret == GST_FLOW_EOS) {
+    _ml_logw ("THe pipeline is in EOS state. The input is ignored.");
+    ret = ML_ERROR_STREAMS_PIPE;
+  }
+
+  goto push_done;
+
+dont_destroy_data:
+  G_UNLOCK_UNLESS_NOLOCK (*_data);
+
+push_done:
+  /* the pipeline lock is already released, wake up the element cleanup */
+  elem->src_users--;
+  if (elem->src_closing)
+    g_cond_broadcast (&elem->src_cond);
+  g_mutex_unlock (&elem->lock);
+
+  /**
+   * Flex tensor, the data is already copied into the buffer.
+   * Release the frame without the locks, the callback may access the data or pipeline.
+   */
+  if (frame && is_flex)
+    src_pool_release_frame (frame);
+
+  return ret;
 }
 
 /**
- * @brief Pause the pipeline! (more info in nnstreamer.h)
+ * @brief Push a data frame to a src (more info in nnstreamer.h)
  */
 int
-ml_pipeline_stop (ml_pipeline_h pipe)
+ml_pipeline_src_input_data (ml_pipeline_src_h h, ml_tensors_data_h data,
+    ml_pipeline_buf_policy_e policy)
 {
-  ml_pipeline *p = pipe;
-  GstStateChangeReturn scret;
+  handle_init (src, h);
 
-  check_feature_state ();
+  /* the push releases the locks */
+  return src_push_data (p, elem, src, data, policy, NULL);
 
-  if (p == NULL)
-    return ML_ERROR_INVALID_PARAMETER;
+  handle_exit (h);
+}
 
-  g_mutex_lock (&p->lock);
-  scret = gst_element_set_state (p->element, GST_STATE_PAUSED);
-  g_mutex_unlock (&p->lock);
+/**
+ * @brief Internal function for appsrc callback - need_data.
+ */
+static void
+_pipe_src_cb_need_data (GstAppSrc * src, guint length, gpointer user_data)
+{
+  ml_pipeline_common_elem *src_h;
+  ml_pipeline_element *elem;
+  ml_pipeline_src_callbacks_s *src_cb = NULL;
 
-  if (scret == GST_STATE_CHANGE_FAILURE) {
-    _ml_loge
-        ("Failed to set the state of the pipeline to PAUSED. For the detail, please check the GStreamer log messages.");
-    return ML_ERROR_STREAMS_PIPE;
-  }
+  src_h = (ml_pipeline_common_elem *) user_data;
+  if (src_h) {
+    elem = src_h->element;
 
-  return ML_ERROR_NONE;
+    g_mutex_lock (&elem->lock);
+    if (src_h->callback_info)
+      src_cb = &src_h->callback_info->src_cb;
+
+    /* wake up the waiting push */
+    elem->src_enough_data = FALSE;
+    g_cond_broadcast (&elem->src_cond);
+    g_mutex_unlock (&elem->lock);
+
+    if (src_cb && src_cb->need_data)
+      src_cb->need_data (src_h, length, src_h->callback_info->pdata);
+  }
 }
 
 /**
- * @brief Clears all data and resets the running-time of the pipeline (more info in nnstreamer.h)
+ * @brief Internal function for appsrc callback - enough_data.
  */
-int
-ml_pipeline_flush (ml_pipeline_h pipe, bool start)
+static void
+_pipe_src_cb_enough_data (GstAppSrc * src, gpointer user_data)
 {
-  ml_pipeline *p = pipe;
-  int status;
-
-  check_feature_state ();
-
-  if (p == NULL)
-    return ML_ERROR_INVALID_PARAMETER;
+  ml_pipeline_common_elem *src_h;
+  ml_pipeline_element *elem;
+  ml_pipeline_src_callbacks_s *src_cb = NULL;
 
-  status = ml_pipeline_stop (pipe);
-  if (status != ML_ERROR_NONE)
-    return status;
+  src_h = (ml_pipeline_common_elem *) user_data;
+  if (src_h) {
+    elem = src_h->element;
 
-  _ml_logi ("The pipeline is stopped, clear all data from the pipeline.");
+    g_mutex_lock (&elem->lock);
+    if (src_h->callback_info)
+      src_cb = &src_h->callback_info->src_cb;
 
-  /* send flush event to pipeline */
-  g_mutex_lock (&p->lock);
-  if (!gst_element_send_event (p->element, gst_event_new_flush_start ())) {
-    _ml_logw ("Error occurs while sending flush_start event.");
-  }
+    elem->src_enough_data = TRUE;
+    g_mutex_unlock (&elem->lock);
 
-  if (!gst_element_send_event (p->element, gst_event_new_flush_stop (TRUE))) {
-    _ml_logw ("Error occurs while sending flush_stop event.");
+    if (src_cb && src_cb->enough_data)
+      src_cb->enough_data (src_h, src_h->callback_info->pdata);
   }
-  g_mutex_unlock (&p->lock);
-
-  if (start && status == ML_ERROR_NONE)
-    status = ml_pipeline_start (pipe);
-
-  return status;
 }
 
-/****************************************************
- ** NNStreamer Pipeline Sink/Src Control           **
- ****************************************************/
 /**
- * @brief Register a callback for sink (more info in nnstreamer.h)
+ * @brief Internal function for appsrc callback - seek_data.
  */
-int
-ml_pipeline_sink_register (ml_pipeline_h pipe, const char *sink_name,
-    ml_pipeline_sink_cb cb, void *user_data, ml_pipeline_sink_h * h)
+static gboolean
+_pipe_src_cb_seek_data (GstAppSrc * src, guint64 offset, gpointer user_data)
 {
+  ml_pipeline_common_elem *src_h;
   ml_pipeline_element *elem;
-  ml_pipeline *p = pipe;
-  ml_pipeline_common_elem *sink;
-  int ret = ML_ERROR_NONE;
+  ml_pipeline_src_callbacks_s *src_cb = NULL;
 
-  check_feature_state ();
+  src_h = (ml_pipeline_common_elem *) user_data;
+  if (src_h) {
+    elem = src_h->element;
 
-  if (h == NULL) {
-    _ml_loge ("The argument sink handle is not valid.");
-    return ML_ERROR_INVALID_PARAMETER;
+    g_mutex_lock (&elem->lock);
+    if (src_h->callback_info)
+      src_cb = &src_h->callback_info->src_cb;
+    g_mutex_unlock (&elem->lock);
+
+    if (src_cb && src_cb->seek_data)
+      src_cb->seek_data (src_h, offset, src_h->callback_info->pdata);
   }
 
-  /* init null */
-  *h = NULL;
+  return TRUE;
+}
 
-  if (pipe == NULL) {
-    _ml_loge ("The first argument, pipeline handle is not valid.");
-    return ML_ERROR_INVALID_PARAMETER;
-  }
+/**
+ * @brief Internal function to set appsrc callbacks with given src handle.
+ * @note This function should be called with element lock.
+ */
+static void
+ml_pipeline_src_install_callbacks (ml_pipeline_common_elem * src_h)
+{
+  GstAppSrcCallbacks appsrc_cb = { 0, };
 
-  if (sink_name == NULL) {
-    _ml_loge ("The second argument, sink name is not valid.");
-    return ML_ERROR_INVALID_PARAMETER;
-  }
+  appsrc_cb.need_data = _pipe_src_cb_need_data;
+  appsrc_cb.enough_data = _pipe_src_cb_enough_data;
+  appsrc_cb.seek_data = _pipe_src_cb_seek_data;
 
-  if (cb == NULL) {
-    _ml_loge ("The callback argument, cb, is not valid.");
-    return ML_ERROR_INVALID_PARAMETER;
-  }
+  gst_app_src_set_callbacks (GST_APP_SRC (src_h->element->element),
+      &appsrc_cb, src_h, NULL);
+}
 
-  g_mutex_lock (&p->lock);
-  elem = g_hash_table_lookup (p->namednodes, sink_name);
+/**
+ * @brief Register callbacks for src events (more info in nnstreamer.h)
+ */
+int
+ml_pipeline_src_set_event_cb (ml_pipeline_src_h src_handle,
+    ml_pipeline_src_callbacks_s * cb, void *user_data)
+{
+  handle_init (src, src_handle);
 
-  if (elem == NULL) {
-    _ml_loge ("There is no element named [%s] in the pipeline.", sink_name);
+  if (cb == NULL) {
     ret = ML_ERROR_INVALID_PARAMETER;
     goto unlock_return;
   }
 
-  if (elem->type != ML_PIPELINE_ELEMENT_SINK &&
-      elem->type != ML_PIPELINE_ELEMENT_APP_SINK) {
-    _ml_loge ("The element [%s] in the pipeline is not a sink element.",
-        sink_name);
-    ret = ML_ERROR_INVALID_PARAMETER;
+  if (src->callback_info == NULL)
+    src->callback_info = g_new0 (callback_info_s, 1);
+  if (src->callback_info == NULL) {
+    _ml_loge ("Failed to allocate the callback info for %s.", elem->name);
+    ret = ML_ERROR_OUT_OF_MEMORY;
     goto unlock_return;
   }
 
-  if (elem->handle_id > 0) {
-    /* no need to connect signal to sink element */
-    _ml_logw ("Sink callback is already registered.");
-  } else {
-    /* set callback for new data */
-    if (elem->type == ML_PIPELINE_ELEMENT_SINK) {
-      /* tensor_sink */
-      g_object_set (G_OBJECT (elem->element), "emit-signal", (gboolean) TRUE,
-          NULL);
-      elem->handle_id =
-          g_signal_connect (elem->element, "new-data",
-          G_CALLBACK (cb_sink_event), elem);
-    } else {
-      /* appsink */
-      g_object_set (G_OBJECT (elem->element), "emit-signals", (gboolean) TRUE,
-          NULL);
-      elem->handle_id =
-          g_signal_connect (elem->element, "new-sample",
-          G_CALLBACK (cb_appsink_new_sample), elem);
-    }
+  src->callback_info->src_cb = *cb;
+  src->callback_info->pdata = user_data;
 
-    if (elem->handle_id == 0) {
-      _ml_loge ("Failed to connect a signal to the element [%s].", sink_name);
-      ret = ML_ERROR_STREAMS_PIPE;
+  ml_pipeline_src_install_callbacks (src);
+
+  handle_exit (src_handle);
+}
+
+/**
+ * @brief Sets the queue limit of src node and the blocking mode of data push (more info in nnstreamer.h)
+ */
+int
+ml_pipeline_src_set_queue_limit (ml_pipeline_src_h src_handle,
+    uint64_t max_bytes, uint64_t max_frames, unsigned int timeout_ms)
+{
+  guint64 limit_bytes;
+
+  handle_init (src, src_handle);
+
+  limit_bytes = max_bytes;
+
+#if GST_CHECK_VERSION(1, 20, 0)
+  if (max_frames == 0)
+    reset_element_property (elem->element, "max-buffers");
+#endif
+
+  if (max_frames > 0) {
+#if GST_CHECK_VERSION(1, 20, 0)
+    g_object_set (G_OBJECT (elem->element), "max-buffers", (guint64) max_frames,
+        NULL);
+#else
+    /* appsrc does not support the limit of buffers, convert it to bytes. */
+    ret = ml_pipeline_src_parse_tensors_info (elem);
+    if (ret != ML_ERROR_NONE || elem->size == 0) {
+      _ml_loge
+          ("Cannot set the frame limit of src [%s], the frame size is unknown.",
+          elem->name);
+      ret = ML_ERROR_NOT_SUPPORTED;
       goto unlock_return;
     }
-  }
 
-  sink = g_new0 (ml_pipeline_common_elem, 1);
-  if (sink == NULL) {
-    _ml_loge ("Failed to allocate the sink handle for %s.", sink_name);
-    ret = ML_ERROR_OUT_OF_MEMORY;
-    goto unlock_return;
+    if (limit_bytes == 0 || limit_bytes > max_frames * elem->size)
+      limit_bytes = max_frames * elem->size;
+#endif
   }
 
-  sink->callback_info = g_new0 (callback_info_s, 1);
-  if (sink->callback_info == NULL) {
-    g_free (sink);
-    _ml_loge ("Failed to allocate the sink handle for %s.", sink_name);
+  if (src->callback_info == NULL)
+    src->callback_info = g_new0 (callback_info_s, 1);
+  if (src->callback_info == NULL) {
+    _ml_loge ("Failed to allocate the callback info for %s.", elem->name);
     ret = ML_ERROR_OUT_OF_MEMORY;
     goto unlock_return;
   }
 
-  sink->pipe = p;
-  sink->element = elem;
-  sink->callback_info->sink_cb = cb;
-  sink->callback_info->pdata = user_data;
-  *h = sink;
-
-  g_mutex_lock (&elem->lock);
+  if (max_bytes == 0 && max_frames == 0) {
+    /* disabled, restore the default queue of appsrc */
+    reset_element_property (elem->element, "max-bytes");
+  } else {
+    /* 0 means unlimited bytes in appsrc, the frames are limited */
+    g_object_set (G_OBJECT (elem->element), "max-bytes", limit_bytes, NULL);
+  }
 
-  elem->maxid++;
-  sink->id = elem->maxid;
-  elem->handles = g_list_append (elem->handles, sink);
+  elem->src_blocking = (max_bytes > 0 || max_frames > 0);
+  elem->src_timeout = timeout_ms;
+  elem->src_enough_data = FALSE;
+  g_cond_broadcast (&elem->src_cond);
 
-  g_mutex_unlock (&elem->lock);
+  /* flow notification is required to wake up the waiting push */
+  ml_pipeline_src_install_callbacks (src);
 
-unlock_return:
-  g_mutex_unlock (&p->lock);
-  return ret;
+  handle_exit (src_handle);
 }
 
 /**
- * @brief Unregister a callback for sink (more info in nnstreamer.h)
+ * @brief Register a callback to release the pushed data (more info in nnstreamer.h)
  */
 int
-ml_pipeline_sink_unregister (ml_pipeline_sink_h h)
+ml_pipeline_src_set_release_cb (ml_pipeline_src_h src_handle,
+    ml_pipeline_src_release_cb cb, void *user_data)
 {
-  handle_init (sink, h);
+  handle_init (src, src_handle);
 
-  if (elem->handle_id > 0) {
-    g_signal_handler_disconnect (elem->element, elem->handle_id);
-    elem->handle_id = 0;
+  if (src->callback_info == NULL)
+    src->callback_info = g_new0 (callback_info_s, 1);
+  if (src->callback_info == NULL) {
+    _ml_loge ("Failed to allocate the callback info for %s.", elem->name);
+    ret = ML_ERROR_OUT_OF_MEMORY;
+    goto unlock_return;
   }
 
-  elem->handles = g_list_remove (elem->handles, sink);
-  free_element_handle (sink);
+  src->callback_info->release_cb = cb;
+  src->callback_info->release_pdata = user_data;
 
-  handle_exit (h);
+  handle_exit (src_handle);
 }
 
 /**
- * @brief Parse tensors info of src element.
+ * @brief Gets a handle for the tensors metadata of given src node.
  */
-static int
-ml_pipeline_src_parse_tensors_info (ml_pipeline_element * elem)
+int
+ml_pipeline_src_get_tensors_info (ml_pipeline_src_h h, ml_tensors_info_h * info)
 {
-  int ret = ML_ERROR_NONE;
-  ml_tensors_info_s *_info = &elem->tensors_info;
-
-  if (elem->src == NULL) {
-    elem->src = gst_element_get_static_pad (elem->element, "src");
-    elem->size = 0;
+  handle_init (src, h);
 
-    if (elem->src == NULL) {
-      _ml_loge
-          ("Failed to get the src pad of the element[%s]. For the detail, please check the GStreamer log messages.",
-          elem->name);
-      ret = ML_ERROR_STREAMS_PIPE;
-    } else {
-      GstCaps *caps = gst_pad_get_allowed_caps (elem->src);
-      guint i;
-      gboolean found, flexible;
-      size_t sz;
+  if (info == NULL) {
+    ret = ML_ERROR_INVALID_PARAMETER;
+    goto unlock_return;
+  }
 
-      found = flexible = FALSE;
-      if (caps) {
-        found = get_tensors_info_from_caps (caps, _info, &flexible);
+  ret = ml_pipeline_src_parse_tensors_info (elem);
 
-        if (!found && gst_caps_is_fixed (caps)) {
-          GstStructure *st = gst_caps_get_structure (caps, 0);
+  if (ret == ML_ERROR_NONE) {
+    ml_tensors_info_create (info);
+    ml_tensors_info_clone (*info, &elem->tensors_info);
+  }
 
-          if (!gst_structure_is_tensor_stream (st))
-            elem->is_media_stream = TRUE;
-        } else if (found && flexible) {
-          /* flexible tensor, cannot get exact info from caps. */
-          elem->is_flexible_tensor = TRUE;
-        }
+  handle_exit (h);
+}
 
-        gst_caps_unref (caps);
-      }
+/****************************************************
+ ** NNStreamer Pipeline Batch                      **
+ ****************************************************/
 
-      if (found && !flexible) {
-        for (i = 0; i < _info->num_tensors; i++) {
-          sz = _ml_tensor_info_get_size (&_info->info[i]);
-          elem->size += sz;
-        }
-      } else {
-        if (!elem->is_media_stream && !elem->is_flexible_tensor) {
-          _ml_logw
-              ("Cannot find caps. The pipeline is not yet negotiated for src element [%s].",
-              elem->name);
-          gst_object_unref (elem->src);
-          elem->src = NULL;
-          ret = ML_ERROR_TRY_AGAIN;
-        }
-      }
-    }
+/**
+ * @brief The max number of released frames kept in the batch.
+ */
+#define BATCH_MAX_FREE_FRAMES 4
+
+/**
+ * @brief Internal function to get the index of batch dimension, including the extended rank.
+ * @return The index of the outermost dimension larger than 1, or -1 if the dimension is not batched.
+ * With single stream, this returns ML_TENSOR_RANK_LIMIT_EXTENDED (the tensor is passed through without the batch dimension).
+ */
+static int
+batch_get_dim_index (const ml_tensor_info_s * info, guint num_streams)
+{
+  unsigned int dim;
+  int d;
+
+  if (num_streams == 1)
+    return ML_TENSOR_RANK_LIMIT_EXTENDED;
+
+  for (d = ML_TENSOR_RANK_LIMIT_EXTENDED - 1; d >= 0; d--) {
+    dim = _ml_tensor_info_get_dimension (info, d);
+    if (dim > 1)
+      return (dim == num_streams) ? d : -1;
   }
 
-  return ret;
+  /* all dimensions are 1 */
+  return -1;
 }
 
 /**
- * @brief Get a handle to operate a src (more info in nnstreamer.h)
+ * @brief Internal function to release the mask of batched frame.
  */
-int
-ml_pipeline_src_get_handle (ml_pipeline_h pipe, const char *src_name,
-    ml_pipeline_src_h * h)
+static void
+batch_free_mask (gpointer data)
 {
-  ml_pipeline *p = pipe;
-  ml_pipeline_element *elem;
-  ml_pipeline_common_elem *src;
-  int ret = ML_ERROR_NONE;
-
-  check_feature_state ();
+  ml_pipeline_batch_mask_s *mask = (ml_pipeline_batch_mask_s *) data;
 
-  if (h == NULL) {
-    _ml_loge ("The argument source handle is not valid.");
-    return ML_ERROR_INVALID_PARAMETER;
-  }
+  g_free (mask->filled);
+  g_free (mask);
+}
 
-  /* init null */
-  *h = NULL;
+/**
+ * @brief Internal function to compare the sequence number of batched frame.
+ */
+static gint
+batch_compare_mask (gconstpointer a, gconstpointer b)
+{
+  const ml_pipeline_batch_mask_s *mask = (const ml_pipeline_batch_mask_s *) a;
 
-  if (pipe == NULL) {
-    _ml_loge ("The first argument, pipeline handle is not valid.");
-    return ML_ERROR_INVALID_PARAMETER;
-  }
+  return (mask->seq == *(const guint64 *) b) ? 0 : 1;
+}
 
-  if (src_name == NULL) {
-    _ml_loge ("The second argument, source name is not valid.");
-    return ML_ERROR_INVALID_PARAMETER;
-  }
+/**
+ * @brief Internal function to release the reference of batch.
+ */
+static void
+batch_unref (ml_pipeline_batch_s * b)
+{
+  ml_tensors_data_h data;
 
-  g_mutex_lock (&p->lock);
+  if (!g_atomic_int_dec_and_test (&b->ref_count))
+    return;
 
-  elem = g_hash_table_lookup (p->namednodes, src_name);
+  while ((data = g_queue_pop_head (&b->masks)) != NULL)
+    batch_free_mask (data);
+  while ((data = g_queue_pop_head (&b->free_data)) != NULL)
+    ml_tensors_data_destroy (data);
+
+  if (b->in_info)
+    ml_tensors_info_destroy (b->in_info);
+  if (b->out_info)
+    ml_tensors_info_destroy (b->out_info);
+
+  g_free (b->filled);
+  g_cond_clear (&b->cond);
+  g_mutex_clear (&b->lock);
+  g_mutex_clear (&b->queue_lock);
+  g_free (b);
+}
 
-  if (elem == NULL) {
-    _ml_loge ("There is no element named [%s] in the pipeline.", src_name);
-    ret = ML_ERROR_INVALID_PARAMETER;
-    goto unlock_return;
+/**
+ * @brief Internal function to keep the released frame for next batch.
+ */
+static void
+batch_recycle_data (ml_pipeline_batch_s * b, ml_tensors_data_h data)
+{
+  g_mutex_lock (&b->queue_lock);
+  if (g_queue_get_length (&b->free_data) < BATCH_MAX_FREE_FRAMES) {
+    g_queue_push_head (&b->free_data, data);
+    data = NULL;
   }
+  g_mutex_unlock (&b->queue_lock);
 
-  if (elem->type != ML_PIPELINE_ELEMENT_APP_SRC) {
-    _ml_loge ("The element [%s] in the pipeline is not a source element.",
-        src_name);
-    ret = ML_ERROR_INVALID_PARAMETER;
-    goto unlock_return;
-  }
+  if (data)
+    ml_tensors_data_destroy (data);
+}
 
-  src = *h = g_new0 (ml_pipeline_common_elem, 1);
-  if (src == NULL) {
-    _ml_loge ("Failed to allocate the src handle for %s.", src_name);
-    ret = ML_ERROR_OUT_OF_MEMORY;
-    goto unlock_return;
-  }
+/**
+ * @brief Callback for the frame released from the pipeline.
+ */
+static void
+batch_release_cb (ml_tensors_data_h data, void *user_data)
+{
+  ml_pipeline_batch_s *b = (ml_pipeline_batch_s *) user_data;
 
-  src->pipe = p;
-  src->element = elem;
+  g_mutex_lock (&b->queue_lock);
+  if (b->pushing == data)
+    b->pushing = NULL;
+  g_mutex_unlock (&b->queue_lock);
 
-  g_mutex_lock (&elem->lock);
+  batch_recycle_data (b, data);
+  batch_unref (b);
+}
 
-  elem->maxid++;
-  src->id = elem->maxid;
-  elem->handles = g_list_append (elem->handles, src);
+/**
+ * @brief Internal function to find the handle of batch, and lock the pipeline and element if found.
+ * @return The handle, NULL if the pipeline released the handle (e.g., ml_pipeline_reset()).
+ */
+static ml_pipeline_common_elem *
+batch_lock_handle (ml_pipeline_batch_s * b, ml_pipeline_element * elem,
+    guint32 id)
+{
+  ml_pipeline_common_elem *h;
 
-  ml_pipeline_src_parse_tensors_info (elem);
-  g_mutex_unlock (&elem->lock);
+  g_mutex_lock (&b->pipe->lock);
+  g_mutex_lock (&elem->lock);
 
-unlock_return:
-  g_mutex_unlock (&p->lock);
+  h = find_element_handle (elem, id);
+  if (h == NULL) {
+    g_mutex_unlock (&elem->lock);
+    g_mutex_unlock (&b->pipe->lock);
+  }
 
-  return ret;
+  return h;
 }
 
 /**
- * @brief Close a src node (more info in nnstreamer.h)
+ * @brief Internal function to check the handles of batch are not released by the pipeline.
  */
-int
-ml_pipeline_src_release_handle (ml_pipeline_src_h h)
+static gboolean
+batch_has_handles (ml_pipeline_batch_s * b)
 {
-  handle_init (src, h);
+  ml_pipeline_common_elem *h;
 
-  elem->handles = g_list_remove (elem->handles, src);
-  free_element_handle (src);
+  h = batch_lock_handle (b, b->src, b->src_id);
+  if (h == NULL)
+    return FALSE;
 
-  handle_exit (h);
+  g_mutex_unlock (&b->src->lock);
+  g_mutex_unlock (&b->pipe->lock);
+  return TRUE;
 }
 
 /**
- * @brief Push a data frame to a src (more info in nnstreamer.h)
+ * @brief Internal function to push the pending frame into the pipeline. The caller should hold the lock.
+ * @return ML_ERROR_STREAMS_PIPE if the src handle is released by the pipeline. The frame is dropped if failed.
  */
-int
-ml_pipeline_src_input_data (ml_pipeline_src_h h, ml_tensors_data_h data,
-    ml_pipeline_buf_policy_e policy)
+static int
+batch_push_frame (ml_pipeline_batch_s * b)
 {
-  GstBuffer *buffer;
-  GstMemory *mem, *tmp;
-  gpointer mem_data;
-  gsize mem_size;
-  GstFlowReturn gret;
-  GstTensorsInfo gst_info;
-  ml_tensors_data_s *_data;
-  unsigned int i;
+  ml_pipeline_common_elem *src;
+  ml_tensors_data_s *_data = (ml_tensors_data_s *) b->pending;
+  ml_pipeline_batch_mask_s *mask;
+  gboolean released;
+  guint64 seq;
+  guint s, i;
+  int status;
 
-  handle_init (src, h);
+  mask = g_new0 (ml_pipeline_batch_mask_s, 1);
+  mask->filled = b->filled;
 
-  _data = (ml_tensors_data_s *) data;
-  if (!_data) {
-    _ml_loge ("The given param data is invalid.");
-    ret = ML_ERROR_INVALID_PARAMETER;
-    goto unlock_return;
+  /* fill zero for the missing streams */
+  for (s = 0; s < b->num_streams; s++) {
+    if (mask->filled[s])
+      continue;
+
+    for (i = 0; i < b->num_tensors; i++)
+      memset ((guint8 *) _data->tensors[i].tensor + b->chunk[i] * s, 0,
+          b->chunk[i]);
   }
-  G_LOCK_UNLESS_NOLOCK (*_data);
 
-  if (_data->num_tensors < 1 || _data->num_tensors > ML_TENSOR_SIZE_LIMIT) {
-    _ml_loge
-        ("The tensor size is invalid. It should be 1 ~ %u; where it is %u",
-        ML_TENSOR_SIZE_LIMIT, _data->num_tensors);
-    ret = ML_ERROR_INVALID_PARAMETER;
-    goto dont_destroy_data;
+  b->pending = NULL;
+  b->filled = g_new0 (gboolean, b->num_streams);
+  b->num_filled = 0;
+
+  /**
+   * The buffer is tagged with the sequence number, and the sink finds the mask with the tag of output.
+   * The output may arrive before this function returns, add the mask before pushing.
+   */
+  g_mutex_lock (&b->queue_lock);
+  seq = mask->seq = ++b->seq;
+  g_queue_push_tail (&b->masks, mask);
+  b->pushing = _data;
+  g_mutex_unlock (&b->queue_lock);
+
+  g_atomic_int_inc (&b->ref_count);
+
+  src = batch_lock_handle (b, b->src, b->src_id);
+  if (src) {
+    /* the push releases the locks */
+    status = src_push_data (b->pipe, b->src, src, _data,
+        ML_PIPELINE_BUF_POLICY_DO_NOT_FREE, &seq);
+  } else {
+    _ml_loge ("The src handle of the batch is released by the pipeline.");
+    status = ML_ERROR_STREAMS_PIPE;
   }
 
-  ret = ml_pipeline_src_parse_tensors_info (elem);
+  /**
+   * The pipeline releases the frame in this thread if the push is failed.
+   * If the frame is not released, it is not pushed into the pipeline.
+   */
+  g_mutex_lock (&b->queue_lock);
+  released = (b->pushing == NULL);
+  b->pushing = NULL;
+  if (status != ML_ERROR_NONE)
+    g_queue_remove (&b->masks, mask);
+  g_mutex_unlock (&b->queue_lock);
 
-  if (ret != ML_ERROR_NONE) {
-    _ml_logw
-        ("The pipeline is not ready to accept inputs. The input is ignored.");
-    goto dont_destroy_data;
+  if (status == ML_ERROR_NONE)
+    return ML_ERROR_NONE;
+
+  _ml_logw ("Failed to push the batched frame, the frame is dropped (%d).",
+      status);
+
+  batch_free_mask (mask);
+  if (!released) {
+    batch_recycle_data (b, _data);
+    batch_unref (b);
   }
 
-  if (!elem->is_media_stream && !elem->is_flexible_tensor) {
-    if (elem->tensors_info.num_tensors != _data->num_tensors) {
-      _ml_loge
-          ("The src push of [%s] cannot be handled because the number of tensors in a frame mismatches. %u != %u",
-          elem->name, elem->tensors_info.num_tensors, _data->num_tensors);
+  return status;
+}
 
-      ret = ML_ERROR_INVALID_PARAMETER;
-      goto dont_destroy_data;
-    }
+/**
+ * @brief Thread to push the pending frame when the deadline is expired.
+ */
+static gpointer
+batch_deadline_thread (gpointer user_data)
+{
+  ml_pipeline_batch_s *b = (ml_pipeline_batch_s *) user_data;
+
+  g_mutex_lock (&b->lock);
+  while (b->running) {
+    if (b->pending == NULL)
+      g_cond_wait (&b->cond, &b->lock);
+    else if (g_get_monotonic_time () >= b->end_time)
+      batch_push_frame (b);
+    else
+      g_cond_wait_until (&b->cond, &b->lock, b->end_time);
+  }
+  g_mutex_unlock (&b->lock);
 
-    for (i = 0; i < elem->tensors_info.num_tensors; i++) {
-      size_t sz = _ml_tensor_info_get_size (&elem->tensors_info.info[i]);
+  return NULL;
+}
 
-      if (sz != _data->tensors[i].size) {
-        _ml_loge
-            ("The given input tensor size (%d'th, %zu bytes) mismatches the source pad (%zu bytes)",
-            i, _data->tensors[i].size, sz);
+/**
+ * @brief Callback for the output of batched frame, splits the output and calls the callback for each stream.
+ */
+static void
+batch_sink_cb (const ml_tensors_data_h data, const ml_tensors_info_h info,
+    void *user_data)
+{
+  ml_pipeline_batch_s *b = (ml_pipeline_batch_s *) user_data;
+  ml_tensors_data_s *_data = (ml_tensors_data_s *) data;
+  ml_tensors_info_s *_info;
+  ml_tensors_data_s stream_data;
+  ml_tensor_dimension_extended dim;
+  ml_pipeline_batch_mask_s *mask = NULL;
+  GList *found = NULL;
+  guint64 seq;
+  guint s, i;
+  int d;
+
+  /* the callback is called with the element lock, the buffer is valid. */
+  if (b->sink == NULL || b->sink->sink_buffer == NULL ||
+      !get_buffer_tag (b->sink->sink_buffer, &seq)) {
+    _ml_logw ("The output is not pushed from the batch, ignore it.");
+    return;
+  }
 
-        ret = ML_ERROR_INVALID_PARAMETER;
-        goto dont_destroy_data;
-      }
-    }
+  g_mutex_lock (&b->queue_lock);
+  found = g_queue_find_custom (&b->masks, &seq, batch_compare_mask);
+  if (found) {
+    /* the frames pushed before the output are dropped in the pipeline. */
+    while ((mask = g_queue_pop_head (&b->masks)) != found->data)
+      batch_free_mask (mask);
   }
+  g_mutex_unlock (&b->queue_lock);
 
-  /* Create buffer to be pushed from buf[] */
-  buffer = gst_buffer_new ();
-  _ml_tensors_info_copy_from_ml (&gst_info, _data->info);
+  if (mask == NULL) {
+    _ml_logw ("Cannot find the streams of the batched frame %" G_GUINT64_FORMAT
+        ", ignore it.", seq);
+    return;
+  }
 
-  for (i = 0; i < _data->num_tensors; i++) {
-    mem_data = _data->tensors[i].tensor;
-    mem_size = _data->tensors[i].size;
+  /* the output info is not changed after the negotiation, set it once. */
+  if (b->out_info == NULL) {
+    ml_tensors_info_create (&b->out_info);
+    ml_tensors_info_clone (b->out_info, info);
+
+    _info = (ml_tensors_info_s *) b->out_info;
+    for (i = 0; i < _info->num_tensors; i++) {
+      d = batch_get_dim_index (&_info->info[i], b->num_streams);
+      if (d < 0) {
+        _ml_loge ("The %u'th output tensor is not batched with %u streams.",
+            i, b->num_streams);
+        ml_tensors_info_destroy (b->out_info);
+        b->out_info = NULL;
+        goto done;
+      }
 
-    mem = tmp = gst_memory_new_wrapped (GST_MEMORY_FLAG_READONLY,
-        mem_data, mem_size, 0, mem_size, mem_data,
-        (policy == ML_PIPELINE_BUF_POLICY_AUTO_FREE) ? g_free : NULL);
+      /* single stream keeps the dimension */
+      if (d == ML_TENSOR_RANK_LIMIT_EXTENDED)
+        continue;
 
-    /* flex tensor, append header. */
-    if (elem->is_flexible_tensor) {
-      GstTensorMetaInfo meta;
+      ml_tensors_info_get_tensor_dimension_extended (b->out_info, i, dim);
+      dim[d] = 1;
+      ml_tensors_info_set_tensor_dimension_extended (b->out_info, i, dim);
+    }
+  }
 
-      gst_tensor_info_convert_to_meta (&gst_info.info[i], &meta);
+  memset (&stream_data, 0, sizeof (ml_tensors_data_s));
+  stream_data.info = b->out_info;
+  stream_data.nolock = 1;
+  stream_data.num_tensors = _data->num_tensors;
+
+  for (s = 0; s < b->num_streams; s++) {
+    if (!mask->filled[s])
+      continue;
 
-      mem = gst_tensor_meta_info_append_header (&meta, tmp);
-      gst_memory_unref (tmp);
+    for (i = 0; i < stream_data.num_tensors; i++) {
+      stream_data.tensors[i].size = _data->tensors[i].size / b->num_streams;
+      stream_data.tensors[i].tensor =
+          (guint8 *) _data->tensors[i].tensor + stream_data.tensors[i].size * s;
     }
 
-    gst_buffer_append_memory (buffer, mem);
-    /** @todo Verify that gst_buffer_append lists tensors/gstmem in the correct order */
+    b->cb (s, &stream_data, b->out_info, b->user_data);
   }
 
-  gst_tensors_info_free (&gst_info);
+done:
+  batch_free_mask (mask);
+}
 
-  /* Unlock if it's not auto-free. We do not know when it'll be freed. */
-  if (policy != ML_PIPELINE_BUF_POLICY_AUTO_FREE)
-    G_UNLOCK_UNLESS_NOLOCK (*_data);
+/**
+ * @brief Creates the batch of multiple streams (more info in nnstreamer.h)
+ */
+int
+ml_pipeline_batch_create (ml_pipeline_h pipe, const char *src_name,
+    const char *sink_name, unsigned int num_streams, unsigned int deadline_ms,
+    ml_pipeline_batch_cb cb, void *user_data, ml_pipeline_batch_h * batch)
+{
+  ml_pipeline_batch_s *b;
+  ml_pipeline_common_elem *src = NULL, *sink = NULL;
+  ml_tensors_info_s *_info;
+  guint i;
+  int status;
 
-  /* Push the data! */
-  gret = gst_app_src_push_buffer (GST_APP_SRC (elem->element), buffer);
+  check_feature_state ();
 
-  /* Free data ptr if buffer policy is auto-free */
-  if (policy == ML_PIPELINE_BUF_POLICY_AUTO_FREE) {
-    G_UNLOCK_UNLESS_NOLOCK (*_data);
-    _ml_tensors_data_destroy_internal (_data, FALSE);
-    _data = NULL;
-  }
+  if (!pipe || !src_name || !sink_name || num_streams == 0 || !cb || !batch)
+    return ML_ERROR_INVALID_PARAMETER;
 
-  if (gret == GST_FLOW_FLUSHING) {
-    _ml_logw
-        ("The pipeline is not in PAUSED/PLAYING. The input may be ignored.");
-    ret = ML_ERROR_TRY_AGAIN;
-  } else if (gret == GST_FLOW_EOS) {
-    _ml_logw ("THe pipeline is in EOS state. The input is ignored.");
-    ret = ML_ERROR_STREAMS_PIPE;
-  }
+  /* init null */
+  *batch = NULL;
+
+  b = g_new0 (ml_pipeline_batch_s, 1);
+  b->ref_count = 1;
+  g_mutex_init (&b->lock);
+  g_mutex_init (&b->queue_lock);
+  g_cond_init (&b->cond);
+  g_queue_init (&b->masks);
+  g_queue_init (&b->free_data);
+  b->num_streams = num_streams;
+  b->deadline_ms = deadline_ms;
+  b->cb = cb;
+  b->user_data = user_data;
+  b->filled = g_new0 (gboolean, num_streams);
+  b->pipe = (ml_pipeline *) pipe;
+
+  status = ml_pipeline_src_get_handle (pipe, src_name,
+      (ml_pipeline_src_h *) & src);
+  if (status != ML_ERROR_NONE)
+    goto error;
 
-  goto unlock_return;
+  b->src = src->element;
+  b->src_id = src->id;
 
-dont_destroy_data:
-  G_UNLOCK_UNLESS_NOLOCK (*_data);
+  status = ml_pipeline_src_get_tensors_info (src, &b->in_info);
+  if (status != ML_ERROR_NONE)
+    goto error;
 
-  handle_exit (h);
-}
+  _info = (ml_tensors_info_s *) b->in_info;
+  b->num_tensors = _info->num_tensors;
+  for (i = 0; i < b->num_tensors; i++) {
+    if (batch_get_dim_index (&_info->info[i], num_streams) < 0) {
+      _ml_loge ("The %u'th tensor of src %s is not batched with %u streams.",
+          i, src_name, num_streams);
+      status = ML_ERROR_INVALID_PARAMETER;
+      goto error;
+    }
 
-/**
- * @brief Internal function for appsrc callback - need_data.
- */
-static void
-_pipe_src_cb_need_data (GstAppSrc * src, guint length, gpointer user_data)
-{
-  ml_pipeline_common_elem *src_h;
-  ml_pipeline_element *elem;
-  ml_pipeline_src_callbacks_s *src_cb = NULL;
+    b->chunk[i] = _ml_tensor_info_get_size (&_info->info[i]) / num_streams;
+  }
 
-  src_h = (ml_pipeline_common_elem *) user_data;
-  if (src_h) {
-    elem = src_h->element;
+  status = ml_pipeline_src_set_release_cb (src, batch_release_cb, b);
+  if (status != ML_ERROR_NONE)
+    goto error;
 
-    g_mutex_lock (&elem->lock);
-    if (src_h->callback_info)
-      src_cb = &src_h->callback_info->src_cb;
-    g_mutex_unlock (&elem->lock);
+  status = ml_pipeline_sink_register (pipe, sink_name, batch_sink_cb, b,
+      (ml_pipeline_sink_h *) & sink);
+  if (status != ML_ERROR_NONE)
+    goto error;
 
-    if (src_cb && src_cb->need_data)
-      src_cb->need_data (src_h, length, src_h->callback_info->pdata);
+  b->sink = sink->element;
+  b->sink_id = sink->id;
+
+  if (deadline_ms > 0) {
+    b->running = TRUE;
+    b->thread = g_thread_try_new ("ml-pipeline-batch", batch_deadline_thread,
+        b, NULL);
+    if (b->thread == NULL) {
+      _ml_loge ("Failed to create the thread for the batch deadline.");
+      b->running = FALSE;
+      status = ML_ERROR_OUT_OF_MEMORY;
+      goto error;
+    }
   }
+
+  *batch = b;
+  return ML_ERROR_NONE;
+
+error:
+  ml_pipeline_batch_destroy (b);
+  return status;
 }
 
 /**
- * @brief Internal function for appsrc callback - enough_data.
+ * @brief Destroys the batch (more info in nnstreamer.h)
  */
-static void
-_pipe_src_cb_enough_data (GstAppSrc * src, gpointer user_data)
+int
+ml_pipeline_batch_destroy (ml_pipeline_batch_h batch)
 {
-  ml_pipeline_common_elem *src_h;
-  ml_pipeline_element *elem;
-  ml_pipeline_src_callbacks_s *src_cb = NULL;
+  ml_pipeline_batch_s *b = (ml_pipeline_batch_s *) batch;
+  ml_pipeline_common_elem *h;
 
-  src_h = (ml_pipeline_common_elem *) user_data;
-  if (src_h) {
-    elem = src_h->element;
+  check_feature_state ();
 
-    g_mutex_lock (&elem->lock);
-    if (src_h->callback_info)
-      src_cb = &src_h->callback_info->src_cb;
-    g_mutex_unlock (&elem->lock);
+  if (!b)
+    return ML_ERROR_INVALID_PARAMETER;
 
-    if (src_cb && src_cb->enough_data)
-      src_cb->enough_data (src_h, src_h->callback_info->pdata);
-  }
-}
+  if (b->thread) {
+    g_mutex_lock (&b->lock);
+    b->running = FALSE;
+    g_cond_broadcast (&b->cond);
+    g_mutex_unlock (&b->lock);
 
-/**
- * @brief Internal function for appsrc callback - seek_data.
- */
-static gboolean
-_pipe_src_cb_seek_data (GstAppSrc * src, guint64 offset, gpointer user_data)
-{
-  ml_pipeline_common_elem *src_h;
-  ml_pipeline_element *elem;
-  ml_pipeline_src_callbacks_s *src_cb = NULL;
+    g_thread_join (b->thread);
+    b->thread = NULL;
+  }
 
-  src_h = (ml_pipeline_common_elem *) user_data;
-  if (src_h) {
-    elem = src_h->element;
+  /* the pipeline may release the handles, unregister them if not released */
+  if (b->sink && (h = batch_lock_handle (b, b->sink, b->sink_id)) != NULL) {
+    sink_unregister_handle (b->sink, h);
+    g_mutex_unlock (&b->sink->lock);
+    g_mutex_unlock (&b->pipe->lock);
+  }
 
-    g_mutex_lock (&elem->lock);
-    if (src_h->callback_info)
-      src_cb = &src_h->callback_info->src_cb;
-    g_mutex_unlock (&elem->lock);
+  /* drop the frame waiting for the streams */
+  g_mutex_lock (&b->lock);
+  if (b->pending) {
+    ml_tensors_data_destroy (b->pending);
+    b->pending = NULL;
+  }
+  g_mutex_unlock (&b->lock);
 
-    if (src_cb && src_cb->seek_data)
-      src_cb->seek_data (src_h, offset, src_h->callback_info->pdata);
+  /* the frames in the pipeline hold the batch until released. */
+  if (b->src && (h = batch_lock_handle (b, b->src, b->src_id)) != NULL) {
+    src_release_handle (b->src, h);
+    g_mutex_unlock (&b->src->lock);
+    g_mutex_unlock (&b->pipe->lock);
   }
 
-  return TRUE;
+  batch_unref (b);
+  return ML_ERROR_NONE;
 }
 
 /**
- * @brief Register callbacks for src events (more info in nnstreamer.h)
+ * @brief Copies the frame of a stream into the batch (more info in nnstreamer.h)
  */
 int
-ml_pipeline_src_set_event_cb (ml_pipeline_src_h src_handle,
-    ml_pipeline_src_callbacks_s * cb, void *user_data)
+ml_pipeline_batch_input_data (ml_pipeline_batch_h batch,
+    unsigned int stream_id, const ml_tensors_data_h data)
 {
-  GstAppSrcCallbacks appsrc_cb = { 0, };
+  ml_pipeline_batch_s *b = (ml_pipeline_batch_s *) batch;
+  ml_tensors_data_s *_data = (ml_tensors_data_s *) data;
+  ml_tensors_data_s *_pending;
+  guint i;
+  int status = ML_ERROR_NONE;
 
-  handle_init (src, src_handle);
+  check_feature_state ();
 
-  if (cb == NULL) {
-    ret = ML_ERROR_INVALID_PARAMETER;
-    goto unlock_return;
+  if (!b || !_data || stream_id >= b->num_streams)
+    return ML_ERROR_INVALID_PARAMETER;
+
+  /* the pipeline may release the handles of batch (e.g., reset) */
+  if (!batch_has_handles (b)) {
+    _ml_loge ("The handles of the batch are released by the pipeline.");
+    return ML_ERROR_STREAMS_PIPE;
   }
 
-  if (src->callback_info == NULL)
-    src->callback_info = g_new0 (callback_info_s, 1);
-  if (src->callback_info == NULL) {
-    _ml_loge ("Failed to allocate the callback info for %s.", elem->name);
-    ret = ML_ERROR_OUT_OF_MEMORY;
-    goto unlock_return;
+  G_LOCK_UNLESS_NOLOCK (*_data);
+
+  if (_data->num_tensors != b->num_tensors) {
+    _ml_loge ("The number of tensors mismatches (%u != %u).",
+        _data->num_tensors, b->num_tensors);
+    status = ML_ERROR_INVALID_PARAMETER;
+    goto done;
   }
 
-  src->callback_info->src_cb = *cb;
-  src->callback_info->pdata = user_data;
+  for (i = 0; i < b->num_tensors; i++) {
+    if (_data->tensors[i].size != b->chunk[i]) {
+      _ml_loge ("The size of %u'th tensor mismatches (%zu != %zu).", i,
+          _data->tensors[i].size, b->chunk[i]);
+      status = ML_ERROR_INVALID_PARAMETER;
+      goto done;
+    }
+  }
 
-  appsrc_cb.need_data = _pipe_src_cb_need_data;
-  appsrc_cb.enough_data = _pipe_src_cb_enough_data;
-  appsrc_cb.seek_data = _pipe_src_cb_seek_data;
+  g_mutex_lock (&b->lock);
 
-  gst_app_src_set_callbacks (GST_APP_SRC (elem->element), &appsrc_cb,
-      src_handle, NULL);
+  /* the stream is already filled, push the frame and start new one. */
+  if (b->pending && b->filled[stream_id])
+    batch_push_frame (b);
 
-  handle_exit (src_handle);
-}
+  if (b->pending == NULL) {
+    g_mutex_lock (&b->queue_lock);
+    b->pending = g_queue_pop_head (&b->free_data);
+    g_mutex_unlock (&b->queue_lock);
 
-/**
- * @brief Gets a handle for the tensors metadata of given src node.
- */
-int
-ml_pipeline_src_get_tensors_info (ml_pipeline_src_h h, ml_tensors_info_h * info)
-{
-  handle_init (src, h);
+    /* the missing streams are filled with zero when pushing the frame */
+    if (b->pending == NULL)
+      status = ml_tensors_data_create_full (b->in_info,
+          ML_TENSORS_DATA_FLAG_NO_ZERO_FILL, NULL, &b->pending);
 
-  if (info == NULL) {
-    ret = ML_ERROR_INVALID_PARAMETER;
-    goto unlock_return;
+    if (status != ML_ERROR_NONE) {
+      g_mutex_unlock (&b->lock);
+      goto done;
+    }
+
+    b->end_time = g_get_monotonic_time () +
+        (gint64) b->deadline_ms * G_TIME_SPAN_MILLISECOND;
+    g_cond_signal (&b->cond);
   }
 
-  ret = ml_pipeline_src_parse_tensors_info (elem);
+  _pending = (ml_tensors_data_s *) b->pending;
+  for (i = 0; i < b->num_tensors; i++)
+    memcpy ((guint8 *) _pending->tensors[i].tensor + b->chunk[i] * stream_id,
+        _data->tensors[i].tensor, b->chunk[i]);
 
-  if (ret == ML_ERROR_NONE) {
-    ml_tensors_info_create (info);
-    ml_tensors_info_clone (*info, &elem->tensors_info);
-  }
+  b->filled[stream_id] = TRUE;
+  b->num_filled++;
 
-  handle_exit (h);
+  if (b->num_filled == b->num_streams)
+    status = batch_push_frame (b);
+
+  g_mutex_unlock (&b->lock);
+
+done:
+  G_UNLOCK_UNLESS_NOLOCK (*_data);
+  return status;
 }
 
 /****************************************************
@@ -2250,6 +5449,9 @@ ml_pipeline_element_set_property (ml_pipeline_element_h elem_h,
     g_object_set (G_OBJECT (elem->element), property_name, value, NULL);
   }
 
+  if (elem->type == ML_PIPELINE_ELEMENT_COMMON && is_tensor_filter (elem))
+    update_tensor_filter_share_key (elem, property_name);
+
   handle_exit (elem_h);
 }
 
@@ -2537,6 +5739,29 @@ ml_pipeline_custom_free_handle (ml_custom_filter_s * custom)
   }
 }
 
+/**
+ * @brief Internal function to set the tensors data wrapper of custom-easy filter.
+ * @note The wrapper is allocated in the invoking thread, so it does not need the lock.
+ */
+static void
+ml_pipeline_custom_set_data (ml_tensors_data_s * data, ml_tensors_info_h info,
+    const GstTensorMemory * mem)
+{
+  ml_tensors_info_s *_info = (ml_tensors_info_s *) info;
+  guint i;
+
+  memset (data, 0, sizeof (ml_tensors_data_s));
+
+  /* the tensors info of custom filter is not changed after the registration */
+  data->info = info;
+  data->nolock = 1;
+  data->num_tensors = _info->num_tensors;
+  for (i = 0; i < data->num_tensors; i++) {
+    data->tensors[i].tensor = mem[i].data;
+    data->tensors[i].size = _ml_tensor_info_get_size (&_info->info[i]);
+  }
+}
+
 /**
  * @brief Invoke callback for custom-easy filter.
  */
@@ -2546,45 +5771,28 @@ ml_pipeline_custom_invoke (void *data, const GstTensorFilterProperties * prop,
 {
   int status;
   ml_custom_filter_s *c;
-  ml_tensors_data_h in_data, out_data;
-  ml_tensors_data_s *_data;
-  guint i;
+  ml_tensors_data_s in_data, out_data;
 
-  in_data = out_data = NULL;
   c = (ml_custom_filter_s *) data;
 
   /* internal error? */
   if (!c || !c->cb)
     return -1;
 
-  g_mutex_lock (&c->lock);
-
-  /* prepare invoke */
-  status = _ml_tensors_data_create_no_alloc (c->in_info, &in_data);
-  if (status != ML_ERROR_NONE)
-    goto done;
-
-  _data = (ml_tensors_data_s *) in_data;
-  for (i = 0; i < _data->num_tensors; i++)
-    _data->tensors[i].tensor = in[i].data;
-
-  status = _ml_tensors_data_create_no_alloc (c->out_info, &out_data);
-  if (status != ML_ERROR_NONE)
-    goto done;
-
-  _data = (ml_tensors_data_s *) out_data;
-  for (i = 0; i < _data->num_tensors; i++)
-    _data->tensors[i].tensor = out[i].data;
+  /* prepare invoke, the wrappers are on the stack of invoking thread. */
+  ml_pipeline_custom_set_data (&in_data, c->in_info, in);
+  ml_pipeline_custom_set_data (&out_data, c->out_info, out);
 
   /* call invoke callback */
-  status = c->cb (in_data, out_data, c->pdata);
+  if (c->flags & ML_CUSTOM_EASY_FLAG_REENTRANT) {
+    status = c->cb (&in_data, &out_data, c->pdata);
+  } else {
+    g_mutex_lock (&c->lock);
+    status = c->cb (&in_data, &out_data, c->pdata);
+    g_mutex_unlock (&c->lock);
+  }
 
-done:
-  g_mutex_unlock (&c->lock);
   /* NOTE: DO NOT free tensor data */
-  g_free (in_data);
-  g_free (out_data);
-
   return status;
 }
 
@@ -2596,6 +5804,19 @@ ml_pipeline_custom_easy_filter_register (const char *name,
     const ml_tensors_info_h in, const ml_tensors_info_h out,
     ml_custom_easy_invoke_cb cb, void *user_data,
     ml_custom_easy_filter_h * custom)
+{
+  return ml_pipeline_custom_easy_filter_register_full (name, in, out, cb,
+      user_data, ML_CUSTOM_EASY_FLAG_NONE, custom);
+}
+
+/**
+ * @brief Registers a custom filter with the flags.
+ */
+int
+ml_pipeline_custom_easy_filter_register_full (const char *name,
+    const ml_tensors_info_h in, const ml_tensors_info_h out,
+    ml_custom_easy_invoke_cb cb, void *user_data, int flags,
+    ml_custom_easy_filter_h * custom)
 {
   int status = ML_ERROR_NONE;
   ml_custom_filter_s *c;
@@ -2612,6 +5833,11 @@ ml_pipeline_custom_easy_filter_register (const char *name,
   if (!ml_tensors_info_is_valid (in) || !ml_tensors_info_is_valid (out))
     return ML_ERROR_INVALID_PARAMETER;
 
+  if (flags & ~ML_CUSTOM_EASY_FLAG_REENTRANT) {
+    _ml_loge ("The flags of custom filter %s are invalid (0x%x).", name, flags);
+    return ML_ERROR_INVALID_PARAMETER;
+  }
+
   /* create and init custom handle */
   if ((c = g_new0 (ml_custom_filter_s, 1)) == NULL)
     return ML_ERROR_OUT_OF_MEMORY;
@@ -2623,6 +5849,7 @@ ml_pipeline_custom_easy_filter_register (const char *name,
   c->ref_count = 0;
   c->cb = cb;
   c->pdata = user_data;
+  c->flags = flags;
   ml_tensors_info_create (&c->in_info);
   ml_tensors_info_create (&c->out_info);
 
@@ -2635,8 +5862,15 @@ ml_pipeline_custom_easy_filter_register (const char *name,
     goto exit;
 
   /* register custom filter */
-  _ml_tensors_info_copy_from_ml (&in_info, c->in_info);
-  _ml_tensors_info_copy_from_ml (&out_info, c->out_info);
+  status = _ml_tensors_info_copy_from_ml (&in_info, c->in_info);
+  if (status != ML_ERROR_NONE)
+    goto exit;
+
+  status = _ml_tensors_info_copy_from_ml (&out_info, c->out_info);
+  if (status != ML_ERROR_NONE) {
+    gst_tensors_info_free (&in_info);
+    goto exit;
+  }
 
   if (NNS_custom_easy_register (name, ml_pipeline_custom_invoke, c,
           &in_info, &out_info) != 0) {
@@ -2728,6 +5962,56 @@ ml_pipeline_if_custom_unref (ml_pipeline_if_h custom)
   }
 }
 
+/**
+ * @brief Internal function to evaluate the built-in condition of tensor_if.
+ * @note The condition is not changed after the registration, so it does not need the lock.
+ */
+static gboolean
+ml_pipeline_if_condition_eval (ml_if_custom_s * c, const GstTensorsInfo * info,
+    const GstTensorMemory * input, gboolean * result)
+{
+  gsize esize, len, idx = 0;
+  gdouble max = 0.0;
+  gboolean found;
+  guint i;
+
+  if (c->index >= info->num_tensors) {
+    nns_loge ("The index of custom condition %s (%u) is out of bound (%u).",
+        c->name, c->index, info->num_tensors);
+    return FALSE;
+  }
+
+  esize = gst_tensor_get_element_size (info->info[c->index].type);
+  len = (esize > 0) ? input[c->index].size / esize : 0;
+  if (len == 0) {
+    nns_loge ("The tensor of custom condition %s is empty.", c->name);
+    return FALSE;
+  }
+
+  /* the same kernel with ml_tensors_data_argmax() */
+  if (_ml_tensor_argmax (input[c->index].data, len,
+          _ml_tensor_type_from_gst (info->info[c->index].type), &idx,
+          &max) != ML_ERROR_NONE) {
+    nns_loge ("The tensor type of custom condition %s is invalid.", c->name);
+    return FALSE;
+  }
+
+  found = (max > c->threshold);
+
+  if (found && c->condition == ML_PIPELINE_IF_CONDITION_CLASS_IN_SET) {
+    found = FALSE;
+    for (i = 0; i < c->num_classes; i++) {
+      if (c->classes[i] == idx) {
+        found = TRUE;
+        break;
+      }
+    }
+  }
+
+  *result = found;
+  return TRUE;
+}
+
 /**
  * @brief Callback for tensor_if custom condition.
  */
@@ -2736,41 +6020,48 @@ ml_pipeline_if_custom (const GstTensorsInfo * info,
     const GstTensorMemory * input, void *data, gboolean * result)
 {
   int status = 0;
-  guint i;
   ml_if_custom_s *c;
-  ml_tensors_data_h in_data;
-  ml_tensors_data_s *_data;
-  ml_tensors_info_h ml_info;
-  GstTensorsInfo in_info = *info;
+  ml_tensors_data_s in_data;
   gboolean ret = FALSE;
 
   c = (ml_if_custom_s *) data;
-  in_data = NULL;
 
   /* internal error? */
-  if (!c || !c->cb)
+  if (!c)
     return FALSE;
 
-  _ml_tensors_info_create_from_gst (&ml_info, &in_info);
-  status = _ml_tensors_data_create_no_alloc (ml_info, &in_data);
-  if (status != ML_ERROR_NONE)
-    goto done;
+  /* built-in condition, evaluate it without the callback. */
+  if (!c->cb)
+    return ml_pipeline_if_condition_eval (c, info, input, result);
+
+  g_mutex_lock (&c->lock);
+
+  /* reuse the tensors info handle until the input is changed */
+  if (!c->info || !gst_tensors_info_is_equal (&c->gst_info, info)) {
+    if (c->info) {
+      ml_tensors_info_destroy (c->info);
+      c->info = NULL;
+    }
+
+    gst_tensors_info_free (&c->gst_info);
+    gst_tensors_info_copy (&c->gst_info, info);
 
-  _data = (ml_tensors_data_s *) in_data;
-  for (i = 0; i < _data->num_tensors; i++)
-    _data->tensors[i].tensor = input[i].data;
+    status = _ml_tensors_info_create_from_gst (&c->info, &c->gst_info);
+    if (status != ML_ERROR_NONE)
+      goto done;
+  }
+
+  /* the wrapper is on the stack of invoking thread. */
+  ml_pipeline_custom_set_data (&in_data, c->info, input);
 
   /* call invoke callback */
-  g_mutex_lock (&c->lock);
-  status = c->cb (in_data, ml_info, result, c->pdata);
-  g_mutex_unlock (&c->lock);
+  status = c->cb (&in_data, c->info, result, c->pdata);
 
   if (status == 0)
     ret = TRUE;
 
 done:
-  ml_tensors_info_destroy (ml_info);
-  g_free (in_data);
+  g_mutex_unlock (&c->lock);
 
   return ret;
 }
@@ -2785,6 +6076,11 @@ ml_pipeline_if_custom_free (ml_if_custom_s * custom)
     g_mutex_lock (&custom->lock);
 
     g_free (custom->name);
+    g_free (custom->classes);
+
+    if (custom->info)
+      ml_tensors_info_destroy (custom->info);
+    gst_tensors_info_free (&custom->gst_info);
 
     g_mutex_unlock (&custom->lock);
     g_mutex_clear (&custom->lock);
@@ -2793,6 +6089,37 @@ ml_pipeline_if_custom_free (ml_if_custom_s * custom)
   }
 }
 
+/**
+ * @brief Internal function to register the tensor_if custom condition.
+ * @note The handle is released if failed to register the condition.
+ */
+static int
+ml_pipeline_if_custom_add (ml_if_custom_s * c, const char *name,
+    ml_pipeline_if_h * if_custom)
+{
+  int status = ML_ERROR_NONE;
+
+  g_mutex_lock (&c->lock);
+  c->name = g_strdup (name);
+  c->ref_count = 0;
+  gst_tensors_info_init (&c->gst_info);
+
+  if (nnstreamer_if_custom_register (name, ml_pipeline_if_custom, c) != 0) {
+    nns_loge ("Failed to register tensor_if custom condition %s.", name);
+    status = ML_ERROR_STREAMS_PIPE;
+  }
+  g_mutex_unlock (&c->lock);
+
+  if (status == ML_ERROR_NONE) {
+    pipe_custom_add_data (PIPE_CUSTOM_TYPE_IF, name, c);
+    *if_custom = c;
+  } else {
+    ml_pipeline_if_custom_free (c);
+  }
+
+  return status;
+}
+
 /**
  * @brief Registers the tensor_if custom callback.
  */
@@ -2800,7 +6127,6 @@ int
 ml_pipeline_tensor_if_custom_register (const char *name,
     ml_pipeline_if_custom_cb cb, void *user_data, ml_pipeline_if_h * if_custom)
 {
-  int status = ML_ERROR_NONE;
   ml_if_custom_s *c;
 
   check_feature_state ();
@@ -2816,27 +6142,72 @@ ml_pipeline_tensor_if_custom_register (const char *name,
     return ML_ERROR_OUT_OF_MEMORY;
 
   g_mutex_init (&c->lock);
-
-  g_mutex_lock (&c->lock);
-  c->name = g_strdup (name);
-  c->ref_count = 0;
   c->cb = cb;
   c->pdata = user_data;
 
-  if (nnstreamer_if_custom_register (name, ml_pipeline_if_custom, c) != 0) {
-    nns_loge ("Failed to register tensor_if custom condition %s.", name);
-    status = ML_ERROR_STREAMS_PIPE;
+  return ml_pipeline_if_custom_add (c, name, if_custom);
+}
+
+/**
+ * @brief Registers the built-in tensor_if custom condition.
+ */
+int
+ml_pipeline_tensor_if_condition_register (const char *name,
+    ml_pipeline_if_condition_e condition, unsigned int index, double threshold,
+    const unsigned int *classes, unsigned int num_classes,
+    ml_pipeline_if_h * if_custom)
+{
+  ml_if_custom_s *c;
+
+  check_feature_state ();
+
+  if (!name || !if_custom)
+    return ML_ERROR_INVALID_PARAMETER;
+
+  if (index >= ML_TENSOR_SIZE_LIMIT) {
+    _ml_loge ("The parameter, index (%u), should be less than %d.", index,
+        ML_TENSOR_SIZE_LIMIT);
+    return ML_ERROR_INVALID_PARAMETER;
   }
-  g_mutex_unlock (&c->lock);
 
-  if (status == ML_ERROR_NONE) {
-    pipe_custom_add_data (PIPE_CUSTOM_TYPE_IF, name, c);
-    *if_custom = c;
-  } else {
-    ml_pipeline_if_custom_free (c);
+  switch (condition) {
+    case ML_PIPELINE_IF_CONDITION_MAX_SCORE_GT:
+      break;
+    case ML_PIPELINE_IF_CONDITION_CLASS_IN_SET:
+      if (!classes || num_classes == 0) {
+        _ml_loge ("The parameter, classes, should be a set of class indices.");
+        return ML_ERROR_INVALID_PARAMETER;
+      }
+      break;
+    default:
+      _ml_loge ("The parameter, condition (%d), is invalid.", condition);
+      return ML_ERROR_INVALID_PARAMETER;
   }
 
-  return status;
+  /* init null */
+  *if_custom = NULL;
+
+  /* create and init custom handle */
+  if ((c = g_try_new0 (ml_if_custom_s, 1)) == NULL)
+    return ML_ERROR_OUT_OF_MEMORY;
+
+  g_mutex_init (&c->lock);
+  c->condition = condition;
+  c->index = index;
+  c->threshold = threshold;
+
+  if (condition == ML_PIPELINE_IF_CONDITION_CLASS_IN_SET) {
+    c->classes = g_try_new (unsigned int, num_classes);
+    if (c->classes == NULL) {
+      ml_pipeline_if_custom_free (c);
+      return ML_ERROR_OUT_OF_MEMORY;
+    }
+
+    memcpy (c->classes, classes, sizeof (unsigned int) * num_classes);
+    c->num_classes = num_classes;
+  }
+
+  return ml_pipeline_if_custom_add (c, name, if_custom);
 }
 
 /**
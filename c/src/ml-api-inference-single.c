@@ -490,7 +490,9 @@ ml_single_set_gst_info (ml_single * single_h, const ml_tensors_info_h info)
   int status = ML_ERROR_NONE;
   int ret = -EINVAL;
 
-  _ml_tensors_info_copy_from_ml (&gst_in_info, info);
+  status = _ml_tensors_info_copy_from_ml (&gst_in_info, info);
+  if (status != ML_ERROR_NONE)
+    return status;
 
   ret = single_h->klass->set_input_info (single_h->filter, &gst_in_info,
       &gst_out_info);
@@ -530,7 +532,9 @@ ml_single_set_inout_tensors_info (GObject * object,
     str_name_name = CONCAT_MACRO_STR (OUTPUT_STR, NAME_STR);
   }
 
-  _ml_tensors_info_copy_from_ml (&info, tensors_info);
+  status = _ml_tensors_info_copy_from_ml (&info, tensors_info);
+  if (status != ML_ERROR_NONE)
+    return status;
 
   /* Set input option */
   str_dim = gst_tensors_info_get_dimensions_string (&info);
@@ -1099,7 +1103,7 @@ _ml_single_invoke_internal (ml_single_h single,
       status = ML_ERROR_STREAMS_PIPE;
       goto exit;
     }
-    _ml_loge ("The single invoking thread is not idle.");
+    _ml_loge_ratelimited ("The single invoking thread is not idle.");
     status = ML_ERROR_TRY_AGAIN;
     goto exit;
   }
@@ -1113,6 +1117,18 @@ _ml_single_invoke_internal (ml_single_h single,
     if (status != ML_ERROR_NONE)
       goto exit;
   } else {
+    ml_tensors_data_s *_out = (ml_tensors_data_s *) (*output);
+    guint i;
+
+    /* the output tensors may be shared with other handles */
+    G_LOCK_UNLESS_NOLOCK (*_out);
+    for (i = 0; i < _out->num_tensors && status == ML_ERROR_NONE; i++)
+      status = _ml_tensors_data_make_writable (_out, i, FALSE);
+    G_UNLOCK_UNLESS_NOLOCK (*_out);
+
+    if (status != ML_ERROR_NONE)
+      goto exit;
+
     single_h->output = *output;
   }
 
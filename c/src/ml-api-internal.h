@@ -54,6 +54,74 @@ extern "C" {
 #define _ml_logd g_debug
 #endif
 
+/**
+ * @brief The max number of logs in a rate-limit interval for each call site.
+ */
+#define ML_LOG_RATELIMIT_BURST (10)
+
+/**
+ * @brief The rate-limit interval of the logs in microseconds. The intervals are aligned to the monotonic time.
+ */
+#define ML_LOG_RATELIMIT_INTERVAL (G_USEC_PER_SEC)
+
+/**
+ * @brief Data structure for the call site of the rate-limited log.
+ * @details Defined as a static variable in each call site. The site is registered when the first event occurs, and keeps the number of all events including the suppressed logs.
+ */
+typedef struct _ml_log_site_s {
+  const char *file; /**< The source file of the call site */
+  const char *func; /**< The function name of the call site */
+  int line; /**< The line number of the call site */
+  gint registered; /**< 1 if the site is in the list of the call sites */
+  gint count; /**< The number of all events in the call site */
+  gint window_count; /**< The number of events in current interval */
+  guint suppressed; /**< The number of suppressed logs since the last log */
+  gint window; /**< The index of current interval from the monotonic time, 0 if no event (atomic) */
+  struct _ml_log_site_s *next; /**< The next registered call site */
+} ml_log_site_s;
+
+/**
+ * @brief The initializer of the call site.
+ */
+#define ML_LOG_SITE_INIT { __FILE__, __func__, __LINE__, 0, 0, 0, 0, 0, NULL }
+
+/**
+ * @brief Counts the event of the call site and checks the log should be printed.
+ * @param[in] site The call site of the log.
+ * @param[out] suppressed The number of suppressed logs since the last log of the call site.
+ * @return TRUE if the log should be printed.
+ * @note The rate limit is approximate, concurrent events in the same call site may print a few more logs in an interval.
+ */
+gboolean _ml_log_site_hit (ml_log_site_s * site, guint * suppressed);
+
+/**
+ * @brief Private macro to print the rate-limited log. Don't use.
+ */
+#define _ml_log_ratelimited_(logfunc, fmt, ...) do { \
+  static ml_log_site_s _ml_log_site = ML_LOG_SITE_INIT; \
+  guint _ml_log_suppressed; \
+  if (_ml_log_site_hit (&_ml_log_site, &_ml_log_suppressed)) { \
+    if (_ml_log_suppressed > 0) \
+      logfunc (fmt " [site=%s:%d count=%d suppressed=%u]", ##__VA_ARGS__, \
+          _ml_log_site.file, _ml_log_site.line, \
+          g_atomic_int_get (&_ml_log_site.count), _ml_log_suppressed); \
+    else \
+      logfunc (fmt, ##__VA_ARGS__); \
+  } \
+} while (0)
+
+/**
+ * @brief Error log for the hot path, limited to ML_LOG_RATELIMIT_BURST logs in ML_LOG_RATELIMIT_INTERVAL for each call site.
+ */
+#define _ml_loge_ratelimited(fmt, ...) \
+  _ml_log_ratelimited_ (_ml_loge, fmt, ##__VA_ARGS__)
+
+/**
+ * @brief Warning log for the hot path, limited to ML_LOG_RATELIMIT_BURST logs in ML_LOG_RATELIMIT_INTERVAL for each call site.
+ */
+#define _ml_logw_ratelimited(fmt, ...) \
+  _ml_log_ratelimited_ (_ml_logw, fmt, ##__VA_ARGS__)
+
 #if defined (__TIZEN__)
 typedef enum
 {
@@ -113,8 +181,28 @@ typedef struct {
   char *name;              /**< Name of each element in the tensor. */
   ml_tensor_type_e type;   /**< Type of each element in the tensor. */
   ml_tensor_dimension dimension;     /**< Dimension information. */
+  unsigned int *dimension_ext; /**< The dimensions beyond ML_TENSOR_RANK_LIMIT (ML_TENSOR_RANK_EXTRA), allocated only if one of them is not 1. NULL if all of them are 1. */
 } ml_tensor_info_s;
 
+/**
+ * @brief The number of dimensions beyond ML_TENSOR_RANK_LIMIT in the extended rank.
+ */
+#define ML_TENSOR_RANK_EXTRA (ML_TENSOR_RANK_LIMIT_EXTENDED - ML_TENSOR_RANK_LIMIT)
+
+/**
+ * @brief Canonical and immutable tensors information, interned in the global table.
+ * @details The tensors information with same types and dimensions shares an instance, thus two interned instances are equal if the pointers are same. The names of tensors are not included.
+ */
+typedef struct {
+  gint ref_count; /**< The number of tensors info referring this (atomic) */
+  guint hash; /**< The hash of types and dimensions */
+  gboolean valid; /**< TRUE if the tensors info is valid */
+  unsigned int num_tensors; /**< The number of tensors. */
+  ml_tensor_info_s *info; /**< The list of tensor info, the name is always NULL. Allocated with the instance, including the dimensions beyond ML_TENSOR_RANK_LIMIT. */
+  size_t *size; /**< The byte size of each tensor. Allocated with the instance. */
+  size_t total_size; /**< The byte size of all tensors */
+} ml_tensors_info_interned_s;
+
 /**
  * @brief Data structure for tensors information, which contains multiple tensors.
  * @since_tizen 5.5
@@ -122,10 +210,31 @@ typedef struct {
 typedef struct {
   unsigned int num_tensors; /**< The number of tensors. */
   ml_tensor_info_s info[ML_TENSOR_SIZE_LIMIT];  /**< The list of tensor info. */
+  ml_tensor_info_s *extra; /**< The list of tensor info beyond ML_TENSOR_SIZE_LIMIT, allocated with the number of tensors. NULL if num_tensors <= ML_TENSOR_SIZE_LIMIT. */
+  gboolean is_extended; /**< TRUE if the handle is created with ml_tensors_info_create_extended() */
+  ml_tensors_info_interned_s *interned; /**< The canonical tensors info, NULL if not interned yet. This is cleared when the tensors info is changed. */
   GMutex lock; /**< Lock for thread safety */
   int nolock; /**< Set non-zero to avoid using m (giving up thread safety) */
+  GThread *owner; /**< The thread owning the handle without lock, NULL if the handle is not confined to a thread */
+  gboolean released; /**< TRUE if the handle is destroyed and kept in the cache of released handles */
 } ml_tensors_info_s;
 
+/**
+ * @brief Macro to verify the handle without lock is accessed in its owner thread.
+ * @param sname The name of struct (ml_tensors_info_s or ml_tensors_data_s)
+ * @note This is enabled in the debug build only.
+ */
+#if defined (ML_API_DEBUG)
+#define G_VERIFY_OWNER_IF_NOLOCK(sname) \
+  do { \
+    if ((sname).nolock && (sname).owner && (sname).owner != g_thread_self ()) \
+      g_critical ("The handle %p without lock is owned by thread %p, but it is accessed in thread %p.", \
+          (void *) &(sname), (void *) (sname).owner, (void *) g_thread_self ()); \
+  } while (0)
+#else
+#define G_VERIFY_OWNER_IF_NOLOCK(sname) do { } while (0)
+#endif
+
 /**
  * @brief Macro to control private lock with nolock condition (lock)
  * @param sname The name of struct (ml_tensors_info_s or ml_tensors_data_s)
@@ -135,6 +244,8 @@ typedef struct {
     GMutex *l = (GMutex *) &(sname).lock; \
     if (!(sname).nolock) \
       g_mutex_lock (l); \
+    else \
+      G_VERIFY_OWNER_IF_NOLOCK (sname); \
   } while (0)
 
 /**
@@ -193,6 +304,17 @@ typedef struct {
   size_t size; /**< The size of tensor. */
 } ml_tensor_data_s;
 
+/**
+ * @brief The tensor buffers shared by the handles of tensors data. See ml_tensors_data_ref().
+ */
+typedef struct {
+  gint ref_count; /**< The number of handles sharing the buffers (atomic) */
+  unsigned int num_tensors; /**< The number of tensors. */
+  void *tensors[ML_TENSOR_SIZE_LIMIT]; /**< The shared buffers of tensors */
+  int alloc_flags; /**< The flags of the allocation (ml_tensors_data_flag_e) */
+  ml_tensors_data_allocator_s allocator; /**< The allocator of tensor buffers */
+} ml_tensors_data_shared_s;
+
 /**
  * @brief An instance of input or output frames. #ml_tensors_info_h is the handle for tensors metadata.
  * @since_tizen 5.5
@@ -200,13 +322,21 @@ typedef struct {
 typedef struct {
   unsigned int num_tensors; /**< The number of tensors. */
   ml_tensor_data_s tensors[ML_TENSOR_SIZE_LIMIT]; /**< The list of tensor data. NULL for unused tensors. */
+  ml_tensor_data_s *extra; /**< The list of tensor data beyond ML_TENSOR_SIZE_LIMIT, allocated with the number of tensors. */
 
   /* private */
   ml_tensors_info_h info;
   void *user_data; /**< The user data to pass to the callback function */
   ml_handle_destroy_cb destroy; /**< The function to be called to release the allocated buffer */
+  int alloc_flags; /**< The flags of the allocation (ml_tensors_data_flag_e) */
+  ml_tensors_data_allocator_s allocator; /**< The allocator of tensor buffers, the callbacks are NULL for the default allocator */
+  gboolean owned; /**< TRUE if the handle owns the tensor buffers allocated by ML API */
+  ml_tensors_data_shared_s *shared; /**< The buffers shared with other handles, NULL if not shared */
+  unsigned int shared_mask; /**< The bit of each tensor is set if the tensor is in the shared buffers (copy-on-write). The shared data has ML_TENSOR_SIZE_LIMIT tensors at most. */
   GMutex lock; /**< Lock for thread safety */
   int nolock; /**< Set non-zero to avoid using m (giving up thread safety) */
+  GThread *owner; /**< The thread owning the handle without lock, NULL if the handle is not confined to a thread */
+  gboolean released; /**< TRUE if the handle is destroyed and kept in the cache of released handles */
 } ml_tensors_data_s;
 
 /**
@@ -215,8 +345,61 @@ typedef struct {
  */
 size_t _ml_tensor_info_get_size (const ml_tensor_info_s *info);
 
+/**
+ * @brief Gets the dimension of the given rank, including the extended rank beyond ML_TENSOR_RANK_LIMIT.
+ * @note This is not thread safe.
+ * @return The dimension, 1 if the rank is not set or out of ML_TENSOR_RANK_LIMIT_EXTENDED.
+ */
+unsigned int _ml_tensor_info_get_dimension (const ml_tensor_info_s *info, unsigned int rank);
+
+/**
+ * @brief Sets the dimension of the given rank, including the extended rank beyond ML_TENSOR_RANK_LIMIT.
+ * @details The dimensions beyond ML_TENSOR_RANK_LIMIT are allocated when one of them is set to other than 1.
+ * @note This is not thread safe.
+ * @return @c 0 on success. Otherwise a negative error value.
+ */
+int _ml_tensor_info_set_dimension (ml_tensor_info_s *info, unsigned int rank, unsigned int dim);
+
+/**
+ * @brief Gets the canonical tensors info of the given tensors information, interned in the global table.
+ * @details Two tensors information have same types and dimensions if the interned pointers are same.
+ * @note The info should be locked by caller if nolock == 0. The returned instance is valid until the info is changed or freed.
+ * This caches the interned instance in the given info, so the caller should own the info. Read-only paths should use info->interned if it is set.
+ * @param[in] info The tensors info pointer.
+ * @return The interned tensors info, NULL if the info is invalid.
+ */
+const ml_tensors_info_interned_s *_ml_tensors_info_get_interned (ml_tensors_info_s *info);
+
+/**
+ * @brief Gets the tensor info of the given index, including the extra tensors beyond ML_TENSOR_SIZE_LIMIT.
+ * @note The info should be locked by caller if nolock == 0.
+ * @param[in] info The tensors info pointer.
+ * @param[in] nth The index of the tensor.
+ * @return The tensor info, NULL if the index is out of bound.
+ */
+ml_tensor_info_s *_ml_tensors_info_get_nth_info (ml_tensors_info_s *info, unsigned int nth);
+
+/**
+ * @brief Gets the tensor data of the given index, including the extra tensors beyond ML_TENSOR_SIZE_LIMIT.
+ * @note The data should be locked by caller if nolock == 0.
+ * @param[in] data The tensors data pointer.
+ * @param[in] nth The index of the tensor.
+ * @return The tensor data, NULL if the index is out of bound.
+ */
+ml_tensor_data_s *_ml_tensors_data_get_nth_data (ml_tensors_data_s *data, unsigned int nth);
+
+/**
+ * @brief Resizes the list of extra tensors beyond ML_TENSOR_SIZE_LIMIT with the number of tensors.
+ * @note This does not change the number of tensors. The info should be locked by caller if nolock == 0.
+ * @param[in] info The tensors info pointer.
+ * @param[in] count The number of tensors.
+ * @return @c 0 on success. Otherwise a negative error value.
+ */
+int _ml_tensors_info_resize_extra (ml_tensors_info_s *info, unsigned int count);
+
 /**
  * @brief Initializes the tensors information with default value.
+ * @details This releases the names and dimensions of the tensors, so the info should be zero-filled or initialized before.
  * @since_tizen 5.5
  * @param[in] info The tensors info pointer to be initialized.
  * @return @c 0 on success. Otherwise a negative error value.
@@ -288,6 +471,34 @@ int _ml_tensors_data_destroy_internal (ml_tensors_data_h data, gboolean free_dat
  */
 int _ml_tensors_data_create_no_alloc (const ml_tensors_info_h info, ml_tensors_data_h *data);
 
+/**
+ * @brief Allocates the tensors of the data in a single block, with the size of each tensor in the data.
+ * @note The tensors of the data should not be allocated.
+ */
+int _ml_tensors_data_alloc_block (ml_tensors_data_s *data);
+
+/**
+ * @brief Makes the tensor of the data writable. If the tensor is shared with other handles, this copies the tensor (copy-on-write).
+ * @details The copy is allocated with the flags and allocator of the data. If the tensors are in a single block, all tensors are copied into a new block.
+ * @note The data should be locked by caller if nolock == 0. Every function writing the tensor of the data given by the application should call this first.
+ * @param[in] data The tensors data pointer.
+ * @param[in] index The index of the tensor.
+ * @param[in] keep TRUE to copy the contents of the shared tensor.
+ * @return @c 0 on success. Otherwise a negative error value.
+ */
+int _ml_tensors_data_make_writable (ml_tensors_data_s *data, unsigned int index, gboolean keep);
+
+/**
+ * @brief Gets the index of max value in the tensor, with the vectorized kernel if available.
+ * @param[in] ptr The tensor data.
+ * @param[in] len The number of elements in the tensor.
+ * @param[in] type The type of tensor element.
+ * @param[out] index The index of max value, the first one if the max values are duplicated.
+ * @param[out] max The max value, or NULL.
+ * @return @c 0 on success. Otherwise a negative error value.
+ */
+int _ml_tensor_argmax (gconstpointer ptr, gsize len, ml_tensor_type_e type, gsize *index, gdouble *max);
+
 #if defined (__TIZEN__)
 /****** TIZEN CHECK FEATURE BEGINS *****/
 /**
@@ -313,19 +524,28 @@ int _ml_tizen_set_feature_state (int state);
  * @brief Private function for error reporting infrastructure. Don't use.
  * @note Use _ml_error_report instead!
  */
-void _ml_error_report_ (const char *fmt, ...);
+void _ml_error_report_ (ml_log_site_s * site, const char *fmt, ...);
 
 /**
  * @brief Private function for error reporting infrastructure. Don't use.
  * @note Use _ml_error_report instead!
  */
-void _ml_error_report_continue_ (const char *fmt, ...);
+void _ml_error_report_continue_ (ml_log_site_s * site, const char *fmt, ...);
+
+/**
+ * @brief Private macro for error repoting infra. Don't use.
+ * @details The message is always kept for ml_error(), but the log is rate-limited for each call site.
+ */
+#define _ml_error_report_site_(func, ...)  do { \
+  static ml_log_site_s _ml_log_site = ML_LOG_SITE_INIT; \
+  func (&_ml_log_site, __VA_ARGS__); \
+} while(0)
 
 /**
  * @brief Private macro for error repoting infra. Don't use.
  */
 #define _ml_error_report_return_(errno, ...)  do { \
-  _ml_error_report_ (__VA_ARGS__); \
+  _ml_error_report_site_ (_ml_error_report_, __VA_ARGS__); \
   return errno; \
 } while(0)
 
@@ -333,7 +553,7 @@ void _ml_error_report_continue_ (const char *fmt, ...);
  * @brief Private macro for error repoting infra. Don't use.
  */
 #define _ml_error_report_return_continue_(errno, ...)  do { \
-  _ml_error_report_continue_ (__VA_ARGS__); \
+  _ml_error_report_site_ (_ml_error_report_continue_, __VA_ARGS__); \
   return errno; \
 } while(0)
 
@@ -343,7 +563,7 @@ void _ml_error_report_continue_ (const char *fmt, ...);
  * @note This provides source file, function name, and line number as well.
  */
 #define _ml_error_report(fmt, ...) \
-  _ml_error_report_ ("%s:%s:%d: " fmt,  __FILE__, __func__, __LINE__, ##__VA_ARGS__)
+  _ml_error_report_site_ (_ml_error_report_, "%s:%s:%d: " fmt,  __FILE__, __func__, __LINE__, ##__VA_ARGS__)
 
 /**
  * @brief Error report API. With return / W/o previous report reset.
@@ -360,7 +580,7 @@ void _ml_error_report_continue_ (const char *fmt, ...);
  * @note This provides source file, function name, and line number as well.
  */
 #define _ml_error_report_continue(fmt, ...) \
-  _ml_error_report_continue_ ("%s:%s:%d: " fmt,  __FILE__, __func__, __LINE__, ##__VA_ARGS__)
+  _ml_error_report_site_ (_ml_error_report_continue_, "%s:%s:%d: " fmt,  __FILE__, __func__, __LINE__, ##__VA_ARGS__)
 
 /**
  * @brief Error report API. With return & previous report reset.
@@ -22,6 +22,7 @@ NNSTREAMER_CAPI_INCLUDES := \
 NNSTREAMER_SRC_FILES := \
     $(NNSTREAMER_COMMON_SRCS) \
     $(ML_API_ROOT)/c/src/ml-api-common.c \
+    $(ML_API_ROOT)/c/src/ml-api-common-kernels.c \
     $(ML_API_ROOT)/c/src/ml-api-inference-internal.c \
     $(ML_API_ROOT)/c/src/ml-api-inference-single.c
 
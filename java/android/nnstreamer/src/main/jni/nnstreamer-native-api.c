@@ -490,6 +490,7 @@ nns_parse_tensors_data (pipeline_info_s * pipe_info, JNIEnv * env,
   ml_tensors_data_s *data;
   jobjectArray data_arr;
   gboolean failed = FALSE;
+  gboolean created = FALSE;
   int status;
 
   g_return_val_if_fail (pipe_info, FALSE);
@@ -522,6 +523,8 @@ nns_parse_tensors_data (pipeline_info_s * pipe_info, JNIEnv * env,
       nns_loge ("Failed to create handle for tensors data.");
       return FALSE;
     }
+
+    created = TRUE;
   }
 
   data = (ml_tensors_data_s *) (*data_h);
@@ -530,6 +533,30 @@ nns_parse_tensors_data (pipeline_info_s * pipe_info, JNIEnv * env,
   /* number of tensors data */
   data->num_tensors = (unsigned int) (*env)->GetArrayLength (env, data_arr);
 
+  /* allocate all tensors in a single block, instead of a buffer per tensor */
+  if (clone && data->num_tensors > 0 && data->tensors[0].tensor == NULL) {
+    for (i = 0; i < data->num_tensors; i++) {
+      jobject tensor = (*env)->GetObjectArrayElement (env, data_arr, i);
+
+      if (tensor == NULL) {
+        nns_loge ("Failed to get array element in tensors data object.");
+        failed = TRUE;
+        goto done;
+      }
+
+      data->tensors[i].size =
+          (size_t) (*env)->GetDirectBufferCapacity (env, tensor);
+      (*env)->DeleteLocalRef (env, tensor);
+    }
+
+    data->alloc_flags |= ML_TENSORS_DATA_FLAG_NO_ZERO_FILL;
+    if (_ml_tensors_data_alloc_block (data) != ML_ERROR_NONE) {
+      nns_loge ("Failed to allocate the block for tensors data.");
+      failed = TRUE;
+      goto done;
+    }
+  }
+
   /* set tensor data */
   for (i = 0; i < data->num_tensors; i++) {
     jobject tensor = (*env)->GetObjectArrayElement (env, data_arr, i);
@@ -560,8 +587,13 @@ nns_parse_tensors_data (pipeline_info_s * pipe_info, JNIEnv * env,
 done:
   (*env)->DeleteLocalRef (env, data_arr);
 
-  if (failed) {
-    ml_tensors_data_destroy (*data_h);
+  /**
+   * Release the handle only if it is created here.
+   * The given handle is owned by the caller (e.g., the output of custom filter),
+   * and the tensors without clone are the direct buffers of the data object.
+   */
+  if (failed && created) {
+    _ml_tensors_data_destroy_internal (*data_h, clone);
     *data_h = NULL;
   }
 
@@ -625,107 +625,116 @@ waitPipelineStateChange (ml_pipeline_h handle, ml_pipeline_state_e state, guint
 }
 
 /**
- * @brief Test NNStreamer pipeline sink
+ * @brief Test NNStreamer pipeline template
  */
-TEST (nnstreamer_capi_sink, dummy_01)
+TEST (nnstreamer_capi_construct_destruct, template_01_p)
 {
-  const gchar *_tmpdir = g_get_tmp_dir ();
-  const gchar *_dirname = "nns-tizen-XXXXXX";
-  gchar *fullpath = g_build_path ("/", _tmpdir, _dirname, NULL);
-  gchar *dir = g_mkdtemp ((gchar *)fullpath);
-
-  ASSERT_NE (dir, (gchar *)NULL);
-
-  gchar *file1 = g_build_path ("/", dir, "original", NULL);
-  gchar *file2 = g_build_path ("/", dir, "sink", NULL);
-  gchar *pipeline = g_strdup_printf (
-      "videotestsrc num-buffers=3 ! videoconvert ! videoscale ! video/x-raw,format=BGRx,width=64,height=48,famerate=30/1 ! tee name=t t. ! queue ! filesink location=\"%s\" buffer-mode=unbuffered t. ! queue ! tensor_converter ! tensor_sink name=sinkx",
-      file1);
+  const char *pipeline = "videotestsrc name=vsrc num-buffers=${frames} ! videoconvert ! videoscale ! "
+      "video/x-raw,format=RGB,width=32,height=24 ! tensor_converter ! valve name=valvex drop=${drop} ! tensor_sink name=sinkx sync=false";
+  const char *names[] = { "frames", "drop" };
+  const char *values[2][2] = { { "3", "false" }, { "5", "false" } };
+  const guint expected[2] = { 3U, 5U };
+  ml_pipeline_template_h tmpl;
   ml_pipeline_h handle;
   ml_pipeline_sink_h sinkhandle;
-  int status = ml_pipeline_construct (pipeline, NULL, NULL, &handle);
-  EXPECT_EQ (status, ML_ERROR_NONE);
+  guint *count_sink;
+  guint i;
+  int status;
 
-  status = ml_pipeline_sink_register (
-      handle, "sinkx", test_sink_callback_dm01, file2, &sinkhandle);
+  status = ml_pipeline_template_create (pipeline, &tmpl);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_TRUE (sinkhandle != NULL);
 
-  status = ml_pipeline_start (handle);
-  EXPECT_EQ (status, ML_ERROR_NONE);
+  count_sink = (guint *)g_malloc (sizeof (guint));
+  ASSERT_TRUE (count_sink != NULL);
 
-  status = waitPipelineStateChange (handle, ML_PIPELINE_STATE_PLAYING, 200);
-  EXPECT_EQ (status, ML_ERROR_NONE);
+  /* construct the pipelines with different parameters */
+  for (i = 0; i < 2; i++) {
+    *count_sink = 0;
 
-  /* 200ms. Give enough time for three frames to flow. */
-  g_usleep (200000);
+    status = ml_pipeline_template_construct (tmpl, names, values[i], 2, NULL, NULL, &handle);
+    EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_pipeline_stop (handle);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-  g_usleep (10000); /* 10ms. Wait a bit. */
+    status = ml_pipeline_sink_register (
+        handle, "sinkx", test_sink_callback_count, count_sink, &sinkhandle);
+    EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_pipeline_sink_unregister (sinkhandle);
-  EXPECT_EQ (status, ML_ERROR_NONE);
+    status = ml_pipeline_start (handle);
+    EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_pipeline_destroy (handle);
-  EXPECT_EQ (status, ML_ERROR_NONE);
+    /* 300ms. Give enough time for the frames to flow. */
+    g_usleep (300000);
 
-  g_free (pipeline);
+    status = ml_pipeline_stop (handle);
+    EXPECT_EQ (status, ML_ERROR_NONE);
 
-  /* File Comparison to check the integrity */
-  EXPECT_EQ (file_cmp (file1, file2), 0);
+    status = ml_pipeline_sink_unregister (sinkhandle);
+    EXPECT_EQ (status, ML_ERROR_NONE);
 
-  g_free (fullpath);
-  g_free (file1);
-  g_free (file2);
+    status = ml_pipeline_destroy (handle);
+    EXPECT_EQ (status, ML_ERROR_NONE);
+
+    EXPECT_EQ (*count_sink, expected[i]);
+  }
+
+  status = ml_pipeline_template_destroy (tmpl);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  g_free (count_sink);
 }
 
 /**
- * @brief Test NNStreamer pipeline sink
+ * @brief Test NNStreamer pipeline template with the elements separated by whitespace
  */
-TEST (nnstreamer_capi_sink, dummy_02)
+TEST (nnstreamer_capi_construct_destruct, template_03_p)
 {
+  const char *pipeline = "videotestsrc name=vsrc num-buffers=3 ! fakesink name=fsink "
+      "videotestsrc num-buffers=${frames} name=vsrc2 ! tensor_converter ! tensor_sink sync=${sync} name=sinkx";
+  const char *names[] = { "frames", "sync" };
+  const char *values[] = { "5", "false" };
+  ml_pipeline_template_h tmpl;
   ml_pipeline_h handle;
-  ml_pipeline_state_e state;
+  ml_pipeline_element_h elem;
   ml_pipeline_sink_h sinkhandle;
-  gchar *pipeline;
-  int status;
+  int32_t num_buffers;
   guint *count_sink;
-  TestPipeState *pipe_state;
+  int status;
 
-  /* pipeline with appsink */
-  pipeline = g_strdup ("videotestsrc num-buffers=3 ! videoconvert ! tensor_converter ! appsink name=sinkx sync=false");
+  /* the parameters belong to vsrc2 and sinkx, not the first named element in the segment */
+  status = ml_pipeline_template_create (pipeline, &tmpl);
+  ASSERT_EQ (status, ML_ERROR_NONE);
 
-  count_sink = (guint *)g_malloc (sizeof (guint));
+  count_sink = (guint *)g_malloc0 (sizeof (guint));
   ASSERT_TRUE (count_sink != NULL);
-  *count_sink = 0;
 
-  pipe_state = (TestPipeState *)g_new0 (TestPipeState, 1);
-  ASSERT_TRUE (pipe_state != NULL);
+  status = ml_pipeline_template_construct (tmpl, names, values, 2, NULL, NULL, &handle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_pipeline_construct (pipeline, test_pipe_state_callback, pipe_state, &handle);
+  status = ml_pipeline_element_get_handle (handle, "vsrc", &elem);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  status = ml_pipeline_element_get_property_int32 (elem, "num-buffers", &num_buffers);
   EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (num_buffers, 3);
+  ml_pipeline_element_release_handle (elem);
+
+  status = ml_pipeline_element_get_handle (handle, "vsrc2", &elem);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  status = ml_pipeline_element_get_property_int32 (elem, "num-buffers", &num_buffers);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (num_buffers, 5);
+  ml_pipeline_element_release_handle (elem);
 
   status = ml_pipeline_sink_register (
       handle, "sinkx", test_sink_callback_count, count_sink, &sinkhandle);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_TRUE (sinkhandle != NULL);
 
   status = ml_pipeline_start (handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  g_usleep (100000); /* 100ms. Let a few frames flow. */
-  status = ml_pipeline_get_state (handle, &state);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (state, ML_PIPELINE_STATE_PLAYING);
+  /* 300ms. Give enough time for the frames to flow. */
+  g_usleep (300000);
 
   status = ml_pipeline_stop (handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  g_usleep (10000); /* 10ms. Wait a bit. */
-
-  status = ml_pipeline_get_state (handle, &state);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (state, ML_PIPELINE_STATE_PAUSED);
 
   status = ml_pipeline_sink_unregister (sinkhandle);
   EXPECT_EQ (status, ML_ERROR_NONE);
@@ -733,3034 +742,6383 @@ TEST (nnstreamer_capi_sink, dummy_02)
   status = ml_pipeline_destroy (handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  EXPECT_TRUE (*count_sink > 0U);
-  EXPECT_TRUE (pipe_state->paused);
-  EXPECT_TRUE (pipe_state->playing);
+  EXPECT_EQ (*count_sink, 5U);
+
+  status = ml_pipeline_template_destroy (tmpl);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-  g_free (pipeline);
   g_free (count_sink);
-  g_free (pipe_state);
 }
 
 /**
- * @brief Test NNStreamer pipeline sink
+ * @brief Test NNStreamer pipeline template with invalid param
  */
-TEST (nnstreamer_capi_sink, register_duplicated)
+TEST (nnstreamer_capi_construct_destruct, template_02_n)
 {
+  const char *pipeline = "videotestsrc name=vsrc num-buffers=${frames} ! tensor_converter ! tensor_sink name=sinkx";
+  const char *names[] = { "frames", "unknown" };
+  const char *values[] = { "3", "1" };
+  ml_pipeline_template_h tmpl;
   ml_pipeline_h handle;
-  ml_pipeline_sink_h sinkhandle0, sinkhandle1;
-  gchar *pipeline;
   int status;
-  guint *count_sink0, *count_sink1;
-  TestPipeState *pipe_state;
 
-  /* pipeline with appsink */
-  pipeline = g_strdup ("videotestsrc num-buffers=3 ! videoconvert ! tensor_converter ! appsink name=sinkx sync=false");
-  count_sink0 = (guint *)g_malloc (sizeof (guint));
-  ASSERT_TRUE (count_sink0 != NULL);
-  *count_sink0 = 0;
+  status = ml_pipeline_template_create (NULL, &tmpl);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
 
-  count_sink1 = (guint *)g_malloc (sizeof (guint));
-  ASSERT_TRUE (count_sink1 != NULL);
-  *count_sink1 = 0;
+  status = ml_pipeline_template_create (pipeline, NULL);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
 
-  pipe_state = (TestPipeState *)g_new0 (TestPipeState, 1);
-  ASSERT_TRUE (pipe_state != NULL);
+  /* the element with parameter should have its name */
+  status = ml_pipeline_template_create ("videotestsrc num-buffers=${frames} ! fakesink", &tmpl);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
 
-  status = ml_pipeline_construct (pipeline, test_pipe_state_callback, pipe_state, &handle);
-  EXPECT_EQ (status, ML_ERROR_NONE);
+  /* the named element before the whitespace is not the owner of parameter */
+  status = ml_pipeline_template_create ("fakesrc name=fsrc ! fakesink name=fsink videotestsrc num-buffers=${frames} ! fakesink", &tmpl);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
 
-  status = ml_pipeline_sink_register (
-      handle, "sinkx", test_sink_callback_count, count_sink0, &sinkhandle0);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_TRUE (sinkhandle0 != NULL);
+  /* the element name cannot be the parameter */
+  status = ml_pipeline_template_create ("videotestsrc name=${name} ! fakesink", &tmpl);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
 
-  status = ml_pipeline_sink_register (
-      handle, "sinkx", test_sink_callback_count, count_sink1, &sinkhandle1);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_TRUE (sinkhandle1 != NULL);
+  /* the property does not exist */
+  status = ml_pipeline_template_create ("videotestsrc name=vsrc no-prop=${frames} ! fakesink", &tmpl);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
 
-  status = ml_pipeline_start (handle);
+  status = ml_pipeline_template_create ("nonexistsrc name=src num-buffers=${frames} ! fakesink", &tmpl);
+  EXPECT_EQ (status, ML_ERROR_STREAMS_PIPE);
+
+  status = ml_pipeline_template_create (pipeline, &tmpl);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  g_usleep (100000); /* 100ms. Let a few frames flow. */
+  status = ml_pipeline_template_construct (NULL, names, values, 1, NULL, NULL, &handle);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
 
-  status = ml_pipeline_sink_unregister (sinkhandle0);
-  EXPECT_EQ (status, ML_ERROR_NONE);
+  status = ml_pipeline_template_construct (tmpl, names, values, 1, NULL, NULL, NULL);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
 
-  status = ml_pipeline_sink_unregister (sinkhandle1);
-  EXPECT_EQ (status, ML_ERROR_NONE);
+  /* the value of parameter is not given */
+  status = ml_pipeline_template_construct (tmpl, NULL, NULL, 0, NULL, NULL, &handle);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
 
-  status = ml_pipeline_destroy (handle);
-  EXPECT_EQ (status, ML_ERROR_NONE);
+  /* unknown parameter */
+  status = ml_pipeline_template_construct (tmpl, names, values, 2, NULL, NULL, &handle);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
 
-  EXPECT_TRUE (*count_sink0 > 0U);
-  EXPECT_TRUE (*count_sink1 > 0U);
-  EXPECT_TRUE (pipe_state->paused);
-  EXPECT_TRUE (pipe_state->playing);
+  status = ml_pipeline_template_destroy (tmpl);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-  g_free (pipeline);
-  g_free (count_sink0);
-  g_free (count_sink1);
-  g_free (pipe_state);
+  status = ml_pipeline_template_destroy (NULL);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
 }
 
 /**
- * @brief Test NNStreamer pipeline sink
- * @detail Failure case to register callback with invalid param.
+ * @brief Internal function to push the frames into the src node.
  */
-TEST (nnstreamer_capi_sink, failure_01_n)
+static void
+test_push_frames (ml_pipeline_h handle, guint frames)
 {
-  ml_pipeline_sink_h sinkhandle;
+  ml_pipeline_src_h srchandle;
+  ml_tensors_info_h info;
+  ml_tensors_data_h data;
+  uint8_t frame[4] = { 1, 2, 3, 4 };
+  guint i;
   int status;
-  guint *count_sink;
 
-  count_sink = (guint *)g_malloc (sizeof (guint));
-  ASSERT_TRUE (count_sink != NULL);
-  *count_sink = 0;
+  status = ml_pipeline_src_get_handle (handle, "srcx", &srchandle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-  /* invalid param : pipe */
-  status = ml_pipeline_sink_register (
-      NULL, "sinkx", test_sink_callback_count, count_sink, &sinkhandle);
-  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+  status = ml_pipeline_src_get_tensors_info (srchandle, &info);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-  g_free (count_sink);
+  status = ml_tensors_data_create (info, &data);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_tensors_data_set_tensor_data (data, 0, frame, 4);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  for (i = 0; i < frames; i++) {
+    status = ml_pipeline_src_input_data (srchandle, data,
+        ML_PIPELINE_BUF_POLICY_DO_NOT_FREE);
+    EXPECT_EQ (status, ML_ERROR_NONE);
+
+    g_usleep (10000); /* 10ms. Wait a bit. */
+  }
+
+  /* 100ms. Give enough time for the frames to flow. */
+  g_usleep (100000);
+
+  status = ml_pipeline_src_release_handle (srchandle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  ml_tensors_data_destroy (data);
+  ml_tensors_info_destroy (info);
 }
 
 /**
- * @brief Test NNStreamer pipeline sink
- * @detail Failure case to register callback with invalid param.
+ * @brief Test NNStreamer pipeline reset
  */
-TEST (nnstreamer_capi_sink, failure_02_n)
+TEST (nnstreamer_capi_construct_destruct, reset_01_p)
 {
+  const char *pipeline = "appsrc name=srcx ! other/tensor,dimension=(string)4:1:1:1,type=(string)uint8,framerate=(fraction)0/1 ! "
+      "tensor_sink name=sinkx sync=false async=false";
   ml_pipeline_h handle;
   ml_pipeline_sink_h sinkhandle;
-  gchar *pipeline;
-  int status;
+  ml_pipeline_state_e state;
   guint *count_sink;
-
-  pipeline = g_strdup ("videotestsrc num-buffers=3 ! videoconvert ! valve name=valvex ! tensor_converter ! tensor_sink name=sinkx");
+  guint i;
+  int status;
 
   count_sink = (guint *)g_malloc (sizeof (guint));
   ASSERT_TRUE (count_sink != NULL);
-  *count_sink = 0;
 
   status = ml_pipeline_construct (pipeline, NULL, NULL, &handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  /* invalid param : name */
-  status = ml_pipeline_sink_register (
-      handle, NULL, test_sink_callback_count, count_sink, &sinkhandle);
-  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+  /* reuse the pipeline for each session */
+  for (i = 0; i < 3; i++) {
+    *count_sink = 0;
 
-  g_free (pipeline);
-  g_free (count_sink);
-}
+    status = ml_pipeline_sink_register (
+        handle, "sinkx", test_sink_callback_count, count_sink, &sinkhandle);
+    EXPECT_EQ (status, ML_ERROR_NONE);
 
-/**
- * @brief Test NNStreamer pipeline sink
- * @detail Failure case to register callback with invalid param.
- */
-TEST (nnstreamer_capi_sink, failure_03_n)
-{
-  ml_pipeline_h handle;
-  ml_pipeline_sink_h sinkhandle;
-  gchar *pipeline;
-  int status;
-  guint *count_sink;
+    status = ml_pipeline_start (handle);
+    EXPECT_EQ (status, ML_ERROR_NONE);
 
-  pipeline = g_strdup ("videotestsrc num-buffers=3 ! videoconvert ! valve name=valvex ! tensor_converter ! tensor_sink name=sinkx");
+    test_push_frames (handle, i + 2);
 
-  count_sink = (guint *)g_malloc (sizeof (guint));
-  ASSERT_TRUE (count_sink != NULL);
-  *count_sink = 0;
+    /* the sink handle is released */
+    status = ml_pipeline_reset (handle);
+    EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_pipeline_construct (pipeline, NULL, NULL, &handle);
+    status = ml_pipeline_get_state (handle, &state);
+    EXPECT_EQ (status, ML_ERROR_NONE);
+    EXPECT_EQ (state, ML_PIPELINE_STATE_PAUSED);
+
+    EXPECT_EQ (*count_sink, i + 2);
+  }
+
+  status = ml_pipeline_destroy (handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  /* invalid param : wrong name */
-  status = ml_pipeline_sink_register (
-      handle, "wrongname", test_sink_callback_count, count_sink, &sinkhandle);
+  status = ml_pipeline_reset (NULL);
   EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
 
-  g_free (pipeline);
   g_free (count_sink);
 }
 
 /**
- * @brief Test NNStreamer pipeline sink
- * @detail Failure case to register callback with invalid param.
+ * @brief Test NNStreamer pipeline pool
  */
-TEST (nnstreamer_capi_sink, failure_04_n)
+TEST (nnstreamer_capi_construct_destruct, pool_01_p)
 {
-  ml_pipeline_h handle;
+  const char *pipeline = "appsrc name=srcx ! other/tensor,dimension=(string)4:1:1:1,type=(string)uint8,framerate=(fraction)0/1 ! "
+      "valve name=valvex drop=${drop} ! tensor_sink name=sinkx sync=false async=false";
+  const char *names[] = { "drop" };
+  const char *values[] = { "false" };
+  ml_pipeline_template_h tmpl;
+  ml_pipeline_pool_h pool;
+  ml_pipeline_h pipe1, pipe2, pipe3;
   ml_pipeline_sink_h sinkhandle;
-  gchar *pipeline;
-  int status;
   guint *count_sink;
+  int status;
 
-  pipeline = g_strdup ("videotestsrc num-buffers=3 ! videoconvert ! valve name=valvex ! tensor_converter ! tensor_sink name=sinkx");
-
-  count_sink = (guint *)g_malloc (sizeof (guint));
+  count_sink = (guint *)g_malloc0 (sizeof (guint));
   ASSERT_TRUE (count_sink != NULL);
-  *count_sink = 0;
 
-  status = ml_pipeline_construct (pipeline, NULL, NULL, &handle);
+  status = ml_pipeline_template_create (pipeline, &tmpl);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  /* invalid param : invalid type */
-  status = ml_pipeline_sink_register (
-      handle, "valvex", test_sink_callback_count, count_sink, &sinkhandle);
-  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+  status = ml_pipeline_pool_create (tmpl, names, values, 1, 1, &pool);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-  g_free (pipeline);
-  g_free (count_sink);
-}
-
-/**
- * @brief Test NNStreamer pipeline sink
- * @detail Failure case to register callback with invalid param.
- */
-TEST (nnstreamer_capi_sink, failure_05_n)
-{
-  ml_pipeline_h handle;
-  ml_pipeline_sink_h sinkhandle;
-  gchar *pipeline;
-  int status;
-  guint *count_sink;
+  /* the first one is ready, the second one is constructed. */
+  status = ml_pipeline_pool_acquire (pool, &pipe1);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-  pipeline = g_strdup ("videotestsrc num-buffers=3 ! videoconvert ! valve name=valvex ! tensor_converter ! tensor_sink name=sinkx");
+  status = ml_pipeline_pool_acquire (pool, &pipe2);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_NE (pipe1, pipe2);
 
-  count_sink = (guint *)g_malloc (sizeof (guint));
-  ASSERT_TRUE (count_sink != NULL);
-  *count_sink = 0;
+  status = ml_pipeline_sink_register (
+      pipe1, "sinkx", test_sink_callback_count, count_sink, &sinkhandle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_pipeline_construct (pipeline, NULL, NULL, &handle);
+  status = ml_pipeline_start (pipe1);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  /* invalid param : callback */
-  status = ml_pipeline_sink_register (handle, "sinkx", NULL, count_sink, &sinkhandle);
+  test_push_frames (pipe1, 3);
+  EXPECT_EQ (*count_sink, 3U);
+
+  /* cannot destroy the pool before releasing the pipelines */
+  status = ml_pipeline_pool_destroy (pool);
   EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
 
-  g_free (pipeline);
-  g_free (count_sink);
-}
+  /* the pool keeps one pipeline, the second one is destroyed. */
+  status = ml_pipeline_pool_release (pool, pipe1);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-/**
- * @brief Test NNStreamer pipeline sink
- * @detail Failure case to register callback with invalid param.
- */
-TEST (nnstreamer_capi_sink, failure_06_n)
-{
-  ml_pipeline_h handle;
-  gchar *pipeline;
-  int status;
-  guint *count_sink;
+  status = ml_pipeline_pool_release (pool, pipe2);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-  pipeline = g_strdup ("videotestsrc num-buffers=3 ! videoconvert ! valve name=valvex ! tensor_converter ! tensor_sink name=sinkx");
+  /* the released pipeline is reused */
+  status = ml_pipeline_pool_acquire (pool, &pipe3);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (pipe1, pipe3);
 
-  count_sink = (guint *)g_malloc (sizeof (guint));
-  ASSERT_TRUE (count_sink != NULL);
-  *count_sink = 0;
+  status = ml_pipeline_pool_release (pool, pipe3);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_pipeline_construct (pipeline, NULL, NULL, &handle);
+  status = ml_pipeline_pool_destroy (pool);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  /* invalid param : handle */
-  status = ml_pipeline_sink_register (
-      handle, "sinkx", test_sink_callback_count, count_sink, NULL);
-  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+  status = ml_pipeline_template_destroy (tmpl);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-  g_free (pipeline);
   g_free (count_sink);
 }
 
 /**
- * @brief Test NNStreamer pipeline src
+ * @brief Test NNStreamer pipeline pool with invalid param
  */
-TEST (nnstreamer_capi_src, dummy_01)
+TEST (nnstreamer_capi_construct_destruct, pool_02_n)
 {
-  const gchar *_tmpdir = g_get_tmp_dir ();
-  const gchar *_dirname = "nns-tizen-XXXXXX";
-  gchar *fullpath = g_build_path ("/", _tmpdir, _dirname, NULL);
-  gchar *dir = g_mkdtemp ((gchar *)fullpath);
-  gchar *file1 = g_build_path ("/", dir, "output", NULL);
-  gchar *pipeline = g_strdup_printf (
-      "appsrc name=srcx ! other/tensor,dimension=(string)4:1:1:1,type=(string)uint8,framerate=(fraction)0/1 ! filesink location=\"%s\" buffer-mode=unbuffered",
-      file1);
-  ml_pipeline_h handle;
-  ml_pipeline_state_e state;
-  ml_pipeline_src_h srchandle;
+  const char *pipeline = "videotestsrc name=vsrc num-buffers=${frames} ! tensor_converter ! tensor_sink name=sinkx";
+  const char *names[] = { "frames" };
+  const char *values[] = { "3" };
+  ml_pipeline_template_h tmpl;
+  ml_pipeline_pool_h pool;
+  ml_pipeline_h pipe;
   int status;
-  ml_tensors_info_h info;
-  ml_tensors_data_h data1, data2;
-  unsigned int count = 0;
-  ml_tensor_type_e type = ML_TENSOR_TYPE_UNKNOWN;
-  ml_tensor_dimension dim = {
-    0,
-  };
-
-  int i;
-  uint8_t *uintarray1[10];
-  uint8_t *uintarray2[10];
-  uint8_t *content = NULL;
-  gsize len;
 
-  status = ml_pipeline_construct (pipeline, NULL, NULL, &handle);
+  status = ml_pipeline_template_create (pipeline, &tmpl);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_TRUE (dir != NULL);
-  for (i = 0; i < 10; i++) {
-    uintarray1[i] = (uint8_t *)g_malloc (4);
-    ASSERT_TRUE (uintarray1[i] != NULL);
-    uintarray1[i][0] = i + 4;
-    uintarray1[i][1] = i + 1;
-    uintarray1[i][2] = i + 3;
-    uintarray1[i][3] = i + 2;
 
-    uintarray2[i] = (uint8_t *)g_malloc (4);
-    ASSERT_TRUE (uintarray2[i] != NULL);
-    uintarray2[i][0] = i + 3;
-    uintarray2[i][1] = i + 2;
-    uintarray2[i][2] = i + 1;
-    uintarray2[i][3] = i + 4;
-    /* These will be free'ed by gstreamer (ML_PIPELINE_BUF_POLICY_AUTO_FREE) */
-    /** @todo Check whether gstreamer really deallocates this */
-  }
+  status = ml_pipeline_pool_create (NULL, names, values, 1, 1, &pool);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
 
-  status = ml_pipeline_start (handle);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-  g_usleep (10000); /* 10ms. Wait a bit. */
-  status = ml_pipeline_get_state (handle, &state);
-  EXPECT_EQ (status,
-      ML_ERROR_NONE); /* At this moment, it can be READY, PAUSED, or PLAYING */
-  EXPECT_NE (state, ML_PIPELINE_STATE_UNKNOWN);
-  EXPECT_NE (state, ML_PIPELINE_STATE_NULL);
+  status = ml_pipeline_pool_create (tmpl, names, values, 1, 0, &pool);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
 
-  status = ml_pipeline_src_get_handle (handle, "srcx", &srchandle);
-  EXPECT_EQ (status, ML_ERROR_NONE);
+  status = ml_pipeline_pool_create (tmpl, names, values, 1, 1, NULL);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
 
-  status = ml_pipeline_src_get_tensors_info (srchandle, &info);
-  EXPECT_EQ (status, ML_ERROR_NONE);
+  /* the value of parameter is not given */
+  status = ml_pipeline_pool_create (tmpl, NULL, NULL, 0, 1, &pool);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
 
-  ml_tensors_info_get_count (info, &count);
-  EXPECT_EQ (count, 1U);
+  status = ml_pipeline_pool_create (tmpl, names, values, 1, 1, &pool);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-  ml_tensors_info_get_tensor_type (info, 0, &type);
-  EXPECT_EQ (type, ML_TENSOR_TYPE_UINT8);
+  status = ml_pipeline_pool_acquire (NULL, &pipe);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
 
-  ml_tensors_info_get_tensor_dimension (info, 0, dim);
-  EXPECT_EQ (dim[0], 4U);
-  EXPECT_EQ (dim[1], 1U);
-  EXPECT_EQ (dim[2], 1U);
-  EXPECT_EQ (dim[3], 1U);
+  status = ml_pipeline_pool_acquire (pool, NULL);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
 
-  status = ml_tensors_data_create (info, &data1);
+  /* the pipeline is not acquired from the pool */
+  status = ml_pipeline_construct ("videotestsrc num-buffers=3 ! fakesink", NULL, NULL, &pipe);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  ml_tensors_info_destroy (info);
+  status = ml_pipeline_pool_release (pool, pipe);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
 
-  status = ml_tensors_data_set_tensor_data (data1, 0, uintarray1[0], 4);
+  status = ml_pipeline_destroy (pipe);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_pipeline_src_input_data (srchandle, data1, ML_PIPELINE_BUF_POLICY_DO_NOT_FREE);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-  g_usleep (50000); /* 50ms. Wait a bit. */
+  status = ml_pipeline_pool_release (pool, NULL);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
 
-  status = ml_pipeline_src_input_data (srchandle, data1, ML_PIPELINE_BUF_POLICY_DO_NOT_FREE);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-  g_usleep (50000); /* 50ms. Wait a bit. */
+  status = ml_pipeline_pool_destroy (NULL);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
 
-  status = ml_pipeline_src_release_handle (srchandle);
+  status = ml_pipeline_pool_destroy (pool);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_pipeline_src_get_handle (handle, "srcx", &srchandle);
+  status = ml_pipeline_template_destroy (tmpl);
   EXPECT_EQ (status, ML_ERROR_NONE);
+}
 
-  status = ml_pipeline_src_get_tensors_info (srchandle, &info);
-  EXPECT_EQ (status, ML_ERROR_NONE);
+/**
+ * @brief Callback for asynchronous pipeline operation.
+ */
+static void
+test_pipe_async_callback (int status, void *user_data)
+{
+  gint *result = (gint *)user_data;
 
-  ml_tensors_info_get_count (info, &count);
-  EXPECT_EQ (count, 1U);
+  /* 1 if the operation is done successfully */
+  g_atomic_int_set (result, (status == ML_ERROR_NONE) ? 1 : -1);
+}
 
-  ml_tensors_info_get_tensor_type (info, 0, &type);
-  EXPECT_EQ (type, ML_TENSOR_TYPE_UINT8);
+/**
+ * @brief Internal function to wait for the asynchronous pipeline operation.
+ */
+static gint
+test_wait_async_result (gint *result)
+{
+  guint i;
 
-  ml_tensors_info_get_tensor_dimension (info, 0, dim);
-  EXPECT_EQ (dim[0], 4U);
-  EXPECT_EQ (dim[1], 1U);
-  EXPECT_EQ (dim[2], 1U);
-  EXPECT_EQ (dim[3], 1U);
+  for (i = 0; i < 100; i++) {
+    if (g_atomic_int_get (result) != 0)
+      break;
 
-  for (i = 0; i < 10; i++) {
-    status = ml_tensors_data_set_tensor_data (data1, 0, uintarray1[i], 4);
-    EXPECT_EQ (status, ML_ERROR_NONE);
+    g_usleep (10000); /* 10ms. Wait a bit. */
+  }
 
-    status = ml_pipeline_src_input_data (srchandle, data1, ML_PIPELINE_BUF_POLICY_DO_NOT_FREE);
-    EXPECT_EQ (status, ML_ERROR_NONE);
+  return g_atomic_int_get (result);
+}
 
-    status = ml_tensors_data_create (info, &data2);
-    EXPECT_EQ (status, ML_ERROR_NONE);
+/**
+ * @brief Test NNStreamer pipeline asynchronous start and destroy
+ */
+TEST (nnstreamer_capi_playstop, async_01_p)
+{
+  const char *pipeline = "videotestsrc is-live=true ! videoconvert ! tensor_converter ! tensor_sink name=sinkx sync=false";
+  ml_pipeline_h handle;
+  ml_pipeline_state_e state;
+  gint started = 0, destroyed = 0;
+  guint i;
+  int status;
 
-    status = ml_tensors_data_set_tensor_data (data2, 0, uintarray2[i], 4);
-    EXPECT_EQ (status, ML_ERROR_NONE);
+  /* destroy many pipelines without waiting for each pipeline */
+  for (i = 0; i < 10; i++) {
+    started = destroyed = 0;
 
-    status = ml_pipeline_src_input_data (srchandle, data2, ML_PIPELINE_BUF_POLICY_AUTO_FREE);
+    status = ml_pipeline_construct (pipeline, NULL, NULL, &handle);
     EXPECT_EQ (status, ML_ERROR_NONE);
 
-    g_usleep (50000); /* 50ms. Wait a bit. */
-  }
-
-  status = ml_pipeline_src_release_handle (srchandle);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-
-  g_usleep (50000); /* Wait for the pipeline to flush all */
-
-  status = ml_pipeline_destroy (handle);
-  EXPECT_EQ (status, ML_ERROR_NONE);
+    status = ml_pipeline_start_async (handle, test_pipe_async_callback, &started);
+    EXPECT_EQ (status, ML_ERROR_NONE);
 
-  g_free (pipeline);
+    EXPECT_EQ (test_wait_async_result (&started), 1);
 
-  EXPECT_TRUE (g_file_get_contents (file1, (gchar **)&content, &len, NULL));
-  EXPECT_EQ (len, 8U * 11);
-  EXPECT_TRUE (content != nullptr);
+    status = ml_pipeline_get_state (handle, &state);
+    EXPECT_EQ (status, ML_ERROR_NONE);
+    EXPECT_EQ (state, ML_PIPELINE_STATE_PLAYING);
 
-  if (content && len == 88U) {
-    for (i = 0; i < 10; i++) {
-      EXPECT_EQ (content[i * 8 + 0 + 8], i + 4);
-      EXPECT_EQ (content[i * 8 + 1 + 8], i + 1);
-      EXPECT_EQ (content[i * 8 + 2 + 8], i + 3);
-      EXPECT_EQ (content[i * 8 + 3 + 8], i + 2);
-      EXPECT_EQ (content[i * 8 + 4 + 8], i + 3);
-      EXPECT_EQ (content[i * 8 + 5 + 8], i + 2);
-      EXPECT_EQ (content[i * 8 + 6 + 8], i + 1);
-      EXPECT_EQ (content[i * 8 + 7 + 8], i + 4);
-    }
-  }
+    /* already playing, the callback is called immediately. */
+    started = 0;
+    status = ml_pipeline_start_async (handle, test_pipe_async_callback, &started);
+    EXPECT_EQ (status, ML_ERROR_NONE);
+    EXPECT_EQ (g_atomic_int_get (&started), 1);
 
-  g_free (content);
-  ml_tensors_info_destroy (info);
-  ml_tensors_data_destroy (data1);
+    status = ml_pipeline_destroy_async (handle, test_pipe_async_callback, &destroyed);
+    EXPECT_EQ (status, ML_ERROR_NONE);
 
-  for (i = 0; i < 10; i++) {
-    g_free (uintarray1[i]);
-    g_free (uintarray2[i]);
+    EXPECT_EQ (test_wait_async_result (&destroyed), 1);
   }
-
-  g_free (fullpath);
-  g_free (file1);
 }
 
 /**
- * @brief Test NNStreamer pipeline src
- * @detail Failure case when pipeline is NULL.
+ * @brief Test NNStreamer pipeline asynchronous start and destroy with invalid param
  */
-TEST (nnstreamer_capi_src, failure_01_n)
+TEST (nnstreamer_capi_playstop, async_02_n)
 {
+  const char *pipeline = "videotestsrc is-live=true ! videoconvert ! tensor_converter ! tensor_sink name=sinkx sync=false";
+  ml_pipeline_h handle;
+  gint result = 0;
   int status;
-  ml_pipeline_src_h srchandle;
 
-  status = ml_pipeline_src_get_handle (NULL, "dummy", &srchandle);
+  status = ml_pipeline_start_async (NULL, test_pipe_async_callback, &result);
   EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
-}
 
-/**
- * @brief Test NNStreamer pipeline src
- * @detail Failure case when the name of source node is wrong.
- */
-TEST (nnstreamer_capi_src, failure_02_n)
-{
-  const char *pipeline = "appsrc name=mysource ! other/tensor,dimension=(string)4:1:1:1,type=(string)uint8,framerate=(fraction)0/1 ! valve name=valvex ! tensor_sink";
-  ml_pipeline_h handle;
-  ml_pipeline_src_h srchandle;
+  status = ml_pipeline_destroy_async (NULL, test_pipe_async_callback, &result);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
 
-  int status = ml_pipeline_construct (pipeline, NULL, NULL, &handle);
+  status = ml_pipeline_construct (pipeline, NULL, NULL, &handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  /* invalid param : name */
-  status = ml_pipeline_src_get_handle (handle, NULL, &srchandle);
+  status = ml_pipeline_start_async (handle, NULL, NULL);
   EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
 
   status = ml_pipeline_destroy (handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
+
+  EXPECT_EQ (g_atomic_int_get (&result), 0);
 }
 
 /**
- * @brief Test NNStreamer pipeline src
- * @detail Failure case when the name of source node is wrong.
+ * @brief Test NNStreamer pipeline sink
  */
-TEST (nnstreamer_capi_src, failure_03_n)
+TEST (nnstreamer_capi_sink, dummy_01)
 {
-  const char *pipeline = "appsrc name=mysource ! other/tensor,dimension=(string)4:1:1:1,type=(string)uint8,framerate=(fraction)0/1 ! valve name=valvex ! tensor_sink";
-  ml_pipeline_h handle;
-  ml_pipeline_src_h srchandle;
+  const gchar *_tmpdir = g_get_tmp_dir ();
+  const gchar *_dirname = "nns-tizen-XXXXXX";
+  gchar *fullpath = g_build_path ("/", _tmpdir, _dirname, NULL);
+  gchar *dir = g_mkdtemp ((gchar *)fullpath);
 
+  ASSERT_NE (dir, (gchar *)NULL);
+
+  gchar *file1 = g_build_path ("/", dir, "original", NULL);
+  gchar *file2 = g_build_path ("/", dir, "sink", NULL);
+  gchar *pipeline = g_strdup_printf (
+      "videotestsrc num-buffers=3 ! videoconvert ! videoscale ! video/x-raw,format=BGRx,width=64,height=48,famerate=30/1 ! tee name=t t. ! queue ! filesink location=\"%s\" buffer-mode=unbuffered t. ! queue ! tensor_converter ! tensor_sink name=sinkx",
+      file1);
+  ml_pipeline_h handle;
+  ml_pipeline_sink_h sinkhandle;
   int status = ml_pipeline_construct (pipeline, NULL, NULL, &handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  /* invalid param : wrong name */
-  status = ml_pipeline_src_get_handle (handle, "wrongname", &srchandle);
-  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
-
-  status = ml_pipeline_destroy (handle);
+  status = ml_pipeline_sink_register (
+      handle, "sinkx", test_sink_callback_dm01, file2, &sinkhandle);
   EXPECT_EQ (status, ML_ERROR_NONE);
-}
-
-/**
- * @brief Test NNStreamer pipeline src
- * @detail Failure case when the name of source node is wrong.
- */
-TEST (nnstreamer_capi_src, failure_04_n)
-{
-  const char *pipeline = "appsrc name=mysource ! other/tensor,dimension=(string)4:1:1:1,type=(string)uint8,framerate=(fraction)0/1 ! valve name=valvex ! tensor_sink";
-  ml_pipeline_h handle;
-  ml_pipeline_src_h srchandle;
+  EXPECT_TRUE (sinkhandle != NULL);
 
-  int status = ml_pipeline_construct (pipeline, NULL, NULL, &handle);
+  status = ml_pipeline_start (handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  /* invalid param : invalid type */
-  status = ml_pipeline_src_get_handle (handle, "valvex", &srchandle);
-  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
-
-  status = ml_pipeline_destroy (handle);
+  status = waitPipelineStateChange (handle, ML_PIPELINE_STATE_PLAYING, 200);
   EXPECT_EQ (status, ML_ERROR_NONE);
-}
 
-/**
- * @brief Test NNStreamer pipeline src
- * @detail Failure case when the name of source node is wrong.
- */
-TEST (nnstreamer_capi_src, failure_05_n)
-{
-  const char *pipeline = "appsrc name=mysource ! other/tensor,dimension=(string)4:1:1:1,type=(string)uint8,framerate=(fraction)0/1 ! valve name=valvex ! tensor_sink";
-  ml_pipeline_h handle;
+  /* 200ms. Give enough time for three frames to flow. */
+  g_usleep (200000);
 
-  int status = ml_pipeline_construct (pipeline, NULL, NULL, &handle);
+  status = ml_pipeline_stop (handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
+  g_usleep (10000); /* 10ms. Wait a bit. */
 
-  /* invalid param : handle */
-  status = ml_pipeline_src_get_handle (handle, "mysource", NULL);
-  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+  status = ml_pipeline_sink_unregister (sinkhandle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
   status = ml_pipeline_destroy (handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
+
+  g_free (pipeline);
+
+  /* File Comparison to check the integrity */
+  EXPECT_EQ (file_cmp (file1, file2), 0);
+
+  g_free (fullpath);
+  g_free (file1);
+  g_free (file2);
 }
 
 /**
- * @brief Test NNStreamer pipeline src
- * @detail Failure case when the number of tensors is 0 or bigger than ML_TENSOR_SIZE_LIMIT;
+ * @brief Test NNStreamer pipeline sink
  */
-TEST (nnstreamer_capi_src, failure_06_n)
+TEST (nnstreamer_capi_sink, dummy_02)
 {
-  const char *pipeline = "appsrc name=srcx ! other/tensor,dimension=(string)4:1:1:1,type=(string)uint8,framerate=(fraction)0/1 ! tensor_sink";
   ml_pipeline_h handle;
-  ml_pipeline_src_h srchandle;
-  ml_tensors_data_h data;
-  ml_tensors_info_h info;
+  ml_pipeline_state_e state;
+  ml_pipeline_sink_h sinkhandle;
+  gchar *pipeline;
+  int status;
+  guint *count_sink;
+  TestPipeState *pipe_state;
 
-  int status = ml_pipeline_construct (pipeline, NULL, NULL, &handle);
-  EXPECT_EQ (status, ML_ERROR_NONE);
+  /* pipeline with appsink */
+  pipeline = g_strdup ("videotestsrc num-buffers=3 ! videoconvert ! tensor_converter ! appsink name=sinkx sync=false");
 
-  status = ml_pipeline_start (handle);
-  EXPECT_EQ (status, ML_ERROR_NONE);
+  count_sink = (guint *)g_malloc (sizeof (guint));
+  ASSERT_TRUE (count_sink != NULL);
+  *count_sink = 0;
 
-  status = ml_pipeline_src_get_handle (handle, "srcx", &srchandle);
-  EXPECT_EQ (status, ML_ERROR_NONE);
+  pipe_state = (TestPipeState *)g_new0 (TestPipeState, 1);
+  ASSERT_TRUE (pipe_state != NULL);
 
-  status = ml_pipeline_src_get_tensors_info (srchandle, &info);
+  status = ml_pipeline_construct (pipeline, test_pipe_state_callback, pipe_state, &handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_tensors_data_create (info, &data);
+  status = ml_pipeline_sink_register (
+      handle, "sinkx", test_sink_callback_count, count_sink, &sinkhandle);
   EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_TRUE (sinkhandle != NULL);
 
-  /* null data */
-  status = ml_pipeline_src_input_data (srchandle, NULL, ML_PIPELINE_BUF_POLICY_DO_NOT_FREE);
-  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+  status = ml_pipeline_start (handle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_pipeline_src_release_handle (srchandle);
+  g_usleep (100000); /* 100ms. Let a few frames flow. */
+  status = ml_pipeline_get_state (handle, &state);
   EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (state, ML_PIPELINE_STATE_PLAYING);
 
   status = ml_pipeline_stop (handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
+  g_usleep (10000); /* 10ms. Wait a bit. */
 
-  status = ml_pipeline_destroy (handle);
+  status = ml_pipeline_get_state (handle, &state);
   EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (state, ML_PIPELINE_STATE_PAUSED);
 
-  status = ml_tensors_data_destroy (data);
+  status = ml_pipeline_sink_unregister (sinkhandle);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_tensors_info_destroy (info);
+  status = ml_pipeline_destroy (handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
-}
-
-/**
- * @brief Internal function to push dummy into appsrc.
- */
-static void
-test_src_cb_push_dummy (ml_pipeline_src_h src_handle)
-{
-  ml_tensors_data_h data;
-  ml_tensors_info_h info;
 
-  if (ml_pipeline_src_get_tensors_info (src_handle, &info) == ML_ERROR_NONE) {
-    ml_tensors_data_create (info, &data);
-    ml_pipeline_src_input_data (src_handle, data, ML_PIPELINE_BUF_POLICY_AUTO_FREE);
-    ml_tensors_info_destroy (info);
-  }
-}
+  EXPECT_TRUE (*count_sink > 0U);
+  EXPECT_TRUE (pipe_state->paused);
+  EXPECT_TRUE (pipe_state->playing);
 
-/**
- * @brief appsrc callback - need_data.
- */
-static void
-test_src_cb_need_data (ml_pipeline_src_h src_handle, unsigned int length,
-    void *user_data)
-{
-  /* For test, push dummy if given src handles are same. */
-  if (src_handle == user_data)
-    test_src_cb_push_dummy (src_handle);
+  g_free (pipeline);
+  g_free (count_sink);
+  g_free (pipe_state);
 }
 
 /**
- * @brief Test NNStreamer pipeline src callback.
+ * @brief Test NNStreamer pipeline sink
  */
-TEST (nnstreamer_capi_src, callback_replace)
+TEST (nnstreamer_capi_sink, register_duplicated)
 {
-  const char pipeline[] = "appsrc name=srcx ! other/tensor,dimension=(string)4:1:1:1,type=(string)uint8,framerate=(fraction)0/1 ! tensor_sink name=sinkx";
   ml_pipeline_h handle;
-  ml_pipeline_src_h srchandle1, srchandle2;
-  ml_pipeline_sink_h sinkhandle;
-  ml_pipeline_src_callbacks_s callback = { 0, };
-  guint *count_sink;
+  ml_pipeline_sink_h sinkhandle0, sinkhandle1;
+  gchar *pipeline;
   int status;
+  guint *count_sink0, *count_sink1;
+  TestPipeState *pipe_state;
 
-  callback.need_data = test_src_cb_need_data;
+  /* pipeline with appsink */
+  pipeline = g_strdup ("videotestsrc num-buffers=3 ! videoconvert ! tensor_converter ! appsink name=sinkx sync=false");
+  count_sink0 = (guint *)g_malloc (sizeof (guint));
+  ASSERT_TRUE (count_sink0 != NULL);
+  *count_sink0 = 0;
 
-  count_sink = (guint *) g_malloc0 (sizeof (guint));
-  ASSERT_TRUE (count_sink != NULL);
+  count_sink1 = (guint *)g_malloc (sizeof (guint));
+  ASSERT_TRUE (count_sink1 != NULL);
+  *count_sink1 = 0;
 
-  status = ml_pipeline_construct (pipeline, NULL, NULL, &handle);
-  EXPECT_EQ (status, ML_ERROR_NONE);
+  pipe_state = (TestPipeState *)g_new0 (TestPipeState, 1);
+  ASSERT_TRUE (pipe_state != NULL);
 
-  status = ml_pipeline_src_get_handle (handle, "srcx", &srchandle1);
+  status = ml_pipeline_construct (pipeline, test_pipe_state_callback, pipe_state, &handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_pipeline_src_set_event_cb (srchandle1, &callback, srchandle1);
+  status = ml_pipeline_sink_register (
+      handle, "sinkx", test_sink_callback_count, count_sink0, &sinkhandle0);
   EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_TRUE (sinkhandle0 != NULL);
 
   status = ml_pipeline_sink_register (
-    handle, "sinkx", test_sink_callback_count, count_sink, &sinkhandle);
+      handle, "sinkx", test_sink_callback_count, count_sink1, &sinkhandle1);
   EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_TRUE (sinkhandle1 != NULL);
 
   status = ml_pipeline_start (handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  test_src_cb_push_dummy (srchandle1);
-  g_usleep (100000);
-
-  status = ml_pipeline_stop (handle);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-
-  EXPECT_TRUE (*count_sink > 1U);
-
-  /* Set new callback with new handle. */
-  status = ml_pipeline_src_get_handle (handle, "srcx", &srchandle2);
-  EXPECT_EQ (status, ML_ERROR_NONE);
+  g_usleep (100000); /* 100ms. Let a few frames flow. */
 
-  /* New callback will not push dummy. */
-  status = ml_pipeline_src_set_event_cb (srchandle2, &callback, srchandle1);
+  status = ml_pipeline_sink_unregister (sinkhandle0);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_pipeline_start (handle);
+  status = ml_pipeline_sink_unregister (sinkhandle1);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  g_usleep (100000);
-  *count_sink = 0;
-  test_src_cb_push_dummy (srchandle2);
-  g_usleep (100000);
-
   status = ml_pipeline_destroy (handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  EXPECT_TRUE (*count_sink == 1U);
-  g_free (count_sink);
+  EXPECT_TRUE (*count_sink0 > 0U);
+  EXPECT_TRUE (*count_sink1 > 0U);
+  EXPECT_TRUE (pipe_state->paused);
+  EXPECT_TRUE (pipe_state->playing);
+
+  g_free (pipeline);
+  g_free (count_sink0);
+  g_free (count_sink1);
+  g_free (pipe_state);
 }
 
 /**
- * @brief Test NNStreamer pipeline src callback.
+ * @brief Test NNStreamer pipeline sink
+ * @detail Failure case to register callback with invalid param.
  */
-TEST (nnstreamer_capi_src, callback_invalid_param_01_n)
+TEST (nnstreamer_capi_sink, failure_01_n)
 {
-  const char pipeline[] = "appsrc name=srcx ! other/tensor,dimension=(string)4:1:1:1,type=(string)uint8,framerate=(fraction)0/1 ! tensor_sink";
-  ml_pipeline_h handle;
-  ml_pipeline_src_h srchandle;
-  ml_pipeline_src_callbacks_s callback = { 0, };
+  ml_pipeline_sink_h sinkhandle;
   int status;
+  guint *count_sink;
 
-  callback.need_data = test_src_cb_need_data;
-
-  status = ml_pipeline_construct (pipeline, NULL, NULL, &handle);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-
-  status = ml_pipeline_src_get_handle (handle, "srcx", &srchandle);
-  EXPECT_EQ (status, ML_ERROR_NONE);
+  count_sink = (guint *)g_malloc (sizeof (guint));
+  ASSERT_TRUE (count_sink != NULL);
+  *count_sink = 0;
 
-  /* invalid param */
-  status = ml_pipeline_src_set_event_cb (NULL, &callback, NULL);
+  /* invalid param : pipe */
+  status = ml_pipeline_sink_register (
+      NULL, "sinkx", test_sink_callback_count, count_sink, &sinkhandle);
   EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
 
-  status = ml_pipeline_destroy (handle);
-  EXPECT_EQ (status, ML_ERROR_NONE);
+  g_free (count_sink);
 }
 
 /**
- * @brief Test NNStreamer pipeline src callback.
+ * @brief Test NNStreamer pipeline sink
+ * @detail Failure case to register callback with invalid param.
  */
-TEST (nnstreamer_capi_src, callback_invalid_param_02_n)
+TEST (nnstreamer_capi_sink, failure_02_n)
 {
-  const char pipeline[] = "appsrc name=srcx ! other/tensor,dimension=(string)4:1:1:1,type=(string)uint8,framerate=(fraction)0/1 ! tensor_sink";
   ml_pipeline_h handle;
-  ml_pipeline_src_h srchandle;
+  ml_pipeline_sink_h sinkhandle;
+  gchar *pipeline;
   int status;
+  guint *count_sink;
 
-  status = ml_pipeline_construct (pipeline, NULL, NULL, &handle);
-  EXPECT_EQ (status, ML_ERROR_NONE);
+  pipeline = g_strdup ("videotestsrc num-buffers=3 ! videoconvert ! valve name=valvex ! tensor_converter ! tensor_sink name=sinkx");
 
-  status = ml_pipeline_src_get_handle (handle, "srcx", &srchandle);
+  count_sink = (guint *)g_malloc (sizeof (guint));
+  ASSERT_TRUE (count_sink != NULL);
+  *count_sink = 0;
+
+  status = ml_pipeline_construct (pipeline, NULL, NULL, &handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  /* invalid param */
-  status = ml_pipeline_src_set_event_cb (srchandle, NULL, NULL);
+  /* invalid param : name */
+  status = ml_pipeline_sink_register (
+      handle, NULL, test_sink_callback_count, count_sink, &sinkhandle);
   EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
 
-  status = ml_pipeline_destroy (handle);
-  EXPECT_EQ (status, ML_ERROR_NONE);
+  g_free (pipeline);
+  g_free (count_sink);
 }
 
 /**
- * @brief Test NNStreamer pipeline switch
+ * @brief Test NNStreamer pipeline sink
+ * @detail Failure case to register callback with invalid param.
  */
-TEST (nnstreamer_capi_switch, dummy_01)
+TEST (nnstreamer_capi_sink, failure_03_n)
 {
   ml_pipeline_h handle;
-  ml_pipeline_switch_h switchhandle;
   ml_pipeline_sink_h sinkhandle;
-  ml_pipeline_switch_e type;
-  ml_pipeline_state_e state;
   gchar *pipeline;
   int status;
   guint *count_sink;
-  TestPipeState *pipe_state;
-  gchar **node_list = NULL;
 
-  pipeline = g_strdup (
-      "input-selector name=ins ! tensor_converter ! tensor_sink name=sinkx "
-      "videotestsrc is-live=true ! videoconvert ! ins.sink_0 "
-      "videotestsrc num-buffers=3 is-live=true ! videoconvert ! ins.sink_1");
+  pipeline = g_strdup ("videotestsrc num-buffers=3 ! videoconvert ! valve name=valvex ! tensor_converter ! tensor_sink name=sinkx");
 
   count_sink = (guint *)g_malloc (sizeof (guint));
   ASSERT_TRUE (count_sink != NULL);
   *count_sink = 0;
 
-  pipe_state = (TestPipeState *)g_new0 (TestPipeState, 1);
-  ASSERT_TRUE (pipe_state != NULL);
-
-  status = ml_pipeline_construct (pipeline, test_pipe_state_callback, pipe_state, &handle);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-
-  status = ml_pipeline_switch_get_handle (handle, "ins", &type, &switchhandle);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (type, ML_PIPELINE_SWITCH_INPUT_SELECTOR);
-
-  status = ml_pipeline_switch_get_pad_list (switchhandle, &node_list);
+  status = ml_pipeline_construct (pipeline, NULL, NULL, &handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  if (node_list) {
-    gchar *name = NULL;
-    guint idx = 0;
-
-    while ((name = node_list[idx]) != NULL) {
-      EXPECT_TRUE (g_str_equal (name, "sink_0") || g_str_equal (name, "sink_1"));
-      idx++;
-      g_free (name);
-    }
-
-    EXPECT_EQ (idx, 2U);
-    g_free (node_list);
-  }
-
+  /* invalid param : wrong name */
   status = ml_pipeline_sink_register (
-      handle, "sinkx", test_sink_callback_count, count_sink, &sinkhandle);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_TRUE (sinkhandle != NULL);
-
-  status = ml_pipeline_switch_select (switchhandle, "sink_1");
-  EXPECT_EQ (status, ML_ERROR_NONE);
-
-  status = ml_pipeline_start (handle);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-
-  g_usleep (50000);
-  status = ml_pipeline_get_state (handle, &state);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-  wait_for_start (handle, state, status);
-  EXPECT_EQ (state, ML_PIPELINE_STATE_PLAYING);
-
-  wait_pipeline_process_buffers (*count_sink, 3);
-  g_usleep (300000); /* To check if more frames are coming in  */
-  EXPECT_EQ (*count_sink, 3U);
-
-  status = ml_pipeline_stop (handle);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-
-  status = ml_pipeline_sink_unregister (sinkhandle);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-
-  status = ml_pipeline_switch_release_handle (switchhandle);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-
-  status = ml_pipeline_destroy (handle);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-
-  EXPECT_TRUE (pipe_state->paused);
-  EXPECT_TRUE (pipe_state->playing);
+      handle, "wrongname", test_sink_callback_count, count_sink, &sinkhandle);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
 
   g_free (pipeline);
   g_free (count_sink);
-  g_free (pipe_state);
 }
 
 /**
- * @brief Test NNStreamer pipeline switch
+ * @brief Test NNStreamer pipeline sink
+ * @detail Failure case to register callback with invalid param.
  */
-TEST (nnstreamer_capi_switch, dummy_02)
+TEST (nnstreamer_capi_sink, failure_04_n)
 {
   ml_pipeline_h handle;
-  ml_pipeline_switch_h switchhandle;
-  ml_pipeline_sink_h sinkhandle0, sinkhandle1;
-  ml_pipeline_switch_e type;
+  ml_pipeline_sink_h sinkhandle;
   gchar *pipeline;
   int status;
-  guint *count_sink0, *count_sink1;
-  gchar **node_list = NULL;
-
-  /**
-   * Prerolling problem
-   * For running the test, set async=false in the sink element
-   * when using an output selector.
-   * The pipeline state can be changed to paused
-   * after all sink element receive buffer.
-   */
-  pipeline = g_strdup ("videotestsrc is-live=true ! videoconvert ! tensor_converter ! output-selector name=outs "
-                       "outs.src_0 ! tensor_sink name=sink0 async=false "
-                       "outs.src_1 ! tensor_sink name=sink1 async=false");
+  guint *count_sink;
 
-  count_sink0 = (guint *)g_malloc (sizeof (guint));
-  ASSERT_TRUE (count_sink0 != NULL);
-  *count_sink0 = 0;
+  pipeline = g_strdup ("videotestsrc num-buffers=3 ! videoconvert ! valve name=valvex ! tensor_converter ! tensor_sink name=sinkx");
 
-  count_sink1 = (guint *)g_malloc (sizeof (guint));
-  ASSERT_TRUE (count_sink1 != NULL);
-  *count_sink1 = 0;
+  count_sink = (guint *)g_malloc (sizeof (guint));
+  ASSERT_TRUE (count_sink != NULL);
+  *count_sink = 0;
 
   status = ml_pipeline_construct (pipeline, NULL, NULL, &handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_pipeline_switch_get_handle (handle, "outs", &type, &switchhandle);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (type, ML_PIPELINE_SWITCH_OUTPUT_SELECTOR);
-
-  status = ml_pipeline_switch_get_pad_list (switchhandle, &node_list);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-
-  if (node_list) {
-    gchar *name = NULL;
-    guint idx = 0;
-
-    while ((name = node_list[idx]) != NULL) {
-      EXPECT_TRUE (g_str_equal (name, "src_0") || g_str_equal (name, "src_1"));
-      idx++;
-      g_free (name);
-    }
-
-    EXPECT_EQ (idx, 2U);
-    g_free (node_list);
-  }
-
-  status = ml_pipeline_sink_register (
-      handle, "sink0", test_sink_callback_count, count_sink0, &sinkhandle0);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_TRUE (sinkhandle0 != NULL);
-
+  /* invalid param : invalid type */
   status = ml_pipeline_sink_register (
-      handle, "sink1", test_sink_callback_count, count_sink1, &sinkhandle1);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_TRUE (sinkhandle1 != NULL);
-
-  status = ml_pipeline_switch_select (switchhandle, "src_1");
-  EXPECT_EQ (status, ML_ERROR_NONE);
-
-  status = ml_pipeline_start (handle);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-
-  g_usleep (200000); /* 200ms. Let a few frames flow. */
-
-  status = ml_pipeline_stop (handle);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-
-  status = ml_pipeline_sink_unregister (sinkhandle0);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-
-  status = ml_pipeline_sink_unregister (sinkhandle1);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-
-  status = ml_pipeline_switch_release_handle (switchhandle);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-
-  status = ml_pipeline_destroy (handle);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-
-  EXPECT_EQ (*count_sink0, 0U);
-  EXPECT_TRUE (*count_sink1 > 0U);
+      handle, "valvex", test_sink_callback_count, count_sink, &sinkhandle);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
 
   g_free (pipeline);
-  g_free (count_sink0);
-  g_free (count_sink1);
-}
-
-/**
- * @brief Test NNStreamer pipeline switch
- * @detail Failure case to handle input-selector element with invalid param.
- */
-TEST (nnstreamer_capi_switch, failure_01_n)
-{
-  ml_pipeline_switch_h switchhandle;
-  ml_pipeline_switch_e type;
-  int status;
-
-  /* invalid param : pipe */
-  status = ml_pipeline_switch_get_handle (NULL, "ins", &type, &switchhandle);
-  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+  g_free (count_sink);
 }
 
 /**
- * @brief Test NNStreamer pipeline switch
- * @detail Failure case to handle input-selector element with invalid param.
+ * @brief Test NNStreamer pipeline sink
+ * @detail Failure case to register callback with invalid param.
  */
-TEST (nnstreamer_capi_switch, failure_02_n)
+TEST (nnstreamer_capi_sink, failure_05_n)
 {
   ml_pipeline_h handle;
-  ml_pipeline_switch_h switchhandle;
-  ml_pipeline_switch_e type;
+  ml_pipeline_sink_h sinkhandle;
   gchar *pipeline;
   int status;
+  guint *count_sink;
 
-  pipeline = g_strdup ("input-selector name=ins ! tensor_converter ! tensor_sink name=sinkx "
-                       "videotestsrc is-live=true ! videoconvert ! ins.sink_0 "
-                       "videotestsrc num-buffers=3 ! videoconvert ! ins.sink_1");
+  pipeline = g_strdup ("videotestsrc num-buffers=3 ! videoconvert ! valve name=valvex ! tensor_converter ! tensor_sink name=sinkx");
+
+  count_sink = (guint *)g_malloc (sizeof (guint));
+  ASSERT_TRUE (count_sink != NULL);
+  *count_sink = 0;
 
   status = ml_pipeline_construct (pipeline, NULL, NULL, &handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  /* invalid param : name */
-  status = ml_pipeline_switch_get_handle (handle, NULL, &type, &switchhandle);
+  /* invalid param : callback */
+  status = ml_pipeline_sink_register (handle, "sinkx", NULL, count_sink, &sinkhandle);
   EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
 
-  status = ml_pipeline_destroy (handle);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-
   g_free (pipeline);
+  g_free (count_sink);
 }
 
 /**
- * @brief Test NNStreamer pipeline switch
- * @detail Failure case to handle input-selector element with invalid param.
+ * @brief Test NNStreamer pipeline sink
+ * @detail Failure case to register callback with invalid param.
  */
-TEST (nnstreamer_capi_switch, failure_03_n)
+TEST (nnstreamer_capi_sink, failure_06_n)
 {
   ml_pipeline_h handle;
-  ml_pipeline_switch_h switchhandle;
-  ml_pipeline_switch_e type;
   gchar *pipeline;
   int status;
+  guint *count_sink;
 
-  pipeline = g_strdup ("input-selector name=ins ! tensor_converter ! tensor_sink name=sinkx "
-                       "videotestsrc is-live=true ! videoconvert ! ins.sink_0 "
-                       "videotestsrc num-buffers=3 ! videoconvert ! ins.sink_1");
+  pipeline = g_strdup ("videotestsrc num-buffers=3 ! videoconvert ! valve name=valvex ! tensor_converter ! tensor_sink name=sinkx");
+
+  count_sink = (guint *)g_malloc (sizeof (guint));
+  ASSERT_TRUE (count_sink != NULL);
+  *count_sink = 0;
 
   status = ml_pipeline_construct (pipeline, NULL, NULL, &handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  /* invalid param : wrong name */
-  status = ml_pipeline_switch_get_handle (handle, "wrongname", &type, &switchhandle);
+  /* invalid param : handle */
+  status = ml_pipeline_sink_register (
+      handle, "sinkx", test_sink_callback_count, count_sink, NULL);
   EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
 
-  status = ml_pipeline_destroy (handle);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-
   g_free (pipeline);
+  g_free (count_sink);
 }
 
 /**
- * @brief Test NNStreamer pipeline switch
- * @detail Failure case to handle input-selector element with invalid param.
+ * @brief Test NNStreamer pipeline src
  */
-TEST (nnstreamer_capi_switch, failure_04_n)
+TEST (nnstreamer_capi_src, dummy_01)
 {
+  const gchar *_tmpdir = g_get_tmp_dir ();
+  const gchar *_dirname = "nns-tizen-XXXXXX";
+  gchar *fullpath = g_build_path ("/", _tmpdir, _dirname, NULL);
+  gchar *dir = g_mkdtemp ((gchar *)fullpath);
+  gchar *file1 = g_build_path ("/", dir, "output", NULL);
+  gchar *pipeline = g_strdup_printf (
+      "appsrc name=srcx ! other/tensor,dimension=(string)4:1:1:1,type=(string)uint8,framerate=(fraction)0/1 ! filesink location=\"%s\" buffer-mode=unbuffered",
+      file1);
   ml_pipeline_h handle;
-  ml_pipeline_switch_h switchhandle;
-  ml_pipeline_switch_e type;
-  gchar *pipeline;
+  ml_pipeline_state_e state;
+  ml_pipeline_src_h srchandle;
   int status;
+  ml_tensors_info_h info;
+  ml_tensors_data_h data1, data2;
+  unsigned int count = 0;
+  ml_tensor_type_e type = ML_TENSOR_TYPE_UNKNOWN;
+  ml_tensor_dimension dim = {
+    0,
+  };
 
-  pipeline = g_strdup ("input-selector name=ins ! tensor_converter ! tensor_sink name=sinkx "
-                       "videotestsrc is-live=true ! videoconvert ! ins.sink_0 "
-                       "videotestsrc num-buffers=3 ! videoconvert ! ins.sink_1");
+  int i;
+  uint8_t *uintarray1[10];
+  uint8_t *uintarray2[10];
+  uint8_t *content = NULL;
+  gsize len;
 
   status = ml_pipeline_construct (pipeline, NULL, NULL, &handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_TRUE (dir != NULL);
+  for (i = 0; i < 10; i++) {
+    uintarray1[i] = (uint8_t *)g_malloc (4);
+    ASSERT_TRUE (uintarray1[i] != NULL);
+    uintarray1[i][0] = i + 4;
+    uintarray1[i][1] = i + 1;
+    uintarray1[i][2] = i + 3;
+    uintarray1[i][3] = i + 2;
 
-  /* invalid param : invalid type */
-  status = ml_pipeline_switch_get_handle (handle, "sinkx", &type, &switchhandle);
-  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+    uintarray2[i] = (uint8_t *)g_malloc (4);
+    ASSERT_TRUE (uintarray2[i] != NULL);
+    uintarray2[i][0] = i + 3;
+    uintarray2[i][1] = i + 2;
+    uintarray2[i][2] = i + 1;
+    uintarray2[i][3] = i + 4;
+    /* These will be free'ed by gstreamer (ML_PIPELINE_BUF_POLICY_AUTO_FREE) */
+    /** @todo Check whether gstreamer really deallocates this */
+  }
 
-  status = ml_pipeline_destroy (handle);
+  status = ml_pipeline_start (handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
+  g_usleep (10000); /* 10ms. Wait a bit. */
+  status = ml_pipeline_get_state (handle, &state);
+  EXPECT_EQ (status,
+      ML_ERROR_NONE); /* At this moment, it can be READY, PAUSED, or PLAYING */
+  EXPECT_NE (state, ML_PIPELINE_STATE_UNKNOWN);
+  EXPECT_NE (state, ML_PIPELINE_STATE_NULL);
 
-  g_free (pipeline);
-}
+  status = ml_pipeline_src_get_handle (handle, "srcx", &srchandle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-/**
- * @brief Test NNStreamer pipeline switch
- * @detail Failure case to handle input-selector element with invalid param.
- */
-TEST (nnstreamer_capi_switch, failure_05_n)
-{
-  ml_pipeline_h handle;
-  ml_pipeline_switch_e type;
-  gchar *pipeline;
-  int status;
+  status = ml_pipeline_src_get_tensors_info (srchandle, &info);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-  pipeline = g_strdup ("input-selector name=ins ! tensor_converter ! tensor_sink name=sinkx "
-                       "videotestsrc is-live=true ! videoconvert ! ins.sink_0 "
-                       "videotestsrc num-buffers=3 ! videoconvert ! ins.sink_1");
+  ml_tensors_info_get_count (info, &count);
+  EXPECT_EQ (count, 1U);
 
-  status = ml_pipeline_construct (pipeline, NULL, NULL, &handle);
-  EXPECT_EQ (status, ML_ERROR_NONE);
+  ml_tensors_info_get_tensor_type (info, 0, &type);
+  EXPECT_EQ (type, ML_TENSOR_TYPE_UINT8);
 
-  /* invalid param : handle */
-  status = ml_pipeline_switch_get_handle (handle, "ins", &type, NULL);
-  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+  ml_tensors_info_get_tensor_dimension (info, 0, dim);
+  EXPECT_EQ (dim[0], 4U);
+  EXPECT_EQ (dim[1], 1U);
+  EXPECT_EQ (dim[2], 1U);
+  EXPECT_EQ (dim[3], 1U);
 
-  status = ml_pipeline_destroy (handle);
+  status = ml_tensors_data_create (info, &data1);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  g_free (pipeline);
-}
-
-/**
- * @brief Test NNStreamer pipeline switch
- * @detail Failure case to handle input-selector element with invalid param.
- */
-TEST (nnstreamer_capi_switch, failure_06_n)
-{
-  ml_pipeline_h handle;
-  ml_pipeline_switch_h switchhandle;
-  gchar *pipeline;
-  int status;
+  ml_tensors_info_destroy (info);
 
-  pipeline = g_strdup ("input-selector name=ins ! tensor_converter ! tensor_sink name=sinkx "
-                       "videotestsrc is-live=true ! videoconvert ! ins.sink_0 "
-                       "videotestsrc num-buffers=3 ! videoconvert ! ins.sink_1");
+  status = ml_tensors_data_set_tensor_data (data1, 0, uintarray1[0], 4);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_pipeline_construct (pipeline, NULL, NULL, &handle);
+  status = ml_pipeline_src_input_data (srchandle, data1, ML_PIPELINE_BUF_POLICY_DO_NOT_FREE);
   EXPECT_EQ (status, ML_ERROR_NONE);
+  g_usleep (50000); /* 50ms. Wait a bit. */
 
-  /* succesfully get switch handle if the param type is null */
-  status = ml_pipeline_switch_get_handle (handle, "ins", NULL, &switchhandle);
+  status = ml_pipeline_src_input_data (srchandle, data1, ML_PIPELINE_BUF_POLICY_DO_NOT_FREE);
   EXPECT_EQ (status, ML_ERROR_NONE);
+  g_usleep (50000); /* 50ms. Wait a bit. */
 
-  /* invalid param : handle */
-  status = ml_pipeline_switch_select (NULL, "invalidpadname");
-  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+  status = ml_pipeline_src_release_handle (srchandle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_pipeline_switch_release_handle (switchhandle);
+  status = ml_pipeline_src_get_handle (handle, "srcx", &srchandle);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_pipeline_destroy (handle);
+  status = ml_pipeline_src_get_tensors_info (srchandle, &info);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  g_free (pipeline);
-}
+  ml_tensors_info_get_count (info, &count);
+  EXPECT_EQ (count, 1U);
 
-/**
- * @brief Test NNStreamer pipeline switch
- * @detail Failure case to handle input-selector element with invalid param.
- */
-TEST (nnstreamer_capi_switch, failure_07_n)
-{
-  ml_pipeline_h handle;
-  ml_pipeline_switch_h switchhandle;
-  gchar *pipeline;
-  int status;
+  ml_tensors_info_get_tensor_type (info, 0, &type);
+  EXPECT_EQ (type, ML_TENSOR_TYPE_UINT8);
 
-  pipeline = g_strdup ("input-selector name=ins ! tensor_converter ! tensor_sink name=sinkx "
-                       "videotestsrc is-live=true ! videoconvert ! ins.sink_0 "
-                       "videotestsrc num-buffers=3 ! videoconvert ! ins.sink_1");
+  ml_tensors_info_get_tensor_dimension (info, 0, dim);
+  EXPECT_EQ (dim[0], 4U);
+  EXPECT_EQ (dim[1], 1U);
+  EXPECT_EQ (dim[2], 1U);
+  EXPECT_EQ (dim[3], 1U);
 
-  status = ml_pipeline_construct (pipeline, NULL, NULL, &handle);
-  EXPECT_EQ (status, ML_ERROR_NONE);
+  for (i = 0; i < 10; i++) {
+    status = ml_tensors_data_set_tensor_data (data1, 0, uintarray1[i], 4);
+    EXPECT_EQ (status, ML_ERROR_NONE);
 
-  /* succesfully get switch handle if the param type is null */
-  status = ml_pipeline_switch_get_handle (handle, "ins", NULL, &switchhandle);
-  EXPECT_EQ (status, ML_ERROR_NONE);
+    status = ml_pipeline_src_input_data (srchandle, data1, ML_PIPELINE_BUF_POLICY_DO_NOT_FREE);
+    EXPECT_EQ (status, ML_ERROR_NONE);
 
-  /* invalid param : pad name */
-  status = ml_pipeline_switch_select (switchhandle, NULL);
-  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+    status = ml_tensors_data_create (info, &data2);
+    EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_pipeline_switch_release_handle (switchhandle);
+    status = ml_tensors_data_set_tensor_data (data2, 0, uintarray2[i], 4);
+    EXPECT_EQ (status, ML_ERROR_NONE);
+
+    status = ml_pipeline_src_input_data (srchandle, data2, ML_PIPELINE_BUF_POLICY_AUTO_FREE);
+    EXPECT_EQ (status, ML_ERROR_NONE);
+
+    g_usleep (50000); /* 50ms. Wait a bit. */
+  }
+
+  status = ml_pipeline_src_release_handle (srchandle);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
+  g_usleep (50000); /* Wait for the pipeline to flush all */
+
   status = ml_pipeline_destroy (handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
   g_free (pipeline);
+
+  EXPECT_TRUE (g_file_get_contents (file1, (gchar **)&content, &len, NULL));
+  EXPECT_EQ (len, 8U * 11);
+  EXPECT_TRUE (content != nullptr);
+
+  if (content && len == 88U) {
+    for (i = 0; i < 10; i++) {
+      EXPECT_EQ (content[i * 8 + 0 + 8], i + 4);
+      EXPECT_EQ (content[i * 8 + 1 + 8], i + 1);
+      EXPECT_EQ (content[i * 8 + 2 + 8], i + 3);
+      EXPECT_EQ (content[i * 8 + 3 + 8], i + 2);
+      EXPECT_EQ (content[i * 8 + 4 + 8], i + 3);
+      EXPECT_EQ (content[i * 8 + 5 + 8], i + 2);
+      EXPECT_EQ (content[i * 8 + 6 + 8], i + 1);
+      EXPECT_EQ (content[i * 8 + 7 + 8], i + 4);
+    }
+  }
+
+  g_free (content);
+  ml_tensors_info_destroy (info);
+  ml_tensors_data_destroy (data1);
+
+  for (i = 0; i < 10; i++) {
+    g_free (uintarray1[i]);
+    g_free (uintarray2[i]);
+  }
+
+  g_free (fullpath);
+  g_free (file1);
 }
 
 /**
- * @brief Test NNStreamer pipeline switch
- * @detail Failure case to handle input-selector element with invalid param.
+ * @brief Test NNStreamer pipeline src
+ * @detail Failure case when pipeline is NULL.
  */
-TEST (nnstreamer_capi_switch, failure_08_n)
+TEST (nnstreamer_capi_src, failure_01_n)
 {
-  ml_pipeline_h handle;
-  ml_pipeline_switch_h switchhandle;
-  gchar *pipeline;
   int status;
+  ml_pipeline_src_h srchandle;
 
-  pipeline = g_strdup ("input-selector name=ins ! tensor_converter ! tensor_sink name=sinkx "
-                       "videotestsrc is-live=true ! videoconvert ! ins.sink_0 "
-                       "videotestsrc num-buffers=3 ! videoconvert ! ins.sink_1");
+  status = ml_pipeline_src_get_handle (NULL, "dummy", &srchandle);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+}
 
-  status = ml_pipeline_construct (pipeline, NULL, NULL, &handle);
-  EXPECT_EQ (status, ML_ERROR_NONE);
+/**
+ * @brief Test NNStreamer pipeline src
+ * @detail Failure case when the name of source node is wrong.
+ */
+TEST (nnstreamer_capi_src, failure_02_n)
+{
+  const char *pipeline = "appsrc name=mysource ! other/tensor,dimension=(string)4:1:1:1,type=(string)uint8,framerate=(fraction)0/1 ! valve name=valvex ! tensor_sink";
+  ml_pipeline_h handle;
+  ml_pipeline_src_h srchandle;
 
-  /* succesfully get switch handle if the param type is null */
-  status = ml_pipeline_switch_get_handle (handle, "ins", NULL, &switchhandle);
+  int status = ml_pipeline_construct (pipeline, NULL, NULL, &handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  /* invalid param : wrong pad name */
-  status = ml_pipeline_switch_select (switchhandle, "wrongpadname");
+  /* invalid param : name */
+  status = ml_pipeline_src_get_handle (handle, NULL, &srchandle);
   EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
 
-  status = ml_pipeline_switch_release_handle (switchhandle);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-
   status = ml_pipeline_destroy (handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
-
-  g_free (pipeline);
 }
 
 /**
- * @brief Test NNStreamer Utility for checking plugin availability (invalid param)
+ * @brief Test NNStreamer pipeline src
+ * @detail Failure case when the name of source node is wrong.
  */
-TEST (nnstreamer_capi_util, plugin_availability_fail_invalid_01_n)
+TEST (nnstreamer_capi_src, failure_03_n)
 {
-  int status;
+  const char *pipeline = "appsrc name=mysource ! other/tensor,dimension=(string)4:1:1:1,type=(string)uint8,framerate=(fraction)0/1 ! valve name=valvex ! tensor_sink";
+  ml_pipeline_h handle;
+  ml_pipeline_src_h srchandle;
 
-  status = _ml_check_plugin_availability (NULL, "tensor_filter");
-  EXPECT_NE (status, ML_ERROR_NONE);
+  int status = ml_pipeline_construct (pipeline, NULL, NULL, &handle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  /* invalid param : wrong name */
+  status = ml_pipeline_src_get_handle (handle, "wrongname", &srchandle);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  status = ml_pipeline_destroy (handle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 }
 
 /**
- * @brief Test NNStreamer Utility for checking plugin availability (invalid param)
+ * @brief Test NNStreamer pipeline src
+ * @detail Failure case when the name of source node is wrong.
  */
-TEST (nnstreamer_capi_util, plugin_availability_fail_invalid_02_n)
+TEST (nnstreamer_capi_src, failure_04_n)
 {
-  int status;
+  const char *pipeline = "appsrc name=mysource ! other/tensor,dimension=(string)4:1:1:1,type=(string)uint8,framerate=(fraction)0/1 ! valve name=valvex ! tensor_sink";
+  ml_pipeline_h handle;
+  ml_pipeline_src_h srchandle;
 
-  status = _ml_check_plugin_availability (NULL, "tensor_filter");
-  EXPECT_NE (status, ML_ERROR_NONE);
+  int status = ml_pipeline_construct (pipeline, NULL, NULL, &handle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  /* invalid param : invalid type */
+  status = ml_pipeline_src_get_handle (handle, "valvex", &srchandle);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  status = ml_pipeline_destroy (handle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 }
 
 /**
- * @brief Test NNStreamer Utility for checking nnfw availability with custom option
+ * @brief Test NNStreamer pipeline src
+ * @detail Failure case when the name of source node is wrong.
  */
-TEST (nnstreamer_capi_util, nnfw_availability_full_01)
+TEST (nnstreamer_capi_src, failure_05_n)
 {
-  int status;
-  bool result;
+  const char *pipeline = "appsrc name=mysource ! other/tensor,dimension=(string)4:1:1:1,type=(string)uint8,framerate=(fraction)0/1 ! valve name=valvex ! tensor_sink";
+  ml_pipeline_h handle;
 
-  status = ml_check_nnfw_availability_full (ML_NNFW_TYPE_TENSORFLOW_LITE, ML_NNFW_HW_ANY, NULL, &result);
+  int status = ml_pipeline_construct (pipeline, NULL, NULL, &handle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  /* invalid param : handle */
+  status = ml_pipeline_src_get_handle (handle, "mysource", NULL);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  status = ml_pipeline_destroy (handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (result, is_enabled_tensorflow_lite);
 }
 
 /**
- * @brief Test NNStreamer Utility for checking nnfw availability with custom option (invalid param)
+ * @brief Test NNStreamer pipeline src
+ * @detail Failure case when the number of tensors is 0 or bigger than ML_TENSOR_SIZE_LIMIT;
  */
-TEST (nnstreamer_capi_util, nnfw_availability_full_02_n)
+TEST (nnstreamer_capi_src, failure_06_n)
 {
-  int status;
+  const char *pipeline = "appsrc name=srcx ! other/tensor,dimension=(string)4:1:1:1,type=(string)uint8,framerate=(fraction)0/1 ! tensor_sink";
+  ml_pipeline_h handle;
+  ml_pipeline_src_h srchandle;
+  ml_tensors_data_h data;
+  ml_tensors_info_h info;
 
-  status = ml_check_nnfw_availability_full (ML_NNFW_TYPE_TENSORFLOW_LITE, ML_NNFW_HW_ANY, NULL, NULL);
-  EXPECT_NE (status, ML_ERROR_NONE);
+  int status = ml_pipeline_construct (pipeline, NULL, NULL, &handle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_pipeline_start (handle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_pipeline_src_get_handle (handle, "srcx", &srchandle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_pipeline_src_get_tensors_info (srchandle, &info);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_tensors_data_create (info, &data);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  /* null data */
+  status = ml_pipeline_src_input_data (srchandle, NULL, ML_PIPELINE_BUF_POLICY_DO_NOT_FREE);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  status = ml_pipeline_src_release_handle (srchandle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_pipeline_stop (handle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_pipeline_destroy (handle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_tensors_data_destroy (data);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_tensors_info_destroy (info);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 }
 
 /**
- * @brief Test NNStreamer Utility for checking nnfw availability (invalid param)
+ * @brief Internal function to push dummy into appsrc.
  */
-TEST (nnstreamer_capi_util, nnfw_availability_fail_invalid_01_n)
+static void
+test_src_cb_push_dummy (ml_pipeline_src_h src_handle)
 {
-  int status;
+  ml_tensors_data_h data;
+  ml_tensors_info_h info;
 
-  status = ml_check_nnfw_availability (ML_NNFW_TYPE_TENSORFLOW_LITE, ML_NNFW_HW_ANY, NULL);
-  EXPECT_NE (status, ML_ERROR_NONE);
+  if (ml_pipeline_src_get_tensors_info (src_handle, &info) == ML_ERROR_NONE) {
+    ml_tensors_data_create (info, &data);
+    ml_pipeline_src_input_data (src_handle, data, ML_PIPELINE_BUF_POLICY_AUTO_FREE);
+    ml_tensors_info_destroy (info);
+  }
 }
 
 /**
- * @brief Test NNStreamer Utility for checking nnfw availability (invalid param)
+ * @brief appsrc callback - need_data.
  */
-TEST (nnstreamer_capi_util, nnfw_availability_fail_invalid_02_n)
+static void
+test_src_cb_need_data (ml_pipeline_src_h src_handle, unsigned int length,
+    void *user_data)
 {
-  bool result;
-  int status;
-
-  /* any is unknown nnfw type */
-  status = ml_check_nnfw_availability (ML_NNFW_TYPE_ANY, ML_NNFW_HW_ANY, &result);
-  EXPECT_NE (status, ML_ERROR_NONE);
+  /* For test, push dummy if given src handles are same. */
+  if (src_handle == user_data)
+    test_src_cb_push_dummy (src_handle);
 }
 
 /**
- * @brief Test NNStreamer Utility for checking availability of Tensorflow-lite backend
+ * @brief Test NNStreamer pipeline src callback.
  */
-TEST (nnstreamer_capi_util, availability_01)
+TEST (nnstreamer_capi_src, callback_replace)
 {
-  bool result;
+  const char pipeline[] = "appsrc name=srcx ! other/tensor,dimension=(string)4:1:1:1,type=(string)uint8,framerate=(fraction)0/1 ! tensor_sink name=sinkx";
+  ml_pipeline_h handle;
+  ml_pipeline_src_h srchandle1, srchandle2;
+  ml_pipeline_sink_h sinkhandle;
+  ml_pipeline_src_callbacks_s callback = { 0, };
+  guint *count_sink;
   int status;
 
-  status = ml_check_nnfw_availability (ML_NNFW_TYPE_TENSORFLOW_LITE,
-      ML_NNFW_HW_ANY, &result);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (result, is_enabled_tensorflow_lite);
+  callback.need_data = test_src_cb_need_data;
 
-  status = ml_check_nnfw_availability (ML_NNFW_TYPE_TENSORFLOW_LITE,
-      ML_NNFW_HW_AUTO, &result);
+  count_sink = (guint *) g_malloc0 (sizeof (guint));
+  ASSERT_TRUE (count_sink != NULL);
+
+  status = ml_pipeline_construct (pipeline, NULL, NULL, &handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (result, is_enabled_tensorflow_lite);
 
-  status = ml_check_nnfw_availability (ML_NNFW_TYPE_TENSORFLOW_LITE,
-      ML_NNFW_HW_CPU, &result);
+  status = ml_pipeline_src_get_handle (handle, "srcx", &srchandle1);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (result, is_enabled_tensorflow_lite);
 
-  status = ml_check_nnfw_availability (ML_NNFW_TYPE_TENSORFLOW_LITE,
-      ML_NNFW_HW_CPU_NEON, &result);
+  status = ml_pipeline_src_set_event_cb (srchandle1, &callback, srchandle1);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (result, is_enabled_tensorflow_lite);
 
-  status = ml_check_nnfw_availability (ML_NNFW_TYPE_TENSORFLOW_LITE,
-      ML_NNFW_HW_CPU_SIMD, &result);
+  status = ml_pipeline_sink_register (
+    handle, "sinkx", test_sink_callback_count, count_sink, &sinkhandle);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (result, is_enabled_tensorflow_lite);
 
-  status = ml_check_nnfw_availability (ML_NNFW_TYPE_TENSORFLOW_LITE,
-      ML_NNFW_HW_GPU, &result);
+  status = ml_pipeline_start (handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (result, is_enabled_tensorflow_lite);
 
-  status = ml_check_nnfw_availability (ML_NNFW_TYPE_TENSORFLOW_LITE,
-      ML_NNFW_HW_NPU, &result);
+  test_src_cb_push_dummy (srchandle1);
+  g_usleep (100000);
+
+  status = ml_pipeline_stop (handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (result, is_enabled_tensorflow_lite);
-}
 
-/**
- * @brief Test NNStreamer Utility for checking availability of Tensorflow-lite backend
- */
-TEST (nnstreamer_capi_util, availability_fail_01_n)
-{
-  bool result;
-  int status;
+  EXPECT_TRUE (*count_sink > 1U);
 
-  status = ml_check_nnfw_availability (ML_NNFW_TYPE_TENSORFLOW_LITE,
-      ML_NNFW_HW_NPU_MOVIDIUS, &result);
+  /* Set new callback with new handle. */
+  status = ml_pipeline_src_get_handle (handle, "srcx", &srchandle2);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (result, false);
 
-  status = ml_check_nnfw_availability (ML_NNFW_TYPE_TENSORFLOW_LITE,
-      ML_NNFW_HW_NPU_EDGE_TPU, &result);
+  /* New callback will not push dummy. */
+  status = ml_pipeline_src_set_event_cb (srchandle2, &callback, srchandle1);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (result, false);
 
-  status = ml_check_nnfw_availability (ML_NNFW_TYPE_TENSORFLOW_LITE,
-      ML_NNFW_HW_NPU_VIVANTE, &result);
+  status = ml_pipeline_start (handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (result, false);
 
-  status = ml_check_nnfw_availability (ML_NNFW_TYPE_TENSORFLOW_LITE,
-      ML_NNFW_HW_NPU_SR, &result);
+  g_usleep (100000);
+  *count_sink = 0;
+  test_src_cb_push_dummy (srchandle2);
+  g_usleep (100000);
+
+  status = ml_pipeline_destroy (handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (result, false);
+
+  EXPECT_TRUE (*count_sink == 1U);
+  g_free (count_sink);
 }
 
-#ifdef ENABLE_TENSORFLOW
 /**
- * @brief Test NNStreamer Utility for checking availability of Tensorflow backend
+ * @brief Test NNStreamer pipeline src callback.
  */
-TEST (nnstreamer_capi_util, availability_02)
+TEST (nnstreamer_capi_src, callback_invalid_param_01_n)
 {
-  bool result;
+  const char pipeline[] = "appsrc name=srcx ! other/tensor,dimension=(string)4:1:1:1,type=(string)uint8,framerate=(fraction)0/1 ! tensor_sink";
+  ml_pipeline_h handle;
+  ml_pipeline_src_h srchandle;
+  ml_pipeline_src_callbacks_s callback = { 0, };
   int status;
 
-  status = ml_check_nnfw_availability (ML_NNFW_TYPE_TENSORFLOW,
-      ML_NNFW_HW_ANY, &result);
+  callback.need_data = test_src_cb_need_data;
+
+  status = ml_pipeline_construct (pipeline, NULL, NULL, &handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (result, true);
 
-  status = ml_check_nnfw_availability (ML_NNFW_TYPE_TENSORFLOW,
-      ML_NNFW_HW_AUTO, &result);
+  status = ml_pipeline_src_get_handle (handle, "srcx", &srchandle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  /* invalid param */
+  status = ml_pipeline_src_set_event_cb (NULL, &callback, NULL);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  status = ml_pipeline_destroy (handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (result, true);
 }
 
 /**
- * @brief Test NNStreamer Utility for checking availability of Tensorflow backend
+ * @brief Test NNStreamer pipeline src callback.
  */
-TEST (nnstreamer_capi_util, availability_fail_02_n)
+TEST (nnstreamer_capi_src, callback_invalid_param_02_n)
 {
-  bool result;
+  const char pipeline[] = "appsrc name=srcx ! other/tensor,dimension=(string)4:1:1:1,type=(string)uint8,framerate=(fraction)0/1 ! tensor_sink";
+  ml_pipeline_h handle;
+  ml_pipeline_src_h srchandle;
   int status;
 
-  status = ml_check_nnfw_availability (ML_NNFW_TYPE_TENSORFLOW,
-      ML_NNFW_HW_NPU_VIVANTE, &result);
+  status = ml_pipeline_construct (pipeline, NULL, NULL, &handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (result, false);
 
-  status = ml_check_nnfw_availability (ML_NNFW_TYPE_TENSORFLOW,
-      ML_NNFW_HW_NPU_MOVIDIUS, &result);
+  status = ml_pipeline_src_get_handle (handle, "srcx", &srchandle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  /* invalid param */
+  status = ml_pipeline_src_set_event_cb (srchandle, NULL, NULL);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  status = ml_pipeline_destroy (handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (result, false);
 }
-#endif /* ENABLE_TENSORFLOW */
 
 /**
- * @brief Test NNStreamer Utility for checking availability of custom backend
+ * @brief appsrc callback - release the pushed data.
  */
-TEST (nnstreamer_capi_util, availability_03)
+static void
+test_src_cb_release (ml_tensors_data_h data, void *user_data)
 {
-  bool result;
-  int status;
-
-  status = ml_check_nnfw_availability (ML_NNFW_TYPE_CUSTOM_FILTER,
-      ML_NNFW_HW_ANY, &result);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (result, true);
+  guint *count = (guint *) user_data;
 
-  status = ml_check_nnfw_availability (ML_NNFW_TYPE_CUSTOM_FILTER,
-      ML_NNFW_HW_AUTO, &result);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (result, true);
+  G_LOCK (callback_lock);
+  *count = *count + 1;
+  G_UNLOCK (callback_lock);
 }
 
 /**
- * @brief Test NNStreamer Utility for checking availability of custom backend
+ * @brief Test NNStreamer pipeline src release callback.
  */
-TEST (nnstreamer_capi_util, availability_fail_03_n)
+TEST (nnstreamer_capi_src, release_cb)
 {
-  bool result;
-  int status;
+  const char pipeline[] = "appsrc name=srcx ! other/tensor,dimension=(string)4:1:1:1,type=(string)uint8,framerate=(fraction)0/1 ! tensor_sink name=sinkx sync=false";
+  ml_pipeline_h handle;
+  ml_pipeline_src_h srchandle;
+  ml_tensors_info_h info;
+  ml_tensors_data_h data;
+  guint *count_release;
+  int i, status;
 
-  status = ml_check_nnfw_availability (ML_NNFW_TYPE_CUSTOM_FILTER,
-      ML_NNFW_HW_CPU, &result);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (result, false);
+  count_release = (guint *) g_malloc0 (sizeof (guint));
+  ASSERT_TRUE (count_release != NULL);
 
-  status = ml_check_nnfw_availability (ML_NNFW_TYPE_CUSTOM_FILTER,
-      ML_NNFW_HW_GPU, &result);
+  status = ml_pipeline_construct (pipeline, NULL, NULL, &handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (result, false);
-}
 
-#ifdef ENABLE_NNFW_RUNTIME
-/**
- * @brief Test NNStreamer Utility for checking availability of NNFW
- */
-TEST (nnstreamer_capi_util, availability_04)
-{
-  bool result;
-  int status;
+  status = ml_pipeline_src_get_handle (handle, "srcx", &srchandle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_check_nnfw_availability (ML_NNFW_TYPE_NNFW, ML_NNFW_HW_ANY, &result);
+  status = ml_pipeline_src_set_release_cb (srchandle, test_src_cb_release, count_release);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (result, true);
 
-  status = ml_check_nnfw_availability (ML_NNFW_TYPE_NNFW, ML_NNFW_HW_AUTO, &result);
+  status = ml_pipeline_start (handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (result, true);
 
-  status = ml_check_nnfw_availability (ML_NNFW_TYPE_NNFW, ML_NNFW_HW_CPU, &result);
+  status = ml_pipeline_src_get_tensors_info (srchandle, &info);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (result, true);
 
-  status = ml_check_nnfw_availability (ML_NNFW_TYPE_NNFW, ML_NNFW_HW_GPU, &result);
+  status = ml_tensors_data_create (info, &data);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (result, true);
 
-  status = ml_check_nnfw_availability (ML_NNFW_TYPE_NNFW, ML_NNFW_HW_NPU, &result);
+  for (i = 0; i < 5; i++) {
+    status = ml_pipeline_src_input_data (srchandle, data, ML_PIPELINE_BUF_POLICY_DO_NOT_FREE);
+    EXPECT_EQ (status, ML_ERROR_NONE);
+    g_usleep (50000);
+  }
+
+  wait_pipeline_process_buffers (*count_release, 5U);
+
+  status = ml_pipeline_destroy (handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (result, true);
+
+  EXPECT_EQ (*count_release, 5U);
+
+  ml_tensors_info_destroy (info);
+  ml_tensors_data_destroy (data);
+  g_free (count_release);
 }
 
 /**
- * @brief Test NNStreamer Utility for checking availability of NNFW
+ * @brief Test NNStreamer pipeline src release callback.
+ * @detail Failure case with invalid param.
  */
-TEST (nnstreamer_capi_util, availability_fail_04_n)
+TEST (nnstreamer_capi_src, release_cb_invalid_param_n)
 {
-  bool result;
   int status;
 
-  status = ml_check_nnfw_availability (ML_NNFW_TYPE_NNFW,
-      ML_NNFW_HW_NPU_SR, &result);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (result, false);
-
-  status = ml_check_nnfw_availability (ML_NNFW_TYPE_NNFW,
-      ML_NNFW_HW_NPU_MOVIDIUS, &result);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (result, false);
+  status = ml_pipeline_src_set_release_cb (NULL, test_src_cb_release, NULL);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
 }
-#endif /* ENABLE_NNFW_RUNTIME */
 
-#ifdef ENABLE_MOVIDIUS_NCSDK2
 /**
- * @brief Test NNStreamer Utility for checking availability of NCSDK2
+ * @brief Test NNStreamer pipeline src with queue limit (blocking push).
  */
-TEST (nnstreamer_capi_util, availability_05)
+TEST (nnstreamer_capi_src, queue_limit)
 {
-  bool result;
-  int status;
+  const char pipeline[] = "appsrc name=srcx ! other/tensor,dimension=(string)4:1:1:1,type=(string)uint8,framerate=(fraction)0/1 ! queue ! tensor_sink name=sinkx sync=false";
+  ml_pipeline_h handle;
+  ml_pipeline_src_h srchandle;
+  ml_pipeline_sink_h sinkhandle;
+  ml_tensors_info_h info;
+  ml_tensors_data_h data;
+  guint *count_sink;
+  int i, status;
 
-  status = ml_check_nnfw_availability (ML_NNFW_TYPE_MVNC,
-      ML_NNFW_HW_ANY, &result);
+  count_sink = (guint *) g_malloc0 (sizeof (guint));
+  ASSERT_TRUE (count_sink != NULL);
+
+  status = ml_pipeline_construct (pipeline, NULL, NULL, &handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (result, true);
 
-  status = ml_check_nnfw_availability (ML_NNFW_TYPE_MVNC,
-      ML_NNFW_HW_AUTO, &result);
+  status = ml_pipeline_sink_register (handle, "sinkx", test_sink_callback_count, count_sink, &sinkhandle);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (result, true);
 
-  status = ml_check_nnfw_availability (ML_NNFW_TYPE_MVNC,
-      ML_NNFW_HW_NPU, &result);
+  status = ml_pipeline_src_get_handle (handle, "srcx", &srchandle);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (result, true);
 
-  status = ml_check_nnfw_availability (ML_NNFW_TYPE_MVNC,
-      ML_NNFW_HW_NPU_MOVIDIUS, &result);
+  /* queue a frame (4 bytes) at most */
+  status = ml_pipeline_src_set_queue_limit (srchandle, 4, 1, 1000);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (result, true);
-}
 
-/**
- * @brief Test NNStreamer Utility for checking availability of NCSDK2
- */
-TEST (nnstreamer_capi_util, availability_fail_05_n)
-{
-  bool result;
-  int status;
+  status = ml_pipeline_start (handle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_check_nnfw_availability (ML_NNFW_TYPE_MVNC,
-      ML_NNFW_HW_CPU, &result);
+  status = ml_pipeline_src_get_tensors_info (srchandle, &info);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (result, false);
 
-  status = ml_check_nnfw_availability (ML_NNFW_TYPE_MVNC,
-      ML_NNFW_HW_GPU, &result);
+  status = ml_tensors_data_create (info, &data);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (result, false);
-}
-#endif /* ENABLE_MOVIDIUS_NCSDK2 */
 
-#ifdef ENABLE_ARMNN
-/**
- * @brief Test NNStreamer Utility for checking availability of ARMNN
- */
-TEST (nnstreamer_capi_util, availability_06)
-{
-  bool result;
-  int status;
+  /* every push should wait for the queue and then succeed */
+  for (i = 0; i < 20; i++) {
+    status = ml_pipeline_src_input_data (srchandle, data, ML_PIPELINE_BUF_POLICY_DO_NOT_FREE);
+    EXPECT_EQ (status, ML_ERROR_NONE);
+  }
 
-  status = ml_check_nnfw_availability (ML_NNFW_TYPE_ARMNN,
-      ML_NNFW_HW_ANY, &result);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (result, true);
+  wait_pipeline_process_buffers (*count_sink, 20U);
 
-  status = ml_check_nnfw_availability (ML_NNFW_TYPE_ARMNN,
-      ML_NNFW_HW_AUTO, &result);
+  /* disable blocking mode */
+  status = ml_pipeline_src_set_queue_limit (srchandle, 0, 0, 0);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (result, true);
 
-  status = ml_check_nnfw_availability (ML_NNFW_TYPE_ARMNN,
-      ML_NNFW_HW_CPU, &result);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (result, true);
+  /* the queue limit of appsrc is restored to the default */
+  {
+    GstElement *appsrc = ((ml_pipeline_common_elem *) srchandle)->element->element;
+    GParamSpec *pspec;
+    guint64 value;
+
+    pspec = g_object_class_find_property (G_OBJECT_GET_CLASS (appsrc), "max-bytes");
+    g_object_get (appsrc, "max-bytes", &value, NULL);
+    EXPECT_EQ (value, G_PARAM_SPEC_UINT64 (pspec)->default_value);
+#if GST_CHECK_VERSION(1, 20, 0)
+    pspec = g_object_class_find_property (G_OBJECT_GET_CLASS (appsrc), "max-buffers");
+    g_object_get (appsrc, "max-buffers", &value, NULL);
+    EXPECT_EQ (value, G_PARAM_SPEC_UINT64 (pspec)->default_value);
+#endif
+  }
 
-  status = ml_check_nnfw_availability (ML_NNFW_TYPE_ARMNN,
-      ML_NNFW_HW_CPU_NEON, &result);
+  status = ml_pipeline_src_input_data (srchandle, data, ML_PIPELINE_BUF_POLICY_DO_NOT_FREE);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (result, true);
 
-  status = ml_check_nnfw_availability (ML_NNFW_TYPE_ARMNN,
-      ML_NNFW_HW_GPU, &result);
+  wait_pipeline_process_buffers (*count_sink, 21U);
+
+  status = ml_pipeline_destroy (handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (result, true);
+
+  EXPECT_EQ (*count_sink, 21U);
+
+  ml_tensors_info_destroy (info);
+  ml_tensors_data_destroy (data);
+  g_free (count_sink);
 }
 
 /**
- * @brief Test NNStreamer Utility for checking availability of ARMNN
+ * @brief Thread to push the data while the queue of src is full.
  */
-TEST (nnstreamer_capi_util, availability_fail_06_n)
+static gpointer
+test_push_full_queue_thread (gpointer user_data)
 {
-  bool result;
+  ml_pipeline_src_h srchandle = (ml_pipeline_src_h) user_data;
+  ml_tensors_info_h info;
+  ml_tensors_data_h data;
+  ml_tensor_dimension dim = { 4, 1, 1, 1 };
   int status;
 
-  status = ml_check_nnfw_availability (ML_NNFW_TYPE_ARMNN,
-      ML_NNFW_HW_NPU, &result);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (result, false);
+  ml_tensors_info_create (&info);
+  ml_tensors_info_set_count (info, 1);
+  ml_tensors_info_set_tensor_type (info, 0, ML_TENSOR_TYPE_UINT8);
+  ml_tensors_info_set_tensor_dimension (info, 0, dim);
+  ml_tensors_data_create (info, &data);
 
-  status = ml_check_nnfw_availability (ML_NNFW_TYPE_ARMNN,
-      ML_NNFW_HW_NPU_EDGE_TPU, &result);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (result, false);
+  status = ml_pipeline_src_input_data (srchandle, data, ML_PIPELINE_BUF_POLICY_DO_NOT_FREE);
+
+  ml_tensors_data_destroy (data);
+  ml_tensors_info_destroy (info);
+
+  return GINT_TO_POINTER (status);
 }
-#endif /** ENABLE_ARMNN */
 
 /**
- * @brief Test NNStreamer Utility for checking an element availability
+ * @brief Test NNStreamer pipeline src with queue limit, the waiting push does not lock the pipeline.
  */
-TEST (nnstreamer_capi_util, element_available_01_p)
+TEST (nnstreamer_capi_src, queue_limit_wait_unlocked)
 {
-  bool available;
+  const char pipeline[] = "appsrc name=srcx ! other/tensor,dimension=(string)4:1:1:1,type=(string)uint8,framerate=(fraction)0/1 ! tensor_sink name=sinkx";
+  ml_pipeline_h handle;
+  ml_pipeline_src_h srchandle;
+  ml_pipeline_element *elem;
+  ml_pipeline_state_e state;
+  GThread *thread;
+  gint64 start;
+  guint waiting = 0;
   int status;
 
-  status = ml_check_element_availability ("tensor_converter", &available);
+  status = ml_pipeline_construct (pipeline, NULL, NULL, &handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (available, true);
 
-  status = ml_check_element_availability ("tensor_filter", &available);
+  status = ml_pipeline_src_get_handle (handle, "srcx", &srchandle);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (available, true);
 
-  status = ml_check_element_availability ("appsrc", &available);
+  status = ml_pipeline_src_set_queue_limit (srchandle, 4, 1, 10000);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (available, true);
+
+  /* the queue is full, the push waits */
+  elem = ((ml_pipeline_common_elem *) srchandle)->element;
+  g_mutex_lock (&elem->lock);
+  elem->src_enough_data = TRUE;
+  g_mutex_unlock (&elem->lock);
+
+  thread = g_thread_new ("test-push-full-queue", test_push_full_queue_thread, srchandle);
+
+  while (waiting == 0) {
+    g_usleep (1000);
+    g_mutex_lock (&elem->lock);
+    waiting = elem->src_users;
+    g_mutex_unlock (&elem->lock);
+  }
+
+  /* other pipeline API is not blocked by the waiting push */
+  start = g_get_monotonic_time ();
+  status = ml_pipeline_get_state (handle, &state);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_LT (g_get_monotonic_time () - start, 1000 * G_TIME_SPAN_MILLISECOND);
+
+  /* destroying the pipeline wakes up the push */
+  status = ml_pipeline_destroy (handle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_LT (g_get_monotonic_time () - start, 5000 * G_TIME_SPAN_MILLISECOND);
+
+  status = GPOINTER_TO_INT (g_thread_join (thread));
+  EXPECT_EQ (status, ML_ERROR_STREAMS_PIPE);
 }
 
 /**
- * @brief Test NNStreamer Utility for checking an element availability (null param)
+ * @brief Test NNStreamer pipeline src with queue limit.
+ * @detail Failure case with invalid param.
  */
-TEST (nnstreamer_capi_util, element_available_02_n)
+TEST (nnstreamer_capi_src, queue_limit_invalid_param_n)
 {
-  bool available;
   int status;
 
-  status = ml_check_element_availability (nullptr, &available);
-  EXPECT_NE (status, ML_ERROR_NONE);
-
-  status = ml_check_element_availability ("tensor_filter", nullptr);
-  EXPECT_NE (status, ML_ERROR_NONE);
+  status = ml_pipeline_src_set_queue_limit (NULL, 4, 1, 1000);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
 }
 
 /**
- * @brief Test NNStreamer Utility for checking an element availability (invalid element name)
+ * @brief Data structure to check the output of each stream in the batch.
  */
-TEST (nnstreamer_capi_util, element_available_03_n)
+typedef struct {
+  guint received[2]; /**< The number of outputs of each stream */
+  guint8 first[2]; /**< The first value of the last output of each stream */
+  guint dim; /**< The batch dimension of the output info */
+} TestBatchResult;
+
+/**
+ * @brief Callback for the output of each stream in the batch.
+ */
+static void
+test_batch_callback (unsigned int stream_id, const ml_tensors_data_h data,
+    const ml_tensors_info_h info, void *user_data)
 {
-  bool available;
+  TestBatchResult *result = (TestBatchResult *) user_data;
+  ml_tensor_dimension dim;
+  void *raw;
+  size_t size;
   int status;
 
-  status = ml_check_element_availability ("invalid-elem", &available);
+  status = ml_tensors_data_get_tensor_data (data, 0, &raw, &size);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (available, false);
+  EXPECT_EQ (size, 4U);
+
+  status = ml_tensors_info_get_tensor_dimension (info, 0, dim);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  result->dim = dim[3];
+  result->first[stream_id] = ((guint8 *) raw)[0];
+  result->received[stream_id]++;
 }
 
 /**
- * @brief Test NNStreamer Utility for checking tensors info handle
+ * @brief Test NNStreamer pipeline to merge the frames of streams.
  */
-TEST (nnstreamer_capi_util, tensors_info)
+TEST (nnstreamer_capi_batch, input_data_01_p)
 {
+  const char pipeline[] = "appsrc name=srcx ! other/tensor,dimension=(string)4:1:1:2,type=(string)uint8,framerate=(fraction)0/1 ! tensor_sink name=sinkx";
+  ml_pipeline_h handle;
+  ml_pipeline_batch_h batch;
   ml_tensors_info_h info;
-  ml_tensor_dimension in_dim, out_dim;
-  ml_tensor_type_e out_type;
-  gchar *out_name;
-  size_t data_size;
+  ml_tensors_data_h data;
+  ml_tensor_dimension dim = { 4, 1, 1, 1 };
+  TestBatchResult *result;
+  guint8 frame[4];
   int status;
 
-  status = ml_tensors_info_create (&info);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-
-  in_dim[0] = 3;
-  in_dim[1] = 300;
-  in_dim[2] = 300;
-  in_dim[3] = 1;
+  result = (TestBatchResult *) g_malloc0 (sizeof (TestBatchResult));
+  ASSERT_TRUE (result != NULL);
 
-  /* add tensor info */
-  status = ml_tensors_info_set_count (info, 2);
+  status = ml_pipeline_construct (pipeline, NULL, NULL, &handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_tensors_info_set_tensor_type (info, 0, ML_TENSOR_TYPE_UINT8);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-  status = ml_tensors_info_set_tensor_dimension (info, 0, in_dim);
+  /* push the frame after 50ms if a stream is missing. */
+  status = ml_pipeline_batch_create (handle, "srcx", "sinkx", 2, 50,
+      test_batch_callback, result, &batch);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_tensors_info_set_tensor_type (info, 1, ML_TENSOR_TYPE_FLOAT64);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-  status = ml_tensors_info_set_tensor_dimension (info, 1, in_dim);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-  status = ml_tensors_info_set_tensor_name (info, 1, "tensor-name-test");
+  status = ml_pipeline_start (handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_tensors_info_set_tensor_type (info, 2, ML_TENSOR_TYPE_UINT64);
-  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
-  status = ml_tensors_info_set_tensor_dimension (info, 2, in_dim);
-  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
-
-  /* get tensor info */
-  status = ml_tensors_info_get_tensor_type (info, 0, &out_type);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (out_type, ML_TENSOR_TYPE_UINT8);
+  ml_tensors_info_create (&info);
+  ml_tensors_info_set_count (info, 1);
+  ml_tensors_info_set_tensor_type (info, 0, ML_TENSOR_TYPE_UINT8);
+  ml_tensors_info_set_tensor_dimension (info, 0, dim);
 
-  status = ml_tensors_info_get_tensor_dimension (info, 0, out_dim);
+  status = ml_tensors_data_create (info, &data);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (out_dim[0], 3U);
-  EXPECT_EQ (out_dim[1], 300U);
-  EXPECT_EQ (out_dim[2], 300U);
-  EXPECT_EQ (out_dim[3], 1U);
 
-  status = ml_tensors_info_get_tensor_name (info, 0, &out_name);
+  /* all streams are filled */
+  memset (frame, 10, sizeof (frame));
+  ml_tensors_data_set_tensor_data (data, 0, frame, sizeof (frame));
+  status = ml_pipeline_batch_input_data (batch, 0, data);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_TRUE (out_name == NULL);
 
-  status = ml_tensors_info_get_tensor_type (info, 1, &out_type);
+  memset (frame, 20, sizeof (frame));
+  ml_tensors_data_set_tensor_data (data, 0, frame, sizeof (frame));
+  status = ml_pipeline_batch_input_data (batch, 1, data);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (out_type, ML_TENSOR_TYPE_FLOAT64);
 
-  status = ml_tensors_info_get_tensor_dimension (info, 1, out_dim);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (out_dim[0], 3U);
-  EXPECT_EQ (out_dim[1], 300U);
-  EXPECT_EQ (out_dim[2], 300U);
-  EXPECT_EQ (out_dim[3], 1U);
+  wait_pipeline_process_buffers (result->received[1], 1U);
+  EXPECT_EQ (result->received[0], 1U);
+  EXPECT_EQ (result->received[1], 1U);
+  EXPECT_EQ (result->first[0], 10U);
+  EXPECT_EQ (result->first[1], 20U);
+  EXPECT_EQ (result->dim, 1U);
 
-  status = ml_tensors_info_get_tensor_name (info, 1, &out_name);
+  /* the stream 0 is missing, the frame is pushed with the deadline. */
+  memset (frame, 30, sizeof (frame));
+  ml_tensors_data_set_tensor_data (data, 0, frame, sizeof (frame));
+  status = ml_pipeline_batch_input_data (batch, 1, data);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_TRUE (out_name && g_str_equal (out_name, "tensor-name-test"));
-  g_free (out_name);
-
-  status = ml_tensors_info_get_tensor_type (info, 2, &out_type);
-  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
 
-  status = ml_tensors_info_get_tensor_dimension (info, 2, out_dim);
-  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
-
-  status = ml_tensors_info_get_tensor_name (info, 2, &out_name);
-  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+  wait_pipeline_process_buffers (result->received[1], 2U);
+  EXPECT_EQ (result->received[0], 1U);
+  EXPECT_EQ (result->received[1], 2U);
+  EXPECT_EQ (result->first[1], 30U);
 
-  /* get tensor size */
-  status = ml_tensors_info_get_tensor_size (info, 0, &data_size);
+  status = ml_pipeline_stop (handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_TRUE (data_size == (3 * 300 * 300));
 
-  status = ml_tensors_info_get_tensor_size (info, 1, &data_size);
+  status = ml_pipeline_batch_destroy (batch);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_TRUE (data_size == (3 * 300 * 300 * 8));
 
-  status = ml_tensors_info_get_tensor_size (info, -1, &data_size);
+  status = ml_pipeline_destroy (handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_TRUE (data_size == ((3 * 300 * 300) + (3 * 300 * 300 * 8)));
-
-  status = ml_tensors_info_get_tensor_size (info, 2, &data_size);
-  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
 
-  status = ml_tensors_info_destroy (info);
-  EXPECT_EQ (status, ML_ERROR_NONE);
+  ml_tensors_data_destroy (data);
+  ml_tensors_info_destroy (info);
+  g_free (result);
 }
 
 /**
- * @brief Test utility functions
+ * @brief Test NNStreamer pipeline to merge the frames of streams, the frame is dropped in the pipeline.
  */
-TEST (nnstreamer_capi_util, compare_info)
+TEST (nnstreamer_capi_batch, input_data_03_p)
 {
-  ml_tensors_info_h info1, info2;
-  ml_tensor_dimension dim;
+  const char pipeline[] = "appsrc name=srcx ! other/tensor,dimension=(string)4:1:1:2,type=(string)uint8,framerate=(fraction)0/1 ! "
+      "valve name=valvex drop=true ! tensor_sink name=sinkx";
+  ml_pipeline_h handle;
+  ml_pipeline_batch_h batch;
+  ml_pipeline_valve_h valve;
+  ml_tensors_info_h info;
+  ml_tensors_data_h data;
+  ml_tensor_dimension dim = { 4, 1, 1, 1 };
+  TestBatchResult *result;
+  guint8 frame[4];
   int status;
 
-  status = ml_tensors_info_create (&info1);
+  result = (TestBatchResult *) g_malloc0 (sizeof (TestBatchResult));
+  ASSERT_TRUE (result != NULL);
+
+  status = ml_pipeline_construct (pipeline, NULL, NULL, &handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_tensors_info_create (&info2);
+  status = ml_pipeline_valve_get_handle (handle, "valvex", &valve);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  dim[0] = 3;
-  dim[1] = 4;
-  dim[2] = 4;
-  dim[3] = 1;
+  status = ml_pipeline_batch_create (handle, "srcx", "sinkx", 2, 50,
+      test_batch_callback, result, &batch);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-  ml_tensors_info_set_count (info1, 1);
-  ml_tensors_info_set_tensor_type (info1, 0, ML_TENSOR_TYPE_UINT8);
-  ml_tensors_info_set_tensor_dimension (info1, 0, dim);
+  status = ml_pipeline_start (handle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-  ml_tensors_info_set_count (info2, 1);
-  ml_tensors_info_set_tensor_type (info2, 0, ML_TENSOR_TYPE_UINT8);
-  ml_tensors_info_set_tensor_dimension (info2, 0, dim);
+  ml_tensors_info_create (&info);
+  ml_tensors_info_set_count (info, 1);
+  ml_tensors_info_set_tensor_type (info, 0, ML_TENSOR_TYPE_UINT8);
+  ml_tensors_info_set_tensor_dimension (info, 0, dim);
 
-  /* compare info */
-  EXPECT_TRUE (ml_tensors_info_is_equal (info1, info2));
+  status = ml_tensors_data_create (info, &data);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-  /* change type */
-  ml_tensors_info_set_tensor_type (info2, 0, ML_TENSOR_TYPE_UINT16);
-  EXPECT_FALSE (ml_tensors_info_is_equal (info1, info2));
+  /* all streams are filled, the valve drops the frame. */
+  memset (frame, 10, sizeof (frame));
+  ml_tensors_data_set_tensor_data (data, 0, frame, sizeof (frame));
+  status = ml_pipeline_batch_input_data (batch, 0, data);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-  /* validate info */
-  EXPECT_TRUE (ml_tensors_info_is_valid (info2));
+  memset (frame, 20, sizeof (frame));
+  ml_tensors_data_set_tensor_data (data, 0, frame, sizeof (frame));
+  status = ml_pipeline_batch_input_data (batch, 1, data);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-  /* validate invalid dimension */
-  dim[3] = 0;
-  ml_tensors_info_set_tensor_dimension (info2, 0, dim);
-  EXPECT_FALSE (ml_tensors_info_is_valid (info2));
+  /* 100ms. Wait for the frame to be dropped. */
+  g_usleep (100000);
 
-  status = ml_tensors_info_destroy (info1);
+  status = ml_pipeline_valve_set_open (valve, true);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_tensors_info_destroy (info2);
+  /* the stream 0 is missing, the output is paired with this frame, not the dropped one. */
+  memset (frame, 30, sizeof (frame));
+  ml_tensors_data_set_tensor_data (data, 0, frame, sizeof (frame));
+  status = ml_pipeline_batch_input_data (batch, 1, data);
   EXPECT_EQ (status, ML_ERROR_NONE);
-}
 
-/**
- * @brief Test utility functions (public)
- */
-TEST (nnstreamer_capi_util, info_create_1_n)
-{
-  int status = ml_tensors_info_create (nullptr);
-  ASSERT_EQ (status, ML_ERROR_INVALID_PARAMETER);
-}
+  wait_pipeline_process_buffers (result->received[1], 1U);
+  EXPECT_EQ (result->received[0], 0U);
+  EXPECT_EQ (result->received[1], 1U);
+  EXPECT_EQ (result->first[1], 30U);
 
-/**
- * @brief Test utility functions (internal)
- */
-TEST (nnstreamer_capi_util, info_create_2_n)
-{
-  ml_tensors_info_h i;
-  int status = _ml_tensors_info_create_from_gst (&i, nullptr);
-  ASSERT_EQ (status, ML_ERROR_INVALID_PARAMETER);
-}
+  status = ml_pipeline_stop (handle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-/**
- * @brief Test utility functions (internal)
- */
-TEST (nnstreamer_capi_util, info_create_3_n)
-{
-  GstTensorsInfo gi;
-  int status = _ml_tensors_info_create_from_gst (nullptr, &gi);
-  ASSERT_EQ (status, ML_ERROR_INVALID_PARAMETER);
-}
+  status = ml_pipeline_batch_destroy (batch);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-/**
- * @brief Test utility functions (public)
- */
-TEST (nnstreamer_capi_util, info_destroy_n)
-{
-  int status = ml_tensors_info_destroy (nullptr);
-  ASSERT_EQ (status, ML_ERROR_INVALID_PARAMETER);
-}
+  status = ml_pipeline_valve_release_handle (valve);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-/**
- * @brief Test utility functions (internal)
- */
-TEST (nnstreamer_capi_util, info_init_n)
-{
-  int status = _ml_tensors_info_initialize (nullptr);
-  ASSERT_EQ (status, ML_ERROR_INVALID_PARAMETER);
-}
+  status = ml_pipeline_destroy (handle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-/**
- * @brief Test utility functions (public)
- */
-TEST (nnstreamer_capi_util, info_valid_01_n)
-{
-  bool valid;
-  int status = ml_tensors_info_validate (nullptr, &valid);
-  ASSERT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+  ml_tensors_data_destroy (data);
+  ml_tensors_info_destroy (info);
+  g_free (result);
 }
 
 /**
- * @brief Test utility functions (public)
+ * @brief Test NNStreamer pipeline to merge the frames of streams, single stream passes the frame through.
  */
-TEST (nnstreamer_capi_util, info_valid_02_n)
+TEST (nnstreamer_capi_batch, input_data_05_p)
 {
+  const char pipeline[] = "appsrc name=srcx ! other/tensor,dimension=(string)4:1:1:1,type=(string)uint8,framerate=(fraction)0/1 ! tensor_sink name=sinkx";
+  ml_pipeline_h handle;
+  ml_pipeline_batch_h batch;
   ml_tensors_info_h info;
-  ml_tensor_dimension dim = { 2, 2, 2, 2 };
+  ml_tensors_data_h data;
+  ml_tensor_dimension dim = { 4, 1, 1, 1 };
+  TestBatchResult *result;
+  guint8 frame[4];
   int status;
 
-  status = ml_tensors_info_create (&info);
+  result = (TestBatchResult *) g_malloc0 (sizeof (TestBatchResult));
+  ASSERT_TRUE (result != NULL);
+
+  status = ml_pipeline_construct (pipeline, NULL, NULL, &handle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_pipeline_batch_create (handle, "srcx", "sinkx", 1, 50,
+      test_batch_callback, result, &batch);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
+  status = ml_pipeline_start (handle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  ml_tensors_info_create (&info);
   ml_tensors_info_set_count (info, 1);
   ml_tensors_info_set_tensor_type (info, 0, ML_TENSOR_TYPE_UINT8);
   ml_tensors_info_set_tensor_dimension (info, 0, dim);
 
-  status = ml_tensors_info_validate (info, nullptr);
-  ASSERT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+  status = ml_tensors_data_create (info, &data);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_tensors_info_destroy (info);
+  memset (frame, 10, sizeof (frame));
+  ml_tensors_data_set_tensor_data (data, 0, frame, sizeof (frame));
+  status = ml_pipeline_batch_input_data (batch, 0, data);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  wait_pipeline_process_buffers (result->received[0], 1U);
+  EXPECT_EQ (result->received[0], 1U);
+  EXPECT_EQ (result->first[0], 10U);
+  EXPECT_EQ (result->dim, 1U);
+
+  status = ml_pipeline_stop (handle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_pipeline_batch_destroy (batch);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_pipeline_destroy (handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
+
+  ml_tensors_data_destroy (data);
+  ml_tensors_info_destroy (info);
+  g_free (result);
 }
 
 /**
- * @brief Test utility functions (internal)
+ * @brief Test NNStreamer pipeline to merge the frames of streams (invalid param).
  */
-TEST (nnstreamer_capi_util, info_comp_01_n)
+TEST (nnstreamer_capi_batch, input_data_02_n)
 {
+  const char pipeline[] = "appsrc name=srcx ! other/tensor,dimension=(string)4:1:1:2,type=(string)uint8,framerate=(fraction)0/1 ! tensor_sink name=sinkx";
+  ml_pipeline_h handle;
+  ml_pipeline_batch_h batch;
   ml_tensors_info_h info;
-  ml_tensor_dimension dim = { 2, 2, 2, 2 };
-  bool equal;
+  ml_tensors_data_h data;
+  ml_tensor_dimension dim = { 4, 1, 1, 2 };
+  TestBatchResult result;
   int status;
 
-  status = ml_tensors_info_create (&info);
+  status = ml_pipeline_construct (pipeline, NULL, NULL, &handle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_pipeline_batch_create (NULL, "srcx", "sinkx", 2, 0,
+      test_batch_callback, &result, &batch);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  status = ml_pipeline_batch_create (handle, "srcx", "sinkx", 0, 0,
+      test_batch_callback, &result, &batch);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  status = ml_pipeline_batch_create (handle, "srcx", "sinkx", 2, 0,
+      NULL, &result, &batch);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  /* the dimension of src is not batched with 3 streams. */
+  status = ml_pipeline_batch_create (handle, "srcx", "sinkx", 3, 0,
+      test_batch_callback, &result, &batch);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  status = ml_pipeline_batch_create (handle, "srcx", "sinkx", 2, 0,
+      test_batch_callback, &result, &batch);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
+  /* the size of a stream mismatches */
+  ml_tensors_info_create (&info);
   ml_tensors_info_set_count (info, 1);
   ml_tensors_info_set_tensor_type (info, 0, ML_TENSOR_TYPE_UINT8);
   ml_tensors_info_set_tensor_dimension (info, 0, dim);
+  ml_tensors_data_create (info, &data);
 
-  status = _ml_tensors_info_compare (nullptr, info, &equal);
-  ASSERT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+  status = ml_pipeline_batch_input_data (batch, 0, data);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
 
-  status = ml_tensors_info_destroy (info);
+  status = ml_pipeline_batch_input_data (batch, 2, data);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  status = ml_pipeline_batch_input_data (NULL, 0, data);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  status = ml_pipeline_batch_input_data (batch, 0, NULL);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  status = ml_pipeline_batch_destroy (batch);
   EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_pipeline_batch_destroy (NULL);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  status = ml_pipeline_destroy (handle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  ml_tensors_data_destroy (data);
+  ml_tensors_info_destroy (info);
 }
 
 /**
- * @brief Test utility functions (internal)
+ * @brief Test NNStreamer pipeline to merge the frames of streams, the pipeline is reset.
  */
-TEST (nnstreamer_capi_util, info_comp_02_n)
+TEST (nnstreamer_capi_batch, input_data_04_n)
 {
+  const char pipeline[] = "appsrc name=srcx ! other/tensor,dimension=(string)4:1:1:2,type=(string)uint8,framerate=(fraction)0/1 ! tensor_sink name=sinkx";
+  ml_pipeline_h handle;
+  ml_pipeline_batch_h batch;
   ml_tensors_info_h info;
-  ml_tensor_dimension dim = { 2, 2, 2, 2 };
-
-  bool equal;
+  ml_tensors_data_h data;
+  ml_tensor_dimension dim = { 4, 1, 1, 1 };
+  TestBatchResult result;
   int status;
 
-  status = ml_tensors_info_create (&info);
+  status = ml_pipeline_construct (pipeline, NULL, NULL, &handle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_pipeline_batch_create (handle, "srcx", "sinkx", 2, 0,
+      test_batch_callback, &result, &batch);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_pipeline_start (handle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  /* the reset releases the handles of the batch */
+  status = ml_pipeline_reset (handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
+  ml_tensors_info_create (&info);
   ml_tensors_info_set_count (info, 1);
   ml_tensors_info_set_tensor_type (info, 0, ML_TENSOR_TYPE_UINT8);
   ml_tensors_info_set_tensor_dimension (info, 0, dim);
+  ml_tensors_data_create (info, &data);
 
-  status = _ml_tensors_info_compare (info, nullptr, &equal);
-  ASSERT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+  status = ml_pipeline_batch_input_data (batch, 0, data);
+  EXPECT_EQ (status, ML_ERROR_STREAMS_PIPE);
 
-  status = ml_tensors_info_destroy (info);
+  status = ml_pipeline_batch_destroy (batch);
   EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_pipeline_destroy (handle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  ml_tensors_data_destroy (data);
+  ml_tensors_info_destroy (info);
 }
 
 /**
- * @brief Test utility functions (internal)
+ * @brief Test NNStreamer pipeline statistics.
  */
-TEST (nnstreamer_capi_util, info_comp_03_n)
+TEST (nnstreamer_capi_statistics, node_counters)
 {
-  ml_tensors_info_h info1, info2;
-  ml_tensor_dimension dim = { 2, 2, 2, 2 };
-  int status;
+  const char pipeline[] = "appsrc name=srcx ! other/tensor,dimension=(string)4:1:1:1,type=(string)uint8,framerate=(fraction)0/1 ! valve name=valvex ! tensor_sink name=sinkx sync=false";
+  ml_pipeline_h handle;
+  ml_pipeline_src_h srchandle;
+  ml_pipeline_sink_h sinkhandle;
+  ml_tensors_info_h info;
+  ml_tensors_data_h data;
+  ml_pipeline_node_statistics_s stats;
+  guint *count_sink;
+  uint64_t sum;
+  int i, status;
 
-  status = ml_tensors_info_create (&info1);
-  EXPECT_EQ (status, ML_ERROR_NONE);
+  count_sink = (guint *) g_malloc0 (sizeof (guint));
+  ASSERT_TRUE (count_sink != NULL);
 
-  ml_tensors_info_set_count (info1, 1);
-  ml_tensors_info_set_tensor_type (info1, 0, ML_TENSOR_TYPE_UINT8);
-  ml_tensors_info_set_tensor_dimension (info1, 0, dim);
+  status = ml_pipeline_construct (pipeline, NULL, NULL, &handle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_tensors_info_create (&info2);
+  status = ml_pipeline_set_statistics (handle, true);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  ml_tensors_info_set_count (info2, 1);
-  ml_tensors_info_set_tensor_type (info2, 0, ML_TENSOR_TYPE_UINT8);
-  ml_tensors_info_set_tensor_dimension (info2, 0, dim);
+  status = ml_pipeline_sink_register (handle, "sinkx", test_sink_callback_count, count_sink, &sinkhandle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = _ml_tensors_info_compare (info1, info2, nullptr);
-  ASSERT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+  status = ml_pipeline_src_get_handle (handle, "srcx", &srchandle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_tensors_info_destroy (info1);
+  status = ml_pipeline_start (handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_tensors_info_destroy (info2);
+  status = ml_pipeline_src_get_tensors_info (srchandle, &info);
   EXPECT_EQ (status, ML_ERROR_NONE);
-}
 
-/**
- * @brief Test utility functions (internal)
- */
-TEST (nnstreamer_capi_util, info_comp_0)
-{
-  bool equal;
-  ml_tensors_info_h info1, info2;
-  ml_tensors_info_s *is;
-  int status = ml_tensors_info_create (&info1);
-  ASSERT_EQ (status, ML_ERROR_NONE);
-  status = ml_tensors_info_create (&info2);
-  ASSERT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_data_create (info, &data);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-  is = (ml_tensors_info_s *)info1;
-  is->num_tensors = 1;
-  is = (ml_tensors_info_s *)info2;
-  is->num_tensors = 2;
+  for (i = 0; i < 5; i++) {
+    status = ml_pipeline_src_input_data (srchandle, data, ML_PIPELINE_BUF_POLICY_DO_NOT_FREE);
+    EXPECT_EQ (status, ML_ERROR_NONE);
+    g_usleep (50000);
+  }
 
-  status = _ml_tensors_info_compare (info1, info2, &equal);
-  ASSERT_EQ (status, ML_ERROR_NONE);
-  ASSERT_FALSE (equal);
+  wait_pipeline_process_buffers (*count_sink, 5U);
+  EXPECT_EQ (*count_sink, 5U);
 
-  status = ml_tensors_info_destroy (info1);
-  ASSERT_EQ (status, ML_ERROR_NONE);
-  status = ml_tensors_info_destroy (info2);
-  ASSERT_EQ (status, ML_ERROR_NONE);
-}
+  status = ml_pipeline_get_statistics (handle, "srcx", &stats);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (stats.frames_in, 0U);
+  EXPECT_EQ (stats.frames_out, 5U);
+  EXPECT_EQ (stats.bytes_out, 20U);
 
-/**
- * @brief Test utility functions (public)
- */
-TEST (nnstreamer_capi_util, info_set_count_n)
-{
-  int status = ml_tensors_info_set_count (nullptr, 1);
-  ASSERT_EQ (status, ML_ERROR_INVALID_PARAMETER);
-}
+  status = ml_pipeline_get_statistics (handle, "valvex", &stats);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (stats.frames_in, 5U);
+  EXPECT_EQ (stats.frames_out, 5U);
+  EXPECT_EQ (stats.dropped, 0U);
+  EXPECT_GT (stats.fps, 0.0);
+  EXPECT_GE (stats.latency_max, stats.latency_avg);
 
-/**
- * @brief Test utility functions (public)
- */
-TEST (nnstreamer_capi_util, info_get_count_n)
-{
-  int status = ml_tensors_info_get_count (nullptr, nullptr);
-  ASSERT_EQ (status, ML_ERROR_INVALID_PARAMETER);
-}
+  for (sum = 0, i = 0; i < ML_PIPELINE_LATENCY_HISTOGRAM_SIZE; i++)
+    sum += stats.latency_histogram[i];
+  EXPECT_EQ (sum, 5U);
 
-/**
- * @brief Test utility functions (public)
- */
-TEST (nnstreamer_capi_util, info_set_tname_0_n)
-{
-  int status = ml_tensors_info_set_tensor_name (nullptr, 0, "fail");
-  ASSERT_EQ (status, ML_ERROR_INVALID_PARAMETER);
-}
+  status = ml_pipeline_get_statistics (handle, "sinkx", &stats);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (stats.frames_in, 5U);
+  EXPECT_EQ (stats.frames_out, 0U);
 
-/**
- * @brief Test utility functions (public)
- */
-TEST (nnstreamer_capi_util, info_set_tname_1_n)
-{
-  ml_tensors_info_h info;
-  int status = ml_tensors_info_create (&info);
-  ASSERT_EQ (status, ML_ERROR_NONE);
-  status = ml_tensors_info_set_count (info, 3);
-  ASSERT_EQ (status, ML_ERROR_NONE);
+  status = ml_pipeline_set_statistics (handle, false);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_tensors_info_set_tensor_name (info, 3, "fail");
+  /* disabled */
+  status = ml_pipeline_get_statistics (handle, "valvex", &stats);
   EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
 
-  status = ml_tensors_info_destroy (info);
-  ASSERT_EQ (status, ML_ERROR_NONE);
+  status = ml_pipeline_destroy (handle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  ml_tensors_info_destroy (info);
+  ml_tensors_data_destroy (data);
+  g_free (count_sink);
 }
 
 /**
- * @brief Test utility functions (public)
+ * @brief Test NNStreamer pipeline statistics, the frames passed by the later frames are dropped.
  */
-TEST (nnstreamer_capi_util, info_set_tname_1)
+TEST (nnstreamer_capi_statistics, node_dropped)
 {
+  const char pipeline[] = "appsrc name=srcx ! other/tensor,dimension=(string)4:1:1:1,type=(string)uint8,framerate=(fraction)0/1 ! valve name=valvex ! tensor_sink name=sinkx sync=false";
+  ml_pipeline_h handle;
+  ml_pipeline_src_h srchandle;
+  ml_pipeline_sink_h sinkhandle;
+  ml_pipeline_valve_h valvehandle;
   ml_tensors_info_h info;
-  int status = ml_tensors_info_create (&info);
-  ASSERT_EQ (status, ML_ERROR_NONE);
-  status = ml_tensors_info_set_count (info, 1);
-  ASSERT_EQ (status, ML_ERROR_NONE);
+  ml_tensors_data_h data;
+  ml_pipeline_node_statistics_s stats;
+  guint *count_sink;
+  uint64_t sum;
+  int i, status;
 
-  status = ml_tensors_info_set_tensor_name (info, 0, "first");
+  count_sink = (guint *) g_malloc0 (sizeof (guint));
+  ASSERT_TRUE (count_sink != NULL);
+
+  status = ml_pipeline_construct (pipeline, NULL, NULL, &handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  status = ml_tensors_info_set_tensor_name (info, 0, "second");
+
+  status = ml_pipeline_set_statistics (handle, true);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_tensors_info_destroy (info);
-  ASSERT_EQ (status, ML_ERROR_NONE);
-}
+  status = ml_pipeline_sink_register (handle, "sinkx", test_sink_callback_count, count_sink, &sinkhandle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-/**
- * @brief Test utility functions (public)
- */
-TEST (nnstreamer_capi_util, info_get_tname_01_n)
-{
-  int status;
-  ml_tensors_info_h info;
-  char *name = NULL;
+  status = ml_pipeline_src_get_handle (handle, "srcx", &srchandle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_tensors_info_create (&info);
-  ASSERT_EQ (status, ML_ERROR_NONE);
-  status = ml_tensors_info_set_count (info, 1);
-  ASSERT_EQ (status, ML_ERROR_NONE);
+  status = ml_pipeline_valve_get_handle (handle, "valvex", &valvehandle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_tensors_info_get_tensor_name (nullptr, 0, &name);
-  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+  status = ml_pipeline_start (handle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_tensors_info_destroy (info);
-  ASSERT_EQ (status, ML_ERROR_NONE);
-}
+  status = ml_pipeline_src_get_tensors_info (srchandle, &info);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-/**
- * @brief Test utility functions (public)
- */
-TEST (nnstreamer_capi_util, info_get_tname_02_n)
-{
-  int status;
-  ml_tensors_info_h info;
+  status = ml_tensors_data_create (info, &data);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_tensors_info_create (&info);
-  ASSERT_EQ (status, ML_ERROR_NONE);
-  status = ml_tensors_info_set_count (info, 1);
-  ASSERT_EQ (status, ML_ERROR_NONE);
+  /* 3 frames are dropped in closed valve */
+  status = ml_pipeline_valve_set_open (valvehandle, false);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_tensors_info_get_tensor_name (info, 0, nullptr);
-  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+  for (i = 0; i < 3; i++) {
+    status = ml_pipeline_src_input_data (srchandle, data, ML_PIPELINE_BUF_POLICY_DO_NOT_FREE);
+    EXPECT_EQ (status, ML_ERROR_NONE);
+    g_usleep (50000);
+  }
 
-  status = ml_tensors_info_destroy (info);
-  ASSERT_EQ (status, ML_ERROR_NONE);
-}
+  status = ml_pipeline_valve_set_open (valvehandle, true);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-/**
- * @brief Test utility functions (public)
- */
-TEST (nnstreamer_capi_util, info_get_tname_03_n)
-{
-  int status;
-  ml_tensors_info_h info;
-  char *name = NULL;
+  for (i = 0; i < 2; i++) {
+    status = ml_pipeline_src_input_data (srchandle, data, ML_PIPELINE_BUF_POLICY_DO_NOT_FREE);
+    EXPECT_EQ (status, ML_ERROR_NONE);
+    g_usleep (50000);
+  }
 
-  status = ml_tensors_info_create (&info);
-  ASSERT_EQ (status, ML_ERROR_NONE);
-  status = ml_tensors_info_set_count (info, 1);
-  ASSERT_EQ (status, ML_ERROR_NONE);
+  wait_pipeline_process_buffers (*count_sink, 2U);
+  EXPECT_EQ (*count_sink, 2U);
 
-  status = ml_tensors_info_get_tensor_name (info, 2, &name);
-  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+  status = ml_pipeline_get_statistics (handle, "valvex", &stats);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (stats.frames_in, 5U);
+  EXPECT_EQ (stats.frames_out, 2U);
+  EXPECT_EQ (stats.dropped, 3U);
+  EXPECT_EQ (stats.queue_depth, 0U);
+  EXPECT_GE (stats.queue_depth_max, 1U);
 
-  status = ml_tensors_info_destroy (info);
-  ASSERT_EQ (status, ML_ERROR_NONE);
-}
+  for (sum = 0, i = 0; i < ML_PIPELINE_LATENCY_HISTOGRAM_SIZE; i++)
+    sum += stats.latency_histogram[i];
+  EXPECT_EQ (sum, 2U);
 
-/**
- * @brief Test utility functions (public)
- */
-TEST (nnstreamer_capi_util, info_set_ttype_01_n)
-{
-  int status;
+  status = ml_pipeline_destroy (handle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_tensors_info_set_tensor_type (nullptr, 0, ML_TENSOR_TYPE_INT16);
-  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+  ml_tensors_info_destroy (info);
+  ml_tensors_data_destroy (data);
+  g_free (count_sink);
 }
 
 /**
- * @brief Test utility functions (public)
+ * @brief Test NNStreamer pipeline statistics, the frames without timestamp are not paired in the node with multiple sink pads.
  */
-TEST (nnstreamer_capi_util, info_set_ttype_02_n)
+TEST (nnstreamer_capi_statistics, node_multi_sink)
 {
-  int status;
+  const char pipeline[] = "input-selector name=ins ! tensor_sink name=sinkx sync=false "
+      "appsrc name=srcx ! other/tensor,dimension=(string)4:1:1:1,type=(string)uint8,framerate=(fraction)0/1 ! ins.sink_0 "
+      "appsrc name=srcy ! other/tensor,dimension=(string)4:1:1:1,type=(string)uint8,framerate=(fraction)0/1 ! ins.sink_1";
+  ml_pipeline_h handle;
+  ml_pipeline_src_h srchandle_x, srchandle_y;
+  ml_pipeline_sink_h sinkhandle;
   ml_tensors_info_h info;
+  ml_tensors_data_h data;
+  ml_pipeline_node_statistics_s stats;
+  guint *count_sink;
+  uint64_t sum;
+  int i, status;
 
-  status = ml_tensors_info_create (&info);
-  ASSERT_EQ (status, ML_ERROR_NONE);
-  status = ml_tensors_info_set_count (info, 1);
-  ASSERT_EQ (status, ML_ERROR_NONE);
+  count_sink = (guint *) g_malloc0 (sizeof (guint));
+  ASSERT_TRUE (count_sink != NULL);
 
-  status = ml_tensors_info_set_tensor_type (info, 0, ML_TENSOR_TYPE_UNKNOWN);
-  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+  status = ml_pipeline_construct (pipeline, NULL, NULL, &handle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_tensors_info_destroy (info);
-  ASSERT_EQ (status, ML_ERROR_NONE);
-}
+  status = ml_pipeline_set_statistics (handle, true);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-/**
- * @brief Test utility functions (public)
- */
-TEST (nnstreamer_capi_util, info_set_ttype_03_n)
-{
-  int status;
-  ml_tensors_info_h info;
+  status = ml_pipeline_sink_register (handle, "sinkx", test_sink_callback_count, count_sink, &sinkhandle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_tensors_info_create (&info);
-  ASSERT_EQ (status, ML_ERROR_NONE);
-  status = ml_tensors_info_set_count (info, 1);
-  ASSERT_EQ (status, ML_ERROR_NONE);
+  status = ml_pipeline_src_get_handle (handle, "srcx", &srchandle_x);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  status = ml_pipeline_src_get_handle (handle, "srcy", &srchandle_y);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_tensors_info_set_tensor_type (info, 2, ML_TENSOR_TYPE_INT16);
-  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+  status = ml_pipeline_start (handle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_tensors_info_destroy (info);
-  ASSERT_EQ (status, ML_ERROR_NONE);
-}
+  status = ml_pipeline_src_get_tensors_info (srchandle_x, &info);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-/**
- * @brief Test utility functions (public)
- */
-TEST (nnstreamer_capi_util, info_get_ttype_01_n)
-{
-  int status;
-  ml_tensor_type_e type;
+  status = ml_tensors_data_create (info, &data);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_tensors_info_get_tensor_type (nullptr, 0, &type);
-  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
-}
+  /* sink_0 is active, the frames to sink_1 are not pushed out */
+  for (i = 0; i < 3; i++) {
+    status = ml_pipeline_src_input_data (srchandle_y, data, ML_PIPELINE_BUF_POLICY_DO_NOT_FREE);
+    EXPECT_EQ (status, ML_ERROR_NONE);
+    status = ml_pipeline_src_input_data (srchandle_x, data, ML_PIPELINE_BUF_POLICY_DO_NOT_FREE);
+    EXPECT_EQ (status, ML_ERROR_NONE);
+    g_usleep (50000);
+  }
 
-/**
- * @brief Test utility functions (public)
- */
-TEST (nnstreamer_capi_util, info_get_ttype_02_n)
-{
-  int status;
-  ml_tensors_info_h info;
+  wait_pipeline_process_buffers (*count_sink, 3U);
+  EXPECT_EQ (*count_sink, 3U);
 
-  status = ml_tensors_info_create (&info);
-  ASSERT_EQ (status, ML_ERROR_NONE);
-  status = ml_tensors_info_set_count (info, 1);
-  ASSERT_EQ (status, ML_ERROR_NONE);
+  /* the output cannot be paired with the input, no latency and dropped frames */
+  status = ml_pipeline_get_statistics (handle, "ins", &stats);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (stats.frames_in, 6U);
+  EXPECT_EQ (stats.frames_out, 3U);
+  EXPECT_EQ (stats.dropped, 0U);
+  EXPECT_EQ (stats.queue_depth, 0U);
 
-  status = ml_tensors_info_get_tensor_type (info, 0, nullptr);
-  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+  for (sum = 0, i = 0; i < ML_PIPELINE_LATENCY_HISTOGRAM_SIZE; i++)
+    sum += stats.latency_histogram[i];
+  EXPECT_EQ (sum, 0U);
 
-  status = ml_tensors_info_destroy (info);
-  ASSERT_EQ (status, ML_ERROR_NONE);
+  status = ml_pipeline_destroy (handle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  ml_tensors_info_destroy (info);
+  ml_tensors_data_destroy (data);
+  g_free (count_sink);
 }
 
 /**
- * @brief Test utility functions (public)
+ * @brief Test NNStreamer pipeline statistics.
+ * @detail Failure case with invalid param.
  */
-TEST (nnstreamer_capi_util, info_get_ttype_03_n)
+TEST (nnstreamer_capi_statistics, invalid_param_n)
 {
+  const char pipeline[] = "appsrc name=srcx ! other/tensor,dimension=(string)4:1:1:1,type=(string)uint8,framerate=(fraction)0/1 ! tensor_sink name=sinkx sync=false";
+  ml_pipeline_h handle;
+  ml_pipeline_node_statistics_s stats;
   int status;
-  ml_tensors_info_h info;
-  ml_tensor_type_e type;
 
-  status = ml_tensors_info_create (&info);
-  ASSERT_EQ (status, ML_ERROR_NONE);
-  status = ml_tensors_info_set_count (info, 1);
-  ASSERT_EQ (status, ML_ERROR_NONE);
+  status = ml_pipeline_set_statistics (NULL, true);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
 
-  status = ml_tensors_info_get_tensor_type (info, 2, &type);
+  status = ml_pipeline_construct (pipeline, NULL, NULL, &handle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_pipeline_set_statistics (handle, true);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_pipeline_get_statistics (NULL, "sinkx", &stats);
   EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
 
-  status = ml_tensors_info_destroy (info);
-  ASSERT_EQ (status, ML_ERROR_NONE);
-}
+  status = ml_pipeline_get_statistics (handle, NULL, &stats);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
 
-/**
- * @brief Test utility functions (public)
- */
-TEST (nnstreamer_capi_util, info_set_tdimension_01_n)
-{
-  int status;
-  ml_tensor_dimension dim = { 2, 2, 2, 2 };
+  status = ml_pipeline_get_statistics (handle, "sinkx", NULL);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
 
-  status = ml_tensors_info_set_tensor_dimension (nullptr, 0, dim);
+  status = ml_pipeline_get_statistics (handle, "unknown", &stats);
   EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  status = ml_pipeline_destroy (handle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 }
 
 /**
- * @brief Test utility functions (public)
+ * @brief Test NNStreamer pipeline end-to-end latency from src to sink.
  */
-TEST (nnstreamer_capi_util, info_set_tdimension_02_n)
+TEST (nnstreamer_capi_sink, latency)
 {
-  int status;
+  const char pipeline[] = "appsrc name=srcx ! other/tensor,dimension=(string)4:1:1:1,type=(string)uint8,framerate=(fraction)0/1 ! queue ! tensor_sink name=sinkx sync=false";
+  ml_pipeline_h handle;
+  ml_pipeline_src_h srchandle;
+  ml_pipeline_sink_h sinkhandle;
   ml_tensors_info_h info;
-  ml_tensor_dimension dim = { 1, 2, 3, 4 };
+  ml_tensors_data_h data;
+  ml_pipeline_sink_latency_s latency;
+  guint *count_sink;
+  int i, status;
 
-  status = ml_tensors_info_create (&info);
-  ASSERT_EQ (status, ML_ERROR_NONE);
-  status = ml_tensors_info_set_count (info, 1);
-  ASSERT_EQ (status, ML_ERROR_NONE);
+  count_sink = (guint *) g_malloc0 (sizeof (guint));
+  ASSERT_TRUE (count_sink != NULL);
 
-  status = ml_tensors_info_set_tensor_dimension (info, 2, dim);
-  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+  status = ml_pipeline_construct (pipeline, NULL, NULL, &handle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_tensors_info_destroy (info);
-  ASSERT_EQ (status, ML_ERROR_NONE);
-}
+  status = ml_pipeline_sink_register (handle, "sinkx", test_sink_callback_count, count_sink, &sinkhandle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-/**
- * @brief Test utility functions (public)
- */
-TEST (nnstreamer_capi_util, info_get_tdimension_01_n)
-{
-  int status;
-  ml_tensor_dimension dim;
+  status = ml_pipeline_src_get_handle (handle, "srcx", &srchandle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_tensors_info_get_tensor_dimension (nullptr, 0, dim);
-  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
-}
+  status = ml_pipeline_sink_get_latency (sinkhandle, &latency);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (latency.count, 0U);
 
-/**
- * @brief Test utility functions (public)
- */
-TEST (nnstreamer_capi_util, info_get_tdimension_02_n)
-{
-  int status;
-  ml_tensors_info_h info;
-  ml_tensor_dimension dim;
+  status = ml_pipeline_start (handle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_tensors_info_create (&info);
-  ASSERT_EQ (status, ML_ERROR_NONE);
-  status = ml_tensors_info_set_count (info, 1);
-  ASSERT_EQ (status, ML_ERROR_NONE);
+  status = ml_pipeline_src_get_tensors_info (srchandle, &info);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_tensors_info_get_tensor_dimension (info, 2, dim);
-  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+  status = ml_tensors_data_create (info, &data);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_tensors_info_destroy (info);
-  ASSERT_EQ (status, ML_ERROR_NONE);
-}
+  for (i = 0; i < 10; i++) {
+    status = ml_pipeline_src_input_data (srchandle, data, ML_PIPELINE_BUF_POLICY_DO_NOT_FREE);
+    EXPECT_EQ (status, ML_ERROR_NONE);
+    g_usleep (10000);
+  }
 
-/**
- * @brief Test utility functions (public)
- */
-TEST (nnstreamer_capi_util, info_get_tsize_01_n)
-{
-  int status;
-  ml_tensors_info_h info;
+  wait_pipeline_process_buffers (*count_sink, 10U);
+  EXPECT_EQ (*count_sink, 10U);
 
-  status = ml_tensors_info_create (&info);
-  ASSERT_EQ (status, ML_ERROR_NONE);
-  status = ml_tensors_info_set_count (info, 1);
-  ASSERT_EQ (status, ML_ERROR_NONE);
+  status = ml_pipeline_sink_get_latency (sinkhandle, &latency);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (latency.count, 10U);
+  EXPECT_LE (latency.p50, latency.p90);
+  EXPECT_LE (latency.p90, latency.p99);
+  EXPECT_LE (latency.p99, latency.max);
+  EXPECT_LE (latency.last, latency.max);
 
-  status = ml_tensors_info_get_tensor_size (info, 0, nullptr);
-  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+  status = ml_pipeline_destroy (handle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_tensors_info_destroy (info);
-  ASSERT_EQ (status, ML_ERROR_NONE);
+  ml_tensors_info_destroy (info);
+  ml_tensors_data_destroy (data);
+  g_free (count_sink);
 }
 
 /**
- * @brief Test utility functions (public)
+ * @brief Data structure to get the latency in the sink callback.
  */
-TEST (nnstreamer_capi_util, info_get_tsize_02_n)
-{
+typedef struct {
+  ml_pipeline_sink_h sinkhandle;
+  guint count;
   int status;
-  size_t data_size;
-
-  status = ml_tensors_info_get_tensor_size (nullptr, 0, &data_size);
-  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
-}
+} test_sink_latency_s;
 
 /**
- * @brief Test utility functions (public)
+ * @brief Sink callback to get the latency with the handle.
  */
-TEST (nnstreamer_capi_util, info_get_tsize_03_n)
+static void
+test_sink_callback_latency (const ml_tensors_data_h data, const ml_tensors_info_h info, void *user_data)
 {
-  int status;
-  size_t data_size;
-  ml_tensors_info_h info;
-
-  status = ml_tensors_info_create (&info);
-  ASSERT_EQ (status, ML_ERROR_NONE);
-  status = ml_tensors_info_set_count (info, 1);
-  ASSERT_EQ (status, ML_ERROR_NONE);
+  test_sink_latency_s *test = (test_sink_latency_s *) user_data;
+  ml_pipeline_sink_latency_s latency;
 
-  status = ml_tensors_info_get_tensor_size (info, 2, &data_size);
-  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
-  status = ml_tensors_info_get_tensor_size (info, 0, &data_size);
-  EXPECT_TRUE (data_size == 0);
+  if (test->sinkhandle == NULL)
+    return;
 
-  status = ml_tensors_info_destroy (info);
-  ASSERT_EQ (status, ML_ERROR_NONE);
+  test->status = ml_pipeline_sink_get_latency (test->sinkhandle, &latency);
+  test->count++;
 }
 
 /**
- * @brief Test utility functions (public)
+ * @brief Test NNStreamer pipeline end-to-end latency in the sink callback.
  */
-TEST (nnstreamer_capi_util, info_clone)
+TEST (nnstreamer_capi_sink, latency_in_callback)
 {
-  gint status;
-  guint count = 0;
-  ml_tensors_info_h in_info, out_info;
-  ml_tensor_dimension in_dim, out_dim;
-  ml_tensor_type_e type = ML_TENSOR_TYPE_UNKNOWN;
-
-  status = ml_tensors_info_create (&in_info);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-  status = ml_tensors_info_create (&out_info);
-  EXPECT_EQ (status, ML_ERROR_NONE);
+  const char pipeline[] = "appsrc name=srcx ! other/tensor,dimension=(string)4:1:1:1,type=(string)uint8,framerate=(fraction)0/1 ! tensor_sink name=sinkx sync=false";
+  ml_pipeline_h handle;
+  ml_pipeline_src_h srchandle;
+  ml_pipeline_sink_h sinkhandle;
+  ml_tensors_info_h info;
+  ml_tensors_data_h data;
+  test_sink_latency_s *test;
+  int i, status;
 
-  in_dim[0] = 5;
-  in_dim[1] = 1;
-  in_dim[2] = 1;
-  in_dim[3] = 1;
+  test = g_new0 (test_sink_latency_s, 1);
+  ASSERT_TRUE (test != NULL);
+  test->status = ML_ERROR_UNKNOWN;
 
-  status = ml_tensors_info_set_count (in_info, 1);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-  status = ml_tensors_info_set_tensor_type (in_info, 0, ML_TENSOR_TYPE_UINT8);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-  status = ml_tensors_info_set_tensor_dimension (in_info, 0, in_dim);
+  status = ml_pipeline_construct (pipeline, NULL, NULL, &handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_tensors_info_clone (out_info, in_info);
+  status = ml_pipeline_sink_register (handle, "sinkx", test_sink_callback_latency, test, &sinkhandle);
   EXPECT_EQ (status, ML_ERROR_NONE);
+  test->sinkhandle = sinkhandle;
 
-  status = ml_tensors_info_get_count (out_info, &count);
+  status = ml_pipeline_src_get_handle (handle, "srcx", &srchandle);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (count, 1U);
 
-  status = ml_tensors_info_get_tensor_type (out_info, 0, &type);
+  status = ml_pipeline_start (handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (type, ML_TENSOR_TYPE_UINT8);
 
-  status = ml_tensors_info_get_tensor_dimension (out_info, 0, out_dim);
+  status = ml_pipeline_src_get_tensors_info (srchandle, &info);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_TRUE (in_dim[0] == out_dim[0]);
-  EXPECT_TRUE (in_dim[1] == out_dim[1]);
-  EXPECT_TRUE (in_dim[2] == out_dim[2]);
-  EXPECT_TRUE (in_dim[3] == out_dim[3]);
 
-  status = ml_tensors_info_destroy (in_info);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-  status = ml_tensors_info_destroy (out_info);
+  status = ml_tensors_data_create (info, &data);
   EXPECT_EQ (status, ML_ERROR_NONE);
-}
 
-/**
- * @brief Test utility functions (public)
- */
-TEST (nnstreamer_capi_util, info_clone_01_n)
-{
-  int status;
-  ml_tensors_info_h src;
+  for (i = 0; i < 3; i++) {
+    status = ml_pipeline_src_input_data (srchandle, data, ML_PIPELINE_BUF_POLICY_DO_NOT_FREE);
+    EXPECT_EQ (status, ML_ERROR_NONE);
+    g_usleep (10000);
+  }
 
-  status = ml_tensors_info_create (&src);
-  ASSERT_EQ (status, ML_ERROR_NONE);
+  wait_pipeline_process_buffers (test->count, 3U);
+  EXPECT_EQ (test->count, 3U);
+  EXPECT_EQ (test->status, ML_ERROR_NONE);
 
-  status = ml_tensors_info_clone (nullptr, src);
-  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+  status = ml_pipeline_destroy (handle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_tensors_info_destroy (src);
-  ASSERT_EQ (status, ML_ERROR_NONE);
+  ml_tensors_info_destroy (info);
+  ml_tensors_data_destroy (data);
+  g_free (test);
 }
 
 /**
- * @brief Test utility functions (public)
+ * @brief Test NNStreamer pipeline end-to-end latency.
+ * @detail Failure case with invalid param.
  */
-TEST (nnstreamer_capi_util, info_clone_02_n)
+TEST (nnstreamer_capi_sink, latency_invalid_param_n)
 {
+  const char pipeline[] = "appsrc name=srcx ! other/tensor,dimension=(string)4:1:1:1,type=(string)uint8,framerate=(fraction)0/1 ! tensor_sink name=sinkx sync=false";
+  ml_pipeline_h handle;
+  ml_pipeline_sink_h sinkhandle;
+  ml_pipeline_sink_latency_s latency;
+  guint *count_sink;
   int status;
-  ml_tensors_info_h desc;
 
-  status = ml_tensors_info_create (&desc);
-  ASSERT_EQ (status, ML_ERROR_NONE);
+  count_sink = (guint *) g_malloc0 (sizeof (guint));
+  ASSERT_TRUE (count_sink != NULL);
 
-  status = ml_tensors_info_clone (desc, nullptr);
+  status = ml_pipeline_sink_get_latency (NULL, &latency);
   EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
 
-  status = ml_tensors_info_destroy (desc);
-  ASSERT_EQ (status, ML_ERROR_NONE);
-}
+  status = ml_pipeline_construct (pipeline, NULL, NULL, &handle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-/**
- * @brief Test utility functions (public)
- */
-TEST (nnstreamer_capi_util, data_create_01_n)
-{
-  int status;
-  ml_tensors_data_h data = nullptr;
+  status = ml_pipeline_sink_register (handle, "sinkx", test_sink_callback_count, count_sink, &sinkhandle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_tensors_data_create (nullptr, &data);
+  status = ml_pipeline_sink_get_latency (sinkhandle, NULL);
   EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
-}
-
-/**
- * @brief Test utility functions (public)
- */
-TEST (nnstreamer_capi_util, data_create_02_n)
-{
-  int status;
-  ml_tensors_info_h info;
 
-  status = ml_tensors_info_create (&info);
-  ASSERT_EQ (status, ML_ERROR_NONE);
+  /* the handle not registered in the sink node */
+  {
+    ml_pipeline_common_elem unregistered;
 
+    memcpy (&unregistered, sinkhandle, sizeof (ml_pipeline_common_elem));
+    status = ml_pipeline_sink_get_latency (&unregistered, &latency);
+    EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+  }
 
-  status = ml_tensors_data_create (info, nullptr);
-  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+  status = ml_pipeline_destroy (handle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_tensors_info_destroy (info);
-  ASSERT_EQ (status, ML_ERROR_NONE);
+  g_free (count_sink);
 }
 
 /**
- * @brief Test utility functions (public)
+ * @brief Test NNStreamer pipeline switch
  */
-TEST (nnstreamer_capi_util, data_create_03_n)
+TEST (nnstreamer_capi_switch, dummy_01)
 {
+  ml_pipeline_h handle;
+  ml_pipeline_switch_h switchhandle;
+  ml_pipeline_sink_h sinkhandle;
+  ml_pipeline_switch_e type;
+  ml_pipeline_state_e state;
+  gchar *pipeline;
   int status;
-  ml_tensors_info_h info;
-  ml_tensors_data_h data = nullptr;
+  guint *count_sink;
+  TestPipeState *pipe_state;
+  gchar **node_list = NULL;
 
-  status = ml_tensors_info_create (&info);
-  ASSERT_EQ (status, ML_ERROR_NONE);
+  pipeline = g_strdup (
+      "input-selector name=ins ! tensor_converter ! tensor_sink name=sinkx "
+      "videotestsrc is-live=true ! videoconvert ! ins.sink_0 "
+      "videotestsrc num-buffers=3 is-live=true ! videoconvert ! ins.sink_1");
 
-  /* invalid info */
-  status = ml_tensors_data_create (info, &data);
-  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+  count_sink = (guint *)g_malloc (sizeof (guint));
+  ASSERT_TRUE (count_sink != NULL);
+  *count_sink = 0;
 
-  status = ml_tensors_info_destroy (info);
-  ASSERT_EQ (status, ML_ERROR_NONE);
+  pipe_state = (TestPipeState *)g_new0 (TestPipeState, 1);
+  ASSERT_TRUE (pipe_state != NULL);
 
-  status = ml_tensors_data_destroy (data);
-  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
-}
+  status = ml_pipeline_construct (pipeline, test_pipe_state_callback, pipe_state, &handle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-/**
- * @brief Test utility functions (internal)
- */
-TEST (nnstreamer_capi_util, data_create_internal_n)
-{
-  int status;
+  status = ml_pipeline_switch_get_handle (handle, "ins", &type, &switchhandle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (type, ML_PIPELINE_SWITCH_INPUT_SELECTOR);
 
-  status = _ml_tensors_data_create_no_alloc (NULL, NULL);
-  EXPECT_NE (status, ML_ERROR_NONE);
-}
+  status = ml_pipeline_switch_get_pad_list (switchhandle, &node_list);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-/**
- * @brief Test utility functions (public)
- */
-TEST (nnstreamer_capi_util, data_get_tdata_01_n)
-{
-  int status;
-  size_t data_size;
-  void *raw_data;
+  if (node_list) {
+    gchar *name = NULL;
+    guint idx = 0;
 
-  status = ml_tensors_data_get_tensor_data (nullptr, 0, &raw_data, &data_size);
-  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
-}
+    while ((name = node_list[idx]) != NULL) {
+      EXPECT_TRUE (g_str_equal (name, "sink_0") || g_str_equal (name, "sink_1"));
+      idx++;
+      g_free (name);
+    }
 
-/**
- * @brief Test utility functions (public)
- */
-TEST (nnstreamer_capi_util, data_get_tdata_02_n)
-{
-  int status;
-  size_t data_size;
-  ml_tensors_info_h info;
-  ml_tensors_data_h data;
-  ml_tensor_dimension dim = { 2, 2, 2, 2 };
+    EXPECT_EQ (idx, 2U);
+    g_free (node_list);
+  }
 
-  status = ml_tensors_info_create (&info);
-  ASSERT_EQ (status, ML_ERROR_NONE);
-  status = ml_tensors_info_set_count (info, 1);
-  ASSERT_EQ (status, ML_ERROR_NONE);
-  status = ml_tensors_info_set_tensor_type (info, 0, ML_TENSOR_TYPE_UINT8);
-  ASSERT_EQ (status, ML_ERROR_NONE);
-  status = ml_tensors_info_set_tensor_dimension (info, 0, dim);
-  ASSERT_EQ (status, ML_ERROR_NONE);
-  status = ml_tensors_data_create (info, &data);
-  ASSERT_EQ (status, ML_ERROR_NONE);
+  status = ml_pipeline_sink_register (
+      handle, "sinkx", test_sink_callback_count, count_sink, &sinkhandle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_TRUE (sinkhandle != NULL);
 
-  status = ml_tensors_data_get_tensor_data (data, 0, nullptr, &data_size);
-  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+  status = ml_pipeline_switch_select (switchhandle, "sink_1");
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_tensors_data_destroy (data);
-  ASSERT_EQ (status, ML_ERROR_NONE);
-  status = ml_tensors_info_destroy (info);
-  ASSERT_EQ (status, ML_ERROR_NONE);
-}
+  status = ml_pipeline_start (handle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-/**
- * @brief Test utility functions (public)
- */
-TEST (nnstreamer_capi_util, data_get_tdata_03_n)
-{
-  int status;
-  void *raw_data;
-  ml_tensors_info_h info;
-  ml_tensors_data_h data;
-  ml_tensor_dimension dim = { 2, 2, 2, 2 };
+  g_usleep (50000);
+  status = ml_pipeline_get_state (handle, &state);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  wait_for_start (handle, state, status);
+  EXPECT_EQ (state, ML_PIPELINE_STATE_PLAYING);
 
-  status = ml_tensors_info_create (&info);
-  ASSERT_EQ (status, ML_ERROR_NONE);
-  status = ml_tensors_info_set_count (info, 1);
-  ASSERT_EQ (status, ML_ERROR_NONE);
-  status = ml_tensors_info_set_tensor_type (info, 0, ML_TENSOR_TYPE_UINT8);
-  ASSERT_EQ (status, ML_ERROR_NONE);
-  status = ml_tensors_info_set_tensor_dimension (info, 0, dim);
-  ASSERT_EQ (status, ML_ERROR_NONE);
-  status = ml_tensors_data_create (info, &data);
-  ASSERT_EQ (status, ML_ERROR_NONE);
+  wait_pipeline_process_buffers (*count_sink, 3);
+  g_usleep (300000); /* To check if more frames are coming in  */
+  EXPECT_EQ (*count_sink, 3U);
 
-  status = ml_tensors_data_get_tensor_data (data, 0, &raw_data, nullptr);
-  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+  status = ml_pipeline_stop (handle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_tensors_data_destroy (data);
-  ASSERT_EQ (status, ML_ERROR_NONE);
-  status = ml_tensors_info_destroy (info);
-  ASSERT_EQ (status, ML_ERROR_NONE);
-}
+  status = ml_pipeline_sink_unregister (sinkhandle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-/**
- * @brief Test utility functions (public)
- */
-TEST (nnstreamer_capi_util, data_get_tdata_04_n)
-{
-  int status;
-  size_t data_size;
-  void *raw_data;
-  ml_tensors_info_h info;
-  ml_tensors_data_h data;
-  ml_tensor_dimension dim = { 2, 2, 2, 2 };
+  status = ml_pipeline_switch_release_handle (switchhandle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_tensors_info_create (&info);
-  ASSERT_EQ (status, ML_ERROR_NONE);
-  status = ml_tensors_info_set_count (info, 1);
-  ASSERT_EQ (status, ML_ERROR_NONE);
-  status = ml_tensors_info_set_tensor_type (info, 0, ML_TENSOR_TYPE_UINT8);
-  ASSERT_EQ (status, ML_ERROR_NONE);
-  status = ml_tensors_info_set_tensor_dimension (info, 0, dim);
-  ASSERT_EQ (status, ML_ERROR_NONE);
-  status = ml_tensors_data_create (info, &data);
-  ASSERT_EQ (status, ML_ERROR_NONE);
+  status = ml_pipeline_destroy (handle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_tensors_data_get_tensor_data (data, 2, &raw_data, &data_size);
-  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+  EXPECT_TRUE (pipe_state->paused);
+  EXPECT_TRUE (pipe_state->playing);
 
-  status = ml_tensors_data_destroy (data);
-  ASSERT_EQ (status, ML_ERROR_NONE);
-  status = ml_tensors_info_destroy (info);
-  ASSERT_EQ (status, ML_ERROR_NONE);
+  g_free (pipeline);
+  g_free (count_sink);
+  g_free (pipe_state);
 }
 
 /**
- * @brief Test utility functions (public)
+ * @brief Test NNStreamer pipeline switch
  */
-TEST (nnstreamer_capi_util, data_set_tdata_01_n)
+TEST (nnstreamer_capi_switch, dummy_02)
 {
+  ml_pipeline_h handle;
+  ml_pipeline_switch_h switchhandle;
+  ml_pipeline_sink_h sinkhandle0, sinkhandle1;
+  ml_pipeline_switch_e type;
+  gchar *pipeline;
   int status;
-  void *raw_data;
+  guint *count_sink0, *count_sink1;
+  gchar **node_list = NULL;
 
-  raw_data = g_malloc (1024); /* larger than tensor */
+  /**
+   * Prerolling problem
+   * For running the test, set async=false in the sink element
+   * when using an output selector.
+   * The pipeline state can be changed to paused
+   * after all sink element receive buffer.
+   */
+  pipeline = g_strdup ("videotestsrc is-live=true ! videoconvert ! tensor_converter ! output-selector name=outs "
+                       "outs.src_0 ! tensor_sink name=sink0 async=false "
+                       "outs.src_1 ! tensor_sink name=sink1 async=false");
 
-  status = ml_tensors_data_set_tensor_data (nullptr, 0, raw_data, 16);
-  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+  count_sink0 = (guint *)g_malloc (sizeof (guint));
+  ASSERT_TRUE (count_sink0 != NULL);
+  *count_sink0 = 0;
 
-  g_free (raw_data);
+  count_sink1 = (guint *)g_malloc (sizeof (guint));
+  ASSERT_TRUE (count_sink1 != NULL);
+  *count_sink1 = 0;
+
+  status = ml_pipeline_construct (pipeline, NULL, NULL, &handle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_pipeline_switch_get_handle (handle, "outs", &type, &switchhandle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (type, ML_PIPELINE_SWITCH_OUTPUT_SELECTOR);
+
+  status = ml_pipeline_switch_get_pad_list (switchhandle, &node_list);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  if (node_list) {
+    gchar *name = NULL;
+    guint idx = 0;
+
+    while ((name = node_list[idx]) != NULL) {
+      EXPECT_TRUE (g_str_equal (name, "src_0") || g_str_equal (name, "src_1"));
+      idx++;
+      g_free (name);
+    }
+
+    EXPECT_EQ (idx, 2U);
+    g_free (node_list);
+  }
+
+  status = ml_pipeline_sink_register (
+      handle, "sink0", test_sink_callback_count, count_sink0, &sinkhandle0);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_TRUE (sinkhandle0 != NULL);
+
+  status = ml_pipeline_sink_register (
+      handle, "sink1", test_sink_callback_count, count_sink1, &sinkhandle1);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_TRUE (sinkhandle1 != NULL);
+
+  status = ml_pipeline_switch_select (switchhandle, "src_1");
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_pipeline_start (handle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  g_usleep (200000); /* 200ms. Let a few frames flow. */
+
+  status = ml_pipeline_stop (handle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_pipeline_sink_unregister (sinkhandle0);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_pipeline_sink_unregister (sinkhandle1);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_pipeline_switch_release_handle (switchhandle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_pipeline_destroy (handle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  EXPECT_EQ (*count_sink0, 0U);
+  EXPECT_TRUE (*count_sink1 > 0U);
+
+  g_free (pipeline);
+  g_free (count_sink0);
+  g_free (count_sink1);
 }
 
 /**
- * @brief Test utility functions (public)
+ * @brief Test NNStreamer pipeline switch
+ * @detail Failure case to handle input-selector element with invalid param.
  */
-TEST (nnstreamer_capi_util, data_set_tdata_02_n)
+TEST (nnstreamer_capi_switch, failure_01_n)
 {
+  ml_pipeline_switch_h switchhandle;
+  ml_pipeline_switch_e type;
   int status;
-  ml_tensors_info_h info;
-  ml_tensors_data_h data;
-  ml_tensor_dimension dim = { 2, 2, 2, 2 };
-
-  status = ml_tensors_info_create (&info);
-  ASSERT_EQ (status, ML_ERROR_NONE);
-  status = ml_tensors_info_set_count (info, 1);
-  ASSERT_EQ (status, ML_ERROR_NONE);
-  status = ml_tensors_info_set_tensor_type (info, 0, ML_TENSOR_TYPE_UINT8);
-  ASSERT_EQ (status, ML_ERROR_NONE);
-  status = ml_tensors_info_set_tensor_dimension (info, 0, dim);
-  ASSERT_EQ (status, ML_ERROR_NONE);
-  status = ml_tensors_data_create (info, &data);
-  ASSERT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_tensors_data_set_tensor_data (data, 0, nullptr, 16);
+  /* invalid param : pipe */
+  status = ml_pipeline_switch_get_handle (NULL, "ins", &type, &switchhandle);
   EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
-
-  status = ml_tensors_data_destroy (data);
-  ASSERT_EQ (status, ML_ERROR_NONE);
-  status = ml_tensors_info_destroy (info);
-  ASSERT_EQ (status, ML_ERROR_NONE);
 }
 
 /**
- * @brief Test utility functions (public)
+ * @brief Test NNStreamer pipeline switch
+ * @detail Failure case to handle input-selector element with invalid param.
  */
-TEST (nnstreamer_capi_util, data_set_tdata_03_n)
+TEST (nnstreamer_capi_switch, failure_02_n)
 {
+  ml_pipeline_h handle;
+  ml_pipeline_switch_h switchhandle;
+  ml_pipeline_switch_e type;
+  gchar *pipeline;
   int status;
-  void *raw_data;
-  ml_tensors_info_h info;
-  ml_tensors_data_h data;
-  ml_tensor_dimension dim = { 2, 2, 2, 2 };
 
-  raw_data = g_malloc (1024); /* larger than tensor */
+  pipeline = g_strdup ("input-selector name=ins ! tensor_converter ! tensor_sink name=sinkx "
+                       "videotestsrc is-live=true ! videoconvert ! ins.sink_0 "
+                       "videotestsrc num-buffers=3 ! videoconvert ! ins.sink_1");
 
-  status = ml_tensors_info_create (&info);
-  ASSERT_EQ (status, ML_ERROR_NONE);
-  status = ml_tensors_info_set_count (info, 1);
-  ASSERT_EQ (status, ML_ERROR_NONE);
-  status = ml_tensors_info_set_tensor_type (info, 0, ML_TENSOR_TYPE_UINT8);
-  ASSERT_EQ (status, ML_ERROR_NONE);
-  status = ml_tensors_info_set_tensor_dimension (info, 0, dim);
-  ASSERT_EQ (status, ML_ERROR_NONE);
-  status = ml_tensors_data_create (info, &data);
-  ASSERT_EQ (status, ML_ERROR_NONE);
+  status = ml_pipeline_construct (pipeline, NULL, NULL, &handle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_tensors_data_set_tensor_data (data, 2, raw_data, 16);
+  /* invalid param : name */
+  status = ml_pipeline_switch_get_handle (handle, NULL, &type, &switchhandle);
   EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
 
-  status = ml_tensors_data_destroy (data);
-  ASSERT_EQ (status, ML_ERROR_NONE);
-  status = ml_tensors_info_destroy (info);
-  ASSERT_EQ (status, ML_ERROR_NONE);
-  g_free (raw_data);
+  status = ml_pipeline_destroy (handle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  g_free (pipeline);
 }
 
 /**
- * @brief Test utility functions (public)
+ * @brief Test NNStreamer pipeline switch
+ * @detail Failure case to handle input-selector element with invalid param.
  */
-TEST (nnstreamer_capi_util, data_set_tdata_04_n)
+TEST (nnstreamer_capi_switch, failure_03_n)
 {
+  ml_pipeline_h handle;
+  ml_pipeline_switch_h switchhandle;
+  ml_pipeline_switch_e type;
+  gchar *pipeline;
   int status;
-  void *raw_data;
-  ml_tensors_info_h info;
-  ml_tensors_data_h data;
-  ml_tensor_dimension dim = { 2, 2, 2, 2 };
 
-  raw_data = g_malloc (1024); /* larger than tensor */
+  pipeline = g_strdup ("input-selector name=ins ! tensor_converter ! tensor_sink name=sinkx "
+                       "videotestsrc is-live=true ! videoconvert ! ins.sink_0 "
+                       "videotestsrc num-buffers=3 ! videoconvert ! ins.sink_1");
 
-  status = ml_tensors_info_create (&info);
-  ASSERT_EQ (status, ML_ERROR_NONE);
-  status = ml_tensors_info_set_count (info, 1);
-  ASSERT_EQ (status, ML_ERROR_NONE);
-  status = ml_tensors_info_set_tensor_type (info, 0, ML_TENSOR_TYPE_UINT8);
-  ASSERT_EQ (status, ML_ERROR_NONE);
-  status = ml_tensors_info_set_tensor_dimension (info, 0, dim);
-  ASSERT_EQ (status, ML_ERROR_NONE);
-  status = ml_tensors_data_create (info, &data);
-  ASSERT_EQ (status, ML_ERROR_NONE);
+  status = ml_pipeline_construct (pipeline, NULL, NULL, &handle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_tensors_data_set_tensor_data (data, 0, raw_data, 0);
+  /* invalid param : wrong name */
+  status = ml_pipeline_switch_get_handle (handle, "wrongname", &type, &switchhandle);
   EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
 
-  status = ml_tensors_data_destroy (data);
-  ASSERT_EQ (status, ML_ERROR_NONE);
-  status = ml_tensors_info_destroy (info);
-  ASSERT_EQ (status, ML_ERROR_NONE);
-  g_free (raw_data);
+  status = ml_pipeline_destroy (handle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  g_free (pipeline);
 }
 
 /**
- * @brief Test utility functions (public)
+ * @brief Test NNStreamer pipeline switch
+ * @detail Failure case to handle input-selector element with invalid param.
  */
-TEST (nnstreamer_capi_util, data_set_tdata_05_n)
+TEST (nnstreamer_capi_switch, failure_04_n)
 {
+  ml_pipeline_h handle;
+  ml_pipeline_switch_h switchhandle;
+  ml_pipeline_switch_e type;
+  gchar *pipeline;
   int status;
-  void *raw_data;
-  ml_tensors_info_h info;
-  ml_tensors_data_h data;
-  ml_tensor_dimension dim = { 2, 2, 2, 2 };
 
-  raw_data = g_malloc (1024); /* larger than tensor */
+  pipeline = g_strdup ("input-selector name=ins ! tensor_converter ! tensor_sink name=sinkx "
+                       "videotestsrc is-live=true ! videoconvert ! ins.sink_0 "
+                       "videotestsrc num-buffers=3 ! videoconvert ! ins.sink_1");
 
-  status = ml_tensors_info_create (&info);
-  ASSERT_EQ (status, ML_ERROR_NONE);
-  status = ml_tensors_info_set_count (info, 1);
-  ASSERT_EQ (status, ML_ERROR_NONE);
-  status = ml_tensors_info_set_tensor_type (info, 0, ML_TENSOR_TYPE_UINT8);
-  ASSERT_EQ (status, ML_ERROR_NONE);
-  status = ml_tensors_info_set_tensor_dimension (info, 0, dim);
-  ASSERT_EQ (status, ML_ERROR_NONE);
-  status = ml_tensors_data_create (info, &data);
-  ASSERT_EQ (status, ML_ERROR_NONE);
+  status = ml_pipeline_construct (pipeline, NULL, NULL, &handle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_tensors_data_set_tensor_data (data, 0, raw_data, 1024);
+  /* invalid param : invalid type */
+  status = ml_pipeline_switch_get_handle (handle, "sinkx", &type, &switchhandle);
   EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
 
-  status = ml_tensors_data_destroy (data);
-  ASSERT_EQ (status, ML_ERROR_NONE);
-  status = ml_tensors_info_destroy (info);
-  ASSERT_EQ (status, ML_ERROR_NONE);
-  g_free (raw_data);
-}
+  status = ml_pipeline_destroy (handle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-/**
- * @brief Test utility functions (private)
- * @details check sub-plugin type and name
- */
-TEST (nnstreamer_capi_util, nnfw_name_01_p)
-{
-  EXPECT_STREQ (_ml_get_nnfw_subplugin_name (ML_NNFW_TYPE_TENSORFLOW_LITE), "tensorflow-lite");
-  EXPECT_EQ (_ml_get_nnfw_type_by_subplugin_name ("tensorflow-lite"), ML_NNFW_TYPE_TENSORFLOW_LITE);
-  EXPECT_STREQ (_ml_get_nnfw_subplugin_name (ML_NNFW_TYPE_TENSORFLOW), "tensorflow");
-  EXPECT_EQ (_ml_get_nnfw_type_by_subplugin_name ("tensorflow"), ML_NNFW_TYPE_TENSORFLOW);
-  EXPECT_STREQ (_ml_get_nnfw_subplugin_name (ML_NNFW_TYPE_NNFW), "nnfw");
-  EXPECT_EQ (_ml_get_nnfw_type_by_subplugin_name ("nnfw"), ML_NNFW_TYPE_NNFW);
-  EXPECT_STREQ (_ml_get_nnfw_subplugin_name (ML_NNFW_TYPE_VIVANTE), "vivante");
-  EXPECT_EQ (_ml_get_nnfw_type_by_subplugin_name ("vivante"), ML_NNFW_TYPE_VIVANTE);
-  EXPECT_STREQ (_ml_get_nnfw_subplugin_name (ML_NNFW_TYPE_SNAP), "snap");
-  EXPECT_EQ (_ml_get_nnfw_type_by_subplugin_name ("snap"), ML_NNFW_TYPE_SNAP);
+  g_free (pipeline);
 }
 
 /**
- * @brief Test utility functions (private)
- * @details check sub-plugin type and name
+ * @brief Test NNStreamer pipeline switch
+ * @detail Failure case to handle input-selector element with invalid param.
  */
-TEST (nnstreamer_capi_util, nnfw_name_02_n)
+TEST (nnstreamer_capi_switch, failure_05_n)
 {
-  EXPECT_EQ (_ml_get_nnfw_type_by_subplugin_name ("invalid-fw"), ML_NNFW_TYPE_ANY);
-  EXPECT_EQ (_ml_get_nnfw_type_by_subplugin_name (NULL), ML_NNFW_TYPE_ANY);
+  ml_pipeline_h handle;
+  ml_pipeline_switch_e type;
+  gchar *pipeline;
+  int status;
+
+  pipeline = g_strdup ("input-selector name=ins ! tensor_converter ! tensor_sink name=sinkx "
+                       "videotestsrc is-live=true ! videoconvert ! ins.sink_0 "
+                       "videotestsrc num-buffers=3 ! videoconvert ! ins.sink_1");
+
+  status = ml_pipeline_construct (pipeline, NULL, NULL, &handle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  /* invalid param : handle */
+  status = ml_pipeline_switch_get_handle (handle, "ins", &type, NULL);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  status = ml_pipeline_destroy (handle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  g_free (pipeline);
 }
 
 /**
- * @brief Test NNStreamer single shot (tensorflow-lite)
+ * @brief Test NNStreamer pipeline switch
+ * @detail Failure case to handle input-selector element with invalid param.
  */
-TEST (nnstreamer_capi_singleshot, invoke_invalid_param_01_n)
+TEST (nnstreamer_capi_switch, failure_06_n)
 {
-  ml_single_h single;
+  ml_pipeline_h handle;
+  ml_pipeline_switch_h switchhandle;
+  gchar *pipeline;
   int status;
-  ml_tensors_info_h in_info;
-  ml_tensors_data_h input, output;
 
-  const gchar *root_path = g_getenv ("NNSTREAMER_SOURCE_ROOT_PATH");
-  gchar *test_model;
+  pipeline = g_strdup ("input-selector name=ins ! tensor_converter ! tensor_sink name=sinkx "
+                       "videotestsrc is-live=true ! videoconvert ! ins.sink_0 "
+                       "videotestsrc num-buffers=3 ! videoconvert ! ins.sink_1");
 
-  /* supposed to run test in build directory */
-  if (root_path == NULL)
-    root_path = "..";
+  status = ml_pipeline_construct (pipeline, NULL, NULL, &handle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-  test_model = g_build_filename (root_path, "tests", "test_models", "models",
-      "mobilenet_v1_1.0_224_quant.tflite", NULL);
-  ASSERT_TRUE (g_file_test (test_model, G_FILE_TEST_EXISTS));
+  /* succesfully get switch handle if the param type is null */
+  status = ml_pipeline_switch_get_handle (handle, "ins", NULL, &switchhandle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_single_open (&single, test_model, NULL, NULL,
-      ML_NNFW_TYPE_TENSORFLOW_LITE, ML_NNFW_HW_ANY);
-  if (is_enabled_tensorflow_lite) {
-    EXPECT_EQ (status, ML_ERROR_NONE);
-  } else {
-    EXPECT_NE (status, ML_ERROR_NONE);
-    goto skip_test;
-  }
+  /* invalid param : handle */
+  status = ml_pipeline_switch_select (NULL, "invalidpadname");
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
 
-  status = ml_single_get_input_info (single, &in_info);
+  status = ml_pipeline_switch_release_handle (switchhandle);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_tensors_data_create (in_info, &input);
+  status = ml_pipeline_destroy (handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_single_invoke (NULL, input, &output);
-  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+  g_free (pipeline);
+}
 
-  status = ml_single_invoke (single, NULL, &output);
-  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+/**
+ * @brief Test NNStreamer pipeline switch
+ * @detail Failure case to handle input-selector element with invalid param.
+ */
+TEST (nnstreamer_capi_switch, failure_07_n)
+{
+  ml_pipeline_h handle;
+  ml_pipeline_switch_h switchhandle;
+  gchar *pipeline;
+  int status;
 
-  status = ml_single_invoke (single, input, NULL);
+  pipeline = g_strdup ("input-selector name=ins ! tensor_converter ! tensor_sink name=sinkx "
+                       "videotestsrc is-live=true ! videoconvert ! ins.sink_0 "
+                       "videotestsrc num-buffers=3 ! videoconvert ! ins.sink_1");
+
+  status = ml_pipeline_construct (pipeline, NULL, NULL, &handle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  /* succesfully get switch handle if the param type is null */
+  status = ml_pipeline_switch_get_handle (handle, "ins", NULL, &switchhandle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  /* invalid param : pad name */
+  status = ml_pipeline_switch_select (switchhandle, NULL);
   EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
 
-  status = ml_single_close (single);
+  status = ml_pipeline_switch_release_handle (switchhandle);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  ml_tensors_data_destroy (input);
-  ml_tensors_info_destroy (in_info);
+  status = ml_pipeline_destroy (handle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-skip_test:
-  g_free (test_model);
+  g_free (pipeline);
 }
 
 /**
- * @brief Test NNStreamer single shot (tensorflow-lite)
+ * @brief Test NNStreamer pipeline switch
+ * @detail Failure case to handle input-selector element with invalid param.
  */
-TEST (nnstreamer_capi_singleshot, invoke_invalid_param_02_n)
+TEST (nnstreamer_capi_switch, failure_08_n)
 {
-  ml_single_h single;
+  ml_pipeline_h handle;
+  ml_pipeline_switch_h switchhandle;
+  gchar *pipeline;
   int status;
-  ml_tensors_info_h in_info;
-  ml_tensors_data_h input, output;
-  ml_tensor_dimension in_dim;
-
-  const gchar *root_path = g_getenv ("NNSTREAMER_SOURCE_ROOT_PATH");
-  gchar *test_model;
 
-  /* supposed to run test in build directory */
-  if (root_path == NULL)
-    root_path = "..";
+  pipeline = g_strdup ("input-selector name=ins ! tensor_converter ! tensor_sink name=sinkx "
+                       "videotestsrc is-live=true ! videoconvert ! ins.sink_0 "
+                       "videotestsrc num-buffers=3 ! videoconvert ! ins.sink_1");
 
-  test_model = g_build_filename (root_path, "tests", "test_models", "models",
-      "mobilenet_v1_1.0_224_quant.tflite", NULL);
-  ASSERT_TRUE (g_file_test (test_model, G_FILE_TEST_EXISTS));
+  status = ml_pipeline_construct (pipeline, NULL, NULL, &handle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_single_open (&single, test_model, NULL, NULL,
-      ML_NNFW_TYPE_TENSORFLOW_LITE, ML_NNFW_HW_ANY);
-  if (is_enabled_tensorflow_lite) {
-    EXPECT_EQ (status, ML_ERROR_NONE);
-  } else {
-    EXPECT_NE (status, ML_ERROR_NONE);
-    goto skip_test;
-  }
+  /* succesfully get switch handle if the param type is null */
+  status = ml_pipeline_switch_get_handle (handle, "ins", NULL, &switchhandle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-  ml_tensors_info_create (&in_info);
+  /* invalid param : wrong pad name */
+  status = ml_pipeline_switch_select (switchhandle, "wrongpadname");
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
 
-  in_dim[0] = 3;
-  in_dim[1] = 224;
-  in_dim[2] = 224;
-  in_dim[3] = 1;
-  ml_tensors_info_set_count (in_info, 1);
-  ml_tensors_info_set_tensor_type (in_info, 0, ML_TENSOR_TYPE_UINT8);
-  ml_tensors_info_set_tensor_dimension (in_info, 0, in_dim);
+  status = ml_pipeline_switch_release_handle (switchhandle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-  /* handle null data */
-  status = _ml_tensors_data_create_no_alloc (in_info, &input);
+  status = ml_pipeline_destroy (handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_single_invoke (single, input, &output);
-  EXPECT_NE (status, ML_ERROR_NONE);
+  g_free (pipeline);
+}
 
-  ml_tensors_data_destroy (input);
+/**
+ * @brief Test NNStreamer Utility for checking plugin availability (invalid param)
+ */
+TEST (nnstreamer_capi_util, plugin_availability_fail_invalid_01_n)
+{
+  int status;
 
-  /* set invalid type to test wrong data size */
-  ml_tensors_info_set_tensor_type (in_info, 0, ML_TENSOR_TYPE_UINT32);
+  status = _ml_check_plugin_availability (NULL, "tensor_filter");
+  EXPECT_NE (status, ML_ERROR_NONE);
+}
 
-  status = ml_tensors_data_create (in_info, &input);
-  EXPECT_EQ (status, ML_ERROR_NONE);
+/**
+ * @brief Test NNStreamer Utility for checking plugin availability (invalid param)
+ */
+TEST (nnstreamer_capi_util, plugin_availability_fail_invalid_02_n)
+{
+  int status;
 
-  status = ml_single_invoke (single, input, &output);
+  status = _ml_check_plugin_availability (NULL, "tensor_filter");
   EXPECT_NE (status, ML_ERROR_NONE);
+}
 
-  ml_tensors_info_set_tensor_type (in_info, 0, ML_TENSOR_TYPE_UINT8);
-  ml_tensors_data_destroy (input);
-
-  /* set invalid input tensor number */
-  ml_tensors_info_set_count (in_info, 2);
-  ml_tensors_info_set_tensor_type (in_info, 1, ML_TENSOR_TYPE_UINT8);
-  ml_tensors_info_set_tensor_dimension (in_info, 1, in_dim);
+/**
+ * @brief Test NNStreamer Utility for checking nnfw availability with custom option
+ */
+TEST (nnstreamer_capi_util, nnfw_availability_full_01)
+{
+  int status;
+  bool result;
 
-  status = ml_tensors_data_create (in_info, &input);
+  status = ml_check_nnfw_availability_full (ML_NNFW_TYPE_TENSORFLOW_LITE, ML_NNFW_HW_ANY, NULL, &result);
   EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (result, is_enabled_tensorflow_lite);
+}
 
-  status = ml_single_invoke (single, input, &output);
+/**
+ * @brief Test NNStreamer Utility for checking nnfw availability with custom option (invalid param)
+ */
+TEST (nnstreamer_capi_util, nnfw_availability_full_02_n)
+{
+  int status;
+
+  status = ml_check_nnfw_availability_full (ML_NNFW_TYPE_TENSORFLOW_LITE, ML_NNFW_HW_ANY, NULL, NULL);
   EXPECT_NE (status, ML_ERROR_NONE);
+}
 
-  ml_tensors_data_destroy (input);
-  ml_tensors_info_destroy (in_info);
+/**
+ * @brief Test NNStreamer Utility for checking nnfw availability (invalid param)
+ */
+TEST (nnstreamer_capi_util, nnfw_availability_fail_invalid_01_n)
+{
+  int status;
 
-skip_test:
-  g_free (test_model);
+  status = ml_check_nnfw_availability (ML_NNFW_TYPE_TENSORFLOW_LITE, ML_NNFW_HW_ANY, NULL);
+  EXPECT_NE (status, ML_ERROR_NONE);
 }
 
 /**
- * @brief Test NNStreamer single shot (tensorflow-lite)
+ * @brief Test NNStreamer Utility for checking nnfw availability (invalid param)
  */
-TEST (nnstreamer_capi_singleshot, invoke_01)
+TEST (nnstreamer_capi_util, nnfw_availability_fail_invalid_02_n)
 {
-  ml_single_h single;
-  ml_tensors_info_h in_info, out_info;
-  ml_tensors_info_h in_res, out_res;
-  ml_tensors_data_h input, output;
-  ml_tensor_dimension in_dim, out_dim, res_dim;
-  ml_tensor_type_e type = ML_TENSOR_TYPE_UNKNOWN;
-  unsigned int count = 0;
-  char *name = NULL;
+  bool result;
   int status;
 
-  const gchar *root_path = g_getenv ("NNSTREAMER_SOURCE_ROOT_PATH");
-  gchar *test_model;
+  /* any is unknown nnfw type */
+  status = ml_check_nnfw_availability (ML_NNFW_TYPE_ANY, ML_NNFW_HW_ANY, &result);
+  EXPECT_NE (status, ML_ERROR_NONE);
+}
 
-  /* supposed to run test in build directory */
-  if (root_path == NULL)
-    root_path = "..";
+/**
+ * @brief Test NNStreamer Utility for checking availability of Tensorflow-lite backend
+ */
+TEST (nnstreamer_capi_util, availability_01)
+{
+  bool result;
+  int status;
 
-  test_model = g_build_filename (root_path, "tests", "test_models", "models",
-      "mobilenet_v1_1.0_224_quant.tflite", NULL);
-  ASSERT_TRUE (g_file_test (test_model, G_FILE_TEST_EXISTS));
-
-  ml_tensors_info_create (&in_info);
-  ml_tensors_info_create (&out_info);
-
-  in_dim[0] = 3;
-  in_dim[1] = 224;
-  in_dim[2] = 224;
-  in_dim[3] = 1;
-  ml_tensors_info_set_count (in_info, 1);
-  ml_tensors_info_set_tensor_type (in_info, 0, ML_TENSOR_TYPE_UINT8);
-  ml_tensors_info_set_tensor_dimension (in_info, 0, in_dim);
+  status = ml_check_nnfw_availability (ML_NNFW_TYPE_TENSORFLOW_LITE,
+      ML_NNFW_HW_ANY, &result);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (result, is_enabled_tensorflow_lite);
 
-  out_dim[0] = 1001;
-  out_dim[1] = 1;
-  out_dim[2] = 1;
-  out_dim[3] = 1;
-  ml_tensors_info_set_count (out_info, 1);
-  ml_tensors_info_set_tensor_type (out_info, 0, ML_TENSOR_TYPE_UINT8);
-  ml_tensors_info_set_tensor_dimension (out_info, 0, out_dim);
+  status = ml_check_nnfw_availability (ML_NNFW_TYPE_TENSORFLOW_LITE,
+      ML_NNFW_HW_AUTO, &result);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (result, is_enabled_tensorflow_lite);
 
-  status = ml_single_open (&single, test_model, in_info, out_info,
-      ML_NNFW_TYPE_TENSORFLOW_LITE, ML_NNFW_HW_ANY);
-  if (is_enabled_tensorflow_lite) {
-    EXPECT_EQ (status, ML_ERROR_NONE);
-  } else {
-    EXPECT_NE (status, ML_ERROR_NONE);
-    goto skip_test;
-  }
+  status = ml_check_nnfw_availability (ML_NNFW_TYPE_TENSORFLOW_LITE,
+      ML_NNFW_HW_CPU, &result);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (result, is_enabled_tensorflow_lite);
 
-  /* input tensor in filter */
-  status = ml_single_get_input_info (single, &in_res);
+  status = ml_check_nnfw_availability (ML_NNFW_TYPE_TENSORFLOW_LITE,
+      ML_NNFW_HW_CPU_NEON, &result);
   EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (result, is_enabled_tensorflow_lite);
 
-  status = ml_tensors_info_get_count (in_res, &count);
+  status = ml_check_nnfw_availability (ML_NNFW_TYPE_TENSORFLOW_LITE,
+      ML_NNFW_HW_CPU_SIMD, &result);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (count, 1U);
+  EXPECT_EQ (result, is_enabled_tensorflow_lite);
 
-  status = ml_tensors_info_get_tensor_name (in_res, 0, &name);
+  status = ml_check_nnfw_availability (ML_NNFW_TYPE_TENSORFLOW_LITE,
+      ML_NNFW_HW_GPU, &result);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  g_free (name);
+  EXPECT_EQ (result, is_enabled_tensorflow_lite);
 
-  status = ml_tensors_info_get_tensor_type (in_res, 0, &type);
+  status = ml_check_nnfw_availability (ML_NNFW_TYPE_TENSORFLOW_LITE,
+      ML_NNFW_HW_NPU, &result);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (type, ML_TENSOR_TYPE_UINT8);
+  EXPECT_EQ (result, is_enabled_tensorflow_lite);
+}
 
-  ml_tensors_info_get_tensor_dimension (in_res, 0, res_dim);
-  EXPECT_TRUE (in_dim[0] == res_dim[0]);
-  EXPECT_TRUE (in_dim[1] == res_dim[1]);
-  EXPECT_TRUE (in_dim[2] == res_dim[2]);
-  EXPECT_TRUE (in_dim[3] == res_dim[3]);
+/**
+ * @brief Test NNStreamer Utility for checking availability of Tensorflow-lite backend
+ */
+TEST (nnstreamer_capi_util, availability_fail_01_n)
+{
+  bool result;
+  int status;
 
-  /* output tensor in filter */
-  status = ml_single_get_output_info (single, &out_res);
+  status = ml_check_nnfw_availability (ML_NNFW_TYPE_TENSORFLOW_LITE,
+      ML_NNFW_HW_NPU_MOVIDIUS, &result);
   EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (result, false);
 
-  status = ml_tensors_info_get_count (out_res, &count);
+  status = ml_check_nnfw_availability (ML_NNFW_TYPE_TENSORFLOW_LITE,
+      ML_NNFW_HW_NPU_EDGE_TPU, &result);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (count, 1U);
+  EXPECT_EQ (result, false);
 
-  status = ml_tensors_info_get_tensor_name (out_res, 0, &name);
+  status = ml_check_nnfw_availability (ML_NNFW_TYPE_TENSORFLOW_LITE,
+      ML_NNFW_HW_NPU_VIVANTE, &result);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  g_free (name);
+  EXPECT_EQ (result, false);
 
-  status = ml_tensors_info_get_tensor_type (out_res, 0, &type);
+  status = ml_check_nnfw_availability (ML_NNFW_TYPE_TENSORFLOW_LITE,
+      ML_NNFW_HW_NPU_SR, &result);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (type, ML_TENSOR_TYPE_UINT8);
+  EXPECT_EQ (result, false);
+}
 
-  ml_tensors_info_get_tensor_dimension (out_res, 0, res_dim);
-  EXPECT_TRUE (out_dim[0] == res_dim[0]);
-  EXPECT_TRUE (out_dim[1] == res_dim[1]);
-  EXPECT_TRUE (out_dim[2] == res_dim[2]);
-  EXPECT_TRUE (out_dim[3] == res_dim[3]);
+#ifdef ENABLE_TENSORFLOW
+/**
+ * @brief Test NNStreamer Utility for checking availability of Tensorflow backend
+ */
+TEST (nnstreamer_capi_util, availability_02)
+{
+  bool result;
+  int status;
 
-  input = output = NULL;
+  status = ml_check_nnfw_availability (ML_NNFW_TYPE_TENSORFLOW,
+      ML_NNFW_HW_ANY, &result);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (result, true);
 
-  /* generate dummy data */
-  status = ml_tensors_data_create (in_info, &input);
+  status = ml_check_nnfw_availability (ML_NNFW_TYPE_TENSORFLOW,
+      ML_NNFW_HW_AUTO, &result);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_TRUE (input != NULL);
+  EXPECT_EQ (result, true);
+}
 
-  status = ml_single_set_timeout (single, SINGLE_DEF_TIMEOUT_MSEC);
-  EXPECT_TRUE (status == ML_ERROR_NOT_SUPPORTED || status == ML_ERROR_NONE);
+/**
+ * @brief Test NNStreamer Utility for checking availability of Tensorflow backend
+ */
+TEST (nnstreamer_capi_util, availability_fail_02_n)
+{
+  bool result;
+  int status;
 
-  status = ml_single_invoke (single, input, &output);
+  status = ml_check_nnfw_availability (ML_NNFW_TYPE_TENSORFLOW,
+      ML_NNFW_HW_NPU_VIVANTE, &result);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_TRUE (output != NULL);
+  EXPECT_EQ (result, false);
 
-  status = ml_single_close (single);
+  status = ml_check_nnfw_availability (ML_NNFW_TYPE_TENSORFLOW,
+      ML_NNFW_HW_NPU_MOVIDIUS, &result);
   EXPECT_EQ (status, ML_ERROR_NONE);
-
-  ml_tensors_data_destroy (output);
-  ml_tensors_data_destroy (input);
-  ml_tensors_info_destroy (in_res);
-  ml_tensors_info_destroy (out_res);
-
-skip_test:
-  g_free (test_model);
-  ml_tensors_info_destroy (in_info);
-  ml_tensors_info_destroy (out_info);
+  EXPECT_EQ (result, false);
 }
+#endif /* ENABLE_TENSORFLOW */
 
 /**
- * @brief Test NNStreamer single shot (tensorflow-lite)
- * @detail Start pipeline without tensor info
+ * @brief Test NNStreamer Utility for checking availability of custom backend
  */
-TEST (nnstreamer_capi_singleshot, invoke_02)
+TEST (nnstreamer_capi_util, availability_03)
 {
-  ml_single_h single;
-  ml_tensors_info_h in_info;
-  ml_tensors_data_h input, output;
+  bool result;
   int status;
 
-  const gchar *root_path = g_getenv ("NNSTREAMER_SOURCE_ROOT_PATH");
-  gchar *test_model;
+  status = ml_check_nnfw_availability (ML_NNFW_TYPE_CUSTOM_FILTER,
+      ML_NNFW_HW_ANY, &result);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (result, true);
 
-  /* supposed to run test in build directory */
-  if (root_path == NULL)
-    root_path = "..";
+  status = ml_check_nnfw_availability (ML_NNFW_TYPE_CUSTOM_FILTER,
+      ML_NNFW_HW_AUTO, &result);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (result, true);
+}
 
-  test_model = g_build_filename (root_path, "tests", "test_models", "models",
-      "mobilenet_v1_1.0_224_quant.tflite", NULL);
-  ASSERT_TRUE (g_file_test (test_model, G_FILE_TEST_EXISTS));
+/**
+ * @brief Test NNStreamer Utility for checking availability of custom backend
+ */
+TEST (nnstreamer_capi_util, availability_fail_03_n)
+{
+  bool result;
+  int status;
 
-  status = ml_single_open (&single, test_model, NULL, NULL,
-      ML_NNFW_TYPE_TENSORFLOW_LITE, ML_NNFW_HW_ANY);
-  if (is_enabled_tensorflow_lite) {
-    EXPECT_EQ (status, ML_ERROR_NONE);
-  } else {
-    EXPECT_NE (status, ML_ERROR_NONE);
-    goto skip_test;
-  }
+  status = ml_check_nnfw_availability (ML_NNFW_TYPE_CUSTOM_FILTER,
+      ML_NNFW_HW_CPU, &result);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (result, false);
 
-  status = ml_single_get_input_info (single, &in_info);
+  status = ml_check_nnfw_availability (ML_NNFW_TYPE_CUSTOM_FILTER,
+      ML_NNFW_HW_GPU, &result);
   EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (result, false);
+}
 
-  input = output = NULL;
+#ifdef ENABLE_NNFW_RUNTIME
+/**
+ * @brief Test NNStreamer Utility for checking availability of NNFW
+ */
+TEST (nnstreamer_capi_util, availability_04)
+{
+  bool result;
+  int status;
 
-  /* generate dummy data */
-  status = ml_tensors_data_create (in_info, &input);
+  status = ml_check_nnfw_availability (ML_NNFW_TYPE_NNFW, ML_NNFW_HW_ANY, &result);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_TRUE (input != NULL);
+  EXPECT_EQ (result, true);
 
-  status = ml_single_set_timeout (single, SINGLE_DEF_TIMEOUT_MSEC);
-  EXPECT_TRUE (status == ML_ERROR_NOT_SUPPORTED || status == ML_ERROR_NONE);
+  status = ml_check_nnfw_availability (ML_NNFW_TYPE_NNFW, ML_NNFW_HW_AUTO, &result);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (result, true);
 
-  status = ml_single_invoke (single, input, &output);
+  status = ml_check_nnfw_availability (ML_NNFW_TYPE_NNFW, ML_NNFW_HW_CPU, &result);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_TRUE (output != NULL);
+  EXPECT_EQ (result, true);
 
-  status = ml_single_close (single);
+  status = ml_check_nnfw_availability (ML_NNFW_TYPE_NNFW, ML_NNFW_HW_GPU, &result);
   EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (result, true);
 
-  ml_tensors_data_destroy (output);
-  ml_tensors_data_destroy (input);
-  ml_tensors_info_destroy (in_info);
-skip_test:
-  g_free (test_model);
+  status = ml_check_nnfw_availability (ML_NNFW_TYPE_NNFW, ML_NNFW_HW_NPU, &result);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (result, true);
 }
 
 /**
- * @brief Measure the loading time and total time for the run
+ * @brief Test NNStreamer Utility for checking availability of NNFW
  */
-static void
-benchmark_single (const gboolean no_alloc, const gboolean no_timeout, const int count)
+TEST (nnstreamer_capi_util, availability_fail_04_n)
 {
-  ml_single_h single;
-  ml_tensors_info_h in_info, out_info;
-  ml_tensors_data_h input, output;
-  ml_tensor_dimension in_dim, out_dim;
+  bool result;
   int status;
-  unsigned long open_duration = 0, invoke_duration = 0, close_duration = 0;
-  gint64 start, end;
-
-  const gchar *root_path = g_getenv ("NNSTREAMER_SOURCE_ROOT_PATH");
-  gchar *test_model;
 
-  /* supposed to run test in build directory */
-  if (root_path == NULL)
-    root_path = "..";
+  status = ml_check_nnfw_availability (ML_NNFW_TYPE_NNFW,
+      ML_NNFW_HW_NPU_SR, &result);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (result, false);
 
-  test_model = g_build_filename (root_path, "tests", "test_models", "models",
-      "mobilenet_v1_1.0_224_quant.tflite", NULL);
-  ASSERT_TRUE (g_file_test (test_model, G_FILE_TEST_EXISTS));
+  status = ml_check_nnfw_availability (ML_NNFW_TYPE_NNFW,
+      ML_NNFW_HW_NPU_MOVIDIUS, &result);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (result, false);
+}
+#endif /* ENABLE_NNFW_RUNTIME */
+
+#ifdef ENABLE_MOVIDIUS_NCSDK2
+/**
+ * @brief Test NNStreamer Utility for checking availability of NCSDK2
+ */
+TEST (nnstreamer_capi_util, availability_05)
+{
+  bool result;
+  int status;
+
+  status = ml_check_nnfw_availability (ML_NNFW_TYPE_MVNC,
+      ML_NNFW_HW_ANY, &result);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (result, true);
+
+  status = ml_check_nnfw_availability (ML_NNFW_TYPE_MVNC,
+      ML_NNFW_HW_AUTO, &result);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (result, true);
+
+  status = ml_check_nnfw_availability (ML_NNFW_TYPE_MVNC,
+      ML_NNFW_HW_NPU, &result);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (result, true);
+
+  status = ml_check_nnfw_availability (ML_NNFW_TYPE_MVNC,
+      ML_NNFW_HW_NPU_MOVIDIUS, &result);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (result, true);
+}
+
+/**
+ * @brief Test NNStreamer Utility for checking availability of NCSDK2
+ */
+TEST (nnstreamer_capi_util, availability_fail_05_n)
+{
+  bool result;
+  int status;
+
+  status = ml_check_nnfw_availability (ML_NNFW_TYPE_MVNC,
+      ML_NNFW_HW_CPU, &result);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (result, false);
+
+  status = ml_check_nnfw_availability (ML_NNFW_TYPE_MVNC,
+      ML_NNFW_HW_GPU, &result);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (result, false);
+}
+#endif /* ENABLE_MOVIDIUS_NCSDK2 */
+
+#ifdef ENABLE_ARMNN
+/**
+ * @brief Test NNStreamer Utility for checking availability of ARMNN
+ */
+TEST (nnstreamer_capi_util, availability_06)
+{
+  bool result;
+  int status;
+
+  status = ml_check_nnfw_availability (ML_NNFW_TYPE_ARMNN,
+      ML_NNFW_HW_ANY, &result);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (result, true);
+
+  status = ml_check_nnfw_availability (ML_NNFW_TYPE_ARMNN,
+      ML_NNFW_HW_AUTO, &result);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (result, true);
+
+  status = ml_check_nnfw_availability (ML_NNFW_TYPE_ARMNN,
+      ML_NNFW_HW_CPU, &result);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (result, true);
+
+  status = ml_check_nnfw_availability (ML_NNFW_TYPE_ARMNN,
+      ML_NNFW_HW_CPU_NEON, &result);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (result, true);
+
+  status = ml_check_nnfw_availability (ML_NNFW_TYPE_ARMNN,
+      ML_NNFW_HW_GPU, &result);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (result, true);
+}
+
+/**
+ * @brief Test NNStreamer Utility for checking availability of ARMNN
+ */
+TEST (nnstreamer_capi_util, availability_fail_06_n)
+{
+  bool result;
+  int status;
+
+  status = ml_check_nnfw_availability (ML_NNFW_TYPE_ARMNN,
+      ML_NNFW_HW_NPU, &result);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (result, false);
+
+  status = ml_check_nnfw_availability (ML_NNFW_TYPE_ARMNN,
+      ML_NNFW_HW_NPU_EDGE_TPU, &result);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (result, false);
+}
+#endif /** ENABLE_ARMNN */
+
+/**
+ * @brief Test NNStreamer Utility for checking an element availability
+ */
+TEST (nnstreamer_capi_util, element_available_01_p)
+{
+  bool available;
+  int status;
+
+  status = ml_check_element_availability ("tensor_converter", &available);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (available, true);
+
+  status = ml_check_element_availability ("tensor_filter", &available);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (available, true);
+
+  status = ml_check_element_availability ("appsrc", &available);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (available, true);
+}
+
+/**
+ * @brief Test NNStreamer Utility for checking an element availability (null param)
+ */
+TEST (nnstreamer_capi_util, element_available_02_n)
+{
+  bool available;
+  int status;
+
+  status = ml_check_element_availability (nullptr, &available);
+  EXPECT_NE (status, ML_ERROR_NONE);
+
+  status = ml_check_element_availability ("tensor_filter", nullptr);
+  EXPECT_NE (status, ML_ERROR_NONE);
+}
+
+/**
+ * @brief Test NNStreamer Utility for checking an element availability (invalid element name)
+ */
+TEST (nnstreamer_capi_util, element_available_03_n)
+{
+  bool available;
+  int status;
+
+  status = ml_check_element_availability ("invalid-elem", &available);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (available, false);
+}
+
+/**
+ * @brief Test NNStreamer Utility for checking tensors info handle
+ */
+TEST (nnstreamer_capi_util, tensors_info)
+{
+  ml_tensors_info_h info;
+  ml_tensor_dimension in_dim, out_dim;
+  ml_tensor_type_e out_type;
+  gchar *out_name;
+  size_t data_size;
+  int status;
+
+  status = ml_tensors_info_create (&info);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  in_dim[0] = 3;
+  in_dim[1] = 300;
+  in_dim[2] = 300;
+  in_dim[3] = 1;
+
+  /* add tensor info */
+  status = ml_tensors_info_set_count (info, 2);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_tensors_info_set_tensor_type (info, 0, ML_TENSOR_TYPE_UINT8);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_info_set_tensor_dimension (info, 0, in_dim);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_tensors_info_set_tensor_type (info, 1, ML_TENSOR_TYPE_FLOAT64);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_info_set_tensor_dimension (info, 1, in_dim);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_info_set_tensor_name (info, 1, "tensor-name-test");
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_tensors_info_set_tensor_type (info, 2, ML_TENSOR_TYPE_UINT64);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+  status = ml_tensors_info_set_tensor_dimension (info, 2, in_dim);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  /* get tensor info */
+  status = ml_tensors_info_get_tensor_type (info, 0, &out_type);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (out_type, ML_TENSOR_TYPE_UINT8);
+
+  status = ml_tensors_info_get_tensor_dimension (info, 0, out_dim);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (out_dim[0], 3U);
+  EXPECT_EQ (out_dim[1], 300U);
+  EXPECT_EQ (out_dim[2], 300U);
+  EXPECT_EQ (out_dim[3], 1U);
+
+  status = ml_tensors_info_get_tensor_name (info, 0, &out_name);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_TRUE (out_name == NULL);
+
+  status = ml_tensors_info_get_tensor_type (info, 1, &out_type);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (out_type, ML_TENSOR_TYPE_FLOAT64);
+
+  status = ml_tensors_info_get_tensor_dimension (info, 1, out_dim);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (out_dim[0], 3U);
+  EXPECT_EQ (out_dim[1], 300U);
+  EXPECT_EQ (out_dim[2], 300U);
+  EXPECT_EQ (out_dim[3], 1U);
+
+  status = ml_tensors_info_get_tensor_name (info, 1, &out_name);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_TRUE (out_name && g_str_equal (out_name, "tensor-name-test"));
+  g_free (out_name);
+
+  status = ml_tensors_info_get_tensor_type (info, 2, &out_type);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  status = ml_tensors_info_get_tensor_dimension (info, 2, out_dim);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  status = ml_tensors_info_get_tensor_name (info, 2, &out_name);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  /* get tensor size */
+  status = ml_tensors_info_get_tensor_size (info, 0, &data_size);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_TRUE (data_size == (3 * 300 * 300));
+
+  status = ml_tensors_info_get_tensor_size (info, 1, &data_size);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_TRUE (data_size == (3 * 300 * 300 * 8));
+
+  status = ml_tensors_info_get_tensor_size (info, -1, &data_size);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_TRUE (data_size == ((3 * 300 * 300) + (3 * 300 * 300 * 8)));
+
+  status = ml_tensors_info_get_tensor_size (info, 2, &data_size);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  status = ml_tensors_info_destroy (info);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+}
+
+/**
+ * @brief Test utility functions
+ */
+TEST (nnstreamer_capi_util, compare_info)
+{
+  ml_tensors_info_h info1, info2;
+  ml_tensor_dimension dim;
+  int status;
+
+  status = ml_tensors_info_create (&info1);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_tensors_info_create (&info2);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  dim[0] = 3;
+  dim[1] = 4;
+  dim[2] = 4;
+  dim[3] = 1;
+
+  ml_tensors_info_set_count (info1, 1);
+  ml_tensors_info_set_tensor_type (info1, 0, ML_TENSOR_TYPE_UINT8);
+  ml_tensors_info_set_tensor_dimension (info1, 0, dim);
+
+  ml_tensors_info_set_count (info2, 1);
+  ml_tensors_info_set_tensor_type (info2, 0, ML_TENSOR_TYPE_UINT8);
+  ml_tensors_info_set_tensor_dimension (info2, 0, dim);
+
+  /* compare info */
+  EXPECT_TRUE (ml_tensors_info_is_equal (info1, info2));
+
+  /* change type */
+  ml_tensors_info_set_tensor_type (info2, 0, ML_TENSOR_TYPE_UINT16);
+  EXPECT_FALSE (ml_tensors_info_is_equal (info1, info2));
+
+  /* validate info */
+  EXPECT_TRUE (ml_tensors_info_is_valid (info2));
+
+  /* validate invalid dimension */
+  dim[3] = 0;
+  ml_tensors_info_set_tensor_dimension (info2, 0, dim);
+  EXPECT_FALSE (ml_tensors_info_is_valid (info2));
+
+  status = ml_tensors_info_destroy (info1);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_tensors_info_destroy (info2);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+}
+
+/**
+ * @brief Test utility functions (public)
+ */
+TEST (nnstreamer_capi_util, info_create_1_n)
+{
+  int status = ml_tensors_info_create (nullptr);
+  ASSERT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+}
+
+/**
+ * @brief Test utility functions (internal)
+ */
+TEST (nnstreamer_capi_util, info_create_2_n)
+{
+  ml_tensors_info_h i;
+  int status = _ml_tensors_info_create_from_gst (&i, nullptr);
+  ASSERT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+}
+
+/**
+ * @brief Test utility functions (internal)
+ */
+TEST (nnstreamer_capi_util, info_create_3_n)
+{
+  GstTensorsInfo gi;
+  int status = _ml_tensors_info_create_from_gst (nullptr, &gi);
+  ASSERT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+}
+
+/**
+ * @brief Test utility functions (public)
+ */
+TEST (nnstreamer_capi_util, info_destroy_n)
+{
+  int status = ml_tensors_info_destroy (nullptr);
+  ASSERT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+}
+
+/**
+ * @brief Test utility functions (public)
+ * @details Destroy the handles of tensors info and data twice.
+ */
+TEST (nnstreamer_capi_util, destroy_twice_n)
+{
+  ml_tensors_info_h info;
+  ml_tensors_data_h data;
+  ml_tensor_dimension dim = { 4, 1, 1, 1 };
+  int status;
+
+  /* the released handle is kept in the cache, so it is still valid memory */
+  status = ml_tensors_info_create (&info);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_info_destroy (info);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_info_destroy (info);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  ml_tensors_info_create (&info);
+  ml_tensors_info_set_count (info, 1);
+  ml_tensors_info_set_tensor_type (info, 0, ML_TENSOR_TYPE_UINT8);
+  ml_tensors_info_set_tensor_dimension (info, 0, dim);
+
+  status = ml_tensors_data_create (info, &data);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_data_destroy (data);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_data_destroy (data);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  ml_tensors_info_destroy (info);
+}
+
+/**
+ * @brief Test utility functions (internal)
+ */
+TEST (nnstreamer_capi_util, info_init_n)
+{
+  int status = _ml_tensors_info_initialize (nullptr);
+  ASSERT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+}
+
+/**
+ * @brief Test utility functions (public)
+ */
+TEST (nnstreamer_capi_util, info_valid_01_n)
+{
+  bool valid;
+  int status = ml_tensors_info_validate (nullptr, &valid);
+  ASSERT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+}
+
+/**
+ * @brief Test utility functions (public)
+ */
+TEST (nnstreamer_capi_util, info_valid_02_n)
+{
+  ml_tensors_info_h info;
+  ml_tensor_dimension dim = { 2, 2, 2, 2 };
+  int status;
+
+  status = ml_tensors_info_create (&info);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  ml_tensors_info_set_count (info, 1);
+  ml_tensors_info_set_tensor_type (info, 0, ML_TENSOR_TYPE_UINT8);
+  ml_tensors_info_set_tensor_dimension (info, 0, dim);
+
+  status = ml_tensors_info_validate (info, nullptr);
+  ASSERT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  status = ml_tensors_info_destroy (info);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+}
+
+/**
+ * @brief Test utility functions (internal)
+ */
+TEST (nnstreamer_capi_util, info_comp_01_n)
+{
+  ml_tensors_info_h info;
+  ml_tensor_dimension dim = { 2, 2, 2, 2 };
+  bool equal;
+  int status;
+
+  status = ml_tensors_info_create (&info);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  ml_tensors_info_set_count (info, 1);
+  ml_tensors_info_set_tensor_type (info, 0, ML_TENSOR_TYPE_UINT8);
+  ml_tensors_info_set_tensor_dimension (info, 0, dim);
+
+  status = _ml_tensors_info_compare (nullptr, info, &equal);
+  ASSERT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  status = ml_tensors_info_destroy (info);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+}
+
+/**
+ * @brief Test utility functions (internal)
+ */
+TEST (nnstreamer_capi_util, info_comp_02_n)
+{
+  ml_tensors_info_h info;
+  ml_tensor_dimension dim = { 2, 2, 2, 2 };
+
+  bool equal;
+  int status;
+
+  status = ml_tensors_info_create (&info);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  ml_tensors_info_set_count (info, 1);
+  ml_tensors_info_set_tensor_type (info, 0, ML_TENSOR_TYPE_UINT8);
+  ml_tensors_info_set_tensor_dimension (info, 0, dim);
+
+  status = _ml_tensors_info_compare (info, nullptr, &equal);
+  ASSERT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  status = ml_tensors_info_destroy (info);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+}
+
+/**
+ * @brief Test utility functions (internal)
+ */
+TEST (nnstreamer_capi_util, info_comp_03_n)
+{
+  ml_tensors_info_h info1, info2;
+  ml_tensor_dimension dim = { 2, 2, 2, 2 };
+  int status;
+
+  status = ml_tensors_info_create (&info1);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  ml_tensors_info_set_count (info1, 1);
+  ml_tensors_info_set_tensor_type (info1, 0, ML_TENSOR_TYPE_UINT8);
+  ml_tensors_info_set_tensor_dimension (info1, 0, dim);
+
+  status = ml_tensors_info_create (&info2);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  ml_tensors_info_set_count (info2, 1);
+  ml_tensors_info_set_tensor_type (info2, 0, ML_TENSOR_TYPE_UINT8);
+  ml_tensors_info_set_tensor_dimension (info2, 0, dim);
+
+  status = _ml_tensors_info_compare (info1, info2, nullptr);
+  ASSERT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  status = ml_tensors_info_destroy (info1);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_tensors_info_destroy (info2);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+}
+
+/**
+ * @brief Test utility functions (internal)
+ */
+TEST (nnstreamer_capi_util, info_comp_0)
+{
+  bool equal;
+  ml_tensors_info_h info1, info2;
+  ml_tensors_info_s *is;
+  int status = ml_tensors_info_create (&info1);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_info_create (&info2);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+
+  is = (ml_tensors_info_s *)info1;
+  is->num_tensors = 1;
+  is = (ml_tensors_info_s *)info2;
+  is->num_tensors = 2;
+
+  status = _ml_tensors_info_compare (info1, info2, &equal);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+  ASSERT_FALSE (equal);
+
+  status = ml_tensors_info_destroy (info1);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_info_destroy (info2);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+}
+
+/**
+ * @brief Test utility functions (internal) - the tensors info with same shapes shares the interned instance.
+ */
+TEST (nnstreamer_capi_util, info_interned_01_p)
+{
+  ml_tensors_info_h info1, info2, info3;
+  ml_tensor_dimension dim = { 3, 4, 1, 1 };
+  const ml_tensors_info_interned_s *p1, *p2, *p3;
+  size_t size;
+  bool equal;
+  int status;
+
+  ml_tensors_info_create (&info1);
+  ml_tensors_info_set_count (info1, 2);
+  ml_tensors_info_set_tensor_type (info1, 0, ML_TENSOR_TYPE_UINT8);
+  ml_tensors_info_set_tensor_dimension (info1, 0, dim);
+  ml_tensors_info_set_tensor_type (info1, 1, ML_TENSOR_TYPE_FLOAT32);
+  ml_tensors_info_set_tensor_dimension (info1, 1, dim);
+  ml_tensors_info_set_tensor_name (info1, 0, "first");
+
+  /* the name is not a part of the interned info */
+  ml_tensors_info_create (&info2);
+  ml_tensors_info_set_count (info2, 2);
+  ml_tensors_info_set_tensor_type (info2, 0, ML_TENSOR_TYPE_UINT8);
+  ml_tensors_info_set_tensor_dimension (info2, 0, dim);
+  ml_tensors_info_set_tensor_type (info2, 1, ML_TENSOR_TYPE_FLOAT32);
+  ml_tensors_info_set_tensor_dimension (info2, 1, dim);
+
+  p1 = _ml_tensors_info_get_interned ((ml_tensors_info_s *) info1);
+  p2 = _ml_tensors_info_get_interned ((ml_tensors_info_s *) info2);
+  ASSERT_TRUE (p1 != NULL);
+  EXPECT_TRUE (p1 == p2);
+  EXPECT_TRUE (p1->valid);
+  EXPECT_EQ (p1->size[0], 12U);
+  EXPECT_EQ (p1->size[1], 48U);
+  EXPECT_EQ (p1->total_size, 60U);
+
+  status = _ml_tensors_info_compare (info1, info2, &equal);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_TRUE (equal);
+
+  /* the clone shares the interned info */
+  ml_tensors_info_create (&info3);
+  status = ml_tensors_info_clone (info3, info1);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  p3 = ((ml_tensors_info_s *) info3)->interned;
+  EXPECT_TRUE (p3 == p1);
+
+  /* the interned info is released when the info is changed */
+  dim[0] = 5;
+  ml_tensors_info_set_tensor_dimension (info2, 0, dim);
+  EXPECT_TRUE (((ml_tensors_info_s *) info2)->interned == NULL);
+
+  status = _ml_tensors_info_compare (info1, info2, &equal);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_FALSE (equal);
+
+  status = ml_tensors_info_get_tensor_size (info2, -1, &size);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (size, 68U);
+
+  p2 = _ml_tensors_info_get_interned ((ml_tensors_info_s *) info2);
+  EXPECT_TRUE (p2 != p1);
+
+  ml_tensors_info_destroy (info1);
+  ml_tensors_info_destroy (info2);
+  ml_tensors_info_destroy (info3);
+}
+
+/**
+ * @brief Test utility functions (internal) - the interned instance of invalid tensors info.
+ */
+TEST (nnstreamer_capi_util, info_interned_02_n)
+{
+  ml_tensors_info_h info;
+  ml_tensor_dimension dim = { 3, 4, 0, 1 };
+  const ml_tensors_info_interned_s *p;
+  bool valid;
+  int status;
+
+  EXPECT_TRUE (_ml_tensors_info_get_interned (NULL) == NULL);
+
+  ml_tensors_info_create (&info);
+  ml_tensors_info_set_count (info, 1);
+  ml_tensors_info_set_tensor_type (info, 0, ML_TENSOR_TYPE_UINT8);
+  ml_tensors_info_set_tensor_dimension (info, 0, dim);
+
+  p = _ml_tensors_info_get_interned ((ml_tensors_info_s *) info);
+  ASSERT_TRUE (p != NULL);
+  EXPECT_FALSE (p->valid);
+
+  status = ml_tensors_info_validate (info, &valid);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_FALSE (valid);
+
+  ml_tensors_info_destroy (info);
+}
+
+/**
+ * @brief Test utility functions (public)
+ * @details The extended tensors info with 40 tensors of rank 5.
+ */
+TEST (nnstreamer_capi_util, info_create_extended_01_p)
+{
+  ml_tensors_info_h info, cloned;
+  ml_tensors_data_h data, ref;
+  ml_tensor_dimension dim;
+  ml_tensor_dimension_extended dim_ext = { 3, 4, 5, 2, 6, 1, 1, 1 };
+  ml_tensor_dimension_extended dim_out;
+  unsigned int count, i;
+  size_t size;
+  void *raw;
+  char *name;
+  bool valid;
+  int status;
+
+  status = ml_tensors_info_create_extended (&info);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_tensors_info_set_count (info, 40);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  for (i = 0; i < 40; i++) {
+    status = ml_tensors_info_set_tensor_type (info, i, ML_TENSOR_TYPE_FLOAT32);
+    EXPECT_EQ (status, ML_ERROR_NONE);
+    status = ml_tensors_info_set_tensor_dimension_extended (info, i, dim_ext);
+    EXPECT_EQ (status, ML_ERROR_NONE);
+  }
+
+  status = ml_tensors_info_set_tensor_name (info, 39, "last");
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_tensors_info_validate (info, &valid);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_TRUE (valid);
+
+  status = ml_tensors_info_get_tensor_dimension_extended (info, 39, dim_out);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  for (i = 0; i < ML_TENSOR_RANK_LIMIT_EXTENDED; i++)
+    EXPECT_EQ (dim_out[i], dim_ext[i]);
+
+  /* the higher rank is folded into the last dimension */
+  status = ml_tensors_info_get_tensor_dimension (info, 39, dim);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (dim[0], 3U);
+  EXPECT_EQ (dim[1], 4U);
+  EXPECT_EQ (dim[2], 5U);
+  EXPECT_EQ (dim[3], 12U);
+
+  status = ml_tensors_info_get_tensor_size (info, 39, &size);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (size, 2880U);
+  status = ml_tensors_info_get_tensor_size (info, -1, &size);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (size, 2880U * 40);
+
+  ml_tensors_info_create (&cloned);
+  status = ml_tensors_info_clone (cloned, info);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  ml_tensors_info_get_count (cloned, &count);
+  EXPECT_EQ (count, 40U);
+  status = ml_tensors_info_get_tensor_name (cloned, 39, &name);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_STREQ (name, "last");
+  g_free (name);
+  ml_tensors_info_destroy (cloned);
+
+  status = ml_tensors_data_create (info, &data);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_data_get_tensor_data (data, 39, &raw, &size);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_TRUE (raw != NULL);
+  EXPECT_EQ (size, 2880U);
+  status = ml_tensors_data_set_tensor_data (data, 20, raw, size);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  /* the shared data supports ML_TENSOR_SIZE_LIMIT tensors */
+  status = ml_tensors_data_ref (data, &ref);
+  EXPECT_EQ (status, ML_ERROR_NOT_SUPPORTED);
+  ml_tensors_data_destroy (data);
+
+  status = ml_tensors_data_create_full (info, ML_TENSORS_DATA_FLAG_CONTIGUOUS,
+      NULL, &data);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_data_get_block_data (data, &raw, &size);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (size, 2880U * 40);
+  ml_tensors_data_destroy (data);
+
+  /* shrink the list of tensors */
+  status = ml_tensors_info_set_count (info, 17);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_info_get_tensor_name (info, 39, &name);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  ml_tensors_info_destroy (info);
+}
+
+/**
+ * @brief Test utility functions (public)
+ * @details The limits of the tensors info with and without the extension.
+ */
+TEST (nnstreamer_capi_util, info_create_extended_02_n)
+{
+  ml_tensors_info_h info;
+  ml_tensor_dimension_extended dim_ext = { 3, 4, 5, 2, 6, 1, 1, 1 };
+  int status;
+
+  status = ml_tensors_info_create_extended (NULL);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  /* the handle without the extension */
+  ml_tensors_info_create (&info);
+  status = ml_tensors_info_set_count (info, ML_TENSOR_SIZE_LIMIT + 1);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+  ml_tensors_info_set_count (info, 1);
+  status = ml_tensors_info_set_tensor_dimension_extended (info, 0, dim_ext);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+  ml_tensors_info_destroy (info);
+
+  ml_tensors_info_create_extended (&info);
+  status = ml_tensors_info_set_count (info, ML_TENSOR_SIZE_LIMIT_EXTENDED + 1);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+  ml_tensors_info_set_count (info, 1);
+  status = ml_tensors_info_set_tensor_dimension_extended (info, 1, dim_ext);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+  status = ml_tensors_info_set_tensor_dimension_extended (info, 0, NULL);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+  status = ml_tensors_info_get_tensor_dimension_extended (info, 0, NULL);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+  status = ml_tensors_info_get_tensor_dimension_extended (NULL, 0, dim_ext);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+  ml_tensors_info_destroy (info);
+}
+
+/**
+ * @brief Test utility functions (public)
+ * @details The dimensions beyond the rank 4 are reset and cloned with the tensor.
+ */
+TEST (nnstreamer_capi_util, info_create_extended_03_p)
+{
+  ml_tensors_info_h info, cloned;
+  ml_tensor_dimension dim = { 2, 3, 4, 5 };
+  ml_tensor_dimension_extended dim_ext = { 2, 3, 4, 5, 1, 1, 6, 1 };
+  ml_tensor_dimension_extended dim_out;
+  unsigned int i;
+  bool equal;
+  int status;
+
+  status = ml_tensors_info_create_extended (&info);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_info_set_count (info, 2);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  for (i = 0; i < 2; i++) {
+    status = ml_tensors_info_set_tensor_type (info, i, ML_TENSOR_TYPE_UINT8);
+    EXPECT_EQ (status, ML_ERROR_NONE);
+    status = ml_tensors_info_set_tensor_dimension_extended (info, i, dim_ext);
+    EXPECT_EQ (status, ML_ERROR_NONE);
+  }
+
+  ml_tensors_info_create (&cloned);
+  status = ml_tensors_info_clone (cloned, info);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_info_get_tensor_dimension_extended (cloned, 1, dim_out);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  for (i = 0; i < ML_TENSOR_RANK_LIMIT_EXTENDED; i++)
+    EXPECT_EQ (dim_out[i], dim_ext[i]);
+
+  status = _ml_tensors_info_compare (info, cloned, &equal);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_TRUE (equal);
+
+  /* the rank-4 dimension resets the higher rank */
+  status = ml_tensors_info_set_tensor_dimension (info, 1, dim);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_info_get_tensor_dimension_extended (info, 1, dim_out);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  for (i = 0; i < ML_TENSOR_RANK_LIMIT; i++)
+    EXPECT_EQ (dim_out[i], dim[i]);
+  for (; i < ML_TENSOR_RANK_LIMIT_EXTENDED; i++)
+    EXPECT_EQ (dim_out[i], 1U);
+
+  status = _ml_tensors_info_compare (info, cloned, &equal);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_FALSE (equal);
+
+  ml_tensors_info_destroy (cloned);
+  ml_tensors_info_destroy (info);
+}
+
+/**
+ * @brief Test utility functions (public)
+ */
+TEST (nnstreamer_capi_util, info_set_count_n)
+{
+  int status = ml_tensors_info_set_count (nullptr, 1);
+  ASSERT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+}
+
+/**
+ * @brief Test utility functions (public)
+ */
+TEST (nnstreamer_capi_util, info_get_count_n)
+{
+  int status = ml_tensors_info_get_count (nullptr, nullptr);
+  ASSERT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+}
+
+/**
+ * @brief Test utility functions (public)
+ */
+TEST (nnstreamer_capi_util, info_set_tname_0_n)
+{
+  int status = ml_tensors_info_set_tensor_name (nullptr, 0, "fail");
+  ASSERT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+}
+
+/**
+ * @brief Test utility functions (public)
+ */
+TEST (nnstreamer_capi_util, info_set_tname_1_n)
+{
+  ml_tensors_info_h info;
+  int status = ml_tensors_info_create (&info);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_info_set_count (info, 3);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_tensors_info_set_tensor_name (info, 3, "fail");
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  status = ml_tensors_info_destroy (info);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+}
+
+/**
+ * @brief Test utility functions (public)
+ */
+TEST (nnstreamer_capi_util, info_set_tname_1)
+{
+  ml_tensors_info_h info;
+  int status = ml_tensors_info_create (&info);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_info_set_count (info, 1);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_tensors_info_set_tensor_name (info, 0, "first");
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_info_set_tensor_name (info, 0, "second");
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_tensors_info_destroy (info);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+}
+
+/**
+ * @brief Test utility functions (public)
+ */
+TEST (nnstreamer_capi_util, info_get_tname_01_n)
+{
+  int status;
+  ml_tensors_info_h info;
+  char *name = NULL;
+
+  status = ml_tensors_info_create (&info);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_info_set_count (info, 1);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_tensors_info_get_tensor_name (nullptr, 0, &name);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  status = ml_tensors_info_destroy (info);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+}
+
+/**
+ * @brief Test utility functions (public)
+ */
+TEST (nnstreamer_capi_util, info_get_tname_02_n)
+{
+  int status;
+  ml_tensors_info_h info;
+
+  status = ml_tensors_info_create (&info);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_info_set_count (info, 1);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_tensors_info_get_tensor_name (info, 0, nullptr);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  status = ml_tensors_info_destroy (info);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+}
+
+/**
+ * @brief Test utility functions (public)
+ */
+TEST (nnstreamer_capi_util, info_get_tname_03_n)
+{
+  int status;
+  ml_tensors_info_h info;
+  char *name = NULL;
+
+  status = ml_tensors_info_create (&info);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_info_set_count (info, 1);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_tensors_info_get_tensor_name (info, 2, &name);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  status = ml_tensors_info_destroy (info);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+}
+
+/**
+ * @brief Test utility functions (public)
+ */
+TEST (nnstreamer_capi_util, info_set_ttype_01_n)
+{
+  int status;
+
+  status = ml_tensors_info_set_tensor_type (nullptr, 0, ML_TENSOR_TYPE_INT16);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+}
+
+/**
+ * @brief Test utility functions (public)
+ */
+TEST (nnstreamer_capi_util, info_set_ttype_02_n)
+{
+  int status;
+  ml_tensors_info_h info;
+
+  status = ml_tensors_info_create (&info);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_info_set_count (info, 1);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_tensors_info_set_tensor_type (info, 0, ML_TENSOR_TYPE_UNKNOWN);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  status = ml_tensors_info_destroy (info);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+}
+
+/**
+ * @brief Test utility functions (public)
+ */
+TEST (nnstreamer_capi_util, info_set_ttype_03_n)
+{
+  int status;
+  ml_tensors_info_h info;
+
+  status = ml_tensors_info_create (&info);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_info_set_count (info, 1);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_tensors_info_set_tensor_type (info, 2, ML_TENSOR_TYPE_INT16);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  status = ml_tensors_info_destroy (info);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+}
+
+/**
+ * @brief Test utility functions (public)
+ */
+TEST (nnstreamer_capi_util, info_get_ttype_01_n)
+{
+  int status;
+  ml_tensor_type_e type;
+
+  status = ml_tensors_info_get_tensor_type (nullptr, 0, &type);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+}
+
+/**
+ * @brief Test utility functions (public)
+ */
+TEST (nnstreamer_capi_util, info_get_ttype_02_n)
+{
+  int status;
+  ml_tensors_info_h info;
+
+  status = ml_tensors_info_create (&info);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_info_set_count (info, 1);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_tensors_info_get_tensor_type (info, 0, nullptr);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  status = ml_tensors_info_destroy (info);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+}
+
+/**
+ * @brief Test utility functions (public)
+ */
+TEST (nnstreamer_capi_util, info_get_ttype_03_n)
+{
+  int status;
+  ml_tensors_info_h info;
+  ml_tensor_type_e type;
+
+  status = ml_tensors_info_create (&info);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_info_set_count (info, 1);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_tensors_info_get_tensor_type (info, 2, &type);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  status = ml_tensors_info_destroy (info);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+}
+
+/**
+ * @brief Test utility functions (public)
+ */
+TEST (nnstreamer_capi_util, info_set_tdimension_01_n)
+{
+  int status;
+  ml_tensor_dimension dim = { 2, 2, 2, 2 };
+
+  status = ml_tensors_info_set_tensor_dimension (nullptr, 0, dim);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+}
+
+/**
+ * @brief Test utility functions (public)
+ */
+TEST (nnstreamer_capi_util, info_set_tdimension_02_n)
+{
+  int status;
+  ml_tensors_info_h info;
+  ml_tensor_dimension dim = { 1, 2, 3, 4 };
+
+  status = ml_tensors_info_create (&info);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_info_set_count (info, 1);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_tensors_info_set_tensor_dimension (info, 2, dim);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  status = ml_tensors_info_destroy (info);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+}
+
+/**
+ * @brief Test utility functions (public)
+ */
+TEST (nnstreamer_capi_util, info_get_tdimension_01_n)
+{
+  int status;
+  ml_tensor_dimension dim;
+
+  status = ml_tensors_info_get_tensor_dimension (nullptr, 0, dim);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+}
+
+/**
+ * @brief Test utility functions (public)
+ */
+TEST (nnstreamer_capi_util, info_get_tdimension_02_n)
+{
+  int status;
+  ml_tensors_info_h info;
+  ml_tensor_dimension dim;
+
+  status = ml_tensors_info_create (&info);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_info_set_count (info, 1);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_tensors_info_get_tensor_dimension (info, 2, dim);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  status = ml_tensors_info_destroy (info);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+}
+
+/**
+ * @brief Test utility functions (public)
+ */
+TEST (nnstreamer_capi_util, info_get_tsize_01_n)
+{
+  int status;
+  ml_tensors_info_h info;
+
+  status = ml_tensors_info_create (&info);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_info_set_count (info, 1);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_tensors_info_get_tensor_size (info, 0, nullptr);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  status = ml_tensors_info_destroy (info);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+}
+
+/**
+ * @brief Test utility functions (public)
+ */
+TEST (nnstreamer_capi_util, info_get_tsize_02_n)
+{
+  int status;
+  size_t data_size;
+
+  status = ml_tensors_info_get_tensor_size (nullptr, 0, &data_size);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+}
+
+/**
+ * @brief Test utility functions (public)
+ */
+TEST (nnstreamer_capi_util, info_get_tsize_03_n)
+{
+  int status;
+  size_t data_size;
+  ml_tensors_info_h info;
+
+  status = ml_tensors_info_create (&info);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_info_set_count (info, 1);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_tensors_info_get_tensor_size (info, 2, &data_size);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+  status = ml_tensors_info_get_tensor_size (info, 0, &data_size);
+  EXPECT_TRUE (data_size == 0);
+
+  status = ml_tensors_info_destroy (info);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+}
+
+/**
+ * @brief Test utility functions (public)
+ */
+TEST (nnstreamer_capi_util, info_clone)
+{
+  gint status;
+  guint count = 0;
+  ml_tensors_info_h in_info, out_info;
+  ml_tensor_dimension in_dim, out_dim;
+  ml_tensor_type_e type = ML_TENSOR_TYPE_UNKNOWN;
+
+  status = ml_tensors_info_create (&in_info);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_info_create (&out_info);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  in_dim[0] = 5;
+  in_dim[1] = 1;
+  in_dim[2] = 1;
+  in_dim[3] = 1;
+
+  status = ml_tensors_info_set_count (in_info, 1);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_info_set_tensor_type (in_info, 0, ML_TENSOR_TYPE_UINT8);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_info_set_tensor_dimension (in_info, 0, in_dim);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_tensors_info_clone (out_info, in_info);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_tensors_info_get_count (out_info, &count);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (count, 1U);
+
+  status = ml_tensors_info_get_tensor_type (out_info, 0, &type);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (type, ML_TENSOR_TYPE_UINT8);
+
+  status = ml_tensors_info_get_tensor_dimension (out_info, 0, out_dim);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_TRUE (in_dim[0] == out_dim[0]);
+  EXPECT_TRUE (in_dim[1] == out_dim[1]);
+  EXPECT_TRUE (in_dim[2] == out_dim[2]);
+  EXPECT_TRUE (in_dim[3] == out_dim[3]);
+
+  status = ml_tensors_info_destroy (in_info);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_info_destroy (out_info);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+}
+
+/**
+ * @brief Test utility functions (public)
+ */
+TEST (nnstreamer_capi_util, info_clone_01_n)
+{
+  int status;
+  ml_tensors_info_h src;
+
+  status = ml_tensors_info_create (&src);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_tensors_info_clone (nullptr, src);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  status = ml_tensors_info_destroy (src);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+}
+
+/**
+ * @brief Test utility functions (public)
+ */
+TEST (nnstreamer_capi_util, info_clone_02_n)
+{
+  int status;
+  ml_tensors_info_h desc;
+
+  status = ml_tensors_info_create (&desc);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_tensors_info_clone (desc, nullptr);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  status = ml_tensors_info_destroy (desc);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+}
+
+/**
+ * @brief Test utility functions (public)
+ */
+TEST (nnstreamer_capi_util, data_create_01_n)
+{
+  int status;
+  ml_tensors_data_h data = nullptr;
+
+  status = ml_tensors_data_create (nullptr, &data);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+}
+
+/**
+ * @brief Test utility functions (public)
+ */
+TEST (nnstreamer_capi_util, data_create_02_n)
+{
+  int status;
+  ml_tensors_info_h info;
+
+  status = ml_tensors_info_create (&info);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+
+
+  status = ml_tensors_data_create (info, nullptr);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  status = ml_tensors_info_destroy (info);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+}
+
+/**
+ * @brief Test utility functions (public)
+ */
+TEST (nnstreamer_capi_util, data_create_03_n)
+{
+  int status;
+  ml_tensors_info_h info;
+  ml_tensors_data_h data = nullptr;
+
+  status = ml_tensors_info_create (&info);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+
+  /* invalid info */
+  status = ml_tensors_data_create (info, &data);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  status = ml_tensors_info_destroy (info);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_tensors_data_destroy (data);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+}
+
+/**
+ * @brief Test utility functions (internal)
+ */
+TEST (nnstreamer_capi_util, data_create_internal_n)
+{
+  int status;
+
+  status = _ml_tensors_data_create_no_alloc (NULL, NULL);
+  EXPECT_NE (status, ML_ERROR_NONE);
+}
+
+/**
+ * @brief Test utility functions (public)
+ */
+TEST (nnstreamer_capi_util, data_get_tdata_01_n)
+{
+  int status;
+  size_t data_size;
+  void *raw_data;
+
+  status = ml_tensors_data_get_tensor_data (nullptr, 0, &raw_data, &data_size);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+}
+
+/**
+ * @brief Test utility functions (public)
+ */
+TEST (nnstreamer_capi_util, data_get_tdata_02_n)
+{
+  int status;
+  size_t data_size;
+  ml_tensors_info_h info;
+  ml_tensors_data_h data;
+  ml_tensor_dimension dim = { 2, 2, 2, 2 };
+
+  status = ml_tensors_info_create (&info);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_info_set_count (info, 1);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_info_set_tensor_type (info, 0, ML_TENSOR_TYPE_UINT8);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_info_set_tensor_dimension (info, 0, dim);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_data_create (info, &data);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_tensors_data_get_tensor_data (data, 0, nullptr, &data_size);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  status = ml_tensors_data_destroy (data);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_info_destroy (info);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+}
+
+/**
+ * @brief Test utility functions (public)
+ */
+TEST (nnstreamer_capi_util, data_get_tdata_03_n)
+{
+  int status;
+  void *raw_data;
+  ml_tensors_info_h info;
+  ml_tensors_data_h data;
+  ml_tensor_dimension dim = { 2, 2, 2, 2 };
+
+  status = ml_tensors_info_create (&info);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_info_set_count (info, 1);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_info_set_tensor_type (info, 0, ML_TENSOR_TYPE_UINT8);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_info_set_tensor_dimension (info, 0, dim);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_data_create (info, &data);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_tensors_data_get_tensor_data (data, 0, &raw_data, nullptr);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  status = ml_tensors_data_destroy (data);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_info_destroy (info);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+}
+
+/**
+ * @brief Test utility functions (public)
+ */
+TEST (nnstreamer_capi_util, data_get_tdata_04_n)
+{
+  int status;
+  size_t data_size;
+  void *raw_data;
+  ml_tensors_info_h info;
+  ml_tensors_data_h data;
+  ml_tensor_dimension dim = { 2, 2, 2, 2 };
+
+  status = ml_tensors_info_create (&info);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_info_set_count (info, 1);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_info_set_tensor_type (info, 0, ML_TENSOR_TYPE_UINT8);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_info_set_tensor_dimension (info, 0, dim);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_data_create (info, &data);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_tensors_data_get_tensor_data (data, 2, &raw_data, &data_size);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  status = ml_tensors_data_destroy (data);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_info_destroy (info);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+}
+
+/**
+ * @brief Test utility functions (public)
+ */
+TEST (nnstreamer_capi_util, data_set_tdata_01_n)
+{
+  int status;
+  void *raw_data;
+
+  raw_data = g_malloc (1024); /* larger than tensor */
+
+  status = ml_tensors_data_set_tensor_data (nullptr, 0, raw_data, 16);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  g_free (raw_data);
+}
+
+/**
+ * @brief Test utility functions (public)
+ */
+TEST (nnstreamer_capi_util, data_set_tdata_02_n)
+{
+  int status;
+  ml_tensors_info_h info;
+  ml_tensors_data_h data;
+  ml_tensor_dimension dim = { 2, 2, 2, 2 };
+
+  status = ml_tensors_info_create (&info);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_info_set_count (info, 1);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_info_set_tensor_type (info, 0, ML_TENSOR_TYPE_UINT8);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_info_set_tensor_dimension (info, 0, dim);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_data_create (info, &data);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_tensors_data_set_tensor_data (data, 0, nullptr, 16);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  status = ml_tensors_data_destroy (data);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_info_destroy (info);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+}
+
+/**
+ * @brief Test utility functions (public)
+ */
+TEST (nnstreamer_capi_util, data_set_tdata_03_n)
+{
+  int status;
+  void *raw_data;
+  ml_tensors_info_h info;
+  ml_tensors_data_h data;
+  ml_tensor_dimension dim = { 2, 2, 2, 2 };
+
+  raw_data = g_malloc (1024); /* larger than tensor */
+
+  status = ml_tensors_info_create (&info);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_info_set_count (info, 1);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_info_set_tensor_type (info, 0, ML_TENSOR_TYPE_UINT8);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_info_set_tensor_dimension (info, 0, dim);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_data_create (info, &data);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_tensors_data_set_tensor_data (data, 2, raw_data, 16);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  status = ml_tensors_data_destroy (data);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_info_destroy (info);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+  g_free (raw_data);
+}
+
+/**
+ * @brief Test utility functions (public)
+ */
+TEST (nnstreamer_capi_util, data_set_tdata_04_n)
+{
+  int status;
+  void *raw_data;
+  ml_tensors_info_h info;
+  ml_tensors_data_h data;
+  ml_tensor_dimension dim = { 2, 2, 2, 2 };
+
+  raw_data = g_malloc (1024); /* larger than tensor */
+
+  status = ml_tensors_info_create (&info);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_info_set_count (info, 1);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_info_set_tensor_type (info, 0, ML_TENSOR_TYPE_UINT8);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_info_set_tensor_dimension (info, 0, dim);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_data_create (info, &data);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_tensors_data_set_tensor_data (data, 0, raw_data, 0);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  status = ml_tensors_data_destroy (data);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_info_destroy (info);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+  g_free (raw_data);
+}
+
+/**
+ * @brief Test utility functions (public)
+ */
+TEST (nnstreamer_capi_util, data_set_tdata_05_n)
+{
+  int status;
+  void *raw_data;
+  ml_tensors_info_h info;
+  ml_tensors_data_h data;
+  ml_tensor_dimension dim = { 2, 2, 2, 2 };
+
+  raw_data = g_malloc (1024); /* larger than tensor */
+
+  status = ml_tensors_info_create (&info);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_info_set_count (info, 1);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_info_set_tensor_type (info, 0, ML_TENSOR_TYPE_UINT8);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_info_set_tensor_dimension (info, 0, dim);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_data_create (info, &data);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_tensors_data_set_tensor_data (data, 0, raw_data, 1024);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  status = ml_tensors_data_destroy (data);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_info_destroy (info);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+  g_free (raw_data);
+}
+
+/**
+ * @brief Test utility functions (public)
+ * @details normalize uint8 tensor with mean and std for each channel.
+ */
+TEST (nnstreamer_capi_util, data_normalize_01_p)
+{
+  int status;
+  ml_tensors_info_h in_info, out_info;
+  ml_tensors_data_h in_data, out_data, ref_data;
+  ml_tensor_dimension dim = { 3, 10, 7, 1 };
+  const float mean[3] = { 0.0f, 127.5f, 10.0f };
+  const float std[3] = { 255.0f, 127.5f, 2.0f };
+  guint8 *in_raw;
+  float *out_raw, *ref_raw;
+  size_t in_size, out_size, i;
+
+  ml_tensors_info_create (&in_info);
+  ml_tensors_info_set_count (in_info, 1);
+  ml_tensors_info_set_tensor_type (in_info, 0, ML_TENSOR_TYPE_UINT8);
+  ml_tensors_info_set_tensor_dimension (in_info, 0, dim);
+
+  ml_tensors_info_create (&out_info);
+  ml_tensors_info_set_count (out_info, 1);
+  ml_tensors_info_set_tensor_type (out_info, 0, ML_TENSOR_TYPE_FLOAT32);
+  ml_tensors_info_set_tensor_dimension (out_info, 0, dim);
+
+  status = ml_tensors_data_create (in_info, &in_data);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_data_create (out_info, &out_data);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_tensors_data_get_tensor_data (in_data, 0, (void **) &in_raw, &in_size);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  for (i = 0; i < in_size; i++)
+    in_raw[i] = (guint8) (i * 7);
+
+  /* the output shared with other handle is copied before writing */
+  status = ml_tensors_data_ref (out_data, &ref_data);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_tensors_data_normalize (in_data, out_data, 0, mean, std, 3);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_tensors_data_get_tensor_data (out_data, 0, (void **) &out_raw, &out_size);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (out_size, in_size * sizeof (float));
+
+  for (i = 0; i < in_size; i++)
+    EXPECT_NEAR (out_raw[i], ((float) in_raw[i] - mean[i % 3]) / std[i % 3], 1e-5);
+
+  status = ml_tensors_data_get_tensor_data (ref_data, 0, (void **) &ref_raw, &out_size);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_TRUE (ref_raw != out_raw);
+  for (i = 0; i < in_size; i++)
+    EXPECT_FLOAT_EQ (ref_raw[i], 0.0f);
+
+  ml_tensors_data_destroy (in_data);
+  ml_tensors_data_destroy (out_data);
+  ml_tensors_data_destroy (ref_data);
+  ml_tensors_info_destroy (in_info);
+  ml_tensors_info_destroy (out_info);
+}
+
+/**
+ * @brief Test utility functions (public)
+ * @details normalize with invalid param.
+ */
+TEST (nnstreamer_capi_util, data_normalize_02_n)
+{
+  int status;
+  ml_tensors_info_h info;
+  ml_tensors_data_h in_data, out_data;
+  ml_tensor_dimension dim = { 3, 4, 4, 1 };
+  const float mean[3] = { 0.0f, 0.0f, 0.0f };
+  const float std[3] = { 255.0f, 255.0f, 0.0f };
+
+  ml_tensors_info_create (&info);
+  ml_tensors_info_set_count (info, 1);
+  ml_tensors_info_set_tensor_type (info, 0, ML_TENSOR_TYPE_UINT8);
+  ml_tensors_info_set_tensor_dimension (info, 0, dim);
+
+  ml_tensors_data_create (info, &in_data);
+  ml_tensors_data_create (info, &out_data);
+
+  status = ml_tensors_data_normalize (NULL, out_data, 0, mean, std, 1);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+  status = ml_tensors_data_normalize (in_data, in_data, 0, mean, std, 1);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+  status = ml_tensors_data_normalize (in_data, out_data, 0, mean, std, 0);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+  /* std is 0 */
+  status = ml_tensors_data_normalize (in_data, out_data, 0, mean, std, 3);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+  /* output is not float32 */
+  status = ml_tensors_data_normalize (in_data, out_data, 0, mean, std, 1);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+  /* invalid index */
+  status = ml_tensors_data_normalize (in_data, out_data, 1, mean, std, 1);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  ml_tensors_data_destroy (in_data);
+  ml_tensors_data_destroy (out_data);
+  ml_tensors_info_destroy (info);
+}
+
+/**
+ * @brief Test utility functions (public)
+ * @details transpose NHWC to NCHW and back.
+ */
+TEST (nnstreamer_capi_util, data_transpose_01_p)
+{
+  int status;
+  ml_tensors_info_h info;
+  ml_tensors_data_h data, nchw, nhwc;
+  ml_tensor_dimension dim = { 3, 5, 4, 2 };
+  guint16 *raw, *raw_nchw, *raw_nhwc;
+  size_t size, i;
+  guint b, c, s;
+
+  ml_tensors_info_create (&info);
+  ml_tensors_info_set_count (info, 1);
+  ml_tensors_info_set_tensor_type (info, 0, ML_TENSOR_TYPE_UINT16);
+  ml_tensors_info_set_tensor_dimension (info, 0, dim);
+
+  ml_tensors_data_create (info, &data);
+  ml_tensors_data_create (info, &nchw);
+  ml_tensors_data_create (info, &nhwc);
+
+  ml_tensors_data_get_tensor_data (data, 0, (void **) &raw, &size);
+  for (i = 0; i < size / sizeof (guint16); i++)
+    raw[i] = (guint16) i;
+
+  status = ml_tensors_data_transpose (data, nchw, 0, sizeof (guint16), 3, 2, true);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  ml_tensors_data_get_tensor_data (nchw, 0, (void **) &raw_nchw, &size);
+  for (b = 0; b < 2; b++) {
+    for (c = 0; c < 3; c++) {
+      for (s = 0; s < 20; s++)
+        EXPECT_EQ (raw_nchw[(b * 3 + c) * 20 + s], raw[(b * 20 + s) * 3 + c]);
+    }
+  }
+
+  status = ml_tensors_data_transpose (nchw, nhwc, 0, sizeof (guint16), 3, 2, false);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  ml_tensors_data_get_tensor_data (nhwc, 0, (void **) &raw_nhwc, &size);
+  EXPECT_EQ (memcmp (raw, raw_nhwc, size), 0);
+
+  status = ml_tensors_data_transpose (data, data, 0, sizeof (guint16), 3, 2, true);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+  status = ml_tensors_data_transpose (data, nchw, 0, sizeof (guint16), 7, 2, true);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  ml_tensors_data_destroy (data);
+  ml_tensors_data_destroy (nchw);
+  ml_tensors_data_destroy (nhwc);
+  ml_tensors_info_destroy (info);
+}
+
+/**
+ * @brief Test utility functions (public)
+ * @details transpose float32 NHWC to NCHW and back, with the full and partial tiles.
+ */
+TEST (nnstreamer_capi_util, data_transpose_02_p)
+{
+  int status;
+  ml_tensors_info_h info;
+  ml_tensors_data_h data, nchw, nhwc;
+  ml_tensor_dimension dim = { 24, 7, 5, 2 };
+  float *raw, *raw_nchw, *raw_nhwc;
+  size_t size, i;
+  guint b, c, s;
+
+  ml_tensors_info_create (&info);
+  ml_tensors_info_set_count (info, 1);
+  ml_tensors_info_set_tensor_type (info, 0, ML_TENSOR_TYPE_FLOAT32);
+  ml_tensors_info_set_tensor_dimension (info, 0, dim);
+
+  ml_tensors_data_create (info, &data);
+  ml_tensors_data_create (info, &nchw);
+  ml_tensors_data_create (info, &nhwc);
+
+  ml_tensors_data_get_tensor_data (data, 0, (void **) &raw, &size);
+  for (i = 0; i < size / sizeof (float); i++)
+    raw[i] = (float) i;
+
+  status = ml_tensors_data_transpose (data, nchw, 0, sizeof (float), 24, 2, true);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  ml_tensors_data_get_tensor_data (nchw, 0, (void **) &raw_nchw, &size);
+  for (b = 0; b < 2; b++) {
+    for (c = 0; c < 24; c++) {
+      for (s = 0; s < 35; s++)
+        EXPECT_FLOAT_EQ (raw_nchw[(b * 24 + c) * 35 + s], raw[(b * 35 + s) * 24 + c]);
+    }
+  }
+
+  status = ml_tensors_data_transpose (nchw, nhwc, 0, sizeof (float), 24, 2, false);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  ml_tensors_data_get_tensor_data (nhwc, 0, (void **) &raw_nhwc, &size);
+  EXPECT_EQ (memcmp (raw, raw_nhwc, size), 0);
+
+  ml_tensors_data_destroy (data);
+  ml_tensors_data_destroy (nchw);
+  ml_tensors_data_destroy (nhwc);
+  ml_tensors_info_destroy (info);
+}
+
+/**
+ * @brief Test utility functions (public)
+ * @details argmax of float32 and uint8 tensors.
+ */
+TEST (nnstreamer_capi_util, data_argmax_01_p)
+{
+  int status;
+  ml_tensors_info_h info;
+  ml_tensors_data_h data;
+  ml_tensor_dimension dim = { 1001, 1, 1, 1 };
+  float *raw;
+  size_t size, i;
+  unsigned int result;
+
+  ml_tensors_info_create (&info);
+  ml_tensors_info_set_count (info, 2);
+  ml_tensors_info_set_tensor_type (info, 0, ML_TENSOR_TYPE_FLOAT32);
+  ml_tensors_info_set_tensor_dimension (info, 0, dim);
+  ml_tensors_info_set_tensor_type (info, 1, ML_TENSOR_TYPE_UINT8);
+  ml_tensors_info_set_tensor_dimension (info, 1, dim);
+
+  ml_tensors_data_create (info, &data);
+
+  ml_tensors_data_get_tensor_data (data, 0, (void **) &raw, &size);
+  for (i = 0; i < size / sizeof (float); i++)
+    raw[i] = -1.0f * i;
+  raw[777] = 3.5f;
+  raw[999] = 3.5f;
+
+  status = ml_tensors_data_argmax (data, 0, ML_TENSOR_TYPE_FLOAT32, &result);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (result, 777U);
+
+  ml_tensors_data_get_tensor_data (data, 1, (void **) &raw, &size);
+  ((guint8 *) raw)[1000] = 200;
+
+  status = ml_tensors_data_argmax (data, 1, ML_TENSOR_TYPE_UINT8, &result);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (result, 1000U);
+
+  status = ml_tensors_data_argmax (data, 2, ML_TENSOR_TYPE_UINT8, &result);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+  status = ml_tensors_data_argmax (data, 0, ML_TENSOR_TYPE_UNKNOWN, &result);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+  status = ml_tensors_data_argmax (data, 0, ML_TENSOR_TYPE_FLOAT32, NULL);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  ml_tensors_data_destroy (data);
+  ml_tensors_info_destroy (info);
+}
+
+/**
+ * @brief Test utility functions (private)
+ * @details Find the index of max value for each type, shared by ml_tensors_data_argmax() and tensor_if condition.
+ */
+TEST (nnstreamer_capi_util, tensor_argmax_types_p)
+{
+  const gint8 s8[] = { 0, 1, 9, 2, 3 };
+  const guint8 u8[] = { 0, 1, 9, 2, 3 };
+  const gint16 s16[] = { 0, 1, 9, 2, 3 };
+  const guint16 u16[] = { 0, 1, 9, 2, 3 };
+  const gint32 s32[] = { 0, 1, 9, 2, 3 };
+  const guint32 u32[] = { 0, 1, 9, 2, 3 };
+  const gint64 s64[] = { 0, 1, 9, 2, 3 };
+  const guint64 u64[] = { 0, 1, 9, 2, 3 };
+  const gfloat f32[] = { 0, 1, 9, 2, 3 };
+  const gdouble f64[] = { 0, 1, 9, 2, 3 };
+  gsize idx;
+  gdouble max;
+
+#define test_argmax(arr, type) do { \
+    idx = 0; max = 0.0; \
+    EXPECT_EQ (_ml_tensor_argmax (arr, 5, type, &idx, &max), ML_ERROR_NONE); \
+    EXPECT_EQ (idx, 2U); \
+    EXPECT_DOUBLE_EQ (max, 9.0); \
+  } while (0)
+
+  test_argmax (s8, ML_TENSOR_TYPE_INT8);
+  test_argmax (u8, ML_TENSOR_TYPE_UINT8);
+  test_argmax (s16, ML_TENSOR_TYPE_INT16);
+  test_argmax (u16, ML_TENSOR_TYPE_UINT16);
+  test_argmax (s32, ML_TENSOR_TYPE_INT32);
+  test_argmax (u32, ML_TENSOR_TYPE_UINT32);
+  test_argmax (s64, ML_TENSOR_TYPE_INT64);
+  test_argmax (u64, ML_TENSOR_TYPE_UINT64);
+  test_argmax (f32, ML_TENSOR_TYPE_FLOAT32);
+  test_argmax (f64, ML_TENSOR_TYPE_FLOAT64);
+#undef test_argmax
+
+  EXPECT_EQ (_ml_tensor_argmax (u8, 5, ML_TENSOR_TYPE_UNKNOWN, &idx, NULL), ML_ERROR_INVALID_PARAMETER);
+  EXPECT_EQ (_ml_tensor_argmax (u8, 0, ML_TENSOR_TYPE_UINT8, &idx, NULL), ML_ERROR_INVALID_PARAMETER);
+  EXPECT_EQ (_ml_tensor_argmax (NULL, 5, ML_TENSOR_TYPE_UINT8, &idx, NULL), ML_ERROR_INVALID_PARAMETER);
+  EXPECT_EQ (_ml_tensor_argmax (u8, 5, ML_TENSOR_TYPE_UINT8, NULL, NULL), ML_ERROR_INVALID_PARAMETER);
+}
+
+/**
+ * @brief Test utility functions (public)
+ * @details Type conversion, quantization and dequantization of tensors.
+ */
+TEST (nnstreamer_capi_util, data_convert_01_p)
+{
+  int status;
+  ml_tensors_info_h info;
+  ml_tensors_data_h data;
+  ml_tensor_dimension dim = { 37, 1, 1, 1 };
+  ml_tensor_quant_param_s quant = { 0.5f, 10 };
+  guint8 *u8;
+  gint8 *s8;
+  gint32 *s32;
+  float *f32;
+  double *f64;
+  size_t size, i;
+
+  ml_tensors_info_create (&info);
+  ml_tensors_info_set_count (info, 4);
+  ml_tensors_info_set_tensor_type (info, 0, ML_TENSOR_TYPE_UINT8);
+  ml_tensors_info_set_tensor_dimension (info, 0, dim);
+  ml_tensors_info_set_tensor_type (info, 1, ML_TENSOR_TYPE_FLOAT32);
+  ml_tensors_info_set_tensor_dimension (info, 1, dim);
+  ml_tensors_info_set_tensor_type (info, 2, ML_TENSOR_TYPE_INT32);
+  ml_tensors_info_set_tensor_dimension (info, 2, dim);
+  ml_tensors_info_set_tensor_type (info, 3, ML_TENSOR_TYPE_FLOAT64);
+  ml_tensors_info_set_tensor_dimension (info, 3, dim);
+
+  ml_tensors_data_create (info, &data);
+
+  ml_tensors_data_get_tensor_data (data, 0, (void **) &u8, &size);
+  for (i = 0; i < size; i++)
+    u8[i] = (guint8) (i * 7);
+
+  /* uint8 to float32, dequantize */
+  status = ml_tensors_data_convert (data, data, 0, ML_TENSOR_TYPE_UINT8,
+      ML_TENSOR_TYPE_FLOAT32, NULL);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  {
+    ml_tensors_data_h out;
+    ml_tensors_info_h out_info;
+
+    ml_tensors_info_create (&out_info);
+    ml_tensors_info_set_count (out_info, 1);
+    ml_tensors_info_set_tensor_type (out_info, 0, ML_TENSOR_TYPE_FLOAT32);
+    ml_tensors_info_set_tensor_dimension (out_info, 0, dim);
+    ml_tensors_data_create (out_info, &out);
+
+    status = ml_tensors_data_convert (data, out, 0, ML_TENSOR_TYPE_UINT8,
+        ML_TENSOR_TYPE_FLOAT32, &quant);
+    EXPECT_EQ (status, ML_ERROR_NONE);
+
+    ml_tensors_data_get_tensor_data (out, 0, (void **) &f32, &size);
+    for (i = 0; i < size / sizeof (float); i++)
+      EXPECT_FLOAT_EQ (f32[i], ((float) u8[i] - 10.0f) * 0.5f);
+
+    /* quantize back to uint8 and int8 (saturated) */
+    status = ml_tensors_data_convert (out, data, 0, ML_TENSOR_TYPE_FLOAT32,
+        ML_TENSOR_TYPE_UINT8, &quant);
+    EXPECT_EQ (status, ML_ERROR_NONE);
+    for (i = 0; i < size / sizeof (float); i++)
+      EXPECT_EQ (u8[i], (guint8) (i * 7));
+
+    status = ml_tensors_data_convert (out, data, 0, ML_TENSOR_TYPE_FLOAT32,
+        ML_TENSOR_TYPE_INT8, &quant);
+    EXPECT_EQ (status, ML_ERROR_NONE);
+    s8 = (gint8 *) u8;
+    for (i = 0; i < size / sizeof (float); i++)
+      EXPECT_EQ (s8[i], (gint8) MIN (i * 7, 127));
+
+    /* int8 to float32 */
+    status = ml_tensors_data_convert (data, out, 0, ML_TENSOR_TYPE_INT8,
+        ML_TENSOR_TYPE_FLOAT32, NULL);
+    EXPECT_EQ (status, ML_ERROR_NONE);
+    for (i = 0; i < size / sizeof (float); i++)
+      EXPECT_FLOAT_EQ (f32[i], (float) s8[i]);
+
+    ml_tensors_data_destroy (out);
+    ml_tensors_info_destroy (out_info);
+  }
+
+  /* in place, int8 to uint8 (saturated) */
+  s8[0] = -5;
+  status = ml_tensors_data_convert (data, data, 0, ML_TENSOR_TYPE_INT8,
+      ML_TENSOR_TYPE_UINT8, NULL);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (u8[0], 0U);
+  EXPECT_EQ (u8[1], 7U);
+
+  /* int32 to float64, and float64 to int32 with quantization */
+  ml_tensors_data_get_tensor_data (data, 2, (void **) &s32, &size);
+  for (i = 0; i < size / sizeof (gint32); i++)
+    s32[i] = (gint32) i * 100000 - 1000000;
+
+  status = ml_tensors_data_convert (data, data, 2, ML_TENSOR_TYPE_INT32,
+      ML_TENSOR_TYPE_FLOAT64, NULL);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  {
+    ml_tensors_data_h out;
+    ml_tensors_info_h out_info;
+
+    ml_tensors_info_create (&out_info);
+    ml_tensors_info_set_count (out_info, 3);
+    ml_tensors_info_set_tensor_type (out_info, 0, ML_TENSOR_TYPE_UINT8);
+    ml_tensors_info_set_tensor_type (out_info, 1, ML_TENSOR_TYPE_UINT8);
+    ml_tensors_info_set_tensor_type (out_info, 2, ML_TENSOR_TYPE_FLOAT64);
+    ml_tensors_info_set_tensor_dimension (out_info, 0, dim);
+    ml_tensors_info_set_tensor_dimension (out_info, 1, dim);
+    ml_tensors_info_set_tensor_dimension (out_info, 2, dim);
+    ml_tensors_data_create (out_info, &out);
+
+    status = ml_tensors_data_convert (data, out, 2, ML_TENSOR_TYPE_INT32,
+        ML_TENSOR_TYPE_FLOAT64, NULL);
+    EXPECT_EQ (status, ML_ERROR_NONE);
+
+    ml_tensors_data_get_tensor_data (out, 2, (void **) &f64, &size);
+    for (i = 0; i < size / sizeof (double); i++)
+      EXPECT_DOUBLE_EQ (f64[i], (double) s32[i]);
+
+    f64[0] = 2.6;
+    f64[1] = -2.6;
+    status = ml_tensors_data_convert (out, data, 2, ML_TENSOR_TYPE_FLOAT64,
+        ML_TENSOR_TYPE_INT32, &quant);
+    EXPECT_EQ (status, ML_ERROR_NONE);
+    EXPECT_EQ (s32[0], 15);
+    EXPECT_EQ (s32[1], 5);
+    EXPECT_EQ (s32[2], -1599990);
+
+    ml_tensors_data_destroy (out);
+    ml_tensors_info_destroy (out_info);
+  }
+
+  /* in place, int32 to float32 */
+  status = ml_tensors_data_convert (data, data, 2, ML_TENSOR_TYPE_INT32,
+      ML_TENSOR_TYPE_FLOAT32, NULL);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_FLOAT_EQ (((float *) s32)[0], 15.0f);
+  EXPECT_FLOAT_EQ (((float *) s32)[2], -1599990.0f);
+
+  ml_tensors_data_destroy (data);
+  ml_tensors_info_destroy (info);
+}
+
+/**
+ * @brief Test utility functions (public)
+ * @details Type conversion between integer types, widening and narrowing with saturation.
+ */
+TEST (nnstreamer_capi_util, data_convert_03_p)
+{
+  int status;
+  ml_tensors_info_h info, out_info;
+  ml_tensors_data_h data, out;
+  ml_tensor_dimension dim = { 4, 1, 1, 1 };
+  gint64 *s64;
+  guint64 *u64;
+  gint16 *s16;
+  guint8 *u8;
+  size_t size;
+
+  ml_tensors_info_create (&info);
+  ml_tensors_info_set_count (info, 2);
+  ml_tensors_info_set_tensor_type (info, 0, ML_TENSOR_TYPE_INT64);
+  ml_tensors_info_set_tensor_dimension (info, 0, dim);
+  ml_tensors_info_set_tensor_type (info, 1, ML_TENSOR_TYPE_INT16);
+  ml_tensors_info_set_tensor_dimension (info, 1, dim);
+
+  ml_tensors_info_create (&out_info);
+  ml_tensors_info_set_count (out_info, 2);
+  ml_tensors_info_set_tensor_type (out_info, 0, ML_TENSOR_TYPE_UINT8);
+  ml_tensors_info_set_tensor_dimension (out_info, 0, dim);
+  ml_tensors_info_set_tensor_type (out_info, 1, ML_TENSOR_TYPE_INT64);
+  ml_tensors_info_set_tensor_dimension (out_info, 1, dim);
+
+  ml_tensors_data_create (info, &data);
+  ml_tensors_data_create (out_info, &out);
+
+  /* the int64 larger than 2^53 is not exact in float64 */
+  ml_tensors_data_get_tensor_data (data, 0, (void **) &s64, &size);
+  s64[0] = G_GINT64_CONSTANT (9007199254740993);
+  s64[1] = -1;
+  s64[2] = G_MININT64;
+  s64[3] = 300;
+
+  /* in place, int64 to uint64 */
+  status = ml_tensors_data_convert (data, data, 0, ML_TENSOR_TYPE_INT64,
+      ML_TENSOR_TYPE_UINT64, NULL);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  u64 = (guint64 *) s64;
+  EXPECT_EQ (u64[0], G_GUINT64_CONSTANT (9007199254740993));
+  EXPECT_EQ (u64[1], 0U);
+  EXPECT_EQ (u64[2], 0U);
+  EXPECT_EQ (u64[3], 300U);
+
+  /* in place, uint64 to int64 */
+  u64[1] = G_MAXUINT64;
+  status = ml_tensors_data_convert (data, data, 0, ML_TENSOR_TYPE_UINT64,
+      ML_TENSOR_TYPE_INT64, NULL);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (s64[0], G_GINT64_CONSTANT (9007199254740993));
+  EXPECT_EQ (s64[1], G_MAXINT64);
+  EXPECT_EQ (s64[2], 0);
+  EXPECT_EQ (s64[3], 300);
+
+  /* narrowing, int64 to uint8 */
+  s64[2] = -40000;
+  status = ml_tensors_data_convert (data, out, 0, ML_TENSOR_TYPE_INT64,
+      ML_TENSOR_TYPE_UINT8, NULL);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  ml_tensors_data_get_tensor_data (out, 0, (void **) &u8, &size);
+  EXPECT_EQ (u8[0], G_MAXUINT8);
+  EXPECT_EQ (u8[1], G_MAXUINT8);
+  EXPECT_EQ (u8[2], 0U);
+  EXPECT_EQ (u8[3], G_MAXUINT8);
+
+  /* widening, int16 to int64 */
+  ml_tensors_data_get_tensor_data (data, 1, (void **) &s16, &size);
+  s16[0] = G_MININT16;
+  s16[1] = -1;
+  s16[2] = 255;
+  s16[3] = G_MAXINT16;
+
+  status = ml_tensors_data_convert (data, out, 1, ML_TENSOR_TYPE_INT16,
+      ML_TENSOR_TYPE_INT64, NULL);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  ml_tensors_data_get_tensor_data (out, 1, (void **) &s64, &size);
+  EXPECT_EQ (s64[0], G_MININT16);
+  EXPECT_EQ (s64[1], -1);
+  EXPECT_EQ (s64[2], 255);
+  EXPECT_EQ (s64[3], G_MAXINT16);
+
+  /* in place, int16 to uint16 (saturated) */
+  status = ml_tensors_data_convert (data, data, 1, ML_TENSOR_TYPE_INT16,
+      ML_TENSOR_TYPE_UINT16, NULL);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (((guint16 *) s16)[0], 0U);
+  EXPECT_EQ (((guint16 *) s16)[1], 0U);
+  EXPECT_EQ (((guint16 *) s16)[2], 255U);
+  EXPECT_EQ (((guint16 *) s16)[3], (guint16) G_MAXINT16);
+
+  ml_tensors_data_destroy (data);
+  ml_tensors_data_destroy (out);
+  ml_tensors_info_destroy (info);
+  ml_tensors_info_destroy (out_info);
+}
+
+/**
+ * @brief Test utility functions (public)
+ * @details Type conversion with invalid parameters.
+ */
+TEST (nnstreamer_capi_util, data_convert_02_n)
+{
+  int status;
+  ml_tensors_info_h info;
+  ml_tensors_data_h data;
+  ml_tensor_dimension dim = { 5, 1, 1, 1 };
+  ml_tensor_quant_param_s quant = { 0.0f, 0 };
+
+  ml_tensors_info_create (&info);
+  ml_tensors_info_set_count (info, 2);
+  ml_tensors_info_set_tensor_type (info, 0, ML_TENSOR_TYPE_UINT8);
+  ml_tensors_info_set_tensor_dimension (info, 0, dim);
+  ml_tensors_info_set_tensor_type (info, 1, ML_TENSOR_TYPE_FLOAT32);
+  ml_tensors_info_set_tensor_dimension (info, 1, dim);
+
+  ml_tensors_data_create (info, &data);
+
+  status = ml_tensors_data_convert (NULL, data, 0, ML_TENSOR_TYPE_UINT8,
+      ML_TENSOR_TYPE_INT8, NULL);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+  status = ml_tensors_data_convert (data, NULL, 0, ML_TENSOR_TYPE_UINT8,
+      ML_TENSOR_TYPE_INT8, NULL);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+  status = ml_tensors_data_convert (data, data, 0, ML_TENSOR_TYPE_UNKNOWN,
+      ML_TENSOR_TYPE_INT8, NULL);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+  status = ml_tensors_data_convert (data, data, 2, ML_TENSOR_TYPE_UINT8,
+      ML_TENSOR_TYPE_INT8, NULL);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  /* the size of float32 tensor (20 bytes) is not a multiple of int64 */
+  status = ml_tensors_data_convert (data, data, 1, ML_TENSOR_TYPE_INT64,
+      ML_TENSOR_TYPE_FLOAT64, NULL);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  /* quantization between integer types, and invalid scale */
+  quant.scale = 1.0f;
+  status = ml_tensors_data_convert (data, data, 0, ML_TENSOR_TYPE_UINT8,
+      ML_TENSOR_TYPE_INT8, &quant);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+  quant.scale = 0.0f;
+  status = ml_tensors_data_convert (data, data, 1, ML_TENSOR_TYPE_FLOAT32,
+      ML_TENSOR_TYPE_INT32, &quant);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  ml_tensors_data_destroy (data);
+  ml_tensors_info_destroy (info);
+}
+
+/**
+ * @brief Allocator for the test, counts the allocated buffers.
+ */
+static void *
+test_alloc_cb (size_t size, size_t alignment, void *user_data)
+{
+  int *count = (int *) user_data;
+  void *mem = NULL;
+
+  if (alignment > 0) {
+    if (posix_memalign (&mem, alignment, size) != 0)
+      return NULL;
+  } else {
+    mem = malloc (size);
+  }
+
+  (*count)++;
+  return mem;
+}
+
+/**
+ * @brief Allocator for the test, counts the released buffers.
+ */
+static void
+test_free_cb (void *mem, void *user_data)
+{
+  int *count = (int *) user_data;
+
+  free (mem);
+  (*count)--;
+}
+
+/**
+ * @brief Test utility functions - create tensors data with flags and allocator.
+ */
+TEST (nnstreamer_capi_util, data_create_full_01_p)
+{
+  ml_tensors_info_h info;
+  ml_tensors_data_h data;
+  ml_tensor_dimension dim = { 3, 100, 100, 1 };
+  ml_tensor_dimension dim_large = { 3, 1024, 1024, 1 };
+  ml_tensors_data_allocator_s allocator;
+  int count = 0;
+  void *raw;
+  size_t size, i;
+  int status;
+
+  ml_tensors_info_create (&info);
+  ml_tensors_info_set_count (info, 2);
+  ml_tensors_info_set_tensor_type (info, 0, ML_TENSOR_TYPE_UINT8);
+  ml_tensors_info_set_tensor_dimension (info, 0, dim);
+  ml_tensors_info_set_tensor_type (info, 1, ML_TENSOR_TYPE_UINT8);
+  ml_tensors_info_set_tensor_dimension (info, 1, dim);
+
+  /* aligned and zero-filled */
+  status = ml_tensors_data_create_full (info, ML_TENSORS_DATA_FLAG_ALIGNED, NULL, &data);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_tensors_data_get_tensor_data (data, 1, &raw, &size);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (size, 30000U);
+  EXPECT_EQ ((uintptr_t) raw % ML_TENSORS_DATA_ALIGNMENT, 0U);
+  for (i = 0; i < size; i++) {
+    if (((uint8_t *) raw)[i] != 0U)
+      break;
+  }
+  EXPECT_EQ (i, size);
+
+  status = ml_tensors_data_destroy (data);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  /* custom allocator without zero-fill */
+  allocator.alloc = test_alloc_cb;
+  allocator.free = test_free_cb;
+  allocator.user_data = &count;
+
+  status = ml_tensors_data_create_full (info,
+      ML_TENSORS_DATA_FLAG_ALIGNED | ML_TENSORS_DATA_FLAG_NO_ZERO_FILL, &allocator, &data);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (count, 2);
+
+  status = ml_tensors_data_get_tensor_data (data, 0, &raw, &size);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ ((uintptr_t) raw % ML_TENSORS_DATA_ALIGNMENT, 0U);
+
+  status = ml_tensors_data_destroy (data);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (count, 0);
+
+  /* huge page for large tensor */
+  ml_tensors_info_set_count (info, 1);
+  ml_tensors_info_set_tensor_dimension (info, 0, dim_large);
+
+  status = ml_tensors_data_create_full (info, ML_TENSORS_DATA_FLAG_HUGE_PAGE, NULL, &data);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_tensors_data_get_tensor_data (data, 0, &raw, &size);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (size, 3U * 1024U * 1024U);
+  EXPECT_EQ ((uintptr_t) raw % ML_TENSORS_DATA_ALIGNMENT, 0U);
+
+  status = ml_tensors_data_destroy (data);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  ml_tensors_info_destroy (info);
+}
+
+/**
+ * @brief Test utility functions - create tensors data with invalid flags and allocator.
+ */
+TEST (nnstreamer_capi_util, data_create_full_02_n)
+{
+  const char pipeline[] = "appsrc name=srcx ! other/tensor,dimension=(string)4:1:1:1,type=(string)uint8,framerate=(fraction)0/1 ! tensor_sink name=sinkx";
+  ml_pipeline_h handle;
+  ml_pipeline_src_h srchandle;
+  ml_tensors_info_h info;
+  ml_tensors_data_h data;
+  ml_tensor_dimension dim = { 4, 1, 1, 1 };
+  ml_tensors_data_allocator_s allocator;
+  int count = 0;
+  int status;
+
+  ml_tensors_info_create (&info);
+  ml_tensors_info_set_count (info, 1);
+  ml_tensors_info_set_tensor_type (info, 0, ML_TENSOR_TYPE_UINT8);
+  ml_tensors_info_set_tensor_dimension (info, 0, dim);
+
+  status = ml_tensors_data_create_full (NULL, ML_TENSORS_DATA_FLAG_NONE, NULL, &data);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  status = ml_tensors_data_create_full (info, ML_TENSORS_DATA_FLAG_NONE, NULL, NULL);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  status = ml_tensors_data_create_full (info, 0x100, NULL, &data);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  allocator.alloc = test_alloc_cb;
+  allocator.free = NULL;
+  allocator.user_data = &count;
+
+  status = ml_tensors_data_create_full (info, ML_TENSORS_DATA_FLAG_NONE, &allocator, &data);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  /* the pipeline cannot free the data from the custom allocator */
+  allocator.free = test_free_cb;
+  status = ml_tensors_data_create_full (info, ML_TENSORS_DATA_FLAG_NONE, &allocator, &data);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_pipeline_construct (pipeline, NULL, NULL, &handle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_pipeline_src_get_handle (handle, "srcx", &srchandle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_pipeline_src_input_data (srchandle, data, ML_PIPELINE_BUF_POLICY_AUTO_FREE);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  status = ml_pipeline_src_release_handle (srchandle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_pipeline_destroy (handle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_tensors_data_destroy (data);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (count, 0);
+
+  ml_tensors_info_destroy (info);
+}
+
+/**
+ * @brief Test utility functions - create tensors data in a single block.
+ */
+TEST (nnstreamer_capi_util, data_create_full_03_p)
+{
+  const char pipeline[] = "appsrc name=srcx ! other/tensors,num_tensors=(int)2,dimensions=(string)4:1:1:1.8:1:1:1,types=(string)uint8.uint8,framerate=(fraction)0/1 ! tensor_sink name=sinkx sync=false";
+  ml_pipeline_h handle;
+  ml_pipeline_src_h srchandle;
+  ml_pipeline_sink_h sinkhandle;
+  ml_tensors_info_h info;
+  ml_tensors_data_h data;
+  ml_tensor_dimension dim = { 4, 1, 1, 1 };
+  guint *count_sink;
+  void *block, *raw;
+  size_t block_size, size;
+  int status;
+
+  ml_tensors_info_create (&info);
+  ml_tensors_info_set_count (info, 2);
+  ml_tensors_info_set_tensor_type (info, 0, ML_TENSOR_TYPE_UINT8);
+  ml_tensors_info_set_tensor_dimension (info, 0, dim);
+  dim[0] = 8;
+  ml_tensors_info_set_tensor_type (info, 1, ML_TENSOR_TYPE_UINT8);
+  ml_tensors_info_set_tensor_dimension (info, 1, dim);
+
+  status = ml_tensors_data_create_full (info, ML_TENSORS_DATA_FLAG_CONTIGUOUS, NULL, &data);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  /* the second tensor starts at the aligned offset in the block */
+  status = ml_tensors_data_get_block_data (data, &block, &block_size);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ ((uintptr_t) block % ML_TENSORS_DATA_ALIGNMENT, 0U);
+  EXPECT_EQ (block_size, ML_TENSORS_DATA_ALIGNMENT + 8U);
+
+  status = ml_tensors_data_get_tensor_data (data, 0, &raw, &size);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_TRUE (raw == block);
+  EXPECT_EQ (size, 4U);
+
+  status = ml_tensors_data_get_tensor_data (data, 1, &raw, &size);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_TRUE (raw == (uint8_t *) block + ML_TENSORS_DATA_ALIGNMENT);
+  EXPECT_EQ (size, 8U);
+
+  /* the pipeline releases the block with auto-free policy */
+  count_sink = (guint *) g_malloc0 (sizeof (guint));
+  ASSERT_TRUE (count_sink != NULL);
+
+  status = ml_pipeline_construct (pipeline, NULL, NULL, &handle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_pipeline_sink_register (handle, "sinkx", test_sink_callback_count, count_sink, &sinkhandle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_pipeline_src_get_handle (handle, "srcx", &srchandle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_pipeline_start (handle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_pipeline_src_input_data (srchandle, data, ML_PIPELINE_BUF_POLICY_AUTO_FREE);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  wait_pipeline_process_buffers (*count_sink, 1U);
+  EXPECT_EQ (*count_sink, 1U);
+
+  status = ml_pipeline_stop (handle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_pipeline_src_release_handle (srchandle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_pipeline_sink_unregister (sinkhandle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_pipeline_destroy (handle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  ml_tensors_info_destroy (info);
+  g_free (count_sink);
+}
+
+/**
+ * @brief Test utility functions - get the block of tensors data with invalid param.
+ */
+TEST (nnstreamer_capi_util, data_create_full_04_n)
+{
+  ml_tensors_info_h info;
+  ml_tensors_data_h data;
+  ml_tensor_dimension dim = { 4, 1, 1, 1 };
+  void *block;
+  size_t block_size;
+  int status;
+
+  ml_tensors_info_create (&info);
+  ml_tensors_info_set_count (info, 1);
+  ml_tensors_info_set_tensor_type (info, 0, ML_TENSOR_TYPE_UINT8);
+  ml_tensors_info_set_tensor_dimension (info, 0, dim);
+
+  status = ml_tensors_data_get_block_data (NULL, &block, &block_size);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  /* the data is not allocated in a single block */
+  status = ml_tensors_data_create_full (info, ML_TENSORS_DATA_FLAG_ALIGNED, NULL, &data);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_tensors_data_get_block_data (data, &block, &block_size);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  status = ml_tensors_data_destroy (data);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_tensors_data_create_full (info, ML_TENSORS_DATA_FLAG_CONTIGUOUS, NULL, &data);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_tensors_data_get_block_data (data, NULL, &block_size);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  status = ml_tensors_data_get_block_data (data, &block, NULL);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  status = ml_tensors_data_destroy (data);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  ml_tensors_info_destroy (info);
+}
+
+/**
+ * @brief Thread to create the tensors data, which is released in other thread.
+ */
+static gpointer
+test_create_data_thread (gpointer user_data)
+{
+  ml_tensors_info_h info = (ml_tensors_info_h) user_data;
+  ml_tensors_data_h data = NULL;
+  int status;
+
+  status = ml_tensors_data_create (info, &data);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  return data;
+}
+
+/**
+ * @brief Test utility functions - the handles reused from the cache are cleared.
+ */
+TEST (nnstreamer_capi_util, handle_cache_01_p)
+{
+  ml_tensors_info_h info;
+  ml_tensors_data_h data;
+  ml_tensor_dimension dim = { 4, 1, 1, 1 };
+  ml_tensors_info_s *_info;
+  ml_tensors_data_s *_data;
+  GThread *thread;
+  unsigned int count;
+  void *raw;
+  size_t size;
+  int status, i;
+
+  for (i = 0; i < 100; i++) {
+    status = ml_tensors_info_create (&info);
+    EXPECT_EQ (status, ML_ERROR_NONE);
+
+    /* the released handle should be initialized */
+    _info = (ml_tensors_info_s *) info;
+    EXPECT_EQ (_info->nolock, 0);
+    status = ml_tensors_info_get_count (info, &count);
+    EXPECT_EQ (status, ML_ERROR_NONE);
+    EXPECT_EQ (count, 0U);
+
+    ml_tensors_info_set_count (info, (i % 2) + 1);
+    ml_tensors_info_set_tensor_type (info, 0, ML_TENSOR_TYPE_UINT8);
+    ml_tensors_info_set_tensor_dimension (info, 0, dim);
+    ml_tensors_info_set_tensor_type (info, 1, ML_TENSOR_TYPE_FLOAT32);
+    ml_tensors_info_set_tensor_dimension (info, 1, dim);
+    ml_tensors_info_set_tensor_name (info, 0, "cached");
+
+    status = ml_tensors_data_create (info, &data);
+    EXPECT_EQ (status, ML_ERROR_NONE);
+
+    _data = (ml_tensors_data_s *) data;
+    EXPECT_EQ (_data->nolock, 0);
+    EXPECT_TRUE (_data->destroy == NULL);
+    EXPECT_EQ (_data->num_tensors, (unsigned int) (i % 2) + 1);
+
+    status = ml_tensors_data_get_tensor_data (data, 0, &raw, &size);
+    EXPECT_EQ (status, ML_ERROR_NONE);
+    EXPECT_EQ (size, 4U);
+
+    status = ml_tensors_data_get_tensor_data (data, 1, &raw, &size);
+    if (i % 2) {
+      EXPECT_EQ (status, ML_ERROR_NONE);
+      EXPECT_EQ (size, 16U);
+    } else {
+      EXPECT_NE (status, ML_ERROR_NONE);
+      EXPECT_TRUE (_data->tensors[1].tensor == NULL);
+    }
+
+    status = ml_tensors_data_destroy (data);
+    EXPECT_EQ (status, ML_ERROR_NONE);
+
+    status = ml_tensors_info_destroy (info);
+    EXPECT_EQ (status, ML_ERROR_NONE);
+  }
+
+  /* create the handle in other thread and release it in this thread */
+  ml_tensors_info_create (&info);
+  ml_tensors_info_set_count (info, 1);
+  ml_tensors_info_set_tensor_type (info, 0, ML_TENSOR_TYPE_UINT8);
+  ml_tensors_info_set_tensor_dimension (info, 0, dim);
+
+  for (i = 0; i < 4; i++) {
+    thread = g_thread_new ("test-create-data", test_create_data_thread, info);
+    data = (ml_tensors_data_h) g_thread_join (thread);
+    ASSERT_TRUE (data != NULL);
+
+    status = ml_tensors_data_destroy (data);
+    EXPECT_EQ (status, ML_ERROR_NONE);
+  }
+
+  ml_tensors_info_destroy (info);
+}
+
+/**
+ * @brief Test utility functions - share the tensors data with copy-on-write.
+ */
+TEST (nnstreamer_capi_util, data_ref_01_p)
+{
+  ml_tensors_info_h info;
+  ml_tensors_data_h data, ref1, ref2;
+  ml_tensor_dimension dim = { 4, 1, 1, 1 };
+  void *raw, *raw_ref;
+  size_t size;
+  int status;
+
+  ml_tensors_info_create (&info);
+  ml_tensors_info_set_count (info, 2);
+  ml_tensors_info_set_tensor_type (info, 0, ML_TENSOR_TYPE_UINT8);
+  ml_tensors_info_set_tensor_dimension (info, 0, dim);
+  ml_tensors_info_set_tensor_type (info, 1, ML_TENSOR_TYPE_UINT8);
+  ml_tensors_info_set_tensor_dimension (info, 1, dim);
+
+  status = ml_tensors_data_create (info, &data);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  ml_tensors_data_set_tensor_data (data, 0, "abcd", 4);
+  ml_tensors_data_set_tensor_data (data, 1, "efgh", 4);
+
+  status = ml_tensors_data_ref (data, &ref1);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_tensors_data_ref (data, &ref2);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  /* the handles share the tensors */
+  ml_tensors_data_get_tensor_data (data, 0, &raw, &size);
+  ml_tensors_data_get_tensor_data (ref1, 0, &raw_ref, &size);
+  EXPECT_TRUE (raw == raw_ref);
+  ml_tensors_data_get_tensor_data (ref2, 0, &raw_ref, &size);
+  EXPECT_TRUE (raw == raw_ref);
+
+  /* copy only the updated tensor */
+  status = ml_tensors_data_set_tensor_data (ref1, 0, "xy", 2);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  ml_tensors_data_get_tensor_data (ref1, 0, &raw_ref, &size);
+  EXPECT_TRUE (raw != raw_ref);
+  EXPECT_EQ (memcmp (raw_ref, "xycd", 4), 0);
+  EXPECT_EQ (memcmp (raw, "abcd", 4), 0);
+
+  ml_tensors_data_get_tensor_data (data, 1, &raw, &size);
+  ml_tensors_data_get_tensor_data (ref1, 1, &raw_ref, &size);
+  EXPECT_TRUE (raw == raw_ref);
+
+  /* the shared tensors are valid until all handles are released */
+  status = ml_tensors_data_destroy (data);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_tensors_data_unref (ref1);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  ml_tensors_data_get_tensor_data (ref2, 0, &raw, &size);
+  EXPECT_EQ (memcmp (raw, "abcd", 4), 0);
+
+  status = ml_tensors_data_unref (ref2);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  /* the tensors in a single block */
+  status = ml_tensors_data_create_full (info, ML_TENSORS_DATA_FLAG_CONTIGUOUS, NULL, &data);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_tensors_data_ref (data, &ref1);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_tensors_data_set_tensor_data (data, 1, "efgh", 4);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  /* the private copy is not shared with new handle */
+  status = ml_tensors_data_ref (data, &ref2);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  ml_tensors_data_get_tensor_data (data, 1, &raw, &size);
+  ml_tensors_data_get_tensor_data (ref2, 1, &raw_ref, &size);
+  EXPECT_TRUE (raw != raw_ref);
+  EXPECT_EQ (memcmp (raw_ref, "efgh", 4), 0);
+
+  /* the handles keep the single block after the copy */
+  status = ml_tensors_data_get_block_data (data, &raw, &size);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  ml_tensors_data_get_tensor_data (data, 0, &raw_ref, &size);
+  EXPECT_TRUE (raw == raw_ref);
+
+  status = ml_tensors_data_get_block_data (ref1, &raw_ref, &size);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_TRUE (raw != raw_ref);
+
+  status = ml_tensors_data_get_block_data (ref2, &raw_ref, &size);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_TRUE (raw != raw_ref);
+
+  status = ml_tensors_data_unref (ref1);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_data_unref (ref2);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_data_unref (data);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  ml_tensors_info_destroy (info);
+}
+
+/**
+ * @brief Test utility functions - share the tensors data with invalid param.
+ */
+TEST (nnstreamer_capi_util, data_ref_02_n)
+{
+  const char pipeline[] = "appsrc name=srcx ! other/tensor,dimension=(string)4:1:1:1,type=(string)uint8,framerate=(fraction)0/1 ! tensor_sink name=sinkx";
+  ml_pipeline_h handle;
+  ml_pipeline_src_h srchandle;
+  ml_tensors_info_h info;
+  ml_tensors_data_h data, ref;
+  ml_tensor_dimension dim = { 4, 1, 1, 1 };
+  int status;
+
+  ml_tensors_info_create (&info);
+  ml_tensors_info_set_count (info, 1);
+  ml_tensors_info_set_tensor_type (info, 0, ML_TENSOR_TYPE_UINT8);
+  ml_tensors_info_set_tensor_dimension (info, 0, dim);
+
+  status = ml_tensors_data_ref (NULL, &ref);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  status = ml_tensors_data_unref (NULL);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  /* the handle does not own the tensors */
+  status = _ml_tensors_data_create_no_alloc (info, &data);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_tensors_data_ref (data, &ref);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  status = _ml_tensors_data_destroy_internal (data, FALSE);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_tensors_data_create (info, &data);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_tensors_data_ref (data, NULL);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  /* the pipeline cannot free the shared tensors */
+  status = ml_tensors_data_ref (data, &ref);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_pipeline_construct (pipeline, NULL, NULL, &handle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_pipeline_src_get_handle (handle, "srcx", &srchandle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_pipeline_src_input_data (srchandle, ref, ML_PIPELINE_BUF_POLICY_AUTO_FREE);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  status = ml_pipeline_src_release_handle (srchandle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_pipeline_destroy (handle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_tensors_data_unref (ref);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_data_destroy (data);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  ml_tensors_info_destroy (info);
+}
+
+/**
+ * @brief Test utility functions - create the handles without lock.
+ */
+TEST (nnstreamer_capi_util, create_unlocked_01_p)
+{
+  ml_tensors_info_h info;
+  ml_tensors_data_h data;
+  ml_tensor_dimension dim = { 4, 1, 1, 1 };
+  ml_tensors_info_s *_info;
+  ml_tensors_data_s *_data;
+  void *raw;
+  size_t size;
+  int status;
+
+  status = ml_tensors_info_create_unlocked (&info);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  _info = (ml_tensors_info_s *) info;
+  EXPECT_NE (_info->nolock, 0);
+  EXPECT_TRUE (_info->owner == g_thread_self ());
+
+  ml_tensors_info_set_count (info, 1);
+  ml_tensors_info_set_tensor_type (info, 0, ML_TENSOR_TYPE_UINT8);
+  ml_tensors_info_set_tensor_dimension (info, 0, dim);
+
+  status = ml_tensors_data_create_unlocked (info, &data);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  _data = (ml_tensors_data_s *) data;
+  EXPECT_NE (_data->nolock, 0);
+  EXPECT_TRUE (_data->owner == g_thread_self ());
+  _info = (ml_tensors_info_s *) _data->info;
+  EXPECT_NE (_info->nolock, 0);
+
+  status = ml_tensors_data_set_tensor_data (data, 0, "abcd", 4);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_tensors_data_get_tensor_data (data, 0, &raw, &size);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (size, 4U);
+  EXPECT_EQ (memcmp (raw, "abcd", 4), 0);
+
+  status = ml_tensors_data_destroy (data);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  /* the handle reused from the cache has the lock */
+  status = ml_tensors_data_create (info, &data);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  _data = (ml_tensors_data_s *) data;
+  EXPECT_EQ (_data->nolock, 0);
+  EXPECT_TRUE (_data->owner == NULL);
+
+  status = ml_tensors_data_destroy (data);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_tensors_info_destroy (info);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+}
+
+/**
+ * @brief Test utility functions - create the handles without lock with invalid param.
+ */
+TEST (nnstreamer_capi_util, create_unlocked_02_n)
+{
+  ml_tensors_info_h info;
+  ml_tensors_data_h data;
+  int status;
+
+  status = ml_tensors_info_create_unlocked (NULL);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  status = ml_tensors_data_create_unlocked (NULL, &data);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  /* invalid tensors info */
+  status = ml_tensors_info_create_unlocked (&info);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_tensors_data_create_unlocked (info, &data);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  status = ml_tensors_data_create_unlocked (info, NULL);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  status = ml_tensors_info_destroy (info);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+}
+
+/**
+ * @brief Test utility functions - get the error message of the last error.
+ */
+TEST (nnstreamer_capi_util, error_message_01_p)
+{
+  const char *msg;
+  int status;
+
+  /* clear the message reported before */
+  ml_error ();
+  ml_error ();
+  EXPECT_TRUE (ml_error () == NULL);
+
+  status = ml_tensors_info_create (NULL);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  msg = ml_error ();
+  ASSERT_TRUE (msg != NULL);
+  EXPECT_TRUE (strstr (msg, "info") != NULL);
+
+  /* the message is returned once */
+  EXPECT_TRUE (ml_error () == NULL);
+}
+
+/**
+ * @brief Thread to report the error, which is not visible to other thread.
+ */
+static gpointer
+test_error_report_thread (gpointer user_data)
+{
+  int status;
+
+  status = ml_tensors_info_create (NULL);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  return GINT_TO_POINTER (ml_error () != NULL);
+}
+
+/**
+ * @brief Test utility functions - the error in other thread is not reported.
+ */
+TEST (nnstreamer_capi_util, error_message_02_n)
+{
+  GThread *thread;
+  gpointer reported;
+
+  ml_error ();
+  ml_error ();
+
+  thread = g_thread_new ("test-error-report", test_error_report_thread, NULL);
+  reported = g_thread_join (thread);
+
+  EXPECT_TRUE (GPOINTER_TO_INT (reported));
+  EXPECT_TRUE (ml_error () == NULL);
+}
+
+/**
+ * @brief Callback to sum the number of events in the call sites of given function.
+ */
+static void
+test_log_site_count_cb (const char *file, const char *func, int line,
+    unsigned int count, void *user_data)
+{
+  unsigned int *total = (unsigned int *) user_data;
+
+  if (g_str_equal (func, "ml_tensors_info_create"))
+    *total += count;
+}
+
+/**
+ * @brief Test utility functions - the errors are counted though the logs are rate-limited.
+ */
+TEST (nnstreamer_capi_util, error_log_count_01_p)
+{
+  unsigned int before = 0, after = 0;
+  int i, status;
+
+  status = ml_error_foreach_count (test_log_site_count_cb, &before);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  for (i = 0; i < ML_LOG_RATELIMIT_BURST * 5; i++) {
+    status = ml_tensors_info_create (NULL);
+    EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+    /* the message is kept even if the log is suppressed */
+    EXPECT_TRUE (ml_error () != NULL);
+  }
+
+  status = ml_error_foreach_count (test_log_site_count_cb, &after);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (after - before, (unsigned int) ML_LOG_RATELIMIT_BURST * 5);
+}
+
+/**
+ * @brief Test utility functions - iterate the call sites with invalid param.
+ */
+TEST (nnstreamer_capi_util, error_log_count_02_n)
+{
+  unsigned int before = 0, after = 0;
+  int status;
+
+  status = ml_error_foreach_count (NULL, NULL);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  status = ml_error_foreach_count (test_log_site_count_cb, &before);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  status = ml_error_foreach_count (NULL, &after);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+  status = ml_error_foreach_count (test_log_site_count_cb, &after);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  /* no event in ml_tensors_info_create without error */
+  EXPECT_EQ (after, before);
+}
+
+/**
+ * @brief The call site of the rate-limited log to test the concurrent events.
+ */
+static ml_log_site_s test_log_site = ML_LOG_SITE_INIT;
+
+/**
+ * @brief Thread to hit the call site of the rate-limited log.
+ */
+static gpointer
+test_log_site_hit_thread (gpointer data)
+{
+  guint suppressed, printed = 0;
+  int i;
+
+  for (i = 0; i < 100; i++) {
+    if (_ml_log_site_hit (&test_log_site, &suppressed))
+      printed++;
+  }
+
+  return GUINT_TO_POINTER (printed);
+}
+
+/**
+ * @brief Test utility functions (private) - the events from threads are counted and limited.
+ */
+TEST (nnstreamer_capi_util, error_log_count_03_p)
+{
+  GThread *threads[4];
+  guint printed = 0;
+  int i;
+
+  for (i = 0; i < 4; i++)
+    threads[i] = g_thread_new ("test-log-site", test_log_site_hit_thread, NULL);
+
+  for (i = 0; i < 4; i++)
+    printed += GPOINTER_TO_UINT (g_thread_join (threads[i]));
+
+  EXPECT_EQ (g_atomic_int_get (&test_log_site.count), 400);
+  EXPECT_GT (printed, 0U);
+  EXPECT_LT (printed, 400U);
+}
+
+/**
+ * @brief Test utility functions (private)
+ * @details check sub-plugin type and name
+ */
+TEST (nnstreamer_capi_util, nnfw_name_01_p)
+{
+  EXPECT_STREQ (_ml_get_nnfw_subplugin_name (ML_NNFW_TYPE_TENSORFLOW_LITE), "tensorflow-lite");
+  EXPECT_EQ (_ml_get_nnfw_type_by_subplugin_name ("tensorflow-lite"), ML_NNFW_TYPE_TENSORFLOW_LITE);
+  EXPECT_STREQ (_ml_get_nnfw_subplugin_name (ML_NNFW_TYPE_TENSORFLOW), "tensorflow");
+  EXPECT_EQ (_ml_get_nnfw_type_by_subplugin_name ("tensorflow"), ML_NNFW_TYPE_TENSORFLOW);
+  EXPECT_STREQ (_ml_get_nnfw_subplugin_name (ML_NNFW_TYPE_NNFW), "nnfw");
+  EXPECT_EQ (_ml_get_nnfw_type_by_subplugin_name ("nnfw"), ML_NNFW_TYPE_NNFW);
+  EXPECT_STREQ (_ml_get_nnfw_subplugin_name (ML_NNFW_TYPE_VIVANTE), "vivante");
+  EXPECT_EQ (_ml_get_nnfw_type_by_subplugin_name ("vivante"), ML_NNFW_TYPE_VIVANTE);
+  EXPECT_STREQ (_ml_get_nnfw_subplugin_name (ML_NNFW_TYPE_SNAP), "snap");
+  EXPECT_EQ (_ml_get_nnfw_type_by_subplugin_name ("snap"), ML_NNFW_TYPE_SNAP);
+}
+
+/**
+ * @brief Test utility functions (private)
+ * @details check sub-plugin type and name
+ */
+TEST (nnstreamer_capi_util, nnfw_name_02_n)
+{
+  EXPECT_EQ (_ml_get_nnfw_type_by_subplugin_name ("invalid-fw"), ML_NNFW_TYPE_ANY);
+  EXPECT_EQ (_ml_get_nnfw_type_by_subplugin_name (NULL), ML_NNFW_TYPE_ANY);
+}
+
+/**
+ * @brief Test NNStreamer single shot (tensorflow-lite)
+ */
+TEST (nnstreamer_capi_singleshot, invoke_invalid_param_01_n)
+{
+  ml_single_h single;
+  int status;
+  ml_tensors_info_h in_info;
+  ml_tensors_data_h input, output;
+
+  const gchar *root_path = g_getenv ("NNSTREAMER_SOURCE_ROOT_PATH");
+  gchar *test_model;
+
+  /* supposed to run test in build directory */
+  if (root_path == NULL)
+    root_path = "..";
+
+  test_model = g_build_filename (root_path, "tests", "test_models", "models",
+      "mobilenet_v1_1.0_224_quant.tflite", NULL);
+  ASSERT_TRUE (g_file_test (test_model, G_FILE_TEST_EXISTS));
+
+  status = ml_single_open (&single, test_model, NULL, NULL,
+      ML_NNFW_TYPE_TENSORFLOW_LITE, ML_NNFW_HW_ANY);
+  if (is_enabled_tensorflow_lite) {
+    EXPECT_EQ (status, ML_ERROR_NONE);
+  } else {
+    EXPECT_NE (status, ML_ERROR_NONE);
+    goto skip_test;
+  }
+
+  status = ml_single_get_input_info (single, &in_info);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_tensors_data_create (in_info, &input);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_single_invoke (NULL, input, &output);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  status = ml_single_invoke (single, NULL, &output);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  status = ml_single_invoke (single, input, NULL);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  status = ml_single_close (single);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  ml_tensors_data_destroy (input);
+  ml_tensors_info_destroy (in_info);
+
+skip_test:
+  g_free (test_model);
+}
+
+/**
+ * @brief Test NNStreamer single shot (tensorflow-lite)
+ */
+TEST (nnstreamer_capi_singleshot, invoke_invalid_param_02_n)
+{
+  ml_single_h single;
+  int status;
+  ml_tensors_info_h in_info;
+  ml_tensors_data_h input, output;
+  ml_tensor_dimension in_dim;
+
+  const gchar *root_path = g_getenv ("NNSTREAMER_SOURCE_ROOT_PATH");
+  gchar *test_model;
+
+  /* supposed to run test in build directory */
+  if (root_path == NULL)
+    root_path = "..";
+
+  test_model = g_build_filename (root_path, "tests", "test_models", "models",
+      "mobilenet_v1_1.0_224_quant.tflite", NULL);
+  ASSERT_TRUE (g_file_test (test_model, G_FILE_TEST_EXISTS));
+
+  status = ml_single_open (&single, test_model, NULL, NULL,
+      ML_NNFW_TYPE_TENSORFLOW_LITE, ML_NNFW_HW_ANY);
+  if (is_enabled_tensorflow_lite) {
+    EXPECT_EQ (status, ML_ERROR_NONE);
+  } else {
+    EXPECT_NE (status, ML_ERROR_NONE);
+    goto skip_test;
+  }
+
+  ml_tensors_info_create (&in_info);
+
+  in_dim[0] = 3;
+  in_dim[1] = 224;
+  in_dim[2] = 224;
+  in_dim[3] = 1;
+  ml_tensors_info_set_count (in_info, 1);
+  ml_tensors_info_set_tensor_type (in_info, 0, ML_TENSOR_TYPE_UINT8);
+  ml_tensors_info_set_tensor_dimension (in_info, 0, in_dim);
+
+  /* handle null data */
+  status = _ml_tensors_data_create_no_alloc (in_info, &input);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_single_invoke (single, input, &output);
+  EXPECT_NE (status, ML_ERROR_NONE);
+
+  ml_tensors_data_destroy (input);
+
+  /* set invalid type to test wrong data size */
+  ml_tensors_info_set_tensor_type (in_info, 0, ML_TENSOR_TYPE_UINT32);
+
+  status = ml_tensors_data_create (in_info, &input);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_single_invoke (single, input, &output);
+  EXPECT_NE (status, ML_ERROR_NONE);
+
+  ml_tensors_info_set_tensor_type (in_info, 0, ML_TENSOR_TYPE_UINT8);
+  ml_tensors_data_destroy (input);
+
+  /* set invalid input tensor number */
+  ml_tensors_info_set_count (in_info, 2);
+  ml_tensors_info_set_tensor_type (in_info, 1, ML_TENSOR_TYPE_UINT8);
+  ml_tensors_info_set_tensor_dimension (in_info, 1, in_dim);
+
+  status = ml_tensors_data_create (in_info, &input);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_single_invoke (single, input, &output);
+  EXPECT_NE (status, ML_ERROR_NONE);
+
+  ml_tensors_data_destroy (input);
+  ml_tensors_info_destroy (in_info);
+
+skip_test:
+  g_free (test_model);
+}
+
+/**
+ * @brief Test NNStreamer single shot (tensorflow-lite)
+ */
+TEST (nnstreamer_capi_singleshot, invoke_01)
+{
+  ml_single_h single;
+  ml_tensors_info_h in_info, out_info;
+  ml_tensors_info_h in_res, out_res;
+  ml_tensors_data_h input, output;
+  ml_tensor_dimension in_dim, out_dim, res_dim;
+  ml_tensor_type_e type = ML_TENSOR_TYPE_UNKNOWN;
+  unsigned int count = 0;
+  char *name = NULL;
+  int status;
+
+  const gchar *root_path = g_getenv ("NNSTREAMER_SOURCE_ROOT_PATH");
+  gchar *test_model;
+
+  /* supposed to run test in build directory */
+  if (root_path == NULL)
+    root_path = "..";
+
+  test_model = g_build_filename (root_path, "tests", "test_models", "models",
+      "mobilenet_v1_1.0_224_quant.tflite", NULL);
+  ASSERT_TRUE (g_file_test (test_model, G_FILE_TEST_EXISTS));
+
+  ml_tensors_info_create (&in_info);
+  ml_tensors_info_create (&out_info);
+
+  in_dim[0] = 3;
+  in_dim[1] = 224;
+  in_dim[2] = 224;
+  in_dim[3] = 1;
+  ml_tensors_info_set_count (in_info, 1);
+  ml_tensors_info_set_tensor_type (in_info, 0, ML_TENSOR_TYPE_UINT8);
+  ml_tensors_info_set_tensor_dimension (in_info, 0, in_dim);
+
+  out_dim[0] = 1001;
+  out_dim[1] = 1;
+  out_dim[2] = 1;
+  out_dim[3] = 1;
+  ml_tensors_info_set_count (out_info, 1);
+  ml_tensors_info_set_tensor_type (out_info, 0, ML_TENSOR_TYPE_UINT8);
+  ml_tensors_info_set_tensor_dimension (out_info, 0, out_dim);
+
+  status = ml_single_open (&single, test_model, in_info, out_info,
+      ML_NNFW_TYPE_TENSORFLOW_LITE, ML_NNFW_HW_ANY);
+  if (is_enabled_tensorflow_lite) {
+    EXPECT_EQ (status, ML_ERROR_NONE);
+  } else {
+    EXPECT_NE (status, ML_ERROR_NONE);
+    goto skip_test;
+  }
+
+  /* input tensor in filter */
+  status = ml_single_get_input_info (single, &in_res);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_tensors_info_get_count (in_res, &count);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (count, 1U);
+
+  status = ml_tensors_info_get_tensor_name (in_res, 0, &name);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  g_free (name);
+
+  status = ml_tensors_info_get_tensor_type (in_res, 0, &type);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (type, ML_TENSOR_TYPE_UINT8);
+
+  ml_tensors_info_get_tensor_dimension (in_res, 0, res_dim);
+  EXPECT_TRUE (in_dim[0] == res_dim[0]);
+  EXPECT_TRUE (in_dim[1] == res_dim[1]);
+  EXPECT_TRUE (in_dim[2] == res_dim[2]);
+  EXPECT_TRUE (in_dim[3] == res_dim[3]);
+
+  /* output tensor in filter */
+  status = ml_single_get_output_info (single, &out_res);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_tensors_info_get_count (out_res, &count);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (count, 1U);
+
+  status = ml_tensors_info_get_tensor_name (out_res, 0, &name);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  g_free (name);
+
+  status = ml_tensors_info_get_tensor_type (out_res, 0, &type);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (type, ML_TENSOR_TYPE_UINT8);
+
+  ml_tensors_info_get_tensor_dimension (out_res, 0, res_dim);
+  EXPECT_TRUE (out_dim[0] == res_dim[0]);
+  EXPECT_TRUE (out_dim[1] == res_dim[1]);
+  EXPECT_TRUE (out_dim[2] == res_dim[2]);
+  EXPECT_TRUE (out_dim[3] == res_dim[3]);
+
+  input = output = NULL;
+
+  /* generate dummy data */
+  status = ml_tensors_data_create (in_info, &input);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_TRUE (input != NULL);
+
+  status = ml_single_set_timeout (single, SINGLE_DEF_TIMEOUT_MSEC);
+  EXPECT_TRUE (status == ML_ERROR_NOT_SUPPORTED || status == ML_ERROR_NONE);
+
+  status = ml_single_invoke (single, input, &output);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_TRUE (output != NULL);
+
+  status = ml_single_close (single);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  ml_tensors_data_destroy (output);
+  ml_tensors_data_destroy (input);
+  ml_tensors_info_destroy (in_res);
+  ml_tensors_info_destroy (out_res);
+
+skip_test:
+  g_free (test_model);
+  ml_tensors_info_destroy (in_info);
+  ml_tensors_info_destroy (out_info);
+}
+
+/**
+ * @brief Test NNStreamer single shot (tensorflow-lite)
+ * @detail Start pipeline without tensor info
+ */
+TEST (nnstreamer_capi_singleshot, invoke_02)
+{
+  ml_single_h single;
+  ml_tensors_info_h in_info;
+  ml_tensors_data_h input, output;
+  int status;
+
+  const gchar *root_path = g_getenv ("NNSTREAMER_SOURCE_ROOT_PATH");
+  gchar *test_model;
+
+  /* supposed to run test in build directory */
+  if (root_path == NULL)
+    root_path = "..";
+
+  test_model = g_build_filename (root_path, "tests", "test_models", "models",
+      "mobilenet_v1_1.0_224_quant.tflite", NULL);
+  ASSERT_TRUE (g_file_test (test_model, G_FILE_TEST_EXISTS));
+
+  status = ml_single_open (&single, test_model, NULL, NULL,
+      ML_NNFW_TYPE_TENSORFLOW_LITE, ML_NNFW_HW_ANY);
+  if (is_enabled_tensorflow_lite) {
+    EXPECT_EQ (status, ML_ERROR_NONE);
+  } else {
+    EXPECT_NE (status, ML_ERROR_NONE);
+    goto skip_test;
+  }
+
+  status = ml_single_get_input_info (single, &in_info);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  input = output = NULL;
+
+  /* generate dummy data */
+  status = ml_tensors_data_create (in_info, &input);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_TRUE (input != NULL);
+
+  status = ml_single_set_timeout (single, SINGLE_DEF_TIMEOUT_MSEC);
+  EXPECT_TRUE (status == ML_ERROR_NOT_SUPPORTED || status == ML_ERROR_NONE);
+
+  status = ml_single_invoke (single, input, &output);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_TRUE (output != NULL);
+
+  status = ml_single_close (single);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  ml_tensors_data_destroy (output);
+  ml_tensors_data_destroy (input);
+  ml_tensors_info_destroy (in_info);
+skip_test:
+  g_free (test_model);
+}
+
+/**
+ * @brief Measure the loading time and total time for the run
+ */
+static void
+benchmark_single (const gboolean no_alloc, const gboolean no_timeout, const int count)
+{
+  ml_single_h single;
+  ml_tensors_info_h in_info, out_info;
+  ml_tensors_data_h input, output;
+  ml_tensor_dimension in_dim, out_dim;
+  int status;
+  unsigned long open_duration = 0, invoke_duration = 0, close_duration = 0;
+  gint64 start, end;
+
+  const gchar *root_path = g_getenv ("NNSTREAMER_SOURCE_ROOT_PATH");
+  gchar *test_model;
+
+  /* supposed to run test in build directory */
+  if (root_path == NULL)
+    root_path = "..";
+
+  test_model = g_build_filename (root_path, "tests", "test_models", "models",
+      "mobilenet_v1_1.0_224_quant.tflite", NULL);
+  ASSERT_TRUE (g_file_test (test_model, G_FILE_TEST_EXISTS));
 
   ml_tensors_info_create (&in_info);
   ml_tensors_info_create (&out_info);
@@ -5181,26 +8539,249 @@ TEST (nnstreamer_capi_singleshot, property_02_n)
   status = ml_single_set_property (single, "unknown_prop", "INVALID");
   EXPECT_NE (status, ML_ERROR_NONE);
 
-  /* null params */
-  status = ml_single_set_property (single, "input", NULL);
-  EXPECT_NE (status, ML_ERROR_NONE);
+  /* null params */
+  status = ml_single_set_property (single, "input", NULL);
+  EXPECT_NE (status, ML_ERROR_NONE);
+
+  status = ml_single_set_property (single, NULL, "INVALID");
+  EXPECT_NE (status, ML_ERROR_NONE);
+
+  status = ml_single_get_property (single, "input", NULL);
+  EXPECT_NE (status, ML_ERROR_NONE);
+
+  status = ml_single_get_property (single, NULL, &prop_value);
+  EXPECT_NE (status, ML_ERROR_NONE);
+  g_free (prop_value);
+
+  /* dimension should be valid */
+  status = ml_single_get_property (single, "input", &prop_value);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  EXPECT_STREQ (prop_value, "3:224:224:1");
+  g_free (prop_value);
+
+  status = ml_single_close (single);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+skip_test:
+  g_free (test_model);
+}
+
+/**
+ * @brief Test NNStreamer single shot (tensorflow-lite)
+ * @detail Failure case to set meta property
+ */
+TEST (nnstreamer_capi_singleshot, property_03_n)
+{
+  ml_single_h single;
+  ml_tensors_info_h in_info, out_info;
+  ml_tensor_dimension in_dim, out_dim;
+  ml_tensors_data_h input, output;
+  ml_tensor_type_e type = ML_TENSOR_TYPE_UNKNOWN;
+  int status;
+  unsigned int count = 0;
+  char *name = NULL;
+  char *prop_value = NULL;
+  void *data;
+  size_t data_size;
+
+  const gchar *root_path = g_getenv ("NNSTREAMER_SOURCE_ROOT_PATH");
+  gchar *test_model;
+
+  /* supposed to run test in build directory */
+  if (root_path == NULL)
+    root_path = "..";
+
+  test_model = g_build_filename (root_path, "tests", "test_models", "models",
+      "mobilenet_v1_1.0_224_quant.tflite", NULL);
+  ASSERT_TRUE (g_file_test (test_model, G_FILE_TEST_EXISTS));
+
+  status = ml_single_open (&single, test_model, NULL, NULL,
+      ML_NNFW_TYPE_TENSORFLOW_LITE, ML_NNFW_HW_ANY);
+  if (is_enabled_tensorflow_lite) {
+    EXPECT_EQ (status, ML_ERROR_NONE);
+  } else {
+    EXPECT_NE (status, ML_ERROR_NONE);
+    goto skip_test;
+  }
+
+  /* failed to set dimension */
+  status = ml_single_set_property (single, "input", "3:4:4:1");
+  EXPECT_NE (status, ML_ERROR_NONE);
+
+  status = ml_single_get_property (single, "input", &prop_value);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  EXPECT_STREQ (prop_value, "3:224:224:1");
+  g_free (prop_value);
+
+  /* input tensor in filter */
+  status = ml_single_get_input_info (single, &in_info);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_tensors_info_get_count (in_info, &count);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (count, 1U);
+
+  status = ml_tensors_info_get_tensor_name (in_info, 0, &name);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  g_free (name);
+
+  status = ml_tensors_info_get_tensor_type (in_info, 0, &type);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (type, ML_TENSOR_TYPE_UINT8);
+
+  ml_tensors_info_get_tensor_dimension (in_info, 0, in_dim);
+  EXPECT_EQ (in_dim[0], 3U);
+  EXPECT_EQ (in_dim[1], 224U);
+  EXPECT_EQ (in_dim[2], 224U);
+  EXPECT_EQ (in_dim[3], 1U);
+
+  /* output tensor in filter */
+  status = ml_single_get_output_info (single, &out_info);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_tensors_info_get_count (out_info, &count);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (count, 1U);
+
+  status = ml_tensors_info_get_tensor_name (out_info, 0, &name);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  g_free (name);
+
+  status = ml_tensors_info_get_tensor_type (out_info, 0, &type);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (type, ML_TENSOR_TYPE_UINT8);
+
+  ml_tensors_info_get_tensor_dimension (out_info, 0, out_dim);
+  EXPECT_EQ (out_dim[0], 1001U);
+  EXPECT_EQ (out_dim[1], 1U);
+  EXPECT_EQ (out_dim[2], 1U);
+  EXPECT_EQ (out_dim[3], 1U);
+
+  /* invoke */
+  input = output = NULL;
+
+  /* generate dummy data */
+  status = ml_tensors_data_create (in_info, &input);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_TRUE (input != NULL);
+
+  status = ml_single_set_timeout (single, SINGLE_DEF_TIMEOUT_MSEC);
+  EXPECT_TRUE (status == ML_ERROR_NOT_SUPPORTED || status == ML_ERROR_NONE);
+
+  status = ml_single_invoke (single, input, &output);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_TRUE (output != NULL);
+
+  status = ml_tensors_data_get_tensor_data (output, 0, (void **)&data, &data_size);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (data_size, 1001U);
+
+  status = ml_single_close (single);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  ml_tensors_data_destroy (input);
+  ml_tensors_data_destroy (output);
+  ml_tensors_info_destroy (in_info);
+  ml_tensors_info_destroy (out_info);
+
+skip_test:
+  g_free (test_model);
+}
+
+/**
+ * @brief Test NNStreamer single shot (tensorflow-lite)
+ * @detail Update dimension for input tensor
+ */
+TEST (nnstreamer_capi_singleshot, property_04_p)
+{
+  ml_single_h single;
+  ml_tensors_info_h in_info, out_info;
+  ml_tensors_data_h input, output;
+  ml_tensor_dimension in_dim, out_dim;
+  char *prop_value;
+  int status;
+  size_t data_size;
+  float *data;
+
+  const gchar *root_path = g_getenv ("NNSTREAMER_SOURCE_ROOT_PATH");
+  gchar *test_model;
+
+  /* supposed to run test in build directory */
+  if (root_path == NULL)
+    root_path = "..";
+
+  /** add.tflite adds value 2 to all the values in the input */
+  test_model = g_build_filename (
+      root_path, "tests", "test_models", "models", "add.tflite", NULL);
+  ASSERT_TRUE (g_file_test (test_model, G_FILE_TEST_EXISTS));
+
+  status = ml_single_open (&single, test_model, NULL, NULL,
+      ML_NNFW_TYPE_TENSORFLOW_LITE, ML_NNFW_HW_ANY);
+  if (is_enabled_tensorflow_lite) {
+    EXPECT_EQ (status, ML_ERROR_NONE);
+  } else {
+    EXPECT_NE (status, ML_ERROR_NONE);
+    goto skip_test;
+  }
+
+  status = ml_single_set_property (single, "input", "5:1:1:1");
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_single_get_property (single, "input", &prop_value);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  EXPECT_STREQ (prop_value, "5:1:1:1");
+  g_free (prop_value);
+
+  /* validate in/out info */
+  status = ml_single_get_input_info (single, &in_info);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  ml_tensors_info_get_tensor_dimension (in_info, 0, in_dim);
+  EXPECT_EQ (in_dim[0], 5U);
+  EXPECT_EQ (in_dim[1], 1U);
+  EXPECT_EQ (in_dim[2], 1U);
+  EXPECT_EQ (in_dim[3], 1U);
+
+  status = ml_single_get_output_info (single, &out_info);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  ml_tensors_info_get_tensor_dimension (out_info, 0, out_dim);
+  EXPECT_EQ (out_dim[0], 5U);
+  EXPECT_EQ (out_dim[1], 1U);
+  EXPECT_EQ (out_dim[2], 1U);
+  EXPECT_EQ (out_dim[3], 1U);
+
+  /* invoke */
+  input = output = NULL;
 
-  status = ml_single_set_property (single, NULL, "INVALID");
-  EXPECT_NE (status, ML_ERROR_NONE);
+  /* generate dummy data */
+  status = ml_tensors_data_create (in_info, &input);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_TRUE (input != NULL);
 
-  status = ml_single_get_property (single, "input", NULL);
-  EXPECT_NE (status, ML_ERROR_NONE);
+  status = ml_tensors_data_get_tensor_data (input, 0, (void **)&data, &data_size);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (data_size, 5 * sizeof (float));
+  for (int idx = 0; idx < 5; idx++)
+    data[idx] = idx;
 
-  status = ml_single_get_property (single, NULL, &prop_value);
-  EXPECT_NE (status, ML_ERROR_NONE);
-  g_free (prop_value);
+  status = ml_single_invoke (single, input, &output);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_TRUE (output != NULL);
 
-  /* dimension should be valid */
-  status = ml_single_get_property (single, "input", &prop_value);
+  status = ml_tensors_data_get_tensor_data (output, 0, (void **)&data, &data_size);
   EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (data_size, 5 * sizeof (float));
+  for (int idx = 0; idx < 5; idx++)
+    EXPECT_EQ (data[idx], idx + 2);
 
-  EXPECT_STREQ (prop_value, "3:224:224:1");
-  g_free (prop_value);
+  ml_tensors_data_destroy (input);
+  ml_tensors_data_destroy (output);
+  ml_tensors_info_destroy (in_info);
+  ml_tensors_info_destroy (out_info);
 
   status = ml_single_close (single);
   EXPECT_EQ (status, ML_ERROR_NONE);
@@ -5209,23 +8790,21 @@ skip_test:
   g_free (test_model);
 }
 
+#ifdef ENABLE_NNFW_RUNTIME
 /**
- * @brief Test NNStreamer single shot (tensorflow-lite)
- * @detail Failure case to set meta property
+ * @brief Test NNStreamer single shot (nnfw backend)
  */
-TEST (nnstreamer_capi_singleshot, property_03_n)
+TEST (nnstreamer_capi_singleshot, invoke_05)
 {
   ml_single_h single;
   ml_tensors_info_h in_info, out_info;
-  ml_tensor_dimension in_dim, out_dim;
+  ml_tensors_info_h in_res, out_res;
   ml_tensors_data_h input, output;
+  ml_tensor_dimension in_dim, out_dim, res_dim;
   ml_tensor_type_e type = ML_TENSOR_TYPE_UNKNOWN;
-  int status;
   unsigned int count = 0;
   char *name = NULL;
-  char *prop_value = NULL;
-  void *data;
-  size_t data_size;
+  int status;
 
   const gchar *root_path = g_getenv ("NNSTREAMER_SOURCE_ROOT_PATH");
   gchar *test_model;
@@ -5234,74 +8813,77 @@ TEST (nnstreamer_capi_singleshot, property_03_n)
   if (root_path == NULL)
     root_path = "..";
 
-  test_model = g_build_filename (root_path, "tests", "test_models", "models",
-      "mobilenet_v1_1.0_224_quant.tflite", NULL);
+  test_model = g_build_filename (
+      root_path, "tests", "test_models", "models", "add.tflite", NULL);
   ASSERT_TRUE (g_file_test (test_model, G_FILE_TEST_EXISTS));
 
-  status = ml_single_open (&single, test_model, NULL, NULL,
-      ML_NNFW_TYPE_TENSORFLOW_LITE, ML_NNFW_HW_ANY);
-  if (is_enabled_tensorflow_lite) {
-    EXPECT_EQ (status, ML_ERROR_NONE);
-  } else {
-    EXPECT_NE (status, ML_ERROR_NONE);
-    goto skip_test;
-  }
+  ml_tensors_info_create (&in_info);
+  ml_tensors_info_create (&out_info);
 
-  /* failed to set dimension */
-  status = ml_single_set_property (single, "input", "3:4:4:1");
-  EXPECT_NE (status, ML_ERROR_NONE);
+  in_dim[0] = 1;
+  in_dim[1] = 1;
+  in_dim[2] = 1;
+  in_dim[3] = 1;
+  ml_tensors_info_set_count (in_info, 1);
+  ml_tensors_info_set_tensor_type (in_info, 0, ML_TENSOR_TYPE_FLOAT32);
+  ml_tensors_info_set_tensor_dimension (in_info, 0, in_dim);
 
-  status = ml_single_get_property (single, "input", &prop_value);
-  EXPECT_EQ (status, ML_ERROR_NONE);
+  out_dim[0] = 1;
+  out_dim[1] = 1;
+  out_dim[2] = 1;
+  out_dim[3] = 1;
+  ml_tensors_info_set_count (out_info, 1);
+  ml_tensors_info_set_tensor_type (out_info, 0, ML_TENSOR_TYPE_FLOAT32);
+  ml_tensors_info_set_tensor_dimension (out_info, 0, out_dim);
 
-  EXPECT_STREQ (prop_value, "3:224:224:1");
-  g_free (prop_value);
+  status = ml_single_open (
+      &single, test_model, in_info, out_info, ML_NNFW_TYPE_NNFW, ML_NNFW_HW_ANY);
+  ASSERT_EQ (status, ML_ERROR_NONE);
 
   /* input tensor in filter */
-  status = ml_single_get_input_info (single, &in_info);
+  status = ml_single_get_input_info (single, &in_res);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_tensors_info_get_count (in_info, &count);
+  status = ml_tensors_info_get_count (in_res, &count);
   EXPECT_EQ (status, ML_ERROR_NONE);
   EXPECT_EQ (count, 1U);
 
-  status = ml_tensors_info_get_tensor_name (in_info, 0, &name);
+  status = ml_tensors_info_get_tensor_name (in_res, 0, &name);
   EXPECT_EQ (status, ML_ERROR_NONE);
   g_free (name);
 
-  status = ml_tensors_info_get_tensor_type (in_info, 0, &type);
+  status = ml_tensors_info_get_tensor_type (in_res, 0, &type);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (type, ML_TENSOR_TYPE_UINT8);
+  EXPECT_EQ (type, ML_TENSOR_TYPE_FLOAT32);
 
-  ml_tensors_info_get_tensor_dimension (in_info, 0, in_dim);
-  EXPECT_EQ (in_dim[0], 3U);
-  EXPECT_EQ (in_dim[1], 224U);
-  EXPECT_EQ (in_dim[2], 224U);
-  EXPECT_EQ (in_dim[3], 1U);
+  ml_tensors_info_get_tensor_dimension (in_res, 0, res_dim);
+  EXPECT_TRUE (in_dim[0] == res_dim[0]);
+  EXPECT_TRUE (in_dim[1] == res_dim[1]);
+  EXPECT_TRUE (in_dim[2] == res_dim[2]);
+  EXPECT_TRUE (in_dim[3] == res_dim[3]);
 
   /* output tensor in filter */
-  status = ml_single_get_output_info (single, &out_info);
+  status = ml_single_get_output_info (single, &out_res);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_tensors_info_get_count (out_info, &count);
+  status = ml_tensors_info_get_count (out_res, &count);
   EXPECT_EQ (status, ML_ERROR_NONE);
   EXPECT_EQ (count, 1U);
 
-  status = ml_tensors_info_get_tensor_name (out_info, 0, &name);
+  status = ml_tensors_info_get_tensor_name (out_res, 0, &name);
   EXPECT_EQ (status, ML_ERROR_NONE);
   g_free (name);
 
-  status = ml_tensors_info_get_tensor_type (out_info, 0, &type);
+  status = ml_tensors_info_get_tensor_type (out_res, 0, &type);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (type, ML_TENSOR_TYPE_UINT8);
+  EXPECT_EQ (type, ML_TENSOR_TYPE_FLOAT32);
 
-  ml_tensors_info_get_tensor_dimension (out_info, 0, out_dim);
-  EXPECT_EQ (out_dim[0], 1001U);
-  EXPECT_EQ (out_dim[1], 1U);
-  EXPECT_EQ (out_dim[2], 1U);
-  EXPECT_EQ (out_dim[3], 1U);
+  ml_tensors_info_get_tensor_dimension (out_res, 0, res_dim);
+  EXPECT_TRUE (out_dim[0] == res_dim[0]);
+  EXPECT_TRUE (out_dim[1] == res_dim[1]);
+  EXPECT_TRUE (out_dim[2] == res_dim[2]);
+  EXPECT_TRUE (out_dim[3] == res_dim[3]);
 
-  /* invoke */
   input = output = NULL;
 
   /* generate dummy data */
@@ -5316,127 +8898,226 @@ TEST (nnstreamer_capi_singleshot, property_03_n)
   EXPECT_EQ (status, ML_ERROR_NONE);
   EXPECT_TRUE (output != NULL);
 
-  status = ml_tensors_data_get_tensor_data (output, 0, (void **)&data, &data_size);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (data_size, 1001U);
-
   status = ml_single_close (single);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  ml_tensors_data_destroy (input);
   ml_tensors_data_destroy (output);
+  ml_tensors_data_destroy (input);
+
+  g_free (test_model);
   ml_tensors_info_destroy (in_info);
   ml_tensors_info_destroy (out_info);
+  ml_tensors_info_destroy (in_res);
+  ml_tensors_info_destroy (out_res);
+}
+
+/**
+ * @brief Test NNStreamer single shot (nnfw backend using model path)
+ */
+TEST (nnstreamer_capi_singleshot, open_dir)
+{
+  ml_single_h single;
+  int status;
+
+  const gchar *root_path = g_getenv ("NNSTREAMER_SOURCE_ROOT_PATH");
+  gchar *test_model;
+
+  /* supposed to run test in build directory */
+  if (root_path == NULL)
+    root_path = "..";
+
+  test_model = g_build_filename (root_path, "tests", "test_models", "models", NULL);
+  ASSERT_TRUE (g_file_test (test_model, G_FILE_TEST_EXISTS));
+
+  status = ml_single_open (&single, test_model, NULL, NULL, ML_NNFW_TYPE_NNFW, ML_NNFW_HW_ANY);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_single_close (single);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-skip_test:
   g_free (test_model);
 }
 
+#endif /* ENABLE_NNFW_RUNTIME */
+
+#ifdef ENABLE_ARMNN
 /**
- * @brief Test NNStreamer single shot (tensorflow-lite)
- * @detail Update dimension for input tensor
+ * @brief Test NNStreamer single shot (caffe/armnn)
+ * @detail Run pipeline with caffe lenet model.
  */
-TEST (nnstreamer_capi_singleshot, property_04_p)
+TEST (nnstreamer_capi_singleshot, invoke_06)
 {
   ml_single_h single;
   ml_tensors_info_h in_info, out_info;
+  ml_tensors_info_h in_res, out_res;
   ml_tensors_data_h input, output;
-  ml_tensor_dimension in_dim, out_dim;
-  char *prop_value;
-  int status;
+  ml_tensor_dimension in_dim, out_dim, res_dim;
+  ml_tensor_type_e type = ML_TENSOR_TYPE_UNKNOWN;
+  unsigned int count = 0;
+  char *name = NULL;
+  int status, max_score_index;
+  float score, max_score;
+  void *data_ptr;
   size_t data_size;
-  float *data;
 
   const gchar *root_path = g_getenv ("NNSTREAMER_SOURCE_ROOT_PATH");
-  gchar *test_model;
+  gchar *test_model, *test_file;
+  guint8 *contents_uint8 = NULL;
+  gfloat *contents_float = NULL;
+  gsize len = 0;
 
   /* supposed to run test in build directory */
   if (root_path == NULL)
     root_path = "..";
 
-  /** add.tflite adds value 2 to all the values in the input */
-  test_model = g_build_filename (
-      root_path, "tests", "test_models", "models", "add.tflite", NULL);
+  test_model = g_build_filename (root_path, "tests", "test_models", "models",
+      "lenet_iter_9000.caffemodel", NULL);
   ASSERT_TRUE (g_file_test (test_model, G_FILE_TEST_EXISTS));
 
-  status = ml_single_open (&single, test_model, NULL, NULL,
-      ML_NNFW_TYPE_TENSORFLOW_LITE, ML_NNFW_HW_ANY);
-  if (is_enabled_tensorflow_lite) {
-    EXPECT_EQ (status, ML_ERROR_NONE);
-  } else {
-    EXPECT_NE (status, ML_ERROR_NONE);
-    goto skip_test;
+  test_file = g_build_filename (root_path, "tests", "test_models", "data", "9.raw", NULL);
+  ASSERT_TRUE (g_file_test (test_file, G_FILE_TEST_EXISTS));
+
+  ml_tensors_info_create (&in_info);
+  ml_tensors_info_create (&out_info);
+
+  in_dim[0] = 28;
+  in_dim[1] = 28;
+  in_dim[2] = 1;
+  in_dim[3] = 1;
+  ml_tensors_info_set_count (in_info, 1);
+  ml_tensors_info_set_tensor_name (in_info, 0, "data");
+  ml_tensors_info_set_tensor_type (in_info, 0, ML_TENSOR_TYPE_FLOAT32);
+  ml_tensors_info_set_tensor_dimension (in_info, 0, in_dim);
+
+  out_dim[0] = 10;
+  out_dim[1] = 1;
+  out_dim[2] = 1;
+  out_dim[3] = 1;
+  ml_tensors_info_set_count (out_info, 1);
+  ml_tensors_info_set_tensor_name (out_info, 0, "prob");
+  ml_tensors_info_set_tensor_type (out_info, 0, ML_TENSOR_TYPE_FLOAT32);
+  ml_tensors_info_set_tensor_dimension (out_info, 0, out_dim);
+
+  ASSERT_TRUE (g_file_get_contents (test_file, (gchar **)&contents_uint8, &len, NULL));
+  status = ml_tensors_info_get_tensor_size (in_info, 0, &data_size);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  ASSERT_TRUE (len == data_size / sizeof (float));
+
+  /** Convert uint8 data with range [0, 255] to float with range [-1, 1] */
+  contents_float = (gfloat *)g_malloc (data_size);
+  for (unsigned int idx = 0; idx < len; idx++) {
+    contents_float[idx] = static_cast<float> (contents_uint8[idx]);
+    contents_float[idx] -= 127.5;
+    contents_float[idx] /= 127.5;
   }
 
-  status = ml_single_set_property (single, "input", "5:1:1:1");
+  status = ml_single_open (&single, test_model, in_info, out_info,
+      ML_NNFW_TYPE_ARMNN, ML_NNFW_HW_ANY);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+
+  /* input tensor in filter */
+  status = ml_single_get_input_info (single, &in_res);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_tensors_info_get_count (in_res, &count);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (count, 1U);
+
+  status = ml_tensors_info_get_tensor_name (in_res, 0, &name);
   EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_STREQ (name, "data");
+  g_free (name);
 
-  status = ml_single_get_property (single, "input", &prop_value);
+  status = ml_tensors_info_get_tensor_type (in_res, 0, &type);
   EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (type, ML_TENSOR_TYPE_FLOAT32);
 
-  EXPECT_STREQ (prop_value, "5:1:1:1");
-  g_free (prop_value);
+  ml_tensors_info_get_tensor_dimension (in_res, 0, res_dim);
+  EXPECT_TRUE (in_dim[0] == res_dim[0]);
+  EXPECT_TRUE (in_dim[1] == res_dim[1]);
+  EXPECT_TRUE (in_dim[2] == res_dim[2]);
+  EXPECT_TRUE (in_dim[3] == res_dim[3]);
 
-  /* validate in/out info */
-  status = ml_single_get_input_info (single, &in_info);
+  /* output tensor in filter */
+  status = ml_single_get_output_info (single, &out_res);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  ml_tensors_info_get_tensor_dimension (in_info, 0, in_dim);
-  EXPECT_EQ (in_dim[0], 5U);
-  EXPECT_EQ (in_dim[1], 1U);
-  EXPECT_EQ (in_dim[2], 1U);
-  EXPECT_EQ (in_dim[3], 1U);
+  status = ml_tensors_info_get_count (out_res, &count);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (count, 1U);
 
-  status = ml_single_get_output_info (single, &out_info);
+  status = ml_tensors_info_get_tensor_name (out_res, 0, &name);
   EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_STREQ (name, "prob");
+  g_free (name);
 
-  ml_tensors_info_get_tensor_dimension (out_info, 0, out_dim);
-  EXPECT_EQ (out_dim[0], 5U);
-  EXPECT_EQ (out_dim[1], 1U);
-  EXPECT_EQ (out_dim[2], 1U);
-  EXPECT_EQ (out_dim[3], 1U);
+  status = ml_tensors_info_get_tensor_type (out_res, 0, &type);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (type, ML_TENSOR_TYPE_FLOAT32);
+
+  ml_tensors_info_get_tensor_dimension (out_res, 0, res_dim);
+  EXPECT_TRUE (out_dim[0] == res_dim[0]);
+  EXPECT_TRUE (out_dim[1] == res_dim[1]);
+  EXPECT_TRUE (out_dim[2] == res_dim[2]);
+  EXPECT_TRUE (out_dim[3] == res_dim[3]);
 
-  /* invoke */
   input = output = NULL;
 
-  /* generate dummy data */
+  /* generate input data */
   status = ml_tensors_data_create (in_info, &input);
   EXPECT_EQ (status, ML_ERROR_NONE);
   EXPECT_TRUE (input != NULL);
 
-  status = ml_tensors_data_get_tensor_data (input, 0, (void **)&data, &data_size);
+  status = ml_tensors_data_set_tensor_data (input, 0, contents_float, data_size);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (data_size, 5 * sizeof (float));
-  for (int idx = 0; idx < 5; idx++)
-    data[idx] = idx;
+
+  status = ml_single_set_timeout (single, SINGLE_DEF_TIMEOUT_MSEC);
+  EXPECT_TRUE (status == ML_ERROR_NOT_SUPPORTED || status == ML_ERROR_NONE);
 
   status = ml_single_invoke (single, input, &output);
   EXPECT_EQ (status, ML_ERROR_NONE);
   EXPECT_TRUE (output != NULL);
 
-  status = ml_tensors_data_get_tensor_data (output, 0, (void **)&data, &data_size);
+  status = ml_tensors_data_get_tensor_data (output, 1, &data_ptr, &data_size);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  status = ml_tensors_data_get_tensor_data (output, 0, &data_ptr, &data_size);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (data_size, 5 * sizeof (float));
-  for (int idx = 0; idx < 5; idx++)
-    EXPECT_EQ (data[idx], idx + 2);
 
-  ml_tensors_data_destroy (input);
-  ml_tensors_data_destroy (output);
-  ml_tensors_info_destroy (in_info);
-  ml_tensors_info_destroy (out_info);
+  max_score = .0;
+  max_score_index = 0;
+  for (gint i = 0; i < 10; i++) {
+    score = ((float *)data_ptr)[i];
+    if (score > max_score) {
+      max_score = score;
+      max_score_index = i;
+    }
+  }
+
+  EXPECT_EQ (max_score_index, 9);
 
   status = ml_single_close (single);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-skip_test:
+  ml_tensors_data_destroy (output);
+  ml_tensors_data_destroy (input);
+
   g_free (test_model);
+  g_free (test_file);
+  g_free (contents_uint8);
+  g_free (contents_float);
+  ml_tensors_info_destroy (in_info);
+  ml_tensors_info_destroy (out_info);
+  ml_tensors_info_destroy (in_res);
+  ml_tensors_info_destroy (out_res);
 }
 
-#ifdef ENABLE_NNFW_RUNTIME
 /**
- * @brief Test NNStreamer single shot (nnfw backend)
+ * @brief Test NNStreamer single shot (tflite/armnn)
+ * @detail Run pipeline with tflite basic model.
  */
-TEST (nnstreamer_capi_singleshot, invoke_05)
+TEST (nnstreamer_capi_singleshot, invoke_07)
 {
   ml_single_h single;
   ml_tensors_info_h in_info, out_info;
@@ -5447,6 +9128,8 @@ TEST (nnstreamer_capi_singleshot, invoke_05)
   unsigned int count = 0;
   char *name = NULL;
   int status;
+  void *data_ptr;
+  size_t data_size;
 
   const gchar *root_path = g_getenv ("NNSTREAMER_SOURCE_ROOT_PATH");
   gchar *test_model;
@@ -5478,8 +9161,7 @@ TEST (nnstreamer_capi_singleshot, invoke_05)
   ml_tensors_info_set_tensor_type (out_info, 0, ML_TENSOR_TYPE_FLOAT32);
   ml_tensors_info_set_tensor_dimension (out_info, 0, out_dim);
 
-  status = ml_single_open (
-      &single, test_model, in_info, out_info, ML_NNFW_TYPE_NNFW, ML_NNFW_HW_ANY);
+  status = ml_single_open (&single, test_model, NULL, NULL, ML_NNFW_TYPE_ARMNN, ML_NNFW_HW_ANY);
   ASSERT_EQ (status, ML_ERROR_NONE);
 
   /* input tensor in filter */
@@ -5533,6 +9215,10 @@ TEST (nnstreamer_capi_singleshot, invoke_05)
   EXPECT_EQ (status, ML_ERROR_NONE);
   EXPECT_TRUE (input != NULL);
 
+  status = ml_tensors_data_get_tensor_data (input, 0, &data_ptr, &data_size);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  ((float *)data_ptr)[0] = 10.0;
+
   status = ml_single_set_timeout (single, SINGLE_DEF_TIMEOUT_MSEC);
   EXPECT_TRUE (status == ML_ERROR_NOT_SUPPORTED || status == ML_ERROR_NONE);
 
@@ -5540,6 +9226,10 @@ TEST (nnstreamer_capi_singleshot, invoke_05)
   EXPECT_EQ (status, ML_ERROR_NONE);
   EXPECT_TRUE (output != NULL);
 
+  status = ml_tensors_data_get_tensor_data (output, 0, &data_ptr, &data_size);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (((float *)data_ptr)[0], 12.0);
+
   status = ml_single_close (single);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
@@ -5554,13 +9244,15 @@ TEST (nnstreamer_capi_singleshot, invoke_05)
 }
 
 /**
- * @brief Test NNStreamer single shot (nnfw backend using model path)
+ * @brief Test NNStreamer single shot (caffe/armnn)
+ * @detail Failure open with invalid param.
  */
-TEST (nnstreamer_capi_singleshot, open_dir)
+TEST (nnstreamer_capi_singleshot, open_fail_03_n)
 {
   ml_single_h single;
+  ml_tensors_info_h in_info, out_info;
+  ml_tensor_dimension in_dim, out_dim;
   int status;
-
   const gchar *root_path = g_getenv ("NNSTREAMER_SOURCE_ROOT_PATH");
   gchar *test_model;
 
@@ -5568,45 +9260,77 @@ TEST (nnstreamer_capi_singleshot, open_dir)
   if (root_path == NULL)
     root_path = "..";
 
-  test_model = g_build_filename (root_path, "tests", "test_models", "models", NULL);
+  test_model = g_build_filename (root_path, "tests", "test_models", "models",
+      "lenet_iter_9000.caffemodel", NULL);
   ASSERT_TRUE (g_file_test (test_model, G_FILE_TEST_EXISTS));
 
-  status = ml_single_open (&single, test_model, NULL, NULL, ML_NNFW_TYPE_NNFW, ML_NNFW_HW_ANY);
-  EXPECT_EQ (status, ML_ERROR_NONE);
+  ml_tensors_info_create (&in_info);
+  ml_tensors_info_create (&out_info);
 
-  status = ml_single_close (single);
-  EXPECT_EQ (status, ML_ERROR_NONE);
+  /** Set the correct input/output info */
+  in_dim[0] = 28;
+  in_dim[1] = 28;
+  in_dim[2] = 1;
+  in_dim[3] = 1;
+  ml_tensors_info_set_count (in_info, 1);
+  ml_tensors_info_set_tensor_name (in_info, 0, "data");
+  ml_tensors_info_set_tensor_type (in_info, 0, ML_TENSOR_TYPE_FLOAT32);
+  ml_tensors_info_set_tensor_dimension (in_info, 0, in_dim);
+
+  out_dim[0] = 10;
+  out_dim[1] = 1;
+  out_dim[2] = 1;
+  out_dim[3] = 1;
+  ml_tensors_info_set_count (out_info, 1);
+  ml_tensors_info_set_tensor_name (out_info, 0, "prob");
+  ml_tensors_info_set_tensor_type (out_info, 0, ML_TENSOR_TYPE_FLOAT32);
+  ml_tensors_info_set_tensor_dimension (out_info, 0, out_dim);
+
+  /** Modify the input or output name to be wrong and open */
+  ml_tensors_info_set_tensor_name (in_info, 0, "data1");
+  status = ml_single_open (&single, test_model, in_info, out_info,
+      ML_NNFW_TYPE_ARMNN, ML_NNFW_HW_ANY);
+  EXPECT_NE (status, ML_ERROR_NONE);
+  ml_tensors_info_set_tensor_name (in_info, 0, "data");
+
+  ml_tensors_info_set_tensor_name (out_info, 0, "prob1");
+  status = ml_single_open (&single, test_model, in_info, out_info,
+      ML_NNFW_TYPE_ARMNN, ML_NNFW_HW_ANY);
+  EXPECT_NE (status, ML_ERROR_NONE);
+  ml_tensors_info_set_tensor_name (out_info, 0, "prob");
+
+  /**
+   * Modify the input dim to be wrong and open
+   * output dim is not used for caffe, so wrong output dim will pass open
+   * but will fail at invoke (check nnstreamer_capi_singleshot.invoke_07_n)
+   */
+  ml_tensors_info_set_tensor_dimension (in_info, 0, out_dim);
+  status = ml_single_open (&single, test_model, in_info, out_info,
+      ML_NNFW_TYPE_ARMNN, ML_NNFW_HW_ANY);
+  EXPECT_NE (status, ML_ERROR_NONE);
+  ml_tensors_info_set_tensor_dimension (in_info, 0, in_dim);
 
   g_free (test_model);
+  ml_tensors_info_destroy (in_info);
+  ml_tensors_info_destroy (out_info);
 }
 
-#endif /* ENABLE_NNFW_RUNTIME */
-
-#ifdef ENABLE_ARMNN
 /**
  * @brief Test NNStreamer single shot (caffe/armnn)
- * @detail Run pipeline with caffe lenet model.
+ * @detail Failure invoke with invalid param.
  */
-TEST (nnstreamer_capi_singleshot, invoke_06)
+TEST (nnstreamer_capi_singleshot, invoke_08_n)
 {
   ml_single_h single;
   ml_tensors_info_h in_info, out_info;
-  ml_tensors_info_h in_res, out_res;
   ml_tensors_data_h input, output;
-  ml_tensor_dimension in_dim, out_dim, res_dim;
-  ml_tensor_type_e type = ML_TENSOR_TYPE_UNKNOWN;
-  unsigned int count = 0;
-  char *name = NULL;
-  int status, max_score_index;
-  float score, max_score;
-  void *data_ptr;
+  ml_tensor_dimension in_dim, out_dim;
+  int status;
   size_t data_size;
 
   const gchar *root_path = g_getenv ("NNSTREAMER_SOURCE_ROOT_PATH");
-  gchar *test_model, *test_file;
-  guint8 *contents_uint8 = NULL;
+  gchar *test_model;
   gfloat *contents_float = NULL;
-  gsize len = 0;
 
   /* supposed to run test in build directory */
   if (root_path == NULL)
@@ -5616,9 +9340,6 @@ TEST (nnstreamer_capi_singleshot, invoke_06)
       "lenet_iter_9000.caffemodel", NULL);
   ASSERT_TRUE (g_file_test (test_model, G_FILE_TEST_EXISTS));
 
-  test_file = g_build_filename (root_path, "tests", "test_models", "data", "9.raw", NULL);
-  ASSERT_TRUE (g_file_test (test_file, G_FILE_TEST_EXISTS));
-
   ml_tensors_info_create (&in_info);
   ml_tensors_info_create (&out_info);
 
@@ -5639,78 +9360,22 @@ TEST (nnstreamer_capi_singleshot, invoke_06)
   ml_tensors_info_set_tensor_name (out_info, 0, "prob");
   ml_tensors_info_set_tensor_type (out_info, 0, ML_TENSOR_TYPE_FLOAT32);
   ml_tensors_info_set_tensor_dimension (out_info, 0, out_dim);
+  ml_tensors_info_set_tensor_dimension (out_info, 0, in_dim);
+
+  status = ml_single_open (&single, test_model, in_info, out_info,
+      ML_NNFW_TYPE_ARMNN, ML_NNFW_HW_ANY);
+  ASSERT_EQ (status, ML_ERROR_NONE);
 
-  ASSERT_TRUE (g_file_get_contents (test_file, (gchar **)&contents_uint8, &len, NULL));
-  status = ml_tensors_info_get_tensor_size (in_info, 0, &data_size);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-
-  ASSERT_TRUE (len == data_size / sizeof (float));
-
-  /** Convert uint8 data with range [0, 255] to float with range [-1, 1] */
-  contents_float = (gfloat *)g_malloc (data_size);
-  for (unsigned int idx = 0; idx < len; idx++) {
-    contents_float[idx] = static_cast<float> (contents_uint8[idx]);
-    contents_float[idx] -= 127.5;
-    contents_float[idx] /= 127.5;
-  }
-
-  status = ml_single_open (&single, test_model, in_info, out_info,
-      ML_NNFW_TYPE_ARMNN, ML_NNFW_HW_ANY);
-  ASSERT_EQ (status, ML_ERROR_NONE);
-
-  /* input tensor in filter */
-  status = ml_single_get_input_info (single, &in_res);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-
-  status = ml_tensors_info_get_count (in_res, &count);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (count, 1U);
-
-  status = ml_tensors_info_get_tensor_name (in_res, 0, &name);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_STREQ (name, "data");
-  g_free (name);
-
-  status = ml_tensors_info_get_tensor_type (in_res, 0, &type);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (type, ML_TENSOR_TYPE_FLOAT32);
-
-  ml_tensors_info_get_tensor_dimension (in_res, 0, res_dim);
-  EXPECT_TRUE (in_dim[0] == res_dim[0]);
-  EXPECT_TRUE (in_dim[1] == res_dim[1]);
-  EXPECT_TRUE (in_dim[2] == res_dim[2]);
-  EXPECT_TRUE (in_dim[3] == res_dim[3]);
-
-  /* output tensor in filter */
-  status = ml_single_get_output_info (single, &out_res);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-
-  status = ml_tensors_info_get_count (out_res, &count);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (count, 1U);
-
-  status = ml_tensors_info_get_tensor_name (out_res, 0, &name);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_STREQ (name, "prob");
-  g_free (name);
-
-  status = ml_tensors_info_get_tensor_type (out_res, 0, &type);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (type, ML_TENSOR_TYPE_FLOAT32);
-
-  ml_tensors_info_get_tensor_dimension (out_res, 0, res_dim);
-  EXPECT_TRUE (out_dim[0] == res_dim[0]);
-  EXPECT_TRUE (out_dim[1] == res_dim[1]);
-  EXPECT_TRUE (out_dim[2] == res_dim[2]);
-  EXPECT_TRUE (out_dim[3] == res_dim[3]);
-
   input = output = NULL;
 
-  /* generate input data */
+  /* generate input data with wrong info */
   status = ml_tensors_data_create (in_info, &input);
   EXPECT_EQ (status, ML_ERROR_NONE);
   EXPECT_TRUE (input != NULL);
 
+  status = ml_tensors_info_get_tensor_size (in_info, 0, &data_size);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  contents_float = (gfloat *)g_malloc (data_size);
   status = ml_tensors_data_set_tensor_data (input, 0, contents_float, data_size);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
@@ -5718,1302 +9383,1652 @@ TEST (nnstreamer_capi_singleshot, invoke_06)
   EXPECT_TRUE (status == ML_ERROR_NOT_SUPPORTED || status == ML_ERROR_NONE);
 
   status = ml_single_invoke (single, input, &output);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_TRUE (output != NULL);
-
-  status = ml_tensors_data_get_tensor_data (output, 1, &data_ptr, &data_size);
-  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
-
-  status = ml_tensors_data_get_tensor_data (output, 0, &data_ptr, &data_size);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-
-  max_score = .0;
-  max_score_index = 0;
-  for (gint i = 0; i < 10; i++) {
-    score = ((float *)data_ptr)[i];
-    if (score > max_score) {
-      max_score = score;
-      max_score_index = i;
-    }
-  }
+  EXPECT_NE (status, ML_ERROR_NONE);
+  EXPECT_TRUE (output == NULL);
 
-  EXPECT_EQ (max_score_index, 9);
+  ml_tensors_data_destroy (input);
 
   status = ml_single_close (single);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  ml_tensors_data_destroy (output);
-  ml_tensors_data_destroy (input);
-
   g_free (test_model);
-  g_free (test_file);
-  g_free (contents_uint8);
   g_free (contents_float);
   ml_tensors_info_destroy (in_info);
   ml_tensors_info_destroy (out_info);
-  ml_tensors_info_destroy (in_res);
-  ml_tensors_info_destroy (out_res);
 }
 
 /**
- * @brief Test NNStreamer single shot (tflite/armnn)
- * @detail Run pipeline with tflite basic model.
+ * @brief Test NNStreamer single shot (caffe/armnn)
+ * @detail Failure invoke with invalid param.
  */
-TEST (nnstreamer_capi_singleshot, invoke_07)
+TEST (nnstreamer_capi_singleshot, invoke_09_n)
 {
   ml_single_h single;
   ml_tensors_info_h in_info, out_info;
   ml_tensors_info_h in_res, out_res;
   ml_tensors_data_h input, output;
-  ml_tensor_dimension in_dim, out_dim, res_dim;
-  ml_tensor_type_e type = ML_TENSOR_TYPE_UNKNOWN;
-  unsigned int count = 0;
-  char *name = NULL;
+  ml_tensor_dimension in_dim, out_dim;
   int status;
-  void *data_ptr;
   size_t data_size;
 
   const gchar *root_path = g_getenv ("NNSTREAMER_SOURCE_ROOT_PATH");
   gchar *test_model;
+  gfloat *contents_float = NULL;
 
   /* supposed to run test in build directory */
   if (root_path == NULL)
     root_path = "..";
 
-  test_model = g_build_filename (
-      root_path, "tests", "test_models", "models", "add.tflite", NULL);
+  test_model = g_build_filename (root_path, "tests", "test_models", "models",
+      "lenet_iter_9000.caffemodel", NULL);
   ASSERT_TRUE (g_file_test (test_model, G_FILE_TEST_EXISTS));
 
   ml_tensors_info_create (&in_info);
   ml_tensors_info_create (&out_info);
+  ml_tensors_info_create (&in_res);
+  ml_tensors_info_create (&out_res);
 
-  in_dim[0] = 1;
-  in_dim[1] = 1;
+  in_dim[0] = 28;
+  in_dim[1] = 28;
   in_dim[2] = 1;
   in_dim[3] = 1;
   ml_tensors_info_set_count (in_info, 1);
+  ml_tensors_info_set_tensor_name (in_info, 0, "data");
   ml_tensors_info_set_tensor_type (in_info, 0, ML_TENSOR_TYPE_FLOAT32);
   ml_tensors_info_set_tensor_dimension (in_info, 0, in_dim);
 
-  out_dim[0] = 1;
+  out_dim[0] = 10;
   out_dim[1] = 1;
   out_dim[2] = 1;
   out_dim[3] = 1;
   ml_tensors_info_set_count (out_info, 1);
+  ml_tensors_info_set_tensor_name (out_info, 0, "prob");
   ml_tensors_info_set_tensor_type (out_info, 0, ML_TENSOR_TYPE_FLOAT32);
   ml_tensors_info_set_tensor_dimension (out_info, 0, out_dim);
 
-  status = ml_single_open (&single, test_model, NULL, NULL, ML_NNFW_TYPE_ARMNN, ML_NNFW_HW_ANY);
+  status = ml_single_open (&single, test_model, in_info, out_info,
+      ML_NNFW_TYPE_ARMNN, ML_NNFW_HW_ANY);
   ASSERT_EQ (status, ML_ERROR_NONE);
 
-  /* input tensor in filter */
-  status = ml_single_get_input_info (single, &in_res);
-  EXPECT_EQ (status, ML_ERROR_NONE);
+  input = output = NULL;
 
-  status = ml_tensors_info_get_count (in_res, &count);
+  /* generate input data with wrong info */
+  status = ml_tensors_data_create (out_info, &input);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (count, 1U);
+  EXPECT_TRUE (input != NULL);
 
-  status = ml_tensors_info_get_tensor_name (in_res, 0, &name);
+  status = ml_tensors_info_get_tensor_size (out_info, 0, &data_size);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  contents_float = (gfloat *)g_malloc (data_size);
+  status = ml_tensors_data_set_tensor_data (input, 0, contents_float, data_size);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  g_free (name);
 
-  status = ml_tensors_info_get_tensor_type (in_res, 0, &type);
+  status = ml_single_set_timeout (single, SINGLE_DEF_TIMEOUT_MSEC);
+  EXPECT_TRUE (status == ML_ERROR_NOT_SUPPORTED || status == ML_ERROR_NONE);
+
+  status = ml_single_invoke (single, input, &output);
+  EXPECT_NE (status, ML_ERROR_NONE);
+  EXPECT_TRUE (output == NULL);
+
+  ml_tensors_data_destroy (input);
+
+  status = ml_single_close (single);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (type, ML_TENSOR_TYPE_FLOAT32);
 
-  ml_tensors_info_get_tensor_dimension (in_res, 0, res_dim);
-  EXPECT_TRUE (in_dim[0] == res_dim[0]);
-  EXPECT_TRUE (in_dim[1] == res_dim[1]);
-  EXPECT_TRUE (in_dim[2] == res_dim[2]);
-  EXPECT_TRUE (in_dim[3] == res_dim[3]);
+  g_free (test_model);
+  g_free (contents_float);
+  ml_tensors_info_destroy (in_info);
+  ml_tensors_info_destroy (out_info);
+  ml_tensors_info_destroy (in_res);
+  ml_tensors_info_destroy (out_res);
+}
+#endif /* ENABLE_ARMNN */
 
-  /* output tensor in filter */
-  status = ml_single_get_output_info (single, &out_res);
+/**
+ * @brief Test NNStreamer single shot (custom filter)
+ * @detail Run pipeline with custom filter with allocate in invoke, handle multi tensors.
+ */
+TEST (nnstreamer_capi_singleshot, invoke_10_p)
+{
+  const gchar cf_name[] = "libnnstreamer_customfilter_scaler_allocator" SO_FILE_EXTENSION;
+  gchar *lib_path = NULL;
+  gchar *test_model = NULL;
+  ml_single_h single;
+  ml_tensors_info_h in_info, out_info;
+  ml_tensors_data_h input, output;
+  ml_tensor_dimension in_dim;
+  int status;
+  unsigned int i;
+  void *data_ptr;
+  size_t data_size;
+
+  lib_path = nnsconf_get_custom_value_string ("filter", "customfilters");
+  if (lib_path == NULL) {
+    /* cannot get custom-filter directory */
+    goto skip_test;
+  }
+
+  test_model = g_build_filename (lib_path, cf_name, NULL);
+  if (!g_file_test (test_model, G_FILE_TEST_EXISTS)) {
+    goto skip_test;
+  }
+
+  ml_tensors_info_create (&in_info);
+  ml_tensors_info_create (&out_info);
+
+  ml_tensors_info_set_count (in_info, 1);
+
+  in_dim[0] = 10;
+  in_dim[1] = 1;
+  in_dim[2] = 1;
+  in_dim[3] = 1;
+
+  ml_tensors_info_set_tensor_type (in_info, 0, ML_TENSOR_TYPE_INT16);
+  ml_tensors_info_set_tensor_dimension (in_info, 0, in_dim);
+
+  ml_tensors_info_clone (out_info, in_info);
+
+  status = ml_single_open (&single, test_model, in_info, out_info,
+      ML_NNFW_TYPE_CUSTOM_FILTER, ML_NNFW_HW_ANY);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+
+  input = output = NULL;
+
+  /* generate input data */
+  status = ml_tensors_data_create (in_info, &input);
   EXPECT_EQ (status, ML_ERROR_NONE);
+  ASSERT_TRUE (input != NULL);
 
-  status = ml_tensors_info_get_count (out_res, &count);
+  status = ml_tensors_data_get_tensor_data (input, 0, &data_ptr, &data_size);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (count, 1U);
+  for (i = 0; i < 10; i++) {
+    ((int16_t *)data_ptr)[i] = (int16_t) (i + 1);
+  }
 
-  status = ml_tensors_info_get_tensor_name (out_res, 0, &name);
+  status = ml_single_invoke (single, input, &output);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  g_free (name);
+  EXPECT_TRUE (output != NULL);
 
-  status = ml_tensors_info_get_tensor_type (out_res, 0, &type);
+  /**
+   * since the output data was allocated by the tensor filter element in the
+   * single API,
+   * closing this single handle will also delete the data
+   */
+  status = ml_single_close (single);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (type, ML_TENSOR_TYPE_FLOAT32);
 
-  ml_tensors_info_get_tensor_dimension (out_res, 0, res_dim);
-  EXPECT_TRUE (out_dim[0] == res_dim[0]);
-  EXPECT_TRUE (out_dim[1] == res_dim[1]);
-  EXPECT_TRUE (out_dim[2] == res_dim[2]);
-  EXPECT_TRUE (out_dim[3] == res_dim[3]);
+  status = ml_tensors_data_destroy (input);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  ml_tensors_info_destroy (in_info);
+  ml_tensors_info_destroy (out_info);
+  ml_tensors_data_destroy (output);
+
+skip_test:
+  g_free (lib_path);
+  g_free (test_model);
+}
+
+/**
+ * @brief Test NNStreamer single shot (custom filter)
+ * @detail Run pipeline with custom filter with allocate in invoke, handle multi tensors.
+ */
+TEST (nnstreamer_capi_singleshot, invoke_11_p)
+{
+  const gchar cf_name[] = "libnnstreamer_customfilter_scaler_allocator" SO_FILE_EXTENSION;
+  gchar *lib_path = NULL;
+  gchar *test_model = NULL;
+  ml_single_h single;
+  ml_tensors_info_h in_info, out_info;
+  ml_tensors_data_h input, output;
+  ml_tensor_dimension in_dim;
+  int status;
+  unsigned int i;
+  void *data_ptr;
+  size_t data_size;
+
+  lib_path = nnsconf_get_custom_value_string ("filter", "customfilters");
+  if (lib_path == NULL) {
+    /* cannot get custom-filter directory */
+    goto skip_test;
+  }
+
+  test_model = g_build_filename (lib_path, cf_name, NULL);
+  if (!g_file_test (test_model, G_FILE_TEST_EXISTS)) {
+    goto skip_test;
+  }
+
+  ml_tensors_info_create (&in_info);
+  ml_tensors_info_create (&out_info);
+
+  ml_tensors_info_set_count (in_info, 1);
+
+  in_dim[0] = 10;
+  in_dim[1] = 1;
+  in_dim[2] = 1;
+  in_dim[3] = 1;
+
+  ml_tensors_info_set_tensor_type (in_info, 0, ML_TENSOR_TYPE_INT16);
+  ml_tensors_info_set_tensor_dimension (in_info, 0, in_dim);
+
+  ml_tensors_info_clone (out_info, in_info);
+
+  status = ml_single_open (&single, test_model, in_info, out_info,
+      ML_NNFW_TYPE_CUSTOM_FILTER, ML_NNFW_HW_ANY);
+  ASSERT_EQ (status, ML_ERROR_NONE);
 
   input = output = NULL;
 
-  /* generate dummy data */
+  /* generate input data */
   status = ml_tensors_data_create (in_info, &input);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_TRUE (input != NULL);
+  ASSERT_TRUE (input != NULL);
 
   status = ml_tensors_data_get_tensor_data (input, 0, &data_ptr, &data_size);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  ((float *)data_ptr)[0] = 10.0;
-
-  status = ml_single_set_timeout (single, SINGLE_DEF_TIMEOUT_MSEC);
-  EXPECT_TRUE (status == ML_ERROR_NOT_SUPPORTED || status == ML_ERROR_NONE);
+  for (i = 0; i < 10; i++) {
+    ((int16_t *)data_ptr)[i] = (int16_t) (i + 1);
+  }
 
   status = ml_single_invoke (single, input, &output);
   EXPECT_EQ (status, ML_ERROR_NONE);
   EXPECT_TRUE (output != NULL);
 
+  status = ml_tensors_data_destroy (input);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  /** Access data before destroy works */
   status = ml_tensors_data_get_tensor_data (output, 0, &data_ptr, &data_size);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (((float *)data_ptr)[0], 12.0);
 
-  status = ml_single_close (single);
+  status = ml_tensors_data_destroy (output);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  ml_tensors_data_destroy (output);
-  ml_tensors_data_destroy (input);
+  /** Close handle works normally */
+  status = ml_single_close (single);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-  g_free (test_model);
   ml_tensors_info_destroy (in_info);
   ml_tensors_info_destroy (out_info);
-  ml_tensors_info_destroy (in_res);
-  ml_tensors_info_destroy (out_res);
+
+skip_test:
+  g_free (lib_path);
+  g_free (test_model);
 }
 
 /**
- * @brief Test NNStreamer single shot (caffe/armnn)
- * @detail Failure open with invalid param.
+ * @brief Test NNStreamer single shot (custom filter)
+ * @detail Run pipeline with custom filter with allocate in invoke, handle multi tensors.
  */
-TEST (nnstreamer_capi_singleshot, open_fail_03_n)
+TEST (nnstreamer_capi_singleshot, invoke_12_p)
 {
+  const gchar cf_name[] = "libnnstreamer_customfilter_scaler_allocator" SO_FILE_EXTENSION;
+  gchar *lib_path = NULL;
+  gchar *test_model = NULL;
   ml_single_h single;
   ml_tensors_info_h in_info, out_info;
-  ml_tensor_dimension in_dim, out_dim;
+  ml_tensors_data_h input, output1, output2;
+  ml_tensor_dimension in_dim;
   int status;
-  const gchar *root_path = g_getenv ("NNSTREAMER_SOURCE_ROOT_PATH");
-  gchar *test_model;
+  unsigned int i;
+  void *data_ptr;
+  size_t data_size;
 
-  /* supposed to run test in build directory */
-  if (root_path == NULL)
-    root_path = "..";
+  lib_path = nnsconf_get_custom_value_string ("filter", "customfilters");
+  if (lib_path == NULL) {
+    /* cannot get custom-filter directory */
+    goto skip_test;
+  }
 
-  test_model = g_build_filename (root_path, "tests", "test_models", "models",
-      "lenet_iter_9000.caffemodel", NULL);
-  ASSERT_TRUE (g_file_test (test_model, G_FILE_TEST_EXISTS));
+  test_model = g_build_filename (lib_path, cf_name, NULL);
+  if (!g_file_test (test_model, G_FILE_TEST_EXISTS)) {
+    goto skip_test;
+  }
 
   ml_tensors_info_create (&in_info);
   ml_tensors_info_create (&out_info);
 
-  /** Set the correct input/output info */
-  in_dim[0] = 28;
-  in_dim[1] = 28;
+  ml_tensors_info_set_count (in_info, 1);
+
+  in_dim[0] = 10;
+  in_dim[1] = 1;
   in_dim[2] = 1;
   in_dim[3] = 1;
-  ml_tensors_info_set_count (in_info, 1);
-  ml_tensors_info_set_tensor_name (in_info, 0, "data");
-  ml_tensors_info_set_tensor_type (in_info, 0, ML_TENSOR_TYPE_FLOAT32);
+
+  ml_tensors_info_set_tensor_type (in_info, 0, ML_TENSOR_TYPE_INT16);
   ml_tensors_info_set_tensor_dimension (in_info, 0, in_dim);
 
-  out_dim[0] = 10;
-  out_dim[1] = 1;
-  out_dim[2] = 1;
-  out_dim[3] = 1;
-  ml_tensors_info_set_count (out_info, 1);
-  ml_tensors_info_set_tensor_name (out_info, 0, "prob");
-  ml_tensors_info_set_tensor_type (out_info, 0, ML_TENSOR_TYPE_FLOAT32);
-  ml_tensors_info_set_tensor_dimension (out_info, 0, out_dim);
+  ml_tensors_info_clone (out_info, in_info);
 
-  /** Modify the input or output name to be wrong and open */
-  ml_tensors_info_set_tensor_name (in_info, 0, "data1");
   status = ml_single_open (&single, test_model, in_info, out_info,
-      ML_NNFW_TYPE_ARMNN, ML_NNFW_HW_ANY);
-  EXPECT_NE (status, ML_ERROR_NONE);
-  ml_tensors_info_set_tensor_name (in_info, 0, "data");
+      ML_NNFW_TYPE_CUSTOM_FILTER, ML_NNFW_HW_ANY);
+  ASSERT_EQ (status, ML_ERROR_NONE);
 
-  ml_tensors_info_set_tensor_name (out_info, 0, "prob1");
-  status = ml_single_open (&single, test_model, in_info, out_info,
-      ML_NNFW_TYPE_ARMNN, ML_NNFW_HW_ANY);
-  EXPECT_NE (status, ML_ERROR_NONE);
-  ml_tensors_info_set_tensor_name (out_info, 0, "prob");
+  input = output1 = output2 = NULL;
 
-  /**
-   * Modify the input dim to be wrong and open
-   * output dim is not used for caffe, so wrong output dim will pass open
-   * but will fail at invoke (check nnstreamer_capi_singleshot.invoke_07_n)
-   */
-  ml_tensors_info_set_tensor_dimension (in_info, 0, out_dim);
-  status = ml_single_open (&single, test_model, in_info, out_info,
-      ML_NNFW_TYPE_ARMNN, ML_NNFW_HW_ANY);
-  EXPECT_NE (status, ML_ERROR_NONE);
-  ml_tensors_info_set_tensor_dimension (in_info, 0, in_dim);
+  /* generate input data */
+  status = ml_tensors_data_create (in_info, &input);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  ASSERT_TRUE (input != NULL);
+
+  status = ml_tensors_data_get_tensor_data (input, 0, &data_ptr, &data_size);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  for (i = 0; i < 10; i++) {
+    ((int16_t *)data_ptr)[i] = (int16_t) (i + 1);
+  }
+
+  status = ml_single_invoke (single, input, &output1);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_TRUE (output1 != NULL);
+
+  status = ml_single_invoke (single, input, &output2);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_TRUE (output2 != NULL);
+
+  status = ml_tensors_data_destroy (input);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_tensors_data_destroy (output1);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  /** Destroy the other data by closing the handle */
+  status = ml_single_close (single);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-  g_free (test_model);
   ml_tensors_info_destroy (in_info);
   ml_tensors_info_destroy (out_info);
+  ml_tensors_data_destroy (output2);
+
+skip_test:
+  g_free (lib_path);
+  g_free (test_model);
 }
 
 /**
- * @brief Test NNStreamer single shot (caffe/armnn)
- * @detail Failure invoke with invalid param.
+ * @brief Test NNStreamer single shot (custom filter)
+ * @detail Change the number of input tensors, run the model and verify output
  */
-TEST (nnstreamer_capi_singleshot, invoke_08_n)
+TEST (nnstreamer_capi_singleshot, set_input_info_success_02)
 {
+  const gchar cf_name[] = "libnnstreamer_customfilter_passthrough_variable" SO_FILE_EXTENSION;
+  gchar *lib_path = NULL;
+  gchar *test_model = NULL;
   ml_single_h single;
   ml_tensors_info_h in_info, out_info;
+  ml_tensors_info_h in_res = nullptr, out_res = nullptr;
   ml_tensors_data_h input, output;
-  ml_tensor_dimension in_dim, out_dim;
-  int status;
-  size_t data_size;
-
-  const gchar *root_path = g_getenv ("NNSTREAMER_SOURCE_ROOT_PATH");
-  gchar *test_model;
-  gfloat *contents_float = NULL;
+  ml_tensor_dimension in_dim, out_dim, res_dim;
+  ml_tensor_type_e type = ML_TENSOR_TYPE_UNKNOWN;
+  unsigned int count = 0;
+  int status, tensor_size;
 
-  /* supposed to run test in build directory */
-  if (root_path == NULL)
-    root_path = "..";
+  lib_path = nnsconf_get_custom_value_string ("filter", "customfilters");
+  if (lib_path == NULL) {
+    /* cannot get custom-filter directory */
+    goto skip_test;
+  }
 
-  test_model = g_build_filename (root_path, "tests", "test_models", "models",
-      "lenet_iter_9000.caffemodel", NULL);
-  ASSERT_TRUE (g_file_test (test_model, G_FILE_TEST_EXISTS));
+  test_model = g_build_filename (lib_path, cf_name, NULL);
+  if (!g_file_test (test_model, G_FILE_TEST_EXISTS)) {
+    goto skip_test;
+  }
 
   ml_tensors_info_create (&in_info);
   ml_tensors_info_create (&out_info);
 
-  in_dim[0] = 28;
-  in_dim[1] = 28;
+  tensor_size = 5;
+  in_dim[0] = tensor_size;
+  in_dim[1] = 1;
   in_dim[2] = 1;
   in_dim[3] = 1;
   ml_tensors_info_set_count (in_info, 1);
-  ml_tensors_info_set_tensor_name (in_info, 0, "data");
   ml_tensors_info_set_tensor_type (in_info, 0, ML_TENSOR_TYPE_FLOAT32);
   ml_tensors_info_set_tensor_dimension (in_info, 0, in_dim);
 
-  out_dim[0] = 10;
+  out_dim[0] = tensor_size;
   out_dim[1] = 1;
   out_dim[2] = 1;
   out_dim[3] = 1;
   ml_tensors_info_set_count (out_info, 1);
-  ml_tensors_info_set_tensor_name (out_info, 0, "prob");
   ml_tensors_info_set_tensor_type (out_info, 0, ML_TENSOR_TYPE_FLOAT32);
   ml_tensors_info_set_tensor_dimension (out_info, 0, out_dim);
-  ml_tensors_info_set_tensor_dimension (out_info, 0, in_dim);
 
   status = ml_single_open (&single, test_model, in_info, out_info,
-      ML_NNFW_TYPE_ARMNN, ML_NNFW_HW_ANY);
+      ML_NNFW_TYPE_CUSTOM_FILTER, ML_NNFW_HW_ANY);
   ASSERT_EQ (status, ML_ERROR_NONE);
 
+  /* Run the model once with the original input/output info */
   input = output = NULL;
 
-  /* generate input data with wrong info */
+  /* generate dummy data */
   status = ml_tensors_data_create (in_info, &input);
   EXPECT_EQ (status, ML_ERROR_NONE);
   EXPECT_TRUE (input != NULL);
 
-  status = ml_tensors_info_get_tensor_size (in_info, 0, &data_size);
+  status = ml_single_invoke (single, input, &output);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  contents_float = (gfloat *)g_malloc (data_size);
-  status = ml_tensors_data_set_tensor_data (input, 0, contents_float, data_size);
+  EXPECT_TRUE (output != NULL);
+
+  ml_tensors_data_destroy (output);
+  ml_tensors_data_destroy (input);
+
+  /** modify input/output info and run again */
+  in_dim[0] = 10;
+  ml_tensors_info_set_tensor_dimension (in_info, 0, in_dim);
+  out_dim[0] = 10;
+  ml_tensors_info_set_tensor_dimension (out_info, 0, out_dim);
+
+  status = ml_single_get_input_info (single, &in_res);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_single_set_timeout (single, SINGLE_DEF_TIMEOUT_MSEC);
+  /**
+   * 1. start with a model file with different input dimensions
+   * 2. change the input for the model file
+   * 3. run the model file with the updated input dimensions
+   * 4. verify the output
+   */
+
+  ml_tensors_info_get_tensor_dimension (in_res, 0, res_dim);
+  EXPECT_FALSE (in_dim[0] == res_dim[0]);
+  EXPECT_TRUE (in_dim[1] == res_dim[1]);
+  EXPECT_TRUE (in_dim[2] == res_dim[2]);
+  EXPECT_TRUE (in_dim[3] == res_dim[3]);
+
+  /** set the same original input dimension */
+  status = ml_single_set_input_info (single, in_info);
   EXPECT_TRUE (status == ML_ERROR_NOT_SUPPORTED || status == ML_ERROR_NONE);
+  if (status == ML_ERROR_NONE) {
+    /* input tensor in filter */
+    ml_tensors_info_destroy (in_res);
+    status = ml_single_get_input_info (single, &in_res);
+    EXPECT_EQ (status, ML_ERROR_NONE);
+
+    status = ml_tensors_info_get_count (in_res, &count);
+    EXPECT_EQ (status, ML_ERROR_NONE);
+    EXPECT_EQ (count, 1U);
+
+    status = ml_tensors_info_get_tensor_type (in_res, 0, &type);
+    EXPECT_EQ (status, ML_ERROR_NONE);
+    EXPECT_EQ (type, ML_TENSOR_TYPE_FLOAT32);
+
+    ml_tensors_info_get_tensor_dimension (in_res, 0, res_dim);
+    EXPECT_TRUE (in_dim[0] == res_dim[0]);
+    EXPECT_TRUE (in_dim[1] == res_dim[1]);
+    EXPECT_TRUE (in_dim[2] == res_dim[2]);
+    EXPECT_TRUE (in_dim[3] == res_dim[3]);
+
+    /* output tensor in filter */
+    status = ml_single_get_output_info (single, &out_res);
+    EXPECT_EQ (status, ML_ERROR_NONE);
+
+    status = ml_tensors_info_get_count (out_res, &count);
+    EXPECT_EQ (status, ML_ERROR_NONE);
+    EXPECT_EQ (count, 1U);
+
+    status = ml_tensors_info_get_tensor_type (out_res, 0, &type);
+    EXPECT_EQ (status, ML_ERROR_NONE);
+    EXPECT_EQ (type, ML_TENSOR_TYPE_FLOAT32);
+
+    ml_tensors_info_get_tensor_dimension (out_res, 0, res_dim);
+    EXPECT_TRUE (out_dim[0] == res_dim[0]);
+    EXPECT_TRUE (out_dim[1] == res_dim[1]);
+    EXPECT_TRUE (out_dim[2] == res_dim[2]);
+    EXPECT_TRUE (out_dim[3] == res_dim[3]);
+
+    input = output = NULL;
+
+    /* generate dummy data */
+    status = ml_tensors_data_create (in_info, &input);
+    EXPECT_EQ (status, ML_ERROR_NONE);
+    EXPECT_TRUE (input != NULL);
 
-  status = ml_single_invoke (single, input, &output);
-  EXPECT_NE (status, ML_ERROR_NONE);
-  EXPECT_TRUE (output == NULL);
+    status = ml_single_invoke (single, input, &output);
+    EXPECT_EQ (status, ML_ERROR_NONE);
+    EXPECT_TRUE (output != NULL);
 
-  ml_tensors_data_destroy (input);
+    ml_tensors_data_destroy (output);
+    ml_tensors_data_destroy (input);
+  }
 
   status = ml_single_close (single);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  g_free (test_model);
-  g_free (contents_float);
   ml_tensors_info_destroy (in_info);
   ml_tensors_info_destroy (out_info);
+  ml_tensors_info_destroy (in_res);
+  ml_tensors_info_destroy (out_res);
+
+skip_test:
+  g_free (lib_path);
+  g_free (test_model);
 }
 
 /**
- * @brief Test NNStreamer single shot (caffe/armnn)
- * @detail Failure invoke with invalid param.
+ * @brief Test NNStreamer single shot (tflite)
+ * @detail run the `ml_single_invoke_dynamic` api works properly.
  */
-TEST (nnstreamer_capi_singleshot, invoke_09_n)
+TEST (nnstreamer_capi_singleshot, invoke_dynamic_success_01_p)
 {
   ml_single_h single;
+  int status;
   ml_tensors_info_h in_info, out_info;
-  ml_tensors_info_h in_res, out_res;
   ml_tensors_data_h input, output;
-  ml_tensor_dimension in_dim, out_dim;
-  int status;
   size_t data_size;
 
+  unsigned int tmp_count;
+  ml_tensor_type_e tmp_type = ML_TENSOR_TYPE_UNKNOWN;
+  ml_tensor_dimension tmp_dim;
+
   const gchar *root_path = g_getenv ("NNSTREAMER_SOURCE_ROOT_PATH");
   gchar *test_model;
-  gfloat *contents_float = NULL;
 
   /* supposed to run test in build directory */
   if (root_path == NULL)
     root_path = "..";
 
-  test_model = g_build_filename (root_path, "tests", "test_models", "models",
-      "lenet_iter_9000.caffemodel", NULL);
+  /* dynamic dimension supported */
+  test_model = g_build_filename (
+      root_path, "tests", "test_models", "models", "add.tflite", NULL);
   ASSERT_TRUE (g_file_test (test_model, G_FILE_TEST_EXISTS));
 
-  ml_tensors_info_create (&in_info);
-  ml_tensors_info_create (&out_info);
-  ml_tensors_info_create (&in_res);
-  ml_tensors_info_create (&out_res);
+  status = ml_single_open (&single, test_model, NULL, NULL,
+      ML_NNFW_TYPE_TENSORFLOW_LITE, ML_NNFW_HW_ANY);
+  if (is_enabled_tensorflow_lite) {
+    EXPECT_EQ (status, ML_ERROR_NONE);
+  } else {
+    EXPECT_NE (status, ML_ERROR_NONE);
+    goto skip_test;
+  }
 
-  in_dim[0] = 28;
-  in_dim[1] = 28;
-  in_dim[2] = 1;
-  in_dim[3] = 1;
-  ml_tensors_info_set_count (in_info, 1);
-  ml_tensors_info_set_tensor_name (in_info, 0, "data");
-  ml_tensors_info_set_tensor_type (in_info, 0, ML_TENSOR_TYPE_FLOAT32);
-  ml_tensors_info_set_tensor_dimension (in_info, 0, in_dim);
+  status = ml_single_get_input_info (single, &in_info);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-  out_dim[0] = 10;
-  out_dim[1] = 1;
-  out_dim[2] = 1;
-  out_dim[3] = 1;
-  ml_tensors_info_set_count (out_info, 1);
-  ml_tensors_info_set_tensor_name (out_info, 0, "prob");
-  ml_tensors_info_set_tensor_type (out_info, 0, ML_TENSOR_TYPE_FLOAT32);
-  ml_tensors_info_set_tensor_dimension (out_info, 0, out_dim);
+  status = ml_tensors_data_create (in_info, &input);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  {
+    float tmp_input[] = { 1.0 };
+    float *output_buf;
+    status = ml_tensors_data_set_tensor_data (input, 0, tmp_input, 1 * sizeof (float));
 
-  status = ml_single_open (&single, test_model, in_info, out_info,
-      ML_NNFW_TYPE_ARMNN, ML_NNFW_HW_ANY);
-  ASSERT_EQ (status, ML_ERROR_NONE);
+    ml_tensors_info_get_count (in_info, &tmp_count);
+    ml_tensors_info_get_tensor_type (in_info, 0, &tmp_type);
+    ml_tensors_info_get_tensor_dimension (in_info, 0, tmp_dim);
 
-  input = output = NULL;
+    EXPECT_EQ (tmp_count, 1U);
+    EXPECT_EQ (tmp_type, ML_TENSOR_TYPE_FLOAT32);
+    EXPECT_EQ (tmp_dim[0], 1U);
+    EXPECT_EQ (tmp_dim[1], 1U);
+    EXPECT_EQ (tmp_dim[2], 1U);
+    EXPECT_EQ (tmp_dim[3], 1U);
 
-  /* generate input data with wrong info */
-  status = ml_tensors_data_create (out_info, &input);
+    status = ml_single_invoke_dynamic (single, input, in_info, &output, &out_info);
+    EXPECT_EQ (status, ML_ERROR_NONE);
+
+    ml_tensors_data_get_tensor_data (output, 0, (void **)&output_buf, &data_size);
+
+    EXPECT_FLOAT_EQ (output_buf[0], 3.0f);
+    EXPECT_EQ (data_size, sizeof (float));
+
+    ml_tensors_info_get_count (out_info, &tmp_count);
+    ml_tensors_info_get_tensor_type (out_info, 0, &tmp_type);
+    ml_tensors_info_get_tensor_dimension (out_info, 0, tmp_dim);
+
+    EXPECT_EQ (tmp_count, 1U);
+    EXPECT_EQ (tmp_type, ML_TENSOR_TYPE_FLOAT32);
+    EXPECT_EQ (tmp_dim[0], 1U);
+    EXPECT_EQ (tmp_dim[1], 1U);
+    EXPECT_EQ (tmp_dim[2], 1U);
+    EXPECT_EQ (tmp_dim[3], 1U);
+
+    ml_tensors_data_destroy (output);
+    ml_tensors_data_destroy (input);
+    ml_tensors_info_destroy (in_info);
+    ml_tensors_info_destroy (out_info);
+  }
+
+  status = ml_single_set_property (single, "input", "5:1:1:1");
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_TRUE (input != NULL);
 
-  status = ml_tensors_info_get_tensor_size (out_info, 0, &data_size);
+  status = ml_single_get_input_info (single, &in_info);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  contents_float = (gfloat *)g_malloc (data_size);
-  status = ml_tensors_data_set_tensor_data (input, 0, contents_float, data_size);
+
+  status = ml_tensors_data_create (in_info, &input);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_single_set_timeout (single, SINGLE_DEF_TIMEOUT_MSEC);
-  EXPECT_TRUE (status == ML_ERROR_NOT_SUPPORTED || status == ML_ERROR_NONE);
+  {
+    float tmp_input2[] = { 1.0, 2.0, 3.0, 4.0, 5.0 };
+    float *output_buf2;
+    status = ml_tensors_data_set_tensor_data (input, 0, tmp_input2, 5 * sizeof (float));
 
-  status = ml_single_invoke (single, input, &output);
-  EXPECT_NE (status, ML_ERROR_NONE);
-  EXPECT_TRUE (output == NULL);
+    ml_tensors_info_get_count (in_info, &tmp_count);
+    ml_tensors_info_get_tensor_type (in_info, 0, &tmp_type);
+    ml_tensors_info_get_tensor_dimension (in_info, 0, tmp_dim);
 
-  ml_tensors_data_destroy (input);
+    EXPECT_EQ (tmp_count, 1U);
+    EXPECT_EQ (tmp_type, ML_TENSOR_TYPE_FLOAT32);
+    EXPECT_EQ (tmp_dim[0], 5U);
+    EXPECT_EQ (tmp_dim[1], 1U);
+    EXPECT_EQ (tmp_dim[2], 1U);
+    EXPECT_EQ (tmp_dim[3], 1U);
 
-  status = ml_single_close (single);
-  EXPECT_EQ (status, ML_ERROR_NONE);
+    status = ml_single_invoke_dynamic (single, input, in_info, &output, &out_info);
+    EXPECT_EQ (status, ML_ERROR_NONE);
+
+    ml_tensors_data_get_tensor_data (output, 0, (void **)&output_buf2, &data_size);
+
+    EXPECT_FLOAT_EQ (output_buf2[0], 3.0f);
+    EXPECT_FLOAT_EQ (output_buf2[1], 4.0f);
+    EXPECT_FLOAT_EQ (output_buf2[2], 5.0f);
+    EXPECT_FLOAT_EQ (output_buf2[3], 6.0f);
+    EXPECT_FLOAT_EQ (output_buf2[4], 7.0f);
+    EXPECT_EQ (data_size, 5 * sizeof (float));
+
+    ml_tensors_info_get_count (out_info, &tmp_count);
+    ml_tensors_info_get_tensor_type (out_info, 0, &tmp_type);
+    ml_tensors_info_get_tensor_dimension (out_info, 0, tmp_dim);
+
+    EXPECT_EQ (tmp_count, 1U);
+    EXPECT_EQ (tmp_type, ML_TENSOR_TYPE_FLOAT32);
+    EXPECT_EQ (tmp_dim[0], 5U);
+    EXPECT_EQ (tmp_dim[1], 1U);
+    EXPECT_EQ (tmp_dim[2], 1U);
+    EXPECT_EQ (tmp_dim[3], 1U);
+
+    status = ml_single_close (single);
+    EXPECT_EQ (status, ML_ERROR_NONE);
 
+    ml_tensors_data_destroy (output);
+    ml_tensors_data_destroy (input);
+    ml_tensors_info_destroy (in_info);
+    ml_tensors_info_destroy (out_info);
+  }
+skip_test:
   g_free (test_model);
-  g_free (contents_float);
-  ml_tensors_info_destroy (in_info);
-  ml_tensors_info_destroy (out_info);
-  ml_tensors_info_destroy (in_res);
-  ml_tensors_info_destroy (out_res);
 }
-#endif /* ENABLE_ARMNN */
 
 /**
- * @brief Test NNStreamer single shot (custom filter)
- * @detail Run pipeline with custom filter with allocate in invoke, handle multi tensors.
+ * @brief Test NNStreamer single shot (tflite)
+ * @detail run the `ml_single_invoke_dynamic` api works properly.
  */
-TEST (nnstreamer_capi_singleshot, invoke_10_p)
+TEST (nnstreamer_capi_singleshot, invoke_dynamic_success_02_p)
 {
-  const gchar cf_name[] = "libnnstreamer_customfilter_scaler_allocator" SO_FILE_EXTENSION;
-  gchar *lib_path = NULL;
-  gchar *test_model = NULL;
   ml_single_h single;
+  int status;
   ml_tensors_info_h in_info, out_info;
   ml_tensors_data_h input, output;
-  ml_tensor_dimension in_dim;
-  int status;
-  unsigned int i;
-  void *data_ptr;
   size_t data_size;
 
-  lib_path = nnsconf_get_custom_value_string ("filter", "customfilters");
-  if (lib_path == NULL) {
-    /* cannot get custom-filter directory */
+  unsigned int tmp_count;
+  ml_tensor_type_e tmp_type = ML_TENSOR_TYPE_UNKNOWN;
+  ml_tensor_dimension tmp_dim, in_dim;
+
+  const gchar *root_path = g_getenv ("NNSTREAMER_SOURCE_ROOT_PATH");
+  gchar *test_model;
+
+  /* supposed to run test in build directory */
+  if (root_path == NULL)
+    root_path = "..";
+
+  /* dynamic dimension supported */
+  test_model = g_build_filename (
+      root_path, "tests", "test_models", "models", "add.tflite", NULL);
+  ASSERT_TRUE (g_file_test (test_model, G_FILE_TEST_EXISTS));
+
+  status = ml_single_open (&single, test_model, NULL, NULL,
+      ML_NNFW_TYPE_TENSORFLOW_LITE, ML_NNFW_HW_ANY);
+  if (is_enabled_tensorflow_lite) {
+    EXPECT_EQ (status, ML_ERROR_NONE);
+  } else {
+    EXPECT_NE (status, ML_ERROR_NONE);
     goto skip_test;
   }
 
-  test_model = g_build_filename (lib_path, cf_name, NULL);
-  if (!g_file_test (test_model, G_FILE_TEST_EXISTS)) {
-    goto skip_test;
+  status = ml_single_get_input_info (single, &in_info);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_tensors_data_create (in_info, &input);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  {
+    float tmp_input[] = { 1.0 };
+    float *output_buf;
+
+    status = ml_tensors_data_set_tensor_data (input, 0, tmp_input, 1 * sizeof (float));
+
+    ml_tensors_info_get_count (in_info, &tmp_count);
+    ml_tensors_info_get_tensor_type (in_info, 0, &tmp_type);
+    ml_tensors_info_get_tensor_dimension (in_info, 0, tmp_dim);
+
+    EXPECT_EQ (tmp_count, 1U);
+    EXPECT_EQ (tmp_type, ML_TENSOR_TYPE_FLOAT32);
+    EXPECT_EQ (tmp_dim[0], 1U);
+    EXPECT_EQ (tmp_dim[1], 1U);
+    EXPECT_EQ (tmp_dim[2], 1U);
+    EXPECT_EQ (tmp_dim[3], 1U);
+
+    status = ml_single_invoke_dynamic (single, input, in_info, &output, &out_info);
+    EXPECT_EQ (status, ML_ERROR_NONE);
+
+    ml_tensors_data_get_tensor_data (output, 0, (void **)&output_buf, &data_size);
+    EXPECT_FLOAT_EQ (output_buf[0], 3.0f);
+    EXPECT_EQ (data_size, sizeof (float));
+
+    ml_tensors_info_get_count (out_info, &tmp_count);
+    ml_tensors_info_get_tensor_type (out_info, 0, &tmp_type);
+    ml_tensors_info_get_tensor_dimension (out_info, 0, tmp_dim);
+
+    EXPECT_EQ (tmp_count, 1U);
+    EXPECT_EQ (tmp_type, ML_TENSOR_TYPE_FLOAT32);
+    EXPECT_EQ (tmp_dim[0], 1U);
+    EXPECT_EQ (tmp_dim[1], 1U);
+    EXPECT_EQ (tmp_dim[2], 1U);
+    EXPECT_EQ (tmp_dim[3], 1U);
+
+    ml_tensors_data_destroy (output);
+    ml_tensors_data_destroy (input);
+    ml_tensors_info_destroy (in_info);
+    ml_tensors_info_destroy (out_info);
   }
 
-  ml_tensors_info_create (&in_info);
-  ml_tensors_info_create (&out_info);
-
-  ml_tensors_info_set_count (in_info, 1);
+  status = ml_single_get_input_info (single, &in_info);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-  in_dim[0] = 10;
+  in_dim[0] = 5;
   in_dim[1] = 1;
   in_dim[2] = 1;
   in_dim[3] = 1;
 
-  ml_tensors_info_set_tensor_type (in_info, 0, ML_TENSOR_TYPE_INT16);
-  ml_tensors_info_set_tensor_dimension (in_info, 0, in_dim);
+  status = ml_tensors_info_set_tensor_dimension (in_info, 0, in_dim);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-  ml_tensors_info_clone (out_info, in_info);
+  status = ml_tensors_data_create (in_info, &input);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_single_open (&single, test_model, in_info, out_info,
-      ML_NNFW_TYPE_CUSTOM_FILTER, ML_NNFW_HW_ANY);
-  ASSERT_EQ (status, ML_ERROR_NONE);
+  {
+    float tmp_input2[] = { 1.0, 2.0, 3.0, 4.0, 5.0 };
+    float *output_buf2;
+    status = ml_tensors_data_set_tensor_data (input, 0, tmp_input2, 5 * sizeof (float));
 
-  input = output = NULL;
+    ml_tensors_info_get_count (in_info, &tmp_count);
+    ml_tensors_info_get_tensor_type (in_info, 0, &tmp_type);
+    ml_tensors_info_get_tensor_dimension (in_info, 0, tmp_dim);
 
-  /* generate input data */
-  status = ml_tensors_data_create (in_info, &input);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-  ASSERT_TRUE (input != NULL);
+    EXPECT_EQ (tmp_count, 1U);
+    EXPECT_EQ (tmp_type, ML_TENSOR_TYPE_FLOAT32);
+    EXPECT_EQ (tmp_dim[0], 5U);
+    EXPECT_EQ (tmp_dim[1], 1U);
+    EXPECT_EQ (tmp_dim[2], 1U);
+    EXPECT_EQ (tmp_dim[3], 1U);
 
-  status = ml_tensors_data_get_tensor_data (input, 0, &data_ptr, &data_size);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-  for (i = 0; i < 10; i++) {
-    ((int16_t *)data_ptr)[i] = (int16_t) (i + 1);
-  }
+    status = ml_single_invoke_dynamic (single, input, in_info, &output, &out_info);
+    EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_single_invoke (single, input, &output);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_TRUE (output != NULL);
+    ml_tensors_data_get_tensor_data (output, 0, (void **)&output_buf2, &data_size);
 
-  /**
-   * since the output data was allocated by the tensor filter element in the
-   * single API,
-   * closing this single handle will also delete the data
-   */
-  status = ml_single_close (single);
-  EXPECT_EQ (status, ML_ERROR_NONE);
+    EXPECT_FLOAT_EQ (output_buf2[0], 3.0f);
+    EXPECT_FLOAT_EQ (output_buf2[1], 4.0f);
+    EXPECT_FLOAT_EQ (output_buf2[2], 5.0f);
+    EXPECT_FLOAT_EQ (output_buf2[3], 6.0f);
+    EXPECT_FLOAT_EQ (output_buf2[4], 7.0f);
+    EXPECT_EQ (data_size, 5 * sizeof (float));
 
-  status = ml_tensors_data_destroy (input);
-  EXPECT_EQ (status, ML_ERROR_NONE);
+    ml_tensors_info_get_count (out_info, &tmp_count);
+    ml_tensors_info_get_tensor_type (out_info, 0, &tmp_type);
+    ml_tensors_info_get_tensor_dimension (out_info, 0, tmp_dim);
 
-  ml_tensors_info_destroy (in_info);
-  ml_tensors_info_destroy (out_info);
-  ml_tensors_data_destroy (output);
+    EXPECT_EQ (tmp_count, 1U);
+    EXPECT_EQ (tmp_type, ML_TENSOR_TYPE_FLOAT32);
+    EXPECT_EQ (tmp_dim[0], 5U);
+    EXPECT_EQ (tmp_dim[1], 1U);
+    EXPECT_EQ (tmp_dim[2], 1U);
+    EXPECT_EQ (tmp_dim[3], 1U);
+
+    status = ml_single_close (single);
+    EXPECT_EQ (status, ML_ERROR_NONE);
+
+    ml_tensors_data_destroy (output);
+    ml_tensors_data_destroy (input);
+    ml_tensors_info_destroy (in_info);
+    ml_tensors_info_destroy (out_info);
+  }
 
 skip_test:
-  g_free (lib_path);
   g_free (test_model);
 }
 
 /**
- * @brief Test NNStreamer single shot (custom filter)
- * @detail Run pipeline with custom filter with allocate in invoke, handle multi tensors.
+ * @brief Test NNStreamer single shot (tflite)
+ * @detail check the `ml_single_invoke_dynamic` api handles exception cases well.
  */
-TEST (nnstreamer_capi_singleshot, invoke_11_p)
+TEST (nnstreamer_capi_singleshot, invoke_dynamic_fail_n)
 {
-  const gchar cf_name[] = "libnnstreamer_customfilter_scaler_allocator" SO_FILE_EXTENSION;
-  gchar *lib_path = NULL;
-  gchar *test_model = NULL;
   ml_single_h single;
+  int status;
   ml_tensors_info_h in_info, out_info;
   ml_tensors_data_h input, output;
-  ml_tensor_dimension in_dim;
-  int status;
-  unsigned int i;
-  void *data_ptr;
-  size_t data_size;
 
-  lib_path = nnsconf_get_custom_value_string ("filter", "customfilters");
-  if (lib_path == NULL) {
-    /* cannot get custom-filter directory */
-    goto skip_test;
-  }
+  const gchar *root_path = g_getenv ("NNSTREAMER_SOURCE_ROOT_PATH");
+  gchar *test_model;
 
-  test_model = g_build_filename (lib_path, cf_name, NULL);
-  if (!g_file_test (test_model, G_FILE_TEST_EXISTS)) {
+  /* supposed to run test in build directory */
+  if (root_path == NULL)
+    root_path = "..";
+
+  /* dynamic dimension supported */
+  test_model = g_build_filename (
+      root_path, "tests", "test_models", "models", "add.tflite", NULL);
+  ASSERT_TRUE (g_file_test (test_model, G_FILE_TEST_EXISTS));
+
+  status = ml_single_open (&single, test_model, NULL, NULL,
+      ML_NNFW_TYPE_TENSORFLOW_LITE, ML_NNFW_HW_ANY);
+  if (is_enabled_tensorflow_lite) {
+    EXPECT_EQ (status, ML_ERROR_NONE);
+  } else {
+    EXPECT_NE (status, ML_ERROR_NONE);
     goto skip_test;
   }
 
-  ml_tensors_info_create (&in_info);
-  ml_tensors_info_create (&out_info);
+  status = ml_single_get_input_info (single, &in_info);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-  ml_tensors_info_set_count (in_info, 1);
+  status = ml_tensors_data_create (in_info, &input);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-  in_dim[0] = 10;
-  in_dim[1] = 1;
-  in_dim[2] = 1;
-  in_dim[3] = 1;
+  status = ml_single_invoke_dynamic (NULL, input, in_info, &output, &out_info);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
 
-  ml_tensors_info_set_tensor_type (in_info, 0, ML_TENSOR_TYPE_INT16);
-  ml_tensors_info_set_tensor_dimension (in_info, 0, in_dim);
+  status = ml_single_invoke_dynamic (single, NULL, in_info, &output, &out_info);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
 
-  ml_tensors_info_clone (out_info, in_info);
+  status = ml_single_invoke_dynamic (single, input, NULL, &output, &out_info);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
 
-  status = ml_single_open (&single, test_model, in_info, out_info,
-      ML_NNFW_TYPE_CUSTOM_FILTER, ML_NNFW_HW_ANY);
-  ASSERT_EQ (status, ML_ERROR_NONE);
+  status = ml_single_invoke_dynamic (single, input, in_info, NULL, &out_info);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
 
-  input = output = NULL;
+  status = ml_single_invoke_dynamic (single, input, in_info, &output, NULL);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
 
-  /* generate input data */
-  status = ml_tensors_data_create (in_info, &input);
+  status = ml_single_close (single);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  ASSERT_TRUE (input != NULL);
 
-  status = ml_tensors_data_get_tensor_data (input, 0, &data_ptr, &data_size);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-  for (i = 0; i < 10; i++) {
-    ((int16_t *)data_ptr)[i] = (int16_t) (i + 1);
-  }
+  ml_tensors_data_destroy (input);
+  ml_tensors_info_destroy (in_info);
 
-  status = ml_single_invoke (single, input, &output);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_TRUE (output != NULL);
+skip_test:
+  g_free (test_model);
+}
 
-  status = ml_tensors_data_destroy (input);
-  EXPECT_EQ (status, ML_ERROR_NONE);
+/**
+ * @brief Test case of Element Property Control.
+ * @detail Run the `ml_pipeline_element_get_handle()` API and check its results.
+ */
+TEST (nnstreamer_capi_element, get_handle_00_p)
+{
+  ml_pipeline_h handle = nullptr;
+  ml_pipeline_element_h vsrc_h = nullptr;
+  int status;
+  gchar *pipeline;
 
-  /** Access data before destroy works */
-  status = ml_tensors_data_get_tensor_data (output, 0, &data_ptr, &data_size);
+  pipeline = g_strdup (
+      "videotestsrc name=vsrc is-live=true ! videoconvert ! videoscale name=vscale ! "
+      "video/x-raw,format=RGBx,width=224,height=224,framerate=60/1 ! tensor_converter ! "
+      "valve name=valvex ! input-selector name=is01 ! tensor_sink name=sinkx");
+
+  status = ml_pipeline_construct (pipeline, nullptr, nullptr, &handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_tensors_data_destroy (output);
+  /* Test Code */
+  status = ml_pipeline_element_get_handle (handle, "vsrc", &vsrc_h);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  /** Close handle works normally */
-  status = ml_single_close (single);
+  status = ml_pipeline_element_release_handle (vsrc_h);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  ml_tensors_info_destroy (in_info);
-  ml_tensors_info_destroy (out_info);
+  status = ml_pipeline_destroy (handle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-skip_test:
-  g_free (lib_path);
-  g_free (test_model);
+  g_free (pipeline);
 }
 
 /**
- * @brief Test NNStreamer single shot (custom filter)
- * @detail Run pipeline with custom filter with allocate in invoke, handle multi tensors.
+ * @brief Test case of Element Property Control.
+ * @detail Run the `ml_pipeline_element_get_handle()` API and check its results.
  */
-TEST (nnstreamer_capi_singleshot, invoke_12_p)
+TEST (nnstreamer_capi_element, get_handle_01_n)
 {
-  const gchar cf_name[] = "libnnstreamer_customfilter_scaler_allocator" SO_FILE_EXTENSION;
-  gchar *lib_path = NULL;
-  gchar *test_model = NULL;
-  ml_single_h single;
-  ml_tensors_info_h in_info, out_info;
-  ml_tensors_data_h input, output1, output2;
-  ml_tensor_dimension in_dim;
+  ml_pipeline_h handle = nullptr;
+  ml_pipeline_element_h vsrc_h = nullptr;
   int status;
-  unsigned int i;
-  void *data_ptr;
-  size_t data_size;
-
-  lib_path = nnsconf_get_custom_value_string ("filter", "customfilters");
-  if (lib_path == NULL) {
-    /* cannot get custom-filter directory */
-    goto skip_test;
-  }
-
-  test_model = g_build_filename (lib_path, cf_name, NULL);
-  if (!g_file_test (test_model, G_FILE_TEST_EXISTS)) {
-    goto skip_test;
-  }
+  gchar *pipeline;
 
-  ml_tensors_info_create (&in_info);
-  ml_tensors_info_create (&out_info);
+  pipeline = g_strdup (
+      "videotestsrc name=vsrc is-live=true ! videoconvert ! videoscale name=vscale ! "
+      "video/x-raw,format=RGBx,width=224,height=224,framerate=60/1 ! tensor_converter ! "
+      "valve name=valvex ! input-selector name=is01 ! tensor_sink name=sinkx");
 
-  ml_tensors_info_set_count (in_info, 1);
+  status = ml_pipeline_construct (pipeline, nullptr, nullptr, &handle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-  in_dim[0] = 10;
-  in_dim[1] = 1;
-  in_dim[2] = 1;
-  in_dim[3] = 1;
+  /* Test Code */
+  status = ml_pipeline_element_get_handle (handle, nullptr, &vsrc_h);
+  EXPECT_NE (status, ML_ERROR_NONE);
 
-  ml_tensors_info_set_tensor_type (in_info, 0, ML_TENSOR_TYPE_INT16);
-  ml_tensors_info_set_tensor_dimension (in_info, 0, in_dim);
+  status = ml_pipeline_element_get_handle (handle, "WRONG_PROPERTY_NAME", &vsrc_h);
+  EXPECT_NE (status, ML_ERROR_NONE);
 
-  ml_tensors_info_clone (out_info, in_info);
+  status = ml_pipeline_destroy (handle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_single_open (&single, test_model, in_info, out_info,
-      ML_NNFW_TYPE_CUSTOM_FILTER, ML_NNFW_HW_ANY);
-  ASSERT_EQ (status, ML_ERROR_NONE);
+  g_free (pipeline);
+}
 
-  input = output1 = output2 = NULL;
+/**
+ * @brief Test case of Element Property Control.
+ * @detail Run the `ml_pipeline_element_release_handle()` API and check its results.
+ */
+TEST (nnstreamer_capi_element, release_handle_02_p)
+{
+  ml_pipeline_h handle = nullptr;
+  ml_pipeline_element_h vsrc_h = nullptr;
+  ml_pipeline_element_h selector_h = nullptr;
+  int status;
+  gchar *pipeline;
 
-  /* generate input data */
-  status = ml_tensors_data_create (in_info, &input);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-  ASSERT_TRUE (input != NULL);
+  pipeline = g_strdup (
+      "videotestsrc name=vsrc is-live=true ! videoconvert ! videoscale name=vscale ! "
+      "video/x-raw,format=RGBx,width=224,height=224,framerate=60/1 ! tensor_converter ! "
+      "valve name=valvex ! input-selector name=is01 ! tensor_sink name=sinkx");
 
-  status = ml_tensors_data_get_tensor_data (input, 0, &data_ptr, &data_size);
+  status = ml_pipeline_construct (pipeline, nullptr, nullptr, &handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  for (i = 0; i < 10; i++) {
-    ((int16_t *)data_ptr)[i] = (int16_t) (i + 1);
-  }
 
-  status = ml_single_invoke (single, input, &output1);
+  status = ml_pipeline_element_get_handle (handle, "vsrc", &vsrc_h);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_TRUE (output1 != NULL);
 
-  status = ml_single_invoke (single, input, &output2);
+  status = ml_pipeline_element_get_handle (handle, "is01", &selector_h);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_TRUE (output2 != NULL);
 
-  status = ml_tensors_data_destroy (input);
+  /* Test Code */
+  status = ml_pipeline_element_release_handle (vsrc_h);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_tensors_data_destroy (output1);
+  status = ml_pipeline_element_release_handle (selector_h);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  /** Destroy the other data by closing the handle */
-  status = ml_single_close (single);
+  status = ml_pipeline_destroy (handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  ml_tensors_info_destroy (in_info);
-  ml_tensors_info_destroy (out_info);
-  ml_tensors_data_destroy (output2);
-
-skip_test:
-  g_free (lib_path);
-  g_free (test_model);
+  g_free (pipeline);
 }
 
 /**
- * @brief Test NNStreamer single shot (custom filter)
- * @detail Change the number of input tensors, run the model and verify output
+ * @brief Test case of Element Property Control.
+ * @detail Run the `ml_pipeline_element_release_handle()` API and check its results.
  */
-TEST (nnstreamer_capi_singleshot, set_input_info_success_02)
+TEST (nnstreamer_capi_element, release_handle_03_n)
 {
-  const gchar cf_name[] = "libnnstreamer_customfilter_passthrough_variable" SO_FILE_EXTENSION;
-  gchar *lib_path = NULL;
-  gchar *test_model = NULL;
-  ml_single_h single;
-  ml_tensors_info_h in_info, out_info;
-  ml_tensors_info_h in_res = nullptr, out_res = nullptr;
-  ml_tensors_data_h input, output;
-  ml_tensor_dimension in_dim, out_dim, res_dim;
-  ml_tensor_type_e type = ML_TENSOR_TYPE_UNKNOWN;
-  unsigned int count = 0;
-  int status, tensor_size;
+  ml_pipeline_h handle = nullptr;
+  ml_pipeline_element_h vsrc_h = nullptr;
+  int status;
+  gchar *pipeline;
 
-  lib_path = nnsconf_get_custom_value_string ("filter", "customfilters");
-  if (lib_path == NULL) {
-    /* cannot get custom-filter directory */
-    goto skip_test;
-  }
+  pipeline = g_strdup (
+      "videotestsrc name=vsrc is-live=true ! videoconvert ! videoscale name=vscale ! "
+      "video/x-raw,format=RGBx,width=224,height=224,framerate=60/1 ! tensor_converter ! "
+      "valve name=valvex ! input-selector name=is01 ! tensor_sink name=sinkx");
 
-  test_model = g_build_filename (lib_path, cf_name, NULL);
-  if (!g_file_test (test_model, G_FILE_TEST_EXISTS)) {
-    goto skip_test;
-  }
+  status = ml_pipeline_construct (pipeline, nullptr, nullptr, &handle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-  ml_tensors_info_create (&in_info);
-  ml_tensors_info_create (&out_info);
+  /* Test Code */
+  status = ml_pipeline_element_release_handle (vsrc_h);
+  EXPECT_NE (status, ML_ERROR_NONE);
 
-  tensor_size = 5;
-  in_dim[0] = tensor_size;
-  in_dim[1] = 1;
-  in_dim[2] = 1;
-  in_dim[3] = 1;
-  ml_tensors_info_set_count (in_info, 1);
-  ml_tensors_info_set_tensor_type (in_info, 0, ML_TENSOR_TYPE_FLOAT32);
-  ml_tensors_info_set_tensor_dimension (in_info, 0, in_dim);
+  status = ml_pipeline_destroy (handle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-  out_dim[0] = tensor_size;
-  out_dim[1] = 1;
-  out_dim[2] = 1;
-  out_dim[3] = 1;
-  ml_tensors_info_set_count (out_info, 1);
-  ml_tensors_info_set_tensor_type (out_info, 0, ML_TENSOR_TYPE_FLOAT32);
-  ml_tensors_info_set_tensor_dimension (out_info, 0, out_dim);
+  g_free (pipeline);
+}
 
-  status = ml_single_open (&single, test_model, in_info, out_info,
-      ML_NNFW_TYPE_CUSTOM_FILTER, ML_NNFW_HW_ANY);
-  ASSERT_EQ (status, ML_ERROR_NONE);
+/**
+ * @brief Test case of Element Property Control.
+ * @detail Run the `ml_pipeline_element_set_property_bool()` API and check its results.
+ */
+TEST (nnstreamer_capi_element, set_property_bool_01_p)
+{
+  ml_pipeline_h handle = nullptr;
+  ml_pipeline_element_h selector_h = nullptr;
+  gchar *pipeline;
+  int status;
 
-  /* Run the model once with the original input/output info */
-  input = output = NULL;
+  pipeline = g_strdup (
+      "videotestsrc name=vsrc is-live=true ! videoconvert ! videoscale name=vscale ! "
+      "video/x-raw,format=RGBx,width=224,height=224,framerate=60/1 ! tensor_converter ! "
+      "valve name=valvex ! input-selector name=is01 ! tensor_sink name=sinkx");
 
-  /* generate dummy data */
-  status = ml_tensors_data_create (in_info, &input);
+  status = ml_pipeline_construct (pipeline, nullptr, nullptr, &handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_TRUE (input != NULL);
 
-  status = ml_single_invoke (single, input, &output);
+  status = ml_pipeline_element_get_handle (handle, "is01", &selector_h);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_TRUE (output != NULL);
-
-  ml_tensors_data_destroy (output);
-  ml_tensors_data_destroy (input);
-
-  /** modify input/output info and run again */
-  in_dim[0] = 10;
-  ml_tensors_info_set_tensor_dimension (in_info, 0, in_dim);
-  out_dim[0] = 10;
-  ml_tensors_info_set_tensor_dimension (out_info, 0, out_dim);
 
-  status = ml_single_get_input_info (single, &in_res);
+  /* Test Code */
+  status = ml_pipeline_element_set_property_bool (selector_h, "sync-streams", FALSE);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  /**
-   * 1. start with a model file with different input dimensions
-   * 2. change the input for the model file
-   * 3. run the model file with the updated input dimensions
-   * 4. verify the output
-   */
-
-  ml_tensors_info_get_tensor_dimension (in_res, 0, res_dim);
-  EXPECT_FALSE (in_dim[0] == res_dim[0]);
-  EXPECT_TRUE (in_dim[1] == res_dim[1]);
-  EXPECT_TRUE (in_dim[2] == res_dim[2]);
-  EXPECT_TRUE (in_dim[3] == res_dim[3]);
-
-  /** set the same original input dimension */
-  status = ml_single_set_input_info (single, in_info);
-  EXPECT_TRUE (status == ML_ERROR_NOT_SUPPORTED || status == ML_ERROR_NONE);
-  if (status == ML_ERROR_NONE) {
-    /* input tensor in filter */
-    ml_tensors_info_destroy (in_res);
-    status = ml_single_get_input_info (single, &in_res);
-    EXPECT_EQ (status, ML_ERROR_NONE);
-
-    status = ml_tensors_info_get_count (in_res, &count);
-    EXPECT_EQ (status, ML_ERROR_NONE);
-    EXPECT_EQ (count, 1U);
+  status = ml_pipeline_element_set_property_bool (selector_h, "sync-streams", TRUE);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-    status = ml_tensors_info_get_tensor_type (in_res, 0, &type);
-    EXPECT_EQ (status, ML_ERROR_NONE);
-    EXPECT_EQ (type, ML_TENSOR_TYPE_FLOAT32);
+  status = ml_pipeline_element_release_handle (selector_h);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-    ml_tensors_info_get_tensor_dimension (in_res, 0, res_dim);
-    EXPECT_TRUE (in_dim[0] == res_dim[0]);
-    EXPECT_TRUE (in_dim[1] == res_dim[1]);
-    EXPECT_TRUE (in_dim[2] == res_dim[2]);
-    EXPECT_TRUE (in_dim[3] == res_dim[3]);
+  status = ml_pipeline_destroy (handle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-    /* output tensor in filter */
-    status = ml_single_get_output_info (single, &out_res);
-    EXPECT_EQ (status, ML_ERROR_NONE);
+  g_free (pipeline);
+}
 
-    status = ml_tensors_info_get_count (out_res, &count);
-    EXPECT_EQ (status, ML_ERROR_NONE);
-    EXPECT_EQ (count, 1U);
+/**
+ * @brief Test case of Element Property Control.
+ * @detail Run the `ml_pipeline_element_set_property_bool()` API and check its results.
+ */
+TEST (nnstreamer_capi_element, set_property_bool_02_n)
+{
+  int status;
 
-    status = ml_tensors_info_get_tensor_type (out_res, 0, &type);
-    EXPECT_EQ (status, ML_ERROR_NONE);
-    EXPECT_EQ (type, ML_TENSOR_TYPE_FLOAT32);
+  /* Test Code */
+  status = ml_pipeline_element_set_property_bool (nullptr, "sync-streams", FALSE);
+  EXPECT_NE (status, ML_ERROR_NONE);
+}
 
-    ml_tensors_info_get_tensor_dimension (out_res, 0, res_dim);
-    EXPECT_TRUE (out_dim[0] == res_dim[0]);
-    EXPECT_TRUE (out_dim[1] == res_dim[1]);
-    EXPECT_TRUE (out_dim[2] == res_dim[2]);
-    EXPECT_TRUE (out_dim[3] == res_dim[3]);
+/**
+ * @brief Test case of Element Property Control.
+ * @detail Run the `ml_pipeline_element_set_property_bool()` API and check its results.
+ */
+TEST (nnstreamer_capi_element, set_property_bool_03_n)
+{
+  ml_pipeline_h handle = nullptr;
+  ml_pipeline_element_h selector_h = nullptr;
+  gchar *pipeline;
+  int status;
 
-    input = output = NULL;
+  pipeline = g_strdup (
+      "videotestsrc name=vsrc is-live=true ! videoconvert ! videoscale name=vscale ! "
+      "video/x-raw,format=RGBx,width=224,height=224,framerate=60/1 ! tensor_converter ! "
+      "valve name=valvex ! input-selector name=is01 ! tensor_sink name=sinkx");
 
-    /* generate dummy data */
-    status = ml_tensors_data_create (in_info, &input);
-    EXPECT_EQ (status, ML_ERROR_NONE);
-    EXPECT_TRUE (input != NULL);
+  status = ml_pipeline_construct (pipeline, nullptr, nullptr, &handle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-    status = ml_single_invoke (single, input, &output);
-    EXPECT_EQ (status, ML_ERROR_NONE);
-    EXPECT_TRUE (output != NULL);
+  status = ml_pipeline_element_get_handle (handle, "is01", &selector_h);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-    ml_tensors_data_destroy (output);
-    ml_tensors_data_destroy (input);
-  }
+  /* Test Code */
+  status = ml_pipeline_element_set_property_bool (selector_h, "WRONG_PROPERTY", TRUE);
+  EXPECT_NE (status, ML_ERROR_NONE);
 
-  status = ml_single_close (single);
+  status = ml_pipeline_element_release_handle (selector_h);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  ml_tensors_info_destroy (in_info);
-  ml_tensors_info_destroy (out_info);
-  ml_tensors_info_destroy (in_res);
-  ml_tensors_info_destroy (out_res);
+  status = ml_pipeline_destroy (handle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-skip_test:
-  g_free (lib_path);
-  g_free (test_model);
+  g_free (pipeline);
 }
 
 /**
- * @brief Test NNStreamer single shot (tflite)
- * @detail run the `ml_single_invoke_dynamic` api works properly.
+ * @brief Test case of Element Property Control.
+ * @detail Run the `ml_pipeline_element_set_property_bool()` API and check its results.
  */
-TEST (nnstreamer_capi_singleshot, invoke_dynamic_success_01_p)
+TEST (nnstreamer_capi_element, set_property_bool_04_n)
 {
-  ml_single_h single;
+  ml_pipeline_h handle = nullptr;
+  ml_pipeline_element_h vscale_h = nullptr;
   int status;
-  ml_tensors_info_h in_info, out_info;
-  ml_tensors_data_h input, output;
-  size_t data_size;
-
-  unsigned int tmp_count;
-  ml_tensor_type_e tmp_type = ML_TENSOR_TYPE_UNKNOWN;
-  ml_tensor_dimension tmp_dim;
+  gchar *pipeline;
 
-  const gchar *root_path = g_getenv ("NNSTREAMER_SOURCE_ROOT_PATH");
-  gchar *test_model;
+  pipeline = g_strdup (
+      "videotestsrc name=vsrc is-live=true ! videoconvert ! videoscale name=vscale ! "
+      "video/x-raw,format=RGBx,width=224,height=224,framerate=60/1 ! tensor_converter ! "
+      "valve name=valvex ! input-selector name=is01 ! tensor_sink name=sinkx");
 
-  /* supposed to run test in build directory */
-  if (root_path == NULL)
-    root_path = "..";
+  status = ml_pipeline_construct (pipeline, nullptr, nullptr, &handle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-  /* dynamic dimension supported */
-  test_model = g_build_filename (
-      root_path, "tests", "test_models", "models", "add.tflite", NULL);
-  ASSERT_TRUE (g_file_test (test_model, G_FILE_TEST_EXISTS));
+  status = ml_pipeline_element_get_handle (handle, "vscale", &vscale_h);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_single_open (&single, test_model, NULL, NULL,
-      ML_NNFW_TYPE_TENSORFLOW_LITE, ML_NNFW_HW_ANY);
-  if (is_enabled_tensorflow_lite) {
-    EXPECT_EQ (status, ML_ERROR_NONE);
-  } else {
-    EXPECT_NE (status, ML_ERROR_NONE);
-    goto skip_test;
-  }
+  /* Test Code */
+  status = ml_pipeline_element_set_property_bool (vscale_h, "sharpness", 10);
+  EXPECT_NE (status, ML_ERROR_NONE);
 
-  status = ml_single_get_input_info (single, &in_info);
+  status = ml_pipeline_element_release_handle (vscale_h);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_tensors_data_create (in_info, &input);
+  status = ml_pipeline_destroy (handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  {
-    float tmp_input[] = { 1.0 };
-    float *output_buf;
-    status = ml_tensors_data_set_tensor_data (input, 0, tmp_input, 1 * sizeof (float));
 
-    ml_tensors_info_get_count (in_info, &tmp_count);
-    ml_tensors_info_get_tensor_type (in_info, 0, &tmp_type);
-    ml_tensors_info_get_tensor_dimension (in_info, 0, tmp_dim);
+  g_free (pipeline);
+}
 
-    EXPECT_EQ (tmp_count, 1U);
-    EXPECT_EQ (tmp_type, ML_TENSOR_TYPE_FLOAT32);
-    EXPECT_EQ (tmp_dim[0], 1U);
-    EXPECT_EQ (tmp_dim[1], 1U);
-    EXPECT_EQ (tmp_dim[2], 1U);
-    EXPECT_EQ (tmp_dim[3], 1U);
+/**
+ * @brief Test case of Element Property Control.
+ * @detail Run the `ml_pipeline_element_get_property_bool()` API and check its results.
+ */
+TEST (nnstreamer_capi_element, get_property_bool_01_p)
+{
+  ml_pipeline_h handle = nullptr;
+  ml_pipeline_element_h selector_h = nullptr;
+  gchar *pipeline;
+  int ret_sync_streams;
+  int status;
 
-    status = ml_single_invoke_dynamic (single, input, in_info, &output, &out_info);
-    EXPECT_EQ (status, ML_ERROR_NONE);
+  pipeline = g_strdup (
+      "videotestsrc name=vsrc is-live=true ! videoconvert ! videoscale name=vscale ! "
+      "video/x-raw,format=RGBx,width=224,height=224,framerate=60/1 ! tensor_converter ! "
+      "valve name=valvex ! input-selector name=is01 ! tensor_sink name=sinkx");
 
-    ml_tensors_data_get_tensor_data (output, 0, (void **)&output_buf, &data_size);
+  status = ml_pipeline_construct (pipeline, nullptr, nullptr, &handle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-    EXPECT_FLOAT_EQ (output_buf[0], 3.0f);
-    EXPECT_EQ (data_size, sizeof (float));
+  status = ml_pipeline_element_get_handle (handle, "is01", &selector_h);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-    ml_tensors_info_get_count (out_info, &tmp_count);
-    ml_tensors_info_get_tensor_type (out_info, 0, &tmp_type);
-    ml_tensors_info_get_tensor_dimension (out_info, 0, tmp_dim);
+  status = ml_pipeline_element_set_property_bool (selector_h, "sync-streams", FALSE);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-    EXPECT_EQ (tmp_count, 1U);
-    EXPECT_EQ (tmp_type, ML_TENSOR_TYPE_FLOAT32);
-    EXPECT_EQ (tmp_dim[0], 1U);
-    EXPECT_EQ (tmp_dim[1], 1U);
-    EXPECT_EQ (tmp_dim[2], 1U);
-    EXPECT_EQ (tmp_dim[3], 1U);
+  /* Test Code */
+  status = ml_pipeline_element_get_property_bool (selector_h, "sync-streams", &ret_sync_streams);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (ret_sync_streams, FALSE);
 
-    ml_tensors_data_destroy (output);
-    ml_tensors_data_destroy (input);
-    ml_tensors_info_destroy (in_info);
-    ml_tensors_info_destroy (out_info);
-  }
+  status = ml_pipeline_element_set_property_bool (selector_h, "sync-streams", TRUE);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_single_set_property (single, "input", "5:1:1:1");
+  status = ml_pipeline_element_get_property_bool (selector_h, "sync-streams", &ret_sync_streams);
   EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (ret_sync_streams, TRUE);
 
-  status = ml_single_get_input_info (single, &in_info);
+  status = ml_pipeline_element_release_handle (selector_h);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_tensors_data_create (in_info, &input);
+  status = ml_pipeline_destroy (handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  {
-    float tmp_input2[] = { 1.0, 2.0, 3.0, 4.0, 5.0 };
-    float *output_buf2;
-    status = ml_tensors_data_set_tensor_data (input, 0, tmp_input2, 5 * sizeof (float));
+  g_free (pipeline);
+}
 
-    ml_tensors_info_get_count (in_info, &tmp_count);
-    ml_tensors_info_get_tensor_type (in_info, 0, &tmp_type);
-    ml_tensors_info_get_tensor_dimension (in_info, 0, tmp_dim);
+/**
+ * @brief Test case of Element Property Control.
+ * @detail Run the `ml_pipeline_element_get_property_bool()` API and check its results.
+ */
+TEST (nnstreamer_capi_element, get_property_bool_02_n)
+{
+  int ret_sync_streams;
+  int status;
 
-    EXPECT_EQ (tmp_count, 1U);
-    EXPECT_EQ (tmp_type, ML_TENSOR_TYPE_FLOAT32);
-    EXPECT_EQ (tmp_dim[0], 5U);
-    EXPECT_EQ (tmp_dim[1], 1U);
-    EXPECT_EQ (tmp_dim[2], 1U);
-    EXPECT_EQ (tmp_dim[3], 1U);
+  /* Test Code */
+  status = ml_pipeline_element_get_property_bool (nullptr, "sync-streams", &ret_sync_streams);
+  ASSERT_NE (status, ML_ERROR_NONE);
+}
 
-    status = ml_single_invoke_dynamic (single, input, in_info, &output, &out_info);
-    EXPECT_EQ (status, ML_ERROR_NONE);
+/**
+ * @brief Test case of Element Property Control.
+ * @detail Run the `ml_pipeline_element_get_property_bool()` API and check its results.
+ */
+TEST (nnstreamer_capi_element, get_property_bool_03_n)
+{
+  ml_pipeline_h handle = nullptr;
+  ml_pipeline_element_h selector_h = nullptr;
+  gchar *pipeline;
+  int ret_sync_streams;
+  int status;
 
-    ml_tensors_data_get_tensor_data (output, 0, (void **)&output_buf2, &data_size);
+  pipeline = g_strdup (
+      "videotestsrc name=vsrc is-live=true ! videoconvert ! videoscale name=vscale ! "
+      "video/x-raw,format=RGBx,width=224,height=224,framerate=60/1 ! tensor_converter ! "
+      "valve name=valvex ! input-selector name=is01 ! tensor_sink name=sinkx");
 
-    EXPECT_FLOAT_EQ (output_buf2[0], 3.0f);
-    EXPECT_FLOAT_EQ (output_buf2[1], 4.0f);
-    EXPECT_FLOAT_EQ (output_buf2[2], 5.0f);
-    EXPECT_FLOAT_EQ (output_buf2[3], 6.0f);
-    EXPECT_FLOAT_EQ (output_buf2[4], 7.0f);
-    EXPECT_EQ (data_size, 5 * sizeof (float));
+  status = ml_pipeline_construct (pipeline, nullptr, nullptr, &handle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-    ml_tensors_info_get_count (out_info, &tmp_count);
-    ml_tensors_info_get_tensor_type (out_info, 0, &tmp_type);
-    ml_tensors_info_get_tensor_dimension (out_info, 0, tmp_dim);
+  status = ml_pipeline_element_get_handle (handle, "is01", &selector_h);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-    EXPECT_EQ (tmp_count, 1U);
-    EXPECT_EQ (tmp_type, ML_TENSOR_TYPE_FLOAT32);
-    EXPECT_EQ (tmp_dim[0], 5U);
-    EXPECT_EQ (tmp_dim[1], 1U);
-    EXPECT_EQ (tmp_dim[2], 1U);
-    EXPECT_EQ (tmp_dim[3], 1U);
+  status = ml_pipeline_element_set_property_bool (selector_h, "sync-streams", FALSE);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-    status = ml_single_close (single);
-    EXPECT_EQ (status, ML_ERROR_NONE);
+  /* Test Code */
+  status = ml_pipeline_element_get_property_bool (selector_h, "WRONG_NAME", &ret_sync_streams);
+  EXPECT_NE (status, ML_ERROR_NONE);
 
-    ml_tensors_data_destroy (output);
-    ml_tensors_data_destroy (input);
-    ml_tensors_info_destroy (in_info);
-    ml_tensors_info_destroy (out_info);
-  }
-skip_test:
-  g_free (test_model);
+  status = ml_pipeline_element_release_handle (selector_h);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_pipeline_destroy (handle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  g_free (pipeline);
 }
 
 /**
- * @brief Test NNStreamer single shot (tflite)
- * @detail run the `ml_single_invoke_dynamic` api works properly.
+ * @brief Test case of Element Property Control.
+ * @detail Run the `ml_pipeline_element_get_property_bool()` API and check its results.
  */
-TEST (nnstreamer_capi_singleshot, invoke_dynamic_success_02_p)
+TEST (nnstreamer_capi_element, get_property_bool_04_n)
 {
-  ml_single_h single;
+  ml_pipeline_h handle = nullptr;
+  ml_pipeline_element_h selector_h = nullptr;
+  gchar *pipeline;
   int status;
-  ml_tensors_info_h in_info, out_info;
-  ml_tensors_data_h input, output;
-  size_t data_size;
-
-  unsigned int tmp_count;
-  ml_tensor_type_e tmp_type = ML_TENSOR_TYPE_UNKNOWN;
-  ml_tensor_dimension tmp_dim, in_dim;
-
-  const gchar *root_path = g_getenv ("NNSTREAMER_SOURCE_ROOT_PATH");
-  gchar *test_model;
-
-  /* supposed to run test in build directory */
-  if (root_path == NULL)
-    root_path = "..";
 
-  /* dynamic dimension supported */
-  test_model = g_build_filename (
-      root_path, "tests", "test_models", "models", "add.tflite", NULL);
-  ASSERT_TRUE (g_file_test (test_model, G_FILE_TEST_EXISTS));
-
-  status = ml_single_open (&single, test_model, NULL, NULL,
-      ML_NNFW_TYPE_TENSORFLOW_LITE, ML_NNFW_HW_ANY);
-  if (is_enabled_tensorflow_lite) {
-    EXPECT_EQ (status, ML_ERROR_NONE);
-  } else {
-    EXPECT_NE (status, ML_ERROR_NONE);
-    goto skip_test;
-  }
+  pipeline = g_strdup (
+      "videotestsrc name=vsrc is-live=true ! videoconvert ! videoscale name=vscale ! "
+      "video/x-raw,format=RGBx,width=224,height=224,framerate=60/1 ! tensor_converter ! "
+      "valve name=valvex ! input-selector name=is01 ! tensor_sink name=sinkx");
 
-  status = ml_single_get_input_info (single, &in_info);
+  status = ml_pipeline_construct (pipeline, nullptr, nullptr, &handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_tensors_data_create (in_info, &input);
+  status = ml_pipeline_element_get_handle (handle, "is01", &selector_h);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  {
-    float tmp_input[] = { 1.0 };
-    float *output_buf;
+  status = ml_pipeline_element_set_property_bool (selector_h, "sync-streams", FALSE);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-    status = ml_tensors_data_set_tensor_data (input, 0, tmp_input, 1 * sizeof (float));
+  /* Test Code */
+  status = ml_pipeline_element_get_property_bool (selector_h, "sync-streams", nullptr);
+  EXPECT_NE (status, ML_ERROR_NONE);
 
-    ml_tensors_info_get_count (in_info, &tmp_count);
-    ml_tensors_info_get_tensor_type (in_info, 0, &tmp_type);
-    ml_tensors_info_get_tensor_dimension (in_info, 0, tmp_dim);
+  status = ml_pipeline_element_release_handle (selector_h);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-    EXPECT_EQ (tmp_count, 1U);
-    EXPECT_EQ (tmp_type, ML_TENSOR_TYPE_FLOAT32);
-    EXPECT_EQ (tmp_dim[0], 1U);
-    EXPECT_EQ (tmp_dim[1], 1U);
-    EXPECT_EQ (tmp_dim[2], 1U);
-    EXPECT_EQ (tmp_dim[3], 1U);
+  status = ml_pipeline_destroy (handle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-    status = ml_single_invoke_dynamic (single, input, in_info, &output, &out_info);
-    EXPECT_EQ (status, ML_ERROR_NONE);
+  g_free (pipeline);
+}
 
-    ml_tensors_data_get_tensor_data (output, 0, (void **)&output_buf, &data_size);
-    EXPECT_FLOAT_EQ (output_buf[0], 3.0f);
-    EXPECT_EQ (data_size, sizeof (float));
+/**
+ * @brief Test case of Element Property Control.
+ * @detail Run the `ml_pipeline_element_get_property_bool()` API and check its results.
+ */
+TEST (nnstreamer_capi_element, get_property_bool_05_n)
+{
+  ml_pipeline_h handle = nullptr;
+  ml_pipeline_element_h udpsrc_h = nullptr;
+  int status;
+  int wrong_type;
+  gchar *pipeline;
 
-    ml_tensors_info_get_count (out_info, &tmp_count);
-    ml_tensors_info_get_tensor_type (out_info, 0, &tmp_type);
-    ml_tensors_info_get_tensor_dimension (out_info, 0, tmp_dim);
+  pipeline = g_strdup ("udpsrc name=usrc port=5555 caps=application/x-rtp ! queue ! fakesink");
 
-    EXPECT_EQ (tmp_count, 1U);
-    EXPECT_EQ (tmp_type, ML_TENSOR_TYPE_FLOAT32);
-    EXPECT_EQ (tmp_dim[0], 1U);
-    EXPECT_EQ (tmp_dim[1], 1U);
-    EXPECT_EQ (tmp_dim[2], 1U);
-    EXPECT_EQ (tmp_dim[3], 1U);
+  status = ml_pipeline_construct (pipeline, nullptr, nullptr, &handle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-    ml_tensors_data_destroy (output);
-    ml_tensors_data_destroy (input);
-    ml_tensors_info_destroy (in_info);
-    ml_tensors_info_destroy (out_info);
-  }
+  status = ml_pipeline_element_get_handle (handle, "usrc", &udpsrc_h);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_single_get_input_info (single, &in_info);
+  status = ml_pipeline_element_set_property_uint64 (udpsrc_h, "timeout", 123456789123456789ULL);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  in_dim[0] = 5;
-  in_dim[1] = 1;
-  in_dim[2] = 1;
-  in_dim[3] = 1;
+  /* Test Code */
+  status = ml_pipeline_element_get_property_bool (udpsrc_h, "timeout", &wrong_type);
+  EXPECT_NE (status, ML_ERROR_NONE);
 
-  status = ml_tensors_info_set_tensor_dimension (in_info, 0, in_dim);
+  status = ml_pipeline_element_release_handle (udpsrc_h);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_tensors_data_create (in_info, &input);
+  status = ml_pipeline_destroy (handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  {
-    float tmp_input2[] = { 1.0, 2.0, 3.0, 4.0, 5.0 };
-    float *output_buf2;
-    status = ml_tensors_data_set_tensor_data (input, 0, tmp_input2, 5 * sizeof (float));
+  g_free (pipeline);
+}
 
-    ml_tensors_info_get_count (in_info, &tmp_count);
-    ml_tensors_info_get_tensor_type (in_info, 0, &tmp_type);
-    ml_tensors_info_get_tensor_dimension (in_info, 0, tmp_dim);
+/**
+ * @brief Test case of Element Property Control.
+ * @detail Run the `ml_pipeline_element_set_property_string()` API and check its results.
+ */
+TEST (nnstreamer_capi_element, set_property_string_01_p)
+{
+  ml_pipeline_h handle = nullptr;
+  ml_pipeline_element_h filter_h = nullptr;
+  gchar *pipeline, *test_model;
+  int status;
+  const gchar *root_path = g_getenv ("NNSTREAMER_SOURCE_ROOT_PATH");
 
-    EXPECT_EQ (tmp_count, 1U);
-    EXPECT_EQ (tmp_type, ML_TENSOR_TYPE_FLOAT32);
-    EXPECT_EQ (tmp_dim[0], 5U);
-    EXPECT_EQ (tmp_dim[1], 1U);
-    EXPECT_EQ (tmp_dim[2], 1U);
-    EXPECT_EQ (tmp_dim[3], 1U);
+  /* Skip this test if enable-tensorflow-lite is false */
+  if (!is_enabled_tensorflow_lite)
+    return;
 
-    status = ml_single_invoke_dynamic (single, input, in_info, &output, &out_info);
-    EXPECT_EQ (status, ML_ERROR_NONE);
+  /* supposed to run test in build directory */
+  if (root_path == NULL)
+    root_path = "..";
 
-    ml_tensors_data_get_tensor_data (output, 0, (void **)&output_buf2, &data_size);
+  /* start pipeline test with valid model file */
+  test_model = g_build_filename (
+      root_path, "tests", "test_models", "models", "add.tflite", NULL);
+  EXPECT_TRUE (g_file_test (test_model, G_FILE_TEST_EXISTS));
 
-    EXPECT_FLOAT_EQ (output_buf2[0], 3.0f);
-    EXPECT_FLOAT_EQ (output_buf2[1], 4.0f);
-    EXPECT_FLOAT_EQ (output_buf2[2], 5.0f);
-    EXPECT_FLOAT_EQ (output_buf2[3], 6.0f);
-    EXPECT_FLOAT_EQ (output_buf2[4], 7.0f);
-    EXPECT_EQ (data_size, 5 * sizeof (float));
+  pipeline = g_strdup_printf (
+      "appsrc name=appsrc ! "
+      "other/tensor,dimension=(string)1:1:1:1,type=(string)float32,framerate=(fraction)0/1 ! "
+      "tensor_filter name=filter_h framework=tensorflow-lite model=%s ! tensor_sink name=tensor_sink",
+      test_model);
 
-    ml_tensors_info_get_count (out_info, &tmp_count);
-    ml_tensors_info_get_tensor_type (out_info, 0, &tmp_type);
-    ml_tensors_info_get_tensor_dimension (out_info, 0, tmp_dim);
+  status = ml_pipeline_construct (pipeline, nullptr, nullptr, &handle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-    EXPECT_EQ (tmp_count, 1U);
-    EXPECT_EQ (tmp_type, ML_TENSOR_TYPE_FLOAT32);
-    EXPECT_EQ (tmp_dim[0], 5U);
-    EXPECT_EQ (tmp_dim[1], 1U);
-    EXPECT_EQ (tmp_dim[2], 1U);
-    EXPECT_EQ (tmp_dim[3], 1U);
+  status = ml_pipeline_element_get_handle (handle, "filter_h", &filter_h);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-    status = ml_single_close (single);
-    EXPECT_EQ (status, ML_ERROR_NONE);
+  /* Test Code */
+  status = ml_pipeline_element_set_property_string (filter_h, "framework", "nnfw");
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-    ml_tensors_data_destroy (output);
-    ml_tensors_data_destroy (input);
-    ml_tensors_info_destroy (in_info);
-    ml_tensors_info_destroy (out_info);
-  }
+  status = ml_pipeline_element_release_handle (filter_h);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-skip_test:
+  status = ml_pipeline_destroy (handle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  g_free (pipeline);
   g_free (test_model);
 }
 
 /**
- * @brief Test NNStreamer single shot (tflite)
- * @detail check the `ml_single_invoke_dynamic` api handles exception cases well.
+ * @brief Test case of Element Property Control.
+ * @detail Run the `ml_pipeline_element_set_property_string()` API and check its results.
  */
-TEST (nnstreamer_capi_singleshot, invoke_dynamic_fail_n)
+TEST (nnstreamer_capi_element, set_property_string_02_n)
 {
-  ml_single_h single;
   int status;
-  ml_tensors_info_h in_info, out_info;
-  ml_tensors_data_h input, output;
 
+  /* Test Code */
+  status = ml_pipeline_element_set_property_string (nullptr, "framework", "nnfw");
+  EXPECT_NE (status, ML_ERROR_NONE);
+}
+
+/**
+ * @brief Test case of Element Property Control.
+ * @detail Run the `ml_pipeline_element_set_property_string()` API and check its results.
+ */
+TEST (nnstreamer_capi_element, set_property_string_03_n)
+{
+  ml_pipeline_h handle = nullptr;
+  ml_pipeline_element_h filter_h = nullptr;
+  gchar *pipeline, *test_model;
+  int status;
   const gchar *root_path = g_getenv ("NNSTREAMER_SOURCE_ROOT_PATH");
-  gchar *test_model;
+
+  /* Skip this test if enable-tensorflow-lite is false */
+  if (!is_enabled_tensorflow_lite)
+    return;
 
   /* supposed to run test in build directory */
   if (root_path == NULL)
     root_path = "..";
 
-  /* dynamic dimension supported */
+  /* start pipeline test with valid model file */
   test_model = g_build_filename (
       root_path, "tests", "test_models", "models", "add.tflite", NULL);
-  ASSERT_TRUE (g_file_test (test_model, G_FILE_TEST_EXISTS));
+  EXPECT_TRUE (g_file_test (test_model, G_FILE_TEST_EXISTS));
 
-  status = ml_single_open (&single, test_model, NULL, NULL,
-      ML_NNFW_TYPE_TENSORFLOW_LITE, ML_NNFW_HW_ANY);
-  if (is_enabled_tensorflow_lite) {
-    EXPECT_EQ (status, ML_ERROR_NONE);
-  } else {
-    EXPECT_NE (status, ML_ERROR_NONE);
-    goto skip_test;
-  }
+  pipeline = g_strdup_printf (
+      "appsrc name=appsrc ! "
+      "other/tensor,dimension=(string)1:1:1:1,type=(string)float32,framerate=(fraction)0/1 ! "
+      "tensor_filter name=filter_h framework=tensorflow-lite model=%s ! tensor_sink name=tensor_sink",
+      test_model);
 
-  status = ml_single_get_input_info (single, &in_info);
+  status = ml_pipeline_construct (pipeline, nullptr, nullptr, &handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_tensors_data_create (in_info, &input);
+  status = ml_pipeline_element_get_handle (handle, "filter_h", &filter_h);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_single_invoke_dynamic (NULL, input, in_info, &output, &out_info);
-  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+  /* Test Code */
+  status = ml_pipeline_element_set_property_string (filter_h, "WRONG_NAME", "invalid");
+  EXPECT_NE (status, ML_ERROR_NONE);
 
-  status = ml_single_invoke_dynamic (single, NULL, in_info, &output, &out_info);
-  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+  status = ml_pipeline_element_release_handle (filter_h);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_single_invoke_dynamic (single, input, NULL, &output, &out_info);
-  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+  status = ml_pipeline_destroy (handle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_single_invoke_dynamic (single, input, in_info, NULL, &out_info);
-  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+  g_free (pipeline);
+  g_free (test_model);
+}
 
-  status = ml_single_invoke_dynamic (single, input, in_info, &output, NULL);
-  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+/**
+ * @brief Test case of Element Property Control.
+ * @detail Run the `ml_pipeline_element_set_property_string()` API and check its results.
+ */
+TEST (nnstreamer_capi_element, set_property_string_04_n)
+{
+  ml_pipeline_h handle = nullptr;
+  ml_pipeline_element_h selector_h = nullptr;
+  gchar *pipeline;
+  int status;
 
-  status = ml_single_close (single);
+  pipeline = g_strdup (
+      "videotestsrc name=vsrc is-live=true ! videoconvert ! videoscale name=vscale ! "
+      "video/x-raw,format=RGBx,width=224,height=224,framerate=60/1 ! tensor_converter ! "
+      "valve name=valvex ! input-selector name=is01 ! tensor_sink name=sinkx");
+
+  status = ml_pipeline_construct (pipeline, nullptr, nullptr, &handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  ml_tensors_data_destroy (input);
-  ml_tensors_info_destroy (in_info);
+  status = ml_pipeline_element_get_handle (handle, "is01", &selector_h);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  /* Test Code */
+  status = ml_pipeline_element_set_property_string (selector_h, "sync-streams", "TRUE");
+  EXPECT_NE (status, ML_ERROR_NONE);
+
+  status = ml_pipeline_element_release_handle (selector_h);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_pipeline_destroy (handle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-skip_test:
-  g_free (test_model);
+  g_free (pipeline);
 }
 
 /**
  * @brief Test case of Element Property Control.
- * @detail Run the `ml_pipeline_element_get_handle()` API and check its results.
+ * @detail Run the `ml_pipeline_element_get_property_string()` API and check its results.
  */
-TEST (nnstreamer_capi_element, get_handle_00_p)
+TEST (nnstreamer_capi_element, get_property_string_01_p)
 {
   ml_pipeline_h handle = nullptr;
-  ml_pipeline_element_h vsrc_h = nullptr;
+  ml_pipeline_element_h filter_h = nullptr;
+  gchar *pipeline, *test_model;
+  gchar *ret_prop;
   int status;
-  gchar *pipeline;
+  const gchar *root_path = g_getenv ("NNSTREAMER_SOURCE_ROOT_PATH");
 
-  pipeline = g_strdup (
-      "videotestsrc name=vsrc is-live=true ! videoconvert ! videoscale name=vscale ! "
-      "video/x-raw,format=RGBx,width=224,height=224,framerate=60/1 ! tensor_converter ! "
-      "valve name=valvex ! input-selector name=is01 ! tensor_sink name=sinkx");
+  /* Skip this test if enable-tensorflow-lite is false */
+  if (!is_enabled_tensorflow_lite)
+    return;
+
+  /* supposed to run test in build directory */
+  if (root_path == NULL)
+    root_path = "..";
+
+  /* start pipeline test with valid model file */
+  test_model = g_build_filename (
+      root_path, "tests", "test_models", "models", "add.tflite", NULL);
+  EXPECT_TRUE (g_file_test (test_model, G_FILE_TEST_EXISTS));
+
+  pipeline = g_strdup_printf (
+      "appsrc name=appsrc ! "
+      "other/tensor,dimension=(string)1:1:1:1,type=(string)float32,framerate=(fraction)0/1 ! "
+      "tensor_filter name=filter_h framework=tensorflow-lite model=%s ! tensor_sink name=tensor_sink",
+      test_model);
 
   status = ml_pipeline_construct (pipeline, nullptr, nullptr, &handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
+  status = ml_pipeline_element_get_handle (handle, "filter_h", &filter_h);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
   /* Test Code */
-  status = ml_pipeline_element_get_handle (handle, "vsrc", &vsrc_h);
+  status = ml_pipeline_element_get_property_string (filter_h, "framework", &ret_prop);
   EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_TRUE (g_str_equal (ret_prop, "tensorflow-lite"));
+  g_free (ret_prop);
 
-  status = ml_pipeline_element_release_handle (vsrc_h);
+#ifdef ENABLE_NNFW_RUNTIME
+  status = ml_pipeline_element_set_property_string (filter_h, "framework", "nnfw");
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  /* Test Code */
+  status = ml_pipeline_element_get_property_string (filter_h, "framework", &ret_prop);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_TRUE (g_str_equal (ret_prop, "nnfw"));
+  g_free (ret_prop);
+#endif
+
+  status = ml_pipeline_element_release_handle (filter_h);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
   status = ml_pipeline_destroy (handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
   g_free (pipeline);
+  g_free (test_model);
 }
 
 /**
  * @brief Test case of Element Property Control.
- * @detail Run the `ml_pipeline_element_get_handle()` API and check its results.
+ * @detail Run the `ml_pipeline_element_get_property_string()` API and check its results.
  */
-TEST (nnstreamer_capi_element, get_handle_01_n)
+TEST (nnstreamer_capi_element, get_property_string_02_n)
+{
+  int status;
+  gchar *ret_prop;
+
+  /* Test Code */
+  status = ml_pipeline_element_get_property_string (nullptr, "framework", &ret_prop);
+  EXPECT_NE (status, ML_ERROR_NONE);
+}
+
+/**
+ * @brief Test case of Element Property Control.
+ * @detail Run the `ml_pipeline_element_get_property_string()` API and check its results.
+ */
+TEST (nnstreamer_capi_element, get_property_string_03_n)
 {
   ml_pipeline_h handle = nullptr;
-  ml_pipeline_element_h vsrc_h = nullptr;
+  ml_pipeline_element_h filter_h = nullptr;
+  gchar *pipeline, *test_model;
+  gchar *ret_prop;
   int status;
-  gchar *pipeline;
+  const gchar *root_path = g_getenv ("NNSTREAMER_SOURCE_ROOT_PATH");
 
-  pipeline = g_strdup (
-      "videotestsrc name=vsrc is-live=true ! videoconvert ! videoscale name=vscale ! "
-      "video/x-raw,format=RGBx,width=224,height=224,framerate=60/1 ! tensor_converter ! "
-      "valve name=valvex ! input-selector name=is01 ! tensor_sink name=sinkx");
+  /* Skip this test if enable-tensorflow-lite is false */
+  if (!is_enabled_tensorflow_lite)
+    return;
+
+  /* supposed to run test in build directory */
+  if (root_path == NULL)
+    root_path = "..";
+
+  /* start pipeline test with valid model file */
+  test_model = g_build_filename (
+      root_path, "tests", "test_models", "models", "add.tflite", NULL);
+  EXPECT_TRUE (g_file_test (test_model, G_FILE_TEST_EXISTS));
+
+  pipeline = g_strdup_printf (
+      "appsrc name=appsrc ! "
+      "other/tensor,dimension=(string)1:1:1:1,type=(string)float32,framerate=(fraction)0/1 ! "
+      "tensor_filter name=filter_h framework=tensorflow-lite model=%s ! tensor_sink name=tensor_sink",
+      test_model);
 
   status = ml_pipeline_construct (pipeline, nullptr, nullptr, &handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
+  status = ml_pipeline_element_get_handle (handle, "filter_h", &filter_h);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
   /* Test Code */
-  status = ml_pipeline_element_get_handle (handle, nullptr, &vsrc_h);
+  status = ml_pipeline_element_get_property_string (filter_h, "WRONG_NAME", &ret_prop);
   EXPECT_NE (status, ML_ERROR_NONE);
 
-  status = ml_pipeline_element_get_handle (handle, "WRONG_PROPERTY_NAME", &vsrc_h);
-  EXPECT_NE (status, ML_ERROR_NONE);
+  status = ml_pipeline_element_release_handle (filter_h);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
   status = ml_pipeline_destroy (handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
   g_free (pipeline);
+  g_free (test_model);
 }
 
 /**
  * @brief Test case of Element Property Control.
- * @detail Run the `ml_pipeline_element_release_handle()` API and check its results.
+ * @detail Run the `ml_pipeline_element_get_property_string()` API and check its results.
  */
-TEST (nnstreamer_capi_element, release_handle_02_p)
+TEST (nnstreamer_capi_element, get_property_string_04_n)
 {
   ml_pipeline_h handle = nullptr;
-  ml_pipeline_element_h vsrc_h = nullptr;
-  ml_pipeline_element_h selector_h = nullptr;
+  ml_pipeline_element_h filter_h = nullptr;
+  gchar *pipeline, *test_model;
   int status;
-  gchar *pipeline;
+  const gchar *root_path = g_getenv ("NNSTREAMER_SOURCE_ROOT_PATH");
 
-  pipeline = g_strdup (
-      "videotestsrc name=vsrc is-live=true ! videoconvert ! videoscale name=vscale ! "
-      "video/x-raw,format=RGBx,width=224,height=224,framerate=60/1 ! tensor_converter ! "
-      "valve name=valvex ! input-selector name=is01 ! tensor_sink name=sinkx");
+  /* Skip this test if enable-tensorflow-lite is false */
+  if (!is_enabled_tensorflow_lite)
+    return;
 
-  status = ml_pipeline_construct (pipeline, nullptr, nullptr, &handle);
-  EXPECT_EQ (status, ML_ERROR_NONE);
+  /* supposed to run test in build directory */
+  if (root_path == NULL)
+    root_path = "..";
 
-  status = ml_pipeline_element_get_handle (handle, "vsrc", &vsrc_h);
+  /* start pipeline test with valid model file */
+  test_model = g_build_filename (
+      root_path, "tests", "test_models", "models", "add.tflite", NULL);
+  EXPECT_TRUE (g_file_test (test_model, G_FILE_TEST_EXISTS));
+
+  pipeline = g_strdup_printf (
+      "appsrc name=appsrc ! "
+      "other/tensor,dimension=(string)1:1:1:1,type=(string)float32,framerate=(fraction)0/1 ! "
+      "tensor_filter name=filter_h framework=tensorflow-lite model=%s ! tensor_sink name=tensor_sink",
+      test_model);
+
+  status = ml_pipeline_construct (pipeline, nullptr, nullptr, &handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_pipeline_element_get_handle (handle, "is01", &selector_h);
+  status = ml_pipeline_element_get_handle (handle, "filter_h", &filter_h);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
   /* Test Code */
-  status = ml_pipeline_element_release_handle (vsrc_h);
-  EXPECT_EQ (status, ML_ERROR_NONE);
+  status = ml_pipeline_element_get_property_string (filter_h, "framework", nullptr);
+  EXPECT_NE (status, ML_ERROR_NONE);
 
-  status = ml_pipeline_element_release_handle (selector_h);
+  status = ml_pipeline_element_release_handle (filter_h);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
   status = ml_pipeline_destroy (handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
   g_free (pipeline);
+  g_free (test_model);
 }
 
 /**
  * @brief Test case of Element Property Control.
- * @detail Run the `ml_pipeline_element_release_handle()` API and check its results.
+ * @detail Run the `ml_pipeline_element_get_property_string()` API and check its results.
  */
-TEST (nnstreamer_capi_element, release_handle_03_n)
+TEST (nnstreamer_capi_element, get_property_string_05_n)
 {
   ml_pipeline_h handle = nullptr;
-  ml_pipeline_element_h vsrc_h = nullptr;
-  int status;
+  ml_pipeline_element_h selector_h = nullptr;
   gchar *pipeline;
+  gchar *ret_wrong_type;
+  int status;
 
   pipeline = g_strdup (
       "videotestsrc name=vsrc is-live=true ! videoconvert ! videoscale name=vscale ! "
@@ -7023,10 +11038,19 @@ TEST (nnstreamer_capi_element, release_handle_03_n)
   status = ml_pipeline_construct (pipeline, nullptr, nullptr, &handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
+  status = ml_pipeline_element_get_handle (handle, "is01", &selector_h);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_pipeline_element_set_property_bool (selector_h, "sync-streams", FALSE);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
   /* Test Code */
-  status = ml_pipeline_element_release_handle (vsrc_h);
+  status = ml_pipeline_element_get_property_string (selector_h, "sync-streams", &ret_wrong_type);
   EXPECT_NE (status, ML_ERROR_NONE);
 
+  status = ml_pipeline_element_release_handle (selector_h);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
   status = ml_pipeline_destroy (handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
@@ -7035,14 +11059,14 @@ TEST (nnstreamer_capi_element, release_handle_03_n)
 
 /**
  * @brief Test case of Element Property Control.
- * @detail Run the `ml_pipeline_element_set_property_bool()` API and check its results.
+ * @detail Run the `ml_pipeline_element_set_property_int32()` API and check its results.
  */
-TEST (nnstreamer_capi_element, set_property_bool_01_p)
+TEST (nnstreamer_capi_element, set_property_int32_01_p)
 {
   ml_pipeline_h handle = nullptr;
-  ml_pipeline_element_h selector_h = nullptr;
-  gchar *pipeline;
+  ml_pipeline_element_h vsrc_h = nullptr;
   int status;
+  gchar *pipeline;
 
   pipeline = g_strdup (
       "videotestsrc name=vsrc is-live=true ! videoconvert ! videoscale name=vscale ! "
@@ -7052,17 +11076,17 @@ TEST (nnstreamer_capi_element, set_property_bool_01_p)
   status = ml_pipeline_construct (pipeline, nullptr, nullptr, &handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_pipeline_element_get_handle (handle, "is01", &selector_h);
+  status = ml_pipeline_element_get_handle (handle, "vsrc", &vsrc_h);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
   /* Test Code */
-  status = ml_pipeline_element_set_property_bool (selector_h, "sync-streams", FALSE);
+  status = ml_pipeline_element_set_property_int32 (vsrc_h, "kx", 10);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_pipeline_element_set_property_bool (selector_h, "sync-streams", TRUE);
+  status = ml_pipeline_element_set_property_int32 (vsrc_h, "kx", -1234);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_pipeline_element_release_handle (selector_h);
+  status = ml_pipeline_element_release_handle (vsrc_h);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
   status = ml_pipeline_destroy (handle);
@@ -7073,27 +11097,27 @@ TEST (nnstreamer_capi_element, set_property_bool_01_p)
 
 /**
  * @brief Test case of Element Property Control.
- * @detail Run the `ml_pipeline_element_set_property_bool()` API and check its results.
+ * @detail Run the `ml_pipeline_element_set_property_int32()` API and check its results.
  */
-TEST (nnstreamer_capi_element, set_property_bool_02_n)
+TEST (nnstreamer_capi_element, set_property_int32_02_n)
 {
   int status;
 
   /* Test Code */
-  status = ml_pipeline_element_set_property_bool (nullptr, "sync-streams", FALSE);
+  status = ml_pipeline_element_set_property_int32 (nullptr, "kx", 10);
   EXPECT_NE (status, ML_ERROR_NONE);
 }
 
 /**
  * @brief Test case of Element Property Control.
- * @detail Run the `ml_pipeline_element_set_property_bool()` API and check its results.
+ * @detail Run the `ml_pipeline_element_set_property_int32()` API and check its results.
  */
-TEST (nnstreamer_capi_element, set_property_bool_03_n)
+TEST (nnstreamer_capi_element, set_property_int32_03_n)
 {
   ml_pipeline_h handle = nullptr;
-  ml_pipeline_element_h selector_h = nullptr;
-  gchar *pipeline;
+  ml_pipeline_element_h vsrc_h = nullptr;
   int status;
+  gchar *pipeline;
 
   pipeline = g_strdup (
       "videotestsrc name=vsrc is-live=true ! videoconvert ! videoscale name=vscale ! "
@@ -7103,14 +11127,14 @@ TEST (nnstreamer_capi_element, set_property_bool_03_n)
   status = ml_pipeline_construct (pipeline, nullptr, nullptr, &handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_pipeline_element_get_handle (handle, "is01", &selector_h);
+  status = ml_pipeline_element_get_handle (handle, "vsrc", &vsrc_h);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
   /* Test Code */
-  status = ml_pipeline_element_set_property_bool (selector_h, "WRONG_PROPERTY", TRUE);
+  status = ml_pipeline_element_set_property_int32 (vsrc_h, "WRONG_NAME", 10);
   EXPECT_NE (status, ML_ERROR_NONE);
 
-  status = ml_pipeline_element_release_handle (selector_h);
+  status = ml_pipeline_element_release_handle (vsrc_h);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
   status = ml_pipeline_destroy (handle);
@@ -7121,31 +11145,30 @@ TEST (nnstreamer_capi_element, set_property_bool_03_n)
 
 /**
  * @brief Test case of Element Property Control.
- * @detail Run the `ml_pipeline_element_set_property_bool()` API and check its results.
+ * @detail Run the `ml_pipeline_element_set_property_int32()` API and check its results.
  */
-TEST (nnstreamer_capi_element, set_property_bool_04_n)
+TEST (nnstreamer_capi_element, set_property_int32_04_n)
 {
   ml_pipeline_h handle = nullptr;
-  ml_pipeline_element_h vscale_h = nullptr;
-  int status;
+  ml_pipeline_element_h demux_h = nullptr;
   gchar *pipeline;
+  int status;
 
   pipeline = g_strdup (
-      "videotestsrc name=vsrc is-live=true ! videoconvert ! videoscale name=vscale ! "
-      "video/x-raw,format=RGBx,width=224,height=224,framerate=60/1 ! tensor_converter ! "
-      "valve name=valvex ! input-selector name=is01 ! tensor_sink name=sinkx");
+      "videotestsrc ! video/x-raw,format=RGB,width=640,height=480 ! videorate max-rate=1 ! "
+      "tensor_converter ! tensor_mux ! tensor_demux name=demux ! tensor_sink");
 
   status = ml_pipeline_construct (pipeline, nullptr, nullptr, &handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_pipeline_element_get_handle (handle, "vscale", &vscale_h);
+  status = ml_pipeline_element_get_handle (handle, "demux", &demux_h);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
   /* Test Code */
-  status = ml_pipeline_element_set_property_bool (vscale_h, "sharpness", 10);
+  status = ml_pipeline_element_set_property_int32 (demux_h, "tensorpick", 1);
   EXPECT_NE (status, ML_ERROR_NONE);
 
-  status = ml_pipeline_element_release_handle (vscale_h);
+  status = ml_pipeline_element_release_handle (demux_h);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
   status = ml_pipeline_destroy (handle);
@@ -7156,15 +11179,15 @@ TEST (nnstreamer_capi_element, set_property_bool_04_n)
 
 /**
  * @brief Test case of Element Property Control.
- * @detail Run the `ml_pipeline_element_get_property_bool()` API and check its results.
+ * @detail Run the `ml_pipeline_element_get_property_int32()` API and check its results.
  */
-TEST (nnstreamer_capi_element, get_property_bool_01_p)
+TEST (nnstreamer_capi_element, get_property_int32_01_p)
 {
   ml_pipeline_h handle = nullptr;
-  ml_pipeline_element_h selector_h = nullptr;
-  gchar *pipeline;
-  int ret_sync_streams;
+  ml_pipeline_element_h vsrc_h = nullptr;
   int status;
+  int32_t ret_kx;
+  gchar *pipeline;
 
   pipeline = g_strdup (
       "videotestsrc name=vsrc is-live=true ! videoconvert ! videoscale name=vscale ! "
@@ -7174,25 +11197,25 @@ TEST (nnstreamer_capi_element, get_property_bool_01_p)
   status = ml_pipeline_construct (pipeline, nullptr, nullptr, &handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_pipeline_element_get_handle (handle, "is01", &selector_h);
+  status = ml_pipeline_element_get_handle (handle, "vsrc", &vsrc_h);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_pipeline_element_set_property_bool (selector_h, "sync-streams", FALSE);
+  status = ml_pipeline_element_set_property_int32 (vsrc_h, "kx", 10);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
   /* Test Code */
-  status = ml_pipeline_element_get_property_bool (selector_h, "sync-streams", &ret_sync_streams);
+  status = ml_pipeline_element_get_property_int32 (vsrc_h, "kx", &ret_kx);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (ret_sync_streams, FALSE);
+  EXPECT_TRUE (ret_kx == 10);
 
-  status = ml_pipeline_element_set_property_bool (selector_h, "sync-streams", TRUE);
+  status = ml_pipeline_element_set_property_int32 (vsrc_h, "kx", -1234);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_pipeline_element_get_property_bool (selector_h, "sync-streams", &ret_sync_streams);
+  status = ml_pipeline_element_get_property_int32 (vsrc_h, "kx", &ret_kx);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (ret_sync_streams, TRUE);
+  EXPECT_TRUE (ret_kx == -1234);
 
-  status = ml_pipeline_element_release_handle (selector_h);
+  status = ml_pipeline_element_release_handle (vsrc_h);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
   status = ml_pipeline_destroy (handle);
@@ -7203,29 +11226,29 @@ TEST (nnstreamer_capi_element, get_property_bool_01_p)
 
 /**
  * @brief Test case of Element Property Control.
- * @detail Run the `ml_pipeline_element_get_property_bool()` API and check its results.
+ * @detail Run the `ml_pipeline_element_get_property_int32()` API and check its results.
  */
-TEST (nnstreamer_capi_element, get_property_bool_02_n)
+TEST (nnstreamer_capi_element, get_property_int32_02_n)
 {
-  int ret_sync_streams;
   int status;
+  int32_t ret_kx;
 
   /* Test Code */
-  status = ml_pipeline_element_get_property_bool (nullptr, "sync-streams", &ret_sync_streams);
-  ASSERT_NE (status, ML_ERROR_NONE);
+  status = ml_pipeline_element_get_property_int32 (nullptr, "kx", &ret_kx);
+  EXPECT_NE (status, ML_ERROR_NONE);
 }
 
 /**
  * @brief Test case of Element Property Control.
- * @detail Run the `ml_pipeline_element_get_property_bool()` API and check its results.
+ * @detail Run the `ml_pipeline_element_get_property_int32()` API and check its results.
  */
-TEST (nnstreamer_capi_element, get_property_bool_03_n)
+TEST (nnstreamer_capi_element, get_property_int32_03_n)
 {
   ml_pipeline_h handle = nullptr;
-  ml_pipeline_element_h selector_h = nullptr;
-  gchar *pipeline;
-  int ret_sync_streams;
+  ml_pipeline_element_h vsrc_h = nullptr;
   int status;
+  int32_t ret_kx;
+  gchar *pipeline;
 
   pipeline = g_strdup (
       "videotestsrc name=vsrc is-live=true ! videoconvert ! videoscale name=vscale ! "
@@ -7235,17 +11258,17 @@ TEST (nnstreamer_capi_element, get_property_bool_03_n)
   status = ml_pipeline_construct (pipeline, nullptr, nullptr, &handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_pipeline_element_get_handle (handle, "is01", &selector_h);
+  status = ml_pipeline_element_get_handle (handle, "vsrc", &vsrc_h);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_pipeline_element_set_property_bool (selector_h, "sync-streams", FALSE);
+  status = ml_pipeline_element_set_property_int32 (vsrc_h, "kx", 10);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
   /* Test Code */
-  status = ml_pipeline_element_get_property_bool (selector_h, "WRONG_NAME", &ret_sync_streams);
+  status = ml_pipeline_element_get_property_int32 (vsrc_h, "WRONG_NAME", &ret_kx);
   EXPECT_NE (status, ML_ERROR_NONE);
 
-  status = ml_pipeline_element_release_handle (selector_h);
+  status = ml_pipeline_element_release_handle (vsrc_h);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
   status = ml_pipeline_destroy (handle);
@@ -7256,14 +11279,14 @@ TEST (nnstreamer_capi_element, get_property_bool_03_n)
 
 /**
  * @brief Test case of Element Property Control.
- * @detail Run the `ml_pipeline_element_get_property_bool()` API and check its results.
+ * @detail Run the `ml_pipeline_element_get_property_int32()` API and check its results.
  */
-TEST (nnstreamer_capi_element, get_property_bool_04_n)
+TEST (nnstreamer_capi_element, get_property_int32_04_n)
 {
   ml_pipeline_h handle = nullptr;
-  ml_pipeline_element_h selector_h = nullptr;
-  gchar *pipeline;
+  ml_pipeline_element_h vsrc_h = nullptr;
   int status;
+  gchar *pipeline;
 
   pipeline = g_strdup (
       "videotestsrc name=vsrc is-live=true ! videoconvert ! videoscale name=vscale ! "
@@ -7273,17 +11296,17 @@ TEST (nnstreamer_capi_element, get_property_bool_04_n)
   status = ml_pipeline_construct (pipeline, nullptr, nullptr, &handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_pipeline_element_get_handle (handle, "is01", &selector_h);
+  status = ml_pipeline_element_get_handle (handle, "vsrc", &vsrc_h);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_pipeline_element_set_property_bool (selector_h, "sync-streams", FALSE);
+  status = ml_pipeline_element_set_property_int32 (vsrc_h, "kx", 10);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
   /* Test Code */
-  status = ml_pipeline_element_get_property_bool (selector_h, "sync-streams", nullptr);
+  status = ml_pipeline_element_get_property_int32 (vsrc_h, "kx", nullptr);
   EXPECT_NE (status, ML_ERROR_NONE);
 
-  status = ml_pipeline_element_release_handle (selector_h);
+  status = ml_pipeline_element_release_handle (vsrc_h);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
   status = ml_pipeline_destroy (handle);
@@ -7294,32 +11317,35 @@ TEST (nnstreamer_capi_element, get_property_bool_04_n)
 
 /**
  * @brief Test case of Element Property Control.
- * @detail Run the `ml_pipeline_element_get_property_bool()` API and check its results.
+ * @detail Run the `ml_pipeline_element_get_property_int32()` API and check its results.
  */
-TEST (nnstreamer_capi_element, get_property_bool_05_n)
+TEST (nnstreamer_capi_element, get_property_int32_05_n)
 {
   ml_pipeline_h handle = nullptr;
-  ml_pipeline_element_h udpsrc_h = nullptr;
+  ml_pipeline_element_h vscale_h = nullptr;
   int status;
   int wrong_type;
   gchar *pipeline;
 
-  pipeline = g_strdup ("udpsrc name=usrc port=5555 caps=application/x-rtp ! queue ! fakesink");
+  pipeline = g_strdup (
+      "videotestsrc name=vsrc is-live=true ! videoconvert ! videoscale name=vscale ! "
+      "video/x-raw,format=RGBx,width=224,height=224,framerate=60/1 ! tensor_converter ! "
+      "valve name=valvex ! input-selector name=is01 ! tensor_sink name=sinkx");
 
   status = ml_pipeline_construct (pipeline, nullptr, nullptr, &handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_pipeline_element_get_handle (handle, "usrc", &udpsrc_h);
+  status = ml_pipeline_element_get_handle (handle, "vscale", &vscale_h);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_pipeline_element_set_property_uint64 (udpsrc_h, "timeout", 123456789123456789ULL);
+  status = ml_pipeline_element_set_property_double (vscale_h, "sharpness", 0.72);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
   /* Test Code */
-  status = ml_pipeline_element_get_property_bool (udpsrc_h, "timeout", &wrong_type);
+  status = ml_pipeline_element_get_property_int32 (vscale_h, "sharpness", &wrong_type);
   EXPECT_NE (status, ML_ERROR_NONE);
 
-  status = ml_pipeline_element_release_handle (udpsrc_h);
+  status = ml_pipeline_element_release_handle (vscale_h);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
   status = ml_pipeline_destroy (handle);
@@ -7330,129 +11356,100 @@ TEST (nnstreamer_capi_element, get_property_bool_05_n)
 
 /**
  * @brief Test case of Element Property Control.
- * @detail Run the `ml_pipeline_element_set_property_string()` API and check its results.
+ * @detail Run the `ml_pipeline_element_set_property_int64()` API and check its results.
  */
-TEST (nnstreamer_capi_element, set_property_string_01_p)
+TEST (nnstreamer_capi_element, set_property_int64_01_p)
 {
   ml_pipeline_h handle = nullptr;
-  ml_pipeline_element_h filter_h = nullptr;
-  gchar *pipeline, *test_model;
+  ml_pipeline_element_h vsrc_h = nullptr;
   int status;
-  const gchar *root_path = g_getenv ("NNSTREAMER_SOURCE_ROOT_PATH");
-
-  /* Skip this test if enable-tensorflow-lite is false */
-  if (!is_enabled_tensorflow_lite)
-    return;
-
-  /* supposed to run test in build directory */
-  if (root_path == NULL)
-    root_path = "..";
-
-  /* start pipeline test with valid model file */
-  test_model = g_build_filename (
-      root_path, "tests", "test_models", "models", "add.tflite", NULL);
-  EXPECT_TRUE (g_file_test (test_model, G_FILE_TEST_EXISTS));
+  gchar *pipeline;
 
-  pipeline = g_strdup_printf (
-      "appsrc name=appsrc ! "
-      "other/tensor,dimension=(string)1:1:1:1,type=(string)float32,framerate=(fraction)0/1 ! "
-      "tensor_filter name=filter_h framework=tensorflow-lite model=%s ! tensor_sink name=tensor_sink",
-      test_model);
+  pipeline = g_strdup (
+      "videotestsrc name=vsrc is-live=true ! videoconvert ! videoscale name=vscale ! "
+      "video/x-raw,format=RGBx,width=224,height=224,framerate=60/1 ! tensor_converter ! "
+      "valve name=valvex ! input-selector name=is01 ! tensor_sink name=sinkx");
 
   status = ml_pipeline_construct (pipeline, nullptr, nullptr, &handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_pipeline_element_get_handle (handle, "filter_h", &filter_h);
+  status = ml_pipeline_element_get_handle (handle, "vsrc", &vsrc_h);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
   /* Test Code */
-  status = ml_pipeline_element_set_property_string (filter_h, "framework", "nnfw");
+  status = ml_pipeline_element_set_property_int64 (vsrc_h, "timestamp-offset", 1234567891234LL);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_pipeline_element_release_handle (filter_h);
+  status = ml_pipeline_element_set_property_int64 (vsrc_h, "timestamp-offset", 10LL);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_pipeline_element_release_handle (vsrc_h);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
   status = ml_pipeline_destroy (handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
   g_free (pipeline);
-  g_free (test_model);
 }
 
 /**
  * @brief Test case of Element Property Control.
- * @detail Run the `ml_pipeline_element_set_property_string()` API and check its results.
+ * @detail Run the `ml_pipeline_element_set_property_int64()` API and check its results.
  */
-TEST (nnstreamer_capi_element, set_property_string_02_n)
+TEST (nnstreamer_capi_element, set_property_int64_02_n)
 {
   int status;
 
   /* Test Code */
-  status = ml_pipeline_element_set_property_string (nullptr, "framework", "nnfw");
+  status = ml_pipeline_element_set_property_int64 (nullptr, "timestamp-offset", 1234567891234LL);
   EXPECT_NE (status, ML_ERROR_NONE);
 }
 
 /**
  * @brief Test case of Element Property Control.
- * @detail Run the `ml_pipeline_element_set_property_string()` API and check its results.
+ * @detail Run the `ml_pipeline_element_set_property_int64()` API and check its results.
  */
-TEST (nnstreamer_capi_element, set_property_string_03_n)
+TEST (nnstreamer_capi_element, set_property_int64_03_n)
 {
   ml_pipeline_h handle = nullptr;
-  ml_pipeline_element_h filter_h = nullptr;
-  gchar *pipeline, *test_model;
+  ml_pipeline_element_h vsrc_h = nullptr;
   int status;
-  const gchar *root_path = g_getenv ("NNSTREAMER_SOURCE_ROOT_PATH");
-
-  /* Skip this test if enable-tensorflow-lite is false */
-  if (!is_enabled_tensorflow_lite)
-    return;
-
-  /* supposed to run test in build directory */
-  if (root_path == NULL)
-    root_path = "..";
-
-  /* start pipeline test with valid model file */
-  test_model = g_build_filename (
-      root_path, "tests", "test_models", "models", "add.tflite", NULL);
-  EXPECT_TRUE (g_file_test (test_model, G_FILE_TEST_EXISTS));
+  gchar *pipeline;
 
-  pipeline = g_strdup_printf (
-      "appsrc name=appsrc ! "
-      "other/tensor,dimension=(string)1:1:1:1,type=(string)float32,framerate=(fraction)0/1 ! "
-      "tensor_filter name=filter_h framework=tensorflow-lite model=%s ! tensor_sink name=tensor_sink",
-      test_model);
+  pipeline = g_strdup (
+      "videotestsrc name=vsrc is-live=true ! videoconvert ! videoscale name=vscale ! "
+      "video/x-raw,format=RGBx,width=224,height=224,framerate=60/1 ! tensor_converter ! "
+      "valve name=valvex ! input-selector name=is01 ! tensor_sink name=sinkx");
 
   status = ml_pipeline_construct (pipeline, nullptr, nullptr, &handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_pipeline_element_get_handle (handle, "filter_h", &filter_h);
+  status = ml_pipeline_element_get_handle (handle, "vsrc", &vsrc_h);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
   /* Test Code */
-  status = ml_pipeline_element_set_property_string (filter_h, "WRONG_NAME", "invalid");
+  status = ml_pipeline_element_set_property_int64 (vsrc_h, "WRONG_NAME", 1234567891234LL);
   EXPECT_NE (status, ML_ERROR_NONE);
 
-  status = ml_pipeline_element_release_handle (filter_h);
+  status = ml_pipeline_element_release_handle (vsrc_h);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
   status = ml_pipeline_destroy (handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
   g_free (pipeline);
-  g_free (test_model);
 }
 
 /**
  * @brief Test case of Element Property Control.
- * @detail Run the `ml_pipeline_element_set_property_string()` API and check its results.
+ * @detail Run the `ml_pipeline_element_set_property_int64()` API and check its results.
  */
-TEST (nnstreamer_capi_element, set_property_string_04_n)
+TEST (nnstreamer_capi_element, set_property_int64_04_n)
 {
   ml_pipeline_h handle = nullptr;
-  ml_pipeline_element_h selector_h = nullptr;
-  gchar *pipeline;
+  ml_pipeline_element_h vsrc_h = nullptr;
   int status;
+  gchar *pipeline;
 
   pipeline = g_strdup (
       "videotestsrc name=vsrc is-live=true ! videoconvert ! videoscale name=vscale ! "
@@ -7462,14 +11459,14 @@ TEST (nnstreamer_capi_element, set_property_string_04_n)
   status = ml_pipeline_construct (pipeline, nullptr, nullptr, &handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_pipeline_element_get_handle (handle, "is01", &selector_h);
+  status = ml_pipeline_element_get_handle (handle, "vsrc", &vsrc_h);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
   /* Test Code */
-  status = ml_pipeline_element_set_property_string (selector_h, "sync-streams", "TRUE");
+  status = ml_pipeline_element_set_property_int64 (vsrc_h, "foreground-color", 123456);
   EXPECT_NE (status, ML_ERROR_NONE);
 
-  status = ml_pipeline_element_release_handle (selector_h);
+  status = ml_pipeline_element_release_handle (vsrc_h);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
   status = ml_pipeline_destroy (handle);
@@ -7480,197 +11477,156 @@ TEST (nnstreamer_capi_element, set_property_string_04_n)
 
 /**
  * @brief Test case of Element Property Control.
- * @detail Run the `ml_pipeline_element_get_property_string()` API and check its results.
+ * @detail Run the `ml_pipeline_element_get_property_int64()` API and check its results.
  */
-TEST (nnstreamer_capi_element, get_property_string_01_p)
+TEST (nnstreamer_capi_element, get_property_int64_01_p)
 {
   ml_pipeline_h handle = nullptr;
-  ml_pipeline_element_h filter_h = nullptr;
-  gchar *pipeline, *test_model;
-  gchar *ret_prop;
+  ml_pipeline_element_h vsrc_h = nullptr;
   int status;
-  const gchar *root_path = g_getenv ("NNSTREAMER_SOURCE_ROOT_PATH");
-
-  /* Skip this test if enable-tensorflow-lite is false */
-  if (!is_enabled_tensorflow_lite)
-    return;
-
-  /* supposed to run test in build directory */
-  if (root_path == NULL)
-    root_path = "..";
-
-  /* start pipeline test with valid model file */
-  test_model = g_build_filename (
-      root_path, "tests", "test_models", "models", "add.tflite", NULL);
-  EXPECT_TRUE (g_file_test (test_model, G_FILE_TEST_EXISTS));
+  int64_t ret_timestame_offset;
+  gchar *pipeline;
 
-  pipeline = g_strdup_printf (
-      "appsrc name=appsrc ! "
-      "other/tensor,dimension=(string)1:1:1:1,type=(string)float32,framerate=(fraction)0/1 ! "
-      "tensor_filter name=filter_h framework=tensorflow-lite model=%s ! tensor_sink name=tensor_sink",
-      test_model);
+  pipeline = g_strdup (
+      "videotestsrc name=vsrc is-live=true ! videoconvert ! videoscale name=vscale ! "
+      "video/x-raw,format=RGBx,width=224,height=224,framerate=60/1 ! tensor_converter ! "
+      "valve name=valvex ! input-selector name=is01 ! tensor_sink name=sinkx");
 
   status = ml_pipeline_construct (pipeline, nullptr, nullptr, &handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_pipeline_element_get_handle (handle, "filter_h", &filter_h);
+  status = ml_pipeline_element_get_handle (handle, "vsrc", &vsrc_h);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_pipeline_element_set_property_int64 (vsrc_h, "timestamp-offset", 1234567891234LL);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
   /* Test Code */
-  status = ml_pipeline_element_get_property_string (filter_h, "framework", &ret_prop);
+  status = ml_pipeline_element_get_property_int64 (
+      vsrc_h, "timestamp-offset", &ret_timestame_offset);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_TRUE (g_str_equal (ret_prop, "tensorflow-lite"));
-  g_free (ret_prop);
+  EXPECT_TRUE (ret_timestame_offset == 1234567891234LL);
 
-#ifdef ENABLE_NNFW_RUNTIME
-  status = ml_pipeline_element_set_property_string (filter_h, "framework", "nnfw");
+  status = ml_pipeline_element_set_property_int64 (vsrc_h, "timestamp-offset", 10LL);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  /* Test Code */
-  status = ml_pipeline_element_get_property_string (filter_h, "framework", &ret_prop);
+  status = ml_pipeline_element_get_property_int64 (
+      vsrc_h, "timestamp-offset", &ret_timestame_offset);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_TRUE (g_str_equal (ret_prop, "nnfw"));
-  g_free (ret_prop);
-#endif
+  EXPECT_TRUE (ret_timestame_offset == 10LL);
 
-  status = ml_pipeline_element_release_handle (filter_h);
+  status = ml_pipeline_element_release_handle (vsrc_h);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
   status = ml_pipeline_destroy (handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
   g_free (pipeline);
-  g_free (test_model);
 }
 
 /**
  * @brief Test case of Element Property Control.
- * @detail Run the `ml_pipeline_element_get_property_string()` API and check its results.
+ * @detail Run the `ml_pipeline_element_get_property_int64()` API and check its results.
  */
-TEST (nnstreamer_capi_element, get_property_string_02_n)
+TEST (nnstreamer_capi_element, get_property_int64_02_n)
 {
   int status;
-  gchar *ret_prop;
+  int64_t ret_timestame_offset;
 
   /* Test Code */
-  status = ml_pipeline_element_get_property_string (nullptr, "framework", &ret_prop);
+  status = ml_pipeline_element_get_property_int64 (
+      nullptr, "timestamp-offset", &ret_timestame_offset);
   EXPECT_NE (status, ML_ERROR_NONE);
 }
 
 /**
- * @brief Test case of Element Property Control.
- * @detail Run the `ml_pipeline_element_get_property_string()` API and check its results.
- */
-TEST (nnstreamer_capi_element, get_property_string_03_n)
-{
-  ml_pipeline_h handle = nullptr;
-  ml_pipeline_element_h filter_h = nullptr;
-  gchar *pipeline, *test_model;
-  gchar *ret_prop;
-  int status;
-  const gchar *root_path = g_getenv ("NNSTREAMER_SOURCE_ROOT_PATH");
-
-  /* Skip this test if enable-tensorflow-lite is false */
-  if (!is_enabled_tensorflow_lite)
-    return;
-
-  /* supposed to run test in build directory */
-  if (root_path == NULL)
-    root_path = "..";
-
-  /* start pipeline test with valid model file */
-  test_model = g_build_filename (
-      root_path, "tests", "test_models", "models", "add.tflite", NULL);
-  EXPECT_TRUE (g_file_test (test_model, G_FILE_TEST_EXISTS));
+ * @brief Test case of Element Property Control.
+ * @detail Run the `ml_pipeline_element_get_property_int64()` API and check its results.
+ */
+TEST (nnstreamer_capi_element, get_property_int64_03_n)
+{
+  ml_pipeline_h handle = nullptr;
+  ml_pipeline_element_h vsrc_h = nullptr;
+  int status;
+  int64_t ret_timestame_offset;
+  gchar *pipeline;
 
-  pipeline = g_strdup_printf (
-      "appsrc name=appsrc ! "
-      "other/tensor,dimension=(string)1:1:1:1,type=(string)float32,framerate=(fraction)0/1 ! "
-      "tensor_filter name=filter_h framework=tensorflow-lite model=%s ! tensor_sink name=tensor_sink",
-      test_model);
+  pipeline = g_strdup (
+      "videotestsrc name=vsrc is-live=true ! videoconvert ! videoscale name=vscale ! "
+      "video/x-raw,format=RGBx,width=224,height=224,framerate=60/1 ! tensor_converter ! "
+      "valve name=valvex ! input-selector name=is01 ! tensor_sink name=sinkx");
 
   status = ml_pipeline_construct (pipeline, nullptr, nullptr, &handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_pipeline_element_get_handle (handle, "filter_h", &filter_h);
+  status = ml_pipeline_element_get_handle (handle, "vsrc", &vsrc_h);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_pipeline_element_set_property_int64 (vsrc_h, "timestamp-offset", 1234567891234LL);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
   /* Test Code */
-  status = ml_pipeline_element_get_property_string (filter_h, "WRONG_NAME", &ret_prop);
+  status = ml_pipeline_element_get_property_int64 (vsrc_h, "WRONG_NAME", &ret_timestame_offset);
   EXPECT_NE (status, ML_ERROR_NONE);
 
-  status = ml_pipeline_element_release_handle (filter_h);
+  status = ml_pipeline_element_release_handle (vsrc_h);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
   status = ml_pipeline_destroy (handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
   g_free (pipeline);
-  g_free (test_model);
 }
 
 /**
  * @brief Test case of Element Property Control.
- * @detail Run the `ml_pipeline_element_get_property_string()` API and check its results.
+ * @detail Run the `ml_pipeline_element_get_property_int64()` API and check its results.
  */
-TEST (nnstreamer_capi_element, get_property_string_04_n)
+TEST (nnstreamer_capi_element, get_property_int64_04_n)
 {
   ml_pipeline_h handle = nullptr;
-  ml_pipeline_element_h filter_h = nullptr;
-  gchar *pipeline, *test_model;
+  ml_pipeline_element_h vsrc_h = nullptr;
   int status;
-  const gchar *root_path = g_getenv ("NNSTREAMER_SOURCE_ROOT_PATH");
-
-  /* Skip this test if enable-tensorflow-lite is false */
-  if (!is_enabled_tensorflow_lite)
-    return;
-
-  /* supposed to run test in build directory */
-  if (root_path == NULL)
-    root_path = "..";
-
-  /* start pipeline test with valid model file */
-  test_model = g_build_filename (
-      root_path, "tests", "test_models", "models", "add.tflite", NULL);
-  EXPECT_TRUE (g_file_test (test_model, G_FILE_TEST_EXISTS));
+  int64_t wrong_type;
+  gchar *pipeline;
 
-  pipeline = g_strdup_printf (
-      "appsrc name=appsrc ! "
-      "other/tensor,dimension=(string)1:1:1:1,type=(string)float32,framerate=(fraction)0/1 ! "
-      "tensor_filter name=filter_h framework=tensorflow-lite model=%s ! tensor_sink name=tensor_sink",
-      test_model);
+  pipeline = g_strdup (
+      "videotestsrc name=vsrc is-live=true ! videoconvert ! videoscale name=vscale ! "
+      "video/x-raw,format=RGBx,width=224,height=224,framerate=60/1 ! tensor_converter ! "
+      "valve name=valvex ! input-selector name=is01 ! tensor_sink name=sinkx");
 
   status = ml_pipeline_construct (pipeline, nullptr, nullptr, &handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_pipeline_element_get_handle (handle, "filter_h", &filter_h);
+  status = ml_pipeline_element_get_handle (handle, "vsrc", &vsrc_h);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_pipeline_element_set_property_uint32 (vsrc_h, "foreground-color", 123456U);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
   /* Test Code */
-  status = ml_pipeline_element_get_property_string (filter_h, "framework", nullptr);
+  status = ml_pipeline_element_get_property_int64 (vsrc_h, "foreground-color", &wrong_type);
   EXPECT_NE (status, ML_ERROR_NONE);
 
-  status = ml_pipeline_element_release_handle (filter_h);
+  status = ml_pipeline_element_release_handle (vsrc_h);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
   status = ml_pipeline_destroy (handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
   g_free (pipeline);
-  g_free (test_model);
 }
 
 /**
  * @brief Test case of Element Property Control.
- * @detail Run the `ml_pipeline_element_get_property_string()` API and check its results.
+ * @detail Run the `ml_pipeline_element_get_property_int64()` API and check its results.
  */
-TEST (nnstreamer_capi_element, get_property_string_05_n)
+TEST (nnstreamer_capi_element, get_property_int64_05_n)
 {
   ml_pipeline_h handle = nullptr;
-  ml_pipeline_element_h selector_h = nullptr;
-  gchar *pipeline;
-  gchar *ret_wrong_type;
+  ml_pipeline_element_h vsrc_h = nullptr;
   int status;
+  gchar *pipeline;
 
   pipeline = g_strdup (
       "videotestsrc name=vsrc is-live=true ! videoconvert ! videoscale name=vscale ! "
@@ -7680,17 +11636,17 @@ TEST (nnstreamer_capi_element, get_property_string_05_n)
   status = ml_pipeline_construct (pipeline, nullptr, nullptr, &handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_pipeline_element_get_handle (handle, "is01", &selector_h);
+  status = ml_pipeline_element_get_handle (handle, "vsrc", &vsrc_h);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_pipeline_element_set_property_bool (selector_h, "sync-streams", FALSE);
+  status = ml_pipeline_element_set_property_int64 (vsrc_h, "timestamp-offset", 1234567891234LL);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
   /* Test Code */
-  status = ml_pipeline_element_get_property_string (selector_h, "sync-streams", &ret_wrong_type);
+  status = ml_pipeline_element_get_property_int64 (vsrc_h, "timestamp-offset", nullptr);
   EXPECT_NE (status, ML_ERROR_NONE);
 
-  status = ml_pipeline_element_release_handle (selector_h);
+  status = ml_pipeline_element_release_handle (vsrc_h);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
   status = ml_pipeline_destroy (handle);
@@ -7701,9 +11657,9 @@ TEST (nnstreamer_capi_element, get_property_string_05_n)
 
 /**
  * @brief Test case of Element Property Control.
- * @detail Run the `ml_pipeline_element_set_property_int32()` API and check its results.
+ * @detail Run the `ml_pipeline_element_set_property_uint32()` API and check its results.
  */
-TEST (nnstreamer_capi_element, set_property_int32_01_p)
+TEST (nnstreamer_capi_element, set_property_uint32_01_p)
 {
   ml_pipeline_h handle = nullptr;
   ml_pipeline_element_h vsrc_h = nullptr;
@@ -7722,10 +11678,10 @@ TEST (nnstreamer_capi_element, set_property_int32_01_p)
   EXPECT_EQ (status, ML_ERROR_NONE);
 
   /* Test Code */
-  status = ml_pipeline_element_set_property_int32 (vsrc_h, "kx", 10);
+  status = ml_pipeline_element_set_property_uint32 (vsrc_h, "foreground-color", 123456U);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_pipeline_element_set_property_int32 (vsrc_h, "kx", -1234);
+  status = ml_pipeline_element_set_property_uint32 (vsrc_h, "foreground-color", 4294967295U);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
   status = ml_pipeline_element_release_handle (vsrc_h);
@@ -7739,22 +11695,22 @@ TEST (nnstreamer_capi_element, set_property_int32_01_p)
 
 /**
  * @brief Test case of Element Property Control.
- * @detail Run the `ml_pipeline_element_set_property_int32()` API and check its results.
+ * @detail Run the `ml_pipeline_element_set_property_uint32()` API and check its results.
  */
-TEST (nnstreamer_capi_element, set_property_int32_02_n)
+TEST (nnstreamer_capi_element, set_property_uint32_02_n)
 {
   int status;
 
   /* Test Code */
-  status = ml_pipeline_element_set_property_int32 (nullptr, "kx", 10);
+  status = ml_pipeline_element_set_property_uint32 (nullptr, "foreground-color", 123456U);
   EXPECT_NE (status, ML_ERROR_NONE);
 }
 
 /**
  * @brief Test case of Element Property Control.
- * @detail Run the `ml_pipeline_element_set_property_int32()` API and check its results.
+ * @detail Run the `ml_pipeline_element_set_property_uint32()` API and check its results.
  */
-TEST (nnstreamer_capi_element, set_property_int32_03_n)
+TEST (nnstreamer_capi_element, set_property_uint32_03_n)
 {
   ml_pipeline_h handle = nullptr;
   ml_pipeline_element_h vsrc_h = nullptr;
@@ -7773,7 +11729,7 @@ TEST (nnstreamer_capi_element, set_property_int32_03_n)
   EXPECT_EQ (status, ML_ERROR_NONE);
 
   /* Test Code */
-  status = ml_pipeline_element_set_property_int32 (vsrc_h, "WRONG_NAME", 10);
+  status = ml_pipeline_element_set_property_uint32 (vsrc_h, "WRONG_NAME", 123456U);
   EXPECT_NE (status, ML_ERROR_NONE);
 
   status = ml_pipeline_element_release_handle (vsrc_h);
@@ -7787,30 +11743,31 @@ TEST (nnstreamer_capi_element, set_property_int32_03_n)
 
 /**
  * @brief Test case of Element Property Control.
- * @detail Run the `ml_pipeline_element_set_property_int32()` API and check its results.
+ * @detail Run the `ml_pipeline_element_set_property_uint32()` API and check its results.
  */
-TEST (nnstreamer_capi_element, set_property_int32_04_n)
+TEST (nnstreamer_capi_element, set_property_uint32_04_n)
 {
   ml_pipeline_h handle = nullptr;
-  ml_pipeline_element_h demux_h = nullptr;
-  gchar *pipeline;
+  ml_pipeline_element_h vsrc_h = nullptr;
   int status;
+  gchar *pipeline;
 
   pipeline = g_strdup (
-      "videotestsrc ! video/x-raw,format=RGB,width=640,height=480 ! videorate max-rate=1 ! "
-      "tensor_converter ! tensor_mux ! tensor_demux name=demux ! tensor_sink");
+      "videotestsrc name=vsrc is-live=true ! videoconvert ! videoscale name=vscale ! "
+      "video/x-raw,format=RGBx,width=224,height=224,framerate=60/1 ! tensor_converter ! "
+      "valve name=valvex ! input-selector name=is01 ! tensor_sink name=sinkx");
 
   status = ml_pipeline_construct (pipeline, nullptr, nullptr, &handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_pipeline_element_get_handle (handle, "demux", &demux_h);
+  status = ml_pipeline_element_get_handle (handle, "vsrc", &vsrc_h);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
   /* Test Code */
-  status = ml_pipeline_element_set_property_int32 (demux_h, "tensorpick", 1);
+  status = ml_pipeline_element_set_property_uint32 (vsrc_h, "kx", 10U);
   EXPECT_NE (status, ML_ERROR_NONE);
 
-  status = ml_pipeline_element_release_handle (demux_h);
+  status = ml_pipeline_element_release_handle (vsrc_h);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
   status = ml_pipeline_destroy (handle);
@@ -7821,14 +11778,14 @@ TEST (nnstreamer_capi_element, set_property_int32_04_n)
 
 /**
  * @brief Test case of Element Property Control.
- * @detail Run the `ml_pipeline_element_get_property_int32()` API and check its results.
+ * @detail Run the `ml_pipeline_element_get_property_uint32()` API and check its results.
  */
-TEST (nnstreamer_capi_element, get_property_int32_01_p)
+TEST (nnstreamer_capi_element, get_property_uint32_01_p)
 {
   ml_pipeline_h handle = nullptr;
   ml_pipeline_element_h vsrc_h = nullptr;
   int status;
-  int32_t ret_kx;
+  uint32_t ret_foreground_color;
   gchar *pipeline;
 
   pipeline = g_strdup (
@@ -7842,20 +11799,22 @@ TEST (nnstreamer_capi_element, get_property_int32_01_p)
   status = ml_pipeline_element_get_handle (handle, "vsrc", &vsrc_h);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_pipeline_element_set_property_int32 (vsrc_h, "kx", 10);
+  status = ml_pipeline_element_set_property_uint32 (vsrc_h, "foreground-color", 123456U);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
   /* Test Code */
-  status = ml_pipeline_element_get_property_int32 (vsrc_h, "kx", &ret_kx);
+  status = ml_pipeline_element_get_property_uint32 (
+      vsrc_h, "foreground-color", &ret_foreground_color);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_TRUE (ret_kx == 10);
+  EXPECT_TRUE (ret_foreground_color == 123456U);
 
-  status = ml_pipeline_element_set_property_int32 (vsrc_h, "kx", -1234);
+  status = ml_pipeline_element_set_property_uint32 (vsrc_h, "foreground-color", 4294967295U);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_pipeline_element_get_property_int32 (vsrc_h, "kx", &ret_kx);
+  status = ml_pipeline_element_get_property_uint32 (
+      vsrc_h, "foreground-color", &ret_foreground_color);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_TRUE (ret_kx == -1234);
+  EXPECT_TRUE (ret_foreground_color == 4294967295U);
 
   status = ml_pipeline_element_release_handle (vsrc_h);
   EXPECT_EQ (status, ML_ERROR_NONE);
@@ -7868,28 +11827,29 @@ TEST (nnstreamer_capi_element, get_property_int32_01_p)
 
 /**
  * @brief Test case of Element Property Control.
- * @detail Run the `ml_pipeline_element_get_property_int32()` API and check its results.
+ * @detail Run the `ml_pipeline_element_get_property_uint32()` API and check its results.
  */
-TEST (nnstreamer_capi_element, get_property_int32_02_n)
+TEST (nnstreamer_capi_element, get_property_uint32_02_n)
 {
   int status;
-  int32_t ret_kx;
+  uint32_t ret_foreground_color;
 
   /* Test Code */
-  status = ml_pipeline_element_get_property_int32 (nullptr, "kx", &ret_kx);
+  status = ml_pipeline_element_get_property_uint32 (
+      nullptr, "foreground-color", &ret_foreground_color);
   EXPECT_NE (status, ML_ERROR_NONE);
 }
 
 /**
  * @brief Test case of Element Property Control.
- * @detail Run the `ml_pipeline_element_get_property_int32()` API and check its results.
+ * @detail Run the `ml_pipeline_element_get_property_uint32()` API and check its results.
  */
-TEST (nnstreamer_capi_element, get_property_int32_03_n)
+TEST (nnstreamer_capi_element, get_property_uint32_03_n)
 {
   ml_pipeline_h handle = nullptr;
   ml_pipeline_element_h vsrc_h = nullptr;
   int status;
-  int32_t ret_kx;
+  uint32_t ret_foreground_color;
   gchar *pipeline;
 
   pipeline = g_strdup (
@@ -7903,11 +11863,11 @@ TEST (nnstreamer_capi_element, get_property_int32_03_n)
   status = ml_pipeline_element_get_handle (handle, "vsrc", &vsrc_h);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_pipeline_element_set_property_int32 (vsrc_h, "kx", 10);
+  status = ml_pipeline_element_set_property_uint32 (vsrc_h, "foreground-color", 123456U);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
   /* Test Code */
-  status = ml_pipeline_element_get_property_int32 (vsrc_h, "WRONG_NAME", &ret_kx);
+  status = ml_pipeline_element_get_property_uint32 (vsrc_h, "WRONG_NAME", &ret_foreground_color);
   EXPECT_NE (status, ML_ERROR_NONE);
 
   status = ml_pipeline_element_release_handle (vsrc_h);
@@ -7921,13 +11881,14 @@ TEST (nnstreamer_capi_element, get_property_int32_03_n)
 
 /**
  * @brief Test case of Element Property Control.
- * @detail Run the `ml_pipeline_element_get_property_int32()` API and check its results.
+ * @detail Run the `ml_pipeline_element_get_property_uint32()` API and check its results.
  */
-TEST (nnstreamer_capi_element, get_property_int32_04_n)
+TEST (nnstreamer_capi_element, get_property_uint32_04_n)
 {
   ml_pipeline_h handle = nullptr;
   ml_pipeline_element_h vsrc_h = nullptr;
   int status;
+  uint32_t ret_wrong_type;
   gchar *pipeline;
 
   pipeline = g_strdup (
@@ -7945,7 +11906,7 @@ TEST (nnstreamer_capi_element, get_property_int32_04_n)
   EXPECT_EQ (status, ML_ERROR_NONE);
 
   /* Test Code */
-  status = ml_pipeline_element_get_property_int32 (vsrc_h, "kx", nullptr);
+  status = ml_pipeline_element_get_property_uint32 (vsrc_h, "kx", &ret_wrong_type);
   EXPECT_NE (status, ML_ERROR_NONE);
 
   status = ml_pipeline_element_release_handle (vsrc_h);
@@ -7959,14 +11920,13 @@ TEST (nnstreamer_capi_element, get_property_int32_04_n)
 
 /**
  * @brief Test case of Element Property Control.
- * @detail Run the `ml_pipeline_element_get_property_int32()` API and check its results.
+ * @detail Run the `ml_pipeline_element_get_property_uint32()` API and check its results.
  */
-TEST (nnstreamer_capi_element, get_property_int32_05_n)
+TEST (nnstreamer_capi_element, get_property_uint32_05_n)
 {
   ml_pipeline_h handle = nullptr;
-  ml_pipeline_element_h vscale_h = nullptr;
+  ml_pipeline_element_h vsrc_h = nullptr;
   int status;
-  int wrong_type;
   gchar *pipeline;
 
   pipeline = g_strdup (
@@ -7977,17 +11937,17 @@ TEST (nnstreamer_capi_element, get_property_int32_05_n)
   status = ml_pipeline_construct (pipeline, nullptr, nullptr, &handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_pipeline_element_get_handle (handle, "vscale", &vscale_h);
+  status = ml_pipeline_element_get_handle (handle, "vsrc", &vsrc_h);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_pipeline_element_set_property_double (vscale_h, "sharpness", 0.72);
+  status = ml_pipeline_element_set_property_uint32 (vsrc_h, "foreground-color", 123456U);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
   /* Test Code */
-  status = ml_pipeline_element_get_property_int32 (vscale_h, "sharpness", &wrong_type);
+  status = ml_pipeline_element_get_property_uint32 (vsrc_h, "foreground-color", nullptr);
   EXPECT_NE (status, ML_ERROR_NONE);
 
-  status = ml_pipeline_element_release_handle (vscale_h);
+  status = ml_pipeline_element_release_handle (vsrc_h);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
   status = ml_pipeline_destroy (handle);
@@ -7998,34 +11958,31 @@ TEST (nnstreamer_capi_element, get_property_int32_05_n)
 
 /**
  * @brief Test case of Element Property Control.
- * @detail Run the `ml_pipeline_element_set_property_int64()` API and check its results.
+ * @detail Run the `ml_pipeline_element_set_property_uint64()` API and check its results.
  */
-TEST (nnstreamer_capi_element, set_property_int64_01_p)
+TEST (nnstreamer_capi_element, set_property_uint64_01_p)
 {
   ml_pipeline_h handle = nullptr;
-  ml_pipeline_element_h vsrc_h = nullptr;
+  ml_pipeline_element_h udpsrc_h = nullptr;
   int status;
   gchar *pipeline;
 
-  pipeline = g_strdup (
-      "videotestsrc name=vsrc is-live=true ! videoconvert ! videoscale name=vscale ! "
-      "video/x-raw,format=RGBx,width=224,height=224,framerate=60/1 ! tensor_converter ! "
-      "valve name=valvex ! input-selector name=is01 ! tensor_sink name=sinkx");
+  pipeline = g_strdup ("udpsrc name=usrc port=5555 caps=application/x-rtp ! queue ! fakesink");
 
   status = ml_pipeline_construct (pipeline, nullptr, nullptr, &handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_pipeline_element_get_handle (handle, "vsrc", &vsrc_h);
+  status = ml_pipeline_element_get_handle (handle, "usrc", &udpsrc_h);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
   /* Test Code */
-  status = ml_pipeline_element_set_property_int64 (vsrc_h, "timestamp-offset", 1234567891234LL);
+  status = ml_pipeline_element_set_property_uint64 (udpsrc_h, "timeout", 123456789123456789ULL);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_pipeline_element_set_property_int64 (vsrc_h, "timestamp-offset", 10LL);
+  status = ml_pipeline_element_set_property_uint64 (udpsrc_h, "timeout", 987654321ULL);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_pipeline_element_release_handle (vsrc_h);
+  status = ml_pipeline_element_release_handle (udpsrc_h);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
   status = ml_pipeline_destroy (handle);
@@ -8036,44 +11993,41 @@ TEST (nnstreamer_capi_element, set_property_int64_01_p)
 
 /**
  * @brief Test case of Element Property Control.
- * @detail Run the `ml_pipeline_element_set_property_int64()` API and check its results.
+ * @detail Run the `ml_pipeline_element_set_property_uint64()` API and check its results.
  */
-TEST (nnstreamer_capi_element, set_property_int64_02_n)
+TEST (nnstreamer_capi_element, set_property_uint64_02_n)
 {
   int status;
 
   /* Test Code */
-  status = ml_pipeline_element_set_property_int64 (nullptr, "timestamp-offset", 1234567891234LL);
+  status = ml_pipeline_element_set_property_uint64 (nullptr, "timeout", 123456789123456789ULL);
   EXPECT_NE (status, ML_ERROR_NONE);
 }
 
 /**
  * @brief Test case of Element Property Control.
- * @detail Run the `ml_pipeline_element_set_property_int64()` API and check its results.
+ * @detail Run the `ml_pipeline_element_set_property_uint64()` API and check its results.
  */
-TEST (nnstreamer_capi_element, set_property_int64_03_n)
+TEST (nnstreamer_capi_element, set_property_uint64_03_n)
 {
   ml_pipeline_h handle = nullptr;
-  ml_pipeline_element_h vsrc_h = nullptr;
+  ml_pipeline_element_h udpsrc_h = nullptr;
   int status;
   gchar *pipeline;
 
-  pipeline = g_strdup (
-      "videotestsrc name=vsrc is-live=true ! videoconvert ! videoscale name=vscale ! "
-      "video/x-raw,format=RGBx,width=224,height=224,framerate=60/1 ! tensor_converter ! "
-      "valve name=valvex ! input-selector name=is01 ! tensor_sink name=sinkx");
+  pipeline = g_strdup ("udpsrc name=usrc port=5555 caps=application/x-rtp ! queue ! fakesink");
 
   status = ml_pipeline_construct (pipeline, nullptr, nullptr, &handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_pipeline_element_get_handle (handle, "vsrc", &vsrc_h);
+  status = ml_pipeline_element_get_handle (handle, "usrc", &udpsrc_h);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
   /* Test Code */
-  status = ml_pipeline_element_set_property_int64 (vsrc_h, "WRONG_NAME", 1234567891234LL);
+  status = ml_pipeline_element_set_property_uint64 (udpsrc_h, "WRONG_NAME", 123456789123456789ULL);
   EXPECT_NE (status, ML_ERROR_NONE);
 
-  status = ml_pipeline_element_release_handle (vsrc_h);
+  status = ml_pipeline_element_release_handle (udpsrc_h);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
   status = ml_pipeline_destroy (handle);
@@ -8084,9 +12038,9 @@ TEST (nnstreamer_capi_element, set_property_int64_03_n)
 
 /**
  * @brief Test case of Element Property Control.
- * @detail Run the `ml_pipeline_element_set_property_int64()` API and check its results.
+ * @detail Run the `ml_pipeline_element_set_property_uint64()` API and check its results.
  */
-TEST (nnstreamer_capi_element, set_property_int64_04_n)
+TEST (nnstreamer_capi_element, set_property_uint64_04_n)
 {
   ml_pipeline_h handle = nullptr;
   ml_pipeline_element_h vsrc_h = nullptr;
@@ -8105,7 +12059,7 @@ TEST (nnstreamer_capi_element, set_property_int64_04_n)
   EXPECT_EQ (status, ML_ERROR_NONE);
 
   /* Test Code */
-  status = ml_pipeline_element_set_property_int64 (vsrc_h, "foreground-color", 123456);
+  status = ml_pipeline_element_set_property_uint64 (vsrc_h, "timestamp-offset", 12ULL);
   EXPECT_NE (status, ML_ERROR_NONE);
 
   status = ml_pipeline_element_release_handle (vsrc_h);
@@ -8119,45 +12073,40 @@ TEST (nnstreamer_capi_element, set_property_int64_04_n)
 
 /**
  * @brief Test case of Element Property Control.
- * @detail Run the `ml_pipeline_element_get_property_int64()` API and check its results.
+ * @detail Run the `ml_pipeline_element_get_property_uint64()` API and check its results.
  */
-TEST (nnstreamer_capi_element, get_property_int64_01_p)
+TEST (nnstreamer_capi_element, get_property_uint64_01_p)
 {
   ml_pipeline_h handle = nullptr;
-  ml_pipeline_element_h vsrc_h = nullptr;
+  ml_pipeline_element_h udpsrc_h = nullptr;
   int status;
-  int64_t ret_timestame_offset;
+  uint64_t ret_timeout;
   gchar *pipeline;
 
-  pipeline = g_strdup (
-      "videotestsrc name=vsrc is-live=true ! videoconvert ! videoscale name=vscale ! "
-      "video/x-raw,format=RGBx,width=224,height=224,framerate=60/1 ! tensor_converter ! "
-      "valve name=valvex ! input-selector name=is01 ! tensor_sink name=sinkx");
+  pipeline = g_strdup ("udpsrc name=usrc port=5555 caps=application/x-rtp ! queue ! fakesink");
 
   status = ml_pipeline_construct (pipeline, nullptr, nullptr, &handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_pipeline_element_get_handle (handle, "vsrc", &vsrc_h);
+  status = ml_pipeline_element_get_handle (handle, "usrc", &udpsrc_h);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_pipeline_element_set_property_int64 (vsrc_h, "timestamp-offset", 1234567891234LL);
+  status = ml_pipeline_element_set_property_uint64 (udpsrc_h, "timeout", 123456789123456789ULL);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  /* Test Code */
-  status = ml_pipeline_element_get_property_int64 (
-      vsrc_h, "timestamp-offset", &ret_timestame_offset);
+  /* Test Code */
+  status = ml_pipeline_element_get_property_uint64 (udpsrc_h, "timeout", &ret_timeout);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_TRUE (ret_timestame_offset == 1234567891234LL);
+  EXPECT_TRUE (ret_timeout == 123456789123456789ULL);
 
-  status = ml_pipeline_element_set_property_int64 (vsrc_h, "timestamp-offset", 10LL);
+  status = ml_pipeline_element_set_property_uint64 (udpsrc_h, "timeout", 987654321ULL);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_pipeline_element_get_property_int64 (
-      vsrc_h, "timestamp-offset", &ret_timestame_offset);
+  status = ml_pipeline_element_get_property_uint64 (udpsrc_h, "timeout", &ret_timeout);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_TRUE (ret_timestame_offset == 10LL);
+  EXPECT_TRUE (ret_timeout == 987654321ULL);
 
-  status = ml_pipeline_element_release_handle (vsrc_h);
+  status = ml_pipeline_element_release_handle (udpsrc_h);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
   status = ml_pipeline_destroy (handle);
@@ -8168,50 +12117,46 @@ TEST (nnstreamer_capi_element, get_property_int64_01_p)
 
 /**
  * @brief Test case of Element Property Control.
- * @detail Run the `ml_pipeline_element_get_property_int64()` API and check its results.
+ * @detail Run the `ml_pipeline_element_get_property_uint64()` API and check its results.
  */
-TEST (nnstreamer_capi_element, get_property_int64_02_n)
+TEST (nnstreamer_capi_element, get_property_uint64_02_n)
 {
   int status;
-  int64_t ret_timestame_offset;
+  uint64_t ret_timeout;
 
   /* Test Code */
-  status = ml_pipeline_element_get_property_int64 (
-      nullptr, "timestamp-offset", &ret_timestame_offset);
+  status = ml_pipeline_element_get_property_uint64 (nullptr, "timeout", &ret_timeout);
   EXPECT_NE (status, ML_ERROR_NONE);
 }
 
 /**
  * @brief Test case of Element Property Control.
- * @detail Run the `ml_pipeline_element_get_property_int64()` API and check its results.
+ * @detail Run the `ml_pipeline_element_get_property_uint64()` API and check its results.
  */
-TEST (nnstreamer_capi_element, get_property_int64_03_n)
+TEST (nnstreamer_capi_element, get_property_uint64_03_n)
 {
   ml_pipeline_h handle = nullptr;
-  ml_pipeline_element_h vsrc_h = nullptr;
+  ml_pipeline_element_h udpsrc_h = nullptr;
   int status;
-  int64_t ret_timestame_offset;
+  uint64_t ret_timeout;
   gchar *pipeline;
 
-  pipeline = g_strdup (
-      "videotestsrc name=vsrc is-live=true ! videoconvert ! videoscale name=vscale ! "
-      "video/x-raw,format=RGBx,width=224,height=224,framerate=60/1 ! tensor_converter ! "
-      "valve name=valvex ! input-selector name=is01 ! tensor_sink name=sinkx");
+  pipeline = g_strdup ("udpsrc name=usrc port=5555 caps=application/x-rtp ! queue ! fakesink");
 
   status = ml_pipeline_construct (pipeline, nullptr, nullptr, &handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_pipeline_element_get_handle (handle, "vsrc", &vsrc_h);
+  status = ml_pipeline_element_get_handle (handle, "usrc", &udpsrc_h);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_pipeline_element_set_property_int64 (vsrc_h, "timestamp-offset", 1234567891234LL);
+  status = ml_pipeline_element_set_property_uint64 (udpsrc_h, "timeout", 123456789123456789ULL);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
   /* Test Code */
-  status = ml_pipeline_element_get_property_int64 (vsrc_h, "WRONG_NAME", &ret_timestame_offset);
+  status = ml_pipeline_element_get_property_uint64 (udpsrc_h, "WRONG_NAME", &ret_timeout);
   EXPECT_NE (status, ML_ERROR_NONE);
 
-  status = ml_pipeline_element_release_handle (vsrc_h);
+  status = ml_pipeline_element_release_handle (udpsrc_h);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
   status = ml_pipeline_destroy (handle);
@@ -8222,14 +12167,14 @@ TEST (nnstreamer_capi_element, get_property_int64_03_n)
 
 /**
  * @brief Test case of Element Property Control.
- * @detail Run the `ml_pipeline_element_get_property_int64()` API and check its results.
+ * @detail Run the `ml_pipeline_element_get_property_uint64()` API and check its results.
  */
-TEST (nnstreamer_capi_element, get_property_int64_04_n)
+TEST (nnstreamer_capi_element, get_property_uint64_04_n)
 {
   ml_pipeline_h handle = nullptr;
   ml_pipeline_element_h vsrc_h = nullptr;
   int status;
-  int64_t wrong_type;
+  uint64_t wrong_type;
   gchar *pipeline;
 
   pipeline = g_strdup (
@@ -8243,11 +12188,11 @@ TEST (nnstreamer_capi_element, get_property_int64_04_n)
   status = ml_pipeline_element_get_handle (handle, "vsrc", &vsrc_h);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_pipeline_element_set_property_uint32 (vsrc_h, "foreground-color", 123456U);
+  status = ml_pipeline_element_set_property_int64 (vsrc_h, "timestamp-offset", 1234567891234LL);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
   /* Test Code */
-  status = ml_pipeline_element_get_property_int64 (vsrc_h, "foreground-color", &wrong_type);
+  status = ml_pipeline_element_get_property_uint64 (vsrc_h, "timestamp-offset", &wrong_type);
   EXPECT_NE (status, ML_ERROR_NONE);
 
   status = ml_pipeline_element_release_handle (vsrc_h);
@@ -8261,34 +12206,31 @@ TEST (nnstreamer_capi_element, get_property_int64_04_n)
 
 /**
  * @brief Test case of Element Property Control.
- * @detail Run the `ml_pipeline_element_get_property_int64()` API and check its results.
+ * @detail Run the `ml_pipeline_element_get_property_uint64()` API and check its results.
  */
-TEST (nnstreamer_capi_element, get_property_int64_05_n)
+TEST (nnstreamer_capi_element, get_property_uint64_05_n)
 {
   ml_pipeline_h handle = nullptr;
-  ml_pipeline_element_h vsrc_h = nullptr;
+  ml_pipeline_element_h udpsrc_h = nullptr;
   int status;
   gchar *pipeline;
 
-  pipeline = g_strdup (
-      "videotestsrc name=vsrc is-live=true ! videoconvert ! videoscale name=vscale ! "
-      "video/x-raw,format=RGBx,width=224,height=224,framerate=60/1 ! tensor_converter ! "
-      "valve name=valvex ! input-selector name=is01 ! tensor_sink name=sinkx");
+  pipeline = g_strdup ("udpsrc name=usrc port=5555 caps=application/x-rtp ! queue ! fakesink");
 
   status = ml_pipeline_construct (pipeline, nullptr, nullptr, &handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_pipeline_element_get_handle (handle, "vsrc", &vsrc_h);
+  status = ml_pipeline_element_get_handle (handle, "usrc", &udpsrc_h);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_pipeline_element_set_property_int64 (vsrc_h, "timestamp-offset", 1234567891234LL);
+  status = ml_pipeline_element_set_property_uint64 (udpsrc_h, "timeout", 123456789123456789ULL);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
   /* Test Code */
-  status = ml_pipeline_element_get_property_int64 (vsrc_h, "timestamp-offset", nullptr);
+  status = ml_pipeline_element_get_property_uint64 (udpsrc_h, "timeout", nullptr);
   EXPECT_NE (status, ML_ERROR_NONE);
 
-  status = ml_pipeline_element_release_handle (vsrc_h);
+  status = ml_pipeline_element_release_handle (udpsrc_h);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
   status = ml_pipeline_destroy (handle);
@@ -8299,12 +12241,12 @@ TEST (nnstreamer_capi_element, get_property_int64_05_n)
 
 /**
  * @brief Test case of Element Property Control.
- * @detail Run the `ml_pipeline_element_set_property_uint32()` API and check its results.
+ * @detail Run the `ml_pipeline_element_set_property_double()` API and check its results.
  */
-TEST (nnstreamer_capi_element, set_property_uint32_01_p)
+TEST (nnstreamer_capi_element, set_property_double_01_p)
 {
   ml_pipeline_h handle = nullptr;
-  ml_pipeline_element_h vsrc_h = nullptr;
+  ml_pipeline_element_h vscale_h = nullptr;
   int status;
   gchar *pipeline;
 
@@ -8316,17 +12258,17 @@ TEST (nnstreamer_capi_element, set_property_uint32_01_p)
   status = ml_pipeline_construct (pipeline, nullptr, nullptr, &handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_pipeline_element_get_handle (handle, "vsrc", &vsrc_h);
+  status = ml_pipeline_element_get_handle (handle, "vscale", &vscale_h);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
   /* Test Code */
-  status = ml_pipeline_element_set_property_uint32 (vsrc_h, "foreground-color", 123456U);
+  status = ml_pipeline_element_set_property_double (vscale_h, "sharpness", 0.72);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_pipeline_element_set_property_uint32 (vsrc_h, "foreground-color", 4294967295U);
+  status = ml_pipeline_element_set_property_double (vscale_h, "sharpness", 1.43);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_pipeline_element_release_handle (vsrc_h);
+  status = ml_pipeline_element_release_handle (vscale_h);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
   status = ml_pipeline_destroy (handle);
@@ -8337,25 +12279,25 @@ TEST (nnstreamer_capi_element, set_property_uint32_01_p)
 
 /**
  * @brief Test case of Element Property Control.
- * @detail Run the `ml_pipeline_element_set_property_uint32()` API and check its results.
+ * @detail Run the `ml_pipeline_element_set_property_double()` API and check its results.
  */
-TEST (nnstreamer_capi_element, set_property_uint32_02_n)
+TEST (nnstreamer_capi_element, set_property_double_02_n)
 {
   int status;
 
   /* Test Code */
-  status = ml_pipeline_element_set_property_uint32 (nullptr, "foreground-color", 123456U);
+  status = ml_pipeline_element_set_property_double (nullptr, "sharpness", 0.72);
   EXPECT_NE (status, ML_ERROR_NONE);
 }
 
 /**
  * @brief Test case of Element Property Control.
- * @detail Run the `ml_pipeline_element_set_property_uint32()` API and check its results.
+ * @detail Run the `ml_pipeline_element_set_property_double()` API and check its results.
  */
-TEST (nnstreamer_capi_element, set_property_uint32_03_n)
+TEST (nnstreamer_capi_element, set_property_double_03_n)
 {
   ml_pipeline_h handle = nullptr;
-  ml_pipeline_element_h vsrc_h = nullptr;
+  ml_pipeline_element_h vscale_h = nullptr;
   int status;
   gchar *pipeline;
 
@@ -8367,14 +12309,14 @@ TEST (nnstreamer_capi_element, set_property_uint32_03_n)
   status = ml_pipeline_construct (pipeline, nullptr, nullptr, &handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_pipeline_element_get_handle (handle, "vsrc", &vsrc_h);
+  status = ml_pipeline_element_get_handle (handle, "vscale", &vscale_h);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
   /* Test Code */
-  status = ml_pipeline_element_set_property_uint32 (vsrc_h, "WRONG_NAME", 123456U);
+  status = ml_pipeline_element_set_property_double (vscale_h, "WRONG_NAME", 1.43);
   EXPECT_NE (status, ML_ERROR_NONE);
 
-  status = ml_pipeline_element_release_handle (vsrc_h);
+  status = ml_pipeline_element_release_handle (vscale_h);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
   status = ml_pipeline_destroy (handle);
@@ -8385,12 +12327,12 @@ TEST (nnstreamer_capi_element, set_property_uint32_03_n)
 
 /**
  * @brief Test case of Element Property Control.
- * @detail Run the `ml_pipeline_element_set_property_uint32()` API and check its results.
+ * @detail Run the `ml_pipeline_element_set_property_double()` API and check its results.
  */
-TEST (nnstreamer_capi_element, set_property_uint32_04_n)
+TEST (nnstreamer_capi_element, set_property_double_04_n)
 {
   ml_pipeline_h handle = nullptr;
-  ml_pipeline_element_h vsrc_h = nullptr;
+  ml_pipeline_element_h vscale_h = nullptr;
   int status;
   gchar *pipeline;
 
@@ -8402,14 +12344,14 @@ TEST (nnstreamer_capi_element, set_property_uint32_04_n)
   status = ml_pipeline_construct (pipeline, nullptr, nullptr, &handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_pipeline_element_get_handle (handle, "vsrc", &vsrc_h);
+  status = ml_pipeline_element_get_handle (handle, "vscale", &vscale_h);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
   /* Test Code */
-  status = ml_pipeline_element_set_property_uint32 (vsrc_h, "kx", 10U);
+  status = ml_pipeline_element_set_property_double (vscale_h, "method", 3.0);
   EXPECT_NE (status, ML_ERROR_NONE);
 
-  status = ml_pipeline_element_release_handle (vsrc_h);
+  status = ml_pipeline_element_release_handle (vscale_h);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
   status = ml_pipeline_destroy (handle);
@@ -8420,14 +12362,14 @@ TEST (nnstreamer_capi_element, set_property_uint32_04_n)
 
 /**
  * @brief Test case of Element Property Control.
- * @detail Run the `ml_pipeline_element_get_property_uint32()` API and check its results.
+ * @detail Run the `ml_pipeline_element_get_property_double()` API and check its results.
  */
-TEST (nnstreamer_capi_element, get_property_uint32_01_p)
+TEST (nnstreamer_capi_element, get_property_double_01_p)
 {
   ml_pipeline_h handle = nullptr;
-  ml_pipeline_element_h vsrc_h = nullptr;
+  ml_pipeline_element_h vscale_h = nullptr;
   int status;
-  uint32_t ret_foreground_color;
+  double ret_sharpness;
   gchar *pipeline;
 
   pipeline = g_strdup (
@@ -8438,27 +12380,25 @@ TEST (nnstreamer_capi_element, get_property_uint32_01_p)
   status = ml_pipeline_construct (pipeline, nullptr, nullptr, &handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_pipeline_element_get_handle (handle, "vsrc", &vsrc_h);
+  status = ml_pipeline_element_get_handle (handle, "vscale", &vscale_h);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_pipeline_element_set_property_uint32 (vsrc_h, "foreground-color", 123456U);
+  status = ml_pipeline_element_set_property_double (vscale_h, "sharpness", 0.72);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
   /* Test Code */
-  status = ml_pipeline_element_get_property_uint32 (
-      vsrc_h, "foreground-color", &ret_foreground_color);
+  status = ml_pipeline_element_get_property_double (vscale_h, "sharpness", &ret_sharpness);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_TRUE (ret_foreground_color == 123456U);
+  EXPECT_EQ (ret_sharpness, 0.72);
 
-  status = ml_pipeline_element_set_property_uint32 (vsrc_h, "foreground-color", 4294967295U);
+  status = ml_pipeline_element_set_property_double (vscale_h, "sharpness", 1.43);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_pipeline_element_get_property_uint32 (
-      vsrc_h, "foreground-color", &ret_foreground_color);
+  status = ml_pipeline_element_get_property_double (vscale_h, "sharpness", &ret_sharpness);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_TRUE (ret_foreground_color == 4294967295U);
+  EXPECT_EQ (ret_sharpness, 1.43);
 
-  status = ml_pipeline_element_release_handle (vsrc_h);
+  status = ml_pipeline_element_release_handle (vscale_h);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
   status = ml_pipeline_destroy (handle);
@@ -8469,29 +12409,28 @@ TEST (nnstreamer_capi_element, get_property_uint32_01_p)
 
 /**
  * @brief Test case of Element Property Control.
- * @detail Run the `ml_pipeline_element_get_property_uint32()` API and check its results.
+ * @detail Run the `ml_pipeline_element_get_property_double()` API and check its results.
  */
-TEST (nnstreamer_capi_element, get_property_uint32_02_n)
+TEST (nnstreamer_capi_element, get_property_double_02_n)
 {
   int status;
-  uint32_t ret_foreground_color;
+  double ret_sharpness;
 
   /* Test Code */
-  status = ml_pipeline_element_get_property_uint32 (
-      nullptr, "foreground-color", &ret_foreground_color);
+  status = ml_pipeline_element_get_property_double (nullptr, "sharpness", &ret_sharpness);
   EXPECT_NE (status, ML_ERROR_NONE);
 }
 
 /**
  * @brief Test case of Element Property Control.
- * @detail Run the `ml_pipeline_element_get_property_uint32()` API and check its results.
+ * @detail Run the `ml_pipeline_element_get_property_double()` API and check its results.
  */
-TEST (nnstreamer_capi_element, get_property_uint32_03_n)
+TEST (nnstreamer_capi_element, get_property_double_03_n)
 {
   ml_pipeline_h handle = nullptr;
-  ml_pipeline_element_h vsrc_h = nullptr;
+  ml_pipeline_element_h vscale_h = nullptr;
   int status;
-  uint32_t ret_foreground_color;
+  double ret_sharpness;
   gchar *pipeline;
 
   pipeline = g_strdup (
@@ -8502,17 +12441,17 @@ TEST (nnstreamer_capi_element, get_property_uint32_03_n)
   status = ml_pipeline_construct (pipeline, nullptr, nullptr, &handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_pipeline_element_get_handle (handle, "vsrc", &vsrc_h);
+  status = ml_pipeline_element_get_handle (handle, "vscale", &vscale_h);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_pipeline_element_set_property_uint32 (vsrc_h, "foreground-color", 123456U);
+  status = ml_pipeline_element_set_property_double (vscale_h, "sharpness", 0.72);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
   /* Test Code */
-  status = ml_pipeline_element_get_property_uint32 (vsrc_h, "WRONG_NAME", &ret_foreground_color);
+  status = ml_pipeline_element_get_property_double (vscale_h, "WRONG_NAME", &ret_sharpness);
   EXPECT_NE (status, ML_ERROR_NONE);
 
-  status = ml_pipeline_element_release_handle (vsrc_h);
+  status = ml_pipeline_element_release_handle (vscale_h);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
   status = ml_pipeline_destroy (handle);
@@ -8523,14 +12462,14 @@ TEST (nnstreamer_capi_element, get_property_uint32_03_n)
 
 /**
  * @brief Test case of Element Property Control.
- * @detail Run the `ml_pipeline_element_get_property_uint32()` API and check its results.
+ * @detail Run the `ml_pipeline_element_get_property_double()` API and check its results.
  */
-TEST (nnstreamer_capi_element, get_property_uint32_04_n)
+TEST (nnstreamer_capi_element, get_property_double_04_n)
 {
   ml_pipeline_h handle = nullptr;
-  ml_pipeline_element_h vsrc_h = nullptr;
+  ml_pipeline_element_h vscale_h = nullptr;
   int status;
-  uint32_t ret_wrong_type;
+  double wrong_type;
   gchar *pipeline;
 
   pipeline = g_strdup (
@@ -8541,17 +12480,17 @@ TEST (nnstreamer_capi_element, get_property_uint32_04_n)
   status = ml_pipeline_construct (pipeline, nullptr, nullptr, &handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_pipeline_element_get_handle (handle, "vsrc", &vsrc_h);
+  status = ml_pipeline_element_get_handle (handle, "vscale", &vscale_h);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_pipeline_element_set_property_int32 (vsrc_h, "kx", 10);
+  status = ml_pipeline_element_set_property_enum (vscale_h, "method", 3U);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
   /* Test Code */
-  status = ml_pipeline_element_get_property_uint32 (vsrc_h, "kx", &ret_wrong_type);
+  status = ml_pipeline_element_get_property_double (vscale_h, "method", &wrong_type);
   EXPECT_NE (status, ML_ERROR_NONE);
 
-  status = ml_pipeline_element_release_handle (vsrc_h);
+  status = ml_pipeline_element_release_handle (vscale_h);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
   status = ml_pipeline_destroy (handle);
@@ -8562,12 +12501,12 @@ TEST (nnstreamer_capi_element, get_property_uint32_04_n)
 
 /**
  * @brief Test case of Element Property Control.
- * @detail Run the `ml_pipeline_element_get_property_uint32()` API and check its results.
+ * @detail Run the `ml_pipeline_element_get_property_double()` API and check its results.
  */
-TEST (nnstreamer_capi_element, get_property_uint32_05_n)
+TEST (nnstreamer_capi_element, get_property_double_05_n)
 {
   ml_pipeline_h handle = nullptr;
-  ml_pipeline_element_h vsrc_h = nullptr;
+  ml_pipeline_element_h vscale_h = nullptr;
   int status;
   gchar *pipeline;
 
@@ -8579,17 +12518,17 @@ TEST (nnstreamer_capi_element, get_property_uint32_05_n)
   status = ml_pipeline_construct (pipeline, nullptr, nullptr, &handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_pipeline_element_get_handle (handle, "vsrc", &vsrc_h);
+  status = ml_pipeline_element_get_handle (handle, "vscale", &vscale_h);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_pipeline_element_set_property_uint32 (vsrc_h, "foreground-color", 123456U);
+  status = ml_pipeline_element_set_property_double (vscale_h, "sharpness", 0.72);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
   /* Test Code */
-  status = ml_pipeline_element_get_property_uint32 (vsrc_h, "foreground-color", nullptr);
+  status = ml_pipeline_element_get_property_double (vscale_h, "sharpness", nullptr);
   EXPECT_NE (status, ML_ERROR_NONE);
 
-  status = ml_pipeline_element_release_handle (vsrc_h);
+  status = ml_pipeline_element_release_handle (vscale_h);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
   status = ml_pipeline_destroy (handle);
@@ -8600,31 +12539,40 @@ TEST (nnstreamer_capi_element, get_property_uint32_05_n)
 
 /**
  * @brief Test case of Element Property Control.
- * @detail Run the `ml_pipeline_element_set_property_uint64()` API and check its results.
+ * @detail Run the `ml_pipeline_element_set_property_enum()` API and check its results.
  */
-TEST (nnstreamer_capi_element, set_property_uint64_01_p)
+TEST (nnstreamer_capi_element, set_property_enum_01_p)
 {
   ml_pipeline_h handle = nullptr;
-  ml_pipeline_element_h udpsrc_h = nullptr;
+  ml_pipeline_element_h vscale_h = nullptr;
   int status;
   gchar *pipeline;
 
-  pipeline = g_strdup ("udpsrc name=usrc port=5555 caps=application/x-rtp ! queue ! fakesink");
+  pipeline = g_strdup (
+      "videotestsrc name=vsrc is-live=true ! videoconvert ! videoscale name=vscale ! "
+      "video/x-raw,format=RGBx,width=224,height=224,framerate=60/1 ! tensor_converter ! "
+      "valve name=valvex ! input-selector name=is01 ! tensor_sink name=sinkx");
 
   status = ml_pipeline_construct (pipeline, nullptr, nullptr, &handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_pipeline_element_get_handle (handle, "usrc", &udpsrc_h);
+  status = ml_pipeline_element_get_handle (handle, "vscale", &vscale_h);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
   /* Test Code */
-  status = ml_pipeline_element_set_property_uint64 (udpsrc_h, "timeout", 123456789123456789ULL);
+  status = ml_pipeline_element_set_property_enum (vscale_h, "method", 3U);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_pipeline_element_set_property_uint64 (udpsrc_h, "timeout", 987654321ULL);
+  status = ml_pipeline_element_set_property_enum (vscale_h, "method", 5U);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_pipeline_element_release_handle (udpsrc_h);
+  status = ml_pipeline_element_set_property_int32 (vscale_h, "method", 4);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_pipeline_element_set_property_uint32 (vscale_h, "method", 2U);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_pipeline_element_release_handle (vscale_h);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
   status = ml_pipeline_destroy (handle);
@@ -8635,41 +12583,44 @@ TEST (nnstreamer_capi_element, set_property_uint64_01_p)
 
 /**
  * @brief Test case of Element Property Control.
- * @detail Run the `ml_pipeline_element_set_property_uint64()` API and check its results.
+ * @detail Run the `ml_pipeline_element_set_property_enum()` API and check its results.
  */
-TEST (nnstreamer_capi_element, set_property_uint64_02_n)
+TEST (nnstreamer_capi_element, set_property_enum_02_n)
 {
   int status;
 
   /* Test Code */
-  status = ml_pipeline_element_set_property_uint64 (nullptr, "timeout", 123456789123456789ULL);
+  status = ml_pipeline_element_set_property_enum (nullptr, "method", 3U);
   EXPECT_NE (status, ML_ERROR_NONE);
 }
 
 /**
  * @brief Test case of Element Property Control.
- * @detail Run the `ml_pipeline_element_set_property_uint64()` API and check its results.
+ * @detail Run the `ml_pipeline_element_set_property_enum()` API and check its results.
  */
-TEST (nnstreamer_capi_element, set_property_uint64_03_n)
+TEST (nnstreamer_capi_element, set_property_enum_03_n)
 {
   ml_pipeline_h handle = nullptr;
-  ml_pipeline_element_h udpsrc_h = nullptr;
+  ml_pipeline_element_h vscale_h = nullptr;
   int status;
   gchar *pipeline;
 
-  pipeline = g_strdup ("udpsrc name=usrc port=5555 caps=application/x-rtp ! queue ! fakesink");
+  pipeline = g_strdup (
+      "videotestsrc name=vsrc is-live=true ! videoconvert ! videoscale name=vscale ! "
+      "video/x-raw,format=RGBx,width=224,height=224,framerate=60/1 ! tensor_converter ! "
+      "valve name=valvex ! input-selector name=is01 ! tensor_sink name=sinkx");
 
   status = ml_pipeline_construct (pipeline, nullptr, nullptr, &handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_pipeline_element_get_handle (handle, "usrc", &udpsrc_h);
+  status = ml_pipeline_element_get_handle (handle, "vscale", &vscale_h);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
   /* Test Code */
-  status = ml_pipeline_element_set_property_uint64 (udpsrc_h, "WRONG_NAME", 123456789123456789ULL);
+  status = ml_pipeline_element_set_property_enum (vscale_h, "WRONG_NAME", 3U);
   EXPECT_NE (status, ML_ERROR_NONE);
 
-  status = ml_pipeline_element_release_handle (udpsrc_h);
+  status = ml_pipeline_element_release_handle (vscale_h);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
   status = ml_pipeline_destroy (handle);
@@ -8680,31 +12631,28 @@ TEST (nnstreamer_capi_element, set_property_uint64_03_n)
 
 /**
  * @brief Test case of Element Property Control.
- * @detail Run the `ml_pipeline_element_set_property_uint64()` API and check its results.
+ * @detail Run the `ml_pipeline_element_set_property_enum()` API and check its results.
  */
-TEST (nnstreamer_capi_element, set_property_uint64_04_n)
+TEST (nnstreamer_capi_element, set_property_enum_04_n)
 {
   ml_pipeline_h handle = nullptr;
-  ml_pipeline_element_h vsrc_h = nullptr;
+  ml_pipeline_element_h udpsrc_h = nullptr;
   int status;
   gchar *pipeline;
 
-  pipeline = g_strdup (
-      "videotestsrc name=vsrc is-live=true ! videoconvert ! videoscale name=vscale ! "
-      "video/x-raw,format=RGBx,width=224,height=224,framerate=60/1 ! tensor_converter ! "
-      "valve name=valvex ! input-selector name=is01 ! tensor_sink name=sinkx");
+  pipeline = g_strdup ("udpsrc name=usrc port=5555 caps=application/x-rtp ! queue ! fakesink");
 
   status = ml_pipeline_construct (pipeline, nullptr, nullptr, &handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_pipeline_element_get_handle (handle, "vsrc", &vsrc_h);
+  status = ml_pipeline_element_get_handle (handle, "usrc", &udpsrc_h);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
   /* Test Code */
-  status = ml_pipeline_element_set_property_uint64 (vsrc_h, "timestamp-offset", 12ULL);
+  status = ml_pipeline_element_set_property_enum (udpsrc_h, "timeout", 12345);
   EXPECT_NE (status, ML_ERROR_NONE);
 
-  status = ml_pipeline_element_release_handle (vsrc_h);
+  status = ml_pipeline_element_release_handle (udpsrc_h);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
   status = ml_pipeline_destroy (handle);
@@ -8715,40 +12663,58 @@ TEST (nnstreamer_capi_element, set_property_uint64_04_n)
 
 /**
  * @brief Test case of Element Property Control.
- * @detail Run the `ml_pipeline_element_get_property_uint64()` API and check its results.
+ * @detail Run the `ml_pipeline_element_get_property_enum()` API and check its results.
  */
-TEST (nnstreamer_capi_element, get_property_uint64_01_p)
+TEST (nnstreamer_capi_element, get_property_enum_01_p)
 {
   ml_pipeline_h handle = nullptr;
-  ml_pipeline_element_h udpsrc_h = nullptr;
+  ml_pipeline_element_h vscale_h = nullptr;
   int status;
-  uint64_t ret_timeout;
+  uint32_t ret_method;
+  int32_t ret_signed_method;
   gchar *pipeline;
 
-  pipeline = g_strdup ("udpsrc name=usrc port=5555 caps=application/x-rtp ! queue ! fakesink");
+  pipeline = g_strdup (
+      "videotestsrc name=vsrc is-live=true ! videoconvert ! videoscale name=vscale ! "
+      "video/x-raw,format=RGBx,width=224,height=224,framerate=60/1 ! tensor_converter ! "
+      "valve name=valvex ! input-selector name=is01 ! tensor_sink name=sinkx");
 
   status = ml_pipeline_construct (pipeline, nullptr, nullptr, &handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_pipeline_element_get_handle (handle, "usrc", &udpsrc_h);
+  status = ml_pipeline_element_get_handle (handle, "vscale", &vscale_h);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_pipeline_element_set_property_uint64 (udpsrc_h, "timeout", 123456789123456789ULL);
+  status = ml_pipeline_element_set_property_enum (vscale_h, "method", 3U);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
   /* Test Code */
-  status = ml_pipeline_element_get_property_uint64 (udpsrc_h, "timeout", &ret_timeout);
+  status = ml_pipeline_element_get_property_enum (vscale_h, "method", &ret_method);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_TRUE (ret_timeout == 123456789123456789ULL);
+  EXPECT_EQ (ret_method, 3U);
 
-  status = ml_pipeline_element_set_property_uint64 (udpsrc_h, "timeout", 987654321ULL);
+  status = ml_pipeline_element_set_property_enum (vscale_h, "method", 5U);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_pipeline_element_get_property_uint64 (udpsrc_h, "timeout", &ret_timeout);
+  status = ml_pipeline_element_get_property_enum (vscale_h, "method", &ret_method);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_TRUE (ret_timeout == 987654321ULL);
+  EXPECT_EQ (ret_method, 5U);
 
-  status = ml_pipeline_element_release_handle (udpsrc_h);
+  status = ml_pipeline_element_set_property_uint32 (vscale_h, "method", 2U);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_pipeline_element_get_property_uint32 (vscale_h, "method", &ret_method);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (ret_method, 2U);
+
+  status = ml_pipeline_element_set_property_int32 (vscale_h, "method", 4);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_pipeline_element_get_property_int32 (vscale_h, "method", &ret_signed_method);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (ret_signed_method, 4);
+
+  status = ml_pipeline_element_release_handle (vscale_h);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
   status = ml_pipeline_destroy (handle);
@@ -8759,46 +12725,50 @@ TEST (nnstreamer_capi_element, get_property_uint64_01_p)
 
 /**
  * @brief Test case of Element Property Control.
- * @detail Run the `ml_pipeline_element_get_property_uint64()` API and check its results.
+ * @detail Run the `ml_pipeline_element_get_property_enum()` API and check its results.
  */
-TEST (nnstreamer_capi_element, get_property_uint64_02_n)
+TEST (nnstreamer_capi_element, get_property_enum_02_n)
 {
+
   int status;
-  uint64_t ret_timeout;
+  uint32_t ret_method;
 
   /* Test Code */
-  status = ml_pipeline_element_get_property_uint64 (nullptr, "timeout", &ret_timeout);
+  status = ml_pipeline_element_get_property_enum (nullptr, "method", &ret_method);
   EXPECT_NE (status, ML_ERROR_NONE);
 }
 
 /**
  * @brief Test case of Element Property Control.
- * @detail Run the `ml_pipeline_element_get_property_uint64()` API and check its results.
+ * @detail Run the `ml_pipeline_element_get_property_enum()` API and check its results.
  */
-TEST (nnstreamer_capi_element, get_property_uint64_03_n)
+TEST (nnstreamer_capi_element, get_property_enum_03_n)
 {
   ml_pipeline_h handle = nullptr;
-  ml_pipeline_element_h udpsrc_h = nullptr;
+  ml_pipeline_element_h vscale_h = nullptr;
   int status;
-  uint64_t ret_timeout;
+  uint32_t ret_method;
   gchar *pipeline;
 
-  pipeline = g_strdup ("udpsrc name=usrc port=5555 caps=application/x-rtp ! queue ! fakesink");
+  pipeline = g_strdup (
+      "videotestsrc name=vsrc is-live=true ! videoconvert ! videoscale name=vscale ! "
+      "video/x-raw,format=RGBx,width=224,height=224,framerate=60/1 ! tensor_converter ! "
+      "valve name=valvex ! input-selector name=is01 ! tensor_sink name=sinkx");
 
   status = ml_pipeline_construct (pipeline, nullptr, nullptr, &handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_pipeline_element_get_handle (handle, "usrc", &udpsrc_h);
+  status = ml_pipeline_element_get_handle (handle, "vscale", &vscale_h);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_pipeline_element_set_property_uint64 (udpsrc_h, "timeout", 123456789123456789ULL);
+  status = ml_pipeline_element_set_property_enum (vscale_h, "method", 3U);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
   /* Test Code */
-  status = ml_pipeline_element_get_property_uint64 (udpsrc_h, "WRONG_NAME", &ret_timeout);
+  status = ml_pipeline_element_get_property_enum (vscale_h, "WRONG_NAME", &ret_method);
   EXPECT_NE (status, ML_ERROR_NONE);
 
-  status = ml_pipeline_element_release_handle (udpsrc_h);
+  status = ml_pipeline_element_release_handle (vscale_h);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
   status = ml_pipeline_destroy (handle);
@@ -8809,35 +12779,34 @@ TEST (nnstreamer_capi_element, get_property_uint64_03_n)
 
 /**
  * @brief Test case of Element Property Control.
- * @detail Run the `ml_pipeline_element_get_property_uint64()` API and check its results.
+ * @detail Run the `ml_pipeline_element_get_property_enum()` API and check its results.
  */
-TEST (nnstreamer_capi_element, get_property_uint64_04_n)
+TEST (nnstreamer_capi_element, get_property_enum_04_n)
 {
   ml_pipeline_h handle = nullptr;
-  ml_pipeline_element_h vsrc_h = nullptr;
-  int status;
-  uint64_t wrong_type;
+  ml_pipeline_element_h demux_h = nullptr;
   gchar *pipeline;
+  uint32_t ret_wrong_type;
+  int status;
 
   pipeline = g_strdup (
-      "videotestsrc name=vsrc is-live=true ! videoconvert ! videoscale name=vscale ! "
-      "video/x-raw,format=RGBx,width=224,height=224,framerate=60/1 ! tensor_converter ! "
-      "valve name=valvex ! input-selector name=is01 ! tensor_sink name=sinkx");
+      "videotestsrc ! video/x-raw,format=RGB,width=640,height=480 ! videorate max-rate=1 ! "
+      "tensor_converter ! tensor_mux ! tensor_demux name=demux ! tensor_sink");
 
   status = ml_pipeline_construct (pipeline, nullptr, nullptr, &handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_pipeline_element_get_handle (handle, "vsrc", &vsrc_h);
+  status = ml_pipeline_element_get_handle (handle, "demux", &demux_h);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_pipeline_element_set_property_int64 (vsrc_h, "timestamp-offset", 1234567891234LL);
+  status = ml_pipeline_element_set_property_string (demux_h, "tensorpick", "1,2");
   EXPECT_EQ (status, ML_ERROR_NONE);
 
   /* Test Code */
-  status = ml_pipeline_element_get_property_uint64 (vsrc_h, "timestamp-offset", &wrong_type);
+  status = ml_pipeline_element_get_property_enum (demux_h, "tensorpick", &ret_wrong_type);
   EXPECT_NE (status, ML_ERROR_NONE);
 
-  status = ml_pipeline_element_release_handle (vsrc_h);
+  status = ml_pipeline_element_release_handle (demux_h);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
   status = ml_pipeline_destroy (handle);
@@ -8848,31 +12817,34 @@ TEST (nnstreamer_capi_element, get_property_uint64_04_n)
 
 /**
  * @brief Test case of Element Property Control.
- * @detail Run the `ml_pipeline_element_get_property_uint64()` API and check its results.
+ * @detail Run the `ml_pipeline_element_get_property_enum()` API and check its results.
  */
-TEST (nnstreamer_capi_element, get_property_uint64_05_n)
+TEST (nnstreamer_capi_element, get_property_enum_05_n)
 {
   ml_pipeline_h handle = nullptr;
-  ml_pipeline_element_h udpsrc_h = nullptr;
+  ml_pipeline_element_h vscale_h = nullptr;
   int status;
   gchar *pipeline;
 
-  pipeline = g_strdup ("udpsrc name=usrc port=5555 caps=application/x-rtp ! queue ! fakesink");
+  pipeline = g_strdup (
+      "videotestsrc name=vsrc is-live=true ! videoconvert ! videoscale name=vscale ! "
+      "video/x-raw,format=RGBx,width=224,height=224,framerate=60/1 ! tensor_converter ! "
+      "valve name=valvex ! input-selector name=is01 ! tensor_sink name=sinkx");
 
   status = ml_pipeline_construct (pipeline, nullptr, nullptr, &handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_pipeline_element_get_handle (handle, "usrc", &udpsrc_h);
+  status = ml_pipeline_element_get_handle (handle, "vscale", &vscale_h);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_pipeline_element_set_property_uint64 (udpsrc_h, "timeout", 123456789123456789ULL);
+  status = ml_pipeline_element_set_property_enum (vscale_h, "method", 3U);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
   /* Test Code */
-  status = ml_pipeline_element_get_property_uint64 (udpsrc_h, "timeout", nullptr);
+  status = ml_pipeline_element_get_property_enum (vscale_h, "method", nullptr);
   EXPECT_NE (status, ML_ERROR_NONE);
 
-  status = ml_pipeline_element_release_handle (udpsrc_h);
+  status = ml_pipeline_element_release_handle (vscale_h);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
   status = ml_pipeline_destroy (handle);
@@ -8883,1139 +12855,1225 @@ TEST (nnstreamer_capi_element, get_property_uint64_05_n)
 
 /**
  * @brief Test case of Element Property Control.
- * @detail Run the `ml_pipeline_element_set_property_double()` API and check its results.
+ * @detail Construct the pipeline and run it during updating elements' property.
  */
-TEST (nnstreamer_capi_element, set_property_double_01_p)
+TEST (nnstreamer_capi_element, scenario_01_p)
 {
   ml_pipeline_h handle = nullptr;
-  ml_pipeline_element_h vscale_h = nullptr;
-  int status;
+  ml_pipeline_element_h vsrc_h = nullptr;
+  ml_pipeline_state_e state;
   gchar *pipeline;
+  int status;
 
-  pipeline = g_strdup (
-      "videotestsrc name=vsrc is-live=true ! videoconvert ! videoscale name=vscale ! "
-      "video/x-raw,format=RGBx,width=224,height=224,framerate=60/1 ! tensor_converter ! "
-      "valve name=valvex ! input-selector name=is01 ! tensor_sink name=sinkx");
+  pipeline = g_strdup ("videotestsrc name=vsrc is-live=true ! videoconvert ! videoscale ! video/x-raw,format=RGBx,width=224,height=224,framerate=60/1 ! "
+                       "tensor_converter ! tensor_sink name=sinkx");
 
   status = ml_pipeline_construct (pipeline, nullptr, nullptr, &handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_pipeline_element_get_handle (handle, "vscale", &vscale_h);
+  status = ml_pipeline_element_get_handle (handle, "vsrc", &vsrc_h);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  /* Test Code */
-  status = ml_pipeline_element_set_property_double (vscale_h, "sharpness", 0.72);
+  /* Test code: Set the videotestsrc pattern */
+  status = ml_pipeline_element_set_property_enum (vsrc_h, "pattern", 4);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_pipeline_element_set_property_double (vscale_h, "sharpness", 1.43);
+  status = ml_pipeline_start (handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
+  g_usleep (50000);
 
-  status = ml_pipeline_element_release_handle (vscale_h);
+  status = ml_pipeline_get_state (handle, &state);
   EXPECT_EQ (status, ML_ERROR_NONE);
+  wait_for_start (handle, state, status);
+  EXPECT_EQ (state, ML_PIPELINE_STATE_PLAYING);
 
-  status = ml_pipeline_destroy (handle);
+  /* Stop playing */
+  status = ml_pipeline_stop (handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
+  g_usleep (50000);
 
-  g_free (pipeline);
-}
+  /* Test code: Set the new videotestsrc pattern */
+  status = ml_pipeline_element_set_property_enum (vsrc_h, "pattern", 12);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-/**
- * @brief Test case of Element Property Control.
- * @detail Run the `ml_pipeline_element_set_property_double()` API and check its results.
- */
-TEST (nnstreamer_capi_element, set_property_double_02_n)
-{
-  int status;
+  /* Resume playing */
+  status = ml_pipeline_start (handle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  g_usleep (50000);
 
-  /* Test Code */
-  status = ml_pipeline_element_set_property_double (nullptr, "sharpness", 0.72);
-  EXPECT_NE (status, ML_ERROR_NONE);
+  status = ml_pipeline_get_state (handle, &state);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  wait_for_start (handle, state, status);
+  EXPECT_EQ (state, ML_PIPELINE_STATE_PLAYING);
+
+  status = ml_pipeline_stop (handle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  g_usleep (50000);
+
+  status = ml_pipeline_element_release_handle (vsrc_h);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_pipeline_destroy (handle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  g_free (pipeline);
 }
 
 /**
  * @brief Test case of Element Property Control.
- * @detail Run the `ml_pipeline_element_set_property_double()` API and check its results.
+ * @detail Construct the pipeline and run it during updating elements' property.
  */
-TEST (nnstreamer_capi_element, set_property_double_03_n)
+TEST (nnstreamer_capi_element, scenario_02_p)
 {
   ml_pipeline_h handle = nullptr;
-  ml_pipeline_element_h vscale_h = nullptr;
-  int status;
+  ml_pipeline_sink_h sinkhandle = nullptr;
+  ml_pipeline_element_h asink_h = nullptr;
   gchar *pipeline;
+  guint *count_sink;
+  int status;
 
-  pipeline = g_strdup (
-      "videotestsrc name=vsrc is-live=true ! videoconvert ! videoscale name=vscale ! "
-      "video/x-raw,format=RGBx,width=224,height=224,framerate=60/1 ! tensor_converter ! "
-      "valve name=valvex ! input-selector name=is01 ! tensor_sink name=sinkx");
+  pipeline = g_strdup ("videotestsrc is-live=true ! videoconvert ! tensor_converter ! appsink name=sinkx sync=false");
+
+  count_sink = (guint *)g_malloc (sizeof (guint));
+  ASSERT_TRUE (count_sink != NULL);
+  *count_sink = 0;
 
   status = ml_pipeline_construct (pipeline, nullptr, nullptr, &handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_pipeline_element_get_handle (handle, "vscale", &vscale_h);
+  status = ml_pipeline_element_get_handle (handle, "sinkx", &asink_h);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  /* Test Code */
-  status = ml_pipeline_element_set_property_double (vscale_h, "WRONG_NAME", 1.43);
-  EXPECT_NE (status, ML_ERROR_NONE);
+  status = ml_pipeline_sink_register (
+      handle, "sinkx", test_sink_callback_count, count_sink, &sinkhandle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_TRUE (sinkhandle != NULL);
 
-  status = ml_pipeline_element_release_handle (vscale_h);
+  status = ml_pipeline_start (handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_pipeline_destroy (handle);
+  g_usleep (100000);
+
+  status = ml_pipeline_stop (handle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_TRUE (*count_sink > 0U);
+
+  /* Test Code */
+  *count_sink = 0;
+
+  status = ml_pipeline_element_set_property_bool (asink_h, "emit-signals", FALSE);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  g_free (pipeline);
-}
+  status = ml_pipeline_start (handle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-/**
- * @brief Test case of Element Property Control.
- * @detail Run the `ml_pipeline_element_set_property_double()` API and check its results.
- */
-TEST (nnstreamer_capi_element, set_property_double_04_n)
-{
-  ml_pipeline_h handle = nullptr;
-  ml_pipeline_element_h vscale_h = nullptr;
-  int status;
-  gchar *pipeline;
+  g_usleep (100000);
 
-  pipeline = g_strdup (
-      "videotestsrc name=vsrc is-live=true ! videoconvert ! videoscale name=vscale ! "
-      "video/x-raw,format=RGBx,width=224,height=224,framerate=60/1 ! tensor_converter ! "
-      "valve name=valvex ! input-selector name=is01 ! tensor_sink name=sinkx");
+  /** Since `emit-signals` property of appsink is set as FALSE, *count_sink
+   * should be 0 */
+  EXPECT_TRUE (*count_sink == 0U);
 
-  status = ml_pipeline_construct (pipeline, nullptr, nullptr, &handle);
+  status = ml_pipeline_stop (handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_pipeline_element_get_handle (handle, "vscale", &vscale_h);
+  status = ml_pipeline_sink_unregister (sinkhandle);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  /* Test Code */
-  status = ml_pipeline_element_set_property_double (vscale_h, "method", 3.0);
-  EXPECT_NE (status, ML_ERROR_NONE);
-
-  status = ml_pipeline_element_release_handle (vscale_h);
+  status = ml_pipeline_element_release_handle (asink_h);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
   status = ml_pipeline_destroy (handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
   g_free (pipeline);
+  g_free (count_sink);
 }
 
 /**
- * @brief Test case of Element Property Control.
- * @detail Run the `ml_pipeline_element_get_property_double()` API and check its results.
+ * @brief Internal function to construct the pipeline with tensor_filter and get the key of shared model.
  */
-TEST (nnstreamer_capi_element, get_property_double_01_p)
+static gchar *
+test_get_filter_share_key (const gchar *desc)
 {
   ml_pipeline_h handle = nullptr;
-  ml_pipeline_element_h vscale_h = nullptr;
+  ml_pipeline_element_h filter_h = nullptr;
+  gchar *key = NULL;
   int status;
-  double ret_sharpness;
-  gchar *pipeline;
-
-  pipeline = g_strdup (
-      "videotestsrc name=vsrc is-live=true ! videoconvert ! videoscale name=vscale ! "
-      "video/x-raw,format=RGBx,width=224,height=224,framerate=60/1 ! tensor_converter ! "
-      "valve name=valvex ! input-selector name=is01 ! tensor_sink name=sinkx");
-
-  status = ml_pipeline_construct (pipeline, nullptr, nullptr, &handle);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-
-  status = ml_pipeline_element_get_handle (handle, "vscale", &vscale_h);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-
-  status = ml_pipeline_element_set_property_double (vscale_h, "sharpness", 0.72);
-  EXPECT_EQ (status, ML_ERROR_NONE);
 
-  /* Test Code */
-  status = ml_pipeline_element_get_property_double (vscale_h, "sharpness", &ret_sharpness);
+  status = ml_pipeline_construct (desc, nullptr, nullptr, &handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (ret_sharpness, 0.72);
 
-  status = ml_pipeline_element_set_property_double (vscale_h, "sharpness", 1.43);
+  status = ml_pipeline_element_get_handle (handle, "filterx", &filter_h);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_pipeline_element_get_property_double (vscale_h, "sharpness", &ret_sharpness);
+  status = ml_pipeline_element_get_property_string (filter_h, "shared-tensor-filter-key", &key);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (ret_sharpness, 1.43);
 
-  status = ml_pipeline_element_release_handle (vscale_h);
+  status = ml_pipeline_element_release_handle (filter_h);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
   status = ml_pipeline_destroy (handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  g_free (pipeline);
+  return key;
 }
 
 /**
- * @brief Test case of Element Property Control.
- * @detail Run the `ml_pipeline_element_get_property_double()` API and check its results.
+ * @brief Test NNStreamer pipeline to share the model among the pipelines.
  */
-TEST (nnstreamer_capi_element, get_property_double_02_n)
+TEST (nnstreamer_capi_element, model_sharing_01_p)
 {
-  int status;
-  double ret_sharpness;
+  const gchar *root_path = g_getenv ("NNSTREAMER_SOURCE_ROOT_PATH");
+  gchar *test_model, *pipeline, *pipeline2, *pipeline3;
+  gchar *key1, *key2, *key3, *key4;
 
-  /* Test Code */
-  status = ml_pipeline_element_get_property_double (nullptr, "sharpness", &ret_sharpness);
-  EXPECT_NE (status, ML_ERROR_NONE);
+  /* supposed to run test in build directory */
+  if (root_path == NULL)
+    root_path = "..";
+
+  if (!is_enabled_tensorflow_lite)
+    return;
+
+  test_model = g_build_filename (root_path, "tests", "test_models", "models",
+      "mobilenet_v1_1.0_224_quant.tflite", NULL);
+  ASSERT_TRUE (g_file_test (test_model, G_FILE_TEST_EXISTS));
+
+  pipeline = g_strdup_printf ("appsrc name=srcx ! "
+      "other/tensor,dimension=(string)3:224:224:1,type=(string)uint8,framerate=(fraction)0/1 ! "
+      "tensor_filter name=filterx framework=tensorflow-lite model=%s shared-tensor-filter-key=auto ! tensor_sink name=sinkx",
+      test_model);
+  pipeline2 = g_strdup_printf ("appsrc name=srcx ! "
+      "other/tensor,dimension=(string)3:224:224:1,type=(string)uint8,framerate=(fraction)0/1 ! "
+      "tensor_filter name=filterx framework=tensorflow-lite model=%s shared-tensor-filter-key=mykey ! tensor_sink name=sinkx",
+      test_model);
+  pipeline3 = g_strdup_printf ("appsrc name=srcx ! "
+      "other/tensor,dimension=(string)3:224:224:1,type=(string)uint8,framerate=(fraction)0/1 ! "
+      "tensor_filter name=filterx framework=tensorflow-lite model=%s shared-tensor-filter-key=auto "
+      "input=3:224:224:1 inputtype=uint8 ! tensor_sink name=sinkx",
+      test_model);
+
+  key1 = test_get_filter_share_key (pipeline);
+  key2 = test_get_filter_share_key (pipeline);
+  key3 = test_get_filter_share_key (pipeline2);
+  key4 = test_get_filter_share_key (pipeline3);
+
+  /* same framework and model, the filters share the model. */
+  EXPECT_TRUE (key1 != NULL && key1[0] != '\0');
+  EXPECT_STRNE (key1, "auto");
+  EXPECT_STREQ (key1, key2);
+
+  /* the key in the pipeline description is not changed. */
+  EXPECT_STREQ (key3, "mykey");
+
+  /* different input information, the filters do not share the model. */
+  EXPECT_TRUE (key4 != NULL && key4[0] != '\0');
+  EXPECT_STRNE (key1, key4);
+
+  g_free (key1);
+  g_free (key2);
+  g_free (key3);
+  g_free (key4);
+  g_free (pipeline);
+  g_free (pipeline2);
+  g_free (pipeline3);
+  g_free (test_model);
 }
 
 /**
- * @brief Test case of Element Property Control.
- * @detail Run the `ml_pipeline_element_get_property_double()` API and check its results.
+ * @brief Test NNStreamer pipeline to share the model (no shared key).
  */
-TEST (nnstreamer_capi_element, get_property_double_03_n)
+TEST (nnstreamer_capi_element, model_sharing_02_n)
 {
-  ml_pipeline_h handle = nullptr;
-  ml_pipeline_element_h vscale_h = nullptr;
-  int status;
-  double ret_sharpness;
-  gchar *pipeline;
-
-  pipeline = g_strdup (
-      "videotestsrc name=vsrc is-live=true ! videoconvert ! videoscale name=vscale ! "
-      "video/x-raw,format=RGBx,width=224,height=224,framerate=60/1 ! tensor_converter ! "
-      "valve name=valvex ! input-selector name=is01 ! tensor_sink name=sinkx");
-
-  status = ml_pipeline_construct (pipeline, nullptr, nullptr, &handle);
-  EXPECT_EQ (status, ML_ERROR_NONE);
+  const gchar *root_path = g_getenv ("NNSTREAMER_SOURCE_ROOT_PATH");
+  gchar *test_model, *pipeline;
+  gchar *key;
 
-  status = ml_pipeline_element_get_handle (handle, "vscale", &vscale_h);
-  EXPECT_EQ (status, ML_ERROR_NONE);
+  /* supposed to run test in build directory */
+  if (root_path == NULL)
+    root_path = "..";
 
-  status = ml_pipeline_element_set_property_double (vscale_h, "sharpness", 0.72);
-  EXPECT_EQ (status, ML_ERROR_NONE);
+  if (!is_enabled_tensorflow_lite)
+    return;
 
-  /* Test Code */
-  status = ml_pipeline_element_get_property_double (vscale_h, "WRONG_NAME", &ret_sharpness);
-  EXPECT_NE (status, ML_ERROR_NONE);
+  test_model = g_build_filename (root_path, "tests", "test_models", "models",
+      "mobilenet_v1_1.0_224_quant.tflite", NULL);
+  ASSERT_TRUE (g_file_test (test_model, G_FILE_TEST_EXISTS));
 
-  status = ml_pipeline_element_release_handle (vscale_h);
-  EXPECT_EQ (status, ML_ERROR_NONE);
+  pipeline = g_strdup_printf ("appsrc name=srcx ! "
+      "other/tensor,dimension=(string)3:224:224:1,type=(string)uint8,framerate=(fraction)0/1 ! "
+      "tensor_filter name=filterx framework=tensorflow-lite model=%s ! tensor_sink name=sinkx",
+      test_model);
 
-  status = ml_pipeline_destroy (handle);
-  EXPECT_EQ (status, ML_ERROR_NONE);
+  /* the key is not set if the shared key is not given. */
+  key = test_get_filter_share_key (pipeline);
+  EXPECT_TRUE (key == NULL || key[0] == '\0');
 
+  g_free (key);
   g_free (pipeline);
+  g_free (test_model);
 }
 
 /**
- * @brief Test case of Element Property Control.
- * @detail Run the `ml_pipeline_element_get_property_double()` API and check its results.
+ * @brief Test NNStreamer pipeline to update the key of shared model with the property setter.
  */
-TEST (nnstreamer_capi_element, get_property_double_04_n)
+TEST (nnstreamer_capi_element, model_sharing_03_p)
 {
-  ml_pipeline_h handle = nullptr;
-  ml_pipeline_element_h vscale_h = nullptr;
+  const gchar *root_path = g_getenv ("NNSTREAMER_SOURCE_ROOT_PATH");
+  gchar *test_model, *pipeline;
+  gchar *key1 = NULL, *key2 = NULL, *key3 = NULL;
+  ml_pipeline_h handle;
+  ml_pipeline_element_h filter_h;
   int status;
-  double wrong_type;
-  gchar *pipeline;
 
-  pipeline = g_strdup (
-      "videotestsrc name=vsrc is-live=true ! videoconvert ! videoscale name=vscale ! "
-      "video/x-raw,format=RGBx,width=224,height=224,framerate=60/1 ! tensor_converter ! "
-      "valve name=valvex ! input-selector name=is01 ! tensor_sink name=sinkx");
+  /* supposed to run test in build directory */
+  if (root_path == NULL)
+    root_path = "..";
 
-  status = ml_pipeline_construct (pipeline, nullptr, nullptr, &handle);
+  if (!is_enabled_tensorflow_lite)
+    return;
+
+  test_model = g_build_filename (root_path, "tests", "test_models", "models",
+      "mobilenet_v1_1.0_224_quant.tflite", NULL);
+  ASSERT_TRUE (g_file_test (test_model, G_FILE_TEST_EXISTS));
+
+  pipeline = g_strdup_printf ("appsrc name=srcx ! "
+      "other/tensor,dimension=(string)3:224:224:1,type=(string)uint8,framerate=(fraction)0/1 ! "
+      "tensor_filter name=filterx framework=tensorflow-lite model=%s shared-tensor-filter-key=auto ! tensor_sink name=sinkx",
+      test_model);
+
+  status = ml_pipeline_construct (pipeline, NULL, NULL, &handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_pipeline_element_get_handle (handle, "vscale", &vscale_h);
+  status = ml_pipeline_element_get_handle (handle, "filterx", &filter_h);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_pipeline_element_set_property_enum (vscale_h, "method", 3U);
+  status = ml_pipeline_element_get_property_string (filter_h, "shared-tensor-filter-key", &key1);
   EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_TRUE (key1 != NULL && key1[0] != '\0');
+  EXPECT_STRNE (key1, "auto");
 
-  /* Test Code */
-  status = ml_pipeline_element_get_property_double (vscale_h, "method", &wrong_type);
-  EXPECT_NE (status, ML_ERROR_NONE);
+  /* the key given by the application is not changed with the property */
+  status = ml_pipeline_element_set_property_string (filter_h, "shared-tensor-filter-key", "mykey");
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_pipeline_element_release_handle (vscale_h);
+  status = ml_pipeline_element_set_property_string (filter_h, "custom", "NumThreads:1");
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_pipeline_element_get_property_string (filter_h, "shared-tensor-filter-key", &key2);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_STREQ (key2, "mykey");
+
+  /* the key is generated again from the properties */
+  status = ml_pipeline_element_set_property_string (filter_h, "shared-tensor-filter-key", "auto");
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_pipeline_element_get_property_string (filter_h, "shared-tensor-filter-key", &key3);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_TRUE (key3 != NULL && key3[0] != '\0');
+  EXPECT_STRNE (key3, "auto");
+
+  status = ml_pipeline_element_release_handle (filter_h);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
   status = ml_pipeline_destroy (handle);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
+  g_free (key1);
+  g_free (key2);
+  g_free (key3);
   g_free (pipeline);
+  g_free (test_model);
 }
 
 /**
- * @brief Test case of Element Property Control.
- * @detail Run the `ml_pipeline_element_get_property_double()` API and check its results.
+ * @brief Test for internal function '_ml_tensors_info_copy_from_gst'.
  */
-TEST (nnstreamer_capi_element, get_property_double_05_n)
+TEST (nnstreamer_capi_internal, copy_from_gst)
 {
-  ml_pipeline_h handle = nullptr;
-  ml_pipeline_element_h vscale_h = nullptr;
   int status;
-  gchar *pipeline;
+  ml_tensors_info_h ml_info;
+  ml_tensor_type_e type;
+  ml_tensor_dimension dim;
+  char *name;
+  unsigned int count;
+  GstTensorsInfo gst_info;
+  guint i;
 
-  pipeline = g_strdup (
-      "videotestsrc name=vsrc is-live=true ! videoconvert ! videoscale name=vscale ! "
-      "video/x-raw,format=RGBx,width=224,height=224,framerate=60/1 ! tensor_converter ! "
-      "valve name=valvex ! input-selector name=is01 ! tensor_sink name=sinkx");
+  gst_tensors_info_init (&gst_info);
+  gst_info.num_tensors = 2;
+  for (i = 0; i < NNS_TENSOR_RANK_LIMIT; i++) {
+    gst_info.info[0].dimension[i] = i + 1;
+    gst_info.info[1].dimension[i] = i + 1;
+  }
 
-  status = ml_pipeline_construct (pipeline, nullptr, nullptr, &handle);
+  status = ml_tensors_info_create (&ml_info);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_pipeline_element_get_handle (handle, "vscale", &vscale_h);
+  _ml_tensors_info_copy_from_gst ((ml_tensors_info_s *)ml_info, &gst_info);
+  status = ml_tensors_info_get_count (ml_info, &count);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (count, 2U);
+  status = ml_tensors_info_get_tensor_dimension (ml_info, 0, dim);
   EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (dim[0], 1U);
+  EXPECT_EQ (dim[1], 2U);
+  EXPECT_EQ (dim[2], 3U);
+  EXPECT_EQ (dim[3], 4U);
 
-  status = ml_pipeline_element_set_property_double (vscale_h, "sharpness", 0.72);
+  gst_info.info[0].type = _NNS_INT32;
+  gst_info.info[1].type = _NNS_UINT32;
+  _ml_tensors_info_copy_from_gst ((ml_tensors_info_s *)ml_info, &gst_info);
+  status = ml_tensors_info_get_tensor_type (ml_info, 0, &type);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (type, ML_TENSOR_TYPE_INT32);
+  status = ml_tensors_info_get_tensor_type (ml_info, 1, &type);
   EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (type, ML_TENSOR_TYPE_UINT32);
 
-  /* Test Code */
-  status = ml_pipeline_element_get_property_double (vscale_h, "sharpness", nullptr);
-  EXPECT_NE (status, ML_ERROR_NONE);
+  gst_info.info[0].type = _NNS_INT16;
+  gst_info.info[1].type = _NNS_UINT16;
+  _ml_tensors_info_copy_from_gst ((ml_tensors_info_s *)ml_info, &gst_info);
+  status = ml_tensors_info_get_tensor_type (ml_info, 0, &type);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (type, ML_TENSOR_TYPE_INT16);
+  status = ml_tensors_info_get_tensor_type (ml_info, 1, &type);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (type, ML_TENSOR_TYPE_UINT16);
 
-  status = ml_pipeline_element_release_handle (vscale_h);
+  gst_info.info[0].type = _NNS_INT8;
+  gst_info.info[1].type = _NNS_UINT8;
+  _ml_tensors_info_copy_from_gst ((ml_tensors_info_s *)ml_info, &gst_info);
+  status = ml_tensors_info_get_tensor_type (ml_info, 0, &type);
   EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (type, ML_TENSOR_TYPE_INT8);
+  status = ml_tensors_info_get_tensor_type (ml_info, 1, &type);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (type, ML_TENSOR_TYPE_UINT8);
 
-  status = ml_pipeline_destroy (handle);
+  gst_info.info[0].type = _NNS_INT64;
+  gst_info.info[1].type = _NNS_UINT64;
+  _ml_tensors_info_copy_from_gst ((ml_tensors_info_s *)ml_info, &gst_info);
+  status = ml_tensors_info_get_tensor_type (ml_info, 0, &type);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (type, ML_TENSOR_TYPE_INT64);
+  status = ml_tensors_info_get_tensor_type (ml_info, 1, &type);
   EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (type, ML_TENSOR_TYPE_UINT64);
 
-  g_free (pipeline);
+  gst_info.info[0].type = _NNS_FLOAT64;
+  gst_info.info[1].type = _NNS_FLOAT32;
+  _ml_tensors_info_copy_from_gst ((ml_tensors_info_s *)ml_info, &gst_info);
+  status = ml_tensors_info_get_tensor_type (ml_info, 0, &type);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (type, ML_TENSOR_TYPE_FLOAT64);
+  status = ml_tensors_info_get_tensor_type (ml_info, 1, &type);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (type, ML_TENSOR_TYPE_FLOAT32);
+
+  gst_info.info[0].name = g_strdup ("tn1");
+  gst_info.info[1].name = g_strdup ("tn2");
+  _ml_tensors_info_copy_from_gst ((ml_tensors_info_s *)ml_info, &gst_info);
+  status = ml_tensors_info_get_tensor_name (ml_info, 0, &name);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_STREQ (name, "tn1");
+  g_free (name);
+  status = ml_tensors_info_get_tensor_name (ml_info, 1, &name);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_STREQ (name, "tn2");
+  g_free (name);
+
+  status = ml_tensors_info_destroy (ml_info);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  gst_tensors_info_free (&gst_info);
 }
 
 /**
- * @brief Test case of Element Property Control.
- * @detail Run the `ml_pipeline_element_set_property_enum()` API and check its results.
+ * @brief Test for internal function '_ml_tensors_info_copy_from_ml'.
  */
-TEST (nnstreamer_capi_element, set_property_enum_01_p)
+TEST (nnstreamer_capi_internal, copy_from_ml)
 {
-  ml_pipeline_h handle = nullptr;
-  ml_pipeline_element_h vscale_h = nullptr;
   int status;
-  gchar *pipeline;
+  ml_tensors_info_h ml_info;
+  ml_tensor_dimension dim = { 1, 2, 3, 4 };
+  GstTensorsInfo gst_info;
 
-  pipeline = g_strdup (
-      "videotestsrc name=vsrc is-live=true ! videoconvert ! videoscale name=vscale ! "
-      "video/x-raw,format=RGBx,width=224,height=224,framerate=60/1 ! tensor_converter ! "
-      "valve name=valvex ! input-selector name=is01 ! tensor_sink name=sinkx");
+  gst_tensors_info_init (&gst_info);
 
-  status = ml_pipeline_construct (pipeline, nullptr, nullptr, &handle);
+  status = ml_tensors_info_create (&ml_info);
   EXPECT_EQ (status, ML_ERROR_NONE);
-
-  status = ml_pipeline_element_get_handle (handle, "vscale", &vscale_h);
+  status = ml_tensors_info_set_count (ml_info, 2);
   EXPECT_EQ (status, ML_ERROR_NONE);
-
-  /* Test Code */
-  status = ml_pipeline_element_set_property_enum (vscale_h, "method", 3U);
+  status = ml_tensors_info_set_tensor_dimension (ml_info, 0, dim);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_info_set_tensor_dimension (ml_info, 1, dim);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_pipeline_element_set_property_enum (vscale_h, "method", 5U);
+  _ml_tensors_info_copy_from_ml (&gst_info, (ml_tensors_info_s *)ml_info);
+  EXPECT_EQ (gst_info.num_tensors, 2U);
+  EXPECT_EQ (gst_info.info[0].dimension[0], 1U);
+  EXPECT_EQ (gst_info.info[0].dimension[1], 2U);
+  EXPECT_EQ (gst_info.info[0].dimension[2], 3U);
+  EXPECT_EQ (gst_info.info[0].dimension[3], 4U);
+
+  status = ml_tensors_info_set_tensor_type (ml_info, 0, ML_TENSOR_TYPE_INT32);
   EXPECT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_info_set_tensor_type (ml_info, 1, ML_TENSOR_TYPE_UINT32);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  _ml_tensors_info_copy_from_ml (&gst_info, (ml_tensors_info_s *)ml_info);
+  EXPECT_EQ (gst_info.info[0].type, _NNS_INT32);
+  EXPECT_EQ (gst_info.info[1].type, _NNS_UINT32);
 
-  status = ml_pipeline_element_set_property_int32 (vscale_h, "method", 4);
+  status = ml_tensors_info_set_tensor_type (ml_info, 0, ML_TENSOR_TYPE_INT16);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_info_set_tensor_type (ml_info, 1, ML_TENSOR_TYPE_UINT16);
   EXPECT_EQ (status, ML_ERROR_NONE);
+  _ml_tensors_info_copy_from_ml (&gst_info, (ml_tensors_info_s *)ml_info);
+  EXPECT_EQ (gst_info.info[0].type, _NNS_INT16);
+  EXPECT_EQ (gst_info.info[1].type, _NNS_UINT16);
 
-  status = ml_pipeline_element_set_property_uint32 (vscale_h, "method", 2U);
+  status = ml_tensors_info_set_tensor_type (ml_info, 0, ML_TENSOR_TYPE_INT8);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_info_set_tensor_type (ml_info, 1, ML_TENSOR_TYPE_UINT8);
   EXPECT_EQ (status, ML_ERROR_NONE);
+  _ml_tensors_info_copy_from_ml (&gst_info, (ml_tensors_info_s *)ml_info);
+  EXPECT_EQ (gst_info.info[0].type, _NNS_INT8);
+  EXPECT_EQ (gst_info.info[1].type, _NNS_UINT8);
 
-  status = ml_pipeline_element_release_handle (vscale_h);
+  status = ml_tensors_info_set_tensor_type (ml_info, 0, ML_TENSOR_TYPE_INT64);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_info_set_tensor_type (ml_info, 1, ML_TENSOR_TYPE_UINT64);
   EXPECT_EQ (status, ML_ERROR_NONE);
+  _ml_tensors_info_copy_from_ml (&gst_info, (ml_tensors_info_s *)ml_info);
+  EXPECT_EQ (gst_info.info[0].type, _NNS_INT64);
+  EXPECT_EQ (gst_info.info[1].type, _NNS_UINT64);
 
-  status = ml_pipeline_destroy (handle);
+  status = ml_tensors_info_set_tensor_type (ml_info, 0, ML_TENSOR_TYPE_FLOAT64);
   EXPECT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_info_set_tensor_type (ml_info, 1, ML_TENSOR_TYPE_FLOAT32);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  _ml_tensors_info_copy_from_ml (&gst_info, (ml_tensors_info_s *)ml_info);
+  EXPECT_EQ (gst_info.info[0].type, _NNS_FLOAT64);
+  EXPECT_EQ (gst_info.info[1].type, _NNS_FLOAT32);
 
-  g_free (pipeline);
-}
+  status = ml_tensors_info_set_tensor_name (ml_info, 0, "tn1");
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_info_set_tensor_name (ml_info, 1, "tn2");
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  _ml_tensors_info_copy_from_ml (&gst_info, (ml_tensors_info_s *)ml_info);
+  EXPECT_STREQ (gst_info.info[0].name, "tn1");
+  EXPECT_STREQ (gst_info.info[1].name, "tn2");
 
-/**
- * @brief Test case of Element Property Control.
- * @detail Run the `ml_pipeline_element_set_property_enum()` API and check its results.
- */
-TEST (nnstreamer_capi_element, set_property_enum_02_n)
-{
-  int status;
+  status = ml_tensors_info_destroy (ml_info);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-  /* Test Code */
-  status = ml_pipeline_element_set_property_enum (nullptr, "method", 3U);
-  EXPECT_NE (status, ML_ERROR_NONE);
+  gst_tensors_info_free (&gst_info);
 }
 
+#if (NNS_TENSOR_RANK_LIMIT < ML_TENSOR_RANK_LIMIT_EXTENDED)
 /**
- * @brief Test case of Element Property Control.
- * @detail Run the `ml_pipeline_element_set_property_enum()` API and check its results.
+ * @brief Test for internal function '_ml_tensors_info_copy_from_ml'.
+ * @detail Failure case with the rank NNStreamer cannot represent.
  */
-TEST (nnstreamer_capi_element, set_property_enum_03_n)
+TEST (nnstreamer_capi_internal, copy_from_ml_n)
 {
-  ml_pipeline_h handle = nullptr;
-  ml_pipeline_element_h vscale_h = nullptr;
   int status;
-  gchar *pipeline;
-
-  pipeline = g_strdup (
-      "videotestsrc name=vsrc is-live=true ! videoconvert ! videoscale name=vscale ! "
-      "video/x-raw,format=RGBx,width=224,height=224,framerate=60/1 ! tensor_converter ! "
-      "valve name=valvex ! input-selector name=is01 ! tensor_sink name=sinkx");
+  ml_tensors_info_h ml_info;
+  ml_tensor_dimension dim = { 1, 2, 3, 4 };
+  ml_tensor_info_s *info;
+  GstTensorsInfo gst_info;
 
-  status = ml_pipeline_construct (pipeline, nullptr, nullptr, &handle);
+  status = ml_tensors_info_create (&ml_info);
   EXPECT_EQ (status, ML_ERROR_NONE);
-
-  status = ml_pipeline_element_get_handle (handle, "vscale", &vscale_h);
+  status = ml_tensors_info_set_count (ml_info, 1);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_info_set_tensor_type (ml_info, 0, ML_TENSOR_TYPE_UINT8);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  status = ml_tensors_info_set_tensor_dimension (ml_info, 0, dim);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  /* Test Code */
-  status = ml_pipeline_element_set_property_enum (vscale_h, "WRONG_NAME", 3U);
-  EXPECT_NE (status, ML_ERROR_NONE);
-
-  status = ml_pipeline_element_release_handle (vscale_h);
+  info = _ml_tensors_info_get_nth_info ((ml_tensors_info_s *) ml_info, 0);
+  status = _ml_tensor_info_set_dimension (info, NNS_TENSOR_RANK_LIMIT, 2U);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_pipeline_destroy (handle);
+  status = _ml_tensors_info_copy_from_ml (&gst_info, (ml_tensors_info_s *) ml_info);
+  EXPECT_EQ (status, ML_ERROR_NOT_SUPPORTED);
+  EXPECT_EQ (gst_info.num_tensors, 0U);
+
+  status = ml_tensors_info_destroy (ml_info);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  g_free (pipeline);
+  gst_tensors_info_free (&gst_info);
 }
+#endif
 
 /**
- * @brief Test case of Element Property Control.
- * @detail Run the `ml_pipeline_element_set_property_enum()` API and check its results.
+ * @brief Test for internal function '_ml_validate_model_file'.
+ * @detail Invalid params.
  */
-TEST (nnstreamer_capi_element, set_property_enum_04_n)
+TEST (nnstreamer_capi_internal, validate_model_file_01_n)
 {
-  ml_pipeline_h handle = nullptr;
-  ml_pipeline_element_h udpsrc_h = nullptr;
+  const gchar cf_name[] = "libnnstreamer_customfilter_passthrough_variable" SO_FILE_EXTENSION;
+  gchar *lib_path = NULL;
+  gchar *test_model = NULL;
   int status;
-  gchar *pipeline;
-
-  pipeline = g_strdup ("udpsrc name=usrc port=5555 caps=application/x-rtp ! queue ! fakesink");
+  ml_nnfw_type_e nnfw = ML_NNFW_TYPE_CUSTOM_FILTER;
 
-  status = ml_pipeline_construct (pipeline, nullptr, nullptr, &handle);
-  EXPECT_EQ (status, ML_ERROR_NONE);
+  lib_path = nnsconf_get_custom_value_string ("filter", "customfilters");
+  if (lib_path == NULL) {
+    /* cannot get custom-filter directory */
+    goto skip_test;
+  }
 
-  status = ml_pipeline_element_get_handle (handle, "usrc", &udpsrc_h);
-  EXPECT_EQ (status, ML_ERROR_NONE);
+  test_model = g_build_filename (lib_path, cf_name, NULL);
+  if (!g_file_test (test_model, G_FILE_TEST_EXISTS)) {
+    goto skip_test;
+  }
 
-  /* Test Code */
-  status = ml_pipeline_element_set_property_enum (udpsrc_h, "timeout", 12345);
+  status = _ml_validate_model_file (NULL, 1, &nnfw);
   EXPECT_NE (status, ML_ERROR_NONE);
 
-  status = ml_pipeline_element_release_handle (udpsrc_h);
-  EXPECT_EQ (status, ML_ERROR_NONE);
+  status = _ml_validate_model_file (&test_model, 0, &nnfw);
+  EXPECT_NE (status, ML_ERROR_NONE);
 
-  status = ml_pipeline_destroy (handle);
-  EXPECT_EQ (status, ML_ERROR_NONE);
+  status = _ml_validate_model_file (&test_model, 1, NULL);
+  EXPECT_NE (status, ML_ERROR_NONE);
 
-  g_free (pipeline);
+skip_test:
+  g_free (lib_path);
+  g_free (test_model);
 }
 
 /**
- * @brief Test case of Element Property Control.
- * @detail Run the `ml_pipeline_element_get_property_enum()` API and check its results.
+ * @brief Test for internal function '_ml_validate_model_file'.
+ * @detail Invalid file extension.
  */
-TEST (nnstreamer_capi_element, get_property_enum_01_p)
+TEST (nnstreamer_capi_internal, validate_model_file_02_n)
 {
-  ml_pipeline_h handle = nullptr;
-  ml_pipeline_element_h vscale_h = nullptr;
+  const gchar *sroot_path = g_getenv ("NNSTREAMER_SOURCE_ROOT_PATH");
+  const gchar cf_name[] = "libnnstreamer_customfilter_passthrough_variable" SO_FILE_EXTENSION;
+  gchar *lib_path = NULL;
+  gchar *test_model1 = NULL;
+  gchar *test_model2 = NULL;
+  gchar *test_models[2];
   int status;
-  uint32_t ret_method;
-  int32_t ret_signed_method;
-  gchar *pipeline;
-
-  pipeline = g_strdup (
-      "videotestsrc name=vsrc is-live=true ! videoconvert ! videoscale name=vscale ! "
-      "video/x-raw,format=RGBx,width=224,height=224,framerate=60/1 ! tensor_converter ! "
-      "valve name=valvex ! input-selector name=is01 ! tensor_sink name=sinkx");
-
-  status = ml_pipeline_construct (pipeline, nullptr, nullptr, &handle);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-
-  status = ml_pipeline_element_get_handle (handle, "vscale", &vscale_h);
-  EXPECT_EQ (status, ML_ERROR_NONE);
+  ml_nnfw_type_e nnfw;
 
-  status = ml_pipeline_element_set_property_enum (vscale_h, "method", 3U);
-  EXPECT_EQ (status, ML_ERROR_NONE);
+  lib_path = nnsconf_get_custom_value_string ("filter", "customfilters");
+  if (lib_path == NULL) {
+    /* cannot get custom-filter directory */
+    goto skip_test;
+  }
 
-  /* Test Code */
-  status = ml_pipeline_element_get_property_enum (vscale_h, "method", &ret_method);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (ret_method, 3U);
+  test_model1 = g_build_filename (lib_path, cf_name, NULL);
+  if (!g_file_test (test_model1, G_FILE_TEST_EXISTS)) {
+    goto skip_test;
+  }
 
-  status = ml_pipeline_element_set_property_enum (vscale_h, "method", 5U);
-  EXPECT_EQ (status, ML_ERROR_NONE);
+  /* supposed to run test in build directory */
+  if (sroot_path == NULL)
+    sroot_path = "..";
 
-  status = ml_pipeline_element_get_property_enum (vscale_h, "method", &ret_method);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (ret_method, 5U);
+  test_model2 = g_build_filename (sroot_path, "tests", "test_models", "models",
+      "mobilenet_v1_1.0_224_quant.tflite", NULL);
+  ASSERT_TRUE (g_file_test (test_model2, G_FILE_TEST_EXISTS));
 
-  status = ml_pipeline_element_set_property_uint32 (vscale_h, "method", 2U);
-  EXPECT_EQ (status, ML_ERROR_NONE);
+  test_models[0] = test_model1;
+  test_models[1] = test_model2;
 
-  status = ml_pipeline_element_get_property_uint32 (vscale_h, "method", &ret_method);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (ret_method, 2U);
+  nnfw = ML_NNFW_TYPE_CUSTOM_FILTER;
+  status = _ml_validate_model_file (&test_model2, 1, &nnfw);
+  EXPECT_NE (status, ML_ERROR_NONE);
 
-  status = ml_pipeline_element_set_property_int32 (vscale_h, "method", 4);
-  EXPECT_EQ (status, ML_ERROR_NONE);
+  nnfw = ML_NNFW_TYPE_TENSORFLOW_LITE;
+  status = _ml_validate_model_file (&test_model1, 1, &nnfw);
+  EXPECT_NE (status, ML_ERROR_NONE);
 
-  status = ml_pipeline_element_get_property_int32 (vscale_h, "method", &ret_signed_method);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (ret_signed_method, 4);
+  nnfw = ML_NNFW_TYPE_TENSORFLOW;
+  status = _ml_validate_model_file (&test_model2, 1, &nnfw);
+  EXPECT_NE (status, ML_ERROR_NONE);
 
-  status = ml_pipeline_element_release_handle (vscale_h);
-  EXPECT_EQ (status, ML_ERROR_NONE);
+  /* snap only for android */
+  nnfw = ML_NNFW_TYPE_SNAP;
+  status = _ml_validate_model_file (&test_model1, 1, &nnfw);
+  EXPECT_NE (status, ML_ERROR_NONE);
 
-  status = ml_pipeline_destroy (handle);
-  EXPECT_EQ (status, ML_ERROR_NONE);
+  nnfw = ML_NNFW_TYPE_VIVANTE;
+  status = _ml_validate_model_file (test_models, 1, &nnfw);
+  EXPECT_NE (status, ML_ERROR_NONE);
 
-  g_free (pipeline);
-}
+  /** @todo currently mvnc, openvino and edgetpu always return failure */
+  nnfw = ML_NNFW_TYPE_MVNC;
+  status = _ml_validate_model_file (&test_model1, 1, &nnfw);
+  EXPECT_NE (status, ML_ERROR_NONE);
 
-/**
- * @brief Test case of Element Property Control.
- * @detail Run the `ml_pipeline_element_get_property_enum()` API and check its results.
- */
-TEST (nnstreamer_capi_element, get_property_enum_02_n)
-{
+  nnfw = ML_NNFW_TYPE_OPENVINO;
+  status = _ml_validate_model_file (&test_model1, 1, &nnfw);
+  EXPECT_NE (status, ML_ERROR_NONE);
 
-  int status;
-  uint32_t ret_method;
+  nnfw = ML_NNFW_TYPE_EDGE_TPU;
+  status = _ml_validate_model_file (&test_model1, 1, &nnfw);
+  EXPECT_NE (status, ML_ERROR_NONE);
 
-  /* Test Code */
-  status = ml_pipeline_element_get_property_enum (nullptr, "method", &ret_method);
+  nnfw = ML_NNFW_TYPE_ARMNN;
+  status = _ml_validate_model_file (&test_model1, 1, &nnfw);
   EXPECT_NE (status, ML_ERROR_NONE);
+
+skip_test:
+  g_free (lib_path);
+  g_free (test_model1);
+  g_free (test_model2);
 }
 
 /**
- * @brief Test case of Element Property Control.
- * @detail Run the `ml_pipeline_element_get_property_enum()` API and check its results.
+ * @brief Test for internal function '_ml_validate_model_file'.
+ * @detail Invalid model path.
  */
-TEST (nnstreamer_capi_element, get_property_enum_03_n)
+TEST (nnstreamer_capi_internal, validate_model_file_03_n)
 {
-  ml_pipeline_h handle = nullptr;
-  ml_pipeline_element_h vscale_h = nullptr;
+  const gchar *root_path = g_getenv ("NNSTREAMER_SOURCE_ROOT_PATH");
   int status;
-  uint32_t ret_method;
-  gchar *pipeline;
+  ml_nnfw_type_e nnfw;
+  gchar *test_dir1, *test_dir2;
 
-  pipeline = g_strdup (
-      "videotestsrc name=vsrc is-live=true ! videoconvert ! videoscale name=vscale ! "
-      "video/x-raw,format=RGBx,width=224,height=224,framerate=60/1 ! tensor_converter ! "
-      "valve name=valvex ! input-selector name=is01 ! tensor_sink name=sinkx");
+  /* supposed to run test in build directory */
+  if (root_path == NULL)
+    root_path = "..";
 
-  status = ml_pipeline_construct (pipeline, nullptr, nullptr, &handle);
-  EXPECT_EQ (status, ML_ERROR_NONE);
+  /* test model path */
+  test_dir1 = g_build_filename (root_path, "tests", "test_models", "models", NULL);
 
-  status = ml_pipeline_element_get_handle (handle, "vscale", &vscale_h);
-  EXPECT_EQ (status, ML_ERROR_NONE);
+  /* invalid dir */
+  test_dir2 = g_build_filename (test_dir1, "invaliddir", NULL);
 
-  status = ml_pipeline_element_set_property_enum (vscale_h, "method", 3U);
-  EXPECT_EQ (status, ML_ERROR_NONE);
+  nnfw = ML_NNFW_TYPE_TENSORFLOW_LITE;
+  status = _ml_validate_model_file (&test_dir1, 1, &nnfw);
+  EXPECT_NE (status, ML_ERROR_NONE);
 
-  /* Test Code */
-  status = ml_pipeline_element_get_property_enum (vscale_h, "WRONG_NAME", &ret_method);
+  nnfw = ML_NNFW_TYPE_TENSORFLOW;
+  status = _ml_validate_model_file (&test_dir1, 1, &nnfw);
   EXPECT_NE (status, ML_ERROR_NONE);
 
-  status = ml_pipeline_element_release_handle (vscale_h);
-  EXPECT_EQ (status, ML_ERROR_NONE);
+  nnfw = ML_NNFW_TYPE_NNFW;
+  status = _ml_validate_model_file (&test_dir2, 1, &nnfw);
+  EXPECT_NE (status, ML_ERROR_NONE);
 
-  status = ml_pipeline_destroy (handle);
+#ifdef ENABLE_NNFW_RUNTIME
+  /* only NNFW supports dir path */
+  nnfw = ML_NNFW_TYPE_NNFW;
+  status = _ml_validate_model_file (&test_dir1, 1, &nnfw);
   EXPECT_EQ (status, ML_ERROR_NONE);
+#endif
 
-  g_free (pipeline);
+  g_free (test_dir1);
+  g_free (test_dir2);
 }
 
 /**
- * @brief Test case of Element Property Control.
- * @detail Run the `ml_pipeline_element_get_property_enum()` API and check its results.
+ * @brief Invoke callback for custom-easy filter.
  */
-TEST (nnstreamer_capi_element, get_property_enum_04_n)
+static int
+test_custom_easy_cb (const ml_tensors_data_h in, ml_tensors_data_h out,
+    void *user_data)
 {
-  ml_pipeline_h handle = nullptr;
-  ml_pipeline_element_h demux_h = nullptr;
-  gchar *pipeline;
-  uint32_t ret_wrong_type;
-  int status;
-
-  pipeline = g_strdup (
-      "videotestsrc ! video/x-raw,format=RGB,width=640,height=480 ! videorate max-rate=1 ! "
-      "tensor_converter ! tensor_mux ! tensor_demux name=demux ! tensor_sink");
-
-  status = ml_pipeline_construct (pipeline, nullptr, nullptr, &handle);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-
-  status = ml_pipeline_element_get_handle (handle, "demux", &demux_h);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-
-  status = ml_pipeline_element_set_property_string (demux_h, "tensorpick", "1,2");
-  EXPECT_EQ (status, ML_ERROR_NONE);
-
-  /* Test Code */
-  status = ml_pipeline_element_get_property_enum (demux_h, "tensorpick", &ret_wrong_type);
-  EXPECT_NE (status, ML_ERROR_NONE);
-
-  status = ml_pipeline_element_release_handle (demux_h);
-  EXPECT_EQ (status, ML_ERROR_NONE);
+  /* test code, set data size. */
+  if (user_data) {
+    void *raw_data = NULL;
+    size_t *data_size = (size_t *)user_data;
 
-  status = ml_pipeline_destroy (handle);
-  EXPECT_EQ (status, ML_ERROR_NONE);
+    ml_tensors_data_get_tensor_data (out, 0, &raw_data, data_size);
+  }
 
-  g_free (pipeline);
+  return 0;
 }
 
 /**
- * @brief Test case of Element Property Control.
- * @detail Run the `ml_pipeline_element_get_property_enum()` API and check its results.
+ * @brief Test for custom-easy registration.
  */
-TEST (nnstreamer_capi_element, get_property_enum_05_n)
+TEST (nnstreamer_capi_custom, register_filter_01_p)
 {
-  ml_pipeline_h handle = nullptr;
-  ml_pipeline_element_h vscale_h = nullptr;
+  const char test_custom_filter[] = "test-custom-filter";
+  ml_pipeline_h pipe;
+  ml_pipeline_src_h src;
+  ml_pipeline_sink_h sink;
+  ml_custom_easy_filter_h custom;
+  ml_tensors_info_h in_info, out_info;
+  ml_tensors_data_h in_data;
+  ml_tensor_dimension dim = { 2, 1, 1, 1 };
   int status;
-  gchar *pipeline;
+  gchar *pipeline = g_strdup_printf (
+      "appsrc name=srcx ! other/tensor,dimension=(string)2:1:1:1,type=(string)int8,framerate=(fraction)0/1 ! tensor_filter framework=custom-easy model=%s ! tensor_sink name=sinkx",
+      test_custom_filter);
+  guint *count_sink = (guint *)g_malloc0 (sizeof (guint));
+  size_t *filter_data_size = (size_t *)g_malloc0 (sizeof (size_t));
+  size_t data_size;
+  guint i;
 
-  pipeline = g_strdup (
-      "videotestsrc name=vsrc is-live=true ! videoconvert ! videoscale name=vscale ! "
-      "video/x-raw,format=RGBx,width=224,height=224,framerate=60/1 ! tensor_converter ! "
-      "valve name=valvex ! input-selector name=is01 ! tensor_sink name=sinkx");
+  ml_tensors_info_create (&in_info);
+  ml_tensors_info_set_count (in_info, 1);
+  ml_tensors_info_set_tensor_type (in_info, 0, ML_TENSOR_TYPE_INT8);
+  ml_tensors_info_set_tensor_dimension (in_info, 0, dim);
 
-  status = ml_pipeline_construct (pipeline, nullptr, nullptr, &handle);
-  EXPECT_EQ (status, ML_ERROR_NONE);
+  ml_tensors_info_create (&out_info);
+  ml_tensors_info_set_count (out_info, 1);
+  ml_tensors_info_set_tensor_type (out_info, 0, ML_TENSOR_TYPE_FLOAT32);
+  ml_tensors_info_set_tensor_dimension (out_info, 0, dim);
+  ml_tensors_info_get_tensor_size (out_info, 0, &data_size);
 
-  status = ml_pipeline_element_get_handle (handle, "vscale", &vscale_h);
+  /* test code for custom filter */
+  status = ml_pipeline_custom_easy_filter_register (test_custom_filter, in_info,
+      out_info, test_custom_easy_cb, filter_data_size, &custom);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_pipeline_element_set_property_enum (vscale_h, "method", 3U);
+  status = ml_pipeline_construct (pipeline, NULL, NULL, &pipe);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  /* Test Code */
-  status = ml_pipeline_element_get_property_enum (vscale_h, "method", nullptr);
-  EXPECT_NE (status, ML_ERROR_NONE);
+  status = ml_pipeline_sink_register (
+      pipe, "sinkx", test_sink_callback_count, count_sink, &sink);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_pipeline_element_release_handle (vscale_h);
+  status = ml_pipeline_src_get_handle (pipe, "srcx", &src);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_pipeline_destroy (handle);
+  status = ml_pipeline_start (pipe);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  g_free (pipeline);
-}
+  for (i = 0; i < 5; i++) {
+    status = ml_tensors_data_create (in_info, &in_data);
+    EXPECT_EQ (status, ML_ERROR_NONE);
 
-/**
- * @brief Test case of Element Property Control.
- * @detail Construct the pipeline and run it during updating elements' property.
- */
-TEST (nnstreamer_capi_element, scenario_01_p)
-{
-  ml_pipeline_h handle = nullptr;
-  ml_pipeline_element_h vsrc_h = nullptr;
-  ml_pipeline_state_e state;
-  gchar *pipeline;
-  int status;
+    status = ml_pipeline_src_input_data (src, in_data, ML_PIPELINE_BUF_POLICY_AUTO_FREE);
+    EXPECT_EQ (status, ML_ERROR_NONE);
 
-  pipeline = g_strdup ("videotestsrc name=vsrc is-live=true ! videoconvert ! videoscale ! video/x-raw,format=RGBx,width=224,height=224,framerate=60/1 ! "
-                       "tensor_converter ! tensor_sink name=sinkx");
+    g_usleep (50000); /* 50ms. Wait a bit. */
+  }
 
-  status = ml_pipeline_construct (pipeline, nullptr, nullptr, &handle);
+  status = ml_pipeline_stop (pipe);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_pipeline_element_get_handle (handle, "vsrc", &vsrc_h);
+  status = ml_pipeline_src_release_handle (src);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  /* Test code: Set the videotestsrc pattern */
-  status = ml_pipeline_element_set_property_enum (vsrc_h, "pattern", 4);
+  status = ml_pipeline_sink_unregister (sink);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_pipeline_start (handle);
+  status = ml_pipeline_destroy (pipe);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  g_usleep (50000);
 
-  status = ml_pipeline_get_state (handle, &state);
+  status = ml_pipeline_custom_easy_filter_unregister (custom);
   EXPECT_EQ (status, ML_ERROR_NONE);
-  wait_for_start (handle, state, status);
-  EXPECT_EQ (state, ML_PIPELINE_STATE_PLAYING);
 
-  /* Stop playing */
-  status = ml_pipeline_stop (handle);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-  g_usleep (50000);
+  /* check received data in sink node */
+  EXPECT_TRUE (*count_sink > 0U);
+  EXPECT_TRUE (*filter_data_size > 0U && *filter_data_size == data_size);
 
-  /* Test code: Set the new videotestsrc pattern */
-  status = ml_pipeline_element_set_property_enum (vsrc_h, "pattern", 12);
-  EXPECT_EQ (status, ML_ERROR_NONE);
+  ml_tensors_info_destroy (in_info);
+  ml_tensors_info_destroy (out_info);
+  g_free (pipeline);
+  g_free (count_sink);
+  g_free (filter_data_size);
+}
 
-  /* Resume playing */
-  status = ml_pipeline_start (handle);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-  g_usleep (50000);
+/**
+ * @brief Test for custom-easy registration.
+ * @detail Invalid params.
+ */
+TEST (nnstreamer_capi_custom, register_filter_02_n)
+{
+  ml_custom_easy_filter_h custom;
+  ml_tensors_info_h in_info, out_info;
+  int status;
+  ml_tensor_dimension dim = { 2, 1, 1, 1 };
 
-  status = ml_pipeline_get_state (handle, &state);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-  wait_for_start (handle, state, status);
-  EXPECT_EQ (state, ML_PIPELINE_STATE_PLAYING);
+  ml_tensors_info_create (&in_info);
+  ml_tensors_info_create (&out_info);
 
-  status = ml_pipeline_stop (handle);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-  g_usleep (50000);
 
-  status = ml_pipeline_element_release_handle (vsrc_h);
-  EXPECT_EQ (status, ML_ERROR_NONE);
+  ml_tensors_info_set_count (in_info, 1);
+  ml_tensors_info_set_tensor_type (in_info, 0, ML_TENSOR_TYPE_INT8);
+  ml_tensors_info_set_tensor_dimension (in_info, 0, dim);
 
-  status = ml_pipeline_destroy (handle);
-  EXPECT_EQ (status, ML_ERROR_NONE);
+  ml_tensors_info_set_count (out_info, 1);
+  ml_tensors_info_set_tensor_type (out_info, 0, ML_TENSOR_TYPE_FLOAT32);
+  ml_tensors_info_set_tensor_dimension (out_info, 0, dim);
 
-  g_free (pipeline);
+  /* test code with null param */
+  status = ml_pipeline_custom_easy_filter_register (
+      NULL, in_info, out_info, test_custom_easy_cb, NULL, &custom);
+  EXPECT_NE (status, ML_ERROR_NONE);
+
+  ml_tensors_info_destroy (in_info);
+  ml_tensors_info_destroy (out_info);
 }
 
 /**
- * @brief Test case of Element Property Control.
- * @detail Construct the pipeline and run it during updating elements' property.
+ * @brief Test for custom-easy registration.
+ * @detail Invalid params.
  */
-TEST (nnstreamer_capi_element, scenario_02_p)
+TEST (nnstreamer_capi_custom, register_filter_03_n)
 {
-  ml_pipeline_h handle = nullptr;
-  ml_pipeline_sink_h sinkhandle = nullptr;
-  ml_pipeline_element_h asink_h = nullptr;
-  gchar *pipeline;
-  guint *count_sink;
+  const char test_custom_filter[] = "test-custom-filter";
+  ml_custom_easy_filter_h custom;
+  ml_tensors_info_h out_info;
   int status;
+  ml_tensor_dimension dim = { 2, 1, 1, 1 };
 
-  pipeline = g_strdup ("videotestsrc is-live=true ! videoconvert ! tensor_converter ! appsink name=sinkx sync=false");
-
-  count_sink = (guint *)g_malloc (sizeof (guint));
-  ASSERT_TRUE (count_sink != NULL);
-  *count_sink = 0;
-
-  status = ml_pipeline_construct (pipeline, nullptr, nullptr, &handle);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-
-  status = ml_pipeline_element_get_handle (handle, "sinkx", &asink_h);
-  EXPECT_EQ (status, ML_ERROR_NONE);
+  ml_tensors_info_create (&out_info);
 
-  status = ml_pipeline_sink_register (
-      handle, "sinkx", test_sink_callback_count, count_sink, &sinkhandle);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_TRUE (sinkhandle != NULL);
+  ml_tensors_info_set_count (out_info, 1);
+  ml_tensors_info_set_tensor_type (out_info, 0, ML_TENSOR_TYPE_FLOAT32);
+  ml_tensors_info_set_tensor_dimension (out_info, 0, dim);
 
-  status = ml_pipeline_start (handle);
-  EXPECT_EQ (status, ML_ERROR_NONE);
+  /* test code with null param */
+  status = ml_pipeline_custom_easy_filter_register (
+      test_custom_filter, NULL, out_info, test_custom_easy_cb, NULL, &custom);
+  EXPECT_NE (status, ML_ERROR_NONE);
 
-  g_usleep (100000);
+  ml_tensors_info_destroy (out_info);
+}
 
-  status = ml_pipeline_stop (handle);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_TRUE (*count_sink > 0U);
+/**
+ * @brief Test for custom-easy registration.
+ * @detail Invalid params.
+ */
+TEST (nnstreamer_capi_custom, register_filter_04_n)
+{
+  const char test_custom_filter[] = "test-custom-filter";
+  ml_custom_easy_filter_h custom;
+  ml_tensors_info_h in_info;
+  int status;
+  ml_tensor_dimension dim = { 2, 1, 1, 1 };
 
-  /* Test Code */
-  *count_sink = 0;
+  ml_tensors_info_create (&in_info);
 
-  status = ml_pipeline_element_set_property_bool (asink_h, "emit-signals", FALSE);
-  EXPECT_EQ (status, ML_ERROR_NONE);
+  ml_tensors_info_set_count (in_info, 1);
+  ml_tensors_info_set_tensor_type (in_info, 0, ML_TENSOR_TYPE_INT8);
+  ml_tensors_info_set_tensor_dimension (in_info, 0, dim);
 
-  status = ml_pipeline_start (handle);
-  EXPECT_EQ (status, ML_ERROR_NONE);
+  /* test code with null param */
+  status = ml_pipeline_custom_easy_filter_register (
+      test_custom_filter, in_info, NULL, test_custom_easy_cb, NULL, &custom);
+  EXPECT_NE (status, ML_ERROR_NONE);
 
-  g_usleep (100000);
+  ml_tensors_info_destroy (in_info);
+}
 
-  /** Since `emit-signals` property of appsink is set as FALSE, *count_sink
-   * should be 0 */
-  EXPECT_TRUE (*count_sink == 0U);
+/**
+ * @brief Test for custom-easy registration.
+ * @detail Invalid params.
+ */
+TEST (nnstreamer_capi_custom, register_filter_05_n)
+{
+  const char test_custom_filter[] = "test-custom-filter";
+  ml_custom_easy_filter_h custom;
+  ml_tensors_info_h in_info, out_info;
+  int status;
+  ml_tensor_dimension dim = { 2, 1, 1, 1 };
 
-  status = ml_pipeline_stop (handle);
-  EXPECT_EQ (status, ML_ERROR_NONE);
+  ml_tensors_info_create (&in_info);
+  ml_tensors_info_create (&out_info);
 
-  status = ml_pipeline_sink_unregister (sinkhandle);
-  EXPECT_EQ (status, ML_ERROR_NONE);
+  ml_tensors_info_set_count (in_info, 1);
+  ml_tensors_info_set_tensor_type (in_info, 0, ML_TENSOR_TYPE_INT8);
+  ml_tensors_info_set_tensor_dimension (in_info, 0, dim);
 
-  status = ml_pipeline_element_release_handle (asink_h);
-  EXPECT_EQ (status, ML_ERROR_NONE);
+  ml_tensors_info_set_count (out_info, 1);
+  ml_tensors_info_set_tensor_type (out_info, 0, ML_TENSOR_TYPE_FLOAT32);
+  ml_tensors_info_set_tensor_dimension (out_info, 0, dim);
 
-  status = ml_pipeline_destroy (handle);
-  EXPECT_EQ (status, ML_ERROR_NONE);
+  /* test code with null param */
+  status = ml_pipeline_custom_easy_filter_register (
+      test_custom_filter, in_info, out_info, NULL, NULL, &custom);
+  EXPECT_NE (status, ML_ERROR_NONE);
 
-  g_free (pipeline);
-  g_free (count_sink);
+  ml_tensors_info_destroy (in_info);
+  ml_tensors_info_destroy (out_info);
 }
 
 /**
- * @brief Test for internal function '_ml_tensors_info_copy_from_gst'.
+ * @brief Test for custom-easy registration.
+ * @detail Invalid params.
  */
-TEST (nnstreamer_capi_internal, copy_from_gst)
+TEST (nnstreamer_capi_custom, register_filter_06_n)
 {
+  const char test_custom_filter[] = "test-custom-filter";
+  ml_tensors_info_h in_info, out_info;
   int status;
-  ml_tensors_info_h ml_info;
-  ml_tensor_type_e type;
-  ml_tensor_dimension dim;
-  char *name;
-  unsigned int count;
-  GstTensorsInfo gst_info;
-  guint i;
+  ml_tensor_dimension dim = { 2, 1, 1, 1 };
 
-  gst_tensors_info_init (&gst_info);
-  gst_info.num_tensors = 2;
-  for (i = 0; i < NNS_TENSOR_RANK_LIMIT; i++) {
-    gst_info.info[0].dimension[i] = i + 1;
-    gst_info.info[1].dimension[i] = i + 1;
-  }
+  ml_tensors_info_create (&in_info);
+  ml_tensors_info_create (&out_info);
 
-  status = ml_tensors_info_create (&ml_info);
-  EXPECT_EQ (status, ML_ERROR_NONE);
+  ml_tensors_info_set_count (in_info, 1);
+  ml_tensors_info_set_tensor_type (in_info, 0, ML_TENSOR_TYPE_INT8);
+  ml_tensors_info_set_tensor_dimension (in_info, 0, dim);
 
-  _ml_tensors_info_copy_from_gst ((ml_tensors_info_s *)ml_info, &gst_info);
-  status = ml_tensors_info_get_count (ml_info, &count);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (count, 2U);
-  status = ml_tensors_info_get_tensor_dimension (ml_info, 0, dim);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (dim[0], 1U);
-  EXPECT_EQ (dim[1], 2U);
-  EXPECT_EQ (dim[2], 3U);
-  EXPECT_EQ (dim[3], 4U);
+  ml_tensors_info_set_count (out_info, 1);
+  ml_tensors_info_set_tensor_type (out_info, 0, ML_TENSOR_TYPE_FLOAT32);
+  ml_tensors_info_set_tensor_dimension (out_info, 0, dim);
 
-  gst_info.info[0].type = _NNS_INT32;
-  gst_info.info[1].type = _NNS_UINT32;
-  _ml_tensors_info_copy_from_gst ((ml_tensors_info_s *)ml_info, &gst_info);
-  status = ml_tensors_info_get_tensor_type (ml_info, 0, &type);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (type, ML_TENSOR_TYPE_INT32);
-  status = ml_tensors_info_get_tensor_type (ml_info, 1, &type);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (type, ML_TENSOR_TYPE_UINT32);
+  /* test code with null param */
+  status = ml_pipeline_custom_easy_filter_register (
+      test_custom_filter, in_info, out_info, test_custom_easy_cb, NULL, NULL);
+  EXPECT_NE (status, ML_ERROR_NONE);
 
-  gst_info.info[0].type = _NNS_INT16;
-  gst_info.info[1].type = _NNS_UINT16;
-  _ml_tensors_info_copy_from_gst ((ml_tensors_info_s *)ml_info, &gst_info);
-  status = ml_tensors_info_get_tensor_type (ml_info, 0, &type);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (type, ML_TENSOR_TYPE_INT16);
-  status = ml_tensors_info_get_tensor_type (ml_info, 1, &type);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (type, ML_TENSOR_TYPE_UINT16);
+  ml_tensors_info_destroy (in_info);
+  ml_tensors_info_destroy (out_info);
+}
 
-  gst_info.info[0].type = _NNS_INT8;
-  gst_info.info[1].type = _NNS_UINT8;
-  _ml_tensors_info_copy_from_gst ((ml_tensors_info_s *)ml_info, &gst_info);
-  status = ml_tensors_info_get_tensor_type (ml_info, 0, &type);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (type, ML_TENSOR_TYPE_INT8);
-  status = ml_tensors_info_get_tensor_type (ml_info, 1, &type);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (type, ML_TENSOR_TYPE_UINT8);
+/**
+ * @brief Test for custom-easy registration.
+ * @detail Invalid params.
+ */
+TEST (nnstreamer_capi_custom, register_filter_07_n)
+{
+  int status;
 
-  gst_info.info[0].type = _NNS_INT64;
-  gst_info.info[1].type = _NNS_UINT64;
-  _ml_tensors_info_copy_from_gst ((ml_tensors_info_s *)ml_info, &gst_info);
-  status = ml_tensors_info_get_tensor_type (ml_info, 0, &type);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (type, ML_TENSOR_TYPE_INT64);
-  status = ml_tensors_info_get_tensor_type (ml_info, 1, &type);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (type, ML_TENSOR_TYPE_UINT64);
+  /* test code with null param */
+  status = ml_pipeline_custom_easy_filter_unregister (NULL);
+  EXPECT_NE (status, ML_ERROR_NONE);
+}
 
-  gst_info.info[0].type = _NNS_FLOAT64;
-  gst_info.info[1].type = _NNS_FLOAT32;
-  _ml_tensors_info_copy_from_gst ((ml_tensors_info_s *)ml_info, &gst_info);
-  status = ml_tensors_info_get_tensor_type (ml_info, 0, &type);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (type, ML_TENSOR_TYPE_FLOAT64);
-  status = ml_tensors_info_get_tensor_type (ml_info, 1, &type);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_EQ (type, ML_TENSOR_TYPE_FLOAT32);
+/**
+ * @brief Test for custom-easy registration.
+ * @detail Invalid params.
+ */
+TEST (nnstreamer_capi_custom, register_filter_08_n)
+{
+  const char test_custom_filter[] = "test-custom-filter";
+  ml_custom_easy_filter_h custom;
+  ml_tensors_info_h in_info, out_info;
+  ml_tensor_dimension dim = { 2, 1, 1, 1 };
+  int status;
 
-  gst_info.info[0].name = g_strdup ("tn1");
-  gst_info.info[1].name = g_strdup ("tn2");
-  _ml_tensors_info_copy_from_gst ((ml_tensors_info_s *)ml_info, &gst_info);
-  status = ml_tensors_info_get_tensor_name (ml_info, 0, &name);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_STREQ (name, "tn1");
-  g_free (name);
-  status = ml_tensors_info_get_tensor_name (ml_info, 1, &name);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-  EXPECT_STREQ (name, "tn2");
-  g_free (name);
+  ml_tensors_info_create (&in_info);
+  ml_tensors_info_create (&out_info);
 
-  status = ml_tensors_info_destroy (ml_info);
-  EXPECT_EQ (status, ML_ERROR_NONE);
+  /* test code with invalid output info */
+  ml_tensors_info_set_count (in_info, 1);
+  ml_tensors_info_set_tensor_type (in_info, 0, ML_TENSOR_TYPE_INT8);
+  ml_tensors_info_set_tensor_dimension (in_info, 0, dim);
+
+  status = ml_pipeline_custom_easy_filter_register (
+      test_custom_filter, in_info, out_info, test_custom_easy_cb, NULL, &custom);
+  EXPECT_NE (status, ML_ERROR_NONE);
 
-  gst_tensors_info_free (&gst_info);
+  ml_tensors_info_destroy (in_info);
+  ml_tensors_info_destroy (out_info);
 }
 
 /**
- * @brief Test for internal function '_ml_tensors_info_copy_from_ml'.
+ * @brief Test for custom-easy registration.
+ * @detail Invalid params.
  */
-TEST (nnstreamer_capi_internal, copy_from_ml)
+TEST (nnstreamer_capi_custom, register_filter_09_n)
 {
+  const char test_custom_filter[] = "test-custom-filter";
+  ml_custom_easy_filter_h custom;
+  ml_tensors_info_h in_info, out_info;
+  ml_tensor_dimension dim = { 2, 1, 1, 1 };
   int status;
-  ml_tensors_info_h ml_info;
-  ml_tensor_dimension dim = { 1, 2, 3, 4 };
-  GstTensorsInfo gst_info;
-
-  gst_tensors_info_init (&gst_info);
-
-  status = ml_tensors_info_create (&ml_info);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-  status = ml_tensors_info_set_count (ml_info, 2);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-  status = ml_tensors_info_set_tensor_dimension (ml_info, 0, dim);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-  status = ml_tensors_info_set_tensor_dimension (ml_info, 1, dim);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-
-  _ml_tensors_info_copy_from_ml (&gst_info, (ml_tensors_info_s *)ml_info);
-  EXPECT_EQ (gst_info.num_tensors, 2U);
-  EXPECT_EQ (gst_info.info[0].dimension[0], 1U);
-  EXPECT_EQ (gst_info.info[0].dimension[1], 2U);
-  EXPECT_EQ (gst_info.info[0].dimension[2], 3U);
-  EXPECT_EQ (gst_info.info[0].dimension[3], 4U);
-
-  status = ml_tensors_info_set_tensor_type (ml_info, 0, ML_TENSOR_TYPE_INT32);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-  status = ml_tensors_info_set_tensor_type (ml_info, 1, ML_TENSOR_TYPE_UINT32);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-  _ml_tensors_info_copy_from_ml (&gst_info, (ml_tensors_info_s *)ml_info);
-  EXPECT_EQ (gst_info.info[0].type, _NNS_INT32);
-  EXPECT_EQ (gst_info.info[1].type, _NNS_UINT32);
-
-  status = ml_tensors_info_set_tensor_type (ml_info, 0, ML_TENSOR_TYPE_INT16);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-  status = ml_tensors_info_set_tensor_type (ml_info, 1, ML_TENSOR_TYPE_UINT16);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-  _ml_tensors_info_copy_from_ml (&gst_info, (ml_tensors_info_s *)ml_info);
-  EXPECT_EQ (gst_info.info[0].type, _NNS_INT16);
-  EXPECT_EQ (gst_info.info[1].type, _NNS_UINT16);
-
-  status = ml_tensors_info_set_tensor_type (ml_info, 0, ML_TENSOR_TYPE_INT8);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-  status = ml_tensors_info_set_tensor_type (ml_info, 1, ML_TENSOR_TYPE_UINT8);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-  _ml_tensors_info_copy_from_ml (&gst_info, (ml_tensors_info_s *)ml_info);
-  EXPECT_EQ (gst_info.info[0].type, _NNS_INT8);
-  EXPECT_EQ (gst_info.info[1].type, _NNS_UINT8);
-
-  status = ml_tensors_info_set_tensor_type (ml_info, 0, ML_TENSOR_TYPE_INT64);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-  status = ml_tensors_info_set_tensor_type (ml_info, 1, ML_TENSOR_TYPE_UINT64);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-  _ml_tensors_info_copy_from_ml (&gst_info, (ml_tensors_info_s *)ml_info);
-  EXPECT_EQ (gst_info.info[0].type, _NNS_INT64);
-  EXPECT_EQ (gst_info.info[1].type, _NNS_UINT64);
 
-  status = ml_tensors_info_set_tensor_type (ml_info, 0, ML_TENSOR_TYPE_FLOAT64);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-  status = ml_tensors_info_set_tensor_type (ml_info, 1, ML_TENSOR_TYPE_FLOAT32);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-  _ml_tensors_info_copy_from_ml (&gst_info, (ml_tensors_info_s *)ml_info);
-  EXPECT_EQ (gst_info.info[0].type, _NNS_FLOAT64);
-  EXPECT_EQ (gst_info.info[1].type, _NNS_FLOAT32);
+  ml_tensors_info_create (&in_info);
+  ml_tensors_info_create (&out_info);
 
-  status = ml_tensors_info_set_tensor_name (ml_info, 0, "tn1");
-  EXPECT_EQ (status, ML_ERROR_NONE);
-  status = ml_tensors_info_set_tensor_name (ml_info, 1, "tn2");
-  EXPECT_EQ (status, ML_ERROR_NONE);
-  _ml_tensors_info_copy_from_ml (&gst_info, (ml_tensors_info_s *)ml_info);
-  EXPECT_STREQ (gst_info.info[0].name, "tn1");
-  EXPECT_STREQ (gst_info.info[1].name, "tn2");
+  /* test code with invalid input info */
+  ml_tensors_info_set_count (out_info, 1);
+  ml_tensors_info_set_tensor_type (out_info, 0, ML_TENSOR_TYPE_FLOAT32);
+  ml_tensors_info_set_tensor_dimension (out_info, 0, dim);
 
-  status = ml_tensors_info_destroy (ml_info);
-  EXPECT_EQ (status, ML_ERROR_NONE);
+  status = ml_pipeline_custom_easy_filter_register (
+      test_custom_filter, in_info, out_info, test_custom_easy_cb, NULL, &custom);
+  EXPECT_NE (status, ML_ERROR_NONE);
 
-  gst_tensors_info_free (&gst_info);
+  ml_tensors_info_destroy (in_info);
+  ml_tensors_info_destroy (out_info);
 }
 
 /**
- * @brief Test for internal function '_ml_validate_model_file'.
+ * @brief Test for custom-easy registration.
  * @detail Invalid params.
  */
-TEST (nnstreamer_capi_internal, validate_model_file_01_n)
+TEST (nnstreamer_capi_custom, register_filter_10_n)
 {
-  const gchar cf_name[] = "libnnstreamer_customfilter_passthrough_variable" SO_FILE_EXTENSION;
-  gchar *lib_path = NULL;
-  gchar *test_model = NULL;
+  const char test_custom_filter[] = "test-custom-filter";
+  ml_custom_easy_filter_h custom, custom2;
+  ml_tensors_info_h in_info, out_info;
+  ml_tensor_dimension dim = { 2, 1, 1, 1 };
   int status;
-  ml_nnfw_type_e nnfw = ML_NNFW_TYPE_CUSTOM_FILTER;
 
-  lib_path = nnsconf_get_custom_value_string ("filter", "customfilters");
-  if (lib_path == NULL) {
-    /* cannot get custom-filter directory */
-    goto skip_test;
-  }
+  ml_tensors_info_create (&in_info);
+  ml_tensors_info_create (&out_info);
 
-  test_model = g_build_filename (lib_path, cf_name, NULL);
-  if (!g_file_test (test_model, G_FILE_TEST_EXISTS)) {
-    goto skip_test;
-  }
+  ml_tensors_info_set_count (in_info, 1);
+  ml_tensors_info_set_tensor_type (in_info, 0, ML_TENSOR_TYPE_INT8);
+  ml_tensors_info_set_tensor_dimension (in_info, 0, dim);
 
-  status = _ml_validate_model_file (NULL, 1, &nnfw);
-  EXPECT_NE (status, ML_ERROR_NONE);
+  ml_tensors_info_set_count (out_info, 1);
+  ml_tensors_info_set_tensor_type (out_info, 0, ML_TENSOR_TYPE_FLOAT32);
+  ml_tensors_info_set_tensor_dimension (out_info, 0, dim);
 
-  status = _ml_validate_model_file (&test_model, 0, &nnfw);
-  EXPECT_NE (status, ML_ERROR_NONE);
+  /* test code for duplicated name */
+  status = ml_pipeline_custom_easy_filter_register (
+      test_custom_filter, in_info, out_info, test_custom_easy_cb, NULL, &custom);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = _ml_validate_model_file (&test_model, 1, NULL);
+  status = ml_pipeline_custom_easy_filter_register (test_custom_filter, in_info,
+      out_info, test_custom_easy_cb, NULL, &custom2);
   EXPECT_NE (status, ML_ERROR_NONE);
 
-skip_test:
-  g_free (lib_path);
-  g_free (test_model);
+  status = ml_pipeline_custom_easy_filter_unregister (custom);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  ml_tensors_info_destroy (in_info);
+  ml_tensors_info_destroy (out_info);
 }
 
 /**
- * @brief Test for internal function '_ml_validate_model_file'.
- * @detail Invalid file extension.
+ * @brief Test for custom-easy unregistration.
+ * @detail Failed if pipeline is constructed.
  */
-TEST (nnstreamer_capi_internal, validate_model_file_02_n)
+TEST (nnstreamer_capi_custom, register_filter_11_n)
 {
-  const gchar *sroot_path = g_getenv ("NNSTREAMER_SOURCE_ROOT_PATH");
-  const gchar cf_name[] = "libnnstreamer_customfilter_passthrough_variable" SO_FILE_EXTENSION;
-  gchar *lib_path = NULL;
-  gchar *test_model1 = NULL;
-  gchar *test_model2 = NULL;
-  gchar *test_models[2];
+  ml_pipeline_h pipe1, pipe2;
+  ml_custom_easy_filter_h custom;
+  ml_tensors_info_h in_info, out_info;
+  ml_tensor_dimension dim = { 2, 1, 1, 1 };
   int status;
-  ml_nnfw_type_e nnfw;
-
-  lib_path = nnsconf_get_custom_value_string ("filter", "customfilters");
-  if (lib_path == NULL) {
-    /* cannot get custom-filter directory */
-    goto skip_test;
-  }
-
-  test_model1 = g_build_filename (lib_path, cf_name, NULL);
-  if (!g_file_test (test_model1, G_FILE_TEST_EXISTS)) {
-    goto skip_test;
-  }
-
-  /* supposed to run test in build directory */
-  if (sroot_path == NULL)
-    sroot_path = "..";
-
-  test_model2 = g_build_filename (sroot_path, "tests", "test_models", "models",
-      "mobilenet_v1_1.0_224_quant.tflite", NULL);
-  ASSERT_TRUE (g_file_test (test_model2, G_FILE_TEST_EXISTS));
+  gchar *pipeline = g_strdup_printf (
+      "appsrc name=srcx ! other/tensor,dimension=(string)2:1:1:1,type=(string)int8,framerate=(fraction)0/1 ! "
+      "tensor_filter framework=custom-easy model=tfilter_unreg_test ! tensor_sink name=sinkx");
 
-  test_models[0] = test_model1;
-  test_models[1] = test_model2;
+  ml_tensors_info_create (&in_info);
+  ml_tensors_info_set_count (in_info, 1);
+  ml_tensors_info_set_tensor_type (in_info, 0, ML_TENSOR_TYPE_INT8);
+  ml_tensors_info_set_tensor_dimension (in_info, 0, dim);
 
-  nnfw = ML_NNFW_TYPE_CUSTOM_FILTER;
-  status = _ml_validate_model_file (&test_model2, 1, &nnfw);
-  EXPECT_NE (status, ML_ERROR_NONE);
+  ml_tensors_info_create (&out_info);
+  ml_tensors_info_set_count (out_info, 1);
+  ml_tensors_info_set_tensor_type (out_info, 0, ML_TENSOR_TYPE_FLOAT32);
+  ml_tensors_info_set_tensor_dimension (out_info, 0, dim);
 
-  nnfw = ML_NNFW_TYPE_TENSORFLOW_LITE;
-  status = _ml_validate_model_file (&test_model1, 1, &nnfw);
-  EXPECT_NE (status, ML_ERROR_NONE);
+  status = ml_pipeline_custom_easy_filter_register ("tfilter_unreg_test",
+      in_info, out_info, test_custom_easy_cb, NULL, &custom);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-  nnfw = ML_NNFW_TYPE_TENSORFLOW;
-  status = _ml_validate_model_file (&test_model2, 1, &nnfw);
-  EXPECT_NE (status, ML_ERROR_NONE);
+  status = ml_pipeline_construct (pipeline, NULL, NULL, &pipe1);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-  /* snap only for android */
-  nnfw = ML_NNFW_TYPE_SNAP;
-  status = _ml_validate_model_file (&test_model1, 1, &nnfw);
-  EXPECT_NE (status, ML_ERROR_NONE);
+  status = ml_pipeline_construct (pipeline, NULL, NULL, &pipe2);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-  nnfw = ML_NNFW_TYPE_VIVANTE;
-  status = _ml_validate_model_file (test_models, 1, &nnfw);
+  /* failed to unregister custom-easy filter if pipeline is constructed */
+  status = ml_pipeline_custom_easy_filter_unregister (custom);
   EXPECT_NE (status, ML_ERROR_NONE);
 
-  /** @todo currently mvnc, openvino and edgetpu always return failure */
-  nnfw = ML_NNFW_TYPE_MVNC;
-  status = _ml_validate_model_file (&test_model1, 1, &nnfw);
-  EXPECT_NE (status, ML_ERROR_NONE);
+  status = ml_pipeline_destroy (pipe1);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-  nnfw = ML_NNFW_TYPE_OPENVINO;
-  status = _ml_validate_model_file (&test_model1, 1, &nnfw);
+  status = ml_pipeline_custom_easy_filter_unregister (custom);
   EXPECT_NE (status, ML_ERROR_NONE);
 
-  nnfw = ML_NNFW_TYPE_EDGE_TPU;
-  status = _ml_validate_model_file (&test_model1, 1, &nnfw);
-  EXPECT_NE (status, ML_ERROR_NONE);
+  status = ml_pipeline_destroy (pipe2);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-  nnfw = ML_NNFW_TYPE_ARMNN;
-  status = _ml_validate_model_file (&test_model1, 1, &nnfw);
-  EXPECT_NE (status, ML_ERROR_NONE);
+  /* succesfully done if all pipelines with custom-easy filter are destroyed */
+  status = ml_pipeline_custom_easy_filter_unregister (custom);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-skip_test:
-  g_free (lib_path);
-  g_free (test_model1);
-  g_free (test_model2);
+  ml_tensors_info_destroy (in_info);
+  ml_tensors_info_destroy (out_info);
+  g_free (pipeline);
 }
 
 /**
- * @brief Test for internal function '_ml_validate_model_file'.
- * @detail Invalid model path.
+ * @brief Test for custom-easy registration.
+ * @detail Register many filters and construct the pipeline with one of them.
  */
-TEST (nnstreamer_capi_internal, validate_model_file_03_n)
+TEST (nnstreamer_capi_custom, register_filter_12_p)
 {
-  const gchar *root_path = g_getenv ("NNSTREAMER_SOURCE_ROOT_PATH");
-  int status;
-  ml_nnfw_type_e nnfw;
-  gchar *test_dir1, *test_dir2;
-
-  /* supposed to run test in build directory */
-  if (root_path == NULL)
-    root_path = "..";
+  const guint num_filters = 200;
+  ml_pipeline_h pipe;
+  ml_custom_easy_filter_h custom[200];
+  ml_tensors_info_h in_info, out_info;
+  ml_tensor_dimension dim = { 2, 1, 1, 1 };
+  int status;
+  guint i;
+  gchar *name;
+  gchar *pipeline = g_strdup_printf (
+      "appsrc name=srcx ! other/tensor,dimension=(string)2:1:1:1,type=(string)int8,framerate=(fraction)0/1 ! "
+      "tensor_filter framework=custom-easy model=tfilter_many_%u ! tensor_sink name=sinkx",
+      num_filters / 2);
 
-  /* test model path */
-  test_dir1 = g_build_filename (root_path, "tests", "test_models", "models", NULL);
+  ml_tensors_info_create (&in_info);
+  ml_tensors_info_set_count (in_info, 1);
+  ml_tensors_info_set_tensor_type (in_info, 0, ML_TENSOR_TYPE_INT8);
+  ml_tensors_info_set_tensor_dimension (in_info, 0, dim);
 
-  /* invalid dir */
-  test_dir2 = g_build_filename (test_dir1, "invaliddir", NULL);
+  ml_tensors_info_create (&out_info);
+  ml_tensors_info_set_count (out_info, 1);
+  ml_tensors_info_set_tensor_type (out_info, 0, ML_TENSOR_TYPE_FLOAT32);
+  ml_tensors_info_set_tensor_dimension (out_info, 0, dim);
 
-  nnfw = ML_NNFW_TYPE_TENSORFLOW_LITE;
-  status = _ml_validate_model_file (&test_dir1, 1, &nnfw);
-  EXPECT_NE (status, ML_ERROR_NONE);
+  for (i = 0; i < num_filters; i++) {
+    name = g_strdup_printf ("tfilter_many_%u", i);
+    status = ml_pipeline_custom_easy_filter_register (name, in_info, out_info,
+        test_custom_easy_cb, NULL, &custom[i]);
+    EXPECT_EQ (status, ML_ERROR_NONE);
+    g_free (name);
+  }
 
-  nnfw = ML_NNFW_TYPE_TENSORFLOW;
-  status = _ml_validate_model_file (&test_dir1, 1, &nnfw);
-  EXPECT_NE (status, ML_ERROR_NONE);
+  status = ml_pipeline_construct (pipeline, NULL, NULL, &pipe);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-  nnfw = ML_NNFW_TYPE_NNFW;
-  status = _ml_validate_model_file (&test_dir2, 1, &nnfw);
+  /* the filter in the pipeline cannot be unregistered */
+  status = ml_pipeline_custom_easy_filter_unregister (custom[num_filters / 2]);
   EXPECT_NE (status, ML_ERROR_NONE);
 
-#ifdef ENABLE_NNFW_RUNTIME
-  /* only NNFW supports dir path */
-  nnfw = ML_NNFW_TYPE_NNFW;
-  status = _ml_validate_model_file (&test_dir1, 1, &nnfw);
+  status = ml_pipeline_destroy (pipe);
   EXPECT_EQ (status, ML_ERROR_NONE);
-#endif
 
-  g_free (test_dir1);
-  g_free (test_dir2);
+  for (i = 0; i < num_filters; i++) {
+    status = ml_pipeline_custom_easy_filter_unregister (custom[i]);
+    EXPECT_EQ (status, ML_ERROR_NONE);
+  }
+
+  ml_tensors_info_destroy (in_info);
+  ml_tensors_info_destroy (out_info);
+  g_free (pipeline);
 }
 
 /**
- * @brief Invoke callback for custom-easy filter.
+ * @brief Re-entrant invoke callback for custom-easy filter.
  */
 static int
-test_custom_easy_cb (const ml_tensors_data_h in, ml_tensors_data_h out,
+test_custom_easy_reentrant_cb (const ml_tensors_data_h in, ml_tensors_data_h out,
     void *user_data)
 {
-  /* test code, set data size. */
-  if (user_data) {
-    void *raw_data = NULL;
-    size_t *data_size = (size_t *)user_data;
-
-    ml_tensors_data_get_tensor_data (out, 0, &raw_data, data_size);
-  }
+  gint *count = (gint *)user_data;
 
+  g_atomic_int_inc (count);
   return 0;
 }
 
 /**
- * @brief Test for custom-easy registration.
+ * @brief Test for custom-easy registration with re-entrant flag.
+ * @detail Two pipelines invoke the same custom filter.
  */
-TEST (nnstreamer_capi_custom, register_filter_01_p)
+TEST (nnstreamer_capi_custom, register_filter_reentrant_p)
 {
-  const char test_custom_filter[] = "test-custom-filter";
-  ml_pipeline_h pipe;
-  ml_pipeline_src_h src;
-  ml_pipeline_sink_h sink;
+  const char test_custom_filter[] = "test-custom-filter-reentrant";
+  ml_pipeline_h pipe1, pipe2;
+  ml_pipeline_src_h src1, src2;
   ml_custom_easy_filter_h custom;
   ml_tensors_info_h in_info, out_info;
   ml_tensors_data_h in_data;
   ml_tensor_dimension dim = { 2, 1, 1, 1 };
   int status;
+  gint *count_invoke = (gint *)g_malloc0 (sizeof (gint));
   gchar *pipeline = g_strdup_printf (
       "appsrc name=srcx ! other/tensor,dimension=(string)2:1:1:1,type=(string)int8,framerate=(fraction)0/1 ! tensor_filter framework=custom-easy model=%s ! tensor_sink name=sinkx",
       test_custom_filter);
-  guint *count_sink = (guint *)g_malloc0 (sizeof (guint));
-  size_t *filter_data_size = (size_t *)g_malloc0 (sizeof (size_t));
-  size_t data_size;
   guint i;
 
   ml_tensors_info_create (&in_info);
@@ -10027,372 +14085,339 @@ TEST (nnstreamer_capi_custom, register_filter_01_p)
   ml_tensors_info_set_count (out_info, 1);
   ml_tensors_info_set_tensor_type (out_info, 0, ML_TENSOR_TYPE_FLOAT32);
   ml_tensors_info_set_tensor_dimension (out_info, 0, dim);
-  ml_tensors_info_get_tensor_size (out_info, 0, &data_size);
 
-  /* test code for custom filter */
-  status = ml_pipeline_custom_easy_filter_register (test_custom_filter, in_info,
-      out_info, test_custom_easy_cb, filter_data_size, &custom);
+  status = ml_pipeline_custom_easy_filter_register_full (test_custom_filter,
+      in_info, out_info, test_custom_easy_reentrant_cb, count_invoke,
+      ML_CUSTOM_EASY_FLAG_REENTRANT, &custom);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_pipeline_construct (pipeline, NULL, NULL, &pipe);
+  status = ml_pipeline_construct (pipeline, NULL, NULL, &pipe1);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_pipeline_sink_register (
-      pipe, "sinkx", test_sink_callback_count, count_sink, &sink);
+  status = ml_pipeline_construct (pipeline, NULL, NULL, &pipe2);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_pipeline_src_get_handle (pipe, "srcx", &src);
+  status = ml_pipeline_src_get_handle (pipe1, "srcx", &src1);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_pipeline_start (pipe);
+  status = ml_pipeline_src_get_handle (pipe2, "srcx", &src2);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_pipeline_start (pipe1);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_pipeline_start (pipe2);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
   for (i = 0; i < 5; i++) {
     status = ml_tensors_data_create (in_info, &in_data);
     EXPECT_EQ (status, ML_ERROR_NONE);
 
-    status = ml_pipeline_src_input_data (src, in_data, ML_PIPELINE_BUF_POLICY_AUTO_FREE);
+    status = ml_pipeline_src_input_data (src1, in_data, ML_PIPELINE_BUF_POLICY_AUTO_FREE);
+    EXPECT_EQ (status, ML_ERROR_NONE);
+
+    status = ml_tensors_data_create (in_info, &in_data);
+    EXPECT_EQ (status, ML_ERROR_NONE);
+
+    status = ml_pipeline_src_input_data (src2, in_data, ML_PIPELINE_BUF_POLICY_AUTO_FREE);
     EXPECT_EQ (status, ML_ERROR_NONE);
 
     g_usleep (50000); /* 50ms. Wait a bit. */
   }
 
-  status = ml_pipeline_stop (pipe);
-  EXPECT_EQ (status, ML_ERROR_NONE);
-
-  status = ml_pipeline_src_release_handle (src);
-  EXPECT_EQ (status, ML_ERROR_NONE);
+  wait_pipeline_process_buffers ((guint) g_atomic_int_get (count_invoke), 10U);
 
-  status = ml_pipeline_sink_unregister (sink);
+  status = ml_pipeline_destroy (pipe1);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_pipeline_destroy (pipe);
+  status = ml_pipeline_destroy (pipe2);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
   status = ml_pipeline_custom_easy_filter_unregister (custom);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  /* check received data in sink node */
-  EXPECT_TRUE (*count_sink > 0U);
-  EXPECT_TRUE (*filter_data_size > 0U && *filter_data_size == data_size);
+  EXPECT_EQ (g_atomic_int_get (count_invoke), 10);
 
   ml_tensors_info_destroy (in_info);
   ml_tensors_info_destroy (out_info);
   g_free (pipeline);
-  g_free (count_sink);
-  g_free (filter_data_size);
+  g_free (count_invoke);
 }
 
 /**
- * @brief Test for custom-easy registration.
- * @detail Invalid params.
+ * @brief Test for custom-easy registration with flags.
+ * @detail Invalid flags.
  */
-TEST (nnstreamer_capi_custom, register_filter_02_n)
+TEST (nnstreamer_capi_custom, register_filter_reentrant_n)
 {
   ml_custom_easy_filter_h custom;
   ml_tensors_info_h in_info, out_info;
-  int status;
   ml_tensor_dimension dim = { 2, 1, 1, 1 };
+  int status;
 
   ml_tensors_info_create (&in_info);
-  ml_tensors_info_create (&out_info);
-
-
   ml_tensors_info_set_count (in_info, 1);
   ml_tensors_info_set_tensor_type (in_info, 0, ML_TENSOR_TYPE_INT8);
   ml_tensors_info_set_tensor_dimension (in_info, 0, dim);
 
+  ml_tensors_info_create (&out_info);
   ml_tensors_info_set_count (out_info, 1);
   ml_tensors_info_set_tensor_type (out_info, 0, ML_TENSOR_TYPE_FLOAT32);
   ml_tensors_info_set_tensor_dimension (out_info, 0, dim);
 
-  /* test code with null param */
-  status = ml_pipeline_custom_easy_filter_register (
-      NULL, in_info, out_info, test_custom_easy_cb, NULL, &custom);
-  EXPECT_NE (status, ML_ERROR_NONE);
+  status = ml_pipeline_custom_easy_filter_register_full ("tfilter_flags_test",
+      in_info, out_info, test_custom_easy_cb, NULL, 0x100, &custom);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
 
   ml_tensors_info_destroy (in_info);
   ml_tensors_info_destroy (out_info);
 }
 
 /**
- * @brief Test for custom-easy registration.
- * @detail Invalid params.
+ * @brief Invoke callback for custom-easy filter, which takes 20ms to process a frame.
  */
-TEST (nnstreamer_capi_custom, register_filter_03_n)
+static int
+test_custom_easy_slow_cb (const ml_tensors_data_h in, ml_tensors_data_h out,
+    void *user_data)
 {
-  const char test_custom_filter[] = "test-custom-filter";
-  ml_custom_easy_filter_h custom;
-  ml_tensors_info_h out_info;
-  int status;
-  ml_tensor_dimension dim = { 2, 1, 1, 1 };
-
-  ml_tensors_info_create (&out_info);
-
-  ml_tensors_info_set_count (out_info, 1);
-  ml_tensors_info_set_tensor_type (out_info, 0, ML_TENSOR_TYPE_FLOAT32);
-  ml_tensors_info_set_tensor_dimension (out_info, 0, dim);
-
-  /* test code with null param */
-  status = ml_pipeline_custom_easy_filter_register (
-      test_custom_filter, NULL, out_info, test_custom_easy_cb, NULL, &custom);
-  EXPECT_NE (status, ML_ERROR_NONE);
-
-  ml_tensors_info_destroy (out_info);
+  g_usleep (20000);
+  return 0;
 }
 
 /**
- * @brief Test for custom-easy registration.
- * @detail Invalid params.
+ * @brief Test NNStreamer pipeline QoS, drop the late frames before tensor_filter.
  */
-TEST (nnstreamer_capi_custom, register_filter_04_n)
+TEST (nnstreamer_capi_qos, drop_frames_01_p)
 {
-  const char test_custom_filter[] = "test-custom-filter";
+  const char pipeline[] = "appsrc name=srcx ! other/tensor,dimension=(string)2:1:1:1,type=(string)int8,framerate=(fraction)0/1 ! "
+      "tensor_filter name=filterx framework=custom-easy model=tfilter_qos_test ! tensor_sink name=sinkx";
+  ml_pipeline_h pipe;
+  ml_pipeline_src_h src;
+  ml_pipeline_sink_h sink;
   ml_custom_easy_filter_h custom;
-  ml_tensors_info_h in_info;
-  int status;
+  ml_tensors_info_h info;
+  ml_tensors_data_h data;
   ml_tensor_dimension dim = { 2, 1, 1, 1 };
+  ml_pipeline_node_qos_s qos;
+  guint *count_sink;
+  guint i;
+  int status;
 
-  ml_tensors_info_create (&in_info);
-
-  ml_tensors_info_set_count (in_info, 1);
-  ml_tensors_info_set_tensor_type (in_info, 0, ML_TENSOR_TYPE_INT8);
-  ml_tensors_info_set_tensor_dimension (in_info, 0, dim);
-
-  /* test code with null param */
-  status = ml_pipeline_custom_easy_filter_register (
-      test_custom_filter, in_info, NULL, test_custom_easy_cb, NULL, &custom);
-  EXPECT_NE (status, ML_ERROR_NONE);
-
-  ml_tensors_info_destroy (in_info);
-}
+  count_sink = (guint *) g_malloc0 (sizeof (guint));
+  ASSERT_TRUE (count_sink != NULL);
 
-/**
- * @brief Test for custom-easy registration.
- * @detail Invalid params.
- */
-TEST (nnstreamer_capi_custom, register_filter_05_n)
-{
-  const char test_custom_filter[] = "test-custom-filter";
-  ml_custom_easy_filter_h custom;
-  ml_tensors_info_h in_info, out_info;
-  int status;
-  ml_tensor_dimension dim = { 2, 1, 1, 1 };
+  ml_tensors_info_create (&info);
+  ml_tensors_info_set_count (info, 1);
+  ml_tensors_info_set_tensor_type (info, 0, ML_TENSOR_TYPE_INT8);
+  ml_tensors_info_set_tensor_dimension (info, 0, dim);
 
-  ml_tensors_info_create (&in_info);
-  ml_tensors_info_create (&out_info);
+  status = ml_pipeline_custom_easy_filter_register ("tfilter_qos_test",
+      info, info, test_custom_easy_slow_cb, NULL, &custom);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-  ml_tensors_info_set_count (in_info, 1);
-  ml_tensors_info_set_tensor_type (in_info, 0, ML_TENSOR_TYPE_INT8);
-  ml_tensors_info_set_tensor_dimension (in_info, 0, dim);
+  status = ml_pipeline_construct (pipeline, NULL, NULL, &pipe);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-  ml_tensors_info_set_count (out_info, 1);
-  ml_tensors_info_set_tensor_type (out_info, 0, ML_TENSOR_TYPE_FLOAT32);
-  ml_tensors_info_set_tensor_dimension (out_info, 0, dim);
+  status = ml_pipeline_set_qos (pipe, 30);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-  /* test code with null param */
-  status = ml_pipeline_custom_easy_filter_register (
-      test_custom_filter, in_info, out_info, NULL, NULL, &custom);
-  EXPECT_NE (status, ML_ERROR_NONE);
+  status = ml_pipeline_sink_register (pipe, "sinkx", test_sink_callback_count, count_sink, &sink);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-  ml_tensors_info_destroy (in_info);
-  ml_tensors_info_destroy (out_info);
-}
+  status = ml_pipeline_src_get_handle (pipe, "srcx", &src);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-/**
- * @brief Test for custom-easy registration.
- * @detail Invalid params.
- */
-TEST (nnstreamer_capi_custom, register_filter_06_n)
-{
-  const char test_custom_filter[] = "test-custom-filter";
-  ml_tensors_info_h in_info, out_info;
-  int status;
-  ml_tensor_dimension dim = { 2, 1, 1, 1 };
+  status = ml_pipeline_start (pipe);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-  ml_tensors_info_create (&in_info);
-  ml_tensors_info_create (&out_info);
+  /* push the frames faster than the filter, the queued frames are late. */
+  for (i = 0; i < 20; i++) {
+    status = ml_tensors_data_create (info, &data);
+    EXPECT_EQ (status, ML_ERROR_NONE);
 
-  ml_tensors_info_set_count (in_info, 1);
-  ml_tensors_info_set_tensor_type (in_info, 0, ML_TENSOR_TYPE_INT8);
-  ml_tensors_info_set_tensor_dimension (in_info, 0, dim);
+    status = ml_pipeline_src_input_data (src, data, ML_PIPELINE_BUF_POLICY_AUTO_FREE);
+    EXPECT_EQ (status, ML_ERROR_NONE);
+  }
 
-  ml_tensors_info_set_count (out_info, 1);
-  ml_tensors_info_set_tensor_type (out_info, 0, ML_TENSOR_TYPE_FLOAT32);
-  ml_tensors_info_set_tensor_dimension (out_info, 0, dim);
+  g_usleep (500000);
 
-  /* test code with null param */
-  status = ml_pipeline_custom_easy_filter_register (
-      test_custom_filter, in_info, out_info, test_custom_easy_cb, NULL, NULL);
-  EXPECT_NE (status, ML_ERROR_NONE);
+  status = ml_pipeline_get_qos (pipe, "filterx", &qos);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (qos.frames_in, 20U);
+  EXPECT_GT (qos.dropped, 0U);
+  EXPECT_GT (qos.drop_rate, 0.0);
+  EXPECT_GT (qos.process_time, 0U);
 
-  ml_tensors_info_destroy (in_info);
-  ml_tensors_info_destroy (out_info);
-}
+  /* the filter keeps processing the frames */
+  EXPECT_GT (*count_sink, 0U);
+  EXPECT_EQ (*count_sink + qos.dropped, 20U);
 
-/**
- * @brief Test for custom-easy registration.
- * @detail Invalid params.
- */
-TEST (nnstreamer_capi_custom, register_filter_07_n)
-{
-  int status;
+  status = ml_pipeline_stop (pipe);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-  /* test code with null param */
-  status = ml_pipeline_custom_easy_filter_unregister (NULL);
-  EXPECT_NE (status, ML_ERROR_NONE);
-}
+  /* disable QoS */
+  status = ml_pipeline_set_qos (pipe, 0);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-/**
- * @brief Test for custom-easy registration.
- * @detail Invalid params.
- */
-TEST (nnstreamer_capi_custom, register_filter_08_n)
-{
-  const char test_custom_filter[] = "test-custom-filter";
-  ml_custom_easy_filter_h custom;
-  ml_tensors_info_h in_info, out_info;
-  ml_tensor_dimension dim = { 2, 1, 1, 1 };
-  int status;
+  status = ml_pipeline_get_qos (pipe, "filterx", &qos);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
 
-  ml_tensors_info_create (&in_info);
-  ml_tensors_info_create (&out_info);
+  status = ml_pipeline_src_release_handle (src);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-  /* test code with invalid output info */
-  ml_tensors_info_set_count (in_info, 1);
-  ml_tensors_info_set_tensor_type (in_info, 0, ML_TENSOR_TYPE_INT8);
-  ml_tensors_info_set_tensor_dimension (in_info, 0, dim);
+  status = ml_pipeline_sink_unregister (sink);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_pipeline_custom_easy_filter_register (
-      test_custom_filter, in_info, out_info, test_custom_easy_cb, NULL, &custom);
-  EXPECT_NE (status, ML_ERROR_NONE);
+  status = ml_pipeline_destroy (pipe);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-  ml_tensors_info_destroy (in_info);
-  ml_tensors_info_destroy (out_info);
+  status = ml_pipeline_custom_easy_filter_unregister (custom);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  ml_tensors_info_destroy (info);
+  g_free (count_sink);
 }
 
 /**
- * @brief Test for custom-easy registration.
- * @detail Invalid params.
+ * @brief Invoke callback for custom-easy filter, which processes a frame immediately.
  */
-TEST (nnstreamer_capi_custom, register_filter_09_n)
+static int
+test_custom_easy_fast_cb (const ml_tensors_data_h in, ml_tensors_data_h out,
+    void *user_data)
 {
-  const char test_custom_filter[] = "test-custom-filter";
-  ml_custom_easy_filter_h custom;
-  ml_tensors_info_h in_info, out_info;
-  ml_tensor_dimension dim = { 2, 1, 1, 1 };
-  int status;
-
-  ml_tensors_info_create (&in_info);
-  ml_tensors_info_create (&out_info);
-
-  /* test code with invalid input info */
-  ml_tensors_info_set_count (out_info, 1);
-  ml_tensors_info_set_tensor_type (out_info, 0, ML_TENSOR_TYPE_FLOAT32);
-  ml_tensors_info_set_tensor_dimension (out_info, 0, dim);
-
-  status = ml_pipeline_custom_easy_filter_register (
-      test_custom_filter, in_info, out_info, test_custom_easy_cb, NULL, &custom);
-  EXPECT_NE (status, ML_ERROR_NONE);
-
-  ml_tensors_info_destroy (in_info);
-  ml_tensors_info_destroy (out_info);
+  return 0;
 }
 
 /**
- * @brief Test for custom-easy registration.
- * @detail Invalid params.
+ * @brief Test NNStreamer pipeline QoS with two filters, the downstream filter does not count the delay of upstream filter.
  */
-TEST (nnstreamer_capi_custom, register_filter_10_n)
+TEST (nnstreamer_capi_qos, drop_frames_02_p)
 {
-  const char test_custom_filter[] = "test-custom-filter";
-  ml_custom_easy_filter_h custom, custom2;
-  ml_tensors_info_h in_info, out_info;
+  const char pipeline[] = "appsrc name=srcx ! other/tensor,dimension=(string)2:1:1:1,type=(string)int8,framerate=(fraction)0/1 ! "
+      "tensor_filter name=filterx framework=custom-easy model=tfilter_qos_slow ! "
+      "tensor_filter name=filtery framework=custom-easy model=tfilter_qos_fast ! tensor_sink name=sinkx";
+  ml_pipeline_h pipe;
+  ml_pipeline_src_h src;
+  ml_pipeline_sink_h sink;
+  ml_custom_easy_filter_h custom_slow, custom_fast;
+  ml_tensors_info_h info;
+  ml_tensors_data_h data;
   ml_tensor_dimension dim = { 2, 1, 1, 1 };
+  ml_pipeline_node_qos_s qos_x, qos_y;
+  guint *count_sink;
+  guint i;
   int status;
 
-  ml_tensors_info_create (&in_info);
-  ml_tensors_info_create (&out_info);
+  count_sink = (guint *) g_malloc0 (sizeof (guint));
+  ASSERT_TRUE (count_sink != NULL);
 
-  ml_tensors_info_set_count (in_info, 1);
-  ml_tensors_info_set_tensor_type (in_info, 0, ML_TENSOR_TYPE_INT8);
-  ml_tensors_info_set_tensor_dimension (in_info, 0, dim);
+  ml_tensors_info_create (&info);
+  ml_tensors_info_set_count (info, 1);
+  ml_tensors_info_set_tensor_type (info, 0, ML_TENSOR_TYPE_INT8);
+  ml_tensors_info_set_tensor_dimension (info, 0, dim);
 
-  ml_tensors_info_set_count (out_info, 1);
-  ml_tensors_info_set_tensor_type (out_info, 0, ML_TENSOR_TYPE_FLOAT32);
-  ml_tensors_info_set_tensor_dimension (out_info, 0, dim);
+  status = ml_pipeline_custom_easy_filter_register ("tfilter_qos_slow",
+      info, info, test_custom_easy_slow_cb, NULL, &custom_slow);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-  /* test code for duplicated name */
-  status = ml_pipeline_custom_easy_filter_register (
-      test_custom_filter, in_info, out_info, test_custom_easy_cb, NULL, &custom);
+  status = ml_pipeline_custom_easy_filter_register ("tfilter_qos_fast",
+      info, info, test_custom_easy_fast_cb, NULL, &custom_fast);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_pipeline_custom_easy_filter_register (test_custom_filter, in_info,
-      out_info, test_custom_easy_cb, NULL, &custom2);
-  EXPECT_NE (status, ML_ERROR_NONE);
+  status = ml_pipeline_construct (pipeline, NULL, NULL, &pipe);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_pipeline_custom_easy_filter_unregister (custom);
+  status = ml_pipeline_set_qos (pipe, 30);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  ml_tensors_info_destroy (in_info);
-  ml_tensors_info_destroy (out_info);
-}
+  status = ml_pipeline_sink_register (pipe, "sinkx", test_sink_callback_count, count_sink, &sink);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-/**
- * @brief Test for custom-easy unregistration.
- * @detail Failed if pipeline is constructed.
- */
-TEST (nnstreamer_capi_custom, register_filter_11_n)
-{
-  ml_pipeline_h pipe1, pipe2;
-  ml_custom_easy_filter_h custom;
-  ml_tensors_info_h in_info, out_info;
-  ml_tensor_dimension dim = { 2, 1, 1, 1 };
-  int status;
-  gchar *pipeline = g_strdup_printf (
-      "appsrc name=srcx ! other/tensor,dimension=(string)2:1:1:1,type=(string)int8,framerate=(fraction)0/1 ! "
-      "tensor_filter framework=custom-easy model=tfilter_unreg_test ! tensor_sink name=sinkx");
+  status = ml_pipeline_src_get_handle (pipe, "srcx", &src);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-  ml_tensors_info_create (&in_info);
-  ml_tensors_info_set_count (in_info, 1);
-  ml_tensors_info_set_tensor_type (in_info, 0, ML_TENSOR_TYPE_INT8);
-  ml_tensors_info_set_tensor_dimension (in_info, 0, dim);
+  status = ml_pipeline_start (pipe);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-  ml_tensors_info_create (&out_info);
-  ml_tensors_info_set_count (out_info, 1);
-  ml_tensors_info_set_tensor_type (out_info, 0, ML_TENSOR_TYPE_FLOAT32);
-  ml_tensors_info_set_tensor_dimension (out_info, 0, dim);
+  /* push the frames faster than the first filter. */
+  for (i = 0; i < 20; i++) {
+    status = ml_tensors_data_create (info, &data);
+    EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_pipeline_custom_easy_filter_register ("tfilter_unreg_test",
-      in_info, out_info, test_custom_easy_cb, NULL, &custom);
+    status = ml_pipeline_src_input_data (src, data, ML_PIPELINE_BUF_POLICY_AUTO_FREE);
+    EXPECT_EQ (status, ML_ERROR_NONE);
+  }
+
+  g_usleep (500000);
+
+  /* the first filter drops the late frames. */
+  status = ml_pipeline_get_qos (pipe, "filterx", &qos_x);
   EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (qos_x.frames_in, 20U);
+  EXPECT_GT (qos_x.dropped, 0U);
 
-  status = ml_pipeline_construct (pipeline, NULL, NULL, &pipe1);
+  /* the frames out of the first filter are not queued for the second filter, nothing is dropped. */
+  status = ml_pipeline_get_qos (pipe, "filtery", &qos_y);
   EXPECT_EQ (status, ML_ERROR_NONE);
+  EXPECT_EQ (qos_y.frames_in, 20U - qos_x.dropped);
+  EXPECT_EQ (qos_y.dropped, 0U);
 
-  status = ml_pipeline_construct (pipeline, NULL, NULL, &pipe2);
+  EXPECT_GT (*count_sink, 0U);
+  EXPECT_EQ (*count_sink + qos_x.dropped, 20U);
+
+  status = ml_pipeline_stop (pipe);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  /* failed to unregister custom-easy filter if pipeline is constructed */
-  status = ml_pipeline_custom_easy_filter_unregister (custom);
-  EXPECT_NE (status, ML_ERROR_NONE);
+  status = ml_pipeline_src_release_handle (src);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_pipeline_destroy (pipe1);
+  status = ml_pipeline_sink_unregister (sink);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_pipeline_custom_easy_filter_unregister (custom);
-  EXPECT_NE (status, ML_ERROR_NONE);
+  status = ml_pipeline_destroy (pipe);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 
-  status = ml_pipeline_destroy (pipe2);
+  status = ml_pipeline_custom_easy_filter_unregister (custom_slow);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  /* succesfully done if all pipelines with custom-easy filter are destroyed */
-  status = ml_pipeline_custom_easy_filter_unregister (custom);
+  status = ml_pipeline_custom_easy_filter_unregister (custom_fast);
   EXPECT_EQ (status, ML_ERROR_NONE);
 
-  ml_tensors_info_destroy (in_info);
-  ml_tensors_info_destroy (out_info);
-  g_free (pipeline);
+  ml_tensors_info_destroy (info);
+  g_free (count_sink);
+}
+
+/**
+ * @brief Test NNStreamer pipeline QoS with invalid param.
+ */
+TEST (nnstreamer_capi_qos, invalid_param_n)
+{
+  const char pipeline[] = "videotestsrc num-buffers=3 ! videoconvert ! valve name=valvex ! tensor_converter ! tensor_sink name=sinkx";
+  ml_pipeline_h pipe;
+  ml_pipeline_node_qos_s qos;
+  int status;
+
+  status = ml_pipeline_set_qos (NULL, 30);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  status = ml_pipeline_construct (pipeline, NULL, NULL, &pipe);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  /* no tensor_filter in the pipeline */
+  status = ml_pipeline_set_qos (pipe, 30);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  status = ml_pipeline_get_qos (pipe, "valvex", &qos);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  status = ml_pipeline_get_qos (pipe, "unknown", &qos);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  status = ml_pipeline_get_qos (pipe, "valvex", NULL);
+  EXPECT_EQ (status, ML_ERROR_INVALID_PARAMETER);
+
+  status = ml_pipeline_destroy (pipe);
+  EXPECT_EQ (status, ML_ERROR_NONE);
 }
 
 /**
@@ -10548,6 +14573,139 @@ TEST (nnstreamer_capi_if, custom_01_p)
   g_free (file);
 }
 
+/**
+ * @brief Test for tensor_if built-in condition
+ */
+TEST (nnstreamer_capi_if, condition_01_p)
+{
+  ml_pipeline_h pipe;
+  ml_pipeline_src_h srchandle;
+  ml_pipeline_sink_h sink_true, sink_false;
+  ml_pipeline_if_h custom;
+  ml_tensors_info_h info;
+  ml_tensors_data_h data;
+  const unsigned int classes[] = { 1, 2 };
+  float scores[4];
+  int status;
+  guint i;
+  const gchar pipeline[] =
+      "appsrc name=appsrc ! other/tensor,dimension=(string)4:1:1:1, type=(string)float32,framerate=(fraction)0/1 ! "
+      "tensor_if name=tif compared-value=CUSTOM compared-value-option=tif_condition_test then=PASSTHROUGH else=PASSTHROUGH "
+      "tif.src_0 ! queue ! tensor_sink name=sink_true sync=false async=false "
+      "tif.src_1 ! queue ! tensor_sink name=sink_false sync=false async=false";
+
+  guint *count_true = (guint *)g_malloc0 (sizeof (guint));
+  guint *count_false = (guint *)g_malloc0 (sizeof (guint));
+  ASSERT_TRUE (count_true != NULL);
+  ASSERT_TRUE (count_false != NULL);
+
+  /* TRUE if the class is 1 or 2, and its score is greater than 0.5 */
+  status = ml_pipeline_tensor_if_condition_register ("tif_condition_test",
+      ML_PIPELINE_IF_CONDITION_CLASS_IN_SET, 0, 0.5, classes, 2, &custom);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_pipeline_construct (pipeline, NULL, NULL, &pipe);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_pipeline_sink_register (
+      pipe, "sink_true", test_sink_callback_count, count_true, &sink_true);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_pipeline_sink_register (
+      pipe, "sink_false", test_sink_callback_count, count_false, &sink_false);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_pipeline_src_get_handle (pipe, "appsrc", &srchandle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_pipeline_start (pipe);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_pipeline_src_get_tensors_info (srchandle, &info);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_tensors_data_create (info, &data);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  /* The class of max score is (i % 4), the score of first 5 buffers is 0.9. */
+  for (i = 0; i < 10; i++) {
+    scores[0] = scores[1] = scores[2] = scores[3] = 0.1f;
+    scores[i % 4] = (i < 5) ? 0.9f : 0.3f;
+
+    status = ml_tensors_data_set_tensor_data (data, 0, scores, sizeof (scores));
+    EXPECT_EQ (status, ML_ERROR_NONE);
+
+    status = ml_pipeline_src_input_data (srchandle, data,
+        ML_PIPELINE_BUF_POLICY_DO_NOT_FREE);
+    EXPECT_EQ (status, ML_ERROR_NONE);
+
+    g_usleep (50000); /* 50ms. Wait a bit. */
+  }
+
+  status = ml_pipeline_stop (pipe);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_pipeline_src_release_handle (srchandle);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_pipeline_sink_unregister (sink_true);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_pipeline_sink_unregister (sink_false);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_pipeline_destroy (pipe);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  status = ml_pipeline_tensor_if_custom_unregister (custom);
+  EXPECT_EQ (status, ML_ERROR_NONE);
+
+  /* The buffers with class 1 and 2 (index 1 and 2) pass the TRUE path. */
+  EXPECT_EQ (*count_true, 2U);
+  EXPECT_EQ (*count_false, 8U);
+
+  ml_tensors_info_destroy (info);
+  ml_tensors_data_destroy (data);
+  g_free (count_true);
+  g_free (count_false);
+}
+
+/**
+ * @brief Test for tensor_if built-in condition registration.
+ * @detail Invalid params.
+ */
+TEST (nnstreamer_capi_if, condition_02_n)
+{
+  ml_pipeline_if_h custom;
+  const unsigned int classes[] = { 1, 2 };
+  int status;
+
+  status = ml_pipeline_tensor_if_condition_register (NULL,
+      ML_PIPELINE_IF_CONDITION_MAX_SCORE_GT, 0, 0.5, NULL, 0, &custom);
+  EXPECT_NE (status, ML_ERROR_NONE);
+
+  status = ml_pipeline_tensor_if_condition_register ("tif_condition_test",
+      ML_PIPELINE_IF_CONDITION_MAX_SCORE_GT, 0, 0.5, NULL, 0, NULL);
+  EXPECT_NE (status, ML_ERROR_NONE);
+
+  status = ml_pipeline_tensor_if_condition_register ("tif_condition_test",
+      ML_PIPELINE_IF_CONDITION_MAX_SCORE_GT, ML_TENSOR_SIZE_LIMIT, 0.5, NULL, 0, &custom);
+  EXPECT_NE (status, ML_ERROR_NONE);
+
+  /* class set is mandatory */
+  status = ml_pipeline_tensor_if_condition_register ("tif_condition_test",
+      ML_PIPELINE_IF_CONDITION_CLASS_IN_SET, 0, 0.5, NULL, 2, &custom);
+  EXPECT_NE (status, ML_ERROR_NONE);
+
+  status = ml_pipeline_tensor_if_condition_register ("tif_condition_test",
+      ML_PIPELINE_IF_CONDITION_CLASS_IN_SET, 0, 0.5, classes, 0, &custom);
+  EXPECT_NE (status, ML_ERROR_NONE);
+
+  status = ml_pipeline_tensor_if_condition_register ("tif_condition_test",
+      (ml_pipeline_if_condition_e) 100, 0, 0.5, classes, 2, &custom);
+  EXPECT_NE (status, ML_ERROR_NONE);
+}
+
 /**
  * @brief Test for tensor_if custom registration.
  * @detail Invalid params.
@@ -278,6 +278,82 @@ TEST_F (nnstreamer_capi_singleshot_latency, benchmarkNNFWRuntime)
 }
 #endif
 
+/**
+ * @brief The number of measurements to compare the time to access the tensors data, the fastest one is used.
+ */
+#define DATA_ACCESS_REPEAT 5
+
+/**
+ * @brief Measure the time to access the tensors data.
+ * @return The fastest time (ns) to get the tensor data in the repeated measurements.
+ */
+static float
+benchmarkDataAccess (ml_tensors_data_h data)
+{
+  int64_t start, end;
+  void *raw;
+  size_t size;
+  int idx, rep, failed = 0;
+  float elapsed, fastest = -1.0f;
+
+  for (rep = 0; rep < DATA_ACCESS_REPEAT; rep++) {
+    start = g_get_monotonic_time ();
+    for (idx = 0; idx < RUN_COUNT * 10000; ++idx) {
+      if (ml_tensors_data_get_tensor_data (data, 0, &raw, &size) != ML_ERROR_NONE)
+        failed++;
+    }
+    end = g_get_monotonic_time ();
+
+    elapsed = ((end - start) * 1000.0f) / (RUN_COUNT * 10000);
+    if (fastest < 0.0f || elapsed < fastest)
+      fastest = elapsed;
+  }
+
+  EXPECT_EQ (failed, 0);
+  return fastest;
+}
+
+/**
+ * @brief Measure the overhead of the lock to access the tensors data.
+ * @note Compare the handle created with lock and the handle created without lock in the owner thread.
+ *       The handle without lock should not be slower than the handle with lock, allowing 20% and 1ns of the noise.
+ */
+TEST (nnstreamer_capi_util_latency, benchmarkDataAccessUnlocked)
+{
+  ml_tensors_info_h info;
+  ml_tensors_data_h data;
+  ml_tensor_dimension dim = { 3, 224, 224, 1 };
+  float locked_ns, unlocked_ns;
+  int status;
+
+  ml_tensors_info_create (&info);
+  ml_tensors_info_set_count (info, 1);
+  ml_tensors_info_set_tensor_type (info, 0, ML_TENSOR_TYPE_UINT8);
+  ml_tensors_info_set_tensor_dimension (info, 0, dim);
+
+  status = ml_tensors_data_create (info, &data);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+  locked_ns = benchmarkDataAccess (data);
+  ml_tensors_data_destroy (data);
+
+  status = ml_tensors_data_create_unlocked (info, &data);
+  ASSERT_EQ (status, ML_ERROR_NONE);
+  unlocked_ns = benchmarkDataAccess (data);
+  ml_tensors_data_destroy (data);
+
+  g_warning ("Time to get tensor data = %f ns (with lock), %f ns (without lock)",
+      locked_ns, unlocked_ns);
+
+  EXPECT_GT (locked_ns, 0.0f);
+
+  /* the timing depends on the machine, report it instead of failing the test */
+  if (unlocked_ns > locked_ns * 1.2f + 1.0f)
+    g_warning ("The access without lock (%f ns) is slower than with lock (%f ns).",
+        unlocked_ns, locked_ns);
+
+  ml_tensors_info_destroy (info);
+}
+
 /**
  * @brief Main gtest
  */